@@ -68,6 +68,10 @@ cmake_dependent_option(OQS_USE_SHA2_OPENSSL "" ON "OQS_USE_OPENSSL" OFF)
 # Disable OpenSSL's SHA3 by default. The implementation is not complete
 # enough to support our incremental API.
 cmake_dependent_option(OQS_USE_SHA3_OPENSSL "" OFF "OQS_USE_OPENSSL" OFF)
+# With OpenSSL's SHA3, also build XKCP and choose the backend per primitive.
+# OpenSSL before 3.3 can only emulate incremental squeezing, at quadratic cost.
+cmake_dependent_option(OQS_USE_SHA3_ROUTING "Select OpenSSL or XKCP per SHA3 primitive" ON "OQS_USE_SHA3_OPENSSL" OFF)
+set(OQS_SHA3_OPENSSL_ROUTES "auto" CACHE STRING "SHA3 primitives served by OpenSSL with OQS_USE_SHA3_ROUTING: auto, all, none, or a list of sha3, sha3_inc, shake, shake_inc, x4")
 
 # sanity check: Disable OpenSSL if not a single OpenSSL component define is on
 cmake_dependent_option(OQS_USE_OPENSSL "" ON "OQS_USE_AES_OPENSSL OR OQS_USE_SHA2_OPENSSL OR OQS_USE_SHA3_OPENSSL" OFF)
@@ -76,17 +80,68 @@ option(OQS_DLOPEN_OPENSSL "Enable OpenSSL through dlopen" OFF)
 
 if(CMAKE_SYSTEM_NAME MATCHES "Linux|Darwin")
 if(OQS_DIST_X86_64_BUILD OR OQS_USE_AVX2_INSTRUCTIONS)
-    cmake_dependent_option(OQS_ENABLE_SHA3_xkcp_low_avx2 "" ON "NOT OQS_USE_SHA3_OPENSSL" OFF)
+    cmake_dependent_option(OQS_ENABLE_SHA3_xkcp_low_avx2 "" ON "NOT OQS_USE_SHA3_OPENSSL OR OQS_USE_SHA3_ROUTING" OFF)
 endif()
 endif()
 
+# SHA3 using the ARMv8.2 SHA3 extension (EOR3, RAX1, XAR, BCAX); the intrinsics need GCC 8 or Clang
+if(CMAKE_SYSTEM_NAME MATCHES "Linux|Darwin" AND (OQS_DIST_ARM64_V8_BUILD OR OQS_USE_ARM_SHA3_INSTRUCTIONS)
+   AND NOT (CMAKE_C_COMPILER_ID STREQUAL "GNU" AND CMAKE_C_COMPILER_VERSION VERSION_LESS "8.0.0"))
+    cmake_dependent_option(OQS_ENABLE_SHA3_xkcp_low_armv8a_sha3 "" ON "NOT OQS_USE_SHA3_OPENSSL OR OQS_USE_SHA3_ROUTING" OFF)
+endif()
+
 # SHA3 AVX512VL only supported on Linux x86_64
 if(CMAKE_SYSTEM_NAME STREQUAL "Linux" AND (OQS_DIST_X86_64_BUILD OR OQS_USE_AVX512_INSTRUCTIONS))
-    cmake_dependent_option(OQS_USE_SHA3_AVX512VL "Enable SHA3 AVX512VL usage" ON "NOT OQS_USE_SHA3_OPENSSL" OFF)
+    cmake_dependent_option(OQS_USE_SHA3_AVX512VL "Enable SHA3 AVX512VL usage" ON "NOT OQS_USE_SHA3_OPENSSL OR OQS_USE_SHA3_ROUTING" OFF)
 else()
     option(OQS_USE_SHA3_AVX512VL "Enable SHA3 AVX512VL usage" OFF)
 endif()
 
+# AVX-512 NTT and rejection sampling for the x86_64 ML-KEM implementations
+if(CMAKE_SYSTEM_NAME MATCHES "Linux|Darwin" AND (OQS_DIST_X86_64_BUILD OR (OQS_USE_AVX512_INSTRUCTIONS AND OQS_USE_AVX512VBMI2_INSTRUCTIONS)))
+    option(OQS_USE_ML_KEM_AVX512 "Enable the AVX-512 code in the x86_64 ML-KEM implementations" ON)
+else()
+    option(OQS_USE_ML_KEM_AVX512 "Enable the AVX-512 code in the x86_64 ML-KEM implementations" OFF)
+endif()
+
+# AVX-512 encapsulation syndrome for the x86_64 Classic McEliece implementations with large public keys
+if(CMAKE_SYSTEM_NAME MATCHES "Linux|Darwin" AND (OQS_DIST_X86_64_BUILD OR OQS_USE_AVX512_INSTRUCTIONS))
+    option(OQS_USE_CLASSIC_MCELIECE_AVX512 "Enable the AVX-512 syndrome in the x86_64 Classic McEliece implementations" ON)
+else()
+    option(OQS_USE_CLASSIC_MCELIECE_AVX512 "Enable the AVX-512 syndrome in the x86_64 Classic McEliece implementations" OFF)
+endif()
+
+# Compiler vector-extension NTTs for ML-KEM, ML-DSA and Falcon on targets without hand-written SIMD code;
+# on by default on POWER and IBM Z when the compiler targets their vector unit (VSX or the z13 vector facility)
+set(OQS_USE_VECTOR_EXTENSIONS_DEFAULT OFF)
+if((ARCH_PPC64LE OR ARCH_PPC64 OR ARCH_S390X) AND CMAKE_C_COMPILER_ID MATCHES "GNU|Clang"
+   AND NOT (CMAKE_C_COMPILER_ID STREQUAL "GNU" AND CMAKE_C_COMPILER_VERSION VERSION_LESS 9))
+    include(CheckCSourceCompiles)
+    check_c_source_compiles("
+#if !defined(__VSX__) && !defined(__VX__)
+#error no vector unit
+#endif
+typedef short v4i16 __attribute__((vector_size(8)));
+typedef int v4i32 __attribute__((vector_size(16)));
+int main(void) {
+    v4i32 a = {1, 2, 3, 4};
+    v4i16 b = __builtin_convertvector(a * a, v4i16);
+    return b[3] - 16;
+}" OQS_HAVE_VECTOR_UNIT)
+    if(OQS_HAVE_VECTOR_UNIT)
+        set(OQS_USE_VECTOR_EXTENSIONS_DEFAULT ON)
+    endif()
+endif()
+option(OQS_USE_VECTOR_EXTENSIONS "Use GCC/Clang vector extensions in the reference NTTs of ML-KEM, ML-DSA and Falcon" ${OQS_USE_VECTOR_EXTENSIONS_DEFAULT})
+if(OQS_USE_VECTOR_EXTENSIONS)
+    if(NOT CMAKE_C_COMPILER_ID MATCHES "GNU|Clang")
+        message(FATAL_ERROR "OQS_USE_VECTOR_EXTENSIONS requires GCC or Clang")
+    elseif(CMAKE_C_COMPILER_ID STREQUAL "GNU" AND CMAKE_C_COMPILER_VERSION VERSION_LESS 9)
+        # __builtin_convertvector
+        message(FATAL_ERROR "OQS_USE_VECTOR_EXTENSIONS requires GCC 9 or later")
+    endif()
+endif()
+
 # BIKE is not supported on Windows, 32-bit ARM, X86, S390X (big endian) and PPC64 (big endian)
 cmake_dependent_option(OQS_ENABLE_KEM_BIKE "Enable BIKE algorithm family" ON "NOT WIN32; NOT ARCH_ARM32v7; NOT ARCH_X86; NOT ARCH_S390X; NOT ARCH_PPC64" OFF)
 # BIKE doesn't work on any 32-bit platform
@@ -641,18 +696,36 @@ if(OQS_DIST_X86_64_BUILD OR (OQS_USE_AVX2_INSTRUCTIONS AND OQS_USE_POPCNT_INSTRU
 endif()
 endif()
 
+if(CMAKE_SYSTEM_NAME MATCHES "Linux|Darwin")
+if(OQS_DIST_ARM64_V8_BUILD OR (OQS_USE_ARM_NEON_INSTRUCTIONS AND OQS_USE_ARM_NEON_INSTRUCTIONS))
+    cmake_dependent_option(OQS_ENABLE_SIG_ml_dsa_44_aarch64 "" ON "OQS_ENABLE_SIG_ml_dsa_44" OFF)
+endif()
+endif()
+
 if(CMAKE_SYSTEM_NAME MATCHES "Darwin|Linux")
 if(OQS_DIST_X86_64_BUILD OR (OQS_USE_AVX2_INSTRUCTIONS AND OQS_USE_POPCNT_INSTRUCTIONS))
     cmake_dependent_option(OQS_ENABLE_SIG_ml_dsa_65_avx2 "" ON "OQS_ENABLE_SIG_ml_dsa_65" OFF)
 endif()
 endif()
 
+if(CMAKE_SYSTEM_NAME MATCHES "Linux|Darwin")
+if(OQS_DIST_ARM64_V8_BUILD OR (OQS_USE_ARM_NEON_INSTRUCTIONS AND OQS_USE_ARM_NEON_INSTRUCTIONS))
+    cmake_dependent_option(OQS_ENABLE_SIG_ml_dsa_65_aarch64 "" ON "OQS_ENABLE_SIG_ml_dsa_65" OFF)
+endif()
+endif()
+
 if(CMAKE_SYSTEM_NAME MATCHES "Darwin|Linux")
 if(OQS_DIST_X86_64_BUILD OR (OQS_USE_AVX2_INSTRUCTIONS AND OQS_USE_POPCNT_INSTRUCTIONS))
     cmake_dependent_option(OQS_ENABLE_SIG_ml_dsa_87_avx2 "" ON "OQS_ENABLE_SIG_ml_dsa_87" OFF)
 endif()
 endif()
 
+if(CMAKE_SYSTEM_NAME MATCHES "Linux|Darwin")
+if(OQS_DIST_ARM64_V8_BUILD OR (OQS_USE_ARM_NEON_INSTRUCTIONS AND OQS_USE_ARM_NEON_INSTRUCTIONS))
+    cmake_dependent_option(OQS_ENABLE_SIG_ml_dsa_87_aarch64 "" ON "OQS_ENABLE_SIG_ml_dsa_87" OFF)
+endif()
+endif()
+
 
 if(OQS_DIST_X86_64_BUILD OR (OQS_USE_AVX2_INSTRUCTIONS))
     cmake_dependent_option(OQS_ENABLE_SIG_falcon_512_avx2 "" ON "OQS_ENABLE_SIG_falcon_512" OFF)
@@ -1294,12 +1367,51 @@ if(OQS_ALLOW_STFL_KEY_AND_SIG_GEN  STREQUAL "ON")
     message(STATUS "Experimental stateful key and signature generation is enabled. Ensure secret keys are securely stored to prevent multiple simultaneous sign operations.")
 endif()
 
+cmake_dependent_option(OQS_ML_DSA_LOW_STACK "Build ML-DSA with a streaming implementation that keeps only a few polynomials on the stack" OFF "OQS_ENABLE_SIG_ML_DSA" OFF)
+if(OQS_ML_DSA_LOW_STACK)
+    # The AVX2 and AArch64 implementations hold the expanded matrix on the stack.
+    set(OQS_ENABLE_SIG_ml_dsa_44_avx2 OFF)
+    set(OQS_ENABLE_SIG_ml_dsa_65_avx2 OFF)
+    set(OQS_ENABLE_SIG_ml_dsa_87_avx2 OFF)
+    set(OQS_ENABLE_SIG_ml_dsa_44_aarch64 OFF)
+    set(OQS_ENABLE_SIG_ml_dsa_65_aarch64 OFF)
+    set(OQS_ENABLE_SIG_ml_dsa_87_aarch64 OFF)
+endif()
+
+cmake_dependent_option(OQS_ML_DSA_SPECULATIVE_SIGN "Evaluate several ML-DSA signing attempts in parallel threads to cut the tail latency of signing" OFF "OQS_ENABLE_SIG_ML_DSA;OQS_USE_PTHREADS;NOT OQS_ML_DSA_LOW_STACK" OFF)
+
+cmake_dependent_option(OQS_CLASSIC_MCELIECE_PARALLEL_SYNDROME "Split the Classic McEliece encapsulation syndrome across a pool of worker threads" OFF "OQS_ENABLE_KEM_CLASSIC_MCELIECE;OQS_USE_CLASSIC_MCELIECE_AVX512;OQS_USE_PTHREADS" OFF)
+
 # Set XKCP (Keccak) required for Sphincs and SNOVA AVX2 code even if OpenSSL3 SHA3 is used:
-if (${OQS_ENABLE_SIG_SPHINCS} OR ${OQS_ENABLE_SIG_SNOVA} OR NOT ${OQS_USE_SHA3_OPENSSL})
+if (${OQS_ENABLE_SIG_SPHINCS} OR ${OQS_ENABLE_SIG_SNOVA} OR NOT ${OQS_USE_SHA3_OPENSSL} OR ${OQS_USE_SHA3_ROUTING})
     set(OQS_ENABLE_SHA3_xkcp_low ON)
 else()
     set(OQS_ENABLE_SHA3_xkcp_low OFF)
 endif()
+
+# Bit i of OQS_SHA3_OPENSSL_ROUTE_MASK sends OQS_SHA3_ROUTE i to OpenSSL.
+# "auto" keeps incremental SHA3 hashing on OpenSSL, and the one-shot hashes
+# (an EVP_MD_CTX allocation per call) and all XOF squeezing on XKCP.
+if(OQS_USE_SHA3_ROUTING)
+    set(_SHA3_ROUTES sha3 sha3_inc shake shake_inc x4)
+    if(OQS_SHA3_OPENSSL_ROUTES STREQUAL "auto")
+        set(_SHA3_OPENSSL_ROUTES sha3_inc)
+    elseif(OQS_SHA3_OPENSSL_ROUTES STREQUAL "all")
+        set(_SHA3_OPENSSL_ROUTES ${_SHA3_ROUTES})
+    elseif(OQS_SHA3_OPENSSL_ROUTES STREQUAL "none")
+        set(_SHA3_OPENSSL_ROUTES "")
+    else()
+        set(_SHA3_OPENSSL_ROUTES ${OQS_SHA3_OPENSSL_ROUTES})
+    endif()
+    set(OQS_SHA3_OPENSSL_ROUTE_MASK 0)
+    foreach(_route ${_SHA3_OPENSSL_ROUTES})
+        list(FIND _SHA3_ROUTES ${_route} _route_index)
+        if(_route_index EQUAL -1)
+            message(FATAL_ERROR "Unknown SHA3 route '${_route}' in OQS_SHA3_OPENSSL_ROUTES")
+        endif()
+        math(EXPR OQS_SHA3_OPENSSL_ROUTE_MASK "${OQS_SHA3_OPENSSL_ROUTE_MASK} | (1 << ${_route_index})")
+    endforeach()
+endif()
 if(CMAKE_SYSTEM_NAME MATCHES "Linux|Darwin")
     if(OQS_DIST_X86_64_BUILD OR OQS_USE_AVX2_INSTRUCTIONS)
         set(OQS_ENABLE_SHA3_xkcp_low_avx2 ON)
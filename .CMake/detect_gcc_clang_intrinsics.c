@@ -24,6 +24,9 @@ int main(void) {
 #if defined(__AVX512F__)
 	printf("AVX512F;");
 #endif
+#if defined(__AVX512VBMI2__)
+	printf("AVX512VBMI2;");
+#endif
 #if defined(__VPCLMULQDQ__)
 	printf("VPCLMULQDQ;");
 #endif
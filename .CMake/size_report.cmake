@@ -0,0 +1,74 @@
+# SPDX-License-Identifier: MIT
+
+# Prints the code and data size of the ML-KEM and ML-DSA object libraries,
+# per implementation and parameter set, and how much of it is
+# parameter-independent code that is compiled once and shared by all
+# parameter sets of the implementation.
+#
+# Run through the size_report target:
+#   cmake -DSIZE=<size executable> -DOBJECTS=<file> -P size_report.cmake
+# where OBJECTS is generated by src/CMakeLists.txt.
+
+include(${OBJECTS})
+
+# Sets <prefix>_<object name> to the text + data size of each object file,
+# <prefix>_NAMES to the list of object names and <prefix>_TOTAL to the sum.
+function(object_sizes prefix)
+    execute_process(COMMAND ${SIZE} ${ARGN} OUTPUT_VARIABLE _out RESULT_VARIABLE _rc)
+    if(NOT _rc EQUAL 0)
+        message(FATAL_ERROR "${SIZE} failed")
+    endif()
+    string(REPLACE "\n" ";" _lines "${_out}")
+    set(_names "")
+    set(_total 0)
+    foreach(_line IN LISTS _lines)
+        # Berkeley format: text data bss dec hex filename
+        if(_line MATCHES "^ *([0-9]+)[ \t]+([0-9]+)[ \t]+[0-9]+[ \t]+[0-9]+[ \t]+[0-9a-f]+[ \t]+(.*)$")
+            math(EXPR _bytes "${CMAKE_MATCH_1} + ${CMAKE_MATCH_2}")
+            get_filename_component(_name "${CMAKE_MATCH_3}" NAME)
+            set(${prefix}_${_name} ${_bytes} PARENT_SCOPE)
+            list(APPEND _names ${_name})
+            math(EXPR _total "${_total} + ${_bytes}")
+        endif()
+    endforeach()
+    set(${prefix}_NAMES ${_names} PARENT_SCOPE)
+    set(${prefix}_TOTAL ${_total} PARENT_SCOPE)
+endfunction()
+
+foreach(_group IN LISTS OQS_SIZE_GROUPS)
+    set(_sets ${OQS_SIZE_${_group}_SETS})
+    list(LENGTH _sets _count)
+    if(_count EQUAL 0)
+        continue()
+    endif()
+
+    set(_line "")
+    set(_sum 0)
+    foreach(_set IN LISTS _sets)
+        object_sizes(_${_set} ${OQS_SIZE_${_group}_${_set}})
+        string(APPEND _line " ${_set}: ${_${_set}_TOTAL}")
+        math(EXPR _sum "${_sum} + ${_${_set}_TOTAL}")
+    endforeach()
+
+    # The first parameter set carries the shared code: the objects that are
+    # missing or empty in the other parameter sets (kem_ml_kem_512.c.o
+    # corresponds to kem_ml_kem_768.c.o, and so on).
+    list(GET _sets 0 _owner)
+    set(_shared 0)
+    if(_count GREATER 1)
+        list(GET _sets 1 _other)
+        foreach(_name IN LISTS _${_owner}_NAMES)
+            set(_counterpart "${_name}")
+            if(NOT DEFINED _${_other}_${_name})
+                string(REPLACE "${_owner}" "${_other}" _counterpart "${_name}")
+            endif()
+            if(NOT _${_other}_${_counterpart})
+                math(EXPR _shared "${_shared} + ${_${_owner}_${_name}}")
+            endif()
+        endforeach()
+    endif()
+    math(EXPR _unshared "${_sum} + (${_count} - 1) * ${_shared}")
+
+    message("${_group}:${_line} bytes; total ${_sum} bytes, "
+            "of which ${_shared} bytes shared (${_unshared} bytes if compiled per parameter set)")
+endforeach()
@@ -0,0 +1,10 @@
+# SPDX-License-Identifier: MIT
+
+set(CMAKE_SYSTEM_NAME Linux)
+set(CMAKE_SYSTEM_PROCESSOR s390x)
+set(CMAKE_CROSSCOMPILING ON)
+
+set(CMAKE_C_COMPILER s390x-linux-gnu-gcc)
+# z13 is the first generation with the vector facility
+set(CMAKE_C_FLAGS_INIT "-march=z13")
+set(CMAKE_CROSSCOMPILING_EMULATOR "qemu-s390x-static;-L;/usr/s390x-linux-gnu/")
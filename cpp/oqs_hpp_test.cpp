@@ -0,0 +1,151 @@
+/*
+ * oqs_hpp_test.cpp
+ *
+ * Exercises the header-only C++ interface in <oqs/oqs.hpp>: runtime-selected
+ * KEM/signature objects with reusable buffers, and compile-time selected
+ * algorithms with fixed-size keys.
+ *
+ * g++ -g -I${LIBOQS_DIR}/build/include \
+ *     -L${LIBOQS_DIR}/build/lib -loqs \
+ *     -lcrypto -std=c++17 \
+ *     -o ${LIBOQS_DIR}/build/tests/oqs_hpp_test \
+ *     ${LIBOQS_DIR}/cpp/oqs_hpp_test.cpp \
+ * && ${LIBOQS_DIR}/build/tests/oqs_hpp_test
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <type_traits>
+
+#include <oqs/oqs.hpp>
+
+static_assert(!std::is_copy_constructible<oqs::SecretKey>::value, "secret keys must not be copyable");
+static_assert(std::is_nothrow_move_constructible<oqs::SecretKey>::value, "secret keys must be movable");
+
+[[maybe_unused]] static bool test_runtime_kem(const char *name) {
+	oqs::KEM kem(name);
+	oqs::PublicKey pk = kem.make_public_key();
+	oqs::SecretKey sk = kem.make_secret_key();
+	oqs::Buffer ct = kem.make_ciphertext();
+	oqs::SecretBuffer ss_e = kem.make_shared_secret();
+	oqs::SecretBuffer ss_d = kem.make_shared_secret();
+
+	/* buffers are reused across iterations */
+	for (int i = 0; i < 3; i++) {
+		if (kem.keypair(pk, sk) != OQS_SUCCESS ||
+		        kem.encaps(ct, ss_e, pk) != OQS_SUCCESS ||
+		        kem.decaps(ss_d, ct, sk) != OQS_SUCCESS) {
+			return false;
+		}
+		if (std::memcmp(ss_e.data(), ss_d.data(), ss_e.size()) != 0) {
+			return false;
+		}
+	}
+
+	/* undersized output buffers are rejected */
+	oqs::mutable_bytes short_ct(ct.data(), ct.size() - 1);
+	if (kem.encaps(short_ct, ss_e, pk) != OQS_ERROR) {
+		return false;
+	}
+
+	oqs::SecretKey moved = std::move(sk);
+	return sk.data() == nullptr && moved.size() == kem.length_secret_key();
+}
+
+[[maybe_unused]] static bool test_runtime_sig(const char *name) {
+	oqs::Signature sig(name);
+	oqs::PublicKey pk = sig.make_public_key();
+	oqs::SecretKey sk = sig.make_secret_key();
+	oqs::Buffer signature = sig.make_signature();
+	const std::uint8_t msg[] = "oqs.hpp";
+	std::size_t sig_len = 0;
+
+	if (sig.keypair(pk, sk) != OQS_SUCCESS ||
+	        sig.sign(signature, sig_len, msg, sk) != OQS_SUCCESS) {
+		return false;
+	}
+	oqs::bytes_view sig_view(signature.data(), sig_len);
+	if (sig.verify(msg, sig_view, pk) != OQS_SUCCESS) {
+		return false;
+	}
+	signature.data()[0] ^= 1;
+	return sig.verify(msg, sig_view, pk) != OQS_SUCCESS;
+}
+
+template <typename Alg>
+static bool test_static_kem() {
+	using K = oqs::StaticKEM<Alg>;
+	static_assert(sizeof(typename K::PublicKey) == Alg::length_public_key, "unexpected public key size");
+	typename K::PublicKey pk;
+	typename K::SecretKey sk;
+	typename K::Ciphertext ct;
+	typename K::SharedSecret ss_e, ss_d;
+
+	if (K::keypair(pk, sk) != OQS_SUCCESS ||
+	        K::encaps(ct, ss_e, pk) != OQS_SUCCESS ||
+	        K::decaps(ss_d, ct, sk) != OQS_SUCCESS) {
+		return false;
+	}
+	return std::memcmp(ss_e.data(), ss_d.data(), K::SharedSecret::size()) == 0;
+}
+
+template <typename Alg>
+static bool test_static_sig() {
+	using S = oqs::StaticSignature<Alg>;
+	typename S::PublicKey pk;
+	typename S::SecretKey sk;
+	typename S::SignatureBuffer signature;
+	const std::uint8_t msg[] = "oqs.hpp";
+	std::size_t sig_len = 0;
+
+	if (S::keypair(pk, sk) != OQS_SUCCESS ||
+	        S::sign(signature, sig_len, msg, sk) != OQS_SUCCESS) {
+		return false;
+	}
+	return S::verify(msg, oqs::bytes_view(signature.data(), sig_len), pk) == OQS_SUCCESS;
+}
+
+int main() {
+	OQS_init();
+	bool ok = true;
+
+	try {
+		oqs::KEM kem("not-an-algorithm");
+		ok = false;
+	} catch (const std::invalid_argument &) {
+	}
+
+	/* the ML-KEM and ML-DSA tags use the direct entry points (OQS_DIRECT_DISPATCH) */
+#ifdef OQS_ENABLE_KEM_ml_kem_512
+	ok = ok && test_static_kem<oqs::alg::ml_kem_512>();
+#endif
+#ifdef OQS_ENABLE_KEM_ml_kem_768
+	ok = ok && test_runtime_kem(OQS_KEM_alg_ml_kem_768);
+	ok = ok && test_static_kem<oqs::alg::ml_kem_768>();
+#endif
+#ifdef OQS_ENABLE_KEM_ml_kem_1024
+	ok = ok && test_static_kem<oqs::alg::ml_kem_1024>();
+#endif
+#ifdef OQS_ENABLE_SIG_ml_dsa_44
+	ok = ok && test_static_sig<oqs::alg::ml_dsa_44>();
+#endif
+#ifdef OQS_ENABLE_SIG_ml_dsa_65
+	ok = ok && test_runtime_sig(OQS_SIG_alg_ml_dsa_65);
+	ok = ok && test_static_sig<oqs::alg::ml_dsa_65>();
+#endif
+#ifdef OQS_ENABLE_SIG_ml_dsa_87
+	ok = ok && test_static_sig<oqs::alg::ml_dsa_87>();
+#endif
+
+	OQS_destroy();
+	if (!ok) {
+		std::cerr << "oqs.hpp test failed" << std::endl;
+		return EXIT_FAILURE;
+	}
+	std::cout << "oqs.hpp test passed" << std::endl;
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,651 @@
+/**
+ * @file oqs.hpp
+ * @brief Header-only C++17 interface to the liboqs KEM and signature APIs
+ *
+ * This header wraps the C API in a small set of RAII types:
+ *
+ * - oqs::SecretBuffer / oqs::Buffer: move-only heap buffers that are allocated
+ *   once and reused across operations. Secret buffers are wiped with
+ *   OQS_MEM_cleanse() when they are destroyed or moved from.
+ * - oqs::KEM / oqs::Signature: runtime-selected algorithms backed by an
+ *   OQS_KEM / OQS_SIG object.
+ * - oqs::StaticKEM<Alg> / oqs::StaticSignature<Alg>: compile-time selected
+ *   algorithms. Sizes are `constexpr` and calls go directly to the per-scheme
+ *   functions (e.g. OQS_KEM_ml_kem_768_encaps) without a function-pointer
+ *   indirection (for ML-KEM and ML-DSA through the *_direct_* entry points of
+ *   kem_ml_kem_direct.h / sig_ml_dsa_direct.h). Keys live in fixed-size,
+ *   stack-allocatable containers.
+ *
+ * All cryptographic operations take non-owning byte views (oqs::span), so
+ * callers can pass their own storage without copies. When compiled as C++20
+ * or later, oqs::span is std::span.
+ *
+ * Constructors throw std::invalid_argument for unknown or disabled algorithms
+ * and std::bad_alloc on allocation failure. Cryptographic operations never
+ * throw; they return OQS_STATUS and reject undersized buffers with OQS_ERROR.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef OQS_HPP
+#define OQS_HPP
+
+#include <oqs/oqs.h>
+#if defined(OQS_ENABLE_KEM_ML_KEM)
+#include <oqs/kem_ml_kem_direct.h>
+#endif
+#if defined(OQS_ENABLE_SIG_ML_DSA)
+#include <oqs/sig_ml_dsa_direct.h>
+#endif
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#if defined(__has_include)
+#if __has_include(<version>)
+#include <version>
+#endif
+#endif
+#if defined(__cpp_lib_span) && __cpp_lib_span >= 202002L
+#include <span>
+#endif
+
+namespace oqs {
+
+/* ============================================================================
+ * Byte views
+ * ============================================================================ */
+
+#if defined(__cpp_lib_span) && __cpp_lib_span >= 202002L
+template <typename T>
+using span = std::span<T>;
+#else
+/**
+ * @brief Minimal stand-in for std::span (C++20) used when building as C++17.
+ *
+ * Only the subset needed by this header is provided: construction from a
+ * pointer/length pair, C arrays, std::array and contiguous containers with
+ * data()/size(), plus element access and subspan().
+ */
+template <typename T>
+class span {
+  public:
+	using element_type = T;
+	using value_type = std::remove_cv_t<T>;
+	using size_type = std::size_t;
+	using pointer = T *;
+	using iterator = T *;
+
+	constexpr span() noexcept = default;
+	constexpr span(T *data, size_type size) noexcept : data_(data), size_(size) {}
+
+	template <std::size_t N>
+	constexpr span(T (&arr)[N]) noexcept : data_(arr), size_(N) {}
+
+	template <typename C,
+	          typename = std::enable_if_t<
+	              std::is_convertible_v<decltype(std::declval<C &>().data()), T *> &&
+	              !std::is_same_v<std::remove_cv_t<C>, span>>>
+	constexpr span(C &container) noexcept : data_(container.data()), size_(container.size()) {}
+
+	template <typename U, typename = std::enable_if_t<std::is_convertible_v<U (*)[], T (*)[]>>>
+	constexpr span(const span<U> &other) noexcept : data_(other.data()), size_(other.size()) {}
+
+	constexpr pointer data() const noexcept {
+		return data_;
+	}
+	constexpr size_type size() const noexcept {
+		return size_;
+	}
+	constexpr bool empty() const noexcept {
+		return size_ == 0;
+	}
+	constexpr T &operator[](size_type i) const noexcept {
+		return data_[i];
+	}
+	constexpr iterator begin() const noexcept {
+		return data_;
+	}
+	constexpr iterator end() const noexcept {
+		return data_ + size_;
+	}
+	constexpr span subspan(size_type offset, size_type count) const noexcept {
+		return span(data_ + offset, count);
+	}
+	constexpr span first(size_type count) const noexcept {
+		return span(data_, count);
+	}
+
+  private:
+	T *data_ = nullptr;
+	size_type size_ = 0;
+};
+#endif
+
+/** Read-only byte view. */
+using bytes_view = span<const std::uint8_t>;
+/** Writable byte view. */
+using mutable_bytes = span<std::uint8_t>;
+
+/* ============================================================================
+ * Owning buffers
+ * ============================================================================ */
+
+namespace detail {
+
+template <bool Secret>
+class BasicBuffer {
+  public:
+	BasicBuffer() noexcept = default;
+
+	explicit BasicBuffer(std::size_t size) : size_(size) {
+		if (size_ != 0) {
+			data_ = static_cast<std::uint8_t *>(OQS_MEM_malloc(size_));
+			if (data_ == nullptr) {
+				throw std::bad_alloc();
+			}
+		}
+	}
+
+	BasicBuffer(const BasicBuffer &) = delete;
+	BasicBuffer &operator=(const BasicBuffer &) = delete;
+
+	BasicBuffer(BasicBuffer &&other) noexcept : data_(other.data_), size_(other.size_) {
+		other.data_ = nullptr;
+		other.size_ = 0;
+	}
+
+	BasicBuffer &operator=(BasicBuffer &&other) noexcept {
+		if (this != &other) {
+			release();
+			data_ = other.data_;
+			size_ = other.size_;
+			other.data_ = nullptr;
+			other.size_ = 0;
+		}
+		return *this;
+	}
+
+	~BasicBuffer() {
+		release();
+	}
+
+	std::uint8_t *data() noexcept {
+		return data_;
+	}
+	const std::uint8_t *data() const noexcept {
+		return data_;
+	}
+	std::size_t size() const noexcept {
+		return size_;
+	}
+	bool empty() const noexcept {
+		return size_ == 0;
+	}
+
+	mutable_bytes bytes() noexcept {
+		return mutable_bytes(data_, size_);
+	}
+	bytes_view bytes() const noexcept {
+		return bytes_view(data_, size_);
+	}
+	operator mutable_bytes() noexcept {
+		return bytes();
+	}
+	operator bytes_view() const noexcept {
+		return bytes();
+	}
+
+	/** Wipes the contents without releasing the allocation. */
+	void cleanse() noexcept {
+		OQS_MEM_cleanse(data_, size_);
+	}
+
+  private:
+	void release() noexcept {
+		if (data_ == nullptr) {
+			return;
+		}
+		if (Secret) {
+			OQS_MEM_secure_free(data_, size_);
+		} else {
+			OQS_MEM_insecure_free(data_);
+		}
+		data_ = nullptr;
+		size_ = 0;
+	}
+
+	std::uint8_t *data_ = nullptr;
+	std::size_t size_ = 0;
+};
+
+} // namespace detail
+
+/** Move-only heap buffer for public data (public keys, ciphertexts, signatures). */
+using Buffer = detail::BasicBuffer<false>;
+/** Move-only heap buffer for secret data; wiped on destruction. */
+using SecretBuffer = detail::BasicBuffer<true>;
+/** A secret key held in a SecretBuffer. */
+using SecretKey = SecretBuffer;
+/** A public key held in a Buffer. */
+using PublicKey = Buffer;
+
+/**
+ * @brief Fixed-size, move-only secret byte array, wiped on destruction.
+ *
+ * Used by the compile-time interfaces so that secret keys and shared secrets
+ * can live on the stack or inline in other objects.
+ */
+template <std::size_t N>
+class FixedSecret {
+  public:
+	static constexpr std::size_t length = N;
+
+	FixedSecret() noexcept = default;
+	FixedSecret(const FixedSecret &) = delete;
+	FixedSecret &operator=(const FixedSecret &) = delete;
+
+	FixedSecret(FixedSecret &&other) noexcept : data_(other.data_) {
+		other.cleanse();
+	}
+
+	FixedSecret &operator=(FixedSecret &&other) noexcept {
+		if (this != &other) {
+			data_ = other.data_;
+			other.cleanse();
+		}
+		return *this;
+	}
+
+	~FixedSecret() {
+		cleanse();
+	}
+
+	std::uint8_t *data() noexcept {
+		return data_.data();
+	}
+	const std::uint8_t *data() const noexcept {
+		return data_.data();
+	}
+	static constexpr std::size_t size() noexcept {
+		return N;
+	}
+	mutable_bytes bytes() noexcept {
+		return mutable_bytes(data_.data(), N);
+	}
+	bytes_view bytes() const noexcept {
+		return bytes_view(data_.data(), N);
+	}
+	operator mutable_bytes() noexcept {
+		return bytes();
+	}
+	operator bytes_view() const noexcept {
+		return bytes();
+	}
+
+	void cleanse() noexcept {
+		OQS_MEM_cleanse(data_.data(), N);
+	}
+
+  private:
+	std::array<std::uint8_t, N> data_{};
+};
+
+/* ============================================================================
+ * Runtime-selected algorithms
+ * ============================================================================ */
+
+namespace detail {
+
+struct KemDeleter {
+	void operator()(OQS_KEM *kem) const noexcept {
+		OQS_KEM_free(kem);
+	}
+};
+
+struct SigDeleter {
+	void operator()(OQS_SIG *sig) const noexcept {
+		OQS_SIG_free(sig);
+	}
+};
+
+inline bool fits(std::size_t have, std::size_t need) noexcept {
+	return have >= need;
+}
+
+} // namespace detail
+
+/**
+ * @brief Key encapsulation mechanism selected by name at run time.
+ *
+ * The object is cheap to keep around; create it once and reuse it together
+ * with preallocated buffers from make_public_key(), make_secret_key(), etc.
+ */
+class KEM {
+  public:
+	explicit KEM(const std::string &method_name) : kem_(OQS_KEM_new(method_name.c_str())) {
+		if (!kem_) {
+			throw std::invalid_argument("oqs::KEM: algorithm not supported or not enabled: " + method_name);
+		}
+	}
+
+	const char *method_name() const noexcept {
+		return kem_->method_name;
+	}
+	std::size_t length_public_key() const noexcept {
+		return kem_->length_public_key;
+	}
+	std::size_t length_secret_key() const noexcept {
+		return kem_->length_secret_key;
+	}
+	std::size_t length_ciphertext() const noexcept {
+		return kem_->length_ciphertext;
+	}
+	std::size_t length_shared_secret() const noexcept {
+		return kem_->length_shared_secret;
+	}
+	const OQS_KEM *get() const noexcept {
+		return kem_.get();
+	}
+
+	PublicKey make_public_key() const {
+		return PublicKey(kem_->length_public_key);
+	}
+	SecretKey make_secret_key() const {
+		return SecretKey(kem_->length_secret_key);
+	}
+	Buffer make_ciphertext() const {
+		return Buffer(kem_->length_ciphertext);
+	}
+	SecretBuffer make_shared_secret() const {
+		return SecretBuffer(kem_->length_shared_secret);
+	}
+
+	OQS_STATUS keypair(mutable_bytes public_key, mutable_bytes secret_key) const noexcept {
+		if (!detail::fits(public_key.size(), kem_->length_public_key) ||
+		        !detail::fits(secret_key.size(), kem_->length_secret_key)) {
+			return OQS_ERROR;
+		}
+		return kem_->keypair(public_key.data(), secret_key.data());
+	}
+
+	OQS_STATUS encaps(mutable_bytes ciphertext, mutable_bytes shared_secret, bytes_view public_key) const noexcept {
+		if (!detail::fits(ciphertext.size(), kem_->length_ciphertext) ||
+		        !detail::fits(shared_secret.size(), kem_->length_shared_secret) ||
+		        !detail::fits(public_key.size(), kem_->length_public_key)) {
+			return OQS_ERROR;
+		}
+		return kem_->encaps(ciphertext.data(), shared_secret.data(), public_key.data());
+	}
+
+	OQS_STATUS decaps(mutable_bytes shared_secret, bytes_view ciphertext, bytes_view secret_key) const noexcept {
+		if (!detail::fits(shared_secret.size(), kem_->length_shared_secret) ||
+		        !detail::fits(ciphertext.size(), kem_->length_ciphertext) ||
+		        !detail::fits(secret_key.size(), kem_->length_secret_key)) {
+			return OQS_ERROR;
+		}
+		return kem_->decaps(shared_secret.data(), ciphertext.data(), secret_key.data());
+	}
+
+  private:
+	std::unique_ptr<OQS_KEM, detail::KemDeleter> kem_;
+};
+
+/**
+ * @brief Signature scheme selected by name at run time.
+ */
+class Signature {
+  public:
+	explicit Signature(const std::string &method_name) : sig_(OQS_SIG_new(method_name.c_str())) {
+		if (!sig_) {
+			throw std::invalid_argument("oqs::Signature: algorithm not supported or not enabled: " + method_name);
+		}
+	}
+
+	const char *method_name() const noexcept {
+		return sig_->method_name;
+	}
+	std::size_t length_public_key() const noexcept {
+		return sig_->length_public_key;
+	}
+	std::size_t length_secret_key() const noexcept {
+		return sig_->length_secret_key;
+	}
+	std::size_t length_signature() const noexcept {
+		return sig_->length_signature;
+	}
+	bool supports_ctx_str() const noexcept {
+		return sig_->sig_with_ctx_support;
+	}
+	const OQS_SIG *get() const noexcept {
+		return sig_.get();
+	}
+
+	PublicKey make_public_key() const {
+		return PublicKey(sig_->length_public_key);
+	}
+	SecretKey make_secret_key() const {
+		return SecretKey(sig_->length_secret_key);
+	}
+	Buffer make_signature() const {
+		return Buffer(sig_->length_signature);
+	}
+
+	OQS_STATUS keypair(mutable_bytes public_key, mutable_bytes secret_key) const noexcept {
+		if (!detail::fits(public_key.size(), sig_->length_public_key) ||
+		        !detail::fits(secret_key.size(), sig_->length_secret_key)) {
+			return OQS_ERROR;
+		}
+		return sig_->keypair(public_key.data(), secret_key.data());
+	}
+
+	/**
+	 * Signs `message` into `signature`. On success `signature_len` holds the
+	 * number of bytes written, which may be less than length_signature().
+	 */
+	OQS_STATUS sign(mutable_bytes signature, std::size_t &signature_len, bytes_view message,
+	                bytes_view secret_key) const noexcept {
+		if (!detail::fits(signature.size(), sig_->length_signature) ||
+		        !detail::fits(secret_key.size(), sig_->length_secret_key)) {
+			return OQS_ERROR;
+		}
+		return sig_->sign(signature.data(), &signature_len, message.data(), message.size(), secret_key.data());
+	}
+
+	OQS_STATUS sign(mutable_bytes signature, std::size_t &signature_len, bytes_view message, bytes_view ctx_str,
+	                bytes_view secret_key) const noexcept {
+		if (!detail::fits(signature.size(), sig_->length_signature) ||
+		        !detail::fits(secret_key.size(), sig_->length_secret_key)) {
+			return OQS_ERROR;
+		}
+		return sig_->sign_with_ctx_str(signature.data(), &signature_len, message.data(), message.size(),
+		                               ctx_str.data(), ctx_str.size(), secret_key.data());
+	}
+
+	OQS_STATUS verify(bytes_view message, bytes_view signature, bytes_view public_key) const noexcept {
+		if (!detail::fits(public_key.size(), sig_->length_public_key)) {
+			return OQS_ERROR;
+		}
+		return sig_->verify(message.data(), message.size(), signature.data(), signature.size(), public_key.data());
+	}
+
+	OQS_STATUS verify(bytes_view message, bytes_view signature, bytes_view ctx_str,
+	                  bytes_view public_key) const noexcept {
+		if (!detail::fits(public_key.size(), sig_->length_public_key)) {
+			return OQS_ERROR;
+		}
+		return sig_->verify_with_ctx_str(message.data(), message.size(), signature.data(), signature.size(),
+		                                 ctx_str.data(), ctx_str.size(), public_key.data());
+	}
+
+  private:
+	std::unique_ptr<OQS_SIG, detail::SigDeleter> sig_;
+};
+
+/* ============================================================================
+ * Compile-time selected algorithms
+ * ============================================================================
+ * Each algorithm tag exposes its sizes as constexpr members and the per-scheme
+ * entry points as static functions. Tags are only declared when the
+ * corresponding algorithm was enabled at library build time.
+ */
+
+namespace alg {
+
+#define OQS_HPP_KEM_TAG(tag, prefix, fn)                                                     \
+	struct tag {                                                                            \
+		static constexpr const char *name = OQS_KEM_alg_##prefix;                           \
+		static constexpr std::size_t length_public_key = OQS_KEM_##prefix##_length_public_key; \
+		static constexpr std::size_t length_secret_key = OQS_KEM_##prefix##_length_secret_key; \
+		static constexpr std::size_t length_ciphertext = OQS_KEM_##prefix##_length_ciphertext; \
+		static constexpr std::size_t length_shared_secret = OQS_KEM_##prefix##_length_shared_secret; \
+		static OQS_STATUS keypair(std::uint8_t *pk, std::uint8_t *sk) noexcept {            \
+			return OQS_KEM_##fn##_keypair(pk, sk);                                      \
+		}                                                                                   \
+		static OQS_STATUS encaps(std::uint8_t *ct, std::uint8_t *ss, const std::uint8_t *pk) noexcept { \
+			return OQS_KEM_##fn##_encaps(ct, ss, pk);                                   \
+		}                                                                                   \
+		static OQS_STATUS decaps(std::uint8_t *ss, const std::uint8_t *ct, const std::uint8_t *sk) noexcept { \
+			return OQS_KEM_##fn##_decaps(ss, ct, sk);                                   \
+		}                                                                                   \
+	}
+
+#define OQS_HPP_SIG_TAG(tag, prefix, fn)                                                     \
+	struct tag {                                                                            \
+		static constexpr const char *name = OQS_SIG_alg_##prefix;                           \
+		static constexpr std::size_t length_public_key = OQS_SIG_##prefix##_length_public_key; \
+		static constexpr std::size_t length_secret_key = OQS_SIG_##prefix##_length_secret_key; \
+		static constexpr std::size_t length_signature = OQS_SIG_##prefix##_length_signature; \
+		static OQS_STATUS keypair(std::uint8_t *pk, std::uint8_t *sk) noexcept {            \
+			return OQS_SIG_##fn##_keypair(pk, sk);                                      \
+		}                                                                                   \
+		static OQS_STATUS sign(std::uint8_t *sig, std::size_t *siglen, const std::uint8_t *m, std::size_t mlen, \
+		                       const std::uint8_t *sk) noexcept {                           \
+			return OQS_SIG_##fn##_sign(sig, siglen, m, mlen, sk);                       \
+		}                                                                                   \
+		static OQS_STATUS verify(const std::uint8_t *m, std::size_t mlen, const std::uint8_t *sig, std::size_t siglen, \
+		                         const std::uint8_t *pk) noexcept {                         \
+			return OQS_SIG_##fn##_verify(m, mlen, sig, siglen, pk);                     \
+		}                                                                                   \
+	}
+
+#if defined(OQS_ENABLE_KEM_ml_kem_512)
+OQS_HPP_KEM_TAG(ml_kem_512, ml_kem_512, ml_kem_512_direct);
+#endif
+#if defined(OQS_ENABLE_KEM_ml_kem_768)
+OQS_HPP_KEM_TAG(ml_kem_768, ml_kem_768, ml_kem_768_direct);
+#endif
+#if defined(OQS_ENABLE_KEM_ml_kem_1024)
+OQS_HPP_KEM_TAG(ml_kem_1024, ml_kem_1024, ml_kem_1024_direct);
+#endif
+#if defined(OQS_ENABLE_SIG_ml_dsa_44)
+OQS_HPP_SIG_TAG(ml_dsa_44, ml_dsa_44, ml_dsa_44_direct);
+#endif
+#if defined(OQS_ENABLE_SIG_ml_dsa_65)
+OQS_HPP_SIG_TAG(ml_dsa_65, ml_dsa_65, ml_dsa_65_direct);
+#endif
+#if defined(OQS_ENABLE_SIG_ml_dsa_87)
+OQS_HPP_SIG_TAG(ml_dsa_87, ml_dsa_87, ml_dsa_87_direct);
+#endif
+#if defined(OQS_ENABLE_SIG_falcon_512)
+OQS_HPP_SIG_TAG(falcon_512, falcon_512, falcon_512);
+#endif
+#if defined(OQS_ENABLE_SIG_falcon_1024)
+OQS_HPP_SIG_TAG(falcon_1024, falcon_1024, falcon_1024);
+#endif
+
+#undef OQS_HPP_KEM_TAG
+#undef OQS_HPP_SIG_TAG
+
+} // namespace alg
+
+/**
+ * @brief Size traits for a compile-time KEM tag.
+ */
+template <typename Alg>
+struct kem_traits {
+	static constexpr std::size_t length_public_key = Alg::length_public_key;
+	static constexpr std::size_t length_secret_key = Alg::length_secret_key;
+	static constexpr std::size_t length_ciphertext = Alg::length_ciphertext;
+	static constexpr std::size_t length_shared_secret = Alg::length_shared_secret;
+};
+
+/**
+ * @brief Size traits for a compile-time signature tag.
+ */
+template <typename Alg>
+struct sig_traits {
+	static constexpr std::size_t length_public_key = Alg::length_public_key;
+	static constexpr std::size_t length_secret_key = Alg::length_secret_key;
+	static constexpr std::size_t length_signature = Alg::length_signature;
+};
+
+/**
+ * @brief KEM selected at compile time, e.g. `oqs::StaticKEM<oqs::alg::ml_kem_768>`.
+ *
+ * Stateless; all members are static. Key and ciphertext types are fixed-size
+ * arrays, so no heap allocation is performed.
+ */
+template <typename Alg>
+struct StaticKEM {
+	using traits = kem_traits<Alg>;
+	using PublicKey = std::array<std::uint8_t, traits::length_public_key>;
+	using SecretKey = FixedSecret<traits::length_secret_key>;
+	using Ciphertext = std::array<std::uint8_t, traits::length_ciphertext>;
+	using SharedSecret = FixedSecret<traits::length_shared_secret>;
+
+	static constexpr const char *name() noexcept {
+		return Alg::name;
+	}
+
+	static OQS_STATUS keypair(PublicKey &public_key, SecretKey &secret_key) noexcept {
+		return Alg::keypair(public_key.data(), secret_key.data());
+	}
+
+	static OQS_STATUS encaps(Ciphertext &ciphertext, SharedSecret &shared_secret, const PublicKey &public_key) noexcept {
+		return Alg::encaps(ciphertext.data(), shared_secret.data(), public_key.data());
+	}
+
+	static OQS_STATUS decaps(SharedSecret &shared_secret, const Ciphertext &ciphertext, const SecretKey &secret_key) noexcept {
+		return Alg::decaps(shared_secret.data(), ciphertext.data(), secret_key.data());
+	}
+};
+
+/**
+ * @brief Signature scheme selected at compile time, e.g. `oqs::StaticSignature<oqs::alg::ml_dsa_65>`.
+ */
+template <typename Alg>
+struct StaticSignature {
+	using traits = sig_traits<Alg>;
+	using PublicKey = std::array<std::uint8_t, traits::length_public_key>;
+	using SecretKey = FixedSecret<traits::length_secret_key>;
+	using SignatureBuffer = std::array<std::uint8_t, traits::length_signature>;
+
+	static constexpr const char *name() noexcept {
+		return Alg::name;
+	}
+
+	static OQS_STATUS keypair(PublicKey &public_key, SecretKey &secret_key) noexcept {
+		return Alg::keypair(public_key.data(), secret_key.data());
+	}
+
+	static OQS_STATUS sign(SignatureBuffer &signature, std::size_t &signature_len, bytes_view message,
+	                       const SecretKey &secret_key) noexcept {
+		return Alg::sign(signature.data(), &signature_len, message.data(), message.size(), secret_key.data());
+	}
+
+	static OQS_STATUS verify(bytes_view message, bytes_view signature, const PublicKey &public_key) noexcept {
+		return Alg::verify(message.data(), message.size(), signature.data(), signature.size(), public_key.data());
+	}
+};
+
+} // namespace oqs
+
+#endif // OQS_HPP
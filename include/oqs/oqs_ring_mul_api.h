@@ -0,0 +1,123 @@
+/**
+ * @file oqs_ring_mul_api.h
+ * @brief API for exposing the polynomial multipliers of liboqs KEMs whose
+ *        rings are not NTT-friendly
+ *
+ * This header is the counterpart of oqs_ntt_api.h for NTRU and Streamlined
+ * NTRU Prime. Their rings have no suitable roots of unity modulo q, so the
+ * schemes ship dedicated multipliers instead of an NTT:
+ *
+ * - NTRU (HPS and HRSS): R_q = Z_q[x]/(x^n - 1) with q a power of two,
+ *   multiplied by Toom-Cook/Karatsuba (AVX2 assembly where available).
+ * - sntrup761: R_q = Z_q[x]/(x^p - x - 1) with p = 761 and q = 4591,
+ *   multiplied by a small (ternary) polynomial; the AVX2 version embeds the
+ *   product in NTTs modulo 7681 and 10753.
+ *
+ * Each entry point uses the fastest implementation the CPU supports, the same
+ * way the corresponding KEM does. The batched variants multiply `count`
+ * independent pairs stored back to back and set up scratch space only once.
+ *
+ * The functions return OQS_ERROR when the parameter set is not enabled in
+ * this build or when a scratch allocation fails.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef OQS_RING_MUL_API_H
+#define OQS_RING_MUL_API_H
+
+#include <oqs/common.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/* ============================================================================
+ * NTRU Multiplication in Z_q[x]/(x^n - 1)
+ * ============================================================================
+ * The ring degree selects the parameter set and with it the modulus:
+ *
+ *     n = 509, 677  (ntru-hps2048509, ntru-hps2048677)   q = 2048
+ *     n = 821, 1229 (ntru-hps4096821, ntru-hps40961229)  q = 4096
+ *     n = 701       (ntru-hrss701)                       q = 8192
+ *     n = 1373      (ntru-hrss1373)                      q = 16384
+ *
+ * Input coefficients are taken modulo q; output coefficients are in [0, q).
+ */
+
+/**
+ * @brief NTRU - Multiplication in Z_q[x]/(x^n - 1)
+ *
+ * Computes r = a * b. `r` may alias `a` or `b`.
+ *
+ * @param r Pointer to n uint16_t coefficients (output)
+ * @param a Pointer to n uint16_t coefficients
+ * @param b Pointer to n uint16_t coefficients
+ * @param n Ring degree, one of 509, 677, 701, 821, 1229, 1373
+ * @return OQS_SUCCESS, or OQS_ERROR if no enabled NTRU parameter set has degree n
+ */
+OQS_API OQS_STATUS OQS_KEM_ntru_poly_Rq_mul(uint16_t *r, const uint16_t *a, const uint16_t *b, size_t n);
+
+/**
+ * @brief NTRU - Batched multiplication in Z_q[x]/(x^n - 1)
+ *
+ * Computes r[i] = a[i] * b[i] for i < count, where the i-th polynomial of
+ * each array starts at offset i * n.
+ *
+ * @param r Pointer to count * n uint16_t coefficients (output)
+ * @param a Pointer to count * n uint16_t coefficients
+ * @param b Pointer to count * n uint16_t coefficients
+ * @param n Ring degree, one of 509, 677, 701, 821, 1229, 1373
+ * @param count Number of products
+ * @return OQS_SUCCESS, or OQS_ERROR if no enabled NTRU parameter set has degree n
+ */
+OQS_API OQS_STATUS OQS_KEM_ntru_poly_Rq_mul_batch(uint16_t *r, const uint16_t *a, const uint16_t *b, size_t n, size_t count);
+
+/* ============================================================================
+ * sntrup761 Multiplication in Z_q[x]/(x^p - x - 1)
+ * ============================================================================
+ * p = 761, q = 4591. Elements of R_q are int16_t coefficients in the centered
+ * range [-(q-1)/2, (q-1)/2]; inputs may be any int16_t and are reduced first.
+ * The second factor must be small, i.e. have coefficients in {-1, 0, 1}:
+ * the multiplier only handles the Rq-by-small products that the scheme
+ * performs, which keeps the AVX2 NTTs free of overflow.
+ */
+
+/** Degree p of the sntrup761 ring. */
+#define OQS_KEM_ntruprime_sntrup761_p 761
+/** Modulus q of the sntrup761 ring. */
+#define OQS_KEM_ntruprime_sntrup761_q 4591
+
+/**
+ * @brief sntrup761 - Multiplication by a small polynomial in Z_q[x]/(x^p - x - 1)
+ *
+ * Computes h = f * g. `h` may alias `f`.
+ *
+ * @param h Pointer to 761 int16_t coefficients (output, centered)
+ * @param f Pointer to 761 int16_t coefficients
+ * @param g Pointer to 761 int8_t coefficients in {-1, 0, 1}
+ * @return OQS_SUCCESS, or OQS_ERROR if sntrup761 is not enabled
+ */
+OQS_API OQS_STATUS OQS_KEM_ntruprime_sntrup761_poly_Rq_mul_small(int16_t *h, const int16_t *f, const int8_t *g);
+
+/**
+ * @brief sntrup761 - Batched multiplication by small polynomials
+ *
+ * Computes h[i] = f[i] * g[i] for i < count, where the i-th polynomial of
+ * each array starts at offset i * 761.
+ *
+ * @param h Pointer to count * 761 int16_t coefficients (output, centered)
+ * @param f Pointer to count * 761 int16_t coefficients
+ * @param g Pointer to count * 761 int8_t coefficients in {-1, 0, 1}
+ * @param count Number of products
+ * @return OQS_SUCCESS, or OQS_ERROR if sntrup761 is not enabled
+ */
+OQS_API OQS_STATUS OQS_KEM_ntruprime_sntrup761_poly_Rq_mul_small_batch(int16_t *h, const int16_t *f, const int8_t *g, size_t count);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* OQS_RING_MUL_API_H */
@@ -236,7 +236,7 @@ def list_variants():
 
 def apply_patches(slh_patch_dir):
     for root, dirs, files in os.walk(slh_patch_dir):
-        for file in files:
+        for file in sorted(files):
             full_path = os.path.join(root, file)
             subprocess.run(["git","apply",full_path], check=True)
             
@@ -306,6 +306,8 @@ def main():
     #enumerate template file paths
     jinja_sig_c_file = os.path.join(template_dir,'slh_dsa_sig_c_template.jinja')
     jinja_sig_h_file = os.path.join(template_dir,'slh_dsa_sig_h_template.jinja')
+    jinja_sig_verify_c_file = os.path.join(template_dir,'slh_dsa_sig_verify_c_template.jinja')
+    jinja_sig_verify_h_file = os.path.join(template_dir,'slh_dsa_sig_verify_h_template.jinja')
     jinja_alg_support_file = os.path.join(template_dir,'slh_dsa_alg_support_template.jinja')
     jinja_oqsconfig_file = os.path.join(template_dir,'slh_dsa_oqsconfig_template.jinja')
     jinja_docs_yml_file = os.path.join(template_dir,'slh_dsa_docs_yml_template.jinja')
@@ -314,6 +316,8 @@ def main():
     #enumerate destination file paths
     sig_c_path = os.path.join(os.environ['LIBOQS_DIR'],'src','sig','sig.c')
     sig_h_path = os.path.join(os.environ['LIBOQS_DIR'],'src','sig','sig.h')
+    sig_verify_c_path = os.path.join(os.environ['LIBOQS_DIR'],'src','sig','sig_verify.c')
+    sig_verify_h_path = os.path.join(os.environ['LIBOQS_DIR'],'src','sig','sig_verify.h')
     alg_support_path = os.path.join(os.environ['LIBOQS_DIR'],'.CMake','alg_support.cmake')
     oqsconfig_path = os.path.join(os.environ['LIBOQS_DIR'],'src','oqsconfig.h.cmake')
     docs_yml_path = os.path.join(os.environ['LIBOQS_DIR'],'docs','algorithms','sig','slh_dsa.yml')
@@ -328,6 +332,8 @@ def main():
     #replace file contents
     file_replacer(jinja_sig_c_file, sig_c_path, {'variants': variants},'/////')
     file_replacer(jinja_sig_h_file, sig_h_path, {'variants': variants},'/////')
+    file_replacer(jinja_sig_verify_c_file, sig_verify_c_path, {'variants': variants},'/////')
+    file_replacer(jinja_sig_verify_h_file, sig_verify_h_path, {'variants': variants},'/////')
     file_replacer(jinja_alg_support_file, alg_support_path, {'variants': variants},'#####')
     file_replacer(jinja_oqsconfig_file, oqsconfig_path, {'variants': variants},'/////')
     
@@ -346,6 +346,8 @@ def load_instructions(file='copy_from_upstream.yml'):
         for scheme in family['schemes']:
             if not 'upstream_location' in scheme:
                 scheme['upstream_location'] = family['upstream_location']
+            if (not 'verify_stream' in scheme) and 'verify_stream' in family:
+                scheme['verify_stream'] = family['verify_stream']
             if not 'git_commit' in scheme:
                 scheme['git_commit'] = upstreams[scheme['upstream_location']]['git_commit']
             if not 'git_branch' in scheme:
@@ -604,15 +606,20 @@ def handle_implementation(impl, family, scheme, dst_basedir):
 
 
 def process_families(instructions, basedir, with_kat, with_generator, with_libjade=False):
+    # directories copied from an upstream are named "<upstream>_<scheme>_<impl>";
+    # anything else in a family directory (e.g. ml_dsa/lowstack) is maintained in liboqs
+    upstream_prefixes = tuple(upstream['name'] + '_' for upstream in instructions['upstreams'])
     for family in instructions['kems'] + instructions['sigs']:
         try:
             os.makedirs(os.path.join(basedir, 'src', family['type'], family['name']))
         except:
             if delete:
-                # clear out all subdirectories
+                # clear out all upstream subdirectories
                 with os.scandir(os.path.join(basedir, 'src', family['type'], family['name'])) as ls:
                     for entry in ls:
                         if entry.is_dir(follow_symlinks=False):
+                            if not entry.name.startswith(upstream_prefixes):
+                                continue
                             if with_libjade:
                                 if not entry.name.startswith('libjade'):
                                     continue
@@ -772,6 +779,8 @@ def copy_from_upstream(slh_dsa_inst: dict):
     replacer('src/kem/kem.h', instructions, '/////')
     replacer('src/sig/sig.c', instructions, '/////')
     replacer('src/sig/sig.h', instructions, '/////')
+    replacer('src/sig/sig_verify.c', instructions, '/////')
+    replacer('src/sig/sig_verify.h', instructions, '/////')
     replacer('tests/kat_sig.c', instructions, '/////')
     # Finally store KATS away again
     for t in ["kem", "sig"]:
@@ -3,6 +3,10 @@
 #include <stdlib.h>
 
 #include <oqs/kem_{{ family }}.h>
+{%- if family == 'ml_kem' %}
+
+#include "../kem_key.h"
+{%- endif %}
 
 {% for scheme in schemes -%}
 #if defined(OQS_ENABLE_KEM_{{ family }}_{{ scheme['scheme'] }}) {%- if 'alias_scheme' in scheme %} || defined(OQS_ENABLE_KEM_{{ family }}_{{ scheme['alias_scheme'] }}){%- endif %}
@@ -499,6 +503,173 @@ OQS_API OQS_STATUS OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_decaps(uint8_t *s
 #endif /* OQS_LIBJADE_BUILD */
 {%- endif %}
 }
+{%- if family == 'ml_kem' %}
+
+extern size_t PQCP_MLKEM_NATIVE_C_MLKEM{{ scheme['scheme'] }}_expanded_pk_bytes(void);
+extern size_t PQCP_MLKEM_NATIVE_C_MLKEM{{ scheme['scheme'] }}_expanded_sk_bytes(void);
+extern int PQCP_MLKEM_NATIVE_C_MLKEM{{ scheme['scheme'] }}_expand_pk(void *epk, const uint8_t *pk);
+extern int PQCP_MLKEM_NATIVE_C_MLKEM{{ scheme['scheme'] }}_expand_sk(void *esk, const uint8_t *sk);
+extern int PQCP_MLKEM_NATIVE_C_MLKEM{{ scheme['scheme'] }}_enc_expanded(uint8_t *ct, uint8_t *ss, const void *epk);
+extern int PQCP_MLKEM_NATIVE_C_MLKEM{{ scheme['scheme'] }}_dec_expanded(uint8_t *ss, const uint8_t *ct, const void *esk);
+
+#if defined(OQS_ENABLE_KEM_ml_kem_{{ scheme['scheme'] }}_x86_64)
+extern size_t PQCP_MLKEM_NATIVE_X86_64_MLKEM{{ scheme['scheme'] }}_expanded_pk_bytes(void);
+extern size_t PQCP_MLKEM_NATIVE_X86_64_MLKEM{{ scheme['scheme'] }}_expanded_sk_bytes(void);
+extern int PQCP_MLKEM_NATIVE_X86_64_MLKEM{{ scheme['scheme'] }}_expand_pk(void *epk, const uint8_t *pk);
+extern int PQCP_MLKEM_NATIVE_X86_64_MLKEM{{ scheme['scheme'] }}_expand_sk(void *esk, const uint8_t *sk);
+extern int PQCP_MLKEM_NATIVE_X86_64_MLKEM{{ scheme['scheme'] }}_enc_expanded(uint8_t *ct, uint8_t *ss, const void *epk);
+extern int PQCP_MLKEM_NATIVE_X86_64_MLKEM{{ scheme['scheme'] }}_dec_expanded(uint8_t *ss, const uint8_t *ct, const void *esk);
+#endif
+
+#if defined(OQS_ENABLE_KEM_ml_kem_{{ scheme['scheme'] }}_aarch64)
+extern size_t PQCP_MLKEM_NATIVE_AARCH64_MLKEM{{ scheme['scheme'] }}_expanded_pk_bytes(void);
+extern size_t PQCP_MLKEM_NATIVE_AARCH64_MLKEM{{ scheme['scheme'] }}_expanded_sk_bytes(void);
+extern int PQCP_MLKEM_NATIVE_AARCH64_MLKEM{{ scheme['scheme'] }}_expand_pk(void *epk, const uint8_t *pk);
+extern int PQCP_MLKEM_NATIVE_AARCH64_MLKEM{{ scheme['scheme'] }}_expand_sk(void *esk, const uint8_t *sk);
+extern int PQCP_MLKEM_NATIVE_AARCH64_MLKEM{{ scheme['scheme'] }}_enc_expanded(uint8_t *ct, uint8_t *ss, const void *epk);
+extern int PQCP_MLKEM_NATIVE_AARCH64_MLKEM{{ scheme['scheme'] }}_dec_expanded(uint8_t *ss, const uint8_t *ct, const void *esk);
+#endif
+
+static OQS_STATUS ml_kem_{{ scheme['scheme'] }}_key_expand(OQS_KEM_KEY *key) {
+	size_t len = (key->type == OQS_KEM_KEY_SECRET) ? PQCP_MLKEM_NATIVE_C_MLKEM{{ scheme['scheme'] }}_expanded_sk_bytes() : PQCP_MLKEM_NATIVE_C_MLKEM{{ scheme['scheme'] }}_expanded_pk_bytes();
+	void *expanded = OQS_MEM_malloc(len);
+	int rc;
+	if (expanded == NULL) {
+		return OQS_ERROR;
+	}
+	if (key->type == OQS_KEM_KEY_SECRET) {
+		rc = PQCP_MLKEM_NATIVE_C_MLKEM{{ scheme['scheme'] }}_expand_sk(expanded, key->bytes);
+	} else {
+		rc = PQCP_MLKEM_NATIVE_C_MLKEM{{ scheme['scheme'] }}_expand_pk(expanded, key->bytes);
+	}
+	/* the key failed the input checks of FIPS 203 */
+	if (rc != 0) {
+		OQS_MEM_secure_free(expanded, len);
+		return OQS_ERROR;
+	}
+	key->expanded = expanded;
+	key->expanded_len = len;
+	return OQS_SUCCESS;
+}
+
+static OQS_STATUS ml_kem_{{ scheme['scheme'] }}_key_encaps(uint8_t *ciphertext, uint8_t *shared_secret, const OQS_KEM_KEY *public_key) {
+	return (OQS_STATUS) PQCP_MLKEM_NATIVE_C_MLKEM{{ scheme['scheme'] }}_enc_expanded(ciphertext, shared_secret, public_key->expanded);
+}
+
+static OQS_STATUS ml_kem_{{ scheme['scheme'] }}_key_decaps(uint8_t *shared_secret, const uint8_t *ciphertext, const OQS_KEM_KEY *secret_key) {
+	return (OQS_STATUS) PQCP_MLKEM_NATIVE_C_MLKEM{{ scheme['scheme'] }}_dec_expanded(shared_secret, ciphertext, secret_key->expanded);
+}
+
+static const OQS_KEM_KEY_ops ml_kem_{{ scheme['scheme'] }}_key_ops = {
+	.expand = ml_kem_{{ scheme['scheme'] }}_key_expand,
+	.encaps = ml_kem_{{ scheme['scheme'] }}_key_encaps,
+	.decaps = ml_kem_{{ scheme['scheme'] }}_key_decaps,
+};
+
+#if defined(OQS_ENABLE_KEM_ml_kem_{{ scheme['scheme'] }}_x86_64)
+static OQS_STATUS ml_kem_{{ scheme['scheme'] }}_x86_64_key_expand(OQS_KEM_KEY *key) {
+	size_t len = (key->type == OQS_KEM_KEY_SECRET) ? PQCP_MLKEM_NATIVE_X86_64_MLKEM{{ scheme['scheme'] }}_expanded_sk_bytes() : PQCP_MLKEM_NATIVE_X86_64_MLKEM{{ scheme['scheme'] }}_expanded_pk_bytes();
+	void *expanded = OQS_MEM_malloc(len);
+	int rc;
+	if (expanded == NULL) {
+		return OQS_ERROR;
+	}
+	if (key->type == OQS_KEM_KEY_SECRET) {
+		rc = PQCP_MLKEM_NATIVE_X86_64_MLKEM{{ scheme['scheme'] }}_expand_sk(expanded, key->bytes);
+	} else {
+		rc = PQCP_MLKEM_NATIVE_X86_64_MLKEM{{ scheme['scheme'] }}_expand_pk(expanded, key->bytes);
+	}
+	/* the key failed the input checks of FIPS 203 */
+	if (rc != 0) {
+		OQS_MEM_secure_free(expanded, len);
+		return OQS_ERROR;
+	}
+	key->expanded = expanded;
+	key->expanded_len = len;
+	return OQS_SUCCESS;
+}
+
+static OQS_STATUS ml_kem_{{ scheme['scheme'] }}_x86_64_key_encaps(uint8_t *ciphertext, uint8_t *shared_secret, const OQS_KEM_KEY *public_key) {
+	return (OQS_STATUS) PQCP_MLKEM_NATIVE_X86_64_MLKEM{{ scheme['scheme'] }}_enc_expanded(ciphertext, shared_secret, public_key->expanded);
+}
+
+static OQS_STATUS ml_kem_{{ scheme['scheme'] }}_x86_64_key_decaps(uint8_t *shared_secret, const uint8_t *ciphertext, const OQS_KEM_KEY *secret_key) {
+	return (OQS_STATUS) PQCP_MLKEM_NATIVE_X86_64_MLKEM{{ scheme['scheme'] }}_dec_expanded(shared_secret, ciphertext, secret_key->expanded);
+}
+
+static const OQS_KEM_KEY_ops ml_kem_{{ scheme['scheme'] }}_x86_64_key_ops = {
+	.expand = ml_kem_{{ scheme['scheme'] }}_x86_64_key_expand,
+	.encaps = ml_kem_{{ scheme['scheme'] }}_x86_64_key_encaps,
+	.decaps = ml_kem_{{ scheme['scheme'] }}_x86_64_key_decaps,
+};
+#endif
+
+#if defined(OQS_ENABLE_KEM_ml_kem_{{ scheme['scheme'] }}_aarch64)
+static OQS_STATUS ml_kem_{{ scheme['scheme'] }}_aarch64_key_expand(OQS_KEM_KEY *key) {
+	size_t len = (key->type == OQS_KEM_KEY_SECRET) ? PQCP_MLKEM_NATIVE_AARCH64_MLKEM{{ scheme['scheme'] }}_expanded_sk_bytes() : PQCP_MLKEM_NATIVE_AARCH64_MLKEM{{ scheme['scheme'] }}_expanded_pk_bytes();
+	void *expanded = OQS_MEM_malloc(len);
+	int rc;
+	if (expanded == NULL) {
+		return OQS_ERROR;
+	}
+	if (key->type == OQS_KEM_KEY_SECRET) {
+		rc = PQCP_MLKEM_NATIVE_AARCH64_MLKEM{{ scheme['scheme'] }}_expand_sk(expanded, key->bytes);
+	} else {
+		rc = PQCP_MLKEM_NATIVE_AARCH64_MLKEM{{ scheme['scheme'] }}_expand_pk(expanded, key->bytes);
+	}
+	/* the key failed the input checks of FIPS 203 */
+	if (rc != 0) {
+		OQS_MEM_secure_free(expanded, len);
+		return OQS_ERROR;
+	}
+	key->expanded = expanded;
+	key->expanded_len = len;
+	return OQS_SUCCESS;
+}
+
+static OQS_STATUS ml_kem_{{ scheme['scheme'] }}_aarch64_key_encaps(uint8_t *ciphertext, uint8_t *shared_secret, const OQS_KEM_KEY *public_key) {
+	return (OQS_STATUS) PQCP_MLKEM_NATIVE_AARCH64_MLKEM{{ scheme['scheme'] }}_enc_expanded(ciphertext, shared_secret, public_key->expanded);
+}
+
+static OQS_STATUS ml_kem_{{ scheme['scheme'] }}_aarch64_key_decaps(uint8_t *shared_secret, const uint8_t *ciphertext, const OQS_KEM_KEY *secret_key) {
+	return (OQS_STATUS) PQCP_MLKEM_NATIVE_AARCH64_MLKEM{{ scheme['scheme'] }}_dec_expanded(shared_secret, ciphertext, secret_key->expanded);
+}
+
+static const OQS_KEM_KEY_ops ml_kem_{{ scheme['scheme'] }}_aarch64_key_ops = {
+	.expand = ml_kem_{{ scheme['scheme'] }}_aarch64_key_expand,
+	.encaps = ml_kem_{{ scheme['scheme'] }}_aarch64_key_encaps,
+	.decaps = ml_kem_{{ scheme['scheme'] }}_aarch64_key_decaps,
+};
+#endif
+
+/* The precomputed keys hold polynomials in the order of the backend that
+ * expanded them, so each backend has its own ops, picked the way the wrappers
+ * above pick the backend. The GPU builds keep keys as bytes. */
+const OQS_KEM_KEY_ops *OQS_KEM_ml_kem_{{ scheme['scheme'] }}_key_ops(void) {
+	const OQS_KEM_KEY_ops *ops = &ml_kem_{{ scheme['scheme'] }}_key_ops;
+#if defined(OQS_ENABLE_KEM_ml_kem_{{ scheme['scheme'] }}_x86_64)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2) && OQS_CPU_has_extension(OQS_CPU_EXT_BMI2) && OQS_CPU_has_extension(OQS_CPU_EXT_POPCNT)) {
+#endif /* OQS_DIST_BUILD */
+		ops = &ml_kem_{{ scheme['scheme'] }}_x86_64_key_ops;
+#if defined(OQS_DIST_BUILD)
+	}
+#endif /* OQS_DIST_BUILD */
+#elif defined(OQS_ENABLE_KEM_ml_kem_{{ scheme['scheme'] }}_aarch64)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_ARM_NEON)) {
+#endif /* OQS_DIST_BUILD */
+		ops = &ml_kem_{{ scheme['scheme'] }}_aarch64_key_ops;
+#if defined(OQS_DIST_BUILD)
+	}
+#endif /* OQS_DIST_BUILD */
+#endif
+#if defined(OQS_ENABLE_KEM_ml_kem_{{ scheme['scheme'] }}_cuda) || defined(OQS_ENABLE_KEM_ml_kem_{{ scheme['scheme'] }}_icicle_cuda)
+	ops = NULL;
+#endif
+	return ops;
+}
+{%- endif %}
 
 #endif
 {% endfor -%}
\ No newline at end of file
@@ -1,8 +1,51 @@
+{%- macro verify_stream_dispatch(scheme, suffix, args, ret) -%}
+    {%- for impl in scheme['metadata']['implementations'] if impl['name'] != scheme['default_implementation'] %}
+    {%- if loop.first %}
+#if defined(OQS_ENABLE_SIG_{{ family }}_{{ scheme['scheme'] }}_{{ impl['name'] }}) {%- if 'alias_scheme' in scheme %} || defined(OQS_ENABLE_SIG_{{ family }}_{{ scheme['alias_scheme'] }}_{{ impl['name'] }}){%- endif %}
+    {%- else %}
+#elif defined(OQS_ENABLE_SIG_{{ family }}_{{ scheme['scheme'] }}_{{ impl['name'] }}) {%- if 'alias_scheme' in scheme %} || defined(OQS_ENABLE_SIG_{{ family }}_{{ scheme['alias_scheme'] }}_{{ impl['name'] }}){%- endif %}
+    {%- endif %}
+    {%- if 'required_flags' in impl and impl['required_flags'] %}
+#if defined(OQS_DIST_BUILD)
+	if ({%- for flag in impl['required_flags'] -%}OQS_CPU_has_extension(OQS_CPU_EXT_{{ flag|upper }}){%- if not loop.last %} && {% endif -%}{%- endfor -%}) {
+#endif /* OQS_DIST_BUILD */
+    {%- endif %}
+           {%- if impl['signature_verify'] %}
+		{{ ret }}{{ impl['signature_verify'] }}{{ suffix }}({{ args }});
+           {%- else %}
+		{{ ret }}PQCLEAN_{{ scheme['pqclean_scheme_c']|upper }}_{{ impl['name']|upper }}_crypto_sign_verify{{ suffix }}({{ args }});
+           {%- endif %}
+    {%- if 'required_flags' in impl and impl['required_flags'] %}
+#if defined(OQS_DIST_BUILD)
+	} else {
+		{{ ret }}{{ scheme['metadata']['default_verify_signature'] }}{{ suffix }}({{ args }});
+	}
+#endif /* OQS_DIST_BUILD */
+    {%- endif %}
+    {%- endfor %}
+    {%- if scheme['metadata']['implementations']|rejectattr('name', 'equalto', scheme['default_implementation'])|list %}
+#else
+    {%- endif %}
+	{{ ret }}{{ scheme['metadata']['default_verify_signature'] }}{{ suffix }}({{ args }});
+    {%- if scheme['metadata']['implementations']|rejectattr('name', 'equalto', scheme['default_implementation'])|list %}
+#endif
+    {%- endif %}
+{%- endmacro -%}
+{%- set ml_dsa_low_stack = family == 'ml_dsa' -%}
 // SPDX-License-Identifier: MIT
 
 #include <stdlib.h>
 
 #include <oqs/sig_{{ family }}.h>
+{%- if verify_stream is defined %}
+#include <oqs/sha3.h>
+
+#include "../sig_verify.h"
+{%- endif %}
+{%- if family == 'ml_dsa' %}
+
+#include "../sig_key.h"
+{%- endif %}
 
 {% for scheme in schemes -%}
 #if defined(OQS_ENABLE_SIG_{{ family }}_{{ scheme['scheme'] }}) {%- if 'alias_scheme' in scheme %} || defined(OQS_ENABLE_SIG_{{ family }}_{{ scheme['alias_scheme'] }}){%- endif %}
@@ -90,6 +133,9 @@ OQS_SIG *OQS_SIG_{{ family }}_{{ scheme['alias_scheme'] }}_new(void) {
         {%- endif %}
 
 extern int {{ scheme['metadata']['default_keypair_signature'] }}(uint8_t *pk, uint8_t *sk);
+{%- if scheme['metadata']['length-keypair-seed'] is defined %}
+extern int {{ scheme['metadata']['default_keypair_signature'] }}_internal(uint8_t *pk, uint8_t *sk, const uint8_t *seed);
+{%- endif %}
 
         {%- if impl['signature_signature'] %}
            {%- set cleansignature = scheme['metadata'].update({'default_signature_signature': impl['signature_signature']}) -%}
@@ -111,9 +157,25 @@ extern int {{ scheme['metadata']['default_signature_signature'] }}(uint8_t *sig,
 extern int {{ scheme['metadata']['default_verify_signature']  }}(const uint8_t *sig, size_t siglen, const uint8_t *m, size_t mlen, const uint8_t *ctx, size_t ctxlen, const uint8_t *pk);
 {%- else %}
 extern int {{ scheme['metadata']['default_verify_signature']  }}(const uint8_t *sig, size_t siglen, const uint8_t *m, size_t mlen, const uint8_t *pk);
+{%- endif %}
+{%- if scheme['verify_stream'] is defined %}
+extern int {{ scheme['metadata']['default_verify_signature'] }}_init(OQS_SHA3_{{ scheme['verify_stream'] }}_inc_ctx *state, const uint8_t *sig, size_t siglen);
+extern void {{ scheme['metadata']['default_verify_signature'] }}_update(OQS_SHA3_{{ scheme['verify_stream'] }}_inc_ctx *state, const uint8_t *m, size_t mlen);
+extern int {{ scheme['metadata']['default_verify_signature'] }}_final(OQS_SHA3_{{ scheme['verify_stream'] }}_inc_ctx *state, const uint8_t *sig, size_t siglen, const uint8_t *pk);
 {%- endif %}
 
     {%- endfor %}
+{%- if ml_dsa_low_stack %}
+
+#if defined(OQS_ML_DSA_LOW_STACK)
+extern int pqcrystals_ml_dsa_{{ scheme['scheme'] }}_ref_lowstack_keypair(uint8_t *pk, uint8_t *sk);
+{%- if scheme['metadata']['length-keypair-seed'] is defined %}
+extern int pqcrystals_ml_dsa_{{ scheme['scheme'] }}_ref_lowstack_keypair_internal(uint8_t *pk, uint8_t *sk, const uint8_t *seed);
+{%- endif %}
+extern int pqcrystals_ml_dsa_{{ scheme['scheme'] }}_ref_lowstack_signature(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const uint8_t *ctx, size_t ctxlen, const uint8_t *sk);
+extern int pqcrystals_ml_dsa_{{ scheme['scheme'] }}_ref_lowstack_verify(const uint8_t *sig, size_t siglen, const uint8_t *m, size_t mlen, const uint8_t *ctx, size_t ctxlen, const uint8_t *pk);
+#endif
+{%- endif %}
 
     {%- for impl in scheme['metadata']['implementations'] if impl['name'] != scheme['default_implementation'] %}
 
@@ -123,6 +185,9 @@ extern int {{ impl['signature_keypair'] }}(uint8_t *pk, uint8_t *sk);
         {%- else %}
 extern int PQCLEAN_{{ scheme['pqclean_scheme_c']|upper }}_{{ impl['name']|upper }}_crypto_sign_keypair(uint8_t *pk, uint8_t *sk);
         {%- endif %}
+        {%- if scheme['metadata']['length-keypair-seed'] is defined %}
+extern int {{ impl['signature_keypair'] }}_internal(uint8_t *pk, uint8_t *sk, const uint8_t *seed);
+        {%- endif %}
 
         {%- if impl['signature_signature'] %}
 {%- if 'api-with-context-string' in impl and impl['api-with-context-string'] %}
@@ -143,12 +208,21 @@ extern int {{ impl['signature_verify'] }}(const uint8_t *sig, size_t siglen, con
         {%- else %}
 extern int PQCLEAN_{{ scheme['pqclean_scheme_c']|upper }}_{{ impl['name']|upper }}_crypto_sign_verify(const uint8_t *sig, size_t siglen, const uint8_t *m, size_t mlen, const uint8_t *pk);
         {%- endif %}
+{%- if scheme['verify_stream'] is defined %}
+extern int {{ impl['signature_verify'] if impl['signature_verify'] else 'PQCLEAN_' ~ scheme['pqclean_scheme_c']|upper ~ '_' ~ impl['name']|upper ~ '_crypto_sign_verify' }}_init(OQS_SHA3_{{ scheme['verify_stream'] }}_inc_ctx *state, const uint8_t *sig, size_t siglen);
+extern void {{ impl['signature_verify'] if impl['signature_verify'] else 'PQCLEAN_' ~ scheme['pqclean_scheme_c']|upper ~ '_' ~ impl['name']|upper ~ '_crypto_sign_verify' }}_update(OQS_SHA3_{{ scheme['verify_stream'] }}_inc_ctx *state, const uint8_t *m, size_t mlen);
+extern int {{ impl['signature_verify'] if impl['signature_verify'] else 'PQCLEAN_' ~ scheme['pqclean_scheme_c']|upper ~ '_' ~ impl['name']|upper ~ '_crypto_sign_verify' }}_final(OQS_SHA3_{{ scheme['verify_stream'] }}_inc_ctx *state, const uint8_t *sig, size_t siglen, const uint8_t *pk);
+{%- endif %}
 #endif
     {%- endfor %}
 
 OQS_API OQS_STATUS OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_keypair(uint8_t *public_key, uint8_t *secret_key) {
+    {%- if ml_dsa_low_stack %}
+#if defined(OQS_ML_DSA_LOW_STACK)
+	return (OQS_STATUS) pqcrystals_ml_dsa_{{ scheme['scheme'] }}_ref_lowstack_keypair(public_key, secret_key);
+    {%- endif %}
     {%- for impl in scheme['metadata']['implementations'] if impl['name'] != scheme['default_implementation'] %}
-    {%- if loop.first %}
+    {%- if loop.first and not ml_dsa_low_stack %}
 #if defined(OQS_ENABLE_SIG_{{ family }}_{{ scheme['scheme'] }}_{{ impl['name'] }}) {%- if 'alias_scheme' in scheme %} || defined(OQS_ENABLE_SIG_{{ family }}_{{ scheme['alias_scheme'] }}_{{ impl['name'] }}){%- endif %}
     {%- else %}
 #elif defined(OQS_ENABLE_SIG_{{ family }}_{{ scheme['scheme'] }}_{{ impl['name'] }}) {%- if 'alias_scheme' in scheme %} || defined(OQS_ENABLE_SIG_{{ family }}_{{ scheme['alias_scheme'] }}_{{ impl['name'] }}){%- endif %}
@@ -171,18 +245,58 @@ OQS_API OQS_STATUS OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_keypair(uint8_t *
 #endif /* OQS_DIST_BUILD */
     {%- endif %}
     {%- endfor %}
-    {%- if scheme['metadata']['implementations']|rejectattr('name', 'equalto', scheme['default_implementation'])|list %}
+    {%- if ml_dsa_low_stack or scheme['metadata']['implementations']|rejectattr('name', 'equalto', scheme['default_implementation'])|list %}
 #else
     {%- endif %}
 	return (OQS_STATUS) {{ scheme['metadata']['default_keypair_signature'] }}(public_key, secret_key);
-    {%- if scheme['metadata']['implementations']|rejectattr('name', 'equalto', scheme['default_implementation'])|list %}
+    {%- if ml_dsa_low_stack or scheme['metadata']['implementations']|rejectattr('name', 'equalto', scheme['default_implementation'])|list %}
+#endif
+    {%- endif %}
+}
+{%- if scheme['metadata']['length-keypair-seed'] is defined %}
+
+OQS_API OQS_STATUS OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_keypair_from_seed(uint8_t *public_key, uint8_t *secret_key, const uint8_t *seed) {
+    {%- if ml_dsa_low_stack %}
+#if defined(OQS_ML_DSA_LOW_STACK)
+	return (OQS_STATUS) pqcrystals_ml_dsa_{{ scheme['scheme'] }}_ref_lowstack_keypair_internal(public_key, secret_key, seed);
+    {%- endif %}
+    {%- for impl in scheme['metadata']['implementations'] if impl['name'] != scheme['default_implementation'] %}
+    {%- if loop.first and not ml_dsa_low_stack %}
+#if defined(OQS_ENABLE_SIG_{{ family }}_{{ scheme['scheme'] }}_{{ impl['name'] }}) {%- if 'alias_scheme' in scheme %} || defined(OQS_ENABLE_SIG_{{ family }}_{{ scheme['alias_scheme'] }}_{{ impl['name'] }}){%- endif %}
+    {%- else %}
+#elif defined(OQS_ENABLE_SIG_{{ family }}_{{ scheme['scheme'] }}_{{ impl['name'] }}) {%- if 'alias_scheme' in scheme %} || defined(OQS_ENABLE_SIG_{{ family }}_{{ scheme['alias_scheme'] }}_{{ impl['name'] }}){%- endif %}
+    {%- endif %}
+    {%- if 'required_flags' in impl and impl['required_flags'] %}
+#if defined(OQS_DIST_BUILD)
+	if ({%- for flag in impl['required_flags'] -%}OQS_CPU_has_extension(OQS_CPU_EXT_{{ flag|upper }}){%- if not loop.last %} && {% endif -%}{%- endfor -%}) {
+#endif /* OQS_DIST_BUILD */
+    {%- endif %}
+		return (OQS_STATUS) {{ impl['signature_keypair'] }}_internal(public_key, secret_key, seed);
+    {%- if 'required_flags' in impl and impl['required_flags'] %}
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) {{ scheme['metadata']['default_keypair_signature'] }}_internal(public_key, secret_key, seed);
+	}
+#endif /* OQS_DIST_BUILD */
+    {%- endif %}
+    {%- endfor %}
+    {%- if ml_dsa_low_stack or scheme['metadata']['implementations']|rejectattr('name', 'equalto', scheme['default_implementation'])|list %}
+#else
+    {%- endif %}
+	return (OQS_STATUS) {{ scheme['metadata']['default_keypair_signature'] }}_internal(public_key, secret_key, seed);
+    {%- if ml_dsa_low_stack or scheme['metadata']['implementations']|rejectattr('name', 'equalto', scheme['default_implementation'])|list %}
 #endif
     {%- endif %}
 }
+{%- endif %}
 
 OQS_API OQS_STATUS OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_sign(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *secret_key) {
+    {%- if ml_dsa_low_stack %}
+#if defined(OQS_ML_DSA_LOW_STACK)
+	return (OQS_STATUS) pqcrystals_ml_dsa_{{ scheme['scheme'] }}_ref_lowstack_signature(signature, signature_len, message, message_len, NULL, 0, secret_key);
+    {%- endif %}
     {%- for impl in scheme['metadata']['implementations'] if impl['name'] != scheme['default_implementation'] %}
-    {%- if loop.first %}
+    {%- if loop.first and not ml_dsa_low_stack %}
 #if defined(OQS_ENABLE_SIG_{{ family }}_{{ scheme['scheme'] }}_{{ impl['name'] }}) {%- if 'alias_scheme' in scheme %} || defined(OQS_ENABLE_SIG_{{ family }}_{{ scheme['alias_scheme'] }}_{{ impl['name'] }}){%- endif %}
     {%- else %}
 #elif defined(OQS_ENABLE_SIG_{{ family }}_{{ scheme['scheme'] }}_{{ impl['name'] }}) {%- if 'alias_scheme' in scheme %} || defined(OQS_ENABLE_SIG_{{ family }}_{{ scheme['alias_scheme'] }}_{{ impl['name'] }}){%- endif %}
@@ -213,7 +327,7 @@ OQS_API OQS_STATUS OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_sign(uint8_t *sig
 #endif /* OQS_DIST_BUILD */
     {%- endif %}
     {%- endfor %}
-    {%- if scheme['metadata']['implementations']|rejectattr('name', 'equalto', scheme['default_implementation'])|list %}
+    {%- if ml_dsa_low_stack or scheme['metadata']['implementations']|rejectattr('name', 'equalto', scheme['default_implementation'])|list %}
 #else
     {%- endif %}
     {%- set default_impl = scheme['metadata']['implementations'] | selectattr("name", "equalto", scheme['default_implementation']) | first -%}
@@ -222,14 +336,18 @@ OQS_API OQS_STATUS OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_sign(uint8_t *sig
     {%- else %}
 	return (OQS_STATUS) {{ scheme['metadata']['default_signature_signature'] }}(signature, signature_len, message, message_len, secret_key);
     {%- endif %}
-    {%- if scheme['metadata']['implementations']|rejectattr('name', 'equalto', scheme['default_implementation'])|list %}
+    {%- if ml_dsa_low_stack or scheme['metadata']['implementations']|rejectattr('name', 'equalto', scheme['default_implementation'])|list %}
 #endif
     {%- endif %}
 }
 
 OQS_API OQS_STATUS OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key) {
+    {%- if ml_dsa_low_stack %}
+#if defined(OQS_ML_DSA_LOW_STACK)
+	return (OQS_STATUS) pqcrystals_ml_dsa_{{ scheme['scheme'] }}_ref_lowstack_verify(signature, signature_len, message, message_len, NULL, 0, public_key);
+    {%- endif %}
     {%- for impl in scheme['metadata']['implementations'] if impl['name'] != scheme['default_implementation'] %}
-    {%- if loop.first %}
+    {%- if loop.first and not ml_dsa_low_stack %}
 #if defined(OQS_ENABLE_SIG_{{ family }}_{{ scheme['scheme'] }}_{{ impl['name'] }}) {%- if 'alias_scheme' in scheme %} || defined(OQS_ENABLE_SIG_{{ family }}_{{ scheme['alias_scheme'] }}_{{ impl['name'] }}){%- endif %}
     {%- else %}
 #elif defined(OQS_ENABLE_SIG_{{ family }}_{{ scheme['scheme'] }}_{{ impl['name'] }}) {%- if 'alias_scheme' in scheme %} || defined(OQS_ENABLE_SIG_{{ family }}_{{ scheme['alias_scheme'] }}_{{ impl['name'] }}){%- endif %}
@@ -260,7 +378,7 @@ OQS_API OQS_STATUS OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_verify(const uint
 #endif /* OQS_DIST_BUILD */
     {%- endif %}
     {%- endfor %}
-    {%- if scheme['metadata']['implementations']|rejectattr('name', 'equalto', scheme['default_implementation'])|list %}
+    {%- if ml_dsa_low_stack or scheme['metadata']['implementations']|rejectattr('name', 'equalto', scheme['default_implementation'])|list %}
 #else
     {%- endif %}
     {%- set default_impl = scheme['metadata']['implementations'] | selectattr("name", "equalto", scheme['default_implementation']) | first -%}
@@ -269,7 +387,7 @@ OQS_API OQS_STATUS OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_verify(const uint
     {%- else %}
 	return (OQS_STATUS) {{ scheme['metadata']['default_verify_signature'] }}(signature, signature_len, message, message_len, public_key);
     {%- endif %}
-    {%- if scheme['metadata']['implementations']|rejectattr('name', 'equalto', scheme['default_implementation'])|list %}
+    {%- if ml_dsa_low_stack or scheme['metadata']['implementations']|rejectattr('name', 'equalto', scheme['default_implementation'])|list %}
 #endif
     {%- endif %}
 }
@@ -277,8 +395,12 @@ OQS_API OQS_STATUS OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_verify(const uint
 {%- set default_impl = scheme['metadata']['implementations'] | selectattr("name", "equalto", scheme['default_implementation']) | first %}
 {%- if 'api-with-context-string' in default_impl and default_impl['api-with-context-string'] %}
 OQS_API OQS_STATUS OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_sign_with_ctx_str(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *secret_key) {
+    {%- if ml_dsa_low_stack %}
+#if defined(OQS_ML_DSA_LOW_STACK)
+	return (OQS_STATUS) pqcrystals_ml_dsa_{{ scheme['scheme'] }}_ref_lowstack_signature(signature, signature_len, message, message_len, ctx_str, ctx_str_len, secret_key);
+    {%- endif %}
     {%- for impl in scheme['metadata']['implementations'] if impl['name'] != scheme['default_implementation'] %}
-    {%- if loop.first %}
+    {%- if loop.first and not ml_dsa_low_stack %}
 #if defined(OQS_ENABLE_SIG_{{ family }}_{{ scheme['scheme'] }}_{{ impl['name'] }}) {%- if 'alias_scheme' in scheme %} || defined(OQS_ENABLE_SIG_{{ family }}_{{ scheme['alias_scheme'] }}_{{ impl['name'] }}){%- endif %}
     {%- else %}
 #elif defined(OQS_ENABLE_SIG_{{ family }}_{{ scheme['scheme'] }}_{{ impl['name'] }}) {%- if 'alias_scheme' in scheme %} || defined(OQS_ENABLE_SIG_{{ family }}_{{ scheme['alias_scheme'] }}_{{ impl['name'] }}){%- endif %}
@@ -301,19 +423,23 @@ OQS_API OQS_STATUS OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_sign_with_ctx_str
 #endif /* OQS_DIST_BUILD */
     {%- endif %}
     {%- endfor %}
-    {%- if scheme['metadata']['implementations']|rejectattr('name', 'equalto', scheme['default_implementation'])|list %}
+    {%- if ml_dsa_low_stack or scheme['metadata']['implementations']|rejectattr('name', 'equalto', scheme['default_implementation'])|list %}
 #else
     {%- endif %}
     {%- set default_impl = scheme['metadata']['implementations'] | selectattr("name", "equalto", scheme['default_implementation']) | first %}
 	return (OQS_STATUS) {{ scheme['metadata']['default_signature_signature'] }}(signature, signature_len, message, message_len, ctx_str, ctx_str_len, secret_key);
-    {%- if scheme['metadata']['implementations']|rejectattr('name', 'equalto', scheme['default_implementation'])|list %}
+    {%- if ml_dsa_low_stack or scheme['metadata']['implementations']|rejectattr('name', 'equalto', scheme['default_implementation'])|list %}
 #endif
     {%- endif %}
 }
 
 OQS_API OQS_STATUS OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_verify_with_ctx_str(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key) {
+    {%- if ml_dsa_low_stack %}
+#if defined(OQS_ML_DSA_LOW_STACK)
+	return (OQS_STATUS) pqcrystals_ml_dsa_{{ scheme['scheme'] }}_ref_lowstack_verify(signature, signature_len, message, message_len, ctx_str, ctx_str_len, public_key);
+    {%- endif %}
     {%- for impl in scheme['metadata']['implementations'] if impl['name'] != scheme['default_implementation'] %}
-    {%- if loop.first %}
+    {%- if loop.first and not ml_dsa_low_stack %}
 #if defined(OQS_ENABLE_SIG_{{ family }}_{{ scheme['scheme'] }}_{{ impl['name'] }}) {%- if 'alias_scheme' in scheme %} || defined(OQS_ENABLE_SIG_{{ family }}_{{ scheme['alias_scheme'] }}_{{ impl['name'] }}){%- endif %}
     {%- else %}
 #elif defined(OQS_ENABLE_SIG_{{ family }}_{{ scheme['scheme'] }}_{{ impl['name'] }}) {%- if 'alias_scheme' in scheme %} || defined(OQS_ENABLE_SIG_{{ family }}_{{ scheme['alias_scheme'] }}_{{ impl['name'] }}){%- endif %}
@@ -336,12 +462,12 @@ OQS_API OQS_STATUS OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_verify_with_ctx_s
 #endif /* OQS_DIST_BUILD */
     {%- endif %}
     {%- endfor %}
-    {%- if scheme['metadata']['implementations']|rejectattr('name', 'equalto', scheme['default_implementation'])|list %}
+    {%- if ml_dsa_low_stack or scheme['metadata']['implementations']|rejectattr('name', 'equalto', scheme['default_implementation'])|list %}
 #else
     {%- endif %}
     {%- set default_impl = scheme['metadata']['implementations'] | selectattr("name", "equalto", scheme['default_implementation']) | first %}
 	return (OQS_STATUS) {{ scheme['metadata']['default_verify_signature'] }}(signature, signature_len, message, message_len, ctx_str, ctx_str_len, public_key);
-    {%- if scheme['metadata']['implementations']|rejectattr('name', 'equalto', scheme['default_implementation'])|list %}
+    {%- if ml_dsa_low_stack or scheme['metadata']['implementations']|rejectattr('name', 'equalto', scheme['default_implementation'])|list %}
 #endif
     {%- endif %}
 }
@@ -363,5 +489,165 @@ OQS_API OQS_STATUS OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_verify_with_ctx_s
 	}
 }
 {%- endif %}
+{%- if scheme['verify_stream'] is defined %}
+
+static OQS_STATUS {{ family }}_{{ scheme['scheme'] }}_verify_init(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key) {
+	(void) public_key;
+	if (ctx_str != NULL || ctx_str_len != 0) {
+		return OQS_ERROR;
+	}
+{{- verify_stream_dispatch(scheme, '_init', 'state, signature, signature_len', 'return (OQS_STATUS) ') }}
+}
+
+static void {{ family }}_{{ scheme['scheme'] }}_verify_update(void *state, const uint8_t *message, size_t message_len) {
+{{- verify_stream_dispatch(scheme, '_update', 'state, message, message_len', '') }}
+}
+
+static OQS_STATUS {{ family }}_{{ scheme['scheme'] }}_verify_final(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key) {
+{{- verify_stream_dispatch(scheme, '_final', 'state, signature, signature_len, public_key', 'return (OQS_STATUS) ') }}
+}
+
+static void {{ family }}_{{ scheme['scheme'] }}_verify_abort(void *state) {
+	OQS_SHA3_{{ scheme['verify_stream'] }}_inc_ctx_release(state);
+}
+
+static const OQS_SIG_VERIFY_ops {{ family }}_{{ scheme['scheme'] }}_verify_ops = {
+	.state_len = sizeof(OQS_SHA3_{{ scheme['verify_stream'] }}_inc_ctx),
+	.init = {{ family }}_{{ scheme['scheme'] }}_verify_init,
+	.update = {{ family }}_{{ scheme['scheme'] }}_verify_update,
+	.final = {{ family }}_{{ scheme['scheme'] }}_verify_final,
+	.abort = {{ family }}_{{ scheme['scheme'] }}_verify_abort,
+};
+
+const OQS_SIG_VERIFY_ops *OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_verify_ops(void) {
+	return &{{ family }}_{{ scheme['scheme'] }}_verify_ops;
+}
+{%- endif %}
+{%- if family == 'ml_dsa' %}
+
+extern size_t pqcrystals_ml_dsa_{{ scheme['scheme'] }}_ref_expanded_pk_bytes(void);
+extern size_t pqcrystals_ml_dsa_{{ scheme['scheme'] }}_ref_expanded_sk_bytes(void);
+extern void pqcrystals_ml_dsa_{{ scheme['scheme'] }}_ref_expand_pk(void *xpk, const uint8_t *pk);
+extern void pqcrystals_ml_dsa_{{ scheme['scheme'] }}_ref_expand_sk(void *xsk, const uint8_t *sk);
+extern int pqcrystals_ml_dsa_{{ scheme['scheme'] }}_ref_signature_expanded(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const uint8_t *ctx, size_t ctxlen, const void *xsk);
+extern int pqcrystals_ml_dsa_{{ scheme['scheme'] }}_ref_verify_expanded(const uint8_t *sig, size_t siglen, const uint8_t *m, size_t mlen, const uint8_t *ctx, size_t ctxlen, const void *xpk);
+
+#if defined(OQS_ENABLE_SIG_ml_dsa_{{ scheme['scheme'] }}_aarch64)
+extern int pqcrystals_ml_dsa_{{ scheme['scheme'] }}_aarch64_signature_expanded(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const uint8_t *ctx, size_t ctxlen, const void *xsk);
+extern int pqcrystals_ml_dsa_{{ scheme['scheme'] }}_aarch64_verify_expanded(const uint8_t *sig, size_t siglen, const uint8_t *m, size_t mlen, const uint8_t *ctx, size_t ctxlen, const void *xpk);
+#endif
+
+#if defined(OQS_ENABLE_SIG_ml_dsa_{{ scheme['scheme'] }}_avx2)
+extern size_t pqcrystals_ml_dsa_{{ scheme['scheme'] }}_avx2_expanded_pk_bytes(void);
+extern size_t pqcrystals_ml_dsa_{{ scheme['scheme'] }}_avx2_expanded_sk_bytes(void);
+extern void pqcrystals_ml_dsa_{{ scheme['scheme'] }}_avx2_expand_pk(void *xpk, const uint8_t *pk);
+extern void pqcrystals_ml_dsa_{{ scheme['scheme'] }}_avx2_expand_sk(void *xsk, const uint8_t *sk);
+extern int pqcrystals_ml_dsa_{{ scheme['scheme'] }}_avx2_signature_expanded(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const uint8_t *ctx, size_t ctxlen, const void *xsk);
+extern int pqcrystals_ml_dsa_{{ scheme['scheme'] }}_avx2_verify_expanded(const uint8_t *sig, size_t siglen, const uint8_t *m, size_t mlen, const uint8_t *ctx, size_t ctxlen, const void *xpk);
+#endif
+
+static OQS_STATUS ml_dsa_{{ scheme['scheme'] }}_key_expand(OQS_SIG_KEY *key) {
+	size_t len = (key->type == OQS_SIG_KEY_SECRET) ? pqcrystals_ml_dsa_{{ scheme['scheme'] }}_ref_expanded_sk_bytes() : pqcrystals_ml_dsa_{{ scheme['scheme'] }}_ref_expanded_pk_bytes();
+	void *expanded = OQS_MEM_malloc(len);
+	if (expanded == NULL) {
+		return OQS_ERROR;
+	}
+	if (key->type == OQS_SIG_KEY_SECRET) {
+		pqcrystals_ml_dsa_{{ scheme['scheme'] }}_ref_expand_sk(expanded, key->bytes);
+	} else {
+		pqcrystals_ml_dsa_{{ scheme['scheme'] }}_ref_expand_pk(expanded, key->bytes);
+	}
+	key->expanded = expanded;
+	key->expanded_len = len;
+	return OQS_SUCCESS;
+}
+
+static OQS_STATUS ml_dsa_{{ scheme['scheme'] }}_key_sign(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, const OQS_SIG_KEY *secret_key) {
+#if defined(OQS_ENABLE_SIG_ml_dsa_{{ scheme['scheme'] }}_aarch64)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_ARM_NEON)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) pqcrystals_ml_dsa_{{ scheme['scheme'] }}_aarch64_signature_expanded(signature, signature_len, message, message_len, ctx_str, ctx_str_len, secret_key->expanded);
+#if defined(OQS_DIST_BUILD)
+	}
+#endif /* OQS_DIST_BUILD */
+#endif
+	return (OQS_STATUS) pqcrystals_ml_dsa_{{ scheme['scheme'] }}_ref_signature_expanded(signature, signature_len, message, message_len, ctx_str, ctx_str_len, secret_key->expanded);
+}
+
+static OQS_STATUS ml_dsa_{{ scheme['scheme'] }}_key_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const OQS_SIG_KEY *public_key) {
+#if defined(OQS_ENABLE_SIG_ml_dsa_{{ scheme['scheme'] }}_aarch64)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_ARM_NEON)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) pqcrystals_ml_dsa_{{ scheme['scheme'] }}_aarch64_verify_expanded(signature, signature_len, message, message_len, ctx_str, ctx_str_len, public_key->expanded);
+#if defined(OQS_DIST_BUILD)
+	}
+#endif /* OQS_DIST_BUILD */
+#endif
+	return (OQS_STATUS) pqcrystals_ml_dsa_{{ scheme['scheme'] }}_ref_verify_expanded(signature, signature_len, message, message_len, ctx_str, ctx_str_len, public_key->expanded);
+}
+
+static const OQS_SIG_KEY_ops ml_dsa_{{ scheme['scheme'] }}_key_ops = {
+	.expand = ml_dsa_{{ scheme['scheme'] }}_key_expand,
+	.sign = ml_dsa_{{ scheme['scheme'] }}_key_sign,
+	.verify = ml_dsa_{{ scheme['scheme'] }}_key_verify,
+};
+
+#if defined(OQS_ENABLE_SIG_ml_dsa_{{ scheme['scheme'] }}_avx2)
+static OQS_STATUS ml_dsa_{{ scheme['scheme'] }}_avx2_key_expand(OQS_SIG_KEY *key) {
+	size_t len = (key->type == OQS_SIG_KEY_SECRET) ? pqcrystals_ml_dsa_{{ scheme['scheme'] }}_avx2_expanded_sk_bytes() : pqcrystals_ml_dsa_{{ scheme['scheme'] }}_avx2_expanded_pk_bytes();
+	void *expanded = OQS_MEM_malloc(len);
+	if (expanded == NULL) {
+		return OQS_ERROR;
+	}
+	if (key->type == OQS_SIG_KEY_SECRET) {
+		pqcrystals_ml_dsa_{{ scheme['scheme'] }}_avx2_expand_sk(expanded, key->bytes);
+	} else {
+		pqcrystals_ml_dsa_{{ scheme['scheme'] }}_avx2_expand_pk(expanded, key->bytes);
+	}
+	key->expanded = expanded;
+	key->expanded_len = len;
+	return OQS_SUCCESS;
+}
+
+static OQS_STATUS ml_dsa_{{ scheme['scheme'] }}_avx2_key_sign(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, const OQS_SIG_KEY *secret_key) {
+	return (OQS_STATUS) pqcrystals_ml_dsa_{{ scheme['scheme'] }}_avx2_signature_expanded(signature, signature_len, message, message_len, ctx_str, ctx_str_len, secret_key->expanded);
+}
+
+static OQS_STATUS ml_dsa_{{ scheme['scheme'] }}_avx2_key_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const OQS_SIG_KEY *public_key) {
+	return (OQS_STATUS) pqcrystals_ml_dsa_{{ scheme['scheme'] }}_avx2_verify_expanded(signature, signature_len, message, message_len, ctx_str, ctx_str_len, public_key->expanded);
+}
+
+static const OQS_SIG_KEY_ops ml_dsa_{{ scheme['scheme'] }}_avx2_key_ops = {
+	.expand = ml_dsa_{{ scheme['scheme'] }}_avx2_key_expand,
+	.sign = ml_dsa_{{ scheme['scheme'] }}_avx2_key_sign,
+	.verify = ml_dsa_{{ scheme['scheme'] }}_avx2_key_verify,
+};
+#endif
+
+/* The precomputed keys follow the backend the wrappers above select. The
+ * AArch64 code shares the layout of the reference code, so one set of ops
+ * serves both and picks NEON where available. The AVX2 code has its own
+ * aligned, differently ordered layout, so a key is expanded and used by the
+ * AVX2 ops only. The low-stack build must not hold expanded matrices and
+ * keeps keys as bytes. */
+const OQS_SIG_KEY_ops *OQS_SIG_ml_dsa_{{ scheme['scheme'] }}_key_ops(void) {
+	const OQS_SIG_KEY_ops *ops = &ml_dsa_{{ scheme['scheme'] }}_key_ops;
+#if defined(OQS_ENABLE_SIG_ml_dsa_{{ scheme['scheme'] }}_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2) && OQS_CPU_has_extension(OQS_CPU_EXT_POPCNT)) {
+#endif /* OQS_DIST_BUILD */
+		ops = &ml_dsa_{{ scheme['scheme'] }}_avx2_key_ops;
+#if defined(OQS_DIST_BUILD)
+	}
+#endif /* OQS_DIST_BUILD */
+#endif
+#if defined(OQS_ML_DSA_LOW_STACK)
+	ops = NULL;
+#endif
+	return ops;
+}
+{%- endif %}
 #endif
 {% endfor -%}
@@ -3,6 +3,7 @@
 # SPDX-License-Identifier: MIT
 
 import argparse
+import copy
 import os
 import subprocess
 import yaml
@@ -439,12 +440,58 @@ def update_upstream_sig_alg_docs(liboqs_root, sigs, upstream_info, write_changes
                         impl['supported-platforms'] = rhs_if_not_equal(impl['supported-platforms'], "all", "supported-platforms")
                     oqs_scheme_yaml['implementations'][impl_index] = impl
 
+                add_new_sig_implementations(oqs_scheme_yaml, _upstream_yaml, sig, scheme, ui)
+
                 oqs_yaml['parameter-sets'][index] = oqs_scheme_yaml
 
             if write_changes:
                 store_yaml(oqs_yaml_path, oqs_yaml)
 
 
+# Document implementations that the primary upstream META.yml (possibly extended
+# by a copy_from_upstream patch) provides but the OQS YAML file does not list yet.
+# They inherit the hand-maintained properties of the default implementation, but
+# are not marked as checked by valgrind until they have been.
+def add_new_sig_implementations(oqs_scheme_yaml, upstream_yaml, sig, scheme, ui):
+    documented = [impl['upstream-id'] for impl in oqs_scheme_yaml['implementations'] if impl['upstream'] == 'primary-upstream']
+    default_impl = None
+    for impl in oqs_scheme_yaml['implementations']:
+        if impl['upstream'] == 'primary-upstream' and impl['upstream-id'] == sig['default_implementation']:
+            default_impl = impl
+    if default_impl == None:
+        return
+    for upstream_impl in upstream_yaml['implementations']:
+        if upstream_impl['name'] in documented:
+            continue
+        if 'ignore' in ui and "{}_{}_{}".format(ui['name'], scheme['pqclean_scheme'], upstream_impl['name']) in ui['ignore']:
+            continue
+        impl = dict()
+        impl['upstream'] = 'primary-upstream'
+        impl['upstream-id'] = upstream_impl['name']
+        if 'supported_platforms' in upstream_impl:
+            platforms = []
+            for p in upstream_impl['supported_platforms']:
+                p = dict(p)
+                if p['architecture'] == 'arm_8':
+                    p['architecture'] = 'ARM64_V8'
+                    if 'required_flags' in p:
+                        p['required_flags'] = [f for f in p['required_flags'] if f != 'asimd']
+                if 'required_flags' in p and not p['required_flags']:
+                    del p['required_flags']
+                platforms.append(p)
+            impl['supported-platforms'] = platforms
+        else:
+            impl['supported-platforms'] = 'all'
+        for key in default_impl:
+            if key not in impl:
+                impl[key] = copy.deepcopy(default_impl[key])
+        if 'no-secret-dependent-branching-checked-by-valgrind' in impl:
+            impl['no-secret-dependent-branching-checked-by-valgrind'] = False
+        if DEBUG > 0:
+            print("Adding implementation {} of {}".format(upstream_impl['name'], scheme['pretty_name_full']))
+        oqs_scheme_yaml['implementations'].append(impl)
+
+
 def do_it(liboqs_root, upstream_location='upstream'):
    global DEBUG
    if liboqs_root == None:
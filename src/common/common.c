@@ -31,6 +31,10 @@
 #include "ossl_helpers.h"
 #endif
 
+#if defined(OQS_USE_PTHREADS)
+#include "thread_pool.h"
+#endif
+
 /* Identifying the CPU is expensive so we cache the results in cpu_ext_data */
 #if defined(OQS_DIST_BUILD)
 static unsigned int cpu_ext_data[OQS_CPU_EXT_COUNT] = {0};
@@ -86,6 +90,7 @@ static void set_available_cpu_extensions(void) {
 			cpu_ext_data[OQS_CPU_EXT_AVX512] = 1;
 		}
 		cpu_ext_data[OQS_CPU_EXT_VPCLMULQDQ] = is_bit_set(leaf_7.ecx, 10);
+		cpu_ext_data[OQS_CPU_EXT_AVX512VBMI2] = is_bit_set(leaf_7.ecx, 6);
 	}
 }
 #elif defined(OQS_DIST_X86_BUILD)
@@ -251,6 +256,9 @@ OQS_API const char *OQS_version(void) {
 }
 
 OQS_API void OQS_destroy(void) {
+#if defined(OQS_USE_PTHREADS)
+	OQS_THREAD_POOL_destroy();
+#endif
 #if defined(OQS_USE_OPENSSL)
 	oqs_ossl_destroy();
 #endif
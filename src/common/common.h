@@ -145,6 +145,7 @@ typedef enum {
 	OQS_CPU_EXT_ARM_SHA2,
 	OQS_CPU_EXT_ARM_SHA3,
 	OQS_CPU_EXT_ARM_NEON,
+	OQS_CPU_EXT_AVX512VBMI2,
 	/* End extension list */
 	OQS_CPU_EXT_COUNT, /* Must be last */
 } OQS_CPU_EXT;
@@ -162,6 +163,20 @@ OQS_API int OQS_CPU_has_extension(OQS_CPU_EXT ext);
  */
 OQS_API void OQS_init(void);
 
+/**
+ * Like OQS_init(), and additionally warms up the given KEM and signature
+ * algorithms with OQS_KEM_warmup() or OQS_SIG_warmup(), so that their first
+ * use in the process does not pay for lazy initialization and page faults on
+ * constant tables.
+ *
+ * Each name is looked up as a KEM first and then as a signature algorithm.
+ * All names are processed even if one of them fails.
+ *
+ * @param[in] alg_names NULL-terminated list of algorithm names; may be NULL.
+ * @return OQS_SUCCESS if every named algorithm was warmed up, OQS_ERROR otherwise.
+ */
+OQS_API OQS_STATUS OQS_init_with_warmup(const char *const *alg_names);
+
 /**
  * This function stops OpenSSL threads, which allows resources
  * to be cleaned up in the correct order.
@@ -279,6 +294,23 @@ void OQS_MEM_aligned_free(void *ptr);
  */
 void OQS_MEM_aligned_secure_free(void *ptr, size_t len);
 
+/**
+ * Counters of a key expansion cache; see OQS_KEM_key_cache_stats() and
+ * OQS_SIG_key_cache_stats().
+ */
+typedef struct OQS_KEY_CACHE_STATS {
+	/** Lookups that found the expanded key in the cache. */
+	uint64_t hits;
+	/** Lookups that had to expand the key from its seed. */
+	uint64_t misses;
+	/** Expanded keys dropped to stay within the memory budget. */
+	uint64_t evictions;
+	/** Expanded keys currently held. */
+	size_t entries;
+	/** Memory currently accounted to the held keys, in bytes. */
+	size_t bytes;
+} OQS_KEY_CACHE_STATS;
+
 #if defined(__cplusplus)
 } // extern "C"
 #endif
@@ -0,0 +1,278 @@
+// SPDX-License-Identifier: MIT
+
+#include <stdbool.h>
+#include <string.h>
+
+#include <oqs/common.h>
+#include <oqs/oqsconfig.h>
+
+#if defined(OQS_USE_PTHREADS)
+#include <pthread.h>
+#endif
+
+#include "key_cache.h"
+
+#define KEY_CACHE_MIN_BUCKETS 16
+
+struct OQS_KEY_CACHE_ENTRY {
+	uint8_t id[OQS_KEY_CACHE_ID_BYTES];
+	void *value;
+	/* accounted size: the value plus this entry */
+	size_t size;
+	unsigned int refs;
+	/* in the hash table and the LRU list; evicted entries that are still
+	 * acquired are unlinked and freed on their last release */
+	bool linked;
+	OQS_KEY_CACHE_ENTRY *hash_next;
+	OQS_KEY_CACHE_ENTRY *lru_prev;
+	OQS_KEY_CACHE_ENTRY *lru_next;
+};
+
+struct OQS_KEY_CACHE {
+	size_t max_bytes;
+	void (*free_value)(void *value);
+	/* chained hash table with a power-of-two number of buckets */
+	OQS_KEY_CACHE_ENTRY **buckets;
+	size_t nbuckets;
+	/* most recently used first */
+	OQS_KEY_CACHE_ENTRY *lru_head;
+	OQS_KEY_CACHE_ENTRY *lru_tail;
+	OQS_KEY_CACHE_STATS stats;
+#if defined(OQS_USE_PTHREADS)
+	pthread_mutex_t lock;
+#endif
+};
+
+static void key_cache_lock(OQS_KEY_CACHE *cache) {
+#if defined(OQS_USE_PTHREADS)
+	pthread_mutex_lock(&cache->lock);
+#else
+	(void) cache;
+#endif
+}
+
+static void key_cache_unlock(OQS_KEY_CACHE *cache) {
+#if defined(OQS_USE_PTHREADS)
+	pthread_mutex_unlock(&cache->lock);
+#else
+	(void) cache;
+#endif
+}
+
+/* The identifiers are hash outputs, so any 8 bytes of them index uniformly. */
+static size_t key_cache_bucket(const OQS_KEY_CACHE *cache, const uint8_t id[OQS_KEY_CACHE_ID_BYTES]) {
+	uint64_t h = 0;
+	for (size_t i = 0; i < 8; i++) {
+		h |= (uint64_t) id[i] << (8 * i);
+	}
+	return (size_t) h & (cache->nbuckets - 1);
+}
+
+static void key_cache_destroy_entry(OQS_KEY_CACHE *cache, OQS_KEY_CACHE_ENTRY *entry) {
+	cache->free_value(entry->value);
+	OQS_MEM_insecure_free(entry);
+}
+
+static void key_cache_lru_remove(OQS_KEY_CACHE *cache, OQS_KEY_CACHE_ENTRY *entry) {
+	if (entry->lru_prev != NULL) {
+		entry->lru_prev->lru_next = entry->lru_next;
+	} else {
+		cache->lru_head = entry->lru_next;
+	}
+	if (entry->lru_next != NULL) {
+		entry->lru_next->lru_prev = entry->lru_prev;
+	} else {
+		cache->lru_tail = entry->lru_prev;
+	}
+	entry->lru_prev = NULL;
+	entry->lru_next = NULL;
+}
+
+static void key_cache_lru_push(OQS_KEY_CACHE *cache, OQS_KEY_CACHE_ENTRY *entry) {
+	entry->lru_prev = NULL;
+	entry->lru_next = cache->lru_head;
+	if (cache->lru_head != NULL) {
+		cache->lru_head->lru_prev = entry;
+	} else {
+		cache->lru_tail = entry;
+	}
+	cache->lru_head = entry;
+}
+
+static void key_cache_unlink(OQS_KEY_CACHE *cache, OQS_KEY_CACHE_ENTRY *entry) {
+	OQS_KEY_CACHE_ENTRY **p = &cache->buckets[key_cache_bucket(cache, entry->id)];
+	while (*p != entry) {
+		p = &(*p)->hash_next;
+	}
+	*p = entry->hash_next;
+	entry->hash_next = NULL;
+	key_cache_lru_remove(cache, entry);
+	entry->linked = false;
+	cache->stats.entries--;
+	cache->stats.bytes -= entry->size;
+}
+
+/* Doubles the number of buckets once there are as many entries as buckets;
+ * if that allocation fails, the chains just get longer. */
+static void key_cache_grow(OQS_KEY_CACHE *cache) {
+	OQS_KEY_CACHE_ENTRY **old = cache->buckets;
+	size_t old_n = cache->nbuckets;
+
+	if (cache->stats.entries < old_n || old_n > SIZE_MAX / (2 * sizeof(OQS_KEY_CACHE_ENTRY *))) {
+		return;
+	}
+	cache->buckets = OQS_MEM_calloc(2 * old_n, sizeof(OQS_KEY_CACHE_ENTRY *));
+	if (cache->buckets == NULL) {
+		cache->buckets = old;
+		return;
+	}
+	cache->nbuckets = 2 * old_n;
+	for (size_t i = 0; i < old_n; i++) {
+		OQS_KEY_CACHE_ENTRY *entry = old[i];
+		while (entry != NULL) {
+			OQS_KEY_CACHE_ENTRY *next = entry->hash_next;
+			size_t b = key_cache_bucket(cache, entry->id);
+			entry->hash_next = cache->buckets[b];
+			cache->buckets[b] = entry;
+			entry = next;
+		}
+	}
+	OQS_MEM_insecure_free(old);
+}
+
+static OQS_KEY_CACHE_ENTRY *key_cache_find(const OQS_KEY_CACHE *cache, const uint8_t id[OQS_KEY_CACHE_ID_BYTES]) {
+	OQS_KEY_CACHE_ENTRY *entry = cache->buckets[key_cache_bucket(cache, id)];
+	while (entry != NULL && memcmp(entry->id, id, OQS_KEY_CACHE_ID_BYTES) != 0) {
+		entry = entry->hash_next;
+	}
+	return entry;
+}
+
+OQS_KEY_CACHE *OQS_KEY_CACHE_new(size_t max_bytes, void (*free_value)(void *value)) {
+	OQS_KEY_CACHE *cache = OQS_MEM_calloc(1, sizeof(OQS_KEY_CACHE));
+	if (cache == NULL) {
+		return NULL;
+	}
+	cache->max_bytes = max_bytes;
+	cache->free_value = free_value;
+	cache->nbuckets = KEY_CACHE_MIN_BUCKETS;
+	cache->buckets = OQS_MEM_calloc(cache->nbuckets, sizeof(OQS_KEY_CACHE_ENTRY *));
+	if (cache->buckets == NULL) {
+		OQS_MEM_insecure_free(cache);
+		return NULL;
+	}
+#if defined(OQS_USE_PTHREADS)
+	if (pthread_mutex_init(&cache->lock, NULL) != 0) {
+		OQS_MEM_insecure_free(cache->buckets);
+		OQS_MEM_insecure_free(cache);
+		return NULL;
+	}
+#endif
+	return cache;
+}
+
+void OQS_KEY_CACHE_free(OQS_KEY_CACHE *cache) {
+	if (cache == NULL) {
+		return;
+	}
+	while (cache->lru_head != NULL) {
+		OQS_KEY_CACHE_ENTRY *entry = cache->lru_head;
+		key_cache_unlink(cache, entry);
+		key_cache_destroy_entry(cache, entry);
+	}
+#if defined(OQS_USE_PTHREADS)
+	pthread_mutex_destroy(&cache->lock);
+#endif
+	OQS_MEM_insecure_free(cache->buckets);
+	OQS_MEM_insecure_free(cache);
+}
+
+OQS_KEY_CACHE_ENTRY *OQS_KEY_CACHE_acquire(OQS_KEY_CACHE *cache, const uint8_t id[OQS_KEY_CACHE_ID_BYTES]) {
+	key_cache_lock(cache);
+	OQS_KEY_CACHE_ENTRY *entry = key_cache_find(cache, id);
+	if (entry != NULL) {
+		entry->refs++;
+		key_cache_lru_remove(cache, entry);
+		key_cache_lru_push(cache, entry);
+		cache->stats.hits++;
+	} else {
+		cache->stats.misses++;
+	}
+	key_cache_unlock(cache);
+	return entry;
+}
+
+OQS_KEY_CACHE_ENTRY *OQS_KEY_CACHE_insert(OQS_KEY_CACHE *cache, const uint8_t id[OQS_KEY_CACHE_ID_BYTES], void *value, size_t size) {
+	OQS_KEY_CACHE_ENTRY *entry = OQS_MEM_calloc(1, sizeof(OQS_KEY_CACHE_ENTRY));
+	OQS_KEY_CACHE_ENTRY *evicted = NULL;
+
+	if (entry == NULL) {
+		cache->free_value(value);
+		return NULL;
+	}
+	memcpy(entry->id, id, OQS_KEY_CACHE_ID_BYTES);
+	entry->value = value;
+	entry->size = (size > SIZE_MAX - sizeof(OQS_KEY_CACHE_ENTRY)) ? SIZE_MAX : size + sizeof(OQS_KEY_CACHE_ENTRY);
+	entry->refs = 1;
+
+	key_cache_lock(cache);
+	OQS_KEY_CACHE_ENTRY *existing = key_cache_find(cache, id);
+	if (existing != NULL) {
+		/* expanded concurrently by another thread */
+		existing->refs++;
+		key_cache_unlock(cache);
+		key_cache_destroy_entry(cache, entry);
+		return existing;
+	}
+	if (entry->size <= cache->max_bytes) {
+		/* evicted entries that are not in use are collected on a list
+		 * threaded through hash_next and freed outside the lock */
+		while (cache->stats.bytes > cache->max_bytes - entry->size) {
+			OQS_KEY_CACHE_ENTRY *victim = cache->lru_tail;
+			key_cache_unlink(cache, victim);
+			cache->stats.evictions++;
+			if (victim->refs == 0) {
+				victim->hash_next = evicted;
+				evicted = victim;
+			}
+		}
+		size_t b = key_cache_bucket(cache, id);
+		entry->hash_next = cache->buckets[b];
+		cache->buckets[b] = entry;
+		key_cache_lru_push(cache, entry);
+		entry->linked = true;
+		cache->stats.entries++;
+		cache->stats.bytes += entry->size;
+		key_cache_grow(cache);
+	}
+	key_cache_unlock(cache);
+
+	while (evicted != NULL) {
+		OQS_KEY_CACHE_ENTRY *next = evicted->hash_next;
+		key_cache_destroy_entry(cache, evicted);
+		evicted = next;
+	}
+	return entry;
+}
+
+const void *OQS_KEY_CACHE_value(const OQS_KEY_CACHE_ENTRY *entry) {
+	return entry->value;
+}
+
+void OQS_KEY_CACHE_release(OQS_KEY_CACHE *cache, OQS_KEY_CACHE_ENTRY *entry) {
+	bool destroy;
+
+	key_cache_lock(cache);
+	entry->refs--;
+	destroy = entry->refs == 0 && !entry->linked;
+	key_cache_unlock(cache);
+	if (destroy) {
+		key_cache_destroy_entry(cache, entry);
+	}
+}
+
+void OQS_KEY_CACHE_stats(OQS_KEY_CACHE *cache, OQS_KEY_CACHE_STATS *stats) {
+	key_cache_lock(cache);
+	*stats = cache->stats;
+	key_cache_unlock(cache);
+}
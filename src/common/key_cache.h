@@ -0,0 +1,53 @@
+// SPDX-License-Identifier: MIT
+
+/*
+ * Internal LRU cache of expanded keys behind OQS_KEM_key_cache_* and
+ * OQS_SIG_key_cache_*. Not installed.
+ *
+ * Entries are looked up by a fixed-size identifier (a hash of the key seed)
+ * and hold an opaque value, owned by the cache and released with the
+ * free_value callback. The cache holds at most max_bytes of values, as
+ * accounted by the sizes given to OQS_KEY_CACHE_insert(); the least recently
+ * used entries are evicted to make room. An entry stays valid while it is
+ * acquired, even if it is evicted in the meantime, so that the expanded key
+ * can be used without holding the cache lock. With OQS_USE_PTHREADS the cache
+ * may be used concurrently from several threads.
+ */
+
+#ifndef OQS_KEY_CACHE_H
+#define OQS_KEY_CACHE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <oqs/common.h>
+
+#define OQS_KEY_CACHE_ID_BYTES 32
+
+typedef struct OQS_KEY_CACHE OQS_KEY_CACHE;
+typedef struct OQS_KEY_CACHE_ENTRY OQS_KEY_CACHE_ENTRY;
+
+OQS_KEY_CACHE *OQS_KEY_CACHE_new(size_t max_bytes, void (*free_value)(void *value));
+
+/* All entries must have been released. */
+void OQS_KEY_CACHE_free(OQS_KEY_CACHE *cache);
+
+/* Returns the acquired entry for id, or NULL on a miss. */
+OQS_KEY_CACHE_ENTRY *OQS_KEY_CACHE_acquire(OQS_KEY_CACHE *cache, const uint8_t id[OQS_KEY_CACHE_ID_BYTES]);
+
+/*
+ * Adds value under id and returns its acquired entry. The cache takes
+ * ownership of value in all cases: if another thread inserted id first, value
+ * is freed and that entry is returned instead; if size exceeds the budget,
+ * the entry is not retained and value is freed on release. Returns NULL, with
+ * value freed, if memory allocation fails.
+ */
+OQS_KEY_CACHE_ENTRY *OQS_KEY_CACHE_insert(OQS_KEY_CACHE *cache, const uint8_t id[OQS_KEY_CACHE_ID_BYTES], void *value, size_t size);
+
+const void *OQS_KEY_CACHE_value(const OQS_KEY_CACHE_ENTRY *entry);
+
+void OQS_KEY_CACHE_release(OQS_KEY_CACHE *cache, OQS_KEY_CACHE_ENTRY *entry);
+
+void OQS_KEY_CACHE_stats(OQS_KEY_CACHE *cache, OQS_KEY_CACHE_STATS *stats);
+
+#endif // OQS_KEY_CACHE_H
@@ -55,10 +55,7 @@
 
 #define shake128_init shake128_inc_init
 #define shake128_absorb_once OQS_SHA3_shake128_absorb_once
-void OQS_SHA3_shake128_absorb_once(shake128incctx *state, const uint8_t *in, size_t inlen);
-
 #define shake256_absorb_once OQS_SHA3_shake256_absorb_once
-void OQS_SHA3_shake256_absorb_once(shake256incctx *state, const uint8_t *in, size_t inlen);
 
 #define shake128_squeezeblocks(OUT, NBLOCKS, STATE) \
         OQS_SHA3_shake128_inc_squeeze(OUT, (NBLOCKS)*OQS_SHA3_SHAKE128_RATE, STATE)
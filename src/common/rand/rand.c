@@ -59,7 +59,46 @@ OQS_API void OQS_randombytes_custom_algorithm(void (*algorithm_ptr)(uint8_t *, s
 	oqs_randombytes_algorithm = algorithm_ptr;
 }
 
+// Embedded targets may have no thread-local storage; they get no per-thread sources.
+#if !defined(OQS_EMBEDDED_BUILD)
+#if defined(_MSC_VER)
+#define OQS_RAND_THREAD_LOCAL __declspec(thread)
+#else
+#define OQS_RAND_THREAD_LOCAL _Thread_local
+#endif
+static OQS_RAND_THREAD_LOCAL void (*oqs_randombytes_thread_source)(uint8_t *, size_t, void *) = NULL;
+static OQS_RAND_THREAD_LOCAL void *oqs_randombytes_thread_ctx = NULL;
+#endif
+
+OQS_API OQS_STATUS OQS_randombytes_set_thread_source(void (*source)(uint8_t *random_array, size_t bytes_to_read, void *ctx), void *ctx) {
+#if defined(OQS_EMBEDDED_BUILD)
+	(void)source;
+	(void)ctx;
+	return OQS_ERROR;
+#else
+	oqs_randombytes_thread_source = source;
+	oqs_randombytes_thread_ctx = source != NULL ? ctx : NULL;
+	return OQS_SUCCESS;
+#endif
+}
+
+OQS_API void OQS_randombytes_get_thread_source(void (**source)(uint8_t *random_array, size_t bytes_to_read, void *ctx), void **ctx) {
+#if defined(OQS_EMBEDDED_BUILD)
+	*source = NULL;
+	*ctx = NULL;
+#else
+	*source = oqs_randombytes_thread_source;
+	*ctx = oqs_randombytes_thread_ctx;
+#endif
+}
+
 OQS_API void OQS_randombytes(uint8_t *random_array, size_t bytes_to_read) {
+#if !defined(OQS_EMBEDDED_BUILD)
+	if (oqs_randombytes_thread_source != NULL) {
+		oqs_randombytes_thread_source(random_array, bytes_to_read, oqs_randombytes_thread_ctx);
+		return;
+	}
+#endif
 	oqs_randombytes_algorithm(random_array, bytes_to_read);
 }
 
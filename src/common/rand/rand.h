@@ -45,12 +45,45 @@ OQS_API OQS_STATUS OQS_randombytes_switch_algorithm(const char *algorithm);
  */
 OQS_API void OQS_randombytes_custom_algorithm(void (*algorithm_ptr)(uint8_t *, size_t));
 
+/**
+ * Makes OQS_randombytes use the given function in the calling thread only.
+ *
+ * The thread source takes precedence over the process-wide algorithm chosen with
+ * `OQS_randombytes_switch_algorithm` or `OQS_randombytes_custom_algorithm`, and is
+ * invisible to other threads. This lets each worker thread attach its own
+ * deterministic generator, e.g. for KAT replay or reproducible batch key generation,
+ * without serializing the process around a global setting.
+ *
+ * `ctx` is passed unchanged to every call of `source` and is owned by the caller;
+ * it must stay valid until the source is replaced or cleared. Pass `source = NULL`
+ * to return the thread to the process-wide algorithm. Threads do not inherit the
+ * source of the thread that created them.
+ *
+ * @param[in] source Function that fills `random_array` with `bytes_to_read` bytes, or NULL.
+ * @param[in] ctx Context pointer handed to `source`.
+ * @return OQS_SUCCESS, or OQS_ERROR in embedded builds, which have no thread-local storage.
+ */
+OQS_API OQS_STATUS OQS_randombytes_set_thread_source(void (*source)(uint8_t *random_array, size_t bytes_to_read, void *ctx), void *ctx);
+
+/**
+ * Returns the source and context set with `OQS_randombytes_set_thread_source` in the
+ * calling thread, so that code installing a temporary source can restore them.
+ *
+ * Both are set to NULL if the thread uses the process-wide algorithm, and in embedded
+ * builds.
+ *
+ * @param[out] source The thread's source, or NULL.
+ * @param[out] ctx The context passed to `source`, or NULL.
+ */
+OQS_API void OQS_randombytes_get_thread_source(void (**source)(uint8_t *random_array, size_t bytes_to_read, void *ctx), void **ctx);
+
 /**
  * Fills the given memory with the requested number of (pseudo)random bytes.
  *
- * This implementation uses whichever algorithm has been selected by
- * OQS_randombytes_switch_algorithm. The default is OQS_randombytes_system, which
- * reads bytes from a system specific default source.
+ * This implementation uses the calling thread's source if one has been set with
+ * OQS_randombytes_set_thread_source, and otherwise whichever algorithm has been
+ * selected by OQS_randombytes_switch_algorithm. The default is OQS_randombytes_system,
+ * which reads bytes from a system specific default source.
  *
  * The caller is responsible for providing a buffer allocated with sufficient room.
  *
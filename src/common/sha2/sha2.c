@@ -78,6 +78,20 @@ void OQS_SHA2_sha256(uint8_t *out, const uint8_t *in, size_t inlen) {
 	callbacks->SHA2_sha256(out, in, inlen);
 }
 
+void OQS_SHA2_sha256_x4(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3,
+                        const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3,
+                        size_t inlen) {
+	if (callbacks->SHA2_sha256 == sha2_default_callbacks.SHA2_sha256) {
+		oqs_sha2_sha256_x4(out0, out1, out2, out3, in0, in1, in2, in3, inlen);
+	} else {
+		// a replaced SHA-256 is used one message at a time
+		callbacks->SHA2_sha256(out0, in0, inlen);
+		callbacks->SHA2_sha256(out1, in1, inlen);
+		callbacks->SHA2_sha256(out2, in2, inlen);
+		callbacks->SHA2_sha256(out3, in3, inlen);
+	}
+}
+
 void OQS_SHA2_sha384(uint8_t *out, const uint8_t *in, size_t inlen) {
 	callbacks->SHA2_sha384(out, in, inlen);
 }
@@ -35,6 +35,29 @@ extern "C" {
  */
 void OQS_SHA2_sha256(uint8_t *output, const uint8_t *input, size_t inplen);
 
+/**
+ * \brief Process four messages of the same length with SHA-256.
+ *
+ * The four hashes are computed together where the platform allows it (one
+ * message per vector lane), which is faster than four calls to
+ * OQS_SHA2_sha256 for short messages such as hash-based signature chains.
+ *
+ * \warning Each output array must be at least 32 bytes in length.
+ *
+ * \param out0 The output byte array for in0
+ * \param out1 The output byte array for in1
+ * \param out2 The output byte array for in2
+ * \param out3 The output byte array for in3
+ * \param in0 The first message input byte array
+ * \param in1 The second message input byte array
+ * \param in2 The third message input byte array
+ * \param in3 The fourth message input byte array
+ * \param inlen The number of bytes of each message
+ */
+void OQS_SHA2_sha256_x4(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3,
+                        const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3,
+                        size_t inlen);
+
 /**
  * \brief Allocate and initialize the state for the SHA-256 incremental hashing API.
  *
@@ -100,6 +100,27 @@ static void SHA2_sha256(uint8_t *out, const uint8_t *in, size_t inlen) {
 	);
 }
 
+#if defined(OQS_DIST_ARM64_V8_BUILD) || defined(OQS_USE_ARM_SHA2_INSTRUCTIONS)
+static void sha256_x4_armv8(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3,
+                            const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3,
+                            size_t inlen) {
+	oqs_sha2_sha256_armv8(out0, in0, inlen);
+	oqs_sha2_sha256_armv8(out1, in1, inlen);
+	oqs_sha2_sha256_armv8(out2, in2, inlen);
+	oqs_sha2_sha256_armv8(out3, in3, inlen);
+}
+#endif
+
+void oqs_sha2_sha256_x4(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3,
+                        const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3,
+                        size_t inlen) {
+	// the SHA-2 instructions beat four NEON lanes, so they hash one message at a time
+	C_OR_ARM (
+	    oqs_sha2_sha256_x4_vec(out0, out1, out2, out3, in0, in1, in2, in3, inlen),
+	    sha256_x4_armv8(out0, out1, out2, out3, in0, in1, in2, in3, inlen)
+	);
+}
+
 static void SHA2_sha384(uint8_t *out, const uint8_t *in, size_t inlen) {
 	oqs_sha2_sha384_c(out, in, inlen);
 }
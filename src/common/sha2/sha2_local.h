@@ -89,6 +89,16 @@ void oqs_sha2_sha256_c(uint8_t *out, const uint8_t *in, size_t inlen);
 void oqs_sha2_sha384_c(uint8_t *out, const uint8_t *in, size_t inlen);
 void oqs_sha2_sha512_c(uint8_t *out, const uint8_t *in, size_t inlen);
 
+// Four-way SHA-256 on 128-bit vectors, with a sequential fallback
+void oqs_sha2_sha256_x4_vec(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3,
+                            const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3,
+                            size_t inlen);
+
+// Four-way SHA-256 of the default provider, used by OQS_SHA2_sha256_x4
+void oqs_sha2_sha256_x4(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3,
+                        const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3,
+                        size_t inlen);
+
 extern struct OQS_SHA2_callbacks sha2_default_callbacks;
 
 #if defined(__cplusplus)
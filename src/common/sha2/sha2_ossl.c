@@ -153,6 +153,15 @@ static void SHA2_sha512_inc_ctx_clone(OQS_SHA2_sha512_ctx *dest, const OQS_SHA2_
 	OQS_OPENSSL_GUARD(OSSL_FUNC(EVP_MD_CTX_copy_ex)((EVP_MD_CTX *) dest->ctx, (EVP_MD_CTX *) src->ctx));
 }
 
+void oqs_sha2_sha256_x4(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3,
+                        const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3,
+                        size_t inlen) {
+	SHA2_sha256(out0, in0, inlen);
+	SHA2_sha256(out1, in1, inlen);
+	SHA2_sha256(out2, in2, inlen);
+	SHA2_sha256(out3, in3, inlen);
+}
+
 struct OQS_SHA2_callbacks sha2_default_callbacks = {
 	SHA2_sha256,
 	SHA2_sha256_inc_init,
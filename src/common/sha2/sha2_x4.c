@@ -0,0 +1,194 @@
+// SPDX-License-Identifier: MIT
+
+/*
+ * Four-way SHA-256: four messages of the same length are hashed together, one
+ * per 32-bit lane of a 128-bit vector. SSE2 and NEON are part of the x86_64
+ * and ARM64 baselines, so no CPU dispatch is needed; other targets hash the
+ * four messages one after the other.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include <oqs/common.h>
+
+#include "sha2_local.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define SHA256_X4_VECTOR
+typedef __m128i v32x4;
+#define ADD(a, b) _mm_add_epi32(a, b)
+#define XOR(a, b) _mm_xor_si128(a, b)
+#define AND(a, b) _mm_and_si128(a, b)
+/* ~a & b */
+#define ANDNOT(a, b) _mm_andnot_si128(a, b)
+#define SHR(a, c) _mm_srli_epi32(a, c)
+#define ROTR(a, c) _mm_or_si128(_mm_srli_epi32(a, c), _mm_slli_epi32(a, 32 - (c)))
+#define SET1(x) _mm_set1_epi32((int) (x))
+#define LOAD(p) _mm_loadu_si128((const __m128i *) (p))
+#define STORE(p, a) _mm_storeu_si128((__m128i *) (p), a)
+#elif defined(__ARM_NEON) || defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define SHA256_X4_VECTOR
+typedef uint32x4_t v32x4;
+#define ADD(a, b) vaddq_u32(a, b)
+#define XOR(a, b) veorq_u32(a, b)
+#define AND(a, b) vandq_u32(a, b)
+/* ~a & b */
+#define ANDNOT(a, b) vbicq_u32(b, a)
+#define SHR(a, c) vshrq_n_u32(a, c)
+#define ROTR(a, c) vsriq_n_u32(vshlq_n_u32(a, 32 - (c)), a, c)
+#define SET1(x) vdupq_n_u32(x)
+#define LOAD(p) vld1q_u32(p)
+#define STORE(p, a) vst1q_u32(p, a)
+#endif
+
+#if defined(SHA256_X4_VECTOR)
+
+static const uint32_t K[64] = {
+	0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+	0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+	0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+	0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+	0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+	0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+	0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+	0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+static const uint32_t IV[8] = {
+	0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+};
+
+static uint32_t load_bigendian_32(const uint8_t *x) {
+	return (uint32_t) (x[3]) | (((uint32_t) (x[2])) << 8) |
+	       (((uint32_t) (x[1])) << 16) | (((uint32_t) (x[0])) << 24);
+}
+
+static void store_bigendian_32(uint8_t *x, uint32_t u) {
+	x[3] = (uint8_t) u;
+	u >>= 8;
+	x[2] = (uint8_t) u;
+	u >>= 8;
+	x[1] = (uint8_t) u;
+	u >>= 8;
+	x[0] = (uint8_t) u;
+}
+
+#define Ch(x, y, z) XOR(AND(x, y), ANDNOT(x, z))
+#define Maj(x, y, z) XOR(AND(x, y), AND(z, XOR(x, y)))
+#define Sigma0(x) XOR(XOR(ROTR(x, 2), ROTR(x, 13)), ROTR(x, 22))
+#define Sigma1(x) XOR(XOR(ROTR(x, 6), ROTR(x, 11)), ROTR(x, 25))
+#define sigma0(x) XOR(XOR(ROTR(x, 7), ROTR(x, 18)), SHR(x, 3))
+#define sigma1(x) XOR(XOR(ROTR(x, 17), ROTR(x, 19)), SHR(x, 10))
+
+/* Compresses one 64-byte block of each of the four messages into state. */
+static void sha256_x4_block(v32x4 state[8], const uint8_t *in[4]) {
+	uint32_t words[4];
+	v32x4 w[16];
+	v32x4 a = state[0], b = state[1], c = state[2], d = state[3];
+	v32x4 e = state[4], f = state[5], g = state[6], h = state[7];
+	v32x4 t1, t2;
+
+	for (int i = 0; i < 16; i++) {
+		for (int j = 0; j < 4; j++) {
+			words[j] = load_bigendian_32(in[j] + 4 * i);
+		}
+		w[i] = LOAD(words);
+	}
+
+	for (int i = 0; i < 64; i++) {
+		if (i >= 16) {
+			w[i & 15] = ADD(ADD(w[i & 15], sigma1(w[(i + 14) & 15])),
+			                ADD(w[(i + 9) & 15], sigma0(w[(i + 1) & 15])));
+		}
+		t1 = ADD(ADD(ADD(h, Sigma1(e)), ADD(Ch(e, f, g), SET1(K[i]))), w[i & 15]);
+		t2 = ADD(Sigma0(a), Maj(a, b, c));
+		h = g;
+		g = f;
+		f = e;
+		e = ADD(d, t1);
+		d = c;
+		c = b;
+		b = a;
+		a = ADD(t1, t2);
+	}
+
+	state[0] = ADD(state[0], a);
+	state[1] = ADD(state[1], b);
+	state[2] = ADD(state[2], c);
+	state[3] = ADD(state[3], d);
+	state[4] = ADD(state[4], e);
+	state[5] = ADD(state[5], f);
+	state[6] = ADD(state[6], g);
+	state[7] = ADD(state[7], h);
+}
+
+void oqs_sha2_sha256_x4_vec(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3,
+                            const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3,
+                            size_t inlen) {
+	uint8_t *out[4] = {out0, out1, out2, out3};
+	const uint8_t *in[4] = {in0, in1, in2, in3};
+	const uint8_t *blocks[4];
+	uint8_t padded[4][128];
+	uint32_t words[4];
+	v32x4 state[8];
+	size_t done, tail, padded_len;
+	const uint64_t bits = (uint64_t) inlen << 3;
+
+	for (int i = 0; i < 8; i++) {
+		state[i] = SET1(IV[i]);
+	}
+
+	for (done = 0; inlen - done >= 64; done += 64) {
+		for (int j = 0; j < 4; j++) {
+			blocks[j] = in[j] + done;
+		}
+		sha256_x4_block(state, blocks);
+	}
+
+	/* The last partial block, the 0x80 byte and the bit length take one or two blocks. */
+	tail = inlen - done;
+	padded_len = tail + 9 <= 64 ? 64 : 128;
+	for (int j = 0; j < 4; j++) {
+		memset(padded[j], 0, padded_len);
+		if (tail > 0) {
+			memcpy(padded[j], in[j] + done, tail);
+		}
+		padded[j][tail] = 0x80;
+		store_bigendian_32(padded[j] + padded_len - 8, (uint32_t) (bits >> 32));
+		store_bigendian_32(padded[j] + padded_len - 4, (uint32_t) bits);
+		blocks[j] = padded[j];
+	}
+	sha256_x4_block(state, blocks);
+	if (padded_len == 128) {
+		for (int j = 0; j < 4; j++) {
+			blocks[j] = padded[j] + 64;
+		}
+		sha256_x4_block(state, blocks);
+	}
+
+	for (int i = 0; i < 8; i++) {
+		STORE(words, state[i]);
+		for (int j = 0; j < 4; j++) {
+			store_bigendian_32(out[j] + 4 * i, words[j]);
+		}
+	}
+
+	/* the messages may be secret, e.g. PRF inputs */
+	OQS_MEM_cleanse(padded, sizeof(padded));
+}
+
+#else
+
+void oqs_sha2_sha256_x4_vec(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3,
+                            const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3,
+                            size_t inlen) {
+	oqs_sha2_sha256_c(out0, in0, inlen);
+	oqs_sha2_sha256_c(out1, in1, inlen);
+	oqs_sha2_sha256_c(out2, in2, inlen);
+	oqs_sha2_sha256_c(out3, in3, inlen);
+}
+
+#endif
@@ -10,6 +10,7 @@
 #ifdef OQS_USE_SHA3_OPENSSL
 
 #include "sha3.h"
+#include "sha3_absorb_once.h"
 
 #include "../ossl_helpers.h"
 #include <string.h>
@@ -304,6 +305,12 @@ static void SHA3_shake256_inc_ctx_reset(OQS_SHA3_shake256_inc_ctx *state) {
 	s->n_out = 0;
 }
 
+#if defined(OQS_USE_SHA3_ROUTING)
+/* Selected per route by sha3_route.c, which provides sha3_default_callbacks. */
+#define sha3_default_callbacks sha3_ossl_callbacks
+#define sha3_default_absorb_once_callbacks sha3_ossl_absorb_once_callbacks
+#endif
+
 extern struct OQS_SHA3_callbacks sha3_default_callbacks;
 
 struct OQS_SHA3_callbacks sha3_default_callbacks = {
@@ -346,4 +353,12 @@ struct OQS_SHA3_callbacks sha3_default_callbacks = {
 	SHA3_shake256_inc_ctx_reset,
 };
 
+/* OpenSSL has no single-block absorb: use inc_absorb + inc_finalize. */
+extern struct OQS_SHA3_absorb_once_callbacks sha3_default_absorb_once_callbacks;
+
+struct OQS_SHA3_absorb_once_callbacks sha3_default_absorb_once_callbacks = {
+	NULL,
+	NULL,
+};
+
 #endif
@@ -6,6 +6,7 @@
 
 #include "sha3.h"
 #include "sha3x4.h"
+#include "sha3_absorb_once.h"
 
 #include <openssl/evp.h>
 #include "../ossl_helpers.h"
@@ -256,6 +257,12 @@ static void SHA3_shake256_x4_inc_ctx_reset(OQS_SHA3_shake256_x4_inc_ctx *state)
 	s->n_out = 0;
 }
 
+#if defined(OQS_USE_SHA3_ROUTING)
+/* Selected per route by sha3_route.c, which provides sha3_x4_default_callbacks. */
+#define sha3_x4_default_callbacks sha3_x4_ossl_callbacks
+#define sha3_x4_default_absorb_once_callbacks sha3_x4_ossl_absorb_once_callbacks
+#endif
+
 extern struct OQS_SHA3_x4_callbacks sha3_x4_default_callbacks;
 
 struct OQS_SHA3_x4_callbacks sha3_x4_default_callbacks = {
@@ -277,4 +284,12 @@ struct OQS_SHA3_x4_callbacks sha3_x4_default_callbacks = {
 	SHA3_shake256_x4_inc_ctx_reset,
 };
 
+/* OpenSSL has no single-block absorb: use inc_absorb + inc_finalize. */
+extern struct OQS_SHA3_x4_absorb_once_callbacks sha3_x4_default_absorb_once_callbacks;
+
+struct OQS_SHA3_x4_absorb_once_callbacks sha3_x4_default_absorb_once_callbacks = {
+	NULL,
+	NULL,
+};
+
 #endif
@@ -3,13 +3,18 @@
 #include <oqs/oqs.h>
 
 #include "sha3.h"
+#include "sha3_absorb_once.h"
 
 extern struct OQS_SHA3_callbacks sha3_default_callbacks;
+extern struct OQS_SHA3_absorb_once_callbacks sha3_default_absorb_once_callbacks;
 
 static struct OQS_SHA3_callbacks *callbacks = &sha3_default_callbacks;
+/* Only the built-in callbacks come with a single-block absorb. */
+static struct OQS_SHA3_absorb_once_callbacks *absorb_once_callbacks = &sha3_default_absorb_once_callbacks;
 
 OQS_API void OQS_SHA3_set_callbacks(struct OQS_SHA3_callbacks *new_callbacks) {
 	callbacks = new_callbacks;
+	absorb_once_callbacks = new_callbacks == &sha3_default_callbacks ? &sha3_default_absorb_once_callbacks : NULL;
 }
 
 void OQS_SHA3_sha3_256(uint8_t *output, const uint8_t *input, size_t inplen) {
@@ -128,6 +133,16 @@ void OQS_SHA3_shake128_inc_ctx_reset(OQS_SHA3_shake128_inc_ctx *state) {
 	callbacks->SHA3_shake128_inc_ctx_reset(state);
 }
 
+void OQS_SHA3_shake128_absorb_once(OQS_SHA3_shake128_inc_ctx *state, const uint8_t *input, size_t inlen) {
+	if (absorb_once_callbacks != NULL && absorb_once_callbacks->SHA3_shake128_absorb_once != NULL) {
+		absorb_once_callbacks->SHA3_shake128_absorb_once(state, input, inlen);
+	} else {
+		callbacks->SHA3_shake128_inc_ctx_reset(state);
+		callbacks->SHA3_shake128_inc_absorb(state, input, inlen);
+		callbacks->SHA3_shake128_inc_finalize(state);
+	}
+}
+
 void OQS_SHA3_shake256(uint8_t *output, size_t outlen, const uint8_t *input, size_t inplen) {
 	callbacks->SHA3_shake256(output, outlen, input, inplen);
 }
@@ -159,3 +174,13 @@ void OQS_SHA3_shake256_inc_ctx_clone(OQS_SHA3_shake256_inc_ctx *dest, const OQS_
 void OQS_SHA3_shake256_inc_ctx_reset(OQS_SHA3_shake256_inc_ctx *state) {
 	callbacks->SHA3_shake256_inc_ctx_reset(state);
 }
+
+void OQS_SHA3_shake256_absorb_once(OQS_SHA3_shake256_inc_ctx *state, const uint8_t *input, size_t inlen) {
+	if (absorb_once_callbacks != NULL && absorb_once_callbacks->SHA3_shake256_absorb_once != NULL) {
+		absorb_once_callbacks->SHA3_shake256_absorb_once(state, input, inlen);
+	} else {
+		callbacks->SHA3_shake256_inc_ctx_reset(state);
+		callbacks->SHA3_shake256_inc_absorb(state, input, inlen);
+		callbacks->SHA3_shake256_inc_finalize(state);
+	}
+}
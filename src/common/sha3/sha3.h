@@ -316,6 +316,20 @@ void OQS_SHA3_shake128_inc_ctx_clone(OQS_SHA3_shake128_inc_ctx *dest, const OQS_
  */
 void OQS_SHA3_shake128_inc_ctx_reset(OQS_SHA3_shake128_inc_ctx *state);
 
+/**
+ * \brief Resets the state for the SHAKE-128 incremental API, absorbs a
+ * complete input and finalizes it, ready for OQS_SHA3_shake128_inc_squeeze.
+ *
+ * Equivalent to OQS_SHA3_shake128_inc_ctx_reset, OQS_SHA3_shake128_inc_absorb
+ * and OQS_SHA3_shake128_inc_finalize, but inputs shorter than one block
+ * (OQS_SHA3_SHAKE128_RATE bytes) are padded and absorbed in a single step.
+ *
+ * \param state The function state; must be initialized
+ * \param input input buffer
+ * \param inlen length of input buffer
+ */
+void OQS_SHA3_shake128_absorb_once(OQS_SHA3_shake128_inc_ctx *state, const uint8_t *input, size_t inlen);
+
 /** The SHAKE-256 byte absorption rate */
 #define OQS_SHA3_SHAKE256_RATE 136
 
@@ -393,6 +407,20 @@ void OQS_SHA3_shake256_inc_ctx_clone(OQS_SHA3_shake256_inc_ctx *dest, const OQS_
  */
 void OQS_SHA3_shake256_inc_ctx_reset(OQS_SHA3_shake256_inc_ctx *state);
 
+/**
+ * \brief Resets the state for the SHAKE-256 incremental API, absorbs a
+ * complete input and finalizes it, ready for OQS_SHA3_shake256_inc_squeeze.
+ *
+ * Equivalent to OQS_SHA3_shake256_inc_ctx_reset, OQS_SHA3_shake256_inc_absorb
+ * and OQS_SHA3_shake256_inc_finalize, but inputs shorter than one block
+ * (OQS_SHA3_SHAKE256_RATE bytes) are padded and absorbed in a single step.
+ *
+ * \param state The function state; must be initialized
+ * \param input input buffer
+ * \param inlen length of input buffer
+ */
+void OQS_SHA3_shake256_absorb_once(OQS_SHA3_shake256_inc_ctx *state, const uint8_t *input, size_t inlen);
+
 #if defined(__cplusplus)
 } // extern "C"
 #endif
@@ -0,0 +1,33 @@
+/* Single-block SHAKE absorb of the built-in SHA-3 backends.
+ *
+ * These hooks are kept out of struct OQS_SHA3_callbacks and struct
+ * OQS_SHA3_x4_callbacks: applications allocate those structures and hand them
+ * to OQS_SHA3_set_callbacks() / OQS_SHA3_x4_set_callbacks(), so their layout
+ * is part of the ABI. The hooks are used only while the built-in callbacks are
+ * installed; a NULL member, or callbacks installed by the application, makes
+ * OQS_SHA3_shake*_absorb_once fall back to the reset, absorb and finalize
+ * callbacks.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef OQS_SHA3_ABSORB_ONCE_H
+#define OQS_SHA3_ABSORB_ONCE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "sha3.h"
+#include "sha3x4.h"
+
+struct OQS_SHA3_absorb_once_callbacks {
+	void (*SHA3_shake128_absorb_once)(OQS_SHA3_shake128_inc_ctx *state, const uint8_t *input, size_t inlen);
+	void (*SHA3_shake256_absorb_once)(OQS_SHA3_shake256_inc_ctx *state, const uint8_t *input, size_t inlen);
+};
+
+struct OQS_SHA3_x4_absorb_once_callbacks {
+	void (*SHA3_shake128_x4_absorb_once)(OQS_SHA3_shake128_x4_inc_ctx *state, const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3, size_t inlen);
+	void (*SHA3_shake256_x4_absorb_once)(OQS_SHA3_shake256_x4_inc_ctx *state, const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3, size_t inlen);
+};
+
+#endif
@@ -244,11 +244,68 @@ struct OQS_SHA3_callbacks {
  * This function may be called before OQS_init to switch the
  * cryptographic provider for SHA3 operations. If it is not called,
  * the default provider determined at build time will be used.
+ * With callbacks other than the built-in ones, OQS_SHA3_shake128_absorb_once and its
+ * SHAKE256 counterpart are served by the reset, absorb and finalize callbacks.
  *
  * @param new_callbacks Callback functions defined in OQS_SHA3_callbacks struct
  */
 OQS_API void OQS_SHA3_set_callbacks(struct OQS_SHA3_callbacks *new_callbacks);
 
+/**
+ * Groups of SHA-3 primitives that can be served by different backends.
+ */
+typedef enum {
+	/** One-shot SHA3-256, SHA3-384 and SHA3-512. */
+	OQS_SHA3_ROUTE_SHA3 = 0,
+	/** Incremental SHA3-256, SHA3-384 and SHA3-512. */
+	OQS_SHA3_ROUTE_SHA3_INC = 1,
+	/** One-shot SHAKE128 and SHAKE256. */
+	OQS_SHA3_ROUTE_SHAKE = 2,
+	/** Incremental SHAKE128 and SHAKE256. */
+	OQS_SHA3_ROUTE_SHAKE_INC = 3,
+	/** Four-way parallel SHAKE128 and SHAKE256 (see sha3x4_ops.h). */
+	OQS_SHA3_ROUTE_X4 = 4,
+	/** Number of routes. */
+	OQS_SHA3_ROUTE_COUNT = 5
+} OQS_SHA3_ROUTE;
+
+/**
+ * SHA-3 backends.
+ */
+typedef enum {
+	/** The built-in Keccak code (XKCP, or the AVX512VL implementation where available). */
+	OQS_SHA3_BACKEND_XKCP = 0,
+	/** OpenSSL's EVP interface. */
+	OQS_SHA3_BACKEND_OPENSSL = 1
+} OQS_SHA3_BACKEND;
+
+/**
+ * Selects the backend serving a group of SHA-3 primitives.
+ *
+ * Both backends are only available when liboqs is built with
+ * OQS_USE_SHA3_OPENSSL and OQS_USE_SHA3_ROUTING; the build-time defaults are
+ * set by OQS_SHA3_OPENSSL_ROUTES.  Otherwise only the single compiled-in
+ * backend can be selected.
+ *
+ * Like OQS_SHA3_set_callbacks(), this is not thread-safe and must be called
+ * while no incremental SHA-3 contexts of the affected route are live, as
+ * contexts cannot migrate between backends.  It has no effect on callbacks
+ * installed with OQS_SHA3_set_callbacks() or OQS_SHA3_x4_set_callbacks().
+ *
+ * @param[in] route The group of primitives.
+ * @param[in] backend The backend to use for it.
+ * @return OQS_SUCCESS, or OQS_ERROR if the backend is not available in this build
+ */
+OQS_API OQS_STATUS OQS_SHA3_set_backend(OQS_SHA3_ROUTE route, OQS_SHA3_BACKEND backend);
+
+/**
+ * Returns the name of the backend serving a group of SHA-3 primitives.
+ *
+ * @param[in] route The group of primitives.
+ * @return "XKCP" or "OpenSSL", or NULL for an invalid route
+ */
+OQS_API const char *OQS_SHA3_backend_name(OQS_SHA3_ROUTE route);
+
 #if defined(__cplusplus)
 } // extern "C"
 #endif
@@ -0,0 +1,443 @@
+// SPDX-License-Identifier: MIT
+
+/*
+ * Per-primitive SHA-3 backend selection.
+ *
+ * With OQS_USE_SHA3_ROUTING both the OpenSSL and the XKCP implementations are
+ * compiled in, and the default callback tables used by sha3.c and sha3x4.c
+ * forward each call to the backend chosen for its route.  This keeps
+ * OpenSSL's SHA-3 available where it is wanted (e.g. for FIPS) while the
+ * block-by-block squeezing of rejection samplers, which OpenSSL before 3.3
+ * can only emulate by re-squeezing the whole output so far, and short
+ * one-shot hashes, which pay for an EVP_MD_CTX allocation per call, stay on
+ * XKCP.
+ */
+
+#include <oqs/oqs.h>
+
+#include "sha3.h"
+#include "sha3x4.h"
+#include "sha3_absorb_once.h"
+
+static const char *const backend_names[] = {
+	"XKCP",
+	"OpenSSL",
+};
+
+#if defined(OQS_USE_SHA3_ROUTING)
+
+#ifndef OQS_SHA3_OPENSSL_ROUTE_MASK
+#define OQS_SHA3_OPENSSL_ROUTE_MASK 0
+#endif
+#define ROUTE_DEFAULT(route) \
+	(((OQS_SHA3_OPENSSL_ROUTE_MASK >> (route)) & 1) ? OQS_SHA3_BACKEND_OPENSSL : OQS_SHA3_BACKEND_XKCP)
+
+extern struct OQS_SHA3_callbacks sha3_xkcp_callbacks;
+extern struct OQS_SHA3_callbacks sha3_ossl_callbacks;
+extern struct OQS_SHA3_x4_callbacks sha3_x4_xkcp_callbacks;
+extern struct OQS_SHA3_x4_callbacks sha3_x4_ossl_callbacks;
+extern struct OQS_SHA3_absorb_once_callbacks sha3_xkcp_absorb_once_callbacks;
+extern struct OQS_SHA3_absorb_once_callbacks sha3_ossl_absorb_once_callbacks;
+extern struct OQS_SHA3_x4_absorb_once_callbacks sha3_x4_xkcp_absorb_once_callbacks;
+extern struct OQS_SHA3_x4_absorb_once_callbacks sha3_x4_ossl_absorb_once_callbacks;
+
+/* Indexed by OQS_SHA3_BACKEND. The XKCP tables may be switched to AVX512VL at first use. */
+static struct OQS_SHA3_callbacks *const sha3_backends[] = {
+	&sha3_xkcp_callbacks,
+	&sha3_ossl_callbacks,
+};
+
+static struct OQS_SHA3_x4_callbacks *const sha3_x4_backends[] = {
+	&sha3_x4_xkcp_callbacks,
+	&sha3_x4_ossl_callbacks,
+};
+
+static struct OQS_SHA3_absorb_once_callbacks *const sha3_absorb_once_backends[] = {
+	&sha3_xkcp_absorb_once_callbacks,
+	&sha3_ossl_absorb_once_callbacks,
+};
+
+static struct OQS_SHA3_x4_absorb_once_callbacks *const sha3_x4_absorb_once_backends[] = {
+	&sha3_x4_xkcp_absorb_once_callbacks,
+	&sha3_x4_ossl_absorb_once_callbacks,
+};
+
+static OQS_SHA3_BACKEND routes[OQS_SHA3_ROUTE_COUNT] = {
+	ROUTE_DEFAULT(OQS_SHA3_ROUTE_SHA3),
+	ROUTE_DEFAULT(OQS_SHA3_ROUTE_SHA3_INC),
+	ROUTE_DEFAULT(OQS_SHA3_ROUTE_SHAKE),
+	ROUTE_DEFAULT(OQS_SHA3_ROUTE_SHAKE_INC),
+	ROUTE_DEFAULT(OQS_SHA3_ROUTE_X4),
+};
+
+OQS_API OQS_STATUS OQS_SHA3_set_backend(OQS_SHA3_ROUTE route, OQS_SHA3_BACKEND backend) {
+	if ((unsigned) route >= OQS_SHA3_ROUTE_COUNT || (backend != OQS_SHA3_BACKEND_XKCP && backend != OQS_SHA3_BACKEND_OPENSSL)) {
+		return OQS_ERROR;
+	}
+	routes[route] = backend;
+	return OQS_SUCCESS;
+}
+
+OQS_API const char *OQS_SHA3_backend_name(OQS_SHA3_ROUTE route) {
+	if ((unsigned) route >= OQS_SHA3_ROUTE_COUNT) {
+		return NULL;
+	}
+	return backend_names[routes[route]];
+}
+
+static void route_sha3_256(uint8_t *output, const uint8_t *input, size_t inplen) {
+	sha3_backends[routes[OQS_SHA3_ROUTE_SHA3]]->SHA3_sha3_256(output, input, inplen);
+}
+
+static void route_sha3_256_inc_init(OQS_SHA3_sha3_256_inc_ctx *state) {
+	sha3_backends[routes[OQS_SHA3_ROUTE_SHA3_INC]]->SHA3_sha3_256_inc_init(state);
+}
+
+static void route_sha3_256_inc_absorb(OQS_SHA3_sha3_256_inc_ctx *state, const uint8_t *input, size_t inlen) {
+	sha3_backends[routes[OQS_SHA3_ROUTE_SHA3_INC]]->SHA3_sha3_256_inc_absorb(state, input, inlen);
+}
+
+static void route_sha3_256_inc_finalize(uint8_t *output, OQS_SHA3_sha3_256_inc_ctx *state) {
+	sha3_backends[routes[OQS_SHA3_ROUTE_SHA3_INC]]->SHA3_sha3_256_inc_finalize(output, state);
+}
+
+static void route_sha3_256_inc_ctx_release(OQS_SHA3_sha3_256_inc_ctx *state) {
+	sha3_backends[routes[OQS_SHA3_ROUTE_SHA3_INC]]->SHA3_sha3_256_inc_ctx_release(state);
+}
+
+static void route_sha3_256_inc_ctx_reset(OQS_SHA3_sha3_256_inc_ctx *state) {
+	sha3_backends[routes[OQS_SHA3_ROUTE_SHA3_INC]]->SHA3_sha3_256_inc_ctx_reset(state);
+}
+
+static void route_sha3_256_inc_ctx_clone(OQS_SHA3_sha3_256_inc_ctx *dest, const OQS_SHA3_sha3_256_inc_ctx *src) {
+	sha3_backends[routes[OQS_SHA3_ROUTE_SHA3_INC]]->SHA3_sha3_256_inc_ctx_clone(dest, src);
+}
+
+static void route_sha3_384(uint8_t *output, const uint8_t *input, size_t inplen) {
+	sha3_backends[routes[OQS_SHA3_ROUTE_SHA3]]->SHA3_sha3_384(output, input, inplen);
+}
+
+static void route_sha3_384_inc_init(OQS_SHA3_sha3_384_inc_ctx *state) {
+	sha3_backends[routes[OQS_SHA3_ROUTE_SHA3_INC]]->SHA3_sha3_384_inc_init(state);
+}
+
+static void route_sha3_384_inc_absorb(OQS_SHA3_sha3_384_inc_ctx *state, const uint8_t *input, size_t inlen) {
+	sha3_backends[routes[OQS_SHA3_ROUTE_SHA3_INC]]->SHA3_sha3_384_inc_absorb(state, input, inlen);
+}
+
+static void route_sha3_384_inc_finalize(uint8_t *output, OQS_SHA3_sha3_384_inc_ctx *state) {
+	sha3_backends[routes[OQS_SHA3_ROUTE_SHA3_INC]]->SHA3_sha3_384_inc_finalize(output, state);
+}
+
+static void route_sha3_384_inc_ctx_release(OQS_SHA3_sha3_384_inc_ctx *state) {
+	sha3_backends[routes[OQS_SHA3_ROUTE_SHA3_INC]]->SHA3_sha3_384_inc_ctx_release(state);
+}
+
+static void route_sha3_384_inc_ctx_reset(OQS_SHA3_sha3_384_inc_ctx *state) {
+	sha3_backends[routes[OQS_SHA3_ROUTE_SHA3_INC]]->SHA3_sha3_384_inc_ctx_reset(state);
+}
+
+static void route_sha3_384_inc_ctx_clone(OQS_SHA3_sha3_384_inc_ctx *dest, const OQS_SHA3_sha3_384_inc_ctx *src) {
+	sha3_backends[routes[OQS_SHA3_ROUTE_SHA3_INC]]->SHA3_sha3_384_inc_ctx_clone(dest, src);
+}
+
+static void route_sha3_512(uint8_t *output, const uint8_t *input, size_t inplen) {
+	sha3_backends[routes[OQS_SHA3_ROUTE_SHA3]]->SHA3_sha3_512(output, input, inplen);
+}
+
+static void route_sha3_512_inc_init(OQS_SHA3_sha3_512_inc_ctx *state) {
+	sha3_backends[routes[OQS_SHA3_ROUTE_SHA3_INC]]->SHA3_sha3_512_inc_init(state);
+}
+
+static void route_sha3_512_inc_absorb(OQS_SHA3_sha3_512_inc_ctx *state, const uint8_t *input, size_t inlen) {
+	sha3_backends[routes[OQS_SHA3_ROUTE_SHA3_INC]]->SHA3_sha3_512_inc_absorb(state, input, inlen);
+}
+
+static void route_sha3_512_inc_finalize(uint8_t *output, OQS_SHA3_sha3_512_inc_ctx *state) {
+	sha3_backends[routes[OQS_SHA3_ROUTE_SHA3_INC]]->SHA3_sha3_512_inc_finalize(output, state);
+}
+
+static void route_sha3_512_inc_ctx_release(OQS_SHA3_sha3_512_inc_ctx *state) {
+	sha3_backends[routes[OQS_SHA3_ROUTE_SHA3_INC]]->SHA3_sha3_512_inc_ctx_release(state);
+}
+
+static void route_sha3_512_inc_ctx_reset(OQS_SHA3_sha3_512_inc_ctx *state) {
+	sha3_backends[routes[OQS_SHA3_ROUTE_SHA3_INC]]->SHA3_sha3_512_inc_ctx_reset(state);
+}
+
+static void route_sha3_512_inc_ctx_clone(OQS_SHA3_sha3_512_inc_ctx *dest, const OQS_SHA3_sha3_512_inc_ctx *src) {
+	sha3_backends[routes[OQS_SHA3_ROUTE_SHA3_INC]]->SHA3_sha3_512_inc_ctx_clone(dest, src);
+}
+
+static void route_shake128(uint8_t *output, size_t outlen, const uint8_t *input, size_t inplen) {
+	sha3_backends[routes[OQS_SHA3_ROUTE_SHAKE]]->SHA3_shake128(output, outlen, input, inplen);
+}
+
+static void route_shake128_inc_init(OQS_SHA3_shake128_inc_ctx *state) {
+	sha3_backends[routes[OQS_SHA3_ROUTE_SHAKE_INC]]->SHA3_shake128_inc_init(state);
+}
+
+static void route_shake128_inc_absorb(OQS_SHA3_shake128_inc_ctx *state, const uint8_t *input, size_t inlen) {
+	sha3_backends[routes[OQS_SHA3_ROUTE_SHAKE_INC]]->SHA3_shake128_inc_absorb(state, input, inlen);
+}
+
+static void route_shake128_inc_finalize(OQS_SHA3_shake128_inc_ctx *state) {
+	sha3_backends[routes[OQS_SHA3_ROUTE_SHAKE_INC]]->SHA3_shake128_inc_finalize(state);
+}
+
+static void route_shake128_inc_squeeze(uint8_t *output, size_t outlen, OQS_SHA3_shake128_inc_ctx *state) {
+	sha3_backends[routes[OQS_SHA3_ROUTE_SHAKE_INC]]->SHA3_shake128_inc_squeeze(output, outlen, state);
+}
+
+static void route_shake128_inc_ctx_release(OQS_SHA3_shake128_inc_ctx *state) {
+	sha3_backends[routes[OQS_SHA3_ROUTE_SHAKE_INC]]->SHA3_shake128_inc_ctx_release(state);
+}
+
+static void route_shake128_inc_ctx_clone(OQS_SHA3_shake128_inc_ctx *dest, const OQS_SHA3_shake128_inc_ctx *src) {
+	sha3_backends[routes[OQS_SHA3_ROUTE_SHAKE_INC]]->SHA3_shake128_inc_ctx_clone(dest, src);
+}
+
+static void route_shake128_inc_ctx_reset(OQS_SHA3_shake128_inc_ctx *state) {
+	sha3_backends[routes[OQS_SHA3_ROUTE_SHAKE_INC]]->SHA3_shake128_inc_ctx_reset(state);
+}
+
+static void route_shake256(uint8_t *output, size_t outlen, const uint8_t *input, size_t inplen) {
+	sha3_backends[routes[OQS_SHA3_ROUTE_SHAKE]]->SHA3_shake256(output, outlen, input, inplen);
+}
+
+static void route_shake256_inc_init(OQS_SHA3_shake256_inc_ctx *state) {
+	sha3_backends[routes[OQS_SHA3_ROUTE_SHAKE_INC]]->SHA3_shake256_inc_init(state);
+}
+
+static void route_shake256_inc_absorb(OQS_SHA3_shake256_inc_ctx *state, const uint8_t *input, size_t inlen) {
+	sha3_backends[routes[OQS_SHA3_ROUTE_SHAKE_INC]]->SHA3_shake256_inc_absorb(state, input, inlen);
+}
+
+static void route_shake256_inc_finalize(OQS_SHA3_shake256_inc_ctx *state) {
+	sha3_backends[routes[OQS_SHA3_ROUTE_SHAKE_INC]]->SHA3_shake256_inc_finalize(state);
+}
+
+static void route_shake256_inc_squeeze(uint8_t *output, size_t outlen, OQS_SHA3_shake256_inc_ctx *state) {
+	sha3_backends[routes[OQS_SHA3_ROUTE_SHAKE_INC]]->SHA3_shake256_inc_squeeze(output, outlen, state);
+}
+
+static void route_shake256_inc_ctx_release(OQS_SHA3_shake256_inc_ctx *state) {
+	sha3_backends[routes[OQS_SHA3_ROUTE_SHAKE_INC]]->SHA3_shake256_inc_ctx_release(state);
+}
+
+static void route_shake256_inc_ctx_clone(OQS_SHA3_shake256_inc_ctx *dest, const OQS_SHA3_shake256_inc_ctx *src) {
+	sha3_backends[routes[OQS_SHA3_ROUTE_SHAKE_INC]]->SHA3_shake256_inc_ctx_clone(dest, src);
+}
+
+static void route_shake256_inc_ctx_reset(OQS_SHA3_shake256_inc_ctx *state) {
+	sha3_backends[routes[OQS_SHA3_ROUTE_SHAKE_INC]]->SHA3_shake256_inc_ctx_reset(state);
+}
+
+static void route_shake128_absorb_once(OQS_SHA3_shake128_inc_ctx *state, const uint8_t *input, size_t inlen) {
+	struct OQS_SHA3_callbacks *backend = sha3_backends[routes[OQS_SHA3_ROUTE_SHAKE_INC]];
+	struct OQS_SHA3_absorb_once_callbacks *absorb_once = sha3_absorb_once_backends[routes[OQS_SHA3_ROUTE_SHAKE_INC]];
+
+	if (absorb_once->SHA3_shake128_absorb_once != NULL) {
+		absorb_once->SHA3_shake128_absorb_once(state, input, inlen);
+	} else {
+		backend->SHA3_shake128_inc_ctx_reset(state);
+		backend->SHA3_shake128_inc_absorb(state, input, inlen);
+		backend->SHA3_shake128_inc_finalize(state);
+	}
+}
+
+static void route_shake256_absorb_once(OQS_SHA3_shake256_inc_ctx *state, const uint8_t *input, size_t inlen) {
+	struct OQS_SHA3_callbacks *backend = sha3_backends[routes[OQS_SHA3_ROUTE_SHAKE_INC]];
+	struct OQS_SHA3_absorb_once_callbacks *absorb_once = sha3_absorb_once_backends[routes[OQS_SHA3_ROUTE_SHAKE_INC]];
+
+	if (absorb_once->SHA3_shake256_absorb_once != NULL) {
+		absorb_once->SHA3_shake256_absorb_once(state, input, inlen);
+	} else {
+		backend->SHA3_shake256_inc_ctx_reset(state);
+		backend->SHA3_shake256_inc_absorb(state, input, inlen);
+		backend->SHA3_shake256_inc_finalize(state);
+	}
+}
+
+struct OQS_SHA3_callbacks sha3_default_callbacks = {
+	route_sha3_256,
+	route_sha3_256_inc_init,
+	route_sha3_256_inc_absorb,
+	route_sha3_256_inc_finalize,
+	route_sha3_256_inc_ctx_release,
+	route_sha3_256_inc_ctx_reset,
+	route_sha3_256_inc_ctx_clone,
+	route_sha3_384,
+	route_sha3_384_inc_init,
+	route_sha3_384_inc_absorb,
+	route_sha3_384_inc_finalize,
+	route_sha3_384_inc_ctx_release,
+	route_sha3_384_inc_ctx_reset,
+	route_sha3_384_inc_ctx_clone,
+	route_sha3_512,
+	route_sha3_512_inc_init,
+	route_sha3_512_inc_absorb,
+	route_sha3_512_inc_finalize,
+	route_sha3_512_inc_ctx_release,
+	route_sha3_512_inc_ctx_reset,
+	route_sha3_512_inc_ctx_clone,
+	route_shake128,
+	route_shake128_inc_init,
+	route_shake128_inc_absorb,
+	route_shake128_inc_finalize,
+	route_shake128_inc_squeeze,
+	route_shake128_inc_ctx_release,
+	route_shake128_inc_ctx_clone,
+	route_shake128_inc_ctx_reset,
+	route_shake256,
+	route_shake256_inc_init,
+	route_shake256_inc_absorb,
+	route_shake256_inc_finalize,
+	route_shake256_inc_squeeze,
+	route_shake256_inc_ctx_release,
+	route_shake256_inc_ctx_clone,
+	route_shake256_inc_ctx_reset,
+};
+
+struct OQS_SHA3_absorb_once_callbacks sha3_default_absorb_once_callbacks = {
+	route_shake128_absorb_once,
+	route_shake256_absorb_once,
+};
+
+static void route_shake128_x4(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3, size_t outlen, const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3, size_t inlen) {
+	sha3_x4_backends[routes[OQS_SHA3_ROUTE_X4]]->SHA3_shake128_x4(out0, out1, out2, out3, outlen, in0, in1, in2, in3, inlen);
+}
+
+static void route_shake128_x4_inc_init(OQS_SHA3_shake128_x4_inc_ctx *state) {
+	sha3_x4_backends[routes[OQS_SHA3_ROUTE_X4]]->SHA3_shake128_x4_inc_init(state);
+}
+
+static void route_shake128_x4_inc_absorb(OQS_SHA3_shake128_x4_inc_ctx *state, const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3, size_t inlen) {
+	sha3_x4_backends[routes[OQS_SHA3_ROUTE_X4]]->SHA3_shake128_x4_inc_absorb(state, in0, in1, in2, in3, inlen);
+}
+
+static void route_shake128_x4_inc_finalize(OQS_SHA3_shake128_x4_inc_ctx *state) {
+	sha3_x4_backends[routes[OQS_SHA3_ROUTE_X4]]->SHA3_shake128_x4_inc_finalize(state);
+}
+
+static void route_shake128_x4_inc_squeeze(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3, size_t outlen, OQS_SHA3_shake128_x4_inc_ctx *state) {
+	sha3_x4_backends[routes[OQS_SHA3_ROUTE_X4]]->SHA3_shake128_x4_inc_squeeze(out0, out1, out2, out3, outlen, state);
+}
+
+static void route_shake128_x4_inc_ctx_release(OQS_SHA3_shake128_x4_inc_ctx *state) {
+	sha3_x4_backends[routes[OQS_SHA3_ROUTE_X4]]->SHA3_shake128_x4_inc_ctx_release(state);
+}
+
+static void route_shake128_x4_inc_ctx_clone(OQS_SHA3_shake128_x4_inc_ctx *dest, const OQS_SHA3_shake128_x4_inc_ctx *src) {
+	sha3_x4_backends[routes[OQS_SHA3_ROUTE_X4]]->SHA3_shake128_x4_inc_ctx_clone(dest, src);
+}
+
+static void route_shake128_x4_inc_ctx_reset(OQS_SHA3_shake128_x4_inc_ctx *state) {
+	sha3_x4_backends[routes[OQS_SHA3_ROUTE_X4]]->SHA3_shake128_x4_inc_ctx_reset(state);
+}
+
+static void route_shake256_x4(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3, size_t outlen, const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3, size_t inlen) {
+	sha3_x4_backends[routes[OQS_SHA3_ROUTE_X4]]->SHA3_shake256_x4(out0, out1, out2, out3, outlen, in0, in1, in2, in3, inlen);
+}
+
+static void route_shake256_x4_inc_init(OQS_SHA3_shake256_x4_inc_ctx *state) {
+	sha3_x4_backends[routes[OQS_SHA3_ROUTE_X4]]->SHA3_shake256_x4_inc_init(state);
+}
+
+static void route_shake256_x4_inc_absorb(OQS_SHA3_shake256_x4_inc_ctx *state, const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3, size_t inlen) {
+	sha3_x4_backends[routes[OQS_SHA3_ROUTE_X4]]->SHA3_shake256_x4_inc_absorb(state, in0, in1, in2, in3, inlen);
+}
+
+static void route_shake256_x4_inc_finalize(OQS_SHA3_shake256_x4_inc_ctx *state) {
+	sha3_x4_backends[routes[OQS_SHA3_ROUTE_X4]]->SHA3_shake256_x4_inc_finalize(state);
+}
+
+static void route_shake256_x4_inc_squeeze(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3, size_t outlen, OQS_SHA3_shake256_x4_inc_ctx *state) {
+	sha3_x4_backends[routes[OQS_SHA3_ROUTE_X4]]->SHA3_shake256_x4_inc_squeeze(out0, out1, out2, out3, outlen, state);
+}
+
+static void route_shake256_x4_inc_ctx_release(OQS_SHA3_shake256_x4_inc_ctx *state) {
+	sha3_x4_backends[routes[OQS_SHA3_ROUTE_X4]]->SHA3_shake256_x4_inc_ctx_release(state);
+}
+
+static void route_shake256_x4_inc_ctx_clone(OQS_SHA3_shake256_x4_inc_ctx *dest, const OQS_SHA3_shake256_x4_inc_ctx *src) {
+	sha3_x4_backends[routes[OQS_SHA3_ROUTE_X4]]->SHA3_shake256_x4_inc_ctx_clone(dest, src);
+}
+
+static void route_shake256_x4_inc_ctx_reset(OQS_SHA3_shake256_x4_inc_ctx *state) {
+	sha3_x4_backends[routes[OQS_SHA3_ROUTE_X4]]->SHA3_shake256_x4_inc_ctx_reset(state);
+}
+
+static void route_shake128_x4_absorb_once(OQS_SHA3_shake128_x4_inc_ctx *state, const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3, size_t inlen) {
+	struct OQS_SHA3_x4_callbacks *backend = sha3_x4_backends[routes[OQS_SHA3_ROUTE_X4]];
+	struct OQS_SHA3_x4_absorb_once_callbacks *absorb_once = sha3_x4_absorb_once_backends[routes[OQS_SHA3_ROUTE_X4]];
+
+	if (absorb_once->SHA3_shake128_x4_absorb_once != NULL) {
+		absorb_once->SHA3_shake128_x4_absorb_once(state, in0, in1, in2, in3, inlen);
+	} else {
+		backend->SHA3_shake128_x4_inc_ctx_reset(state);
+		backend->SHA3_shake128_x4_inc_absorb(state, in0, in1, in2, in3, inlen);
+		backend->SHA3_shake128_x4_inc_finalize(state);
+	}
+}
+
+static void route_shake256_x4_absorb_once(OQS_SHA3_shake256_x4_inc_ctx *state, const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3, size_t inlen) {
+	struct OQS_SHA3_x4_callbacks *backend = sha3_x4_backends[routes[OQS_SHA3_ROUTE_X4]];
+	struct OQS_SHA3_x4_absorb_once_callbacks *absorb_once = sha3_x4_absorb_once_backends[routes[OQS_SHA3_ROUTE_X4]];
+
+	if (absorb_once->SHA3_shake256_x4_absorb_once != NULL) {
+		absorb_once->SHA3_shake256_x4_absorb_once(state, in0, in1, in2, in3, inlen);
+	} else {
+		backend->SHA3_shake256_x4_inc_ctx_reset(state);
+		backend->SHA3_shake256_x4_inc_absorb(state, in0, in1, in2, in3, inlen);
+		backend->SHA3_shake256_x4_inc_finalize(state);
+	}
+}
+
+struct OQS_SHA3_x4_callbacks sha3_x4_default_callbacks = {
+	route_shake128_x4,
+	route_shake128_x4_inc_init,
+	route_shake128_x4_inc_absorb,
+	route_shake128_x4_inc_finalize,
+	route_shake128_x4_inc_squeeze,
+	route_shake128_x4_inc_ctx_release,
+	route_shake128_x4_inc_ctx_clone,
+	route_shake128_x4_inc_ctx_reset,
+	route_shake256_x4,
+	route_shake256_x4_inc_init,
+	route_shake256_x4_inc_absorb,
+	route_shake256_x4_inc_finalize,
+	route_shake256_x4_inc_squeeze,
+	route_shake256_x4_inc_ctx_release,
+	route_shake256_x4_inc_ctx_clone,
+	route_shake256_x4_inc_ctx_reset,
+};
+
+struct OQS_SHA3_x4_absorb_once_callbacks sha3_x4_default_absorb_once_callbacks = {
+	route_shake128_x4_absorb_once,
+	route_shake256_x4_absorb_once,
+};
+
+#else /* !OQS_USE_SHA3_ROUTING */
+
+#if defined(OQS_USE_SHA3_OPENSSL)
+#define SHA3_BUILTIN_BACKEND OQS_SHA3_BACKEND_OPENSSL
+#else
+#define SHA3_BUILTIN_BACKEND OQS_SHA3_BACKEND_XKCP
+#endif
+
+OQS_API OQS_STATUS OQS_SHA3_set_backend(OQS_SHA3_ROUTE route, OQS_SHA3_BACKEND backend) {
+	if ((unsigned) route >= OQS_SHA3_ROUTE_COUNT || backend != SHA3_BUILTIN_BACKEND) {
+		return OQS_ERROR;
+	}
+	return OQS_SUCCESS;
+}
+
+OQS_API const char *OQS_SHA3_backend_name(OQS_SHA3_ROUTE route) {
+	if ((unsigned) route >= OQS_SHA3_ROUTE_COUNT) {
+		return NULL;
+	}
+	return backend_names[SHA3_BUILTIN_BACKEND];
+}
+
+#endif /* OQS_USE_SHA3_ROUTING */
@@ -3,13 +3,18 @@
 #include <oqs/oqs.h>
 
 #include "sha3x4.h"
+#include "sha3_absorb_once.h"
 
 extern struct OQS_SHA3_x4_callbacks sha3_x4_default_callbacks;
+extern struct OQS_SHA3_x4_absorb_once_callbacks sha3_x4_default_absorb_once_callbacks;
 
 static struct OQS_SHA3_x4_callbacks *callbacks = &sha3_x4_default_callbacks;
+/* Only the built-in callbacks come with a single-block absorb. */
+static struct OQS_SHA3_x4_absorb_once_callbacks *absorb_once_callbacks = &sha3_x4_default_absorb_once_callbacks;
 
 OQS_API void OQS_SHA3_x4_set_callbacks(struct OQS_SHA3_x4_callbacks *new_callbacks) {
 	callbacks = new_callbacks;
+	absorb_once_callbacks = new_callbacks == &sha3_x4_default_callbacks ? &sha3_x4_default_absorb_once_callbacks : NULL;
 }
 
 void OQS_SHA3_shake128_x4(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3, size_t outlen, const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3, size_t inlen) {
@@ -44,6 +49,16 @@ void OQS_SHA3_shake128_x4_inc_ctx_reset(OQS_SHA3_shake128_x4_inc_ctx *state) {
 	callbacks->SHA3_shake128_x4_inc_ctx_reset(state);
 }
 
+void OQS_SHA3_shake128_x4_absorb_once(OQS_SHA3_shake128_x4_inc_ctx *state, const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3, size_t inlen) {
+	if (absorb_once_callbacks != NULL && absorb_once_callbacks->SHA3_shake128_x4_absorb_once != NULL) {
+		absorb_once_callbacks->SHA3_shake128_x4_absorb_once(state, in0, in1, in2, in3, inlen);
+	} else {
+		callbacks->SHA3_shake128_x4_inc_ctx_reset(state);
+		callbacks->SHA3_shake128_x4_inc_absorb(state, in0, in1, in2, in3, inlen);
+		callbacks->SHA3_shake128_x4_inc_finalize(state);
+	}
+}
+
 void OQS_SHA3_shake256_x4(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3, size_t outlen, const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3, size_t inlen) {
 	callbacks->SHA3_shake256_x4(out0, out1, out2, out3, outlen, in0, in1, in2, in3, inlen);
 }
@@ -75,3 +90,13 @@ void OQS_SHA3_shake256_x4_inc_ctx_clone(OQS_SHA3_shake256_x4_inc_ctx *dest, cons
 void OQS_SHA3_shake256_x4_inc_ctx_reset(OQS_SHA3_shake256_x4_inc_ctx *state) {
 	callbacks->SHA3_shake256_x4_inc_ctx_reset(state);
 }
+
+void OQS_SHA3_shake256_x4_absorb_once(OQS_SHA3_shake256_x4_inc_ctx *state, const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3, size_t inlen) {
+	if (absorb_once_callbacks != NULL && absorb_once_callbacks->SHA3_shake256_x4_absorb_once != NULL) {
+		absorb_once_callbacks->SHA3_shake256_x4_absorb_once(state, in0, in1, in2, in3, inlen);
+	} else {
+		callbacks->SHA3_shake256_x4_inc_ctx_reset(state);
+		callbacks->SHA3_shake256_x4_inc_absorb(state, in0, in1, in2, in3, inlen);
+		callbacks->SHA3_shake256_x4_inc_finalize(state);
+	}
+}
@@ -131,6 +131,29 @@ void OQS_SHA3_shake128_x4_inc_ctx_clone(
  */
 void OQS_SHA3_shake128_x4_inc_ctx_reset(OQS_SHA3_shake128_x4_inc_ctx *state);
 
+/**
+ * \brief Resets the state for the four-way parallel incremental SHAKE-128 API,
+ * absorbs four complete inputs of equal length and finalizes them, ready for
+ * OQS_SHA3_shake128_x4_inc_squeeze.
+ *
+ * Equivalent to reset, absorb and finalize, but inputs shorter than one block
+ * (OQS_SHA3_SHAKE128_RATE bytes) are padded and absorbed in a single step.
+ *
+ * \param state The function state; must be initialized
+ * \param in0 input buffer for the first instance
+ * \param in1 input buffer for the second instance
+ * \param in2 input buffer for the third instance
+ * \param in3 input buffer for the fourth instance
+ * \param inlen length of each input buffer
+ */
+void OQS_SHA3_shake128_x4_absorb_once(
+    OQS_SHA3_shake128_x4_inc_ctx *state,
+    const uint8_t *in0,
+    const uint8_t *in1,
+    const uint8_t *in2,
+    const uint8_t *in3,
+    size_t inlen);
+
 /* SHAKE256 */
 
 /**
@@ -245,6 +268,29 @@ void OQS_SHA3_shake256_x4_inc_ctx_clone(
  */
 void OQS_SHA3_shake256_x4_inc_ctx_reset(OQS_SHA3_shake256_x4_inc_ctx *state);
 
+/**
+ * \brief Resets the state for the four-way parallel incremental SHAKE-256 API,
+ * absorbs four complete inputs of equal length and finalizes them, ready for
+ * OQS_SHA3_shake256_x4_inc_squeeze.
+ *
+ * Equivalent to reset, absorb and finalize, but inputs shorter than one block
+ * (OQS_SHA3_SHAKE256_RATE bytes) are padded and absorbed in a single step.
+ *
+ * \param state The function state; must be initialized
+ * \param in0 input buffer for the first instance
+ * \param in1 input buffer for the second instance
+ * \param in2 input buffer for the third instance
+ * \param in3 input buffer for the fourth instance
+ * \param inlen length of each input buffer
+ */
+void OQS_SHA3_shake256_x4_absorb_once(
+    OQS_SHA3_shake256_x4_inc_ctx *state,
+    const uint8_t *in0,
+    const uint8_t *in1,
+    const uint8_t *in2,
+    const uint8_t *in3,
+    size_t inlen);
+
 #if defined(__cplusplus)
 } // extern "C"
 #endif
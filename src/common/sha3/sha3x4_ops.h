@@ -170,6 +170,9 @@ struct OQS_SHA3_x4_callbacks {
  * This function may be called before OQS_init to switch the
  * cryptographic provider for 4-parallel SHA3 operations. If it is not
  * called, the default provider determined at build time will be used.
+ * With callbacks other than the built-in ones, OQS_SHA3_shake128_x4_absorb_once
+ * and its SHAKE256 counterpart are served by the reset, absorb and finalize
+ * callbacks.
  *
  * @param new_callbacks Callback functions defined in OQS_SHA3_x4_callbacks struct
  */
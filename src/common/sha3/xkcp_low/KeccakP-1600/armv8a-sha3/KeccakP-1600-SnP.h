@@ -0,0 +1,46 @@
+/*
+ * Keccak-p[1600] state-and-permutation interface for AArch64 with the ARMv8.2
+ * SHA3 extension.  The state is 25 plain (non-complemented) little-endian
+ * 64-bit lanes.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef _KeccakP_1600_SnP_h_
+#define _KeccakP_1600_SnP_h_
+
+#include <stddef.h>
+
+#define KeccakP1600_implementation_armv8a_sha3 "AArch64 implementation using the ARMv8.2 SHA3 extension"
+#define KeccakP1600_stateSizeInBytes_armv8a_sha3 200
+#define KeccakP1600_stateAlignment_armv8a_sha3 16
+
+#if defined(ADD_SYMBOL_SUFFIX)
+#define KECCAK_SYMBOL_SUFFIX armv8a_sha3
+#define KECCAK_IMPL_NAMESPACE(x) x##_armv8a_sha3
+#else
+#define KECCAK_IMPL_NAMESPACE(x) x
+#define KeccakP1600_implementation KeccakP1600_implementation_armv8a_sha3
+#define KeccakP1600_stateSizeInBytes KeccakP1600_stateSizeInBytes_armv8a_sha3
+#define KeccakP1600_stateAlignment KeccakP1600_stateAlignment_armv8a_sha3
+#endif
+
+#define KeccakP1600_Initialize KECCAK_IMPL_NAMESPACE(KeccakP1600_Initialize)
+void KeccakP1600_Initialize(void *state);
+
+#define KeccakP1600_AddByte KECCAK_IMPL_NAMESPACE(KeccakP1600_AddByte)
+void KeccakP1600_AddByte(void *state, unsigned char data, unsigned int offset);
+
+#define KeccakP1600_AddBytes KECCAK_IMPL_NAMESPACE(KeccakP1600_AddBytes)
+void KeccakP1600_AddBytes(void *state, const unsigned char *data, unsigned int offset, unsigned int length);
+
+#define KeccakP1600_Permute_24rounds KECCAK_IMPL_NAMESPACE(KeccakP1600_Permute_24rounds)
+void KeccakP1600_Permute_24rounds(void *state);
+
+#define KeccakP1600_ExtractBytes KECCAK_IMPL_NAMESPACE(KeccakP1600_ExtractBytes)
+void KeccakP1600_ExtractBytes(const void *state, unsigned char *data, unsigned int offset, unsigned int length);
+
+#define KeccakF1600_FastLoop_Absorb KECCAK_IMPL_NAMESPACE(KeccakF1600_FastLoop_Absorb)
+size_t KeccakF1600_FastLoop_Absorb(void *state, unsigned int laneCount, const unsigned char *data, size_t dataByteLen);
+
+#endif
@@ -0,0 +1,82 @@
+/*
+ * Keccak-p[1600] on AArch64 with the ARMv8.2 SHA3 extension.
+ *
+ * The SHA3 instructions only operate on full vector registers, so a single
+ * state runs through the two-way permutation with the second lane unused.
+ * Absorbing full blocks keeps the state in registers across permutations.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "KeccakP-1600-SnP.h"
+#include "KeccakP-1600-x2-armv8a-sha3.h"
+
+#if defined(__ARM_BIG_ENDIAN)
+#error "KeccakP-1600-armv8a-sha3.c assumes a little-endian target"
+#endif
+
+void KeccakP1600_Initialize(void *state) {
+	memset(state, 0, 200);
+}
+
+void KeccakP1600_AddByte(void *state, unsigned char data, unsigned int offset) {
+	((unsigned char *)state)[offset] ^= data;
+}
+
+void KeccakP1600_AddBytes(void *state, const unsigned char *data, unsigned int offset, unsigned int length) {
+	unsigned char *s = (unsigned char *)state + offset;
+	unsigned int i;
+
+	for (i = 0; i < length; i++) {
+		s[i] ^= data[i];
+	}
+}
+
+void KeccakP1600_ExtractBytes(const void *state, unsigned char *data, unsigned int offset, unsigned int length) {
+	memcpy(data, (const unsigned char *)state + offset, length);
+}
+
+static inline void load_state(uint64x2_t v[25], const uint64_t *s) {
+	int i;
+
+	for (i = 0; i < 25; i++) {
+		v[i] = vdupq_n_u64(s[i]);
+	}
+}
+
+static inline void store_state(uint64_t *s, const uint64x2_t v[25]) {
+	int i;
+
+	for (i = 0; i < 25; i++) {
+		s[i] = vgetq_lane_u64(v[i], 0);
+	}
+}
+
+void KeccakP1600_Permute_24rounds(void *state) {
+	uint64x2_t v[25];
+
+	load_state(v, (const uint64_t *)state);
+	KeccakP1600_x2_Permute_24rounds(v);
+	store_state((uint64_t *)state, v);
+}
+
+size_t KeccakF1600_FastLoop_Absorb(void *state, unsigned int laneCount, const unsigned char *data, size_t dataByteLen) {
+	size_t originalDataByteLen = dataByteLen;
+	uint64x2_t v[25];
+	unsigned int i;
+
+	load_state(v, (const uint64_t *)state);
+	while (dataByteLen >= laneCount * 8) {
+		for (i = 0; i < laneCount; i++) {
+			v[i] = veorq_u64(v[i], vcombine_u64(vreinterpret_u64_u8(vld1_u8(data + 8 * i)), vdup_n_u64(0)));
+		}
+		KeccakP1600_x2_Permute_24rounds(v);
+		data += laneCount * 8;
+		dataByteLen -= laneCount * 8;
+	}
+	store_state((uint64_t *)state, v);
+	return originalDataByteLen - dataByteLen;
+}
@@ -0,0 +1,129 @@
+/*
+ * Two-way Keccak-f[1600] on AArch64 with the ARMv8.2 SHA3 extension.
+ *
+ * Each uint64x2_t holds the same lane of two independent states.  A round is
+ * built from the four SHA3 instructions:
+ *
+ *   theta:  C[x]    = EOR3(EOR3(A[x,0], A[x,1], A[x,2]), A[x,3], A[x,4])
+ *           D[x]    = RAX1(C[x-1], C[x+1])            = C[x-1] ^ ROL(C[x+1], 1)
+ *   rho,pi: B[y,2x+3y] = XAR(A[x,y], D[x], 64 - r[x,y]) = ROL(A[x,y] ^ D[x], r[x,y])
+ *   chi:    A[x,y]  = BCAX(B[x,y], B[x+2,y], B[x+1,y]) = B[x,y] ^ (~B[x+1,y] & B[x+2,y])
+ *
+ * so that theta, rho, pi and chi of one round take 5 + 5 + 25 + 25 instructions
+ * on both states at once.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef KECCAKP_1600_X2_ARMV8A_SHA3_H
+#define KECCAKP_1600_X2_ARMV8A_SHA3_H
+
+#include <arm_neon.h>
+#include <stdint.h>
+
+#if !defined(__ARM_FEATURE_SHA3)
+#error "KeccakP-1600-x2-armv8a-sha3.h requires the ARMv8.2 SHA3 extension (-march=armv8.2-a+sha3)"
+#endif
+
+static const uint64_t KeccakP1600_x2_RoundConstants[24] = {
+	0x0000000000000001ULL, 0x0000000000008082ULL, 0x800000000000808aULL,
+	0x8000000080008000ULL, 0x000000000000808bULL, 0x0000000080000001ULL,
+	0x8000000080008081ULL, 0x8000000000008009ULL, 0x000000000000008aULL,
+	0x0000000000000088ULL, 0x0000000080008009ULL, 0x000000008000000aULL,
+	0x000000008000808bULL, 0x800000000000008bULL, 0x8000000000008089ULL,
+	0x8000000000008003ULL, 0x8000000000008002ULL, 0x8000000000000080ULL,
+	0x000000000000800aULL, 0x800000008000000aULL, 0x8000000080008081ULL,
+	0x8000000000008080ULL, 0x0000000080000001ULL, 0x8000000080008008ULL
+};
+
+/* ROL(a ^ d, r) for a constant 0 < r < 64 */
+#define KeccakP1600_x2_XAR(a, d, r) vxarq_u64((a), (d), 64 - (r))
+
+/* Chi on the row b0..b4, written to a0..a4 */
+#define KeccakP1600_x2_Chi(a0, a1, a2, a3, a4, b0, b1, b2, b3, b4) \
+	do { \
+		a0 = vbcaxq_u64(b0, b2, b1); \
+		a1 = vbcaxq_u64(b1, b3, b2); \
+		a2 = vbcaxq_u64(b2, b4, b3); \
+		a3 = vbcaxq_u64(b3, b0, b4); \
+		a4 = vbcaxq_u64(b4, b1, b0); \
+	} while (0)
+
+/**
+ * Applies the 24-round Keccak-f[1600] permutation to two states.  `s` holds 25
+ * vectors, lane x + 5y of both states in s[x + 5y].
+ */
+static inline void KeccakP1600_x2_Permute_24rounds(uint64x2_t *s) {
+	uint64x2_t a00 = s[0], a01 = s[1], a02 = s[2], a03 = s[3], a04 = s[4];
+	uint64x2_t a05 = s[5], a06 = s[6], a07 = s[7], a08 = s[8], a09 = s[9];
+	uint64x2_t a10 = s[10], a11 = s[11], a12 = s[12], a13 = s[13], a14 = s[14];
+	uint64x2_t a15 = s[15], a16 = s[16], a17 = s[17], a18 = s[18], a19 = s[19];
+	uint64x2_t a20 = s[20], a21 = s[21], a22 = s[22], a23 = s[23], a24 = s[24];
+	uint64x2_t c0, c1, c2, c3, c4, d0, d1, d2, d3, d4;
+	uint64x2_t b00, b01, b02, b03, b04, b05, b06, b07, b08, b09;
+	uint64x2_t b10, b11, b12, b13, b14, b15, b16, b17, b18, b19;
+	uint64x2_t b20, b21, b22, b23, b24;
+	int round;
+
+	for (round = 0; round < 24; round++) {
+		/* theta */
+		c0 = veor3q_u64(veor3q_u64(a00, a05, a10), a15, a20);
+		c1 = veor3q_u64(veor3q_u64(a01, a06, a11), a16, a21);
+		c2 = veor3q_u64(veor3q_u64(a02, a07, a12), a17, a22);
+		c3 = veor3q_u64(veor3q_u64(a03, a08, a13), a18, a23);
+		c4 = veor3q_u64(veor3q_u64(a04, a09, a14), a19, a24);
+		d0 = vrax1q_u64(c4, c1);
+		d1 = vrax1q_u64(c0, c2);
+		d2 = vrax1q_u64(c1, c3);
+		d3 = vrax1q_u64(c2, c4);
+		d4 = vrax1q_u64(c3, c0);
+
+		/* theta, rho and pi: B[y, 2x + 3y] = ROL(A[x, y] ^ D[x], r[x, y]) */
+		b00 = veorq_u64(a00, d0);
+		b10 = KeccakP1600_x2_XAR(a01, d1, 1);
+		b20 = KeccakP1600_x2_XAR(a02, d2, 62);
+		b05 = KeccakP1600_x2_XAR(a03, d3, 28);
+		b15 = KeccakP1600_x2_XAR(a04, d4, 27);
+		b16 = KeccakP1600_x2_XAR(a05, d0, 36);
+		b01 = KeccakP1600_x2_XAR(a06, d1, 44);
+		b11 = KeccakP1600_x2_XAR(a07, d2, 6);
+		b21 = KeccakP1600_x2_XAR(a08, d3, 55);
+		b06 = KeccakP1600_x2_XAR(a09, d4, 20);
+		b07 = KeccakP1600_x2_XAR(a10, d0, 3);
+		b17 = KeccakP1600_x2_XAR(a11, d1, 10);
+		b02 = KeccakP1600_x2_XAR(a12, d2, 43);
+		b12 = KeccakP1600_x2_XAR(a13, d3, 25);
+		b22 = KeccakP1600_x2_XAR(a14, d4, 39);
+		b23 = KeccakP1600_x2_XAR(a15, d0, 41);
+		b08 = KeccakP1600_x2_XAR(a16, d1, 45);
+		b18 = KeccakP1600_x2_XAR(a17, d2, 15);
+		b03 = KeccakP1600_x2_XAR(a18, d3, 21);
+		b13 = KeccakP1600_x2_XAR(a19, d4, 8);
+		b14 = KeccakP1600_x2_XAR(a20, d0, 18);
+		b24 = KeccakP1600_x2_XAR(a21, d1, 2);
+		b09 = KeccakP1600_x2_XAR(a22, d2, 61);
+		b19 = KeccakP1600_x2_XAR(a23, d3, 56);
+		b04 = KeccakP1600_x2_XAR(a24, d4, 14);
+
+		/* chi */
+		KeccakP1600_x2_Chi(a00, a01, a02, a03, a04, b00, b01, b02, b03, b04);
+		KeccakP1600_x2_Chi(a05, a06, a07, a08, a09, b05, b06, b07, b08, b09);
+		KeccakP1600_x2_Chi(a10, a11, a12, a13, a14, b10, b11, b12, b13, b14);
+		KeccakP1600_x2_Chi(a15, a16, a17, a18, a19, b15, b16, b17, b18, b19);
+		KeccakP1600_x2_Chi(a20, a21, a22, a23, a24, b20, b21, b22, b23, b24);
+
+		/* iota */
+		a00 = veorq_u64(a00, vdupq_n_u64(KeccakP1600_x2_RoundConstants[round]));
+	}
+
+	s[0] = a00, s[1] = a01, s[2] = a02, s[3] = a03, s[4] = a04;
+	s[5] = a05, s[6] = a06, s[7] = a07, s[8] = a08, s[9] = a09;
+	s[10] = a10, s[11] = a11, s[12] = a12, s[13] = a13, s[14] = a14;
+	s[15] = a15, s[16] = a16, s[17] = a17, s[18] = a18, s[19] = a19;
+	s[20] = a20, s[21] = a21, s[22] = a22, s[23] = a23, s[24] = a24;
+}
+
+#undef KeccakP1600_x2_XAR
+#undef KeccakP1600_x2_Chi
+
+#endif // KECCAKP_1600_X2_ARMV8A_SHA3_H
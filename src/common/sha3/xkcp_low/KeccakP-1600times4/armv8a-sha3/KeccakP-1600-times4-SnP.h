@@ -0,0 +1,40 @@
+/*
+ * Four-way Keccak-p[1600] interface for AArch64 with the ARMv8.2 SHA3
+ * extension, run as two two-way permutations.
+ *
+ * The 800-byte state holds instances 0 and 1 in its first half and instances
+ * 2 and 3 in its second half; within a half, lane i of the two instances is
+ * stored as the 16-byte vector at index i.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef _KeccakP_1600_times4_SnP_h_
+#define _KeccakP_1600_times4_SnP_h_
+
+#if defined(ADD_SYMBOL_SUFFIX)
+#define KECCAKTIMES4_NAMESPACE(x) x##_armv8a_sha3
+#else
+#define KECCAKTIMES4_NAMESPACE(x) x
+#endif
+
+#define KeccakP1600times4_implementation    "two-way ARMv8.2 SHA3 extension implementation, twice"
+#define KeccakP1600times4_statesSizeInBytes 800
+#define KeccakP1600times4_statesAlignment   16
+
+#define KeccakP1600times4_InitializeAll KECCAKTIMES4_NAMESPACE(KeccakP1600times4_InitializeAll)
+void KeccakP1600times4_InitializeAll(void *states);
+
+#define KeccakP1600times4_AddByte KECCAKTIMES4_NAMESPACE(KeccakP1600times4_AddByte)
+void KeccakP1600times4_AddByte(void *states, unsigned int instanceIndex, unsigned char data, unsigned int offset);
+
+#define KeccakP1600times4_AddBytes KECCAKTIMES4_NAMESPACE(KeccakP1600times4_AddBytes)
+void KeccakP1600times4_AddBytes(void *states, unsigned int instanceIndex, const unsigned char *data, unsigned int offset, unsigned int length);
+
+#define KeccakP1600times4_PermuteAll_24rounds KECCAKTIMES4_NAMESPACE(KeccakP1600times4_PermuteAll_24rounds)
+void KeccakP1600times4_PermuteAll_24rounds(void *states);
+
+#define KeccakP1600times4_ExtractBytes KECCAKTIMES4_NAMESPACE(KeccakP1600times4_ExtractBytes)
+void KeccakP1600times4_ExtractBytes(const void *states, unsigned int instanceIndex, unsigned char *data, unsigned int offset, unsigned int length);
+
+#endif
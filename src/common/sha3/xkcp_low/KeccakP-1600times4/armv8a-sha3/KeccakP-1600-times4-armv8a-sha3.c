@@ -0,0 +1,54 @@
+/*
+ * Four-way Keccak-p[1600] on AArch64 with the ARMv8.2 SHA3 extension.
+ *
+ * Instances are paired (0, 1) and (2, 3); each pair is permuted with the
+ * two-way permutation, so the four states take two passes instead of the four
+ * of the serial fallback.  See KeccakP-1600-times4-SnP.h for the layout.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "KeccakP-1600-times4-SnP.h"
+#include "KeccakP-1600-x2-armv8a-sha3.h"
+
+#if defined(__ARM_BIG_ENDIAN)
+#error "KeccakP-1600-times4-armv8a-sha3.c assumes a little-endian target"
+#endif
+
+/* Byte `offset` of instance `instanceIndex` */
+#define STATE_BYTE(states, instanceIndex, offset) \
+	((states) + ((instanceIndex) >> 1) * 400 + ((offset) >> 3) * 16 + ((instanceIndex) & 1) * 8 + ((offset) & 7))
+
+void KeccakP1600times4_InitializeAll(void *states) {
+	memset(states, 0, 800);
+}
+
+void KeccakP1600times4_AddByte(void *states, unsigned int instanceIndex, unsigned char data, unsigned int offset) {
+	*STATE_BYTE((unsigned char *)states, instanceIndex, offset) ^= data;
+}
+
+void KeccakP1600times4_AddBytes(void *states, unsigned int instanceIndex, const unsigned char *data, unsigned int offset, unsigned int length) {
+	unsigned int i;
+
+	for (i = 0; i < length; i++) {
+		*STATE_BYTE((unsigned char *)states, instanceIndex, offset + i) ^= data[i];
+	}
+}
+
+void KeccakP1600times4_PermuteAll_24rounds(void *states) {
+	uint64x2_t *s = (uint64x2_t *)states;
+
+	KeccakP1600_x2_Permute_24rounds(s);
+	KeccakP1600_x2_Permute_24rounds(s + 25);
+}
+
+void KeccakP1600times4_ExtractBytes(const void *states, unsigned int instanceIndex, unsigned char *data, unsigned int offset, unsigned int length) {
+	unsigned int i;
+
+	for (i = 0; i < length; i++) {
+		data[i] = *STATE_BYTE((const unsigned char *)states, instanceIndex, offset + i);
+	}
+}
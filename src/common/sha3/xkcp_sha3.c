@@ -8,6 +8,7 @@
 */
 
 #include "sha3.h"
+#include "sha3_absorb_once.h"
 
 #include "xkcp_dispatch.h"
 
@@ -37,7 +38,14 @@ static KeccakPermuteFn *Keccak_Permute_ptr = NULL;
 static KeccakExtractBytesFn *Keccak_ExtractBytes_ptr = NULL;
 static KeccakFastLoopAbsorbFn *Keccak_FastLoopAbsorb_ptr = NULL;
 
+#if defined(OQS_USE_SHA3_ROUTING)
+/* Selected per route by sha3_route.c, which provides sha3_default_callbacks. */
+#define sha3_default_callbacks sha3_xkcp_callbacks
+#define sha3_default_absorb_once_callbacks sha3_xkcp_absorb_once_callbacks
+#endif
+
 extern struct OQS_SHA3_callbacks sha3_default_callbacks;
+extern struct OQS_SHA3_absorb_once_callbacks sha3_default_absorb_once_callbacks;
 
 static void Keccak_Dispatch(void) {
 // TODO: Simplify this when we have a Windows-compatible AVX2 implementation of SHA3
@@ -48,6 +56,9 @@ static void Keccak_Dispatch(void) {
 		extern const struct OQS_SHA3_callbacks sha3_avx512vl_callbacks;
 
 		sha3_default_callbacks = sha3_avx512vl_callbacks;
+		/* The AVX512VL code has no single-block absorb. */
+		sha3_default_absorb_once_callbacks.SHA3_shake128_absorb_once = NULL;
+		sha3_default_absorb_once_callbacks.SHA3_shake256_absorb_once = NULL;
 	}
 #endif
 	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2)) {
@@ -73,6 +84,22 @@ static void Keccak_Dispatch(void) {
 	Keccak_ExtractBytes_ptr = &KeccakP1600_ExtractBytes_plain64;
 	Keccak_FastLoopAbsorb_ptr = &KeccakF1600_FastLoop_Absorb_plain64;
 #endif
+#elif defined(OQS_DIST_ARM64_V8_BUILD) && defined(OQS_ENABLE_SHA3_xkcp_low_armv8a_sha3)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_ARM_SHA3)) {
+		Keccak_Initialize_ptr = &KeccakP1600_Initialize_armv8a_sha3;
+		Keccak_AddByte_ptr = &KeccakP1600_AddByte_armv8a_sha3;
+		Keccak_AddBytes_ptr = &KeccakP1600_AddBytes_armv8a_sha3;
+		Keccak_Permute_ptr = &KeccakP1600_Permute_24rounds_armv8a_sha3;
+		Keccak_ExtractBytes_ptr = &KeccakP1600_ExtractBytes_armv8a_sha3;
+		Keccak_FastLoopAbsorb_ptr = &KeccakF1600_FastLoop_Absorb_armv8a_sha3;
+	} else {
+		Keccak_Initialize_ptr = &KeccakP1600_Initialize_plain64;
+		Keccak_AddByte_ptr = &KeccakP1600_AddByte_plain64;
+		Keccak_AddBytes_ptr = &KeccakP1600_AddBytes_plain64;
+		Keccak_Permute_ptr = &KeccakP1600_Permute_24rounds_plain64;
+		Keccak_ExtractBytes_ptr = &KeccakP1600_ExtractBytes_plain64;
+		Keccak_FastLoopAbsorb_ptr = &KeccakF1600_FastLoop_Absorb_plain64;
+	}
 #else
 	Keccak_Initialize_ptr = &KeccakP1600_Initialize;
 	Keccak_AddByte_ptr = &KeccakP1600_AddByte;
@@ -197,14 +224,61 @@ static void keccak_inc_squeeze(uint8_t *h, size_t outlen,
 	s[25] -= outlen;
 }
 
+/*************************************************
+ * Name:        keccak_absorb_once
+ *
+ * Description: Resets the state, absorbs a complete message and finalizes.
+ *              A message shorter than one block is padded on the stack and
+ *              added to the state with a single full-block AddBytes, which
+ *              the XKCP implementations do lane by lane.
+ *
+ * Arguments:   - uint64_t *s: pointer to output incremental state
+ *              - uint32_t r: rate in bytes (e.g., 168 for SHAKE128)
+ *              - const uint8_t *m: pointer to input to be absorbed into s
+ *              - size_t mlen: length of input in bytes
+ *              - uint8_t p: domain-separation byte for different
+ *                                 Keccak-derived functions
+ **************************************************/
+static void keccak_absorb_once(uint64_t *s, uint32_t r, const uint8_t *m,
+                               size_t mlen, uint8_t p) {
+	uint64_t block[OQS_SHA3_SHAKE128_RATE / 8];
+	uint8_t *b = (uint8_t *)block;
+
+	keccak_inc_reset(s);
+	if (mlen < r) {
+		memcpy(b, m, mlen);
+		memset(b + mlen, 0, r - mlen);
+		b[mlen] ^= p;
+		b[r - 1] ^= 0x80;
+		(*Keccak_AddBytes_ptr)(s, b, 0, r);
+		s[25] = 0;
+	} else {
+		keccak_inc_absorb(s, r, m, mlen);
+		keccak_inc_finalize(s, r, p);
+	}
+}
+
+/*
+ * The one-shot functions keep their state on the stack instead of allocating
+ * an incremental context.
+ */
+#define KECCAK_STACK_STATE(name) \
+	uint64_t name##_buf[(KECCAK_CTX_BYTES + KECCAK_CTX_ALIGNMENT) / sizeof(uint64_t)]; \
+	uint64_t *name = (uint64_t *)(((uintptr_t)name##_buf + KECCAK_CTX_ALIGNMENT - 1) & ~(uintptr_t)(KECCAK_CTX_ALIGNMENT - 1))
+
+static void keccak_oneshot(uint8_t *h, size_t outlen, uint32_t r,
+                           const uint8_t *m, size_t mlen, uint8_t p) {
+	KECCAK_STACK_STATE(s);
+
+	keccak_absorb_once(s, r, m, mlen, p);
+	keccak_inc_squeeze(h, outlen, s, r);
+	OQS_MEM_cleanse(s, KECCAK_CTX_BYTES);
+}
+
 /* SHA3-256 */
 
 static void SHA3_sha3_256(uint8_t *output, const uint8_t *input, size_t inlen) {
-	OQS_SHA3_sha3_256_inc_ctx s;
-	OQS_SHA3_sha3_256_inc_init(&s);
-	OQS_SHA3_sha3_256_inc_absorb(&s, input, inlen);
-	OQS_SHA3_sha3_256_inc_finalize(output, &s);
-	OQS_SHA3_sha3_256_inc_ctx_release(&s);
+	keccak_oneshot(output, 32, OQS_SHA3_SHA3_256_RATE, input, inlen, 0x06);
 }
 
 static void SHA3_sha3_256_inc_init(OQS_SHA3_sha3_256_inc_ctx *state) {
@@ -238,11 +312,7 @@ static void SHA3_sha3_256_inc_ctx_reset(OQS_SHA3_sha3_256_inc_ctx *state) {
 /* SHA3-384 */
 
 static void SHA3_sha3_384(uint8_t *output, const uint8_t *input, size_t inlen) {
-	OQS_SHA3_sha3_384_inc_ctx s;
-	OQS_SHA3_sha3_384_inc_init(&s);
-	OQS_SHA3_sha3_384_inc_absorb(&s, input, inlen);
-	OQS_SHA3_sha3_384_inc_finalize(output, &s);
-	OQS_SHA3_sha3_384_inc_ctx_release(&s);
+	keccak_oneshot(output, 48, OQS_SHA3_SHA3_384_RATE, input, inlen, 0x06);
 }
 
 static void SHA3_sha3_384_inc_init(OQS_SHA3_sha3_384_inc_ctx *state) {
@@ -274,11 +344,7 @@ static void SHA3_sha3_384_inc_ctx_reset(OQS_SHA3_sha3_384_inc_ctx *state) {
 /* SHA3-512 */
 
 static void SHA3_sha3_512(uint8_t *output, const uint8_t *input, size_t inlen) {
-	OQS_SHA3_sha3_512_inc_ctx s;
-	OQS_SHA3_sha3_512_inc_init(&s);
-	OQS_SHA3_sha3_512_inc_absorb(&s, input, inlen);
-	OQS_SHA3_sha3_512_inc_finalize(output, &s);
-	OQS_SHA3_sha3_512_inc_ctx_release(&s);
+	keccak_oneshot(output, 64, OQS_SHA3_SHA3_512_RATE, input, inlen, 0x06);
 }
 
 static void SHA3_sha3_512_inc_init(OQS_SHA3_sha3_512_inc_ctx *state) {
@@ -311,12 +377,7 @@ static void SHA3_sha3_512_inc_ctx_reset(OQS_SHA3_sha3_512_inc_ctx *state) {
 /* SHAKE128 */
 
 static void SHA3_shake128(uint8_t *output, size_t outlen, const uint8_t *input, size_t inlen) {
-	OQS_SHA3_shake128_inc_ctx s;
-	OQS_SHA3_shake128_inc_init(&s);
-	OQS_SHA3_shake128_inc_absorb(&s, input, inlen);
-	OQS_SHA3_shake128_inc_finalize(&s);
-	OQS_SHA3_shake128_inc_squeeze(output, outlen, &s);
-	OQS_SHA3_shake128_inc_ctx_release(&s);
+	keccak_oneshot(output, outlen, OQS_SHA3_SHAKE128_RATE, input, inlen, 0x1F);
 }
 
 /* SHAKE128 incremental */
@@ -351,15 +412,14 @@ static void SHA3_shake128_inc_ctx_reset(OQS_SHA3_shake128_inc_ctx *state) {
 	keccak_inc_reset((uint64_t *)state->ctx);
 }
 
+static void SHA3_shake128_absorb_once(OQS_SHA3_shake128_inc_ctx *state, const uint8_t *input, size_t inlen) {
+	keccak_absorb_once((uint64_t *)state->ctx, OQS_SHA3_SHAKE128_RATE, input, inlen, 0x1F);
+}
+
 /* SHAKE256 */
 
 static void SHA3_shake256(uint8_t *output, size_t outlen, const uint8_t *input, size_t inlen) {
-	OQS_SHA3_shake256_inc_ctx s;
-	OQS_SHA3_shake256_inc_init(&s);
-	OQS_SHA3_shake256_inc_absorb(&s, input, inlen);
-	OQS_SHA3_shake256_inc_finalize(&s);
-	OQS_SHA3_shake256_inc_squeeze(output, outlen, &s);
-	OQS_SHA3_shake256_inc_ctx_release(&s);
+	keccak_oneshot(output, outlen, OQS_SHA3_SHAKE256_RATE, input, inlen, 0x1F);
 }
 
 /* SHAKE256 incremental */
@@ -394,6 +454,10 @@ static void SHA3_shake256_inc_ctx_reset(OQS_SHA3_shake256_inc_ctx *state) {
 	keccak_inc_reset((uint64_t *)state->ctx);
 }
 
+static void SHA3_shake256_absorb_once(OQS_SHA3_shake256_inc_ctx *state, const uint8_t *input, size_t inlen) {
+	keccak_absorb_once((uint64_t *)state->ctx, OQS_SHA3_SHAKE256_RATE, input, inlen, 0x1F);
+}
+
 struct OQS_SHA3_callbacks sha3_default_callbacks = {
 	SHA3_sha3_256,
 	SHA3_sha3_256_inc_init,
@@ -433,3 +497,8 @@ struct OQS_SHA3_callbacks sha3_default_callbacks = {
 	SHA3_shake256_inc_ctx_clone,
 	SHA3_shake256_inc_ctx_reset,
 };
+
+struct OQS_SHA3_absorb_once_callbacks sha3_default_absorb_once_callbacks = {
+	SHA3_shake128_absorb_once,
+	SHA3_shake256_absorb_once,
+};
@@ -2,6 +2,7 @@
 
 #include "sha3.h"
 #include "sha3x4.h"
+#include "sha3_absorb_once.h"
 
 #include "xkcp_dispatch.h"
 
@@ -31,7 +32,14 @@ static KeccakX4AddBytesFn *Keccak_X4_AddBytes_ptr = NULL;
 static KeccakX4PermuteFn *Keccak_X4_Permute_ptr = NULL;
 static KeccakX4ExtractBytesFn *Keccak_X4_ExtractBytes_ptr = NULL;
 
+#if defined(OQS_USE_SHA3_ROUTING)
+/* Selected per route by sha3_route.c, which provides sha3_x4_default_callbacks. */
+#define sha3_x4_default_callbacks sha3_x4_xkcp_callbacks
+#define sha3_x4_default_absorb_once_callbacks sha3_x4_xkcp_absorb_once_callbacks
+#endif
+
 extern struct OQS_SHA3_x4_callbacks sha3_x4_default_callbacks;
+extern struct OQS_SHA3_x4_absorb_once_callbacks sha3_x4_default_absorb_once_callbacks;
 
 static void Keccak_X4_Dispatch(void) {
 // TODO: Simplify this when we have a Windows-compatible AVX2 implementation of SHA3
@@ -42,6 +50,9 @@ static void Keccak_X4_Dispatch(void) {
 		extern const struct OQS_SHA3_x4_callbacks sha3_x4_avx512vl_callbacks;
 
 		sha3_x4_default_callbacks = sha3_x4_avx512vl_callbacks;
+		/* The AVX512VL code has no single-block absorb. */
+		sha3_x4_default_absorb_once_callbacks.SHA3_shake128_x4_absorb_once = NULL;
+		sha3_x4_default_absorb_once_callbacks.SHA3_shake256_x4_absorb_once = NULL;
 	}
 #endif
 	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2)) {
@@ -64,6 +75,20 @@ static void Keccak_X4_Dispatch(void) {
 	Keccak_X4_Permute_ptr = &KeccakP1600times4_PermuteAll_24rounds_serial;
 	Keccak_X4_ExtractBytes_ptr = &KeccakP1600times4_ExtractBytes_serial;
 #endif
+#elif defined(OQS_DIST_ARM64_V8_BUILD) && defined(OQS_ENABLE_SHA3_xkcp_low_armv8a_sha3)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_ARM_SHA3)) {
+		Keccak_X4_Initialize_ptr = &KeccakP1600times4_InitializeAll_armv8a_sha3;
+		Keccak_X4_AddByte_ptr = &KeccakP1600times4_AddByte_armv8a_sha3;
+		Keccak_X4_AddBytes_ptr = &KeccakP1600times4_AddBytes_armv8a_sha3;
+		Keccak_X4_Permute_ptr = &KeccakP1600times4_PermuteAll_24rounds_armv8a_sha3;
+		Keccak_X4_ExtractBytes_ptr = &KeccakP1600times4_ExtractBytes_armv8a_sha3;
+	} else {
+		Keccak_X4_Initialize_ptr = &KeccakP1600times4_InitializeAll_serial;
+		Keccak_X4_AddByte_ptr = &KeccakP1600times4_AddByte_serial;
+		Keccak_X4_AddBytes_ptr = &KeccakP1600times4_AddBytes_serial;
+		Keccak_X4_Permute_ptr = &KeccakP1600times4_PermuteAll_24rounds_serial;
+		Keccak_X4_ExtractBytes_ptr = &KeccakP1600times4_ExtractBytes_serial;
+	}
 #else
 	Keccak_X4_Initialize_ptr = &KeccakP1600times4_InitializeAll;
 	Keccak_X4_AddByte_ptr = &KeccakP1600times4_AddByte;
@@ -162,15 +187,51 @@ static void keccak_x4_inc_squeeze(uint8_t *out0, uint8_t *out1, uint8_t *out2, u
 	s[100] -= outlen;
 }
 
+/*
+ * Resets the state, absorbs four complete messages and finalizes.  Messages
+ * shorter than one block are padded on the stack and added to each instance
+ * with a single full-block AddBytes.
+ */
+static void keccak_x4_absorb_once(uint64_t *s, uint32_t r,
+                                  const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3,
+                                  size_t inlen, uint8_t p) {
+	const uint8_t *in[4] = {in0, in1, in2, in3};
+	uint64_t block[OQS_SHA3_SHAKE128_RATE / 8];
+	uint8_t *b = (uint8_t *)block;
+	unsigned int i;
+
+	keccak_x4_inc_reset(s);
+	if (inlen < r) {
+		memset(b + inlen, 0, r - inlen);
+		b[r - 1] = 0x80;
+		for (i = 0; i < 4; i++) {
+			memcpy(b, in[i], inlen);
+			b[inlen] = (inlen == r - 1) ? (p | 0x80) : p;
+			(*Keccak_X4_AddBytes_ptr)(s, i, b, 0, r);
+		}
+		s[100] = 0;
+	} else {
+		keccak_x4_inc_absorb(s, r, in0, in1, in2, in3, inlen);
+		keccak_x4_inc_finalize(s, r, p);
+	}
+}
+
+/* The one-shot functions keep their state on the stack. */
+static void keccak_x4_oneshot(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3, size_t outlen, uint32_t r,
+                              const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3,
+                              size_t inlen, uint8_t p) {
+	uint64_t buf[(KECCAK_X4_CTX_BYTES + KECCAK_X4_CTX_ALIGNMENT) / sizeof(uint64_t)];
+	uint64_t *s = (uint64_t *)(((uintptr_t)buf + KECCAK_X4_CTX_ALIGNMENT - 1) & ~(uintptr_t)(KECCAK_X4_CTX_ALIGNMENT - 1));
+
+	keccak_x4_absorb_once(s, r, in0, in1, in2, in3, inlen, p);
+	keccak_x4_inc_squeeze(out0, out1, out2, out3, outlen, s, r);
+	OQS_MEM_cleanse(s, KECCAK_X4_CTX_BYTES);
+}
+
 /********** SHAKE128 ***********/
 
 static void SHA3_shake128_x4(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3, size_t outlen, const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3, size_t inlen) {
-	OQS_SHA3_shake128_x4_inc_ctx s;
-	OQS_SHA3_shake128_x4_inc_init(&s);
-	OQS_SHA3_shake128_x4_inc_absorb(&s, in0, in1, in2, in3, inlen);
-	OQS_SHA3_shake128_x4_inc_finalize(&s);
-	OQS_SHA3_shake128_x4_inc_squeeze(out0, out1, out2, out3, outlen, &s);
-	OQS_SHA3_shake128_x4_inc_ctx_release(&s);
+	keccak_x4_oneshot(out0, out1, out2, out3, outlen, OQS_SHA3_SHAKE128_RATE, in0, in1, in2, in3, inlen, 0x1F);
 }
 
 /* SHAKE128 incremental */
@@ -204,15 +265,14 @@ static void SHA3_shake128_x4_inc_ctx_reset(OQS_SHA3_shake128_x4_inc_ctx *state)
 	keccak_x4_inc_reset((uint64_t *)state->ctx);
 }
 
+static void SHA3_shake128_x4_absorb_once(OQS_SHA3_shake128_x4_inc_ctx *state, const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3, size_t inlen) {
+	keccak_x4_absorb_once((uint64_t *)state->ctx, OQS_SHA3_SHAKE128_RATE, in0, in1, in2, in3, inlen, 0x1F);
+}
+
 /********** SHAKE256 ***********/
 
 static void SHA3_shake256_x4(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3, size_t outlen, const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3, size_t inlen) {
-	OQS_SHA3_shake256_x4_inc_ctx s;
-	OQS_SHA3_shake256_x4_inc_init(&s);
-	OQS_SHA3_shake256_x4_inc_absorb(&s, in0, in1, in2, in3, inlen);
-	OQS_SHA3_shake256_x4_inc_finalize(&s);
-	OQS_SHA3_shake256_x4_inc_squeeze(out0, out1, out2, out3, outlen, &s);
-	OQS_SHA3_shake256_x4_inc_ctx_release(&s);
+	keccak_x4_oneshot(out0, out1, out2, out3, outlen, OQS_SHA3_SHAKE256_RATE, in0, in1, in2, in3, inlen, 0x1F);
 }
 
 /* SHAKE256 incremental */
@@ -247,6 +307,10 @@ static void SHA3_shake256_x4_inc_ctx_reset(OQS_SHA3_shake256_x4_inc_ctx *state)
 	keccak_x4_inc_reset((uint64_t *)state->ctx);
 }
 
+static void SHA3_shake256_x4_absorb_once(OQS_SHA3_shake256_x4_inc_ctx *state, const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3, size_t inlen) {
+	keccak_x4_absorb_once((uint64_t *)state->ctx, OQS_SHA3_SHAKE256_RATE, in0, in1, in2, in3, inlen, 0x1F);
+}
+
 struct OQS_SHA3_x4_callbacks sha3_x4_default_callbacks = {
 	SHA3_shake128_x4,
 	SHA3_shake128_x4_inc_init,
@@ -265,3 +329,8 @@ struct OQS_SHA3_x4_callbacks sha3_x4_default_callbacks = {
 	SHA3_shake256_x4_inc_ctx_clone,
 	SHA3_shake256_x4_inc_ctx_reset,
 };
+
+struct OQS_SHA3_x4_absorb_once_callbacks sha3_x4_default_absorb_once_callbacks = {
+	SHA3_shake128_x4_absorb_once,
+	SHA3_shake256_x4_absorb_once,
+};
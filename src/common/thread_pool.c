@@ -0,0 +1,115 @@
+// SPDX-License-Identifier: MIT
+
+#include <pthread.h>
+#include <stddef.h>
+
+#include "thread_pool.h"
+
+static pthread_mutex_t pool_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t work_ready = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t work_done = PTHREAD_COND_INITIALIZER;
+/* Held by the caller the pool is serving; other callers run their tasks alone. */
+static pthread_mutex_t run_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static pthread_t workers[OQS_THREAD_POOL_WORKERS];
+static size_t num_workers = 0;
+static int started = 0;
+static int stopping = 0;
+
+/* The current job; all protected by pool_lock. */
+static void (*job_task)(void *arg, size_t i) = NULL;
+static void *job_arg = NULL;
+static size_t job_ntasks = 0;
+static size_t job_next = 0;    /* next task to hand out */
+static size_t job_running = 0; /* tasks handed out and not finished yet */
+static unsigned long job_id = 0;
+
+/* Runs tasks of the current job until none is left. Called with pool_lock held. */
+static void run_tasks(void) {
+	void (*task)(void *, size_t) = job_task;
+	void *arg = job_arg;
+
+	while (job_next < job_ntasks) {
+		size_t i = job_next++;
+
+		job_running++;
+		pthread_mutex_unlock(&pool_lock);
+		task(arg, i);
+		pthread_mutex_lock(&pool_lock);
+		job_running--;
+	}
+	if (job_running == 0) {
+		pthread_cond_signal(&work_done);
+	}
+}
+
+static void *worker_main(void *arg) {
+	unsigned long seen;
+
+	(void)arg;
+	pthread_mutex_lock(&pool_lock);
+	seen = job_id;
+	for (;;) {
+		while (!stopping && job_id == seen) {
+			pthread_cond_wait(&work_ready, &pool_lock);
+		}
+		if (stopping) {
+			break;
+		}
+		seen = job_id;
+		run_tasks();
+	}
+	pthread_mutex_unlock(&pool_lock);
+	return NULL;
+}
+
+void OQS_THREAD_POOL_run(void (*task)(void *arg, size_t i), void *arg, size_t ntasks) {
+	if (pthread_mutex_trylock(&run_lock) != 0) {
+		for (size_t i = 0; i < ntasks; i++) {
+			task(arg, i);
+		}
+		return;
+	}
+
+	pthread_mutex_lock(&pool_lock);
+	if (!started) {
+		started = 1;
+		while (num_workers < OQS_THREAD_POOL_WORKERS &&
+		        pthread_create(&workers[num_workers], NULL, worker_main, NULL) == 0) {
+			num_workers++;
+		}
+	}
+	job_task = task;
+	job_arg = arg;
+	job_ntasks = ntasks;
+	job_next = 0;
+	job_running = 0;
+	job_id++;
+	pthread_cond_broadcast(&work_ready);
+
+	run_tasks();
+	while (job_next < job_ntasks || job_running > 0) {
+		pthread_cond_wait(&work_done, &pool_lock);
+	}
+	job_task = NULL;
+	job_arg = NULL;
+	pthread_mutex_unlock(&pool_lock);
+	pthread_mutex_unlock(&run_lock);
+}
+
+void OQS_THREAD_POOL_destroy(void) {
+	pthread_mutex_lock(&pool_lock);
+	stopping = 1;
+	pthread_cond_broadcast(&work_ready);
+	pthread_mutex_unlock(&pool_lock);
+
+	for (size_t i = 0; i < num_workers; i++) {
+		pthread_join(workers[i], NULL);
+	}
+
+	pthread_mutex_lock(&pool_lock);
+	num_workers = 0;
+	started = 0;
+	stopping = 0;
+	pthread_mutex_unlock(&pool_lock);
+}
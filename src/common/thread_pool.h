@@ -0,0 +1,29 @@
+// SPDX-License-Identifier: MIT
+
+/*
+ * Internal pool of persistent worker threads for splitting one operation
+ * into a few independent tasks. Not installed; only built with
+ * OQS_USE_PTHREADS.
+ *
+ * The workers are started on first use and stopped by OQS_destroy(). The
+ * calling thread always takes part and runs every task no worker has picked
+ * up, so OQS_THREAD_POOL_run() completes even if no worker could be started,
+ * and a caller that finds the pool busy with another call runs its tasks by
+ * itself rather than waiting.
+ */
+
+#ifndef OQS_THREAD_POOL_H
+#define OQS_THREAD_POOL_H
+
+#include <stddef.h>
+
+/* Number of worker threads; with the caller, up to this many + 1 tasks run at once. */
+#define OQS_THREAD_POOL_WORKERS 3
+
+/* Runs task(arg, i) for i = 0, ..., ntasks - 1 and returns when all have finished. */
+void OQS_THREAD_POOL_run(void (*task)(void *arg, size_t i), void *arg, size_t ntasks);
+
+/* Stops the workers. No call to OQS_THREAD_POOL_run() may be in progress. */
+void OQS_THREAD_POOL_destroy(void);
+
+#endif
@@ -0,0 +1,160 @@
+// SPDX-License-Identifier: MIT
+
+#include <string.h>
+
+#include <oqs/oqs.h>
+
+/*
+ * The warm-up keys are thrown away, so they come from a fixed-seed generator
+ * (splitmix64) installed as the calling thread's randombytes source. Drawing
+ * from the process-wide RNG instead would make a warm-up shift the output of
+ * a deterministic RNG installed by the application, and would pay for system
+ * calls or DRBG locking that the warm-up does not need.
+ *
+ * Embedded builds have no per-thread sources. Swapping the process-wide
+ * source instead would hand the fixed-seed output to any other task that
+ * draws randomness during the warm-up, so there the warm-up keys come from
+ * the source set with OQS_randombytes_custom_algorithm().
+ */
+struct warmup_rng {
+	uint64_t state;
+	void (*saved_source)(uint8_t *, size_t, void *);
+	void *saved_ctx;
+};
+
+#if !defined(OQS_EMBEDDED_BUILD)
+static void warmup_randombytes(uint8_t *random_array, size_t bytes_to_read, void *ctx) {
+	struct warmup_rng *rng = ctx;
+
+	while (bytes_to_read > 0) {
+		uint64_t z = (rng->state += 0x9e3779b97f4a7c15ULL);
+		z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+		z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+		z ^= z >> 31;
+		size_t n = bytes_to_read < sizeof(z) ? bytes_to_read : sizeof(z);
+		memcpy(random_array, &z, n);
+		random_array += n;
+		bytes_to_read -= n;
+	}
+}
+
+static OQS_STATUS warmup_rng_begin(struct warmup_rng *rng) {
+	rng->state = 0;
+	OQS_randombytes_get_thread_source(&rng->saved_source, &rng->saved_ctx);
+	return OQS_randombytes_set_thread_source(&warmup_randombytes, rng);
+}
+
+static void warmup_rng_end(const struct warmup_rng *rng) {
+	(void)OQS_randombytes_set_thread_source(rng->saved_source, rng->saved_ctx);
+}
+#else
+static OQS_STATUS warmup_rng_begin(struct warmup_rng *rng) {
+	(void)rng;
+	return OQS_SUCCESS;
+}
+
+static void warmup_rng_end(const struct warmup_rng *rng) {
+	(void)rng;
+}
+#endif
+
+OQS_API OQS_STATUS OQS_KEM_warmup(const char *method_name) {
+	OQS_STATUS ret = OQS_ERROR;
+	struct warmup_rng rng;
+	uint8_t *public_key = NULL;
+	uint8_t *secret_key = NULL;
+	uint8_t *ciphertext = NULL;
+	uint8_t *shared_secret = NULL;
+
+	OQS_init();
+	OQS_KEM *kem = OQS_KEM_new(method_name);
+	if (kem == NULL) {
+		return OQS_ERROR;
+	}
+	public_key = OQS_MEM_malloc(kem->length_public_key);
+	secret_key = OQS_MEM_malloc(kem->length_secret_key);
+	ciphertext = OQS_MEM_malloc(kem->length_ciphertext);
+	shared_secret = OQS_MEM_malloc(kem->length_shared_secret);
+	if (public_key == NULL || secret_key == NULL || ciphertext == NULL || shared_secret == NULL) {
+		goto cleanup;
+	}
+	if (warmup_rng_begin(&rng) != OQS_SUCCESS) {
+		goto cleanup;
+	}
+	if (OQS_KEM_keypair(kem, public_key, secret_key) == OQS_SUCCESS &&
+	        OQS_KEM_encaps(kem, ciphertext, shared_secret, public_key) == OQS_SUCCESS &&
+	        OQS_KEM_decaps(kem, shared_secret, ciphertext, secret_key) == OQS_SUCCESS) {
+		ret = OQS_SUCCESS;
+	}
+	warmup_rng_end(&rng);
+
+cleanup:
+	OQS_MEM_secure_free(secret_key, kem->length_secret_key);
+	OQS_MEM_secure_free(shared_secret, kem->length_shared_secret);
+	OQS_MEM_insecure_free(public_key);
+	OQS_MEM_insecure_free(ciphertext);
+	OQS_KEM_free(kem);
+	return ret;
+}
+
+OQS_API OQS_STATUS OQS_SIG_warmup(const char *method_name) {
+	static const uint8_t message[32] = {0};
+	OQS_STATUS ret = OQS_ERROR;
+	struct warmup_rng rng;
+	uint8_t *public_key = NULL;
+	uint8_t *secret_key = NULL;
+	uint8_t *signature = NULL;
+	size_t signature_len;
+
+	OQS_init();
+	OQS_SIG *sig = OQS_SIG_new(method_name);
+	if (sig == NULL) {
+		return OQS_ERROR;
+	}
+	public_key = OQS_MEM_malloc(sig->length_public_key);
+	secret_key = OQS_MEM_malloc(sig->length_secret_key);
+	signature = OQS_MEM_malloc(sig->length_signature);
+	if (public_key == NULL || secret_key == NULL || signature == NULL) {
+		goto cleanup;
+	}
+	if (warmup_rng_begin(&rng) != OQS_SUCCESS) {
+		goto cleanup;
+	}
+	if (OQS_SIG_keypair(sig, public_key, secret_key) == OQS_SUCCESS &&
+	        OQS_SIG_sign(sig, signature, &signature_len, message, sizeof(message), secret_key) == OQS_SUCCESS &&
+	        OQS_SIG_verify(sig, message, sizeof(message), signature, signature_len, public_key) == OQS_SUCCESS) {
+		ret = OQS_SUCCESS;
+	}
+	warmup_rng_end(&rng);
+
+cleanup:
+	OQS_MEM_secure_free(secret_key, sig->length_secret_key);
+	OQS_MEM_insecure_free(public_key);
+	OQS_MEM_insecure_free(signature);
+	OQS_SIG_free(sig);
+	return ret;
+}
+
+OQS_API OQS_STATUS OQS_init_with_warmup(const char *const *alg_names) {
+	OQS_STATUS ret = OQS_SUCCESS;
+
+	OQS_init();
+	if (alg_names == NULL) {
+		return OQS_SUCCESS;
+	}
+	for (size_t i = 0; alg_names[i] != NULL; i++) {
+		OQS_STATUS rc;
+
+		if (OQS_KEM_alg_is_enabled(alg_names[i])) {
+			rc = OQS_KEM_warmup(alg_names[i]);
+		} else if (OQS_SIG_alg_is_enabled(alg_names[i])) {
+			rc = OQS_SIG_warmup(alg_names[i]);
+		} else {
+			rc = OQS_ERROR;
+		}
+		if (rc != OQS_SUCCESS) {
+			ret = OQS_ERROR;
+		}
+	}
+	return ret;
+}
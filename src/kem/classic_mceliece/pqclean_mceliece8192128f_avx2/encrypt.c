@@ -13,6 +13,10 @@
 #include "crypto_uint32.h"
 #include <stdint.h>
 
+#if defined(OQS_USE_CLASSIC_MCELIECE_AVX512)
+#include "syndrome_avx512.h"
+#endif
+
 /* include last because of conflict with unistd.h's encrypt function */
 #include "encrypt.h"
 
@@ -87,5 +91,11 @@ static void gen_e(unsigned char *e) {
 void encrypt(unsigned char *s, const unsigned char *pk, unsigned char *e) {
     gen_e(e);
 
+#if defined(OQS_USE_CLASSIC_MCELIECE_AVX512)
+    if (syndrome_avx512_available()) {
+        syndrome_avx512(s, pk, e);
+        return;
+    }
+#endif
     syndrome_asm(s, pk, e);
 }
@@ -0,0 +1,151 @@
+// SPDX-License-Identifier: MIT
+
+/*
+ * AVX-512 syndrome computation for Classic McEliece encapsulation.
+ *
+ * This file is compiled into the classic_mceliece_{6688128,6960119,8192128}
+ * AVX2 object libraries (with their params.h) when
+ * OQS_USE_CLASSIC_MCELIECE_AVX512 is ON, and replaces syndrome_asm there on
+ * CPUs with AVX512F/BW/DQ.
+ *
+ * The parity-check matrix is H = (I | T), with T the public key stored row by
+ * row, so bit i of the syndrome is e_i xor <T_i, e_tail>, where e_tail holds
+ * the last PK_NCOLS bits of e. e_tail is realigned to a byte boundary once
+ * (PK_NROWS is not a multiple of 8 for 6960119) and kept in zmm registers;
+ * each row is then a stream of 64-byte AND/XOR steps and one parity. The
+ * public key is over 1 MB and usually not in cache, so it is prefetched a few
+ * rows ahead. (The non-temporal hint was measured to be slower than T0 here:
+ * it limits the prefetched lines to L1, where they are evicted again before
+ * use.)
+ *
+ * With OQS_CLASSIC_MCELIECE_PARALLEL_SYNDROME, the rows are split into
+ * SYNDROME_RANGES ranges of whole syndrome bytes, which the caller and the
+ * workers of the library's thread pool compute concurrently.
+ */
+
+#include <immintrin.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <oqs/common.h>
+
+#if defined(OQS_CLASSIC_MCELIECE_PARALLEL_SYNDROME)
+#include "../../../common/thread_pool.h"
+#endif
+
+#include "params.h"
+#include "syndrome_avx512.h"
+
+#define TAIL_VECS ((PK_ROW_BYTES + 63) / 64)
+/* bytes of the last 64-byte block of a public-key row */
+#define ROW_LAST_BYTES (PK_ROW_BYTES - 64 * (TAIL_VECS - 1))
+#define PREFETCH_ROWS 8
+
+#if defined(OQS_CLASSIC_MCELIECE_PARALLEL_SYNDROME)
+#define SYNDROME_RANGES (OQS_THREAD_POOL_WORKERS + 1)
+#endif
+
+int syndrome_avx512_available(void) {
+#if defined(OQS_DIST_X86_64_BUILD)
+	return OQS_CPU_has_extension(OQS_CPU_EXT_AVX512);
+#else
+	/* Only enabled when built for a CPU with AVX512F, AVX512BW and AVX512DQ */
+	return 1;
+#endif
+}
+
+/* tail[j] = bits PK_NROWS + 8j ... PK_NROWS + 8j + 7 of e, zero past PK_NCOLS */
+static void load_e_tail(unsigned char tail[64 * TAIL_VECS], const unsigned char *e) {
+	const int shift = PK_NROWS % 8;
+	const unsigned char *src = e + PK_NROWS / 8;
+
+	memset(tail, 0, 64 * TAIL_VECS);
+	for (int j = 0; j < PK_ROW_BYTES; j++) {
+		unsigned int lo = src[j];
+		unsigned int hi = (PK_NROWS / 8 + j + 1 < SYS_N / 8) ? src[j + 1] : 0;
+		tail[j] = (unsigned char) ((lo | (hi << 8)) >> shift);
+	}
+	if (PK_NCOLS % 8 != 0) {
+		tail[PK_ROW_BYTES - 1] &= (unsigned char) ((1 << (PK_NCOLS % 8)) - 1);
+	}
+}
+
+static inline uint64_t parity_512(__m512i x) {
+	__m256i y = _mm256_xor_si256(_mm512_castsi512_si256(x), _mm512_extracti64x4_epi64(x, 1));
+	__m128i z = _mm_xor_si128(_mm256_castsi256_si128(y), _mm256_extracti128_si256(y, 1));
+	uint64_t w = (uint64_t) _mm_cvtsi128_si64(z) ^ (uint64_t) _mm_extract_epi64(z, 1);
+	return (uint64_t) __builtin_parityll(w);
+}
+
+/* Computes syndrome bytes [byte_begin, byte_end). */
+static void syndrome_bytes(unsigned char *s, const unsigned char *pk, const unsigned char *e, const unsigned char *tail, int byte_begin, int byte_end) {
+	__m512i et[TAIL_VECS];
+	const __mmask64 last_mask = (ROW_LAST_BYTES == 64) ? ~(__mmask64) 0 : (((__mmask64) 1 << ROW_LAST_BYTES) - 1);
+	const int row_end = (8 * byte_end < PK_NROWS) ? 8 * byte_end : PK_NROWS;
+
+	for (int v = 0; v < TAIL_VECS; v++) {
+		et[v] = _mm512_loadu_si512((const void *) (tail + 64 * v));
+	}
+
+	for (int b = byte_begin; b < byte_end; b++) {
+		unsigned int byte = 0;
+		int rows = (8 * b + 8 <= row_end) ? 8 : row_end - 8 * b;
+
+		for (int r = 0; r < rows; r++) {
+			const int i = 8 * b + r;
+			const unsigned char *row = pk + (size_t) i * PK_ROW_BYTES;
+			__m512i acc = _mm512_setzero_si512();
+
+			if (i + PREFETCH_ROWS < row_end) {
+				const char *ahead = (const char *) (row + PREFETCH_ROWS * PK_ROW_BYTES);
+				for (int v = 0; v < TAIL_VECS; v++) {
+					_mm_prefetch(ahead + 64 * v, _MM_HINT_T0);
+				}
+			}
+			for (int v = 0; v < TAIL_VECS - 1; v++) {
+				acc = _mm512_xor_si512(acc, _mm512_and_si512(_mm512_loadu_si512((const void *) (row + 64 * v)), et[v]));
+			}
+			/* masked so that the last row does not read past the public key */
+			acc = _mm512_xor_si512(acc, _mm512_and_si512(_mm512_maskz_loadu_epi8(last_mask, row + 64 * (TAIL_VECS - 1)), et[TAIL_VECS - 1]));
+
+			byte |= (unsigned int) parity_512(acc) << r;
+		}
+		/* identity part of H */
+		s[b] = (unsigned char) (byte ^ (e[b] & ((1u << rows) - 1)));
+	}
+
+	/* e is secret */
+	OQS_MEM_cleanse(et, sizeof(et));
+}
+
+#if defined(OQS_CLASSIC_MCELIECE_PARALLEL_SYNDROME)
+typedef struct {
+	unsigned char *s;
+	const unsigned char *pk;
+	const unsigned char *e;
+	const unsigned char *tail;
+} syndrome_job;
+
+static void syndrome_range(void *arg, size_t i) {
+	const syndrome_job *job = arg;
+
+	syndrome_bytes(job->s, job->pk, job->e, job->tail, (int) (SYND_BYTES * i / SYNDROME_RANGES), (int) (SYND_BYTES * (i + 1) / SYNDROME_RANGES));
+}
+#endif
+
+void syndrome_avx512(unsigned char *s, const unsigned char *pk, const unsigned char *e) {
+	unsigned char tail[64 * TAIL_VECS];
+
+	load_e_tail(tail, e);
+
+#if defined(OQS_CLASSIC_MCELIECE_PARALLEL_SYNDROME)
+	syndrome_job job = {s, pk, e, tail};
+
+	OQS_THREAD_POOL_run(syndrome_range, &job, SYNDROME_RANGES);
+#else
+	syndrome_bytes(s, pk, e, tail, 0, SYND_BYTES);
+#endif
+
+	/* e is secret */
+	OQS_MEM_cleanse(tail, sizeof(tail));
+}
@@ -0,0 +1,18 @@
+// SPDX-License-Identifier: MIT
+
+#ifndef SYNDROME_AVX512_H
+#define SYNDROME_AVX512_H
+
+#include "params.h"
+
+#define syndrome_avx512_available CRYPTO_NAMESPACE(syndrome_avx512_available)
+#define syndrome_avx512 CRYPTO_NAMESPACE(syndrome_avx512)
+
+/* Returns 1 if syndrome_avx512 can run on this CPU. */
+int syndrome_avx512_available(void);
+
+/* input: public key pk, error vector e */
+/* output: syndrome s */
+void syndrome_avx512(unsigned char *s, const unsigned char *pk, const unsigned char *e);
+
+#endif
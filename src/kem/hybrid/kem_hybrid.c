@@ -0,0 +1,369 @@
+// SPDX-License-Identifier: MIT
+
+#include <stdint.h>
+#include <string.h>
+
+#include <oqs/kem.h>
+#include <oqs/rand.h>
+#include <oqs/sha3.h>
+#include <oqs/sha3x4.h>
+
+#include "kem_hybrid.h"
+#include "x25519.h"
+
+#define HYBRID_KNOWN_FLAGS (OQS_KEM_HYBRID_FLAG_SHAKE256 | OQS_KEM_HYBRID_FLAG_BIND_PQ_CIPHERTEXT)
+
+/* X-Wing combiner label, "\.//^\" */
+static const uint8_t xwing_label[6] = {0x5c, 0x2e, 0x2f, 0x2f, 0x5e, 0x5c};
+
+/* X25519 as a classical KEM */
+
+static OQS_STATUS x25519_nonzero(const uint8_t ss[OQS_X25519_BYTES]) {
+	uint8_t acc = 0;
+	for (size_t i = 0; i < OQS_X25519_BYTES; i++) {
+		acc |= ss[i];
+	}
+	return acc == 0 ? OQS_ERROR : OQS_SUCCESS;
+}
+
+static OQS_STATUS x25519_keypair(void *ctx, uint8_t *public_key, uint8_t *secret_key) {
+	(void) ctx;
+	OQS_randombytes(secret_key, OQS_X25519_BYTES);
+	OQS_KEM_HYBRID_x25519_base(public_key, secret_key);
+	return OQS_SUCCESS;
+}
+
+static OQS_STATUS x25519_encaps(void *ctx, uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *public_key) {
+	uint8_t eph[OQS_X25519_BYTES];
+	(void) ctx;
+	OQS_randombytes(eph, sizeof(eph));
+	OQS_KEM_HYBRID_x25519_base(ciphertext, eph);
+	OQS_KEM_HYBRID_x25519(shared_secret, eph, public_key);
+	OQS_MEM_cleanse(eph, sizeof(eph));
+	return x25519_nonzero(shared_secret);
+}
+
+static OQS_STATUS x25519_decaps(void *ctx, uint8_t *shared_secret, const uint8_t *ciphertext, const uint8_t *secret_key) {
+	(void) ctx;
+	OQS_KEM_HYBRID_x25519(shared_secret, secret_key, ciphertext);
+	return x25519_nonzero(shared_secret);
+}
+
+static const OQS_KEM_CLASSICAL classical_x25519 = {
+	.method_name = "X25519",
+	.length_public_key = OQS_X25519_BYTES,
+	.length_secret_key = OQS_X25519_BYTES,
+	.length_ciphertext = OQS_X25519_BYTES,
+	.length_shared_secret = OQS_X25519_BYTES,
+	.ctx = NULL,
+	.keypair = x25519_keypair,
+	.encaps = x25519_encaps,
+	.decaps = x25519_decaps,
+};
+
+OQS_API const OQS_KEM_CLASSICAL *OQS_KEM_classical_x25519(void) {
+	return &classical_x25519;
+}
+
+/* Combiner */
+
+static void hybrid_combine(const OQS_KEM_HYBRID *hybrid, uint8_t *shared_secret, const uint8_t *ss_pq,
+                           const uint8_t *ss_c, const uint8_t *ct_pq, const uint8_t *ct_c, const uint8_t *pk_c) {
+	const size_t ss_pq_len = hybrid->pq->length_shared_secret;
+	const size_t ss_c_len = hybrid->classical->length_shared_secret;
+	const size_t ct_c_len = hybrid->classical->length_ciphertext;
+	const size_t pk_c_len = hybrid->classical->length_public_key;
+	const int bind_ct_pq = (hybrid->flags & OQS_KEM_HYBRID_FLAG_BIND_PQ_CIPHERTEXT) != 0;
+
+	if (hybrid->flags & OQS_KEM_HYBRID_FLAG_SHAKE256) {
+		OQS_SHA3_shake256_inc_ctx state;
+		OQS_SHA3_shake256_inc_init(&state);
+		OQS_SHA3_shake256_inc_absorb(&state, ss_pq, ss_pq_len);
+		OQS_SHA3_shake256_inc_absorb(&state, ss_c, ss_c_len);
+		OQS_SHA3_shake256_inc_absorb(&state, ct_c, ct_c_len);
+		OQS_SHA3_shake256_inc_absorb(&state, pk_c, pk_c_len);
+		if (bind_ct_pq) {
+			OQS_SHA3_shake256_inc_absorb(&state, ct_pq, hybrid->pq->length_ciphertext);
+		}
+		OQS_SHA3_shake256_inc_absorb(&state, hybrid->label, hybrid->label_len);
+		OQS_SHA3_shake256_inc_finalize(&state);
+		OQS_SHA3_shake256_inc_squeeze(shared_secret, OQS_KEM_HYBRID_length_shared_secret, &state);
+		OQS_SHA3_shake256_inc_ctx_release(&state);
+	} else {
+		OQS_SHA3_sha3_256_inc_ctx state;
+		OQS_SHA3_sha3_256_inc_init(&state);
+		OQS_SHA3_sha3_256_inc_absorb(&state, ss_pq, ss_pq_len);
+		OQS_SHA3_sha3_256_inc_absorb(&state, ss_c, ss_c_len);
+		OQS_SHA3_sha3_256_inc_absorb(&state, ct_c, ct_c_len);
+		OQS_SHA3_sha3_256_inc_absorb(&state, pk_c, pk_c_len);
+		if (bind_ct_pq) {
+			OQS_SHA3_sha3_256_inc_absorb(&state, ct_pq, hybrid->pq->length_ciphertext);
+		}
+		OQS_SHA3_sha3_256_inc_absorb(&state, hybrid->label, hybrid->label_len);
+		OQS_SHA3_sha3_256_inc_finalize(shared_secret, &state);
+		OQS_SHA3_sha3_256_inc_ctx_release(&state);
+	}
+}
+
+/* Four independent SHAKE256 combiner instances in one pass of the four-way Keccak. */
+static void hybrid_combine_x4(const OQS_KEM_HYBRID *hybrid, uint8_t *shared_secret[4], const uint8_t *ss_pq[4],
+                              const uint8_t *ss_c[4], const uint8_t *ct_pq[4], const uint8_t *ct_c[4],
+                              const uint8_t *pk_c[4]) {
+	OQS_SHA3_shake256_x4_inc_ctx state;
+	OQS_SHA3_shake256_x4_inc_init(&state);
+	OQS_SHA3_shake256_x4_inc_absorb(&state, ss_pq[0], ss_pq[1], ss_pq[2], ss_pq[3], hybrid->pq->length_shared_secret);
+	OQS_SHA3_shake256_x4_inc_absorb(&state, ss_c[0], ss_c[1], ss_c[2], ss_c[3], hybrid->classical->length_shared_secret);
+	OQS_SHA3_shake256_x4_inc_absorb(&state, ct_c[0], ct_c[1], ct_c[2], ct_c[3], hybrid->classical->length_ciphertext);
+	OQS_SHA3_shake256_x4_inc_absorb(&state, pk_c[0], pk_c[1], pk_c[2], pk_c[3], hybrid->classical->length_public_key);
+	if (hybrid->flags & OQS_KEM_HYBRID_FLAG_BIND_PQ_CIPHERTEXT) {
+		OQS_SHA3_shake256_x4_inc_absorb(&state, ct_pq[0], ct_pq[1], ct_pq[2], ct_pq[3], hybrid->pq->length_ciphertext);
+	}
+	OQS_SHA3_shake256_x4_inc_absorb(&state, hybrid->label, hybrid->label, hybrid->label, hybrid->label, hybrid->label_len);
+	OQS_SHA3_shake256_x4_inc_finalize(&state);
+	OQS_SHA3_shake256_x4_inc_squeeze(shared_secret[0], shared_secret[1], shared_secret[2], shared_secret[3],
+	                                 OQS_KEM_HYBRID_length_shared_secret, &state);
+	OQS_SHA3_shake256_x4_inc_ctx_release(&state);
+}
+
+/* Object management */
+
+OQS_API OQS_KEM_HYBRID *OQS_KEM_HYBRID_new(const struct OQS_KEM *pq, const OQS_KEM_CLASSICAL *classical,
+        const uint8_t *label, size_t label_len, uint32_t flags) {
+	if (pq == NULL || classical == NULL || classical->keypair == NULL || classical->encaps == NULL ||
+	        classical->decaps == NULL) {
+		return NULL;
+	}
+	if ((flags & ~HYBRID_KNOWN_FLAGS) != 0 ||
+	        pq->length_shared_secret > OQS_KEM_HYBRID_MAX_COMPONENT_SHARED_SECRET ||
+	        classical->length_shared_secret > OQS_KEM_HYBRID_MAX_COMPONENT_SHARED_SECRET) {
+		return NULL;
+	}
+	if (label == NULL) {
+		label = xwing_label;
+		label_len = sizeof(xwing_label);
+	} else if (label_len > OQS_KEM_HYBRID_MAX_LABEL) {
+		return NULL;
+	}
+
+	OQS_KEM_HYBRID *hybrid = OQS_MEM_malloc(sizeof(OQS_KEM_HYBRID));
+	if (hybrid == NULL) {
+		return NULL;
+	}
+	memset(hybrid, 0, sizeof(OQS_KEM_HYBRID));
+	hybrid->pq = pq;
+	hybrid->classical = classical;
+	hybrid->flags = flags;
+	hybrid->length_public_key = pq->length_public_key + classical->length_public_key;
+	hybrid->length_secret_key = pq->length_secret_key + classical->length_secret_key + classical->length_public_key;
+	hybrid->length_ciphertext = pq->length_ciphertext + classical->length_ciphertext;
+	hybrid->length_shared_secret = OQS_KEM_HYBRID_length_shared_secret;
+	hybrid->label_len = label_len;
+	if (label_len > 0) {
+		memcpy(hybrid->label, label, label_len);
+	}
+	return hybrid;
+}
+
+OQS_API void OQS_KEM_HYBRID_free(OQS_KEM_HYBRID *hybrid) {
+	OQS_MEM_insecure_free(hybrid);
+}
+
+/* Single operations */
+
+OQS_API OQS_STATUS OQS_KEM_HYBRID_keypair(const OQS_KEM_HYBRID *hybrid, uint8_t *public_key, uint8_t *secret_key) {
+	if (hybrid == NULL || public_key == NULL || secret_key == NULL) {
+		return OQS_ERROR;
+	}
+	const OQS_KEM_CLASSICAL *classical = hybrid->classical;
+	uint8_t *pk_c = public_key + hybrid->pq->length_public_key;
+	uint8_t *sk_c = secret_key + hybrid->pq->length_secret_key;
+
+	if (OQS_KEM_keypair(hybrid->pq, public_key, secret_key) != OQS_SUCCESS ||
+	        classical->keypair(classical->ctx, pk_c, sk_c) != OQS_SUCCESS) {
+		OQS_MEM_cleanse(secret_key, hybrid->length_secret_key);
+		return OQS_ERROR;
+	}
+	/* Decapsulation needs the classical public key for the combiner. */
+	memcpy(sk_c + classical->length_secret_key, pk_c, classical->length_public_key);
+	return OQS_SUCCESS;
+}
+
+/* Component encapsulation into ss_pq / ss_c; the ciphertext halves are written in place. */
+static OQS_STATUS hybrid_encaps_components(const OQS_KEM_HYBRID *hybrid, uint8_t *ciphertext, uint8_t *ss_pq,
+        uint8_t *ss_c, const uint8_t *public_key) {
+	const OQS_KEM_CLASSICAL *classical = hybrid->classical;
+	if (OQS_KEM_encaps(hybrid->pq, ciphertext, ss_pq, public_key) != OQS_SUCCESS) {
+		return OQS_ERROR;
+	}
+	return classical->encaps(classical->ctx, ciphertext + hybrid->pq->length_ciphertext, ss_c,
+	                         public_key + hybrid->pq->length_public_key);
+}
+
+static OQS_STATUS hybrid_decaps_components(const OQS_KEM_HYBRID *hybrid, uint8_t *ss_pq, uint8_t *ss_c,
+        const uint8_t *ciphertext, const uint8_t *secret_key) {
+	const OQS_KEM_CLASSICAL *classical = hybrid->classical;
+	if (OQS_KEM_decaps(hybrid->pq, ss_pq, ciphertext, secret_key) != OQS_SUCCESS) {
+		return OQS_ERROR;
+	}
+	return classical->decaps(classical->ctx, ss_c, ciphertext + hybrid->pq->length_ciphertext,
+	                         secret_key + hybrid->pq->length_secret_key);
+}
+
+/* Position of the classical public key inside a hybrid public / secret key. */
+#define HYBRID_PK_C_FROM_PK(h, pk) ((pk) + (h)->pq->length_public_key)
+#define HYBRID_PK_C_FROM_SK(h, sk) ((sk) + (h)->pq->length_secret_key + (h)->classical->length_secret_key)
+#define HYBRID_CT_C(h, ct) ((ct) + (h)->pq->length_ciphertext)
+
+OQS_API OQS_STATUS OQS_KEM_HYBRID_encaps(const OQS_KEM_HYBRID *hybrid, uint8_t *ciphertext, uint8_t *shared_secret,
+        const uint8_t *public_key) {
+	uint8_t ss_pq[OQS_KEM_HYBRID_MAX_COMPONENT_SHARED_SECRET];
+	uint8_t ss_c[OQS_KEM_HYBRID_MAX_COMPONENT_SHARED_SECRET];
+	OQS_STATUS rc;
+
+	if (hybrid == NULL || ciphertext == NULL || shared_secret == NULL || public_key == NULL) {
+		return OQS_ERROR;
+	}
+	rc = hybrid_encaps_components(hybrid, ciphertext, ss_pq, ss_c, public_key);
+	if (rc == OQS_SUCCESS) {
+		hybrid_combine(hybrid, shared_secret, ss_pq, ss_c, ciphertext, HYBRID_CT_C(hybrid, ciphertext),
+		               HYBRID_PK_C_FROM_PK(hybrid, public_key));
+	} else {
+		OQS_MEM_cleanse(shared_secret, OQS_KEM_HYBRID_length_shared_secret);
+	}
+	OQS_MEM_cleanse(ss_pq, sizeof(ss_pq));
+	OQS_MEM_cleanse(ss_c, sizeof(ss_c));
+	return rc;
+}
+
+OQS_API OQS_STATUS OQS_KEM_HYBRID_decaps(const OQS_KEM_HYBRID *hybrid, uint8_t *shared_secret,
+        const uint8_t *ciphertext, const uint8_t *secret_key) {
+	uint8_t ss_pq[OQS_KEM_HYBRID_MAX_COMPONENT_SHARED_SECRET];
+	uint8_t ss_c[OQS_KEM_HYBRID_MAX_COMPONENT_SHARED_SECRET];
+	OQS_STATUS rc;
+
+	if (hybrid == NULL || shared_secret == NULL || ciphertext == NULL || secret_key == NULL) {
+		return OQS_ERROR;
+	}
+	rc = hybrid_decaps_components(hybrid, ss_pq, ss_c, ciphertext, secret_key);
+	if (rc == OQS_SUCCESS) {
+		hybrid_combine(hybrid, shared_secret, ss_pq, ss_c, ciphertext, HYBRID_CT_C(hybrid, ciphertext),
+		               HYBRID_PK_C_FROM_SK(hybrid, secret_key));
+	} else {
+		OQS_MEM_cleanse(shared_secret, OQS_KEM_HYBRID_length_shared_secret);
+	}
+	OQS_MEM_cleanse(ss_pq, sizeof(ss_pq));
+	OQS_MEM_cleanse(ss_c, sizeof(ss_c));
+	return rc;
+}
+
+OQS_API OQS_STATUS OQS_KEM_HYBRID_combine(const OQS_KEM_HYBRID *hybrid, uint8_t *shared_secret,
+        const uint8_t *ss_pq, const uint8_t *ss_classical, const uint8_t *ct_pq,
+        const uint8_t *ct_classical, const uint8_t *pk_classical) {
+	if (hybrid == NULL || shared_secret == NULL || ss_pq == NULL || ss_classical == NULL ||
+	        ct_classical == NULL || pk_classical == NULL ||
+	        (ct_pq == NULL && (hybrid->flags & OQS_KEM_HYBRID_FLAG_BIND_PQ_CIPHERTEXT))) {
+		return OQS_ERROR;
+	}
+	hybrid_combine(hybrid, shared_secret, ss_pq, ss_classical, ct_pq, ct_classical, pk_classical);
+	return OQS_SUCCESS;
+}
+
+/* Batch operations */
+
+OQS_API OQS_STATUS OQS_KEM_HYBRID_encaps_batch(const OQS_KEM_HYBRID *hybrid, size_t count, uint8_t *ciphertexts,
+        uint8_t *shared_secrets, const uint8_t *public_keys) {
+	uint8_t ss_pq[4][OQS_KEM_HYBRID_MAX_COMPONENT_SHARED_SECRET];
+	uint8_t ss_c[4][OQS_KEM_HYBRID_MAX_COMPONENT_SHARED_SECRET];
+	OQS_STATUS rc = OQS_SUCCESS;
+	size_t i = 0;
+
+	if (hybrid == NULL || (count > 0 && (ciphertexts == NULL || shared_secrets == NULL || public_keys == NULL))) {
+		return OQS_ERROR;
+	}
+	const size_t pk_len = hybrid->length_public_key;
+	const size_t ct_len = hybrid->length_ciphertext;
+	const size_t ss_len = hybrid->length_shared_secret;
+
+	if (hybrid->flags & OQS_KEM_HYBRID_FLAG_SHAKE256) {
+		for (; rc == OQS_SUCCESS && i + 4 <= count; i += 4) {
+			uint8_t *ss[4];
+			const uint8_t *ss_pq_p[4], *ss_c_p[4], *ct_pq[4], *ct_c[4], *pk_c[4];
+			for (size_t j = 0; j < 4; j++) {
+				uint8_t *ct = ciphertexts + (i + j) * ct_len;
+				const uint8_t *pk = public_keys + (i + j) * pk_len;
+				if (hybrid_encaps_components(hybrid, ct, ss_pq[j], ss_c[j], pk) != OQS_SUCCESS) {
+					rc = OQS_ERROR;
+				}
+				ss[j] = shared_secrets + (i + j) * ss_len;
+				ss_pq_p[j] = ss_pq[j];
+				ss_c_p[j] = ss_c[j];
+				ct_pq[j] = ct;
+				ct_c[j] = HYBRID_CT_C(hybrid, ct);
+				pk_c[j] = HYBRID_PK_C_FROM_PK(hybrid, pk);
+			}
+			if (rc == OQS_SUCCESS) {
+				hybrid_combine_x4(hybrid, ss, ss_pq_p, ss_c_p, ct_pq, ct_c, pk_c);
+			}
+		}
+	}
+	for (; rc == OQS_SUCCESS && i < count; i++) {
+		rc = OQS_KEM_HYBRID_encaps(hybrid, ciphertexts + i * ct_len, shared_secrets + i * ss_len,
+		                           public_keys + i * pk_len);
+	}
+
+	if (rc != OQS_SUCCESS) {
+		OQS_MEM_cleanse(shared_secrets, count * ss_len);
+	}
+	OQS_MEM_cleanse(ss_pq, sizeof(ss_pq));
+	OQS_MEM_cleanse(ss_c, sizeof(ss_c));
+	return rc;
+}
+
+OQS_API OQS_STATUS OQS_KEM_HYBRID_decaps_batch(const OQS_KEM_HYBRID *hybrid, size_t count, uint8_t *shared_secrets,
+        const uint8_t *ciphertexts, const uint8_t *secret_keys) {
+	uint8_t ss_pq[4][OQS_KEM_HYBRID_MAX_COMPONENT_SHARED_SECRET];
+	uint8_t ss_c[4][OQS_KEM_HYBRID_MAX_COMPONENT_SHARED_SECRET];
+	OQS_STATUS rc = OQS_SUCCESS;
+	size_t i = 0;
+
+	if (hybrid == NULL || (count > 0 && (ciphertexts == NULL || shared_secrets == NULL || secret_keys == NULL))) {
+		return OQS_ERROR;
+	}
+	const size_t sk_len = hybrid->length_secret_key;
+	const size_t ct_len = hybrid->length_ciphertext;
+	const size_t ss_len = hybrid->length_shared_secret;
+
+	if (hybrid->flags & OQS_KEM_HYBRID_FLAG_SHAKE256) {
+		for (; rc == OQS_SUCCESS && i + 4 <= count; i += 4) {
+			uint8_t *ss[4];
+			const uint8_t *ss_pq_p[4], *ss_c_p[4], *ct_pq[4], *ct_c[4], *pk_c[4];
+			for (size_t j = 0; j < 4; j++) {
+				const uint8_t *ct = ciphertexts + (i + j) * ct_len;
+				const uint8_t *sk = secret_keys + (i + j) * sk_len;
+				if (hybrid_decaps_components(hybrid, ss_pq[j], ss_c[j], ct, sk) != OQS_SUCCESS) {
+					rc = OQS_ERROR;
+				}
+				ss[j] = shared_secrets + (i + j) * ss_len;
+				ss_pq_p[j] = ss_pq[j];
+				ss_c_p[j] = ss_c[j];
+				ct_pq[j] = ct;
+				ct_c[j] = HYBRID_CT_C(hybrid, ct);
+				pk_c[j] = HYBRID_PK_C_FROM_SK(hybrid, sk);
+			}
+			if (rc == OQS_SUCCESS) {
+				hybrid_combine_x4(hybrid, ss, ss_pq_p, ss_c_p, ct_pq, ct_c, pk_c);
+			}
+		}
+	}
+	for (; rc == OQS_SUCCESS && i < count; i++) {
+		rc = OQS_KEM_HYBRID_decaps(hybrid, shared_secrets + i * ss_len, ciphertexts + i * ct_len,
+		                           secret_keys + i * sk_len);
+	}
+
+	if (rc != OQS_SUCCESS) {
+		OQS_MEM_cleanse(shared_secrets, count * ss_len);
+	}
+	OQS_MEM_cleanse(ss_pq, sizeof(ss_pq));
+	OQS_MEM_cleanse(ss_c, sizeof(ss_c));
+	return rc;
+}
@@ -0,0 +1,232 @@
+/**
+ * \file kem_hybrid.h
+ * \brief Hybrid (post-quantum + classical) key encapsulation
+ *
+ * An OQS_KEM_HYBRID object pairs any OQS_KEM with a classical KEM supplied as
+ * an OQS_KEM_CLASSICAL callback table (e.g. ECDH expressed as a KEM; a built-in
+ * X25519 table is provided by OQS_KEM_classical_x25519()).  The hybrid objects
+ * are laid out as
+ *
+ *     public key  = pk_pq || pk_classical
+ *     secret key  = sk_pq || sk_classical || pk_classical
+ *     ciphertext  = ct_pq || ct_classical
+ *
+ * and the combined shared secret is derived in a single incremental Keccak pass
+ * directly over the caller's buffers:
+ *
+ *     ss = H(ss_pq || ss_classical || ct_classical || pk_classical [|| ct_pq] || label)
+ *
+ * where H is SHA3-256, or SHAKE256 with 32 bytes of output when
+ * OQS_KEM_HYBRID_FLAG_SHAKE256 is set.  The post-quantum ciphertext is only
+ * absorbed when OQS_KEM_HYBRID_FLAG_BIND_PQ_CIPHERTEXT is set; ML-KEM is
+ * ciphertext-binding and does not need it.  With ML-KEM-768, X25519, SHA3-256
+ * and the default label this is the X-Wing combiner.
+ *
+ * An OQS_KEM_HYBRID object only holds const pointers to its components and may
+ * be used concurrently from several threads, provided the classical callbacks
+ * are thread-safe.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef OQS_KEM_HYBRID_H
+#define OQS_KEM_HYBRID_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <oqs/common.h>
+
+/* Defined in kem.h, which may include this header before OQS_KEM is complete. */
+struct OQS_KEM;
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/** Length of the combined hybrid shared secret, in bytes. */
+#define OQS_KEM_HYBRID_length_shared_secret 32
+
+/** Largest component shared secret accepted from either KEM, in bytes. */
+#define OQS_KEM_HYBRID_MAX_COMPONENT_SHARED_SECRET 128
+
+/** Longest domain-separation label accepted by OQS_KEM_HYBRID_new(), in bytes. */
+#define OQS_KEM_HYBRID_MAX_LABEL 64
+
+/** Derive the shared secret with SHAKE256 instead of SHA3-256; enables four-way batch combining. */
+#define OQS_KEM_HYBRID_FLAG_SHAKE256 0x1u
+/** Also absorb the post-quantum ciphertext into the combiner (for non-ciphertext-binding KEMs). */
+#define OQS_KEM_HYBRID_FLAG_BIND_PQ_CIPHERTEXT 0x2u
+
+/**
+ * Classical KEM plugged into a hybrid KEM.
+ *
+ * All callbacks receive `ctx` as their first argument and return OQS_SUCCESS
+ * or OQS_ERROR.  `decaps` must return OQS_ERROR for invalid ciphertexts rather
+ * than an all-zero or otherwise degenerate shared secret.
+ */
+typedef struct OQS_KEM_CLASSICAL {
+	/** Printable name of the classical KEM. */
+	const char *method_name;
+	/** The length, in bytes, of public keys. */
+	size_t length_public_key;
+	/** The length, in bytes, of secret keys. */
+	size_t length_secret_key;
+	/** The length, in bytes, of ciphertexts. */
+	size_t length_ciphertext;
+	/** The length, in bytes, of shared secrets. */
+	size_t length_shared_secret;
+	/** Opaque pointer passed to every callback. */
+	void *ctx;
+	/** Keypair generation. */
+	OQS_STATUS (*keypair)(void *ctx, uint8_t *public_key, uint8_t *secret_key);
+	/** Encapsulation against `public_key`. */
+	OQS_STATUS (*encaps)(void *ctx, uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *public_key);
+	/** Decapsulation of `ciphertext` with `secret_key`. */
+	OQS_STATUS (*decaps)(void *ctx, uint8_t *shared_secret, const uint8_t *ciphertext, const uint8_t *secret_key);
+} OQS_KEM_CLASSICAL;
+
+/**
+ * Hybrid KEM object.  Create with OQS_KEM_HYBRID_new(); the length members
+ * give the sizes of the hybrid public key, secret key and ciphertext.
+ */
+typedef struct OQS_KEM_HYBRID {
+	/** Post-quantum component. */
+	const struct OQS_KEM *pq;
+	/** Classical component. */
+	const OQS_KEM_CLASSICAL *classical;
+	/** OQS_KEM_HYBRID_FLAG_* bits. */
+	uint32_t flags;
+	/** The length, in bytes, of hybrid public keys. */
+	size_t length_public_key;
+	/** The length, in bytes, of hybrid secret keys. */
+	size_t length_secret_key;
+	/** The length, in bytes, of hybrid ciphertexts. */
+	size_t length_ciphertext;
+	/** The length, in bytes, of hybrid shared secrets (OQS_KEM_HYBRID_length_shared_secret). */
+	size_t length_shared_secret;
+	/** Length of the domain-separation label. */
+	size_t label_len;
+	/** Domain-separation label absorbed last into the combiner. */
+	uint8_t label[OQS_KEM_HYBRID_MAX_LABEL];
+} OQS_KEM_HYBRID;
+
+/**
+ * Returns a classical KEM table for X25519 (RFC 7748) Diffie-Hellman, used as
+ * a KEM: the ciphertext is an ephemeral public key and the shared secret is the
+ * 32-byte X25519 output.  Decapsulation rejects all-zero outputs.
+ *
+ * @return A pointer to a static, immutable OQS_KEM_CLASSICAL.
+ */
+OQS_API const OQS_KEM_CLASSICAL *OQS_KEM_classical_x25519(void);
+
+/**
+ * Constructs a hybrid KEM.
+ *
+ * @param[in] pq The post-quantum KEM; must outlive the returned object.
+ * @param[in] classical The classical KEM; must outlive the returned object.
+ * @param[in] label Domain-separation label, or NULL for the X-Wing label `\.//^\`.
+ * @param[in] label_len Length of `label`; at most OQS_KEM_HYBRID_MAX_LABEL.
+ * @param[in] flags Bitwise OR of OQS_KEM_HYBRID_FLAG_* values.
+ * @return An OQS_KEM_HYBRID for the given components, or NULL on invalid parameters or allocation failure.
+ */
+OQS_API OQS_KEM_HYBRID *OQS_KEM_HYBRID_new(const struct OQS_KEM *pq, const OQS_KEM_CLASSICAL *classical,
+        const uint8_t *label, size_t label_len, uint32_t flags);
+
+/**
+ * Frees an OQS_KEM_HYBRID object created by OQS_KEM_HYBRID_new().  Does not
+ * free its components.
+ *
+ * @param[in] hybrid The OQS_KEM_HYBRID object to free.
+ */
+OQS_API void OQS_KEM_HYBRID_free(OQS_KEM_HYBRID *hybrid);
+
+/**
+ * Hybrid keypair generation.
+ *
+ * @param[in] hybrid The OQS_KEM_HYBRID object.
+ * @param[out] public_key The public key, of length `hybrid->length_public_key`.
+ * @param[out] secret_key The secret key, of length `hybrid->length_secret_key`.
+ * @return OQS_SUCCESS or OQS_ERROR
+ */
+OQS_API OQS_STATUS OQS_KEM_HYBRID_keypair(const OQS_KEM_HYBRID *hybrid, uint8_t *public_key, uint8_t *secret_key);
+
+/**
+ * Hybrid encapsulation.
+ *
+ * @param[in] hybrid The OQS_KEM_HYBRID object.
+ * @param[out] ciphertext The ciphertext, of length `hybrid->length_ciphertext`.
+ * @param[out] shared_secret The combined shared secret, of length `hybrid->length_shared_secret`.
+ * @param[in] public_key The public key, of length `hybrid->length_public_key`.
+ * @return OQS_SUCCESS or OQS_ERROR
+ */
+OQS_API OQS_STATUS OQS_KEM_HYBRID_encaps(const OQS_KEM_HYBRID *hybrid, uint8_t *ciphertext, uint8_t *shared_secret,
+        const uint8_t *public_key);
+
+/**
+ * Hybrid decapsulation.  On error `shared_secret` is zeroed.
+ *
+ * @param[in] hybrid The OQS_KEM_HYBRID object.
+ * @param[out] shared_secret The combined shared secret, of length `hybrid->length_shared_secret`.
+ * @param[in] ciphertext The ciphertext, of length `hybrid->length_ciphertext`.
+ * @param[in] secret_key The secret key, of length `hybrid->length_secret_key`.
+ * @return OQS_SUCCESS or OQS_ERROR
+ */
+OQS_API OQS_STATUS OQS_KEM_HYBRID_decaps(const OQS_KEM_HYBRID *hybrid, uint8_t *shared_secret,
+        const uint8_t *ciphertext, const uint8_t *secret_key);
+
+/**
+ * Combiner only, for protocols that run the two component KEMs themselves.
+ * Computes the hybrid shared secret from the component outputs in one
+ * incremental pass, without copying them.
+ *
+ * @param[in] hybrid The OQS_KEM_HYBRID object.
+ * @param[out] shared_secret The combined shared secret, of length `hybrid->length_shared_secret`.
+ * @param[in] ss_pq The post-quantum shared secret, of length `hybrid->pq->length_shared_secret`.
+ * @param[in] ss_classical The classical shared secret, of length `hybrid->classical->length_shared_secret`.
+ * @param[in] ct_pq The post-quantum ciphertext; only read with OQS_KEM_HYBRID_FLAG_BIND_PQ_CIPHERTEXT, may otherwise be NULL.
+ * @param[in] ct_classical The classical ciphertext.
+ * @param[in] pk_classical The classical public key.
+ * @return OQS_SUCCESS or OQS_ERROR
+ */
+OQS_API OQS_STATUS OQS_KEM_HYBRID_combine(const OQS_KEM_HYBRID *hybrid, uint8_t *shared_secret,
+        const uint8_t *ss_pq, const uint8_t *ss_classical, const uint8_t *ct_pq,
+        const uint8_t *ct_classical, const uint8_t *pk_classical);
+
+/**
+ * Batch hybrid encapsulation: `count` independent encapsulations against the
+ * public keys in `public_keys`.  Arrays are contiguous, with strides of
+ * `hybrid->length_public_key`, `hybrid->length_ciphertext` and
+ * `hybrid->length_shared_secret` bytes.  With OQS_KEM_HYBRID_FLAG_SHAKE256 the
+ * combiner runs four lanes at a time through the four-way SHAKE256.
+ *
+ * @param[in] hybrid The OQS_KEM_HYBRID object.
+ * @param[in] count Number of encapsulations.
+ * @param[out] ciphertexts `count` ciphertexts.
+ * @param[out] shared_secrets `count` combined shared secrets.
+ * @param[in] public_keys `count` public keys.
+ * @return OQS_SUCCESS, or OQS_ERROR if any encapsulation failed (all shared secrets are then zeroed)
+ */
+OQS_API OQS_STATUS OQS_KEM_HYBRID_encaps_batch(const OQS_KEM_HYBRID *hybrid, size_t count, uint8_t *ciphertexts,
+        uint8_t *shared_secrets, const uint8_t *public_keys);
+
+/**
+ * Batch hybrid decapsulation; see OQS_KEM_HYBRID_encaps_batch() for the
+ * layout.  On error all `count` shared secrets are zeroed.
+ *
+ * @param[in] hybrid The OQS_KEM_HYBRID object.
+ * @param[in] count Number of decapsulations.
+ * @param[out] shared_secrets `count` combined shared secrets.
+ * @param[in] ciphertexts `count` ciphertexts.
+ * @param[in] secret_keys `count` secret keys.
+ * @return OQS_SUCCESS, or OQS_ERROR if any decapsulation failed
+ */
+OQS_API OQS_STATUS OQS_KEM_HYBRID_decaps_batch(const OQS_KEM_HYBRID *hybrid, size_t count, uint8_t *shared_secrets,
+        const uint8_t *ciphertexts, const uint8_t *secret_keys);
+
+#if defined(__cplusplus)
+} // extern "C"
+#endif
+
+#endif // OQS_KEM_HYBRID_H
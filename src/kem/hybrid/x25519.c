@@ -0,0 +1,181 @@
+// SPDX-License-Identifier: MIT
+
+/*
+ * Portable constant-time X25519 (RFC 7748).
+ *
+ * Field elements of GF(2^255 - 19) are held in sixteen signed 64-bit limbs of
+ * 16 bits each, following the representation used by TweetNaCl.  This favours
+ * small code and portability over speed: the combiner only needs one or two
+ * scalar multiplications per hybrid operation, next to a post-quantum KEM that
+ * dominates the cost.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include <oqs/common.h>
+
+#include "x25519.h"
+
+typedef int64_t gf[16];
+
+static const gf gf_121665 = {0xDB41, 1};
+
+static void gf_carry(gf o) {
+	int64_t c;
+	for (int i = 0; i < 16; i++) {
+		o[i] += ((int64_t) 1 << 16);
+		c = o[i] >> 16;
+		if (i < 15) {
+			o[i + 1] += c - 1;
+		} else {
+			o[0] += 38 * (c - 1);
+		}
+		o[i] -= c * ((int64_t) 1 << 16);
+	}
+}
+
+/* Swap p and q if b == 1, in constant time. */
+static void gf_cswap(gf p, gf q, int64_t b) {
+	int64_t t, c = ~(b - 1);
+	for (int i = 0; i < 16; i++) {
+		t = c & (p[i] ^ q[i]);
+		p[i] ^= t;
+		q[i] ^= t;
+	}
+}
+
+static void gf_pack(uint8_t o[32], const gf n) {
+	int64_t b;
+	gf m, t;
+	memcpy(t, n, sizeof(gf));
+	gf_carry(t);
+	gf_carry(t);
+	gf_carry(t);
+	for (int j = 0; j < 2; j++) {
+		m[0] = t[0] - 0xffed;
+		for (int i = 1; i < 15; i++) {
+			m[i] = t[i] - 0xffff - ((m[i - 1] >> 16) & 1);
+			m[i - 1] &= 0xffff;
+		}
+		m[15] = t[15] - 0x7fff - ((m[14] >> 16) & 1);
+		b = (m[15] >> 16) & 1;
+		m[14] &= 0xffff;
+		gf_cswap(t, m, 1 - b);
+	}
+	for (int i = 0; i < 16; i++) {
+		o[2 * i] = (uint8_t) (t[i] & 0xff);
+		o[2 * i + 1] = (uint8_t) ((t[i] >> 8) & 0xff);
+	}
+}
+
+static void gf_unpack(gf o, const uint8_t n[32]) {
+	for (int i = 0; i < 16; i++) {
+		o[i] = (int64_t) n[2 * i] + ((int64_t) n[2 * i + 1] << 8);
+	}
+	o[15] &= 0x7fff;
+}
+
+static void gf_add(gf o, const gf a, const gf b) {
+	for (int i = 0; i < 16; i++) {
+		o[i] = a[i] + b[i];
+	}
+}
+
+static void gf_sub(gf o, const gf a, const gf b) {
+	for (int i = 0; i < 16; i++) {
+		o[i] = a[i] - b[i];
+	}
+}
+
+static void gf_mul(gf o, const gf a, const gf b) {
+	int64_t t[31] = {0};
+	for (int i = 0; i < 16; i++) {
+		for (int j = 0; j < 16; j++) {
+			t[i + j] += a[i] * b[j];
+		}
+	}
+	for (int i = 0; i < 15; i++) {
+		t[i] += 38 * t[i + 16];
+	}
+	memcpy(o, t, sizeof(gf));
+	gf_carry(o);
+	gf_carry(o);
+}
+
+static void gf_sqr(gf o, const gf a) {
+	gf_mul(o, a, a);
+}
+
+/* o = i^(p - 2) */
+static void gf_inv(gf o, const gf i) {
+	gf c;
+	memcpy(c, i, sizeof(gf));
+	for (int a = 253; a >= 0; a--) {
+		gf_sqr(c, c);
+		if (a != 2 && a != 4) {
+			gf_mul(c, c, i);
+		}
+	}
+	memcpy(o, c, sizeof(gf));
+}
+
+void OQS_KEM_HYBRID_x25519(uint8_t out[OQS_X25519_BYTES], const uint8_t scalar[OQS_X25519_BYTES],
+                           const uint8_t point[OQS_X25519_BYTES]) {
+	uint8_t z[32];
+	int64_t r;
+	gf x, a, b, c, d, e, f;
+
+	memcpy(z, scalar, 32);
+	z[31] = (uint8_t) ((z[31] & 127) | 64);
+	z[0] &= 248;
+	gf_unpack(x, point);
+	memcpy(b, x, sizeof(gf));
+	memset(a, 0, sizeof(gf));
+	memset(c, 0, sizeof(gf));
+	memset(d, 0, sizeof(gf));
+	a[0] = d[0] = 1;
+
+	/* Montgomery ladder */
+	for (int i = 254; i >= 0; i--) {
+		r = (z[i >> 3] >> (i & 7)) & 1;
+		gf_cswap(a, b, r);
+		gf_cswap(c, d, r);
+		gf_add(e, a, c);
+		gf_sub(a, a, c);
+		gf_add(c, b, d);
+		gf_sub(b, b, d);
+		gf_sqr(d, e);
+		gf_sqr(f, a);
+		gf_mul(a, c, a);
+		gf_mul(c, b, e);
+		gf_add(e, a, c);
+		gf_sub(a, a, c);
+		gf_sqr(b, a);
+		gf_sub(c, d, f);
+		gf_mul(a, c, gf_121665);
+		gf_add(a, a, d);
+		gf_mul(c, c, a);
+		gf_mul(a, d, f);
+		gf_mul(d, b, x);
+		gf_sqr(b, e);
+		gf_cswap(a, b, r);
+		gf_cswap(c, d, r);
+	}
+	gf_inv(c, c);
+	gf_mul(a, a, c);
+	gf_pack(out, a);
+
+	OQS_MEM_cleanse(z, sizeof(z));
+	OQS_MEM_cleanse(a, sizeof(gf));
+	OQS_MEM_cleanse(b, sizeof(gf));
+	OQS_MEM_cleanse(c, sizeof(gf));
+	OQS_MEM_cleanse(d, sizeof(gf));
+	OQS_MEM_cleanse(e, sizeof(gf));
+	OQS_MEM_cleanse(f, sizeof(gf));
+}
+
+void OQS_KEM_HYBRID_x25519_base(uint8_t out[OQS_X25519_BYTES], const uint8_t scalar[OQS_X25519_BYTES]) {
+	static const uint8_t base[OQS_X25519_BYTES] = {9};
+	OQS_KEM_HYBRID_x25519(out, scalar, base);
+}
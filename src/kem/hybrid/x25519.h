@@ -0,0 +1,17 @@
+// SPDX-License-Identifier: MIT
+
+#ifndef OQS_KEM_HYBRID_X25519_H
+#define OQS_KEM_HYBRID_X25519_H
+
+#include <stdint.h>
+
+#define OQS_X25519_BYTES 32
+
+/* Constant-time X25519 scalar multiplication (RFC 7748, Section 5). */
+void OQS_KEM_HYBRID_x25519(uint8_t out[OQS_X25519_BYTES], const uint8_t scalar[OQS_X25519_BYTES],
+                           const uint8_t point[OQS_X25519_BYTES]);
+
+/* out = scalar * 9, the X25519 public key for `scalar`. */
+void OQS_KEM_HYBRID_x25519_base(uint8_t out[OQS_X25519_BYTES], const uint8_t scalar[OQS_X25519_BYTES]);
+
+#endif // OQS_KEM_HYBRID_X25519_H
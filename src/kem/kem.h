@@ -339,6 +339,173 @@ OQS_API OQS_STATUS OQS_KEM_decaps(const OQS_KEM *kem, uint8_t *shared_secret, co
  */
 OQS_API void OQS_KEM_free(OQS_KEM *kem);
 
+/**
+ * Warms up a KEM algorithm ahead of its first real use.
+ *
+ * Runs one keypair/encaps/decaps cycle on throwaway buffers. This resolves
+ * CPU feature dispatch, runs the lazy initializers of the algorithm and of
+ * the primitives it uses, and faults in the constant tables on the code path
+ * that is selected on this machine, so that the first operation performed
+ * afterwards runs at steady-state speed.
+ *
+ * The cost is that of one full cycle of the algorithm. The throwaway keys are
+ * drawn from a fixed-seed generator installed for the duration of the call with
+ * OQS_randombytes_set_thread_source(), so the warm-up consumes no output of the
+ * RNG configured by the application, whether process-wide or for the thread.
+ * Embedded builds have no per-thread sources; there the throwaway keys are drawn
+ * from the source set with OQS_randombytes_custom_algorithm(), which must be
+ * set before the call.
+ *
+ * @param[in] method_name Name of the desired algorithm; one of the names in `OQS_KEM_algs`.
+ * @return OQS_SUCCESS, or OQS_ERROR if the algorithm is unknown or disabled, or an operation failed.
+ */
+OQS_API OQS_STATUS OQS_KEM_warmup(const char *method_name);
+
+/**
+ * Opaque handle to an imported KEM key.
+ *
+ * A key handle holds a copy of the encoded key and, where the algorithm
+ * supports it, a parsed or precomputed form of it (for ML-KEM: the expanded
+ * matrix A and the key vectors in the NTT domain), so that repeated
+ * operations with the same key do not decode it again on every call.
+ * Algorithms without such support keep only the bytes and forward to
+ * OQS_KEM_encaps() / OQS_KEM_decaps(), as do ML-KEM keys that fail the input
+ * checks of FIPS 203, so that operations with them fail as before. A handle is
+ * immutable after import and may be used concurrently from several threads.
+ */
+typedef struct OQS_KEM_KEY OQS_KEM_KEY;
+
+/** OQS_KEM_key_import() flag: the bytes are a public key. */
+#define OQS_KEM_KEY_PUBLIC 0x1u
+/** OQS_KEM_key_import() flag: the bytes are a secret key. */
+#define OQS_KEM_KEY_SECRET 0x2u
+/** OQS_KEM_key_import() flag: only keep the bytes, do not precompute. */
+#define OQS_KEM_KEY_BYTES_ONLY 0x100u
+/**
+ * OQS_KEM_key_import() flag, with OQS_KEM_KEY_SECRET only: the bytes are the
+ * seed the secret key is generated from with OQS_KEM_keypair_derand() (for
+ * ML-KEM, the 64-byte d || z of FIPS 203).
+ */
+#define OQS_KEM_KEY_SEED 0x200u
+
+/**
+ * Imports an encoded public or secret key into a key handle.
+ *
+ * With OQS_KEM_KEY_SEED, the secret key is generated from the seed at import
+ * and the handle also keeps the seed for OQS_KEM_key_export_seed().
+ *
+ * @param[in] kem The OQS_KEM object the key belongs to.
+ * @param[in] key The encoded key, or the seed with OQS_KEM_KEY_SEED.
+ * @param[in] key_len Length of `key`; must equal the corresponding `length_*` member of `kem`, or `length_keypair_seed` with OQS_KEM_KEY_SEED.
+ * @param[in] flags Exactly one of OQS_KEM_KEY_PUBLIC and OQS_KEM_KEY_SECRET, optionally OR'ed with OQS_KEM_KEY_BYTES_ONLY and, for secret keys, OQS_KEM_KEY_SEED.
+ * @return A key handle to be freed with OQS_KEM_key_free(), or NULL on error.
+ */
+OQS_API OQS_KEM_KEY *OQS_KEM_key_import(const OQS_KEM *kem, const uint8_t *key, size_t key_len, uint32_t flags);
+
+/**
+ * Frees a key handle, zeroing any secret material it holds.
+ *
+ * @param[in] key The key handle to free; may be NULL.
+ */
+OQS_API void OQS_KEM_key_free(OQS_KEM_KEY *key);
+
+/**
+ * Indicates whether a key handle holds an algorithm-specific precomputed form
+ * of the key, rather than only its encoding.
+ *
+ * @param[in] key The key handle.
+ * @return true if the key was precomputed at import.
+ */
+OQS_API bool OQS_KEM_key_is_expanded(const OQS_KEM_KEY *key);
+
+/**
+ * Encapsulation with an imported public key; see OQS_KEM_encaps().
+ *
+ * @param[in] kem The OQS_KEM object representing the KEM.
+ * @param[out] ciphertext The ciphertext (encapsulation) represented as a byte string.
+ * @param[out] shared_secret The shared secret represented as a byte string.
+ * @param[in] public_key A public key handle imported for `kem`.
+ * @return OQS_SUCCESS or OQS_ERROR
+ */
+OQS_API OQS_STATUS OQS_KEM_key_encaps(const OQS_KEM *kem, uint8_t *ciphertext, uint8_t *shared_secret, const OQS_KEM_KEY *public_key);
+
+/**
+ * Decapsulation with an imported secret key; see OQS_KEM_decaps().
+ *
+ * @param[in] kem The OQS_KEM object representing the KEM.
+ * @param[out] shared_secret The shared secret represented as a byte string.
+ * @param[in] ciphertext The ciphertext (encapsulation) represented as a byte string.
+ * @param[in] secret_key A secret key handle imported for `kem`.
+ * @return OQS_SUCCESS or OQS_ERROR
+ */
+OQS_API OQS_STATUS OQS_KEM_key_decaps(const OQS_KEM *kem, uint8_t *shared_secret, const uint8_t *ciphertext, const OQS_KEM_KEY *secret_key);
+
+/**
+ * Writes the encoded key held by a key handle.
+ *
+ * @param[in] key The key handle.
+ * @param[out] out The encoded public or secret key.
+ * @param[in] out_len Length of `out`; must equal the length of the encoded key.
+ * @return OQS_SUCCESS or OQS_ERROR
+ */
+OQS_API OQS_STATUS OQS_KEM_key_export(const OQS_KEM_KEY *key, uint8_t *out, size_t out_len);
+
+/**
+ * Writes the seed of a secret key handle imported with OQS_KEM_KEY_SEED.
+ *
+ * @param[in] key The key handle.
+ * @param[out] seed The seed.
+ * @param[in] seed_len Length of `seed`; must equal `length_keypair_seed`.
+ * @return OQS_SUCCESS, or OQS_ERROR if the handle was not imported from a seed.
+ */
+OQS_API OQS_STATUS OQS_KEM_key_export_seed(const OQS_KEM_KEY *key, uint8_t *seed, size_t seed_len);
+
+/**
+ * Opaque cache of secret keys expanded from their seeds.
+ *
+ * Decapsulation through the cache takes the secret key as its seed, so that
+ * keys can be stored in seed form, and keeps recently used keys imported
+ * within a memory budget, evicting the least recently used ones. A miss costs
+ * a key generation. When liboqs is built with pthreads, a cache may be used
+ * concurrently from several threads.
+ */
+typedef struct OQS_KEM_KEY_CACHE OQS_KEM_KEY_CACHE;
+
+/**
+ * Creates a key expansion cache.
+ *
+ * @param[in] kem The OQS_KEM object the keys belong to; it must outlive the cache and support OQS_KEM_keypair_derand().
+ * @param[in] max_bytes The memory budget of the cached keys, in bytes; see OQS_KEY_CACHE_STATS.bytes.
+ * @return A cache to be freed with OQS_KEM_key_cache_free(), or NULL on error.
+ */
+OQS_API OQS_KEM_KEY_CACHE *OQS_KEM_key_cache_new(const OQS_KEM *kem, size_t max_bytes);
+
+/**
+ * Frees a key expansion cache and all keys in it, zeroing their secret material.
+ *
+ * @param[in] cache The cache to free; may be NULL.
+ */
+OQS_API void OQS_KEM_key_cache_free(OQS_KEM_KEY_CACHE *cache);
+
+/**
+ * Decapsulation with a secret key given by its seed, expanded through a cache.
+ *
+ * @param[in] cache The key expansion cache.
+ * @param[out] shared_secret The shared secret represented as a byte string.
+ * @param[in] ciphertext The ciphertext (encapsulation) represented as a byte string.
+ * @param[in] seed The seed of the secret key, of `length_keypair_seed` bytes.
+ * @return OQS_SUCCESS or OQS_ERROR
+ */
+OQS_API OQS_STATUS OQS_KEM_key_cache_decaps(OQS_KEM_KEY_CACHE *cache, uint8_t *shared_secret, const uint8_t *ciphertext, const uint8_t *seed);
+
+/**
+ * Reads the counters of a key expansion cache.
+ *
+ * @param[in] cache The key expansion cache.
+ * @param[out] stats The counters.
+ */
+OQS_API void OQS_KEM_key_cache_stats(OQS_KEM_KEY_CACHE *cache, OQS_KEY_CACHE_STATS *stats);
+
 #ifdef OQS_ENABLE_KEM_BIKE
 #include <oqs/kem_bike.h>
 #endif /* OQS_ENABLE_KEM_BIKE */
@@ -0,0 +1,218 @@
+// SPDX-License-Identifier: MIT
+
+#include <string.h>
+#if defined(_WIN32)
+#define strcasecmp _stricmp
+#else
+#include <strings.h>
+#endif
+
+#include <oqs/oqs.h>
+#include <oqs/sha3.h>
+
+#include "../common/key_cache.h"
+#include "kem_key.h"
+
+/* Precomputed-key hooks by algorithm; NULL keeps the key as bytes. */
+static const OQS_KEM_KEY_ops *kem_key_ops(const char *method_name) {
+#if defined(OQS_ENABLE_KEM_ml_kem_512)
+	if (0 == strcasecmp(method_name, OQS_KEM_alg_ml_kem_512)) {
+		return OQS_KEM_ml_kem_512_key_ops();
+	}
+#endif
+#if defined(OQS_ENABLE_KEM_ml_kem_768)
+	if (0 == strcasecmp(method_name, OQS_KEM_alg_ml_kem_768)) {
+		return OQS_KEM_ml_kem_768_key_ops();
+	}
+#endif
+#if defined(OQS_ENABLE_KEM_ml_kem_1024)
+	if (0 == strcasecmp(method_name, OQS_KEM_alg_ml_kem_1024)) {
+		return OQS_KEM_ml_kem_1024_key_ops();
+	}
+#endif
+	(void) method_name;
+	return NULL;
+}
+
+OQS_API OQS_KEM_KEY *OQS_KEM_key_import(const OQS_KEM *kem, const uint8_t *key, size_t key_len, uint32_t flags) {
+	uint32_t type = flags & (OQS_KEM_KEY_PUBLIC | OQS_KEM_KEY_SECRET);
+	size_t expected_len;
+
+	if (kem == NULL || key == NULL || (flags & ~(OQS_KEM_KEY_PUBLIC | OQS_KEM_KEY_SECRET | OQS_KEM_KEY_BYTES_ONLY | OQS_KEM_KEY_SEED)) != 0) {
+		return NULL;
+	}
+	if (type == OQS_KEM_KEY_PUBLIC && !(flags & OQS_KEM_KEY_SEED)) {
+		expected_len = kem->length_public_key;
+	} else if (type == OQS_KEM_KEY_SECRET) {
+		expected_len = (flags & OQS_KEM_KEY_SEED) ? kem->length_keypair_seed : kem->length_secret_key;
+	} else {
+		return NULL;
+	}
+	/* a zero seed length means no derandomized key generation */
+	if (key_len != expected_len || expected_len == 0) {
+		return NULL;
+	}
+
+	OQS_KEM_KEY *handle = OQS_MEM_calloc(1, sizeof(OQS_KEM_KEY));
+	if (handle == NULL) {
+		return NULL;
+	}
+	handle->method_name = kem->method_name;
+	handle->type = type;
+	if (flags & OQS_KEM_KEY_SEED) {
+		uint8_t *public_key = OQS_MEM_malloc(kem->length_public_key);
+		handle->bytes_len = kem->length_secret_key;
+		handle->bytes = OQS_MEM_malloc(handle->bytes_len);
+		handle->seed_len = key_len;
+		handle->seed = OQS_MEM_malloc(key_len);
+		if (public_key == NULL || handle->bytes == NULL || handle->seed == NULL ||
+		        OQS_KEM_keypair_derand(kem, public_key, handle->bytes, key) != OQS_SUCCESS) {
+			OQS_MEM_insecure_free(public_key);
+			OQS_KEM_key_free(handle);
+			return NULL;
+		}
+		OQS_MEM_insecure_free(public_key);
+		memcpy(handle->seed, key, key_len);
+	} else {
+		handle->bytes_len = key_len;
+		handle->bytes = OQS_MEM_malloc(key_len);
+		if (handle->bytes == NULL) {
+			OQS_MEM_insecure_free(handle);
+			return NULL;
+		}
+		memcpy(handle->bytes, key, key_len);
+	}
+
+	if (!(flags & OQS_KEM_KEY_BYTES_ONLY)) {
+		handle->ops = kem_key_ops(kem->method_name);
+		/* a failed precomputation leaves a bytes-only handle */
+		if (handle->ops != NULL && handle->ops->expand(handle) != OQS_SUCCESS) {
+			handle->ops = NULL;
+		}
+	}
+	return handle;
+}
+
+OQS_API void OQS_KEM_key_free(OQS_KEM_KEY *key) {
+	if (key == NULL) {
+		return;
+	}
+	OQS_MEM_secure_free(key->expanded, key->expanded_len);
+	OQS_MEM_secure_free(key->bytes, key->bytes_len);
+	OQS_MEM_secure_free(key->seed, key->seed_len);
+	OQS_MEM_insecure_free(key);
+}
+
+OQS_API bool OQS_KEM_key_is_expanded(const OQS_KEM_KEY *key) {
+	return key != NULL && key->expanded != NULL;
+}
+
+static bool kem_key_matches(const OQS_KEM *kem, const OQS_KEM_KEY *key, uint32_t type) {
+	return kem != NULL && key != NULL && key->type == type && 0 == strcmp(kem->method_name, key->method_name);
+}
+
+OQS_API OQS_STATUS OQS_KEM_key_encaps(const OQS_KEM *kem, uint8_t *ciphertext, uint8_t *shared_secret, const OQS_KEM_KEY *public_key) {
+	if (!kem_key_matches(kem, public_key, OQS_KEM_KEY_PUBLIC)) {
+		return OQS_ERROR;
+	}
+	if (public_key->expanded != NULL) {
+		return public_key->ops->encaps(ciphertext, shared_secret, public_key);
+	}
+	return OQS_KEM_encaps(kem, ciphertext, shared_secret, public_key->bytes);
+}
+
+OQS_API OQS_STATUS OQS_KEM_key_decaps(const OQS_KEM *kem, uint8_t *shared_secret, const uint8_t *ciphertext, const OQS_KEM_KEY *secret_key) {
+	if (!kem_key_matches(kem, secret_key, OQS_KEM_KEY_SECRET)) {
+		return OQS_ERROR;
+	}
+	if (secret_key->expanded != NULL) {
+		return secret_key->ops->decaps(shared_secret, ciphertext, secret_key);
+	}
+	return OQS_KEM_decaps(kem, shared_secret, ciphertext, secret_key->bytes);
+}
+
+OQS_API OQS_STATUS OQS_KEM_key_export(const OQS_KEM_KEY *key, uint8_t *out, size_t out_len) {
+	if (key == NULL || out == NULL || out_len != key->bytes_len) {
+		return OQS_ERROR;
+	}
+	memcpy(out, key->bytes, out_len);
+	return OQS_SUCCESS;
+}
+
+OQS_API OQS_STATUS OQS_KEM_key_export_seed(const OQS_KEM_KEY *key, uint8_t *seed, size_t seed_len) {
+	if (key == NULL || key->seed == NULL || seed == NULL || seed_len != key->seed_len) {
+		return OQS_ERROR;
+	}
+	memcpy(seed, key->seed, seed_len);
+	return OQS_SUCCESS;
+}
+
+struct OQS_KEM_KEY_CACHE {
+	const OQS_KEM *kem;
+	OQS_KEY_CACHE *cache;
+};
+
+static void kem_key_cache_free_value(void *value) {
+	OQS_KEM_key_free((OQS_KEM_KEY *) value);
+}
+
+OQS_API OQS_KEM_KEY_CACHE *OQS_KEM_key_cache_new(const OQS_KEM *kem, size_t max_bytes) {
+	OQS_KEM_KEY_CACHE *cache;
+
+	if (kem == NULL || kem->length_keypair_seed == 0) {
+		return NULL;
+	}
+	cache = OQS_MEM_malloc(sizeof(OQS_KEM_KEY_CACHE));
+	if (cache == NULL) {
+		return NULL;
+	}
+	cache->kem = kem;
+	cache->cache = OQS_KEY_CACHE_new(max_bytes, kem_key_cache_free_value);
+	if (cache->cache == NULL) {
+		OQS_MEM_insecure_free(cache);
+		return NULL;
+	}
+	return cache;
+}
+
+OQS_API void OQS_KEM_key_cache_free(OQS_KEM_KEY_CACHE *cache) {
+	if (cache == NULL) {
+		return;
+	}
+	OQS_KEY_CACHE_free(cache->cache);
+	OQS_MEM_insecure_free(cache);
+}
+
+OQS_API OQS_STATUS OQS_KEM_key_cache_decaps(OQS_KEM_KEY_CACHE *cache, uint8_t *shared_secret, const uint8_t *ciphertext, const uint8_t *seed) {
+	/* keys are looked up by a hash of the seed, so that the table itself
+	 * holds no secret material */
+	uint8_t id[OQS_KEY_CACHE_ID_BYTES];
+	OQS_KEY_CACHE_ENTRY *entry;
+	OQS_STATUS rc;
+
+	if (cache == NULL || seed == NULL) {
+		return OQS_ERROR;
+	}
+	OQS_SHA3_sha3_256(id, seed, cache->kem->length_keypair_seed);
+	entry = OQS_KEY_CACHE_acquire(cache->cache, id);
+	if (entry == NULL) {
+		OQS_KEM_KEY *handle = OQS_KEM_key_import(cache->kem, seed, cache->kem->length_keypair_seed, OQS_KEM_KEY_SECRET | OQS_KEM_KEY_SEED);
+		if (handle == NULL) {
+			return OQS_ERROR;
+		}
+		entry = OQS_KEY_CACHE_insert(cache->cache, id, handle, sizeof(OQS_KEM_KEY) + handle->bytes_len + handle->seed_len + handle->expanded_len);
+		if (entry == NULL) {
+			return OQS_ERROR;
+		}
+	}
+	rc = OQS_KEM_key_decaps(cache->kem, shared_secret, ciphertext, (const OQS_KEM_KEY *) OQS_KEY_CACHE_value(entry));
+	OQS_KEY_CACHE_release(cache->cache, entry);
+	return rc;
+}
+
+OQS_API void OQS_KEM_key_cache_stats(OQS_KEM_KEY_CACHE *cache, OQS_KEY_CACHE_STATS *stats) {
+	if (cache == NULL || stats == NULL) {
+		return;
+	}
+	OQS_KEY_CACHE_stats(cache->cache, stats);
+}
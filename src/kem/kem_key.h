@@ -0,0 +1,55 @@
+// SPDX-License-Identifier: MIT
+
+/*
+ * Internal definition of OQS_KEM_KEY and the per-algorithm hooks behind
+ * OQS_KEM_key_import(). Not installed.
+ */
+
+#ifndef OQS_KEM_KEY_INTERNAL_H
+#define OQS_KEM_KEY_INTERNAL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <oqs/oqs.h>
+
+/*
+ * Algorithm hooks for precomputed keys. `expand` fills key->expanded (and
+ * key->expanded_len) from key->bytes, allocating with OQS_MEM_malloc; the
+ * generic code frees it with OQS_MEM_secure_free. `encaps` is only called with
+ * expanded public keys and `decaps` only with expanded secret keys.
+ */
+typedef struct OQS_KEM_KEY_ops {
+	OQS_STATUS (*expand)(OQS_KEM_KEY *key);
+	OQS_STATUS (*encaps)(uint8_t *ciphertext, uint8_t *shared_secret, const OQS_KEM_KEY *public_key);
+	OQS_STATUS (*decaps)(uint8_t *shared_secret, const uint8_t *ciphertext, const OQS_KEM_KEY *secret_key);
+} OQS_KEM_KEY_ops;
+
+struct OQS_KEM_KEY {
+	/* method_name of the OQS_KEM the key was imported for */
+	const char *method_name;
+	/* OQS_KEM_KEY_PUBLIC or OQS_KEM_KEY_SECRET */
+	uint32_t type;
+	uint8_t *bytes;
+	size_t bytes_len;
+	/* seed the secret key was generated from (OQS_KEM_KEY_SEED), or NULL */
+	uint8_t *seed;
+	size_t seed_len;
+	/* algorithm-specific form, or NULL if only the bytes are held */
+	void *expanded;
+	size_t expanded_len;
+	const OQS_KEM_KEY_ops *ops;
+};
+
+/* Returns the hooks for the current platform, or NULL to keep keys as bytes. */
+#if defined(OQS_ENABLE_KEM_ml_kem_512)
+const OQS_KEM_KEY_ops *OQS_KEM_ml_kem_512_key_ops(void);
+#endif
+#if defined(OQS_ENABLE_KEM_ml_kem_768)
+const OQS_KEM_KEY_ops *OQS_KEM_ml_kem_768_key_ops(void);
+#endif
+#if defined(OQS_ENABLE_KEM_ml_kem_1024)
+const OQS_KEM_KEY_ops *OQS_KEM_ml_kem_1024_key_ops(void);
+#endif
+
+#endif // OQS_KEM_KEY_INTERNAL_H
@@ -4,6 +4,8 @@
 
 #include <oqs/kem_ml_kem.h>
 
+#include "../kem_key.h"
+
 #if defined(OQS_ENABLE_KEM_ml_kem_512)
 
 OQS_KEM *OQS_KEM_ml_kem_512_new(void) {
@@ -34,26 +36,26 @@ OQS_KEM *OQS_KEM_ml_kem_512_new(void) {
 	return kem;
 }
 
-extern int PQCP_MLKEM_NATIVE_MLKEM512_C_keypair(uint8_t *pk, uint8_t *sk);
-extern int PQCP_MLKEM_NATIVE_MLKEM512_C_keypair_derand(uint8_t *pk, uint8_t *sk, const uint8_t *seed);
-extern int PQCP_MLKEM_NATIVE_MLKEM512_C_enc(uint8_t *ct, uint8_t *ss, const uint8_t *pk);
-extern int PQCP_MLKEM_NATIVE_MLKEM512_C_enc_derand(uint8_t *ct, uint8_t *ss, const uint8_t *pk, const uint8_t *seed);
-extern int PQCP_MLKEM_NATIVE_MLKEM512_C_dec(uint8_t *ss, const uint8_t *ct, const uint8_t *sk);
+extern int PQCP_MLKEM_NATIVE_C_MLKEM512_keypair(uint8_t *pk, uint8_t *sk);
+extern int PQCP_MLKEM_NATIVE_C_MLKEM512_keypair_derand(uint8_t *pk, uint8_t *sk, const uint8_t *seed);
+extern int PQCP_MLKEM_NATIVE_C_MLKEM512_enc(uint8_t *ct, uint8_t *ss, const uint8_t *pk);
+extern int PQCP_MLKEM_NATIVE_C_MLKEM512_enc_derand(uint8_t *ct, uint8_t *ss, const uint8_t *pk, const uint8_t *seed);
+extern int PQCP_MLKEM_NATIVE_C_MLKEM512_dec(uint8_t *ss, const uint8_t *ct, const uint8_t *sk);
 
 #if defined(OQS_ENABLE_KEM_ml_kem_512_x86_64)
-extern int PQCP_MLKEM_NATIVE_MLKEM512_X86_64_keypair(uint8_t *pk, uint8_t *sk);
-extern int PQCP_MLKEM_NATIVE_MLKEM512_X86_64_keypair_derand(uint8_t *pk, uint8_t *sk, const uint8_t *seed);
-extern int PQCP_MLKEM_NATIVE_MLKEM512_X86_64_enc(uint8_t *ct, uint8_t *ss, const uint8_t *pk);
-extern int PQCP_MLKEM_NATIVE_MLKEM512_X86_64_enc_derand(uint8_t *ct, uint8_t *ss, const uint8_t *pk, const uint8_t *seed);
-extern int PQCP_MLKEM_NATIVE_MLKEM512_X86_64_dec(uint8_t *ss, const uint8_t *ct, const uint8_t *sk);
+extern int PQCP_MLKEM_NATIVE_X86_64_MLKEM512_keypair(uint8_t *pk, uint8_t *sk);
+extern int PQCP_MLKEM_NATIVE_X86_64_MLKEM512_keypair_derand(uint8_t *pk, uint8_t *sk, const uint8_t *seed);
+extern int PQCP_MLKEM_NATIVE_X86_64_MLKEM512_enc(uint8_t *ct, uint8_t *ss, const uint8_t *pk);
+extern int PQCP_MLKEM_NATIVE_X86_64_MLKEM512_enc_derand(uint8_t *ct, uint8_t *ss, const uint8_t *pk, const uint8_t *seed);
+extern int PQCP_MLKEM_NATIVE_X86_64_MLKEM512_dec(uint8_t *ss, const uint8_t *ct, const uint8_t *sk);
 #endif
 
 #if defined(OQS_ENABLE_KEM_ml_kem_512_aarch64)
-extern int PQCP_MLKEM_NATIVE_MLKEM512_AARCH64_keypair(uint8_t *pk, uint8_t *sk);
-extern int PQCP_MLKEM_NATIVE_MLKEM512_AARCH64_keypair_derand(uint8_t *pk, uint8_t *sk, const uint8_t *seed);
-extern int PQCP_MLKEM_NATIVE_MLKEM512_AARCH64_enc(uint8_t *ct, uint8_t *ss, const uint8_t *pk);
-extern int PQCP_MLKEM_NATIVE_MLKEM512_AARCH64_enc_derand(uint8_t *ct, uint8_t *ss, const uint8_t *pk, const uint8_t *seed);
-extern int PQCP_MLKEM_NATIVE_MLKEM512_AARCH64_dec(uint8_t *ss, const uint8_t *ct, const uint8_t *sk);
+extern int PQCP_MLKEM_NATIVE_AARCH64_MLKEM512_keypair(uint8_t *pk, uint8_t *sk);
+extern int PQCP_MLKEM_NATIVE_AARCH64_MLKEM512_keypair_derand(uint8_t *pk, uint8_t *sk, const uint8_t *seed);
+extern int PQCP_MLKEM_NATIVE_AARCH64_MLKEM512_enc(uint8_t *ct, uint8_t *ss, const uint8_t *pk);
+extern int PQCP_MLKEM_NATIVE_AARCH64_MLKEM512_enc_derand(uint8_t *ct, uint8_t *ss, const uint8_t *pk, const uint8_t *seed);
+extern int PQCP_MLKEM_NATIVE_AARCH64_MLKEM512_dec(uint8_t *ss, const uint8_t *ct, const uint8_t *sk);
 #endif
 
 #if defined(OQS_USE_CUPQC)
@@ -78,20 +80,20 @@ OQS_API OQS_STATUS OQS_KEM_ml_kem_512_keypair_derand(uint8_t *public_key, uint8_
 #if defined(OQS_DIST_BUILD)
 	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2) && OQS_CPU_has_extension(OQS_CPU_EXT_BMI2) && OQS_CPU_has_extension(OQS_CPU_EXT_POPCNT)) {
 #endif /* OQS_DIST_BUILD */
-		return (OQS_STATUS) PQCP_MLKEM_NATIVE_MLKEM512_X86_64_keypair_derand(public_key, secret_key, seed);
+		return (OQS_STATUS) PQCP_MLKEM_NATIVE_X86_64_MLKEM512_keypair_derand(public_key, secret_key, seed);
 #if defined(OQS_DIST_BUILD)
 	} else {
-		return (OQS_STATUS) PQCP_MLKEM_NATIVE_MLKEM512_C_keypair_derand(public_key, secret_key, seed);
+		return (OQS_STATUS) PQCP_MLKEM_NATIVE_C_MLKEM512_keypair_derand(public_key, secret_key, seed);
 	}
 #endif /* OQS_DIST_BUILD */
 #elif defined(OQS_ENABLE_KEM_ml_kem_512_aarch64)
 #if defined(OQS_DIST_BUILD)
 	if (OQS_CPU_has_extension(OQS_CPU_EXT_ARM_NEON)) {
 #endif /* OQS_DIST_BUILD */
-		return (OQS_STATUS) PQCP_MLKEM_NATIVE_MLKEM512_AARCH64_keypair_derand(public_key, secret_key, seed);
+		return (OQS_STATUS) PQCP_MLKEM_NATIVE_AARCH64_MLKEM512_keypair_derand(public_key, secret_key, seed);
 #if defined(OQS_DIST_BUILD)
 	} else {
-		return (OQS_STATUS) PQCP_MLKEM_NATIVE_MLKEM512_C_keypair_derand(public_key, secret_key, seed);
+		return (OQS_STATUS) PQCP_MLKEM_NATIVE_C_MLKEM512_keypair_derand(public_key, secret_key, seed);
 	}
 #endif /* OQS_DIST_BUILD */
 #elif defined(OQS_ENABLE_KEM_ml_kem_512_cuda)
@@ -99,7 +101,7 @@ OQS_API OQS_STATUS OQS_KEM_ml_kem_512_keypair_derand(uint8_t *public_key, uint8_
 #elif defined(OQS_ENABLE_KEM_ml_kem_512_icicle_cuda)
 	return (OQS_STATUS) PQCLEAN_MLKEM512_ICICLE_CUDA_crypto_kem_keypair_derand(public_key, secret_key, seed);
 #else
-	return (OQS_STATUS) PQCP_MLKEM_NATIVE_MLKEM512_C_keypair_derand(public_key, secret_key, seed);
+	return (OQS_STATUS) PQCP_MLKEM_NATIVE_C_MLKEM512_keypair_derand(public_key, secret_key, seed);
 #endif
 }
 
@@ -114,24 +116,24 @@ OQS_API OQS_STATUS OQS_KEM_ml_kem_512_keypair(uint8_t *public_key, uint8_t *secr
 #if defined(OQS_DIST_BUILD)
 	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2) && OQS_CPU_has_extension(OQS_CPU_EXT_BMI2) && OQS_CPU_has_extension(OQS_CPU_EXT_POPCNT)) {
 #endif /* OQS_DIST_BUILD */
-		return (OQS_STATUS) PQCP_MLKEM_NATIVE_MLKEM512_X86_64_keypair(public_key, secret_key);
+		return (OQS_STATUS) PQCP_MLKEM_NATIVE_X86_64_MLKEM512_keypair(public_key, secret_key);
 #if defined(OQS_DIST_BUILD)
 	} else {
-		return (OQS_STATUS) PQCP_MLKEM_NATIVE_MLKEM512_C_keypair(public_key, secret_key);
+		return (OQS_STATUS) PQCP_MLKEM_NATIVE_C_MLKEM512_keypair(public_key, secret_key);
 	}
 #endif /* OQS_DIST_BUILD */
 #elif defined(OQS_ENABLE_KEM_ml_kem_512_aarch64)
 #if defined(OQS_DIST_BUILD)
 	if (OQS_CPU_has_extension(OQS_CPU_EXT_ARM_NEON)) {
 #endif /* OQS_DIST_BUILD */
-		return (OQS_STATUS) PQCP_MLKEM_NATIVE_MLKEM512_AARCH64_keypair(public_key, secret_key);
+		return (OQS_STATUS) PQCP_MLKEM_NATIVE_AARCH64_MLKEM512_keypair(public_key, secret_key);
 #if defined(OQS_DIST_BUILD)
 	} else {
-		return (OQS_STATUS) PQCP_MLKEM_NATIVE_MLKEM512_C_keypair(public_key, secret_key);
+		return (OQS_STATUS) PQCP_MLKEM_NATIVE_C_MLKEM512_keypair(public_key, secret_key);
 	}
 #endif /* OQS_DIST_BUILD */
 #else
-	return (OQS_STATUS) PQCP_MLKEM_NATIVE_MLKEM512_C_keypair(public_key, secret_key);
+	return (OQS_STATUS) PQCP_MLKEM_NATIVE_C_MLKEM512_keypair(public_key, secret_key);
 #endif
 }
 
@@ -140,20 +142,20 @@ OQS_API OQS_STATUS OQS_KEM_ml_kem_512_encaps_derand(uint8_t *ciphertext, uint8_t
 #if defined(OQS_DIST_BUILD)
 	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2) && OQS_CPU_has_extension(OQS_CPU_EXT_BMI2) && OQS_CPU_has_extension(OQS_CPU_EXT_POPCNT)) {
 #endif /* OQS_DIST_BUILD */
-		return (OQS_STATUS) PQCP_MLKEM_NATIVE_MLKEM512_X86_64_enc_derand(ciphertext, shared_secret, public_key, seed);
+		return (OQS_STATUS) PQCP_MLKEM_NATIVE_X86_64_MLKEM512_enc_derand(ciphertext, shared_secret, public_key, seed);
 #if defined(OQS_DIST_BUILD)
 	} else {
-		return (OQS_STATUS) PQCP_MLKEM_NATIVE_MLKEM512_C_enc_derand(ciphertext, shared_secret, public_key, seed);
+		return (OQS_STATUS) PQCP_MLKEM_NATIVE_C_MLKEM512_enc_derand(ciphertext, shared_secret, public_key, seed);
 	}
 #endif /* OQS_DIST_BUILD */
 #elif defined(OQS_ENABLE_KEM_ml_kem_512_aarch64)
 #if defined(OQS_DIST_BUILD)
 	if (OQS_CPU_has_extension(OQS_CPU_EXT_ARM_NEON)) {
 #endif /* OQS_DIST_BUILD */
-		return (OQS_STATUS) PQCP_MLKEM_NATIVE_MLKEM512_AARCH64_enc_derand(ciphertext, shared_secret, public_key, seed);
+		return (OQS_STATUS) PQCP_MLKEM_NATIVE_AARCH64_MLKEM512_enc_derand(ciphertext, shared_secret, public_key, seed);
 #if defined(OQS_DIST_BUILD)
 	} else {
-		return (OQS_STATUS) PQCP_MLKEM_NATIVE_MLKEM512_C_enc_derand(ciphertext, shared_secret, public_key, seed);
+		return (OQS_STATUS) PQCP_MLKEM_NATIVE_C_MLKEM512_enc_derand(ciphertext, shared_secret, public_key, seed);
 	}
 #endif /* OQS_DIST_BUILD */
 #elif defined(OQS_ENABLE_KEM_ml_kem_512_cuda)
@@ -161,7 +163,7 @@ OQS_API OQS_STATUS OQS_KEM_ml_kem_512_encaps_derand(uint8_t *ciphertext, uint8_t
 #elif defined(OQS_ENABLE_KEM_ml_kem_512_icicle_cuda)
 	return (OQS_STATUS) icicle_ml_kem_512_enc_derand(ciphertext, shared_secret, public_key, seed);
 #else
-	return (OQS_STATUS) PQCP_MLKEM_NATIVE_MLKEM512_C_enc_derand(ciphertext, shared_secret, public_key, seed);
+	return (OQS_STATUS) PQCP_MLKEM_NATIVE_C_MLKEM512_enc_derand(ciphertext, shared_secret, public_key, seed);
 #endif
 }
 
@@ -176,24 +178,24 @@ OQS_API OQS_STATUS OQS_KEM_ml_kem_512_encaps(uint8_t *ciphertext, uint8_t *share
 #if defined(OQS_DIST_BUILD)
 	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2) && OQS_CPU_has_extension(OQS_CPU_EXT_BMI2) && OQS_CPU_has_extension(OQS_CPU_EXT_POPCNT)) {
 #endif /* OQS_DIST_BUILD */
-		return (OQS_STATUS) PQCP_MLKEM_NATIVE_MLKEM512_X86_64_enc(ciphertext, shared_secret, public_key);
+		return (OQS_STATUS) PQCP_MLKEM_NATIVE_X86_64_MLKEM512_enc(ciphertext, shared_secret, public_key);
 #if defined(OQS_DIST_BUILD)
 	} else {
-		return (OQS_STATUS) PQCP_MLKEM_NATIVE_MLKEM512_C_enc(ciphertext, shared_secret, public_key);
+		return (OQS_STATUS) PQCP_MLKEM_NATIVE_C_MLKEM512_enc(ciphertext, shared_secret, public_key);
 	}
 #endif /* OQS_DIST_BUILD */
 #elif defined(OQS_ENABLE_KEM_ml_kem_512_aarch64)
 #if defined(OQS_DIST_BUILD)
 	if (OQS_CPU_has_extension(OQS_CPU_EXT_ARM_NEON)) {
 #endif /* OQS_DIST_BUILD */
-		return (OQS_STATUS) PQCP_MLKEM_NATIVE_MLKEM512_AARCH64_enc(ciphertext, shared_secret, public_key);
+		return (OQS_STATUS) PQCP_MLKEM_NATIVE_AARCH64_MLKEM512_enc(ciphertext, shared_secret, public_key);
 #if defined(OQS_DIST_BUILD)
 	} else {
-		return (OQS_STATUS) PQCP_MLKEM_NATIVE_MLKEM512_C_enc(ciphertext, shared_secret, public_key);
+		return (OQS_STATUS) PQCP_MLKEM_NATIVE_C_MLKEM512_enc(ciphertext, shared_secret, public_key);
 	}
 #endif /* OQS_DIST_BUILD */
 #else
-	return (OQS_STATUS) PQCP_MLKEM_NATIVE_MLKEM512_C_enc(ciphertext, shared_secret, public_key);
+	return (OQS_STATUS) PQCP_MLKEM_NATIVE_C_MLKEM512_enc(ciphertext, shared_secret, public_key);
 #endif
 }
 
@@ -208,25 +210,190 @@ OQS_API OQS_STATUS OQS_KEM_ml_kem_512_decaps(uint8_t *shared_secret, const uint8
 #if defined(OQS_DIST_BUILD)
 	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2) && OQS_CPU_has_extension(OQS_CPU_EXT_BMI2) && OQS_CPU_has_extension(OQS_CPU_EXT_POPCNT)) {
 #endif /* OQS_DIST_BUILD */
-		return (OQS_STATUS) PQCP_MLKEM_NATIVE_MLKEM512_X86_64_dec(shared_secret, ciphertext, secret_key);
+		return (OQS_STATUS) PQCP_MLKEM_NATIVE_X86_64_MLKEM512_dec(shared_secret, ciphertext, secret_key);
 #if defined(OQS_DIST_BUILD)
 	} else {
-		return (OQS_STATUS) PQCP_MLKEM_NATIVE_MLKEM512_C_dec(shared_secret, ciphertext, secret_key);
+		return (OQS_STATUS) PQCP_MLKEM_NATIVE_C_MLKEM512_dec(shared_secret, ciphertext, secret_key);
 	}
 #endif /* OQS_DIST_BUILD */
 #elif defined(OQS_ENABLE_KEM_ml_kem_512_aarch64)
 #if defined(OQS_DIST_BUILD)
 	if (OQS_CPU_has_extension(OQS_CPU_EXT_ARM_NEON)) {
 #endif /* OQS_DIST_BUILD */
-		return (OQS_STATUS) PQCP_MLKEM_NATIVE_MLKEM512_AARCH64_dec(shared_secret, ciphertext, secret_key);
+		return (OQS_STATUS) PQCP_MLKEM_NATIVE_AARCH64_MLKEM512_dec(shared_secret, ciphertext, secret_key);
 #if defined(OQS_DIST_BUILD)
 	} else {
-		return (OQS_STATUS) PQCP_MLKEM_NATIVE_MLKEM512_C_dec(shared_secret, ciphertext, secret_key);
+		return (OQS_STATUS) PQCP_MLKEM_NATIVE_C_MLKEM512_dec(shared_secret, ciphertext, secret_key);
 	}
 #endif /* OQS_DIST_BUILD */
 #else
-	return (OQS_STATUS) PQCP_MLKEM_NATIVE_MLKEM512_C_dec(shared_secret, ciphertext, secret_key);
+	return (OQS_STATUS) PQCP_MLKEM_NATIVE_C_MLKEM512_dec(shared_secret, ciphertext, secret_key);
+#endif
+}
+
+extern size_t PQCP_MLKEM_NATIVE_C_MLKEM512_expanded_pk_bytes(void);
+extern size_t PQCP_MLKEM_NATIVE_C_MLKEM512_expanded_sk_bytes(void);
+extern int PQCP_MLKEM_NATIVE_C_MLKEM512_expand_pk(void *epk, const uint8_t *pk);
+extern int PQCP_MLKEM_NATIVE_C_MLKEM512_expand_sk(void *esk, const uint8_t *sk);
+extern int PQCP_MLKEM_NATIVE_C_MLKEM512_enc_expanded(uint8_t *ct, uint8_t *ss, const void *epk);
+extern int PQCP_MLKEM_NATIVE_C_MLKEM512_dec_expanded(uint8_t *ss, const uint8_t *ct, const void *esk);
+
+#if defined(OQS_ENABLE_KEM_ml_kem_512_x86_64)
+extern size_t PQCP_MLKEM_NATIVE_X86_64_MLKEM512_expanded_pk_bytes(void);
+extern size_t PQCP_MLKEM_NATIVE_X86_64_MLKEM512_expanded_sk_bytes(void);
+extern int PQCP_MLKEM_NATIVE_X86_64_MLKEM512_expand_pk(void *epk, const uint8_t *pk);
+extern int PQCP_MLKEM_NATIVE_X86_64_MLKEM512_expand_sk(void *esk, const uint8_t *sk);
+extern int PQCP_MLKEM_NATIVE_X86_64_MLKEM512_enc_expanded(uint8_t *ct, uint8_t *ss, const void *epk);
+extern int PQCP_MLKEM_NATIVE_X86_64_MLKEM512_dec_expanded(uint8_t *ss, const uint8_t *ct, const void *esk);
+#endif
+
+#if defined(OQS_ENABLE_KEM_ml_kem_512_aarch64)
+extern size_t PQCP_MLKEM_NATIVE_AARCH64_MLKEM512_expanded_pk_bytes(void);
+extern size_t PQCP_MLKEM_NATIVE_AARCH64_MLKEM512_expanded_sk_bytes(void);
+extern int PQCP_MLKEM_NATIVE_AARCH64_MLKEM512_expand_pk(void *epk, const uint8_t *pk);
+extern int PQCP_MLKEM_NATIVE_AARCH64_MLKEM512_expand_sk(void *esk, const uint8_t *sk);
+extern int PQCP_MLKEM_NATIVE_AARCH64_MLKEM512_enc_expanded(uint8_t *ct, uint8_t *ss, const void *epk);
+extern int PQCP_MLKEM_NATIVE_AARCH64_MLKEM512_dec_expanded(uint8_t *ss, const uint8_t *ct, const void *esk);
+#endif
+
+static OQS_STATUS ml_kem_512_key_expand(OQS_KEM_KEY *key) {
+	size_t len = (key->type == OQS_KEM_KEY_SECRET) ? PQCP_MLKEM_NATIVE_C_MLKEM512_expanded_sk_bytes() : PQCP_MLKEM_NATIVE_C_MLKEM512_expanded_pk_bytes();
+	void *expanded = OQS_MEM_malloc(len);
+	int rc;
+	if (expanded == NULL) {
+		return OQS_ERROR;
+	}
+	if (key->type == OQS_KEM_KEY_SECRET) {
+		rc = PQCP_MLKEM_NATIVE_C_MLKEM512_expand_sk(expanded, key->bytes);
+	} else {
+		rc = PQCP_MLKEM_NATIVE_C_MLKEM512_expand_pk(expanded, key->bytes);
+	}
+	/* the key failed the input checks of FIPS 203 */
+	if (rc != 0) {
+		OQS_MEM_secure_free(expanded, len);
+		return OQS_ERROR;
+	}
+	key->expanded = expanded;
+	key->expanded_len = len;
+	return OQS_SUCCESS;
+}
+
+static OQS_STATUS ml_kem_512_key_encaps(uint8_t *ciphertext, uint8_t *shared_secret, const OQS_KEM_KEY *public_key) {
+	return (OQS_STATUS) PQCP_MLKEM_NATIVE_C_MLKEM512_enc_expanded(ciphertext, shared_secret, public_key->expanded);
+}
+
+static OQS_STATUS ml_kem_512_key_decaps(uint8_t *shared_secret, const uint8_t *ciphertext, const OQS_KEM_KEY *secret_key) {
+	return (OQS_STATUS) PQCP_MLKEM_NATIVE_C_MLKEM512_dec_expanded(shared_secret, ciphertext, secret_key->expanded);
+}
+
+static const OQS_KEM_KEY_ops ml_kem_512_key_ops = {
+	.expand = ml_kem_512_key_expand,
+	.encaps = ml_kem_512_key_encaps,
+	.decaps = ml_kem_512_key_decaps,
+};
+
+#if defined(OQS_ENABLE_KEM_ml_kem_512_x86_64)
+static OQS_STATUS ml_kem_512_x86_64_key_expand(OQS_KEM_KEY *key) {
+	size_t len = (key->type == OQS_KEM_KEY_SECRET) ? PQCP_MLKEM_NATIVE_X86_64_MLKEM512_expanded_sk_bytes() : PQCP_MLKEM_NATIVE_X86_64_MLKEM512_expanded_pk_bytes();
+	void *expanded = OQS_MEM_malloc(len);
+	int rc;
+	if (expanded == NULL) {
+		return OQS_ERROR;
+	}
+	if (key->type == OQS_KEM_KEY_SECRET) {
+		rc = PQCP_MLKEM_NATIVE_X86_64_MLKEM512_expand_sk(expanded, key->bytes);
+	} else {
+		rc = PQCP_MLKEM_NATIVE_X86_64_MLKEM512_expand_pk(expanded, key->bytes);
+	}
+	/* the key failed the input checks of FIPS 203 */
+	if (rc != 0) {
+		OQS_MEM_secure_free(expanded, len);
+		return OQS_ERROR;
+	}
+	key->expanded = expanded;
+	key->expanded_len = len;
+	return OQS_SUCCESS;
+}
+
+static OQS_STATUS ml_kem_512_x86_64_key_encaps(uint8_t *ciphertext, uint8_t *shared_secret, const OQS_KEM_KEY *public_key) {
+	return (OQS_STATUS) PQCP_MLKEM_NATIVE_X86_64_MLKEM512_enc_expanded(ciphertext, shared_secret, public_key->expanded);
+}
+
+static OQS_STATUS ml_kem_512_x86_64_key_decaps(uint8_t *shared_secret, const uint8_t *ciphertext, const OQS_KEM_KEY *secret_key) {
+	return (OQS_STATUS) PQCP_MLKEM_NATIVE_X86_64_MLKEM512_dec_expanded(shared_secret, ciphertext, secret_key->expanded);
+}
+
+static const OQS_KEM_KEY_ops ml_kem_512_x86_64_key_ops = {
+	.expand = ml_kem_512_x86_64_key_expand,
+	.encaps = ml_kem_512_x86_64_key_encaps,
+	.decaps = ml_kem_512_x86_64_key_decaps,
+};
+#endif
+
+#if defined(OQS_ENABLE_KEM_ml_kem_512_aarch64)
+static OQS_STATUS ml_kem_512_aarch64_key_expand(OQS_KEM_KEY *key) {
+	size_t len = (key->type == OQS_KEM_KEY_SECRET) ? PQCP_MLKEM_NATIVE_AARCH64_MLKEM512_expanded_sk_bytes() : PQCP_MLKEM_NATIVE_AARCH64_MLKEM512_expanded_pk_bytes();
+	void *expanded = OQS_MEM_malloc(len);
+	int rc;
+	if (expanded == NULL) {
+		return OQS_ERROR;
+	}
+	if (key->type == OQS_KEM_KEY_SECRET) {
+		rc = PQCP_MLKEM_NATIVE_AARCH64_MLKEM512_expand_sk(expanded, key->bytes);
+	} else {
+		rc = PQCP_MLKEM_NATIVE_AARCH64_MLKEM512_expand_pk(expanded, key->bytes);
+	}
+	/* the key failed the input checks of FIPS 203 */
+	if (rc != 0) {
+		OQS_MEM_secure_free(expanded, len);
+		return OQS_ERROR;
+	}
+	key->expanded = expanded;
+	key->expanded_len = len;
+	return OQS_SUCCESS;
+}
+
+static OQS_STATUS ml_kem_512_aarch64_key_encaps(uint8_t *ciphertext, uint8_t *shared_secret, const OQS_KEM_KEY *public_key) {
+	return (OQS_STATUS) PQCP_MLKEM_NATIVE_AARCH64_MLKEM512_enc_expanded(ciphertext, shared_secret, public_key->expanded);
+}
+
+static OQS_STATUS ml_kem_512_aarch64_key_decaps(uint8_t *shared_secret, const uint8_t *ciphertext, const OQS_KEM_KEY *secret_key) {
+	return (OQS_STATUS) PQCP_MLKEM_NATIVE_AARCH64_MLKEM512_dec_expanded(shared_secret, ciphertext, secret_key->expanded);
+}
+
+static const OQS_KEM_KEY_ops ml_kem_512_aarch64_key_ops = {
+	.expand = ml_kem_512_aarch64_key_expand,
+	.encaps = ml_kem_512_aarch64_key_encaps,
+	.decaps = ml_kem_512_aarch64_key_decaps,
+};
+#endif
+
+/* The precomputed keys hold polynomials in the order of the backend that
+ * expanded them, so each backend has its own ops, picked the way the wrappers
+ * above pick the backend. The GPU builds keep keys as bytes. */
+const OQS_KEM_KEY_ops *OQS_KEM_ml_kem_512_key_ops(void) {
+	const OQS_KEM_KEY_ops *ops = &ml_kem_512_key_ops;
+#if defined(OQS_ENABLE_KEM_ml_kem_512_x86_64)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2) && OQS_CPU_has_extension(OQS_CPU_EXT_BMI2) && OQS_CPU_has_extension(OQS_CPU_EXT_POPCNT)) {
+#endif /* OQS_DIST_BUILD */
+		ops = &ml_kem_512_x86_64_key_ops;
+#if defined(OQS_DIST_BUILD)
+	}
+#endif /* OQS_DIST_BUILD */
+#elif defined(OQS_ENABLE_KEM_ml_kem_512_aarch64)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_ARM_NEON)) {
+#endif /* OQS_DIST_BUILD */
+		ops = &ml_kem_512_aarch64_key_ops;
+#if defined(OQS_DIST_BUILD)
+	}
+#endif /* OQS_DIST_BUILD */
+#endif
+#if defined(OQS_ENABLE_KEM_ml_kem_512_cuda) || defined(OQS_ENABLE_KEM_ml_kem_512_icicle_cuda)
+	ops = NULL;
 #endif
+	return ops;
 }
 
 #endif
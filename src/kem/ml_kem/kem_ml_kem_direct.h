@@ -0,0 +1,126 @@
+/**
+ * \file kem_ml_kem_direct.h
+ * \brief Direct, inlinable ML-KEM entry points for single-implementation builds.
+ *
+ * The functions declared here have the same semantics as the corresponding
+ * OQS_KEM_ml_kem_*_{keypair,keypair_derand,encaps,encaps_derand,decaps}
+ * functions. When liboqs is built with OQS_DIRECT_DISPATCH (a static,
+ * non-distributable build, see CONFIGURE.md), exactly one ML-KEM backend is
+ * compiled in and selected at build time, so these wrappers are `static
+ * inline` calls straight into that backend: there is no OQS_KEM_new() lookup,
+ * no heap-allocated OQS_KEM object, no function pointer and no run-time CPU
+ * feature check, and link-time optimization can fold the call chain into the
+ * implementation. In all other builds they forward to the regular API.
+ *
+ * Object sizes are the compile-time constants from kem_ml_kem.h
+ * (e.g. OQS_KEM_ml_kem_768_length_ciphertext).
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef OQS_KEM_ML_KEM_DIRECT_H
+#define OQS_KEM_ML_KEM_DIRECT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <oqs/oqs.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#if defined(OQS_DIRECT_DISPATCH)
+
+#define OQS_KEM_ML_KEM_DIRECT_DEFINE(alg, impl)                                                             \
+	extern int impl##_keypair(uint8_t *pk, uint8_t *sk);                                                   \
+	extern int impl##_keypair_derand(uint8_t *pk, uint8_t *sk, const uint8_t *seed);                       \
+	extern int impl##_enc(uint8_t *ct, uint8_t *ss, const uint8_t *pk);                                    \
+	extern int impl##_enc_derand(uint8_t *ct, uint8_t *ss, const uint8_t *pk, const uint8_t *seed);        \
+	extern int impl##_dec(uint8_t *ss, const uint8_t *ct, const uint8_t *sk);                              \
+	static inline OQS_STATUS OQS_KEM_##alg##_direct_keypair(uint8_t *public_key, uint8_t *secret_key) {      \
+		return (OQS_STATUS) impl##_keypair(public_key, secret_key);                                        \
+	}                                                                                                      \
+	static inline OQS_STATUS OQS_KEM_##alg##_direct_keypair_derand(uint8_t *public_key, uint8_t *secret_key, \
+	        const uint8_t *seed) {                                                                         \
+		return (OQS_STATUS) impl##_keypair_derand(public_key, secret_key, seed);                           \
+	}                                                                                                      \
+	static inline OQS_STATUS OQS_KEM_##alg##_direct_encaps(uint8_t *ciphertext, uint8_t *shared_secret,     \
+	        const uint8_t *public_key) {                                                                   \
+		return (OQS_STATUS) impl##_enc(ciphertext, shared_secret, public_key);                             \
+	}                                                                                                      \
+	static inline OQS_STATUS OQS_KEM_##alg##_direct_encaps_derand(uint8_t *ciphertext, uint8_t *shared_secret, \
+	        const uint8_t *public_key, const uint8_t *seed) {                                              \
+		return (OQS_STATUS) impl##_enc_derand(ciphertext, shared_secret, public_key, seed);                \
+	}                                                                                                      \
+	static inline OQS_STATUS OQS_KEM_##alg##_direct_decaps(uint8_t *shared_secret, const uint8_t *ciphertext, \
+	        const uint8_t *secret_key) {                                                                   \
+		return (OQS_STATUS) impl##_dec(shared_secret, ciphertext, secret_key);                             \
+	}
+
+#if defined(OQS_ENABLE_KEM_ml_kem_512_x86_64)
+OQS_KEM_ML_KEM_DIRECT_DEFINE(ml_kem_512, PQCP_MLKEM_NATIVE_X86_64_MLKEM512)
+#elif defined(OQS_ENABLE_KEM_ml_kem_512_aarch64)
+OQS_KEM_ML_KEM_DIRECT_DEFINE(ml_kem_512, PQCP_MLKEM_NATIVE_AARCH64_MLKEM512)
+#elif defined(OQS_ENABLE_KEM_ml_kem_512)
+OQS_KEM_ML_KEM_DIRECT_DEFINE(ml_kem_512, PQCP_MLKEM_NATIVE_C_MLKEM512)
+#endif
+
+#if defined(OQS_ENABLE_KEM_ml_kem_768_x86_64)
+OQS_KEM_ML_KEM_DIRECT_DEFINE(ml_kem_768, PQCP_MLKEM_NATIVE_X86_64_MLKEM768)
+#elif defined(OQS_ENABLE_KEM_ml_kem_768_aarch64)
+OQS_KEM_ML_KEM_DIRECT_DEFINE(ml_kem_768, PQCP_MLKEM_NATIVE_AARCH64_MLKEM768)
+#elif defined(OQS_ENABLE_KEM_ml_kem_768)
+OQS_KEM_ML_KEM_DIRECT_DEFINE(ml_kem_768, PQCP_MLKEM_NATIVE_C_MLKEM768)
+#endif
+
+#if defined(OQS_ENABLE_KEM_ml_kem_1024_x86_64)
+OQS_KEM_ML_KEM_DIRECT_DEFINE(ml_kem_1024, PQCP_MLKEM_NATIVE_X86_64_MLKEM1024)
+#elif defined(OQS_ENABLE_KEM_ml_kem_1024_aarch64)
+OQS_KEM_ML_KEM_DIRECT_DEFINE(ml_kem_1024, PQCP_MLKEM_NATIVE_AARCH64_MLKEM1024)
+#elif defined(OQS_ENABLE_KEM_ml_kem_1024)
+OQS_KEM_ML_KEM_DIRECT_DEFINE(ml_kem_1024, PQCP_MLKEM_NATIVE_C_MLKEM1024)
+#endif
+
+#else /* OQS_DIRECT_DISPATCH */
+
+#define OQS_KEM_ML_KEM_DIRECT_DEFINE(alg)                                                                   \
+	static inline OQS_STATUS OQS_KEM_##alg##_direct_keypair(uint8_t *public_key, uint8_t *secret_key) {      \
+		return OQS_KEM_##alg##_keypair(public_key, secret_key);                                            \
+	}                                                                                                      \
+	static inline OQS_STATUS OQS_KEM_##alg##_direct_keypair_derand(uint8_t *public_key, uint8_t *secret_key, \
+	        const uint8_t *seed) {                                                                         \
+		return OQS_KEM_##alg##_keypair_derand(public_key, secret_key, seed);                               \
+	}                                                                                                      \
+	static inline OQS_STATUS OQS_KEM_##alg##_direct_encaps(uint8_t *ciphertext, uint8_t *shared_secret,     \
+	        const uint8_t *public_key) {                                                                   \
+		return OQS_KEM_##alg##_encaps(ciphertext, shared_secret, public_key);                              \
+	}                                                                                                      \
+	static inline OQS_STATUS OQS_KEM_##alg##_direct_encaps_derand(uint8_t *ciphertext, uint8_t *shared_secret, \
+	        const uint8_t *public_key, const uint8_t *seed) {                                              \
+		return OQS_KEM_##alg##_encaps_derand(ciphertext, shared_secret, public_key, seed);                 \
+	}                                                                                                      \
+	static inline OQS_STATUS OQS_KEM_##alg##_direct_decaps(uint8_t *shared_secret, const uint8_t *ciphertext, \
+	        const uint8_t *secret_key) {                                                                   \
+		return OQS_KEM_##alg##_decaps(shared_secret, ciphertext, secret_key);                              \
+	}
+
+#if defined(OQS_ENABLE_KEM_ml_kem_512)
+OQS_KEM_ML_KEM_DIRECT_DEFINE(ml_kem_512)
+#endif
+#if defined(OQS_ENABLE_KEM_ml_kem_768)
+OQS_KEM_ML_KEM_DIRECT_DEFINE(ml_kem_768)
+#endif
+#if defined(OQS_ENABLE_KEM_ml_kem_1024)
+OQS_KEM_ML_KEM_DIRECT_DEFINE(ml_kem_1024)
+#endif
+
+#endif /* OQS_DIRECT_DISPATCH */
+
+#undef OQS_KEM_ML_KEM_DIRECT_DEFINE
+
+#if defined(__cplusplus)
+} // extern "C"
+#endif
+
+#endif // OQS_KEM_ML_KEM_DIRECT_H
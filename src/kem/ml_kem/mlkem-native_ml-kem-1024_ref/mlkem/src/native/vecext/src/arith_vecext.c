@@ -0,0 +1,253 @@
+/*
+ * Copyright (c) The mlkem-native project authors
+ * SPDX-License-Identifier: Apache-2.0 OR ISC OR MIT
+ */
+
+/*
+ * NTT, inverse NTT and base multiplication written with the GCC/Clang
+ * vector extensions instead of architecture-specific intrinsics, for
+ * targets without a hand-written backend (e.g. POWER and IBM Z, where the
+ * compiler lowers the 128-bit vectors to VSX and z/Architecture vector
+ * instructions).
+ *
+ * Every lane performs exactly the modular arithmetic of the C backend
+ * in poly.c and poly_k.c: Montgomery and Barrett reductions are carried
+ * out in 32-bit lanes with the same constants, so the results are
+ * bit-for-bit identical to the C code.
+ */
+
+#include "../../../common.h"
+
+#if defined(MLK_ARITH_BACKEND_VECEXT) && \
+    !defined(MLK_CONFIG_MULTILEVEL_NO_SHARED)
+
+#include <string.h>
+#include "arith_native_vecext.h"
+
+#include "../../../zetas.inc"
+#include "vecext_zetas.i"
+
+typedef int16_t mlk_vec16 __attribute__((vector_size(16)));
+typedef int32_t mlk_vec32 __attribute__((vector_size(32)));
+typedef uint32_t mlk_vecu32 __attribute__((vector_size(32)));
+
+#if defined(__clang__)
+#define mlk_vec_shuffle(a, b, ...) __builtin_shufflevector(a, b, __VA_ARGS__)
+#else
+#define mlk_vec_shuffle(a, b, ...) \
+  __builtin_shuffle(a, b, (mlk_vec16){__VA_ARGS__})
+#endif
+
+static MLK_INLINE mlk_vec16 mlk_vec_load(const int16_t *p)
+{
+  mlk_vec16 v;
+  memcpy(&v, p, sizeof(v));
+  return v;
+}
+
+static MLK_INLINE void mlk_vec_store(int16_t *p, mlk_vec16 v)
+{
+  memcpy(p, &v, sizeof(v));
+}
+
+static MLK_INLINE mlk_vec32 mlk_vec_widen(mlk_vec16 a)
+{
+  return __builtin_convertvector(a, mlk_vec32);
+}
+
+/* Lane-wise mlk_montgomery_reduce() */
+static MLK_INLINE mlk_vec16 mlk_vec_montgomery_reduce(mlk_vec32 a)
+{
+  /* check-magic: 62209 == unsigned_mod(pow(MLKEM_Q, -1, 2^16), 2^16) */
+  /* t = a * q^{-1} mod 2^16, lifted to the signed representative */
+  const mlk_vec32 t = (mlk_vec32)(((mlk_vecu32)a * 62209u) << 16) >> 16;
+  return __builtin_convertvector((a - t * MLKEM_Q) >> 16, mlk_vec16);
+}
+
+/* Lane-wise mlk_fqmul() */
+static MLK_INLINE mlk_vec16 mlk_vec_fqmul(mlk_vec16 a, mlk_vec16 b)
+{
+  return mlk_vec_montgomery_reduce(mlk_vec_widen(a) * mlk_vec_widen(b));
+}
+
+/* Lane-wise mlk_barrett_reduce() */
+static MLK_INLINE mlk_vec16 mlk_vec_barrett_reduce(mlk_vec16 a)
+{
+  /* check-magic: 20159 == round(2^26 / MLKEM_Q) */
+  const mlk_vec32 a32 = mlk_vec_widen(a);
+  const mlk_vec32 t = (a32 * 20159 + (1 << 25)) >> 26;
+  return __builtin_convertvector(a32 - t * MLKEM_Q, mlk_vec16);
+}
+
+/* Layers 1 to 5 of the forward NTT, where a butterfly block spans at least
+ * 8 coefficients and every vector shares a single twiddle factor. */
+static void mlk_ntt_layer_vecext(int16_t r[MLKEM_N], unsigned layer)
+{
+  unsigned start, j, k, len;
+  k = 1u << (layer - 1);
+  len = MLKEM_N >> layer;
+  for (start = 0; start < MLKEM_N; start += 2 * len)
+  {
+    const mlk_vec16 zeta = (mlk_vec16){0} + zetas[k++];
+    for (j = start; j < start + len; j += 8)
+    {
+      const mlk_vec16 a = mlk_vec_load(r + j);
+      const mlk_vec16 t = mlk_vec_fqmul(mlk_vec_load(r + j + len), zeta);
+      mlk_vec_store(r + j + len, a - t);
+      mlk_vec_store(r + j, a + t);
+    }
+  }
+}
+
+void mlk_ntt_vecext(int16_t r[MLKEM_N])
+{
+  unsigned i, layer;
+
+  for (layer = 1; layer <= 5; layer++)
+  {
+    mlk_ntt_layer_vecext(r, layer);
+  }
+
+  /* Layers 6 and 7 (len 4 and 2) on 16 coefficients at a time,
+   * regrouping lanes so that each butterfly pairs two vectors. */
+  for (i = 0; i < MLKEM_N / 16; i++)
+  {
+    mlk_vec16 v0 = mlk_vec_load(r + 16 * i);
+    mlk_vec16 v1 = mlk_vec_load(r + 16 * i + 8);
+    mlk_vec16 lo, hi, t;
+
+    lo = mlk_vec_shuffle(v0, v1, 0, 1, 2, 3, 8, 9, 10, 11);
+    hi = mlk_vec_shuffle(v0, v1, 4, 5, 6, 7, 12, 13, 14, 15);
+    t = mlk_vec_fqmul(hi, mlk_vec_load(mlk_vecext_ntt_l6_zetas + 8 * i));
+    v0 = lo + t;
+    v1 = lo - t;
+
+    lo = mlk_vec_shuffle(v0, v1, 0, 1, 8, 9, 4, 5, 12, 13);
+    hi = mlk_vec_shuffle(v0, v1, 2, 3, 10, 11, 6, 7, 14, 15);
+    t = mlk_vec_fqmul(hi, mlk_vec_load(mlk_vecext_ntt_l7_zetas + 8 * i));
+    v0 = lo + t;
+    v1 = lo - t;
+
+    mlk_vec_store(r + 16 * i, mlk_vec_shuffle(v0, v1, 0, 1, 8, 9, 2, 3, 10, 11));
+    mlk_vec_store(r + 16 * i + 8,
+                  mlk_vec_shuffle(v0, v1, 4, 5, 12, 13, 6, 7, 14, 15));
+  }
+}
+
+/* Layers 5 to 1 of the inverse NTT */
+static void mlk_invntt_layer_vecext(int16_t r[MLKEM_N], unsigned layer)
+{
+  unsigned start, j, k, len;
+  len = MLKEM_N >> layer;
+  k = (1u << layer) - 1;
+  for (start = 0; start < MLKEM_N; start += 2 * len)
+  {
+    const mlk_vec16 zeta = (mlk_vec16){0} + zetas[k--];
+    for (j = start; j < start + len; j += 8)
+    {
+      const mlk_vec16 a = mlk_vec_load(r + j);
+      const mlk_vec16 b = mlk_vec_load(r + j + len);
+      mlk_vec_store(r + j, mlk_vec_barrett_reduce(a + b));
+      mlk_vec_store(r + j + len, mlk_vec_fqmul(b - a, zeta));
+    }
+  }
+}
+
+void mlk_invntt_vecext(int16_t r[MLKEM_N])
+{
+  /* check-magic: 1441 == pow(2,32 - 7,MLKEM_Q) */
+  const mlk_vec16 f = (mlk_vec16){0} + 1441;
+  unsigned i, layer;
+
+  /* Scaling by 1441 and layers 7 and 6 (len 2 and 4), mirroring the
+   * lane regrouping of the forward NTT. */
+  for (i = 0; i < MLKEM_N / 16; i++)
+  {
+    mlk_vec16 v0 = mlk_vec_fqmul(mlk_vec_load(r + 16 * i), f);
+    mlk_vec16 v1 = mlk_vec_fqmul(mlk_vec_load(r + 16 * i + 8), f);
+    mlk_vec16 lo, hi;
+
+    lo = mlk_vec_shuffle(v0, v1, 0, 1, 4, 5, 8, 9, 12, 13);
+    hi = mlk_vec_shuffle(v0, v1, 2, 3, 6, 7, 10, 11, 14, 15);
+    v0 = mlk_vec_barrett_reduce(lo + hi);
+    v1 = mlk_vec_fqmul(hi - lo, mlk_vec_load(mlk_vecext_invntt_l7_zetas + 8 * i));
+
+    lo = mlk_vec_shuffle(v0, v1, 0, 1, 8, 9, 4, 5, 12, 13);
+    hi = mlk_vec_shuffle(v0, v1, 2, 3, 10, 11, 6, 7, 14, 15);
+    v0 = mlk_vec_barrett_reduce(lo + hi);
+    v1 = mlk_vec_fqmul(hi - lo, mlk_vec_load(mlk_vecext_invntt_l6_zetas + 8 * i));
+
+    mlk_vec_store(r + 16 * i, mlk_vec_shuffle(v0, v1, 0, 1, 2, 3, 8, 9, 10, 11));
+    mlk_vec_store(r + 16 * i + 8,
+                  mlk_vec_shuffle(v0, v1, 4, 5, 6, 7, 12, 13, 14, 15));
+  }
+
+  for (layer = 5; layer > 0; layer--)
+  {
+    mlk_invntt_layer_vecext(r, layer);
+  }
+}
+
+void mlk_poly_mulcache_compute_vecext(int16_t x[MLKEM_N / 2],
+                                      const int16_t a[MLKEM_N])
+{
+  unsigned i;
+  for (i = 0; i < MLKEM_N / 16; i++)
+  {
+    const mlk_vec16 v0 = mlk_vec_load(a + 16 * i);
+    const mlk_vec16 v1 = mlk_vec_load(a + 16 * i + 8);
+    const mlk_vec16 odd =
+        mlk_vec_shuffle(v0, v1, 1, 3, 5, 7, 9, 11, 13, 15);
+    mlk_vec_store(x + 8 * i,
+                  mlk_vec_fqmul(odd, mlk_vec_load(mlk_vecext_mulcache_zetas +
+                                                  8 * i)));
+  }
+}
+
+void mlk_polyvec_basemul_acc_montgomery_cached_vecext(unsigned k,
+                                                      int16_t r[MLKEM_N],
+                                                      const int16_t *a,
+                                                      const int16_t *b,
+                                                      const int16_t *b_cache)
+{
+  unsigned i, j;
+  for (i = 0; i < MLKEM_N / 16; i++)
+  {
+    /* Even and odd output coefficients of 8 consecutive pairs, accumulated
+     * without intermediate reduction as in the C backend. */
+    mlk_vec32 t0 = {0}, t1 = {0};
+    mlk_vec16 r0, r1;
+    for (j = 0; j < k; j++)
+    {
+      const int16_t *aj = a + j * MLKEM_N + 16 * i;
+      const int16_t *bj = b + j * MLKEM_N + 16 * i;
+      const mlk_vec16 a0 = mlk_vec_load(aj), a1 = mlk_vec_load(aj + 8);
+      const mlk_vec16 b0 = mlk_vec_load(bj), b1 = mlk_vec_load(bj + 8);
+      const mlk_vec32 a_even = mlk_vec_widen(
+          mlk_vec_shuffle(a0, a1, 0, 2, 4, 6, 8, 10, 12, 14));
+      const mlk_vec32 a_odd = mlk_vec_widen(
+          mlk_vec_shuffle(a0, a1, 1, 3, 5, 7, 9, 11, 13, 15));
+      const mlk_vec32 b_even = mlk_vec_widen(
+          mlk_vec_shuffle(b0, b1, 0, 2, 4, 6, 8, 10, 12, 14));
+      const mlk_vec32 b_odd = mlk_vec_widen(
+          mlk_vec_shuffle(b0, b1, 1, 3, 5, 7, 9, 11, 13, 15));
+      const mlk_vec32 c = mlk_vec_widen(
+          mlk_vec_load(b_cache + j * (MLKEM_N / 2) + 8 * i));
+
+      t0 += a_odd * c + a_even * b_even;
+      t1 += a_even * b_odd + a_odd * b_even;
+    }
+
+    r0 = mlk_vec_montgomery_reduce(t0);
+    r1 = mlk_vec_montgomery_reduce(t1);
+    mlk_vec_store(r + 16 * i, mlk_vec_shuffle(r0, r1, 0, 8, 1, 9, 2, 10, 3, 11));
+    mlk_vec_store(r + 16 * i + 8,
+                  mlk_vec_shuffle(r0, r1, 4, 12, 5, 13, 6, 14, 7, 15));
+  }
+}
+
+#else /* MLK_ARITH_BACKEND_VECEXT && !MLK_CONFIG_MULTILEVEL_NO_SHARED */
+
+MLK_EMPTY_CU(vecext_arith)
+
+#endif /* !(MLK_ARITH_BACKEND_VECEXT && !MLK_CONFIG_MULTILEVEL_NO_SHARED) */
@@ -39,6 +39,9 @@
 #define mlk_check_pk MLK_ADD_PARAM_SET(mlk_check_pk)
 #define mlk_check_sk MLK_ADD_PARAM_SET(mlk_check_sk)
 #define mlk_check_pct MLK_ADD_PARAM_SET(mlk_check_pct)
+#define mlk_expanded_pk MLK_ADD_PARAM_SET(mlk_expanded_pk)
+#define mlk_expanded_sk MLK_ADD_PARAM_SET(mlk_expanded_sk)
+#define mlk_align_expanded MLK_ADD_PARAM_SET(mlk_align_expanded)
 /* End of parameter set namespacing */
 
 #if defined(CBMC)
@@ -364,8 +367,178 @@ int crypto_kem_dec(uint8_t ss[MLKEM_SSBYTES],
   return 0;
 }
 
+/* Expanded public key: the unpacked key with A^T, and H(pk). */
+typedef struct
+{
+  mlk_indcpa_public_key indcpa;
+  uint8_t hpk[MLKEM_SYMBYTES];
+} mlk_expanded_pk;
+
+/* Expanded secret key: the unpacked secret vector, the expanded public key
+ * for the re-encryption, H(pk) and the rejection value z. */
+typedef struct
+{
+  mlk_indcpa_secret_key indcpa;
+  mlk_indcpa_public_key indcpa_pk;
+  uint8_t hpk[MLKEM_SYMBYTES];
+  uint8_t z[MLKEM_SYMBYTES];
+} mlk_expanded_sk;
+
+/* Expanded keys hold polynomials that need MLK_DEFAULT_ALIGN alignment; the
+ * caller's buffer is over-allocated by crypto_kem_expanded_*_bytes() so that
+ * the key can start at the next aligned address. */
+static void *mlk_align_expanded(const void *p)
+{
+  return (void *)(((uintptr_t)p + MLK_DEFAULT_ALIGN - 1) &
+                  ~(uintptr_t)(MLK_DEFAULT_ALIGN - 1));
+}
+
+MLK_EXTERNAL_API
+size_t crypto_kem_expanded_pk_bytes(void)
+{
+  return sizeof(mlk_expanded_pk) + MLK_DEFAULT_ALIGN - 1;
+}
+
+MLK_EXTERNAL_API
+size_t crypto_kem_expanded_sk_bytes(void)
+{
+  return sizeof(mlk_expanded_sk) + MLK_DEFAULT_ALIGN - 1;
+}
+
+MLK_EXTERNAL_API
+int crypto_kem_expand_pk(void *epk,
+                         const uint8_t pk[MLKEM_INDCCA_PUBLICKEYBYTES])
+{
+  mlk_expanded_pk *x = mlk_align_expanded(epk);
+
+  /* Specification: Implements @[FIPS203, Section 7.2, Modulus check] */
+  if (mlk_check_pk(pk))
+  {
+    return -1;
+  }
+
+  mlk_indcpa_expand_pk(&x->indcpa, pk);
+  mlk_hash_h(x->hpk, pk, MLKEM_INDCCA_PUBLICKEYBYTES);
+  return 0;
+}
+
+MLK_EXTERNAL_API
+int crypto_kem_expand_sk(void *esk,
+                         const uint8_t sk[MLKEM_INDCCA_SECRETKEYBYTES])
+{
+  mlk_expanded_sk *x = mlk_align_expanded(esk);
+
+  /* Specification: Implements @[FIPS203, Section 7.3, Hash check] */
+  if (mlk_check_sk(sk))
+  {
+    return -1;
+  }
+
+  mlk_indcpa_expand_sk(&x->indcpa, sk);
+  mlk_indcpa_expand_pk(&x->indcpa_pk, sk + MLKEM_INDCPA_SECRETKEYBYTES);
+  memcpy(x->hpk, sk + MLKEM_INDCCA_SECRETKEYBYTES - 2 * MLKEM_SYMBYTES,
+         MLKEM_SYMBYTES);
+  memcpy(x->z, sk + MLKEM_INDCCA_SECRETKEYBYTES - MLKEM_SYMBYTES,
+         MLKEM_SYMBYTES);
+  return 0;
+}
+
+/* As crypto_kem_enc_derand, with the modulus check and H(pk) done by
+ * crypto_kem_expand_pk. */
+MLK_EXTERNAL_API
+int crypto_kem_enc_derand_expanded(uint8_t ct[MLKEM_INDCCA_CIPHERTEXTBYTES],
+                                   uint8_t ss[MLKEM_SSBYTES], const void *epk,
+                                   const uint8_t coins[MLKEM_SYMBYTES])
+{
+  const mlk_expanded_pk *x = mlk_align_expanded(epk);
+  MLK_ALIGN uint8_t buf[2 * MLKEM_SYMBYTES];
+  /* Will contain key, coins */
+  MLK_ALIGN uint8_t kr[2 * MLKEM_SYMBYTES];
+
+  memcpy(buf, coins, MLKEM_SYMBYTES);
+
+  /* Multitarget countermeasure for coins + contributory KEM */
+  memcpy(buf + MLKEM_SYMBYTES, x->hpk, MLKEM_SYMBYTES);
+  mlk_hash_g(kr, buf, 2 * MLKEM_SYMBYTES);
+
+  /* coins are in kr+MLKEM_SYMBYTES */
+  mlk_indcpa_enc_expanded(ct, buf, &x->indcpa, kr + MLKEM_SYMBYTES);
+
+  memcpy(ss, kr, MLKEM_SYMBYTES);
+
+  /* Specification: Partially implements
+   * @[FIPS203, Section 3.3, Destruction of intermediate values] */
+  mlk_zeroize(buf, sizeof(buf));
+  mlk_zeroize(kr, sizeof(kr));
+
+  return 0;
+}
+
+MLK_EXTERNAL_API
+int crypto_kem_enc_expanded(uint8_t ct[MLKEM_INDCCA_CIPHERTEXTBYTES],
+                            uint8_t ss[MLKEM_SSBYTES], const void *epk)
+{
+  int res;
+  MLK_ALIGN uint8_t coins[MLKEM_SYMBYTES];
+
+  mlk_randombytes(coins, MLKEM_SYMBYTES);
+  MLK_CT_TESTING_SECRET(coins, sizeof(coins));
+
+  res = crypto_kem_enc_derand_expanded(ct, ss, epk, coins);
+
+  /* Specification: Partially implements
+   * @[FIPS203, Section 3.3, Destruction of intermediate values] */
+  mlk_zeroize(coins, sizeof(coins));
+  return res;
+}
+
+/* As crypto_kem_dec, with the hash check, unpacking and the matrix for the
+ * re-encryption done by crypto_kem_expand_sk. */
+MLK_EXTERNAL_API
+int crypto_kem_dec_expanded(uint8_t ss[MLKEM_SSBYTES],
+                            const uint8_t ct[MLKEM_INDCCA_CIPHERTEXTBYTES],
+                            const void *esk)
+{
+  const mlk_expanded_sk *x = mlk_align_expanded(esk);
+  uint8_t fail;
+  MLK_ALIGN uint8_t buf[2 * MLKEM_SYMBYTES];
+  /* Will contain key, coins */
+  MLK_ALIGN uint8_t kr[2 * MLKEM_SYMBYTES];
+  MLK_ALIGN uint8_t tmp[MLKEM_SYMBYTES + MLKEM_INDCCA_CIPHERTEXTBYTES];
+
+  mlk_indcpa_dec_expanded(buf, ct, &x->indcpa);
+
+  /* Multitarget countermeasure for coins + contributory KEM */
+  memcpy(buf + MLKEM_SYMBYTES, x->hpk, MLKEM_SYMBYTES);
+  mlk_hash_g(kr, buf, 2 * MLKEM_SYMBYTES);
+
+  /* Recompute and compare ciphertext */
+  /* coins are in kr+MLKEM_SYMBYTES */
+  mlk_indcpa_enc_expanded(tmp, buf, &x->indcpa_pk, kr + MLKEM_SYMBYTES);
+  fail = mlk_ct_memcmp(ct, tmp, MLKEM_INDCCA_CIPHERTEXTBYTES);
+
+  /* Compute rejection key */
+  memcpy(tmp, x->z, MLKEM_SYMBYTES);
+  memcpy(tmp + MLKEM_SYMBYTES, ct, MLKEM_INDCCA_CIPHERTEXTBYTES);
+  mlk_hash_j(ss, tmp, sizeof(tmp));
+
+  /* Copy true key to return buffer if fail is 0 */
+  mlk_ct_cmov_zero(ss, kr, MLKEM_SYMBYTES, fail);
+
+  /* Specification: Partially implements
+   * @[FIPS203, Section 3.3, Destruction of intermediate values] */
+  mlk_zeroize(buf, sizeof(buf));
+  mlk_zeroize(kr, sizeof(kr));
+  mlk_zeroize(tmp, sizeof(tmp));
+
+  return 0;
+}
+
 /* To facilitate single-compilation-unit (SCU) builds, undefine all macros.
  * Don't modify by hand -- this is auto-generated by scripts/autogen. */
 #undef mlk_check_pk
 #undef mlk_check_sk
 #undef mlk_check_pct
+#undef mlk_expanded_pk
+#undef mlk_expanded_sk
+#undef mlk_align_expanded
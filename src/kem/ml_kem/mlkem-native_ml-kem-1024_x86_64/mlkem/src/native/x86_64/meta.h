@@ -49,16 +49,36 @@ static MLK_INLINE int mlk_rej_uniform_native(int16_t *r, unsigned len,
     return -1;
   }
 
+#if defined(MLK_CONFIG_X86_64_AVX512)
+  if (mlk_sys_check_capability_avx512())
+  {
+    return (int)mlk_rej_uniform_avx512(r, buf);
+  }
+#endif
   return (int)mlk_rej_uniform_avx2(r, buf);
 }
 
 static MLK_INLINE void mlk_ntt_native(int16_t data[MLKEM_N])
 {
+#if defined(MLK_CONFIG_X86_64_AVX512)
+  if (mlk_sys_check_capability_avx512())
+  {
+    mlk_ntt_avx512((__m256i *)data, mlk_qdata.vec);
+    return;
+  }
+#endif
   mlk_ntt_avx2((__m256i *)data, mlk_qdata.vec);
 }
 
 static MLK_INLINE void mlk_intt_native(int16_t data[MLKEM_N])
 {
+#if defined(MLK_CONFIG_X86_64_AVX512)
+  if (mlk_sys_check_capability_avx512())
+  {
+    mlk_invntt_avx512((__m256i *)data, mlk_qdata.vec);
+    return;
+  }
+#endif
   mlk_invntt_avx2((__m256i *)data, mlk_qdata.vec);
 }
 
@@ -0,0 +1,700 @@
+/*
+ * Copyright (c) The mlkem-native project authors
+ * SPDX-License-Identifier: Apache-2.0 OR ISC OR MIT
+ */
+
+/*
+ * AVX-512 forward and inverse NTT.
+ *
+ * Both functions are derived instruction by instruction from the AVX2
+ * assembly in ntt.S and intt.S. The AVX2 code runs its layers on two halves
+ * of the polynomial using the same instruction sequence at different
+ * offsets; here the two halves are processed together, with the first half
+ * in the low 256 bits of each zmm register and the second half in the high
+ * 256 bits. The results are bit-identical to the AVX2 code, including the
+ * custom coefficient order and the output bounds.
+ */
+
+#include "../../../common.h"
+
+#if defined(MLK_ARITH_BACKEND_X86_64_DEFAULT) && \
+    !defined(MLK_CONFIG_MULTILEVEL_NO_SHARED) && \
+    defined(MLK_CONFIG_X86_64_AVX512)
+
+#include <immintrin.h>
+#include <stdint.h>
+#include "arith_native_x86_64.h"
+
+/* Load 32 bytes from lo and hi into the low and high halves */
+static MLK_INLINE __m512i mlk_ld2(const uint8_t *lo, const uint8_t *hi)
+{
+  return _mm512_inserti64x4(
+      _mm512_castsi256_si512(_mm256_load_si256((const __m256i *)lo)),
+      _mm256_load_si256((const __m256i *)hi), 1);
+}
+
+/* Broadcast 8 bytes from lo and hi into the low and high halves */
+static MLK_INLINE __m512i mlk_bq2(const uint8_t *lo, const uint8_t *hi)
+{
+  return _mm512_inserti64x4(
+      _mm512_castsi256_si512(
+          _mm256_broadcastq_epi64(_mm_loadl_epi64((const __m128i *)lo))),
+      _mm256_broadcastq_epi64(_mm_loadl_epi64((const __m128i *)hi)), 1);
+}
+
+/* Store the low and high halves of v to lo and hi */
+static MLK_INLINE void mlk_st2(uint8_t *lo, uint8_t *hi, __m512i v)
+{
+  _mm256_store_si256((__m256i *)lo, _mm512_castsi512_si256(v));
+  _mm256_store_si256((__m256i *)hi, _mm512_extracti64x4_epi64(v, 1));
+}
+
+/* vpermd within each 256-bit half */
+static MLK_INLINE __m512i mlk_permd2(__m512i idx, __m512i tab)
+{
+  idx = _mm512_and_si512(idx, _mm512_set1_epi32(7));
+  idx = _mm512_add_epi32(
+      idx, _mm512_setr_epi32(0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 8, 8, 8, 8, 8, 8));
+  return _mm512_permutexvar_epi32(idx, tab);
+}
+
+void mlk_ntt_avx512(__m256i *r, const __m256i *qdata)
+{
+  uint8_t *rp = (uint8_t *)r;
+  const uint8_t *qp = (const uint8_t *)qdata;
+  __m512i y0, y2, y3, y4, y5, y6, y7, y8, y9, y10, y11, y12, y13, y14, y15;
+  y0 = mlk_ld2(qp + 0x0, qp + 0x0);
+  y15 = mlk_bq2(qp + 0x140, qp + 0x140);
+  y8 = mlk_ld2(rp + 0x100, rp + 0x180);
+  y9 = mlk_ld2(rp + 0x120, rp + 0x1a0);
+  y10 = mlk_ld2(rp + 0x140, rp + 0x1c0);
+  y11 = mlk_ld2(rp + 0x160, rp + 0x1e0);
+  y2 = mlk_bq2(qp + 0x148, qp + 0x148);
+  y12 = _mm512_mullo_epi16(y8, y15);
+  y13 = _mm512_mullo_epi16(y9, y15);
+  y14 = _mm512_mullo_epi16(y10, y15);
+  y15 = _mm512_mullo_epi16(y11, y15);
+  y8 = _mm512_mulhi_epi16(y8, y2);
+  y9 = _mm512_mulhi_epi16(y9, y2);
+  y10 = _mm512_mulhi_epi16(y10, y2);
+  y11 = _mm512_mulhi_epi16(y11, y2);
+  y4 = mlk_ld2(rp + 0x0, rp + 0x80);
+  y5 = mlk_ld2(rp + 0x20, rp + 0xa0);
+  y6 = mlk_ld2(rp + 0x40, rp + 0xc0);
+  y7 = mlk_ld2(rp + 0x60, rp + 0xe0);
+  y12 = _mm512_mulhi_epi16(y12, y0);
+  y13 = _mm512_mulhi_epi16(y13, y0);
+  y14 = _mm512_mulhi_epi16(y14, y0);
+  y15 = _mm512_mulhi_epi16(y15, y0);
+  y3 = _mm512_add_epi16(y4, y8);
+  y8 = _mm512_sub_epi16(y4, y8);
+  y4 = _mm512_add_epi16(y5, y9);
+  y9 = _mm512_sub_epi16(y5, y9);
+  y5 = _mm512_add_epi16(y6, y10);
+  y10 = _mm512_sub_epi16(y6, y10);
+  y6 = _mm512_add_epi16(y7, y11);
+  y11 = _mm512_sub_epi16(y7, y11);
+  y3 = _mm512_sub_epi16(y3, y12);
+  y8 = _mm512_add_epi16(y8, y12);
+  y4 = _mm512_sub_epi16(y4, y13);
+  y9 = _mm512_add_epi16(y9, y13);
+  y5 = _mm512_sub_epi16(y5, y14);
+  y10 = _mm512_add_epi16(y10, y14);
+  y6 = _mm512_sub_epi16(y6, y15);
+  y11 = _mm512_add_epi16(y11, y15);
+  mlk_st2(rp + 0x0, rp + 0x80, y3);
+  mlk_st2(rp + 0x20, rp + 0xa0, y4);
+  mlk_st2(rp + 0x40, rp + 0xc0, y5);
+  mlk_st2(rp + 0x60, rp + 0xe0, y6);
+  mlk_st2(rp + 0x100, rp + 0x180, y8);
+  mlk_st2(rp + 0x120, rp + 0x1a0, y9);
+  mlk_st2(rp + 0x140, rp + 0x1c0, y10);
+  mlk_st2(rp + 0x160, rp + 0x1e0, y11);
+  y15 = mlk_ld2(qp + 0x160, qp + 0x320);
+  y8 = mlk_ld2(rp + 0x80, rp + 0x180);
+  y9 = mlk_ld2(rp + 0xa0, rp + 0x1a0);
+  y10 = mlk_ld2(rp + 0xc0, rp + 0x1c0);
+  y11 = mlk_ld2(rp + 0xe0, rp + 0x1e0);
+  y2 = mlk_ld2(qp + 0x180, qp + 0x340);
+  y12 = _mm512_mullo_epi16(y8, y15);
+  y13 = _mm512_mullo_epi16(y9, y15);
+  y14 = _mm512_mullo_epi16(y10, y15);
+  y15 = _mm512_mullo_epi16(y11, y15);
+  y8 = _mm512_mulhi_epi16(y8, y2);
+  y9 = _mm512_mulhi_epi16(y9, y2);
+  y10 = _mm512_mulhi_epi16(y10, y2);
+  y11 = _mm512_mulhi_epi16(y11, y2);
+  y4 = mlk_ld2(rp + 0x0, rp + 0x100);
+  y5 = mlk_ld2(rp + 0x20, rp + 0x120);
+  y6 = mlk_ld2(rp + 0x40, rp + 0x140);
+  y7 = mlk_ld2(rp + 0x60, rp + 0x160);
+  y12 = _mm512_mulhi_epi16(y12, y0);
+  y13 = _mm512_mulhi_epi16(y13, y0);
+  y14 = _mm512_mulhi_epi16(y14, y0);
+  y15 = _mm512_mulhi_epi16(y15, y0);
+  y3 = _mm512_add_epi16(y4, y8);
+  y8 = _mm512_sub_epi16(y4, y8);
+  y4 = _mm512_add_epi16(y5, y9);
+  y9 = _mm512_sub_epi16(y5, y9);
+  y5 = _mm512_add_epi16(y6, y10);
+  y10 = _mm512_sub_epi16(y6, y10);
+  y6 = _mm512_add_epi16(y7, y11);
+  y11 = _mm512_sub_epi16(y7, y11);
+  y3 = _mm512_sub_epi16(y3, y12);
+  y8 = _mm512_add_epi16(y8, y12);
+  y4 = _mm512_sub_epi16(y4, y13);
+  y9 = _mm512_add_epi16(y9, y13);
+  y5 = _mm512_sub_epi16(y5, y14);
+  y10 = _mm512_add_epi16(y10, y14);
+  y6 = _mm512_sub_epi16(y6, y15);
+  y11 = _mm512_add_epi16(y11, y15);
+  y7 = _mm512_permutex2var_epi64(y5, _mm512_setr_epi64(0, 1, 8, 9, 4, 5, 12, 13), y10);
+  y10 = _mm512_permutex2var_epi64(y5, _mm512_setr_epi64(2, 3, 10, 11, 6, 7, 14, 15), y10);
+  y5 = _mm512_permutex2var_epi64(y6, _mm512_setr_epi64(0, 1, 8, 9, 4, 5, 12, 13), y11);
+  y11 = _mm512_permutex2var_epi64(y6, _mm512_setr_epi64(2, 3, 10, 11, 6, 7, 14, 15), y11);
+  y15 = mlk_ld2(qp + 0x1a0, qp + 0x360);
+  y2 = mlk_ld2(qp + 0x1c0, qp + 0x380);
+  y12 = _mm512_mullo_epi16(y7, y15);
+  y13 = _mm512_mullo_epi16(y10, y15);
+  y14 = _mm512_mullo_epi16(y5, y15);
+  y15 = _mm512_mullo_epi16(y11, y15);
+  y7 = _mm512_mulhi_epi16(y7, y2);
+  y10 = _mm512_mulhi_epi16(y10, y2);
+  y5 = _mm512_mulhi_epi16(y5, y2);
+  y11 = _mm512_mulhi_epi16(y11, y2);
+  y6 = _mm512_permutex2var_epi64(y3, _mm512_setr_epi64(0, 1, 8, 9, 4, 5, 12, 13), y8);
+  y8 = _mm512_permutex2var_epi64(y3, _mm512_setr_epi64(2, 3, 10, 11, 6, 7, 14, 15), y8);
+  y3 = _mm512_permutex2var_epi64(y4, _mm512_setr_epi64(0, 1, 8, 9, 4, 5, 12, 13), y9);
+  y9 = _mm512_permutex2var_epi64(y4, _mm512_setr_epi64(2, 3, 10, 11, 6, 7, 14, 15), y9);
+  y12 = _mm512_mulhi_epi16(y12, y0);
+  y13 = _mm512_mulhi_epi16(y13, y0);
+  y14 = _mm512_mulhi_epi16(y14, y0);
+  y15 = _mm512_mulhi_epi16(y15, y0);
+  y4 = _mm512_add_epi16(y6, y7);
+  y7 = _mm512_sub_epi16(y6, y7);
+  y6 = _mm512_add_epi16(y8, y10);
+  y10 = _mm512_sub_epi16(y8, y10);
+  y8 = _mm512_add_epi16(y3, y5);
+  y5 = _mm512_sub_epi16(y3, y5);
+  y3 = _mm512_add_epi16(y9, y11);
+  y11 = _mm512_sub_epi16(y9, y11);
+  y4 = _mm512_sub_epi16(y4, y12);
+  y7 = _mm512_add_epi16(y7, y12);
+  y6 = _mm512_sub_epi16(y6, y13);
+  y10 = _mm512_add_epi16(y10, y13);
+  y8 = _mm512_sub_epi16(y8, y14);
+  y5 = _mm512_add_epi16(y5, y14);
+  y3 = _mm512_sub_epi16(y3, y15);
+  y11 = _mm512_add_epi16(y11, y15);
+  y9 = _mm512_unpacklo_epi64(y8, y5);
+  y5 = _mm512_unpackhi_epi64(y8, y5);
+  y8 = _mm512_unpacklo_epi64(y3, y11);
+  y11 = _mm512_unpackhi_epi64(y3, y11);
+  y15 = mlk_ld2(qp + 0x1e0, qp + 0x3a0);
+  y2 = mlk_ld2(qp + 0x200, qp + 0x3c0);
+  y12 = _mm512_mullo_epi16(y9, y15);
+  y13 = _mm512_mullo_epi16(y5, y15);
+  y14 = _mm512_mullo_epi16(y8, y15);
+  y15 = _mm512_mullo_epi16(y11, y15);
+  y9 = _mm512_mulhi_epi16(y9, y2);
+  y5 = _mm512_mulhi_epi16(y5, y2);
+  y8 = _mm512_mulhi_epi16(y8, y2);
+  y11 = _mm512_mulhi_epi16(y11, y2);
+  y3 = _mm512_unpacklo_epi64(y4, y7);
+  y7 = _mm512_unpackhi_epi64(y4, y7);
+  y4 = _mm512_unpacklo_epi64(y6, y10);
+  y10 = _mm512_unpackhi_epi64(y6, y10);
+  y12 = _mm512_mulhi_epi16(y12, y0);
+  y13 = _mm512_mulhi_epi16(y13, y0);
+  y14 = _mm512_mulhi_epi16(y14, y0);
+  y15 = _mm512_mulhi_epi16(y15, y0);
+  y6 = _mm512_add_epi16(y3, y9);
+  y9 = _mm512_sub_epi16(y3, y9);
+  y3 = _mm512_add_epi16(y7, y5);
+  y5 = _mm512_sub_epi16(y7, y5);
+  y7 = _mm512_add_epi16(y4, y8);
+  y8 = _mm512_sub_epi16(y4, y8);
+  y4 = _mm512_add_epi16(y10, y11);
+  y11 = _mm512_sub_epi16(y10, y11);
+  y6 = _mm512_sub_epi16(y6, y12);
+  y9 = _mm512_add_epi16(y9, y12);
+  y3 = _mm512_sub_epi16(y3, y13);
+  y5 = _mm512_add_epi16(y5, y13);
+  y7 = _mm512_sub_epi16(y7, y14);
+  y8 = _mm512_add_epi16(y8, y14);
+  y4 = _mm512_sub_epi16(y4, y15);
+  y11 = _mm512_add_epi16(y11, y15);
+  y10 = _mm512_castps_si512(_mm512_moveldup_ps(_mm512_castsi512_ps(y8)));
+  y10 = _mm512_mask_blend_epi32(0xaaaa, y7, y10);
+  y7 = _mm512_srli_epi64(y7, 0x20);
+  y8 = _mm512_mask_blend_epi32(0xaaaa, y7, y8);
+  y7 = _mm512_castps_si512(_mm512_moveldup_ps(_mm512_castsi512_ps(y11)));
+  y7 = _mm512_mask_blend_epi32(0xaaaa, y4, y7);
+  y4 = _mm512_srli_epi64(y4, 0x20);
+  y11 = _mm512_mask_blend_epi32(0xaaaa, y4, y11);
+  y15 = mlk_ld2(qp + 0x220, qp + 0x3e0);
+  y2 = mlk_ld2(qp + 0x240, qp + 0x400);
+  y12 = _mm512_mullo_epi16(y10, y15);
+  y13 = _mm512_mullo_epi16(y8, y15);
+  y14 = _mm512_mullo_epi16(y7, y15);
+  y15 = _mm512_mullo_epi16(y11, y15);
+  y10 = _mm512_mulhi_epi16(y10, y2);
+  y8 = _mm512_mulhi_epi16(y8, y2);
+  y7 = _mm512_mulhi_epi16(y7, y2);
+  y11 = _mm512_mulhi_epi16(y11, y2);
+  y4 = _mm512_castps_si512(_mm512_moveldup_ps(_mm512_castsi512_ps(y9)));
+  y4 = _mm512_mask_blend_epi32(0xaaaa, y6, y4);
+  y6 = _mm512_srli_epi64(y6, 0x20);
+  y9 = _mm512_mask_blend_epi32(0xaaaa, y6, y9);
+  y6 = _mm512_castps_si512(_mm512_moveldup_ps(_mm512_castsi512_ps(y5)));
+  y6 = _mm512_mask_blend_epi32(0xaaaa, y3, y6);
+  y3 = _mm512_srli_epi64(y3, 0x20);
+  y5 = _mm512_mask_blend_epi32(0xaaaa, y3, y5);
+  y12 = _mm512_mulhi_epi16(y12, y0);
+  y13 = _mm512_mulhi_epi16(y13, y0);
+  y14 = _mm512_mulhi_epi16(y14, y0);
+  y15 = _mm512_mulhi_epi16(y15, y0);
+  y3 = _mm512_add_epi16(y4, y10);
+  y10 = _mm512_sub_epi16(y4, y10);
+  y4 = _mm512_add_epi16(y9, y8);
+  y8 = _mm512_sub_epi16(y9, y8);
+  y9 = _mm512_add_epi16(y6, y7);
+  y7 = _mm512_sub_epi16(y6, y7);
+  y6 = _mm512_add_epi16(y5, y11);
+  y11 = _mm512_sub_epi16(y5, y11);
+  y3 = _mm512_sub_epi16(y3, y12);
+  y10 = _mm512_add_epi16(y10, y12);
+  y4 = _mm512_sub_epi16(y4, y13);
+  y8 = _mm512_add_epi16(y8, y13);
+  y9 = _mm512_sub_epi16(y9, y14);
+  y7 = _mm512_add_epi16(y7, y14);
+  y6 = _mm512_sub_epi16(y6, y15);
+  y11 = _mm512_add_epi16(y11, y15);
+  y5 = _mm512_slli_epi32(y7, 0x10);
+  y5 = _mm512_mask_blend_epi16(0xaaaaaaaaU, y9, y5);
+  y9 = _mm512_srli_epi32(y9, 0x10);
+  y7 = _mm512_mask_blend_epi16(0xaaaaaaaaU, y9, y7);
+  y9 = _mm512_slli_epi32(y11, 0x10);
+  y9 = _mm512_mask_blend_epi16(0xaaaaaaaaU, y6, y9);
+  y6 = _mm512_srli_epi32(y6, 0x10);
+  y11 = _mm512_mask_blend_epi16(0xaaaaaaaaU, y6, y11);
+  y15 = mlk_ld2(qp + 0x260, qp + 0x420);
+  y2 = mlk_ld2(qp + 0x280, qp + 0x440);
+  y12 = _mm512_mullo_epi16(y5, y15);
+  y13 = _mm512_mullo_epi16(y7, y15);
+  y14 = _mm512_mullo_epi16(y9, y15);
+  y15 = _mm512_mullo_epi16(y11, y15);
+  y5 = _mm512_mulhi_epi16(y5, y2);
+  y7 = _mm512_mulhi_epi16(y7, y2);
+  y9 = _mm512_mulhi_epi16(y9, y2);
+  y11 = _mm512_mulhi_epi16(y11, y2);
+  y6 = _mm512_slli_epi32(y10, 0x10);
+  y6 = _mm512_mask_blend_epi16(0xaaaaaaaaU, y3, y6);
+  y3 = _mm512_srli_epi32(y3, 0x10);
+  y10 = _mm512_mask_blend_epi16(0xaaaaaaaaU, y3, y10);
+  y3 = _mm512_slli_epi32(y8, 0x10);
+  y3 = _mm512_mask_blend_epi16(0xaaaaaaaaU, y4, y3);
+  y4 = _mm512_srli_epi32(y4, 0x10);
+  y8 = _mm512_mask_blend_epi16(0xaaaaaaaaU, y4, y8);
+  y12 = _mm512_mulhi_epi16(y12, y0);
+  y13 = _mm512_mulhi_epi16(y13, y0);
+  y14 = _mm512_mulhi_epi16(y14, y0);
+  y15 = _mm512_mulhi_epi16(y15, y0);
+  y4 = _mm512_add_epi16(y6, y5);
+  y5 = _mm512_sub_epi16(y6, y5);
+  y6 = _mm512_add_epi16(y10, y7);
+  y7 = _mm512_sub_epi16(y10, y7);
+  y10 = _mm512_add_epi16(y3, y9);
+  y9 = _mm512_sub_epi16(y3, y9);
+  y3 = _mm512_add_epi16(y8, y11);
+  y11 = _mm512_sub_epi16(y8, y11);
+  y4 = _mm512_sub_epi16(y4, y12);
+  y5 = _mm512_add_epi16(y5, y12);
+  y6 = _mm512_sub_epi16(y6, y13);
+  y7 = _mm512_add_epi16(y7, y13);
+  y10 = _mm512_sub_epi16(y10, y14);
+  y9 = _mm512_add_epi16(y9, y14);
+  y3 = _mm512_sub_epi16(y3, y15);
+  y11 = _mm512_add_epi16(y11, y15);
+  y14 = mlk_ld2(qp + 0x2a0, qp + 0x460);
+  y15 = mlk_ld2(qp + 0x2e0, qp + 0x4a0);
+  y8 = mlk_ld2(qp + 0x2c0, qp + 0x480);
+  y2 = mlk_ld2(qp + 0x300, qp + 0x4c0);
+  y12 = _mm512_mullo_epi16(y10, y14);
+  y13 = _mm512_mullo_epi16(y3, y14);
+  y14 = _mm512_mullo_epi16(y9, y15);
+  y15 = _mm512_mullo_epi16(y11, y15);
+  y10 = _mm512_mulhi_epi16(y10, y8);
+  y3 = _mm512_mulhi_epi16(y3, y8);
+  y9 = _mm512_mulhi_epi16(y9, y2);
+  y11 = _mm512_mulhi_epi16(y11, y2);
+  y12 = _mm512_mulhi_epi16(y12, y0);
+  y13 = _mm512_mulhi_epi16(y13, y0);
+  y14 = _mm512_mulhi_epi16(y14, y0);
+  y15 = _mm512_mulhi_epi16(y15, y0);
+  y8 = _mm512_add_epi16(y4, y10);
+  y10 = _mm512_sub_epi16(y4, y10);
+  y4 = _mm512_add_epi16(y6, y3);
+  y3 = _mm512_sub_epi16(y6, y3);
+  y6 = _mm512_add_epi16(y5, y9);
+  y9 = _mm512_sub_epi16(y5, y9);
+  y5 = _mm512_add_epi16(y7, y11);
+  y11 = _mm512_sub_epi16(y7, y11);
+  y8 = _mm512_sub_epi16(y8, y12);
+  y10 = _mm512_add_epi16(y10, y12);
+  y4 = _mm512_sub_epi16(y4, y13);
+  y3 = _mm512_add_epi16(y3, y13);
+  y6 = _mm512_sub_epi16(y6, y14);
+  y9 = _mm512_add_epi16(y9, y14);
+  y5 = _mm512_sub_epi16(y5, y15);
+  y11 = _mm512_add_epi16(y11, y15);
+  mlk_st2(rp + 0x0, rp + 0x100, y8);
+  mlk_st2(rp + 0x20, rp + 0x120, y4);
+  mlk_st2(rp + 0x40, rp + 0x140, y10);
+  mlk_st2(rp + 0x60, rp + 0x160, y3);
+  mlk_st2(rp + 0x80, rp + 0x180, y6);
+  mlk_st2(rp + 0xa0, rp + 0x1a0, y5);
+  mlk_st2(rp + 0xc0, rp + 0x1c0, y9);
+  mlk_st2(rp + 0xe0, rp + 0x1e0, y11);
+}
+
+void mlk_invntt_avx512(__m256i *r, const __m256i *qdata)
+{
+  uint8_t *rp = (uint8_t *)r;
+  const uint8_t *qp = (const uint8_t *)qdata;
+  __m512i y0, y1, y2, y3, y4, y5, y6, y7, y8, y9, y10, y11, y12, y13, y14, y15;
+  y0 = mlk_ld2(qp + 0x0, qp + 0x0);
+  y2 = mlk_ld2(qp + 0x60, qp + 0x60);
+  y3 = mlk_ld2(qp + 0x80, qp + 0x80);
+  y4 = mlk_ld2(rp + 0x0, rp + 0x100);
+  y6 = mlk_ld2(rp + 0x40, rp + 0x140);
+  y5 = mlk_ld2(rp + 0x20, rp + 0x120);
+  y7 = mlk_ld2(rp + 0x60, rp + 0x160);
+  y12 = _mm512_mullo_epi16(y4, y2);
+  y4 = _mm512_mulhi_epi16(y4, y3);
+  y12 = _mm512_mulhi_epi16(y12, y0);
+  y4 = _mm512_sub_epi16(y4, y12);
+  y12 = _mm512_mullo_epi16(y6, y2);
+  y6 = _mm512_mulhi_epi16(y6, y3);
+  y12 = _mm512_mulhi_epi16(y12, y0);
+  y6 = _mm512_sub_epi16(y6, y12);
+  y12 = _mm512_mullo_epi16(y5, y2);
+  y5 = _mm512_mulhi_epi16(y5, y3);
+  y12 = _mm512_mulhi_epi16(y12, y0);
+  y5 = _mm512_sub_epi16(y5, y12);
+  y12 = _mm512_mullo_epi16(y7, y2);
+  y7 = _mm512_mulhi_epi16(y7, y3);
+  y12 = _mm512_mulhi_epi16(y12, y0);
+  y7 = _mm512_sub_epi16(y7, y12);
+  y8 = mlk_ld2(rp + 0x80, rp + 0x180);
+  y10 = mlk_ld2(rp + 0xc0, rp + 0x1c0);
+  y9 = mlk_ld2(rp + 0xa0, rp + 0x1a0);
+  y11 = mlk_ld2(rp + 0xe0, rp + 0x1e0);
+  y12 = _mm512_mullo_epi16(y8, y2);
+  y8 = _mm512_mulhi_epi16(y8, y3);
+  y12 = _mm512_mulhi_epi16(y12, y0);
+  y8 = _mm512_sub_epi16(y8, y12);
+  y12 = _mm512_mullo_epi16(y10, y2);
+  y10 = _mm512_mulhi_epi16(y10, y3);
+  y12 = _mm512_mulhi_epi16(y12, y0);
+  y10 = _mm512_sub_epi16(y10, y12);
+  y12 = _mm512_mullo_epi16(y9, y2);
+  y9 = _mm512_mulhi_epi16(y9, y3);
+  y12 = _mm512_mulhi_epi16(y12, y0);
+  y9 = _mm512_sub_epi16(y9, y12);
+  y12 = _mm512_mullo_epi16(y11, y2);
+  y11 = _mm512_mulhi_epi16(y11, y3);
+  y12 = _mm512_mulhi_epi16(y12, y0);
+  y11 = _mm512_sub_epi16(y11, y12);
+  y15 = _mm512_permutex_epi64(mlk_ld2(qp + 0x4a0, qp + 0x2e0), 0x4e);
+  y1 = _mm512_permutex_epi64(mlk_ld2(qp + 0x460, qp + 0x2a0), 0x4e);
+  y2 = _mm512_permutex_epi64(mlk_ld2(qp + 0x4c0, qp + 0x300), 0x4e);
+  y3 = _mm512_permutex_epi64(mlk_ld2(qp + 0x480, qp + 0x2c0), 0x4e);
+  y12 = mlk_ld2(qp + 0x100, qp + 0x100);
+  y15 = _mm512_shuffle_epi8(y15, y12);
+  y1 = _mm512_shuffle_epi8(y1, y12);
+  y2 = _mm512_shuffle_epi8(y2, y12);
+  y3 = _mm512_shuffle_epi8(y3, y12);
+  y12 = _mm512_sub_epi16(y6, y4);
+  y4 = _mm512_add_epi16(y4, y6);
+  y13 = _mm512_sub_epi16(y7, y5);
+  y6 = _mm512_mullo_epi16(y12, y15);
+  y5 = _mm512_add_epi16(y5, y7);
+  y14 = _mm512_sub_epi16(y10, y8);
+  y7 = _mm512_mullo_epi16(y13, y15);
+  y8 = _mm512_add_epi16(y8, y10);
+  y15 = _mm512_sub_epi16(y11, y9);
+  y10 = _mm512_mullo_epi16(y14, y1);
+  y9 = _mm512_add_epi16(y9, y11);
+  y11 = _mm512_mullo_epi16(y15, y1);
+  y12 = _mm512_mulhi_epi16(y12, y2);
+  y13 = _mm512_mulhi_epi16(y13, y2);
+  y14 = _mm512_mulhi_epi16(y14, y3);
+  y15 = _mm512_mulhi_epi16(y15, y3);
+  y6 = _mm512_mulhi_epi16(y6, y0);
+  y7 = _mm512_mulhi_epi16(y7, y0);
+  y10 = _mm512_mulhi_epi16(y10, y0);
+  y11 = _mm512_mulhi_epi16(y11, y0);
+  y6 = _mm512_sub_epi16(y12, y6);
+  y7 = _mm512_sub_epi16(y13, y7);
+  y10 = _mm512_sub_epi16(y14, y10);
+  y11 = _mm512_sub_epi16(y15, y11);
+  y2 = _mm512_permutex_epi64(mlk_ld2(qp + 0x420, qp + 0x260), 0x4e);
+  y3 = _mm512_permutex_epi64(mlk_ld2(qp + 0x440, qp + 0x280), 0x4e);
+  y1 = mlk_ld2(qp + 0x100, qp + 0x100);
+  y2 = _mm512_shuffle_epi8(y2, y1);
+  y3 = _mm512_shuffle_epi8(y3, y1);
+  y12 = _mm512_sub_epi16(y8, y4);
+  y4 = _mm512_add_epi16(y4, y8);
+  y13 = _mm512_sub_epi16(y9, y5);
+  y8 = _mm512_mullo_epi16(y12, y2);
+  y5 = _mm512_add_epi16(y5, y9);
+  y14 = _mm512_sub_epi16(y10, y6);
+  y9 = _mm512_mullo_epi16(y13, y2);
+  y6 = _mm512_add_epi16(y6, y10);
+  y15 = _mm512_sub_epi16(y11, y7);
+  y10 = _mm512_mullo_epi16(y14, y2);
+  y7 = _mm512_add_epi16(y7, y11);
+  y11 = _mm512_mullo_epi16(y15, y2);
+  y12 = _mm512_mulhi_epi16(y12, y3);
+  y13 = _mm512_mulhi_epi16(y13, y3);
+  y14 = _mm512_mulhi_epi16(y14, y3);
+  y15 = _mm512_mulhi_epi16(y15, y3);
+  y8 = _mm512_mulhi_epi16(y8, y0);
+  y9 = _mm512_mulhi_epi16(y9, y0);
+  y10 = _mm512_mulhi_epi16(y10, y0);
+  y11 = _mm512_mulhi_epi16(y11, y0);
+  y8 = _mm512_sub_epi16(y12, y8);
+  y9 = _mm512_sub_epi16(y13, y9);
+  y10 = _mm512_sub_epi16(y14, y10);
+  y11 = _mm512_sub_epi16(y15, y11);
+  y3 = _mm512_slli_epi32(y5, 0x10);
+  y3 = _mm512_mask_blend_epi16(0xaaaaaaaaU, y4, y3);
+  y4 = _mm512_srli_epi32(y4, 0x10);
+  y5 = _mm512_mask_blend_epi16(0xaaaaaaaaU, y4, y5);
+  y4 = _mm512_slli_epi32(y7, 0x10);
+  y4 = _mm512_mask_blend_epi16(0xaaaaaaaaU, y6, y4);
+  y6 = _mm512_srli_epi32(y6, 0x10);
+  y7 = _mm512_mask_blend_epi16(0xaaaaaaaaU, y6, y7);
+  y6 = _mm512_slli_epi32(y9, 0x10);
+  y6 = _mm512_mask_blend_epi16(0xaaaaaaaaU, y8, y6);
+  y8 = _mm512_srli_epi32(y8, 0x10);
+  y9 = _mm512_mask_blend_epi16(0xaaaaaaaaU, y8, y9);
+  y8 = _mm512_slli_epi32(y11, 0x10);
+  y8 = _mm512_mask_blend_epi16(0xaaaaaaaaU, y10, y8);
+  y10 = _mm512_srli_epi32(y10, 0x10);
+  y11 = _mm512_mask_blend_epi16(0xaaaaaaaaU, y10, y11);
+  y12 = mlk_ld2(qp + 0x120, qp + 0x120);
+  y2 = mlk_permd2(y12, mlk_ld2(qp + 0x3e0, qp + 0x220));
+  y10 = mlk_permd2(y12, mlk_ld2(qp + 0x400, qp + 0x240));
+  y12 = _mm512_sub_epi16(y5, y3);
+  y3 = _mm512_add_epi16(y3, y5);
+  y13 = _mm512_sub_epi16(y7, y4);
+  y5 = _mm512_mullo_epi16(y12, y2);
+  y4 = _mm512_add_epi16(y4, y7);
+  y14 = _mm512_sub_epi16(y9, y6);
+  y7 = _mm512_mullo_epi16(y13, y2);
+  y6 = _mm512_add_epi16(y6, y9);
+  y15 = _mm512_sub_epi16(y11, y8);
+  y9 = _mm512_mullo_epi16(y14, y2);
+  y8 = _mm512_add_epi16(y8, y11);
+  y11 = _mm512_mullo_epi16(y15, y2);
+  y12 = _mm512_mulhi_epi16(y12, y10);
+  y13 = _mm512_mulhi_epi16(y13, y10);
+  y14 = _mm512_mulhi_epi16(y14, y10);
+  y15 = _mm512_mulhi_epi16(y15, y10);
+  y5 = _mm512_mulhi_epi16(y5, y0);
+  y7 = _mm512_mulhi_epi16(y7, y0);
+  y9 = _mm512_mulhi_epi16(y9, y0);
+  y11 = _mm512_mulhi_epi16(y11, y0);
+  y5 = _mm512_sub_epi16(y12, y5);
+  y7 = _mm512_sub_epi16(y13, y7);
+  y9 = _mm512_sub_epi16(y14, y9);
+  y11 = _mm512_sub_epi16(y15, y11);
+  y1 = mlk_ld2(qp + 0x40, qp + 0x40);
+  y12 = _mm512_mulhi_epi16(y3, y1);
+  y12 = _mm512_srai_epi16(y12, 0xa);
+  y12 = _mm512_mullo_epi16(y12, y0);
+  y3 = _mm512_sub_epi16(y3, y12);
+  y10 = _mm512_castps_si512(_mm512_moveldup_ps(_mm512_castsi512_ps(y4)));
+  y10 = _mm512_mask_blend_epi32(0xaaaa, y3, y10);
+  y3 = _mm512_srli_epi64(y3, 0x20);
+  y4 = _mm512_mask_blend_epi32(0xaaaa, y3, y4);
+  y3 = _mm512_castps_si512(_mm512_moveldup_ps(_mm512_castsi512_ps(y8)));
+  y3 = _mm512_mask_blend_epi32(0xaaaa, y6, y3);
+  y6 = _mm512_srli_epi64(y6, 0x20);
+  y8 = _mm512_mask_blend_epi32(0xaaaa, y6, y8);
+  y6 = _mm512_castps_si512(_mm512_moveldup_ps(_mm512_castsi512_ps(y7)));
+  y6 = _mm512_mask_blend_epi32(0xaaaa, y5, y6);
+  y5 = _mm512_srli_epi64(y5, 0x20);
+  y7 = _mm512_mask_blend_epi32(0xaaaa, y5, y7);
+  y5 = _mm512_castps_si512(_mm512_moveldup_ps(_mm512_castsi512_ps(y11)));
+  y5 = _mm512_mask_blend_epi32(0xaaaa, y9, y5);
+  y9 = _mm512_srli_epi64(y9, 0x20);
+  y11 = _mm512_mask_blend_epi32(0xaaaa, y9, y11);
+  y2 = _mm512_permutex_epi64(mlk_ld2(qp + 0x3a0, qp + 0x1e0), 0x1b);
+  y9 = _mm512_permutex_epi64(mlk_ld2(qp + 0x3c0, qp + 0x200), 0x1b);
+  y12 = _mm512_sub_epi16(y4, y10);
+  y10 = _mm512_add_epi16(y10, y4);
+  y13 = _mm512_sub_epi16(y8, y3);
+  y4 = _mm512_mullo_epi16(y12, y2);
+  y3 = _mm512_add_epi16(y3, y8);
+  y14 = _mm512_sub_epi16(y7, y6);
+  y8 = _mm512_mullo_epi16(y13, y2);
+  y6 = _mm512_add_epi16(y6, y7);
+  y15 = _mm512_sub_epi16(y11, y5);
+  y7 = _mm512_mullo_epi16(y14, y2);
+  y5 = _mm512_add_epi16(y5, y11);
+  y11 = _mm512_mullo_epi16(y15, y2);
+  y12 = _mm512_mulhi_epi16(y12, y9);
+  y13 = _mm512_mulhi_epi16(y13, y9);
+  y14 = _mm512_mulhi_epi16(y14, y9);
+  y15 = _mm512_mulhi_epi16(y15, y9);
+  y4 = _mm512_mulhi_epi16(y4, y0);
+  y8 = _mm512_mulhi_epi16(y8, y0);
+  y7 = _mm512_mulhi_epi16(y7, y0);
+  y11 = _mm512_mulhi_epi16(y11, y0);
+  y4 = _mm512_sub_epi16(y12, y4);
+  y8 = _mm512_sub_epi16(y13, y8);
+  y7 = _mm512_sub_epi16(y14, y7);
+  y11 = _mm512_sub_epi16(y15, y11);
+  y12 = _mm512_mulhi_epi16(y10, y1);
+  y12 = _mm512_srai_epi16(y12, 0xa);
+  y12 = _mm512_mullo_epi16(y12, y0);
+  y10 = _mm512_sub_epi16(y10, y12);
+  y9 = _mm512_unpacklo_epi64(y10, y3);
+  y3 = _mm512_unpackhi_epi64(y10, y3);
+  y10 = _mm512_unpacklo_epi64(y6, y5);
+  y5 = _mm512_unpackhi_epi64(y6, y5);
+  y6 = _mm512_unpacklo_epi64(y4, y8);
+  y8 = _mm512_unpackhi_epi64(y4, y8);
+  y4 = _mm512_unpacklo_epi64(y7, y11);
+  y11 = _mm512_unpackhi_epi64(y7, y11);
+  y2 = _mm512_permutex_epi64(mlk_ld2(qp + 0x360, qp + 0x1a0), 0x4e);
+  y7 = _mm512_permutex_epi64(mlk_ld2(qp + 0x380, qp + 0x1c0), 0x4e);
+  y12 = _mm512_sub_epi16(y3, y9);
+  y9 = _mm512_add_epi16(y9, y3);
+  y13 = _mm512_sub_epi16(y5, y10);
+  y3 = _mm512_mullo_epi16(y12, y2);
+  y10 = _mm512_add_epi16(y10, y5);
+  y14 = _mm512_sub_epi16(y8, y6);
+  y5 = _mm512_mullo_epi16(y13, y2);
+  y6 = _mm512_add_epi16(y6, y8);
+  y15 = _mm512_sub_epi16(y11, y4);
+  y8 = _mm512_mullo_epi16(y14, y2);
+  y4 = _mm512_add_epi16(y4, y11);
+  y11 = _mm512_mullo_epi16(y15, y2);
+  y12 = _mm512_mulhi_epi16(y12, y7);
+  y13 = _mm512_mulhi_epi16(y13, y7);
+  y14 = _mm512_mulhi_epi16(y14, y7);
+  y15 = _mm512_mulhi_epi16(y15, y7);
+  y3 = _mm512_mulhi_epi16(y3, y0);
+  y5 = _mm512_mulhi_epi16(y5, y0);
+  y8 = _mm512_mulhi_epi16(y8, y0);
+  y11 = _mm512_mulhi_epi16(y11, y0);
+  y3 = _mm512_sub_epi16(y12, y3);
+  y5 = _mm512_sub_epi16(y13, y5);
+  y8 = _mm512_sub_epi16(y14, y8);
+  y11 = _mm512_sub_epi16(y15, y11);
+  y12 = _mm512_mulhi_epi16(y9, y1);
+  y12 = _mm512_srai_epi16(y12, 0xa);
+  y12 = _mm512_mullo_epi16(y12, y0);
+  y9 = _mm512_sub_epi16(y9, y12);
+  y7 = _mm512_permutex2var_epi64(y9, _mm512_setr_epi64(0, 1, 8, 9, 4, 5, 12, 13), y10);
+  y10 = _mm512_permutex2var_epi64(y9, _mm512_setr_epi64(2, 3, 10, 11, 6, 7, 14, 15), y10);
+  y9 = _mm512_permutex2var_epi64(y6, _mm512_setr_epi64(0, 1, 8, 9, 4, 5, 12, 13), y4);
+  y4 = _mm512_permutex2var_epi64(y6, _mm512_setr_epi64(2, 3, 10, 11, 6, 7, 14, 15), y4);
+  y6 = _mm512_permutex2var_epi64(y3, _mm512_setr_epi64(0, 1, 8, 9, 4, 5, 12, 13), y5);
+  y5 = _mm512_permutex2var_epi64(y3, _mm512_setr_epi64(2, 3, 10, 11, 6, 7, 14, 15), y5);
+  y3 = _mm512_permutex2var_epi64(y8, _mm512_setr_epi64(0, 1, 8, 9, 4, 5, 12, 13), y11);
+  y11 = _mm512_permutex2var_epi64(y8, _mm512_setr_epi64(2, 3, 10, 11, 6, 7, 14, 15), y11);
+  y2 = mlk_ld2(qp + 0x320, qp + 0x160);
+  y8 = mlk_ld2(qp + 0x340, qp + 0x180);
+  y12 = _mm512_sub_epi16(y10, y7);
+  y7 = _mm512_add_epi16(y7, y10);
+  y13 = _mm512_sub_epi16(y4, y9);
+  y10 = _mm512_mullo_epi16(y12, y2);
+  y9 = _mm512_add_epi16(y9, y4);
+  y14 = _mm512_sub_epi16(y5, y6);
+  y4 = _mm512_mullo_epi16(y13, y2);
+  y6 = _mm512_add_epi16(y6, y5);
+  y15 = _mm512_sub_epi16(y11, y3);
+  y5 = _mm512_mullo_epi16(y14, y2);
+  y3 = _mm512_add_epi16(y3, y11);
+  y11 = _mm512_mullo_epi16(y15, y2);
+  y12 = _mm512_mulhi_epi16(y12, y8);
+  y13 = _mm512_mulhi_epi16(y13, y8);
+  y14 = _mm512_mulhi_epi16(y14, y8);
+  y15 = _mm512_mulhi_epi16(y15, y8);
+  y10 = _mm512_mulhi_epi16(y10, y0);
+  y4 = _mm512_mulhi_epi16(y4, y0);
+  y5 = _mm512_mulhi_epi16(y5, y0);
+  y11 = _mm512_mulhi_epi16(y11, y0);
+  y10 = _mm512_sub_epi16(y12, y10);
+  y4 = _mm512_sub_epi16(y13, y4);
+  y5 = _mm512_sub_epi16(y14, y5);
+  y11 = _mm512_sub_epi16(y15, y11);
+  y12 = _mm512_mulhi_epi16(y7, y1);
+  y12 = _mm512_srai_epi16(y12, 0xa);
+  y12 = _mm512_mullo_epi16(y12, y0);
+  y7 = _mm512_sub_epi16(y7, y12);
+  mlk_st2(rp + 0x0, rp + 0x100, y7);
+  mlk_st2(rp + 0x20, rp + 0x120, y9);
+  mlk_st2(rp + 0x40, rp + 0x140, y6);
+  mlk_st2(rp + 0x60, rp + 0x160, y3);
+  mlk_st2(rp + 0x80, rp + 0x180, y10);
+  mlk_st2(rp + 0xa0, rp + 0x1a0, y4);
+  mlk_st2(rp + 0xc0, rp + 0x1c0, y5);
+  mlk_st2(rp + 0xe0, rp + 0x1e0, y11);
+  y4 = mlk_ld2(rp + 0x0, rp + 0x80);
+  y8 = mlk_ld2(rp + 0x100, rp + 0x180);
+  y5 = mlk_ld2(rp + 0x20, rp + 0xa0);
+  y9 = mlk_ld2(rp + 0x120, rp + 0x1a0);
+  y2 = mlk_bq2(qp + 0x140, qp + 0x140);
+  y6 = mlk_ld2(rp + 0x40, rp + 0xc0);
+  y10 = mlk_ld2(rp + 0x140, rp + 0x1c0);
+  y7 = mlk_ld2(rp + 0x60, rp + 0xe0);
+  y11 = mlk_ld2(rp + 0x160, rp + 0x1e0);
+  y3 = mlk_bq2(qp + 0x148, qp + 0x148);
+  y12 = _mm512_sub_epi16(y8, y4);
+  y4 = _mm512_add_epi16(y4, y8);
+  y13 = _mm512_sub_epi16(y9, y5);
+  y8 = _mm512_mullo_epi16(y12, y2);
+  y5 = _mm512_add_epi16(y5, y9);
+  y14 = _mm512_sub_epi16(y10, y6);
+  y9 = _mm512_mullo_epi16(y13, y2);
+  y6 = _mm512_add_epi16(y6, y10);
+  y15 = _mm512_sub_epi16(y11, y7);
+  y10 = _mm512_mullo_epi16(y14, y2);
+  y7 = _mm512_add_epi16(y7, y11);
+  y11 = _mm512_mullo_epi16(y15, y2);
+  y12 = _mm512_mulhi_epi16(y12, y3);
+  y13 = _mm512_mulhi_epi16(y13, y3);
+  y14 = _mm512_mulhi_epi16(y14, y3);
+  y15 = _mm512_mulhi_epi16(y15, y3);
+  y8 = _mm512_mulhi_epi16(y8, y0);
+  y9 = _mm512_mulhi_epi16(y9, y0);
+  y10 = _mm512_mulhi_epi16(y10, y0);
+  y11 = _mm512_mulhi_epi16(y11, y0);
+  y8 = _mm512_sub_epi16(y12, y8);
+  y9 = _mm512_sub_epi16(y13, y9);
+  y10 = _mm512_sub_epi16(y14, y10);
+  y11 = _mm512_sub_epi16(y15, y11);
+  mlk_st2(rp + 0x0, rp + 0x80, y4);
+  mlk_st2(rp + 0x20, rp + 0xa0, y5);
+  mlk_st2(rp + 0x40, rp + 0xc0, y6);
+  mlk_st2(rp + 0x60, rp + 0xe0, y7);
+  mlk_st2(rp + 0x100, rp + 0x180, y8);
+  mlk_st2(rp + 0x120, rp + 0x1a0, y9);
+  mlk_st2(rp + 0x140, rp + 0x1c0, y10);
+  mlk_st2(rp + 0x160, rp + 0x1e0, y11);
+}
+
+#else /* MLK_ARITH_BACKEND_X86_64_DEFAULT && !MLK_CONFIG_MULTILEVEL_NO_SHARED \
+         && MLK_CONFIG_X86_64_AVX512 */
+
+MLK_EMPTY_CU(avx512_ntt)
+
+#endif /* !(MLK_ARITH_BACKEND_X86_64_DEFAULT &&     \
+          !MLK_CONFIG_MULTILEVEL_NO_SHARED &&      \
+          MLK_CONFIG_X86_64_AVX512) */
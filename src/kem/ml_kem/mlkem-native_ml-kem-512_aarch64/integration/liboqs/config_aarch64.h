@@ -45,13 +45,12 @@
  *              This can also be set using CFLAGS.
  *
  *****************************************************************************/
-#if MLK_CONFIG_PARAMETER_SET == 512
-#define MLK_CONFIG_NAMESPACE_PREFIX PQCP_MLKEM_NATIVE_MLKEM512_AARCH64
-#elif MLK_CONFIG_PARAMETER_SET == 768
-#define MLK_CONFIG_NAMESPACE_PREFIX PQCP_MLKEM_NATIVE_MLKEM768_AARCH64
-#elif MLK_CONFIG_PARAMETER_SET == 1024
-#define MLK_CONFIG_NAMESPACE_PREFIX PQCP_MLKEM_NATIVE_MLKEM1024_AARCH64
-#endif
+/* liboqs compiles ML-KEM-512/768/1024 as one multi-level build (see
+ * src/kem/ml_kem/CMakeLists.txt): level-dependent symbols get the
+ * parameter set appended to this prefix, e.g.
+ * PQCP_MLKEM_NATIVE_AARCH64_MLKEM768_keypair, while the level-independent
+ * code is compiled once and shared by all parameter sets. */
+#define MLK_CONFIG_NAMESPACE_PREFIX PQCP_MLKEM_NATIVE_AARCH64_MLKEM
 
 /******************************************************************************
  * Name:        MLK_CONFIG_USE_NATIVE_BACKEND_ARITH
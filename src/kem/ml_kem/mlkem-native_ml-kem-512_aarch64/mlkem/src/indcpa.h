@@ -140,4 +140,113 @@ __contract__(
   assigns(object_whole(m))
 );
 
+/* Parameter set namespacing
+ * This is to facilitate building multiple instances
+ * of mlkem-native (e.g. with varying parameter sets)
+ * within a single compilation unit. */
+#define mlk_indcpa_public_key MLK_ADD_PARAM_SET(mlk_indcpa_public_key)
+#define mlk_indcpa_secret_key MLK_ADD_PARAM_SET(mlk_indcpa_secret_key)
+/* End of parameter set namespacing */
+
+/* Public key in the form mlk_indcpa_enc works with: the transposed matrix
+ * A^T as returned by mlk_gen_matrix, and the unpacked vector t. */
+typedef struct
+{
+  mlk_polymat at;
+  mlk_polyvec pkpv;
+} mlk_indcpa_public_key;
+
+/* Secret key in the form mlk_indcpa_dec works with: the unpacked vector s. */
+typedef struct
+{
+  mlk_polyvec skpv;
+} mlk_indcpa_secret_key;
+
+#define mlk_indcpa_expand_pk MLK_NAMESPACE_K(indcpa_expand_pk)
+/*************************************************
+ * Name:        mlk_indcpa_expand_pk
+ *
+ * Description: Unpacks a public key and expands its matrix, so that
+ *              repeated encryptions under the key can skip both steps.
+ *
+ * Arguments:   - mlk_indcpa_public_key *pk: pointer to output expanded key
+ *              - const uint8_t *packedpk: pointer to input public key
+ *                                   (of length MLKEM_INDCPA_PUBLICKEYBYTES)
+ *
+ * Specification: Implements @[FIPS203, Algorithm 14 (K-PKE.Encrypt), L2-8].
+ *
+ **************************************************/
+MLK_INTERNAL_API
+void mlk_indcpa_expand_pk(mlk_indcpa_public_key *pk,
+                          const uint8_t packedpk[MLKEM_INDCPA_PUBLICKEYBYTES])
+__contract__(
+  requires(memory_no_alias(pk, sizeof(mlk_indcpa_public_key)))
+  requires(memory_no_alias(packedpk, MLKEM_INDCPA_PUBLICKEYBYTES))
+  assigns(object_whole(pk))
+);
+
+#define mlk_indcpa_expand_sk MLK_NAMESPACE_K(indcpa_expand_sk)
+/*************************************************
+ * Name:        mlk_indcpa_expand_sk
+ *
+ * Description: Unpacks a secret key for repeated decryptions.
+ *
+ * Arguments:   - mlk_indcpa_secret_key *sk: pointer to output expanded key
+ *              - const uint8_t *packedsk: pointer to input secret key
+ *                                   (of length MLKEM_INDCPA_SECRETKEYBYTES)
+ *
+ * Specification: Implements @[FIPS203, Algorithm 15 (K-PKE.Decrypt), L5].
+ *
+ **************************************************/
+MLK_INTERNAL_API
+void mlk_indcpa_expand_sk(mlk_indcpa_secret_key *sk,
+                          const uint8_t packedsk[MLKEM_INDCPA_SECRETKEYBYTES])
+__contract__(
+  requires(memory_no_alias(sk, sizeof(mlk_indcpa_secret_key)))
+  requires(memory_no_alias(packedsk, MLKEM_INDCPA_SECRETKEYBYTES))
+  assigns(object_whole(sk))
+);
+
+#define mlk_indcpa_enc_expanded MLK_NAMESPACE_K(indcpa_enc_expanded)
+/*************************************************
+ * Name:        mlk_indcpa_enc_expanded
+ *
+ * Description: As mlk_indcpa_enc, for a key from mlk_indcpa_expand_pk.
+ *
+ * Specification: Implements @[FIPS203, Algorithm 14 (K-PKE.Encrypt), L9-24].
+ *
+ **************************************************/
+MLK_INTERNAL_API
+void mlk_indcpa_enc_expanded(uint8_t c[MLKEM_INDCPA_BYTES],
+                             const uint8_t m[MLKEM_INDCPA_MSGBYTES],
+                             const mlk_indcpa_public_key *pk,
+                             const uint8_t coins[MLKEM_SYMBYTES])
+__contract__(
+  requires(memory_no_alias(c, MLKEM_INDCPA_BYTES))
+  requires(memory_no_alias(m, MLKEM_INDCPA_MSGBYTES))
+  requires(memory_no_alias(pk, sizeof(mlk_indcpa_public_key)))
+  requires(memory_no_alias(coins, MLKEM_SYMBYTES))
+  assigns(object_whole(c))
+);
+
+#define mlk_indcpa_dec_expanded MLK_NAMESPACE_K(indcpa_dec_expanded)
+/*************************************************
+ * Name:        mlk_indcpa_dec_expanded
+ *
+ * Description: As mlk_indcpa_dec, for a key from mlk_indcpa_expand_sk.
+ *
+ * Specification: Implements @[FIPS203, Algorithm 15 (K-PKE.Decrypt), L1-4,6-8].
+ *
+ **************************************************/
+MLK_INTERNAL_API
+void mlk_indcpa_dec_expanded(uint8_t m[MLKEM_INDCPA_MSGBYTES],
+                             const uint8_t c[MLKEM_INDCPA_BYTES],
+                             const mlk_indcpa_secret_key *sk)
+__contract__(
+  requires(memory_no_alias(c, MLKEM_INDCPA_BYTES))
+  requires(memory_no_alias(m, MLKEM_INDCPA_MSGBYTES))
+  requires(memory_no_alias(sk, sizeof(mlk_indcpa_secret_key)))
+  assigns(object_whole(m))
+);
+
 #endif /* !MLK_INDCPA_H */
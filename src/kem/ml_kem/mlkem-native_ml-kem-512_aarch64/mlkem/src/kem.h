@@ -15,6 +15,7 @@
 #ifndef MLK_KEM_H
 #define MLK_KEM_H
 
+#include <stddef.h>
 #include <stdint.h>
 #include "cbmc.h"
 #include "common.h"
@@ -49,6 +50,13 @@
 #define crypto_kem_enc_derand MLK_NAMESPACE_K(enc_derand)
 #define crypto_kem_enc MLK_NAMESPACE_K(enc)
 #define crypto_kem_dec MLK_NAMESPACE_K(dec)
+#define crypto_kem_expanded_pk_bytes MLK_NAMESPACE_K(expanded_pk_bytes)
+#define crypto_kem_expanded_sk_bytes MLK_NAMESPACE_K(expanded_sk_bytes)
+#define crypto_kem_expand_pk MLK_NAMESPACE_K(expand_pk)
+#define crypto_kem_expand_sk MLK_NAMESPACE_K(expand_sk)
+#define crypto_kem_enc_derand_expanded MLK_NAMESPACE_K(enc_derand_expanded)
+#define crypto_kem_enc_expanded MLK_NAMESPACE_K(enc_expanded)
+#define crypto_kem_dec_expanded MLK_NAMESPACE_K(dec_expanded)
 
 /*************************************************
  * Name:        crypto_kem_keypair_derand
@@ -224,4 +232,98 @@ __contract__(
   assigns(object_whole(ss))
 );
 
+/*************************************************
+ * Name:        crypto_kem_expanded_pk_bytes / crypto_kem_expanded_sk_bytes
+ *
+ * Description: Size of the buffer crypto_kem_expand_pk / crypto_kem_expand_sk
+ *              write an expanded key to. The buffer needs no particular
+ *              alignment; the size includes room to align the key inside it.
+ *
+ **************************************************/
+MLK_EXTERNAL_API
+size_t crypto_kem_expanded_pk_bytes(void);
+
+MLK_EXTERNAL_API
+size_t crypto_kem_expanded_sk_bytes(void);
+
+/*************************************************
+ * Name:        crypto_kem_expand_pk
+ *
+ * Description: Checks and expands a public key for repeated encapsulation:
+ *              unpacks the key, expands the matrix A^T and hashes the key.
+ *
+ * Arguments:   - void *epk: pointer to output expanded key
+ *                (an already allocated array of crypto_kem_expanded_pk_bytes()
+ *                 bytes)
+ *              - const uint8_t *pk: pointer to input public key
+ *                (an already allocated array of MLKEM_INDCCA_PUBLICKEYBYTES
+ *                 bytes)
+ *
+ * Returns: - 0 on success
+ *          - -1 if the 'modulus check' @[FIPS203, Section 7.2]
+ *            for the public key fails.
+ *
+ **************************************************/
+MLK_EXTERNAL_API
+MLK_MUST_CHECK_RETURN_VALUE
+int crypto_kem_expand_pk(void *epk,
+                         const uint8_t pk[MLKEM_INDCCA_PUBLICKEYBYTES]);
+
+/*************************************************
+ * Name:        crypto_kem_expand_sk
+ *
+ * Description: Checks and expands a secret key for repeated decapsulation:
+ *              unpacks the secret vector, and expands the public key it
+ *              contains for the re-encryption.
+ *
+ * Arguments:   - void *esk: pointer to output expanded key
+ *                (an already allocated array of crypto_kem_expanded_sk_bytes()
+ *                 bytes)
+ *              - const uint8_t *sk: pointer to input private key
+ *                (an already allocated array of MLKEM_INDCCA_SECRETKEYBYTES
+ *                 bytes)
+ *
+ * Returns: - 0 on success
+ *          - -1 if the 'hash check' @[FIPS203, Section 7.3]
+ *            for the secret key fails.
+ *
+ **************************************************/
+MLK_EXTERNAL_API
+MLK_MUST_CHECK_RETURN_VALUE
+int crypto_kem_expand_sk(void *esk,
+                         const uint8_t sk[MLKEM_INDCCA_SECRETKEYBYTES]);
+
+/*************************************************
+ * Name:        crypto_kem_enc_derand_expanded / crypto_kem_enc_expanded
+ *
+ * Description: As crypto_kem_enc_derand / crypto_kem_enc, for a key from
+ *              crypto_kem_expand_pk. The key was checked when it was
+ *              expanded, so these always return 0.
+ *
+ **************************************************/
+MLK_EXTERNAL_API
+MLK_MUST_CHECK_RETURN_VALUE
+int crypto_kem_enc_derand_expanded(uint8_t ct[MLKEM_INDCCA_CIPHERTEXTBYTES],
+                                   uint8_t ss[MLKEM_SSBYTES], const void *epk,
+                                   const uint8_t coins[MLKEM_SYMBYTES]);
+
+MLK_EXTERNAL_API
+MLK_MUST_CHECK_RETURN_VALUE
+int crypto_kem_enc_expanded(uint8_t ct[MLKEM_INDCCA_CIPHERTEXTBYTES],
+                            uint8_t ss[MLKEM_SSBYTES], const void *epk);
+
+/*************************************************
+ * Name:        crypto_kem_dec_expanded
+ *
+ * Description: As crypto_kem_dec, for a key from crypto_kem_expand_sk. The
+ *              key was checked when it was expanded, so this always
+ *              returns 0.
+ *
+ **************************************************/
+MLK_EXTERNAL_API
+MLK_MUST_CHECK_RETURN_VALUE
+int crypto_kem_dec_expanded(uint8_t ss[MLKEM_SSBYTES],
+                            const uint8_t ct[MLKEM_INDCCA_CIPHERTEXTBYTES],
+                            const void *esk);
+
 #endif /* !MLK_KEM_H */
@@ -45,13 +45,12 @@
  *              This can also be set using CFLAGS.
  *
  *****************************************************************************/
-#if MLK_CONFIG_PARAMETER_SET == 512
-#define MLK_CONFIG_NAMESPACE_PREFIX PQCP_MLKEM_NATIVE_MLKEM512_C
-#elif MLK_CONFIG_PARAMETER_SET == 768
-#define MLK_CONFIG_NAMESPACE_PREFIX PQCP_MLKEM_NATIVE_MLKEM768_C
-#elif MLK_CONFIG_PARAMETER_SET == 1024
-#define MLK_CONFIG_NAMESPACE_PREFIX PQCP_MLKEM_NATIVE_MLKEM1024_C
-#endif
+/* liboqs compiles ML-KEM-512/768/1024 as one multi-level build (see
+ * src/kem/ml_kem/CMakeLists.txt): level-dependent symbols get the
+ * parameter set appended to this prefix, e.g.
+ * PQCP_MLKEM_NATIVE_C_MLKEM768_keypair, while the level-independent
+ * code is compiled once and shared by all parameter sets. */
+#define MLK_CONFIG_NAMESPACE_PREFIX PQCP_MLKEM_NATIVE_C_MLKEM
 
 /******************************************************************************
  * Name:        MLK_CONFIG_FIPS202_CUSTOM_HEADER
@@ -219,6 +218,13 @@ static MLK_INLINE void mlk_randombytes(uint8_t *ptr, size_t len)
 #if defined(OQS_ENABLE_TEST_CONSTANT_TIME)
 #define MLK_CONFIG_CT_TESTING_ENABLED
 #endif
+
+/* Use the compiler vector-extension backend for the NTT, inverse NTT and
+ * base multiplication when liboqs is built with OQS_USE_VECTOR_EXTENSIONS. */
+#if defined(OQS_USE_VECTOR_EXTENSIONS)
+#define MLK_CONFIG_USE_NATIVE_BACKEND_ARITH
+#define MLK_CONFIG_ARITH_BACKEND_FILE "native/vecext/meta.h"
+#endif
 #endif /* !__ASSEMBLER__ */
 
 #endif /* !MLK_INTEGRATION_LIBOQS_CONFIG_C_H */
@@ -41,6 +41,8 @@
 #define mlk_pack_ciphertext MLK_ADD_PARAM_SET(mlk_pack_ciphertext)
 #define mlk_unpack_ciphertext MLK_ADD_PARAM_SET(mlk_unpack_ciphertext)
 #define mlk_matvec_mul MLK_ADD_PARAM_SET(mlk_matvec_mul)
+#define mlk_indcpa_enc_unpacked MLK_ADD_PARAM_SET(mlk_indcpa_enc_unpacked)
+#define mlk_indcpa_dec_unpacked MLK_ADD_PARAM_SET(mlk_indcpa_dec_unpacked)
 /* End of parameter set namespacing */
 
 /*************************************************
@@ -403,39 +405,43 @@ void mlk_indcpa_keypair_derand(uint8_t pk[MLKEM_INDCPA_PUBLICKEYBYTES],
   mlk_zeroize(&skpv_cache, sizeof(skpv_cache));
 }
 
+/*************************************************
+ * Name:        mlk_indcpa_enc_unpacked
+ *
+ * Description: Encryption with an unpacked public key; the part of
+ *              mlk_indcpa_enc after unpacking the key and expanding A^T.
+ *
+ * Arguments:   - uint8_t *c: pointer to output ciphertext
+ *                            (of length MLKEM_INDCPA_BYTES bytes)
+ *              - const uint8_t *m: pointer to input message
+ *                                  (of length MLKEM_INDCPA_MSGBYTES bytes)
+ *              - mlk_polymat at: transposed matrix A^T from mlk_gen_matrix
+ *              - mlk_polyvec pkpv: public-key vector from mlk_unpack_pk
+ *              - const uint8_t *coins: pointer to input random coins
+ *                                  (of length MLKEM_SYMBYTES)
+ *
+ * Specification: Implements @[FIPS203, Algorithm 14 (K-PKE.Encrypt), L9-24].
+ *
+ **************************************************/
+
 /* Reference: `indcpa_enc()` in the reference implementation @[REF].
  *            - We use x4-batched versions of `poly_getnoise` to leverage
  *              batched x4-batched Keccak-f1600.
- *            - We use a different implementation of `gen_matrix()` which
- *              uses x4-batched Keccak-f1600 (see `mlk_gen_matrix()` above).
  *            - We use a mulcache to speed up matrix-vector multiplication.
  *            - We include buffer zeroization.
  */
-MLK_INTERNAL_API
-void mlk_indcpa_enc(uint8_t c[MLKEM_INDCPA_BYTES],
-                    const uint8_t m[MLKEM_INDCPA_MSGBYTES],
-                    const uint8_t pk[MLKEM_INDCPA_PUBLICKEYBYTES],
-                    const uint8_t coins[MLKEM_SYMBYTES])
+static void mlk_indcpa_enc_unpacked(uint8_t c[MLKEM_INDCPA_BYTES],
+                                    const uint8_t m[MLKEM_INDCPA_MSGBYTES],
+                                    const mlk_polymat at,
+                                    const mlk_polyvec pkpv,
+                                    const uint8_t coins[MLKEM_SYMBYTES])
 {
-  MLK_ALIGN uint8_t seed[MLKEM_SYMBYTES];
-  mlk_polymat at;
-  mlk_polyvec sp, pkpv, ep, b;
+  mlk_polyvec sp, ep, b;
   mlk_poly v, k, epp;
   mlk_polyvec_mulcache sp_cache;
 
-  mlk_unpack_pk(pkpv, seed, pk);
   mlk_poly_frommsg(&k, m);
 
-  /*
-   * Declassify the public seed.
-   * Required to use it in conditional-branches in rejection sampling.
-   * This is needed because in re-encryption the publicseed originated from sk
-   * which is marked undefined.
-   */
-  MLK_CT_TESTING_DECLASSIFY(seed, MLKEM_SYMBYTES);
-
-  mlk_gen_matrix(at, seed, 1 /* transpose */);
-
 #if MLKEM_K == 2
   mlk_poly_getnoise_eta1122_4x(&sp[0], &sp[1], &ep[0], &ep[1], coins, 0, 1, 2,
                                3);
@@ -475,31 +481,96 @@ void mlk_indcpa_enc(uint8_t c[MLKEM_INDCPA_BYTES],
 
   /* Specification: Partially implements
    * @[FIPS203, Section 3.3, Destruction of intermediate values] */
-  mlk_zeroize(seed, sizeof(seed));
   mlk_zeroize(&sp, sizeof(sp));
   mlk_zeroize(&sp_cache, sizeof(sp_cache));
   mlk_zeroize(&b, sizeof(b));
   mlk_zeroize(&v, sizeof(v));
-  mlk_zeroize(at, sizeof(at));
   mlk_zeroize(&k, sizeof(k));
   mlk_zeroize(&ep, sizeof(ep));
   mlk_zeroize(&epp, sizeof(epp));
 }
 
+/* Reference: `indcpa_enc()` in the reference implementation @[REF].
+ *            - We use a different implementation of `gen_matrix()` which
+ *              uses x4-batched Keccak-f1600 (see `mlk_gen_matrix()` above).
+ *            - We include buffer zeroization.
+ */
+MLK_INTERNAL_API
+void mlk_indcpa_enc(uint8_t c[MLKEM_INDCPA_BYTES],
+                    const uint8_t m[MLKEM_INDCPA_MSGBYTES],
+                    const uint8_t pk[MLKEM_INDCPA_PUBLICKEYBYTES],
+                    const uint8_t coins[MLKEM_SYMBYTES])
+{
+  mlk_indcpa_public_key epk;
+
+  mlk_indcpa_expand_pk(&epk, pk);
+  mlk_indcpa_enc_unpacked(c, m, epk.at, epk.pkpv, coins);
+
+  /* Specification: Partially implements
+   * @[FIPS203, Section 3.3, Destruction of intermediate values] */
+  mlk_zeroize(&epk, sizeof(epk));
+}
+
+MLK_INTERNAL_API
+void mlk_indcpa_expand_pk(mlk_indcpa_public_key *pk,
+                          const uint8_t packedpk[MLKEM_INDCPA_PUBLICKEYBYTES])
+{
+  MLK_ALIGN uint8_t seed[MLKEM_SYMBYTES];
+
+  mlk_unpack_pk(pk->pkpv, seed, packedpk);
+
+  /*
+   * Declassify the public seed.
+   * Required to use it in conditional-branches in rejection sampling.
+   * This is needed because in re-encryption the publicseed originated from sk
+   * which is marked undefined.
+   */
+  MLK_CT_TESTING_DECLASSIFY(seed, MLKEM_SYMBYTES);
+
+  mlk_gen_matrix(pk->at, seed, 1 /* transpose */);
+
+  /* Specification: Partially implements
+   * @[FIPS203, Section 3.3, Destruction of intermediate values] */
+  mlk_zeroize(seed, sizeof(seed));
+}
+
+MLK_INTERNAL_API
+void mlk_indcpa_enc_expanded(uint8_t c[MLKEM_INDCPA_BYTES],
+                             const uint8_t m[MLKEM_INDCPA_MSGBYTES],
+                             const mlk_indcpa_public_key *pk,
+                             const uint8_t coins[MLKEM_SYMBYTES])
+{
+  mlk_indcpa_enc_unpacked(c, m, pk->at, pk->pkpv, coins);
+}
+
+/*************************************************
+ * Name:        mlk_indcpa_dec_unpacked
+ *
+ * Description: Decryption with an unpacked secret key; the part of
+ *              mlk_indcpa_dec after unpacking the key.
+ *
+ * Arguments:   - uint8_t *m: pointer to output decrypted message
+ *                            (of length MLKEM_INDCPA_MSGBYTES)
+ *              - const uint8_t *c: pointer to input ciphertext
+ *                                  (of length MLKEM_INDCPA_BYTES)
+ *              - mlk_polyvec skpv: secret-key vector from mlk_unpack_sk
+ *
+ * Specification: Implements @[FIPS203, Algorithm 15 (K-PKE.Decrypt), L1-4,6-8].
+ *
+ **************************************************/
+
 /* Reference: `indcpa_dec()` in the reference implementation @[REF].
  *            - We use a mulcache for the scalar product.
  *            - We include buffer zeroization. */
-MLK_INTERNAL_API
-void mlk_indcpa_dec(uint8_t m[MLKEM_INDCPA_MSGBYTES],
-                    const uint8_t c[MLKEM_INDCPA_BYTES],
-                    const uint8_t sk[MLKEM_INDCPA_SECRETKEYBYTES])
+static void mlk_indcpa_dec_unpacked(uint8_t m[MLKEM_INDCPA_MSGBYTES],
+                                    const uint8_t c[MLKEM_INDCPA_BYTES],
+                                    const mlk_polyvec skpv)
 {
-  mlk_polyvec b, skpv;
+  mlk_polyvec b;
   mlk_poly v, sb;
   mlk_polyvec_mulcache b_cache;
 
   mlk_unpack_ciphertext(b, &v, c);
-  mlk_unpack_sk(skpv, sk);
 
   mlk_polyvec_ntt(b);
   mlk_polyvec_mulcache_compute(b_cache, b);
@@ -513,13 +584,44 @@ void mlk_indcpa_dec(uint8_t m[MLKEM_INDCPA_MSGBYTES],
 
   /* Specification: Partially implements
    * @[FIPS203, Section 3.3, Destruction of intermediate values] */
-  mlk_zeroize(&skpv, sizeof(skpv));
   mlk_zeroize(&b, sizeof(b));
   mlk_zeroize(&b_cache, sizeof(b_cache));
   mlk_zeroize(&v, sizeof(v));
   mlk_zeroize(&sb, sizeof(sb));
 }
 
+/* Reference: `indcpa_dec()` in the reference implementation @[REF].
+ *            - We include buffer zeroization. */
+MLK_INTERNAL_API
+void mlk_indcpa_dec(uint8_t m[MLKEM_INDCPA_MSGBYTES],
+                    const uint8_t c[MLKEM_INDCPA_BYTES],
+                    const uint8_t sk[MLKEM_INDCPA_SECRETKEYBYTES])
+{
+  mlk_polyvec skpv;
+
+  mlk_unpack_sk(skpv, sk);
+  mlk_indcpa_dec_unpacked(m, c, skpv);
+
+  /* Specification: Partially implements
+   * @[FIPS203, Section 3.3, Destruction of intermediate values] */
+  mlk_zeroize(&skpv, sizeof(skpv));
+}
+
+MLK_INTERNAL_API
+void mlk_indcpa_expand_sk(mlk_indcpa_secret_key *sk,
+                          const uint8_t packedsk[MLKEM_INDCPA_SECRETKEYBYTES])
+{
+  mlk_unpack_sk(sk->skpv, packedsk);
+}
+
+MLK_INTERNAL_API
+void mlk_indcpa_dec_expanded(uint8_t m[MLKEM_INDCPA_MSGBYTES],
+                             const uint8_t c[MLKEM_INDCPA_BYTES],
+                             const mlk_indcpa_secret_key *sk)
+{
+  mlk_indcpa_dec_unpacked(m, c, sk->skpv);
+}
+
 /* To facilitate single-compilation-unit (SCU) builds, undefine all macros.
  * Don't modify by hand -- this is auto-generated by scripts/autogen. */
 #undef mlk_pack_pk
@@ -529,4 +631,6 @@ void mlk_indcpa_dec(uint8_t m[MLKEM_INDCPA_MSGBYTES],
 #undef mlk_pack_ciphertext
 #undef mlk_unpack_ciphertext
 #undef mlk_matvec_mul
+#undef mlk_indcpa_enc_unpacked
+#undef mlk_indcpa_dec_unpacked
 #undef mlk_poly_permute_bitrev_to_custom
@@ -0,0 +1,27 @@
+/*
+ * Copyright (c) The mlkem-native project authors
+ * SPDX-License-Identifier: Apache-2.0 OR ISC OR MIT
+ */
+#ifndef MLK_NATIVE_VECEXT_SRC_ARITH_NATIVE_VECEXT_H
+#define MLK_NATIVE_VECEXT_SRC_ARITH_NATIVE_VECEXT_H
+
+#include <stdint.h>
+#include "../../../common.h"
+
+#define mlk_ntt_vecext MLK_NAMESPACE(ntt_vecext)
+void mlk_ntt_vecext(int16_t r[MLKEM_N]);
+
+#define mlk_invntt_vecext MLK_NAMESPACE(invntt_vecext)
+void mlk_invntt_vecext(int16_t r[MLKEM_N]);
+
+#define mlk_poly_mulcache_compute_vecext MLK_NAMESPACE(poly_mulcache_compute_vecext)
+void mlk_poly_mulcache_compute_vecext(int16_t x[MLKEM_N / 2],
+                                      const int16_t a[MLKEM_N]);
+
+#define mlk_polyvec_basemul_acc_montgomery_cached_vecext \
+  MLK_NAMESPACE(polyvec_basemul_acc_montgomery_cached_vecext)
+void mlk_polyvec_basemul_acc_montgomery_cached_vecext(
+    unsigned k, int16_t r[MLKEM_N], const int16_t *a, const int16_t *b,
+    const int16_t *b_cache);
+
+#endif /* !MLK_NATIVE_VECEXT_SRC_ARITH_NATIVE_VECEXT_H */
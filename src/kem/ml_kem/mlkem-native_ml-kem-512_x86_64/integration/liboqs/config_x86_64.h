@@ -45,13 +45,12 @@
  *              This can also be set using CFLAGS.
  *
  *****************************************************************************/
-#if MLK_CONFIG_PARAMETER_SET == 512
-#define MLK_CONFIG_NAMESPACE_PREFIX PQCP_MLKEM_NATIVE_MLKEM512_X86_64
-#elif MLK_CONFIG_PARAMETER_SET == 768
-#define MLK_CONFIG_NAMESPACE_PREFIX PQCP_MLKEM_NATIVE_MLKEM768_X86_64
-#elif MLK_CONFIG_PARAMETER_SET == 1024
-#define MLK_CONFIG_NAMESPACE_PREFIX PQCP_MLKEM_NATIVE_MLKEM1024_X86_64
-#endif
+/* liboqs compiles ML-KEM-512/768/1024 as one multi-level build (see
+ * src/kem/ml_kem/CMakeLists.txt): level-dependent symbols get the
+ * parameter set appended to this prefix, e.g.
+ * PQCP_MLKEM_NATIVE_X86_64_MLKEM768_keypair, while the level-independent
+ * code is compiled once and shared by all parameter sets. */
+#define MLK_CONFIG_NAMESPACE_PREFIX PQCP_MLKEM_NATIVE_X86_64_MLKEM
 
 /******************************************************************************
  * Name:        MLK_CONFIG_USE_NATIVE_BACKEND_ARITH
@@ -260,4 +259,22 @@ static MLK_INLINE void mlk_randombytes(uint8_t *ptr, size_t len)
 #endif
 #endif /* !__ASSEMBLER__ */
 
+/* Use the AVX-512 NTT, inverse NTT and rejection sampling when liboqs is
+ * built with OQS_USE_ML_KEM_AVX512 and the CPU supports them. */
+#if !defined(__ASSEMBLER__)
+#if defined(OQS_USE_ML_KEM_AVX512)
+#define MLK_CONFIG_X86_64_AVX512
+static MLK_INLINE int mlk_sys_check_capability_avx512(void)
+{
+#if defined(OQS_DIST_X86_64_BUILD)
+  return OQS_CPU_has_extension(OQS_CPU_EXT_AVX512) &&
+         OQS_CPU_has_extension(OQS_CPU_EXT_AVX512VBMI2);
+#else
+  /* Only available when built for a CPU with AVX512 and AVX512VBMI2 */
+  return 1;
+#endif
+}
+#endif /* OQS_USE_ML_KEM_AVX512 */
+#endif /* !__ASSEMBLER__ */
+
 #endif /* !MLK_INTEGRATION_LIBOQS_CONFIG_X86_64_H */
@@ -26,6 +26,17 @@ void mlk_ntt_avx2(__m256i *r, const __m256i *mlk_qdata);
 #define mlk_invntt_avx2 MLK_NAMESPACE(invntt_avx2)
 void mlk_invntt_avx2(__m256i *r, const __m256i *mlk_qdata);
 
+#if defined(MLK_CONFIG_X86_64_AVX512)
+#define mlk_rej_uniform_avx512 MLK_NAMESPACE(rej_uniform_avx512)
+unsigned mlk_rej_uniform_avx512(int16_t *r, const uint8_t *buf);
+
+#define mlk_ntt_avx512 MLK_NAMESPACE(ntt_avx512)
+void mlk_ntt_avx512(__m256i *r, const __m256i *mlk_qdata);
+
+#define mlk_invntt_avx512 MLK_NAMESPACE(invntt_avx512)
+void mlk_invntt_avx512(__m256i *r, const __m256i *mlk_qdata);
+#endif /* MLK_CONFIG_X86_64_AVX512 */
+
 #define mlk_nttunpack_avx2 MLK_NAMESPACE(nttunpack_avx2)
 void mlk_nttunpack_avx2(__m256i *r);
 
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) The mlkem-native project authors
+ * SPDX-License-Identifier: Apache-2.0 OR ISC OR MIT
+ */
+
+/*
+ * Twiddle factors of zetas.inc rearranged for the last two layers of the
+ * forward NTT, the first two layers of the inverse NTT and the
+ * multiplication cache of the vector-extension backend. Entry i holds the
+ * twiddles for coefficients 16*i .. 16*i+15, in the lane order used by
+ * arith_vecext.c.
+ */
+
+/* Forward NTT, layer 6 (len 4) */
+static MLK_ALIGN const int16_t mlk_vecext_ntt_l6_zetas[128] = {
+    1223, 1223, 1223, 1223, 652, 652, 652, 652,
+    -552, -552, -552, -552, 1015, 1015, 1015, 1015,
+    -1293, -1293, -1293, -1293, 1491, 1491, 1491, 1491,
+    -282, -282, -282, -282, -1544, -1544, -1544, -1544,
+    516, 516, 516, 516, -8, -8, -8, -8,
+    -320, -320, -320, -320, -666, -666, -666, -666,
+    -1618, -1618, -1618, -1618, -1162, -1162, -1162, -1162,
+    126, 126, 126, 126, 1469, 1469, 1469, 1469,
+    -853, -853, -853, -853, -90, -90, -90, -90,
+    -271, -271, -271, -271, 830, 830, 830, 830,
+    107, 107, 107, 107, -1421, -1421, -1421, -1421,
+    -247, -247, -247, -247, -951, -951, -951, -951,
+    -398, -398, -398, -398, 961, 961, 961, 961,
+    -1508, -1508, -1508, -1508, -725, -725, -725, -725,
+    448, 448, 448, 448, -1065, -1065, -1065, -1065,
+    677, 677, 677, 677, -1275, -1275, -1275, -1275,
+};
+
+/* Forward NTT, layer 7 (len 2) */
+static MLK_ALIGN const int16_t mlk_vecext_ntt_l7_zetas[128] = {
+    -1103, -1103, 430, 430, 555, 555, 843, 843,
+    -1251, -1251, 871, 871, 1550, 1550, 105, 105,
+    422, 422, 587, 587, 177, 177, -235, -235,
+    -291, -291, -460, -460, 1574, 1574, 1653, 1653,
+    -246, -246, 778, 778, 1159, 1159, -147, -147,
+    -777, -777, 1483, 1483, -602, -602, 1119, 1119,
+    -1590, -1590, 644, 644, -872, -872, 349, 349,
+    418, 418, 329, 329, -156, -156, -75, -75,
+    817, 817, 1097, 1097, 603, 603, 610, 610,
+    1322, 1322, -1285, -1285, -1465, -1465, 384, 384,
+    -1215, -1215, -136, -136, 1218, 1218, -1335, -1335,
+    -874, -874, 220, 220, -1187, -1187, -1659, -1659,
+    -1185, -1185, -1530, -1530, -1278, -1278, 794, 794,
+    -1510, -1510, -854, -854, -870, -870, 478, 478,
+    -108, -108, -308, -308, 996, 996, 991, 991,
+    958, 958, -1460, -1460, 1522, 1522, 1628, 1628,
+};
+
+/* Inverse NTT, layer 7 (len 2) */
+static MLK_ALIGN const int16_t mlk_vecext_invntt_l7_zetas[128] = {
+    1628, 1628, 1522, 1522, -1460, -1460, 958, 958,
+    991, 991, 996, 996, -308, -308, -108, -108,
+    478, 478, -870, -870, -854, -854, -1510, -1510,
+    794, 794, -1278, -1278, -1530, -1530, -1185, -1185,
+    -1659, -1659, -1187, -1187, 220, 220, -874, -874,
+    -1335, -1335, 1218, 1218, -136, -136, -1215, -1215,
+    384, 384, -1465, -1465, -1285, -1285, 1322, 1322,
+    610, 610, 603, 603, 1097, 1097, 817, 817,
+    -75, -75, -156, -156, 329, 329, 418, 418,
+    349, 349, -872, -872, 644, 644, -1590, -1590,
+    1119, 1119, -602, -602, 1483, 1483, -777, -777,
+    -147, -147, 1159, 1159, 778, 778, -246, -246,
+    1653, 1653, 1574, 1574, -460, -460, -291, -291,
+    -235, -235, 177, 177, 587, 587, 422, 422,
+    105, 105, 1550, 1550, 871, 871, -1251, -1251,
+    843, 843, 555, 555, 430, 430, -1103, -1103,
+};
+
+/* Inverse NTT, layer 6 (len 4) */
+static MLK_ALIGN const int16_t mlk_vecext_invntt_l6_zetas[128] = {
+    -1275, -1275, -1275, -1275, 677, 677, 677, 677,
+    -1065, -1065, -1065, -1065, 448, 448, 448, 448,
+    -725, -725, -725, -725, -1508, -1508, -1508, -1508,
+    961, 961, 961, 961, -398, -398, -398, -398,
+    -951, -951, -951, -951, -247, -247, -247, -247,
+    -1421, -1421, -1421, -1421, 107, 107, 107, 107,
+    830, 830, 830, 830, -271, -271, -271, -271,
+    -90, -90, -90, -90, -853, -853, -853, -853,
+    1469, 1469, 1469, 1469, 126, 126, 126, 126,
+    -1162, -1162, -1162, -1162, -1618, -1618, -1618, -1618,
+    -666, -666, -666, -666, -320, -320, -320, -320,
+    -8, -8, -8, -8, 516, 516, 516, 516,
+    -1544, -1544, -1544, -1544, -282, -282, -282, -282,
+    1491, 1491, 1491, 1491, -1293, -1293, -1293, -1293,
+    1015, 1015, 1015, 1015, -552, -552, -552, -552,
+    652, 652, 652, 652, 1223, 1223, 1223, 1223,
+};
+
+/* Multiplication cache: +zeta and -zeta for each pair of coefficients */
+static MLK_ALIGN const int16_t mlk_vecext_mulcache_zetas[128] = {
+    -1103, 1103, 430, -430, 555, -555, 843, -843,
+    -1251, 1251, 871, -871, 1550, -1550, 105, -105,
+    422, -422, 587, -587, 177, -177, -235, 235,
+    -291, 291, -460, 460, 1574, -1574, 1653, -1653,
+    -246, 246, 778, -778, 1159, -1159, -147, 147,
+    -777, 777, 1483, -1483, -602, 602, 1119, -1119,
+    -1590, 1590, 644, -644, -872, 872, 349, -349,
+    418, -418, 329, -329, -156, 156, -75, 75,
+    817, -817, 1097, -1097, 603, -603, 610, -610,
+    1322, -1322, -1285, 1285, -1465, 1465, 384, -384,
+    -1215, 1215, -136, 136, 1218, -1218, -1335, 1335,
+    -874, 874, 220, -220, -1187, 1187, -1659, 1659,
+    -1185, 1185, -1530, 1530, -1278, 1278, 794, -794,
+    -1510, 1510, -854, 854, -870, 870, 478, -478,
+    -108, 108, -308, 308, 996, -996, 991, -991,
+    958, -958, -1460, 1460, 1522, -1522, 1628, -1628,
+};
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) The mlkem-native project authors
+ * SPDX-License-Identifier: Apache-2.0 OR ISC OR MIT
+ */
+
+/*
+ * AVX-512 rejection sampling. Each iteration expands 48 bytes into 32
+ * candidate coefficients, compares them against MLKEM_Q and packs the
+ * accepted ones with vpcompressw. Accepted coefficients are written in the
+ * same order as in the AVX2 and C implementations.
+ */
+
+#include "../../../common.h"
+
+#if defined(MLK_ARITH_BACKEND_X86_64_DEFAULT) && \
+    !defined(MLK_CONFIG_MULTILEVEL_NO_SHARED) && \
+    defined(MLK_CONFIG_X86_64_AVX512)
+
+#include <immintrin.h>
+#include <stdint.h>
+#include "arith_native_x86_64.h"
+
+unsigned mlk_rej_uniform_avx512(int16_t *MLK_RESTRICT r, const uint8_t *buf)
+{
+  unsigned ctr, pos, bytes, cnt;
+  __mmask32 good;
+  __m512i f;
+  const __m512i bound = _mm512_set1_epi16(MLKEM_Q);
+  const __m512i mask = _mm512_set1_epi16(0xFFF);
+  /* 128-bit lane k receives bytes 12k, ..., 12k+15 */
+  const __m512i idx32 =
+      _mm512_setr_epi32(0, 1, 2, 3, 3, 4, 5, 6, 6, 7, 8, 9, 9, 10, 11, 12);
+  /* Spread 12 bytes of a lane into 8 overlapping 16-bit words */
+  const __m512i idx8 = _mm512_broadcast_i32x4(
+      _mm_setr_epi8(0, 1, 1, 2, 3, 4, 4, 5, 6, 7, 7, 8, 9, 10, 10, 11));
+
+  ctr = pos = 0;
+  while (ctr < MLKEM_N && pos < MLK_AVX2_REJ_UNIFORM_BUFLEN)
+  {
+    bytes = MLK_AVX2_REJ_UNIFORM_BUFLEN - pos;
+    if (bytes > 48)
+    {
+      bytes = 48;
+    }
+
+    /* The masked load does not read past the end of buf */
+    f = _mm512_maskz_loadu_epi8(((uint64_t)1 << bytes) - 1, buf + pos);
+    f = _mm512_permutexvar_epi32(idx32, f);
+    f = _mm512_shuffle_epi8(f, idx8);
+    f = _mm512_mask_srli_epi16(f, 0xAAAAAAAA, f, 4);
+    f = _mm512_and_si512(f, mask);
+    pos += bytes;
+
+    /* Ignore the candidates beyond the end of buf */
+    good = _mm512_mask_cmplt_epu16_mask(_bzhi_u32(0xFFFFFFFF, bytes / 3 * 2),
+                                        f, bound);
+    cnt = (unsigned)_mm_popcnt_u32(good);
+    if (cnt > MLKEM_N - ctr)
+    {
+      /* Keep only the first MLKEM_N - ctr accepted coefficients */
+      cnt = MLKEM_N - ctr;
+      good = _pdep_u32(_bzhi_u32(0xFFFFFFFF, cnt), good);
+    }
+
+    /* Compress in a register and use a masked store, since vpcompressw
+     * with a memory operand is slow on some microarchitectures */
+    f = _mm512_maskz_compress_epi16(good, f);
+    _mm512_mask_storeu_epi16(r + ctr, _bzhi_u32(0xFFFFFFFF, cnt), f);
+    ctr += cnt;
+  }
+
+  return ctr;
+}
+
+#else /* MLK_ARITH_BACKEND_X86_64_DEFAULT && !MLK_CONFIG_MULTILEVEL_NO_SHARED \
+         && MLK_CONFIG_X86_64_AVX512 */
+
+MLK_EMPTY_CU(avx512_rej_uniform)
+
+#endif /* !(MLK_ARITH_BACKEND_X86_64_DEFAULT &&     \
+          !MLK_CONFIG_MULTILEVEL_NO_SHARED &&      \
+          MLK_CONFIG_X86_64_AVX512) */
@@ -0,0 +1,229 @@
+/**
+ * @file oqs_ring_mul_api.c
+ * @brief Implementation of the ring multiplication API for NTRU and sntrup761
+ *
+ * The wrappers copy the caller's coefficients into padded, 32-byte aligned
+ * scratch polynomials, so that the AVX2 kernels can use aligned loads and
+ * read up to the padded length, and dispatch to the kernel the corresponding
+ * KEM would use.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <string.h>
+
+#include <oqs/oqs_ring_mul_api.h>
+
+/* ============================================================================
+ * Forward Declarations for NTRU Multipliers
+ * ============================================================================
+ * As in oqs_ntt_api.c, the kernels are declared directly instead of through
+ * the scheme headers, whose parameter macros clash with each other. The
+ * PQClean poly type is a struct (clean) or union (AVX2) whose first member is
+ * the uint16_t coefficient array, padded to a multiple of 32 coefficients in
+ * the AVX2 implementations.
+ */
+
+typedef void (*ntru_poly_Rq_mul_fn)(uint16_t *r, const uint16_t *a, const uint16_t *b);
+
+#if defined(OQS_ENABLE_KEM_ntru_hps2048509)
+extern void PQCLEAN_NTRUHPS2048509_CLEAN_poly_Rq_mul(uint16_t *r, const uint16_t *a, const uint16_t *b);
+#endif
+#if defined(OQS_ENABLE_KEM_ntru_hps2048509_avx2)
+extern void PQCLEAN_NTRUHPS2048509_AVX2_poly_Rq_mul(uint16_t *r, const uint16_t *a, const uint16_t *b);
+#endif
+#if defined(OQS_ENABLE_KEM_ntru_hps2048677)
+extern void PQCLEAN_NTRUHPS2048677_CLEAN_poly_Rq_mul(uint16_t *r, const uint16_t *a, const uint16_t *b);
+#endif
+#if defined(OQS_ENABLE_KEM_ntru_hps2048677_avx2)
+extern void PQCLEAN_NTRUHPS2048677_AVX2_poly_Rq_mul(uint16_t *r, const uint16_t *a, const uint16_t *b);
+#endif
+#if defined(OQS_ENABLE_KEM_ntru_hps4096821)
+extern void PQCLEAN_NTRUHPS4096821_CLEAN_poly_Rq_mul(uint16_t *r, const uint16_t *a, const uint16_t *b);
+#endif
+#if defined(OQS_ENABLE_KEM_ntru_hps4096821_avx2)
+extern void PQCLEAN_NTRUHPS4096821_AVX2_poly_Rq_mul(uint16_t *r, const uint16_t *a, const uint16_t *b);
+#endif
+#if defined(OQS_ENABLE_KEM_ntru_hps40961229)
+extern void PQCLEAN_NTRUHPS40961229_CLEAN_poly_Rq_mul(uint16_t *r, const uint16_t *a, const uint16_t *b);
+#endif
+#if defined(OQS_ENABLE_KEM_ntru_hrss701)
+extern void PQCLEAN_NTRUHRSS701_CLEAN_poly_Rq_mul(uint16_t *r, const uint16_t *a, const uint16_t *b);
+#endif
+#if defined(OQS_ENABLE_KEM_ntru_hrss701_avx2)
+extern void PQCLEAN_NTRUHRSS701_AVX2_poly_Rq_mul(uint16_t *r, const uint16_t *a, const uint16_t *b);
+#endif
+#if defined(OQS_ENABLE_KEM_ntru_hrss1373)
+extern void PQCLEAN_NTRUHRSS1373_CLEAN_poly_Rq_mul(uint16_t *r, const uint16_t *a, const uint16_t *b);
+#endif
+
+/* Same CPU requirements as the NTRU KEM wrappers */
+#if defined(OQS_DIST_BUILD)
+#define NTRU_AVX2_AVAILABLE() (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2) && OQS_CPU_has_extension(OQS_CPU_EXT_BMI2))
+#else
+#define NTRU_AVX2_AVAILABLE() 1
+#endif
+
+#define NTRU_PAD32(X) ((((X) + 31) / 32) * 32)
+
+/* Returns the multiplier for degree n and sets *q, or NULL if there is none. */
+static ntru_poly_Rq_mul_fn ntru_poly_Rq_mul_select(size_t n, uint16_t *q) {
+	switch (n) {
+#if defined(OQS_ENABLE_KEM_ntru_hps2048509)
+	case 509:
+		*q = 2048;
+#if defined(OQS_ENABLE_KEM_ntru_hps2048509_avx2)
+		if (NTRU_AVX2_AVAILABLE()) {
+			return PQCLEAN_NTRUHPS2048509_AVX2_poly_Rq_mul;
+		}
+#endif
+		return PQCLEAN_NTRUHPS2048509_CLEAN_poly_Rq_mul;
+#endif
+#if defined(OQS_ENABLE_KEM_ntru_hps2048677)
+	case 677:
+		*q = 2048;
+#if defined(OQS_ENABLE_KEM_ntru_hps2048677_avx2)
+		if (NTRU_AVX2_AVAILABLE()) {
+			return PQCLEAN_NTRUHPS2048677_AVX2_poly_Rq_mul;
+		}
+#endif
+		return PQCLEAN_NTRUHPS2048677_CLEAN_poly_Rq_mul;
+#endif
+#if defined(OQS_ENABLE_KEM_ntru_hps4096821)
+	case 821:
+		*q = 4096;
+#if defined(OQS_ENABLE_KEM_ntru_hps4096821_avx2)
+		if (NTRU_AVX2_AVAILABLE()) {
+			return PQCLEAN_NTRUHPS4096821_AVX2_poly_Rq_mul;
+		}
+#endif
+		return PQCLEAN_NTRUHPS4096821_CLEAN_poly_Rq_mul;
+#endif
+#if defined(OQS_ENABLE_KEM_ntru_hps40961229)
+	case 1229:
+		*q = 4096;
+		return PQCLEAN_NTRUHPS40961229_CLEAN_poly_Rq_mul;
+#endif
+#if defined(OQS_ENABLE_KEM_ntru_hrss701)
+	case 701:
+		*q = 8192;
+#if defined(OQS_ENABLE_KEM_ntru_hrss701_avx2)
+		if (NTRU_AVX2_AVAILABLE()) {
+			return PQCLEAN_NTRUHRSS701_AVX2_poly_Rq_mul;
+		}
+#endif
+		return PQCLEAN_NTRUHRSS701_CLEAN_poly_Rq_mul;
+#endif
+#if defined(OQS_ENABLE_KEM_ntru_hrss1373)
+	case 1373:
+		*q = 16384;
+		return PQCLEAN_NTRUHRSS1373_CLEAN_poly_Rq_mul;
+#endif
+	default:
+		(void) q;
+		return NULL;
+	}
+}
+
+/* ============================================================================
+ * NTRU Wrappers
+ * ============================================================================ */
+
+OQS_API OQS_STATUS OQS_KEM_ntru_poly_Rq_mul_batch(uint16_t *r, const uint16_t *a, const uint16_t *b, size_t n, size_t count) {
+	uint16_t q = 0;
+	ntru_poly_Rq_mul_fn mul = ntru_poly_Rq_mul_select(n, &q);
+	if (mul == NULL) {
+		return OQS_ERROR;
+	}
+	if (count == 0) {
+		return OQS_SUCCESS;
+	}
+
+	/* The kernels leave the products unreduced, correct modulo q only. */
+	const size_t padded = NTRU_PAD32(n);
+	uint16_t *scratch = OQS_MEM_aligned_alloc(32, 3 * padded * sizeof(uint16_t));
+	if (scratch == NULL) {
+		return OQS_ERROR;
+	}
+	uint16_t *ta = scratch;
+	uint16_t *tb = scratch + padded;
+	uint16_t *tr = scratch + 2 * padded;
+	memset(scratch, 0, 3 * padded * sizeof(uint16_t));
+
+	for (size_t j = 0; j < count; j++) {
+		for (size_t i = 0; i < n; i++) {
+			ta[i] = a[j * n + i] & (q - 1);
+			tb[i] = b[j * n + i] & (q - 1);
+		}
+		mul(tr, ta, tb);
+		for (size_t i = 0; i < n; i++) {
+			r[j * n + i] = tr[i] & (q - 1);
+		}
+	}
+
+	OQS_MEM_aligned_free(scratch);
+	return OQS_SUCCESS;
+}
+
+OQS_API OQS_STATUS OQS_KEM_ntru_poly_Rq_mul(uint16_t *r, const uint16_t *a, const uint16_t *b, size_t n) {
+	return OQS_KEM_ntru_poly_Rq_mul_batch(r, a, b, n, 1);
+}
+
+/* ============================================================================
+ * sntrup761 Wrappers
+ * ============================================================================
+ * crypto_core_multsntrup761 takes f as 761 little-endian int16 values and g
+ * as 761 bytes holding -1, 0 or 1, and returns h in the same encoding as f.
+ */
+
+#define SNTRUP761_P OQS_KEM_ntruprime_sntrup761_p
+
+#if defined(OQS_ENABLE_KEM_ntruprime_sntrup761)
+extern int PQCLEAN_SNTRUP761_CLEAN_crypto_core_multsntrup761(unsigned char *outbytes, const unsigned char *inbytes, const unsigned char *kbytes);
+#endif
+#if defined(OQS_ENABLE_KEM_ntruprime_sntrup761_avx2)
+extern int PQCLEAN_SNTRUP761_AVX2_crypto_core_multsntrup761(unsigned char *outbytes, const unsigned char *inbytes, const unsigned char *kbytes);
+#endif
+
+OQS_API OQS_STATUS OQS_KEM_ntruprime_sntrup761_poly_Rq_mul_small_batch(int16_t *h, const int16_t *f, const int8_t *g, size_t count) {
+#if defined(OQS_ENABLE_KEM_ntruprime_sntrup761)
+	int (*mul)(unsigned char *, const unsigned char *, const unsigned char *) = PQCLEAN_SNTRUP761_CLEAN_crypto_core_multsntrup761;
+	unsigned char in[2 * SNTRUP761_P];
+	unsigned char out[2 * SNTRUP761_P];
+	unsigned char k[SNTRUP761_P];
+
+#if defined(OQS_ENABLE_KEM_ntruprime_sntrup761_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2)) {
+#endif /* OQS_DIST_BUILD */
+		mul = PQCLEAN_SNTRUP761_AVX2_crypto_core_multsntrup761;
+#if defined(OQS_DIST_BUILD)
+	}
+#endif /* OQS_DIST_BUILD */
+#endif
+
+	for (size_t j = 0; j < count; j++) {
+		for (size_t i = 0; i < SNTRUP761_P; i++) {
+			uint16_t x = (uint16_t) f[j * SNTRUP761_P + i];
+			in[2 * i] = (unsigned char) x;
+			in[2 * i + 1] = (unsigned char) (x >> 8);
+			k[i] = (unsigned char) g[j * SNTRUP761_P + i];
+		}
+		mul(out, in, k);
+		for (size_t i = 0; i < SNTRUP761_P; i++) {
+			h[j * SNTRUP761_P + i] = (int16_t) (uint16_t) (out[2 * i] | (out[2 * i + 1] << 8));
+		}
+	}
+	return OQS_SUCCESS;
+#else
+	(void) h;
+	(void) f;
+	(void) g;
+	(void) count;
+	return OQS_ERROR;
+#endif
+}
+
+OQS_API OQS_STATUS OQS_KEM_ntruprime_sntrup761_poly_Rq_mul_small(int16_t *h, const int16_t *f, const int8_t *g) {
+	return OQS_KEM_ntruprime_sntrup761_poly_Rq_mul_small_batch(h, f, g, 1);
+}
@@ -16,6 +16,7 @@
 #include <oqs/common.h>
 #include <oqs/rand.h>
 #include <oqs/kem.h>
+#include <oqs/kem_hybrid.h>
 #include <oqs/sig.h>
 #include <oqs/sig_stfl.h>
 #include <oqs/aes_ops.h>
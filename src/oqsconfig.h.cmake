@@ -28,6 +28,10 @@
 #cmakedefine ARCH_ARM64v8 1
 #cmakedefine ARCH_ARM32v7 1
 #cmakedefine BUILD_SHARED_LIBS 1
+#cmakedefine OQS_DIRECT_DISPATCH 1
+#cmakedefine OQS_ML_DSA_LOW_STACK 1
+#cmakedefine OQS_ML_DSA_SPECULATIVE_SIGN 1
+#cmakedefine OQS_CLASSIC_MCELIECE_PARALLEL_SYNDROME 1
 #cmakedefine OQS_BUILD_ONLY_LIB 1
 #cmakedefine OQS_OPT_TARGET "@OQS_OPT_TARGET@"
 #cmakedefine USE_COVERAGE 1
@@ -38,6 +42,8 @@
 #cmakedefine OQS_USE_AES_OPENSSL 1
 #cmakedefine OQS_USE_SHA2_OPENSSL 1
 #cmakedefine OQS_USE_SHA3_OPENSSL 1
+#cmakedefine OQS_USE_SHA3_ROUTING 1
+#cmakedefine OQS_SHA3_OPENSSL_ROUTE_MASK @OQS_SHA3_OPENSSL_ROUTE_MASK@
 #cmakedefine OQS_DLOPEN_OPENSSL 1
 #cmakedefine OQS_OPENSSL_CRYPTO_SONAME "@OQS_OPENSSL_CRYPTO_SONAME@"
 
@@ -50,6 +56,7 @@
 #cmakedefine OQS_USE_AVX_INSTRUCTIONS 1
 #cmakedefine OQS_USE_AVX2_INSTRUCTIONS 1
 #cmakedefine OQS_USE_AVX512_INSTRUCTIONS 1
+#cmakedefine OQS_USE_AVX512VBMI2_INSTRUCTIONS 1
 #cmakedefine OQS_USE_BMI1_INSTRUCTIONS 1
 #cmakedefine OQS_USE_BMI2_INSTRUCTIONS 1
 #cmakedefine OQS_USE_PCLMULQDQ_INSTRUCTIONS 1
@@ -69,7 +76,11 @@
 #cmakedefine OQS_ENABLE_TEST_CONSTANT_TIME 1
 
 #cmakedefine OQS_ENABLE_SHA3_xkcp_low_avx2 1
+#cmakedefine OQS_ENABLE_SHA3_xkcp_low_armv8a_sha3 1
 #cmakedefine OQS_USE_SHA3_AVX512VL 1
+#cmakedefine OQS_USE_ML_KEM_AVX512 1
+#cmakedefine OQS_USE_CLASSIC_MCELIECE_AVX512 1
+#cmakedefine OQS_USE_VECTOR_EXTENSIONS 1
 
 #cmakedefine01 OQS_USE_CUPQC
 #cmakedefine01 OQS_USE_ICICLE
@@ -163,10 +174,13 @@
 #cmakedefine OQS_ENABLE_SIG_ML_DSA 1
 #cmakedefine OQS_ENABLE_SIG_ml_dsa_44 1
 #cmakedefine OQS_ENABLE_SIG_ml_dsa_44_avx2 1
+#cmakedefine OQS_ENABLE_SIG_ml_dsa_44_aarch64 1
 #cmakedefine OQS_ENABLE_SIG_ml_dsa_65 1
 #cmakedefine OQS_ENABLE_SIG_ml_dsa_65_avx2 1
+#cmakedefine OQS_ENABLE_SIG_ml_dsa_65_aarch64 1
 #cmakedefine OQS_ENABLE_SIG_ml_dsa_87 1
 #cmakedefine OQS_ENABLE_SIG_ml_dsa_87_avx2 1
+#cmakedefine OQS_ENABLE_SIG_ml_dsa_87_aarch64 1
 
 #cmakedefine OQS_ENABLE_SIG_FALCON 1
 #cmakedefine OQS_ENABLE_SIG_falcon_512 1
@@ -3,6 +3,9 @@
 #include <stdlib.h>
 
 #include <oqs/sig_cross.h>
+#include <oqs/sha3.h>
+
+#include "../sig_verify.h"
 
 #if defined(OQS_ENABLE_SIG_cross_rsdp_192_fast)
 OQS_SIG *OQS_SIG_cross_rsdp_192_fast_new(void) {
@@ -35,11 +38,17 @@ OQS_SIG *OQS_SIG_cross_rsdp_192_fast_new(void) {
 extern int PQCLEAN_CROSSRSDP192FAST_CLEAN_crypto_sign_keypair(uint8_t *pk, uint8_t *sk);
 extern int PQCLEAN_CROSSRSDP192FAST_CLEAN_crypto_sign_signature(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const uint8_t *sk);
 extern int PQCLEAN_CROSSRSDP192FAST_CLEAN_crypto_sign_verify(const uint8_t *sig, size_t siglen, const uint8_t *m, size_t mlen, const uint8_t *pk);
+extern int PQCLEAN_CROSSRSDP192FAST_CLEAN_crypto_sign_verify_init(OQS_SHA3_shake256_inc_ctx *state, const uint8_t *sig, size_t siglen);
+extern void PQCLEAN_CROSSRSDP192FAST_CLEAN_crypto_sign_verify_update(OQS_SHA3_shake256_inc_ctx *state, const uint8_t *m, size_t mlen);
+extern int PQCLEAN_CROSSRSDP192FAST_CLEAN_crypto_sign_verify_final(OQS_SHA3_shake256_inc_ctx *state, const uint8_t *sig, size_t siglen, const uint8_t *pk);
 
 #if defined(OQS_ENABLE_SIG_cross_rsdp_192_fast_avx2)
 extern int PQCLEAN_CROSSRSDP192FAST_AVX2_crypto_sign_keypair(uint8_t *pk, uint8_t *sk);
 extern int PQCLEAN_CROSSRSDP192FAST_AVX2_crypto_sign_signature(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const uint8_t *sk);
 extern int PQCLEAN_CROSSRSDP192FAST_AVX2_crypto_sign_verify(const uint8_t *sig, size_t siglen, const uint8_t *m, size_t mlen, const uint8_t *pk);
+extern int PQCLEAN_CROSSRSDP192FAST_AVX2_crypto_sign_verify_init(OQS_SHA3_shake256_inc_ctx *state, const uint8_t *sig, size_t siglen);
+extern void PQCLEAN_CROSSRSDP192FAST_AVX2_crypto_sign_verify_update(OQS_SHA3_shake256_inc_ctx *state, const uint8_t *m, size_t mlen);
+extern int PQCLEAN_CROSSRSDP192FAST_AVX2_crypto_sign_verify_final(OQS_SHA3_shake256_inc_ctx *state, const uint8_t *sig, size_t siglen, const uint8_t *pk);
 #endif
 
 OQS_API OQS_STATUS OQS_SIG_cross_rsdp_192_fast_keypair(uint8_t *public_key, uint8_t *secret_key) {
@@ -105,4 +114,72 @@ OQS_API OQS_STATUS OQS_SIG_cross_rsdp_192_fast_verify_with_ctx_str(const uint8_t
 		return OQS_ERROR;
 	}
 }
+
+static OQS_STATUS cross_rsdp_192_fast_verify_init(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key) {
+	(void) public_key;
+	if (ctx_str != NULL || ctx_str_len != 0) {
+		return OQS_ERROR;
+	}
+#if defined(OQS_ENABLE_SIG_cross_rsdp_192_fast_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) PQCLEAN_CROSSRSDP192FAST_AVX2_crypto_sign_verify_init(state, signature, signature_len);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) PQCLEAN_CROSSRSDP192FAST_CLEAN_crypto_sign_verify_init(state, signature, signature_len);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return (OQS_STATUS) PQCLEAN_CROSSRSDP192FAST_CLEAN_crypto_sign_verify_init(state, signature, signature_len);
+#endif
+}
+
+static void cross_rsdp_192_fast_verify_update(void *state, const uint8_t *message, size_t message_len) {
+#if defined(OQS_ENABLE_SIG_cross_rsdp_192_fast_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2)) {
+#endif /* OQS_DIST_BUILD */
+		PQCLEAN_CROSSRSDP192FAST_AVX2_crypto_sign_verify_update(state, message, message_len);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		PQCLEAN_CROSSRSDP192FAST_CLEAN_crypto_sign_verify_update(state, message, message_len);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	PQCLEAN_CROSSRSDP192FAST_CLEAN_crypto_sign_verify_update(state, message, message_len);
+#endif
+}
+
+static OQS_STATUS cross_rsdp_192_fast_verify_final(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key) {
+#if defined(OQS_ENABLE_SIG_cross_rsdp_192_fast_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) PQCLEAN_CROSSRSDP192FAST_AVX2_crypto_sign_verify_final(state, signature, signature_len, public_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) PQCLEAN_CROSSRSDP192FAST_CLEAN_crypto_sign_verify_final(state, signature, signature_len, public_key);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return (OQS_STATUS) PQCLEAN_CROSSRSDP192FAST_CLEAN_crypto_sign_verify_final(state, signature, signature_len, public_key);
+#endif
+}
+
+static void cross_rsdp_192_fast_verify_abort(void *state) {
+	OQS_SHA3_shake256_inc_ctx_release(state);
+}
+
+static const OQS_SIG_VERIFY_ops cross_rsdp_192_fast_verify_ops = {
+	.state_len = sizeof(OQS_SHA3_shake256_inc_ctx),
+	.init = cross_rsdp_192_fast_verify_init,
+	.update = cross_rsdp_192_fast_verify_update,
+	.final = cross_rsdp_192_fast_verify_final,
+	.abort = cross_rsdp_192_fast_verify_abort,
+};
+
+const OQS_SIG_VERIFY_ops *OQS_SIG_cross_rsdp_192_fast_verify_ops(void) {
+	return &cross_rsdp_192_fast_verify_ops;
+}
 #endif
@@ -37,6 +37,8 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include "fips202.h"
+
 #define PQCLEAN_CROSSRSDP128FAST_CLEAN_CRYPTO_ALGNAME "cross-rsdp-128-fast"
 
 /*  no. of bytes of the secret key */
@@ -84,4 +86,20 @@ int PQCLEAN_CROSSRSDP128FAST_CLEAN_crypto_sign_verify(const unsigned char *sig,
         const unsigned char *pk
                                                      );
 
+int PQCLEAN_CROSSRSDP128FAST_CLEAN_crypto_sign_verify_init(shake128incctx *state,
+        const unsigned char *sig,
+        size_t siglen
+                                                              );
+
+void PQCLEAN_CROSSRSDP128FAST_CLEAN_crypto_sign_verify_update(shake128incctx *state,
+        const unsigned char *m,
+        size_t mlen
+                                                                 );
+
+int PQCLEAN_CROSSRSDP128FAST_CLEAN_crypto_sign_verify_final(shake128incctx *state,
+        const unsigned char *sig,
+        size_t siglen,
+        const unsigned char *pk
+                                                               );
+
 #endif
@@ -139,3 +139,42 @@ int crypto_sign_verify(const unsigned char *sig,                // in parameter
 } // end crypto_sign_verify
 
 /*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*.  ... streaming form of crypto_sign_verify: the message is passed to      */
+/*.  ... crypto_sign_verify_update in chunks; state is released by           */
+/*.  ... crypto_sign_verify_final, or not allocated if _init fails            */
+int crypto_sign_verify_init(CSPRNG_STATE_T *state,               // out parameter
+                            const unsigned char *sig,            // in parameter
+                            size_t siglen                        // in parameter
+                           ) {
+	(void)sig;
+	if (siglen != (size_t) sizeof(CROSS_sig_t)) {
+		return -1;
+	}
+	hash_init(state);
+	return 0;
+} // end crypto_sign_verify_init
+
+void crypto_sign_verify_update(CSPRNG_STATE_T *state,            // in/out parameter
+                               const unsigned char *m,           // in parameter
+                               size_t mlen                       // in parameter
+                              ) {
+	hash_update(state, m, (uint64_t) mlen);
+} // end crypto_sign_verify_update
+
+int crypto_sign_verify_final(CSPRNG_STATE_T *state,              // in parameter
+                             const unsigned char *sig,           // in parameter
+                             size_t siglen,                      // in parameter
+                             const unsigned char *pk             // in parameter
+                            ) {
+	(void)siglen;
+
+	/* verify returns 1 if signature is ok, 0 otherwise */
+	int ok = CROSS_verify_hashed((const pk_t * const) pk,        // in parameter
+	                             state,                          // in parameter
+	                             (const CROSS_sig_t *const) sig); // in parameter
+
+	return ok - 1; // NIST convention: 0 == zero errors, -1 == error condition
+} // end crypto_sign_verify_final
+
+/*----------------------------------------------------------------------------*/
@@ -8,10 +8,14 @@
 #define crypto_sign_open                        CROSS_NAMESPACE(crypto_sign_open)
 #define crypto_sign_signature                   CROSS_NAMESPACE(crypto_sign_signature)
 #define crypto_sign_verify                      CROSS_NAMESPACE(crypto_sign_verify)
+#define crypto_sign_verify_final                CROSS_NAMESPACE(crypto_sign_verify_final)
+#define crypto_sign_verify_init                 CROSS_NAMESPACE(crypto_sign_verify_init)
+#define crypto_sign_verify_update               CROSS_NAMESPACE(crypto_sign_verify_update)
 
 #define CROSS_keygen                            CROSS_NAMESPACE(CROSS_keygen)
 #define CROSS_sign                              CROSS_NAMESPACE(CROSS_sign)
 #define CROSS_verify                            CROSS_NAMESPACE(CROSS_verify)
+#define CROSS_verify_hashed                     CROSS_NAMESPACE(CROSS_verify_hashed)
 #define expand_digest_to_fixed_weight           CROSS_NAMESPACE(expand_digest_to_fixed_weight)
 #define gen_seed_tree                           CROSS_NAMESPACE(gen_seed_tree)
 #define pack_fp_syn                             CROSS_NAMESPACE(pack_fp_syn)
@@ -276,6 +276,42 @@ void hash_par(int par_level,
 	par_xof_release(par_level, &states);
 }
 
+/* hash() for a message passed in chunks: hash_init(), any number of
+ * hash_update() and hash_final(), which releases the state */
+static inline
+void hash_init(CSPRNG_STATE_T *const csprng_state) {
+	xof_shake_init(csprng_state, SEED_LENGTH_BYTES * 8);
+}
+
+static inline
+void hash_update(CSPRNG_STATE_T *const csprng_state,
+                 const unsigned char *const m,
+                 const uint64_t mlen) {
+	/* xof_shake_update() takes an unsigned int length */
+	uint64_t done = 0;
+	while (done < mlen) {
+		uint64_t chunk = mlen - done;
+		if (chunk > 0x40000000) {
+			chunk = 0x40000000;
+		}
+		xof_shake_update(csprng_state, m + done, (unsigned int) chunk);
+		done += chunk;
+	}
+}
+
+static inline
+void hash_final(uint8_t digest[HASH_DIGEST_LENGTH],
+                CSPRNG_STATE_T *const csprng_state,
+                const uint16_t dsc) {
+	uint8_t dsc_ordered[2];
+	dsc_ordered[0] = dsc & 0xff;
+	dsc_ordered[1] = (dsc >> 8) & 0xff;
+	xof_shake_update(csprng_state, dsc_ordered, 2);
+	xof_shake_final(csprng_state);
+	xof_shake_extract(csprng_state, digest, HASH_DIGEST_LENGTH);
+	xof_shake_release(csprng_state);
+}
+
 /***************** Specialized CSPRNGs for non binary domains *****************/
 
 /* CSPRNG sampling fixed weight strings */
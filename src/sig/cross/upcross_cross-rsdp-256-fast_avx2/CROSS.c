@@ -341,6 +341,17 @@ int CROSS_verify(const pk_t *const PK,
                  const char *const m,
                  const uint64_t mlen,
                  const CROSS_sig_t *const sig) {
+	CSPRNG_STATE_T msg_state;
+	hash_init(&msg_state);
+	hash_update(&msg_state, (const unsigned char *) m, mlen);
+	return CROSS_verify_hashed(PK, &msg_state, sig);
+}
+
+/* as CROSS_verify, for a message absorbed into msg_state with hash_init()
+ * and hash_update(); msg_state is released */
+int CROSS_verify_hashed(const pk_t *const PK,
+                        CSPRNG_STATE_T *const msg_state,
+                        const CROSS_sig_t *const sig) {
 	CSPRNG_STATE_T csprng_state;
 
 	FP_ELEM V_tr[K][N - K];
@@ -358,7 +369,7 @@ int CROSS_verify(const pk_t *const PK,
 	is_padd_key_ok = unpack_fp_syn(s, PK->s);
 
 	uint8_t digest_msg_cmt_salt[2 * HASH_DIGEST_LENGTH + SALT_LENGTH_BYTES];
-	hash(digest_msg_cmt_salt, (uint8_t *) m, mlen, HASH_DOMAIN_SEP_CONST);
+	hash_final(digest_msg_cmt_salt, msg_state, HASH_DOMAIN_SEP_CONST);
 	memcpy(digest_msg_cmt_salt + HASH_DIGEST_LENGTH, sig->digest_cmt, HASH_DIGEST_LENGTH);
 	memcpy(digest_msg_cmt_salt + 2 * HASH_DIGEST_LENGTH, sig->salt, SALT_LENGTH_BYTES);
 
@@ -37,6 +37,8 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include "fips202.h"
+
 #define PQCLEAN_CROSSRSDPG128BALANCED_CLEAN_CRYPTO_ALGNAME "cross-rsdpg-128-balanced"
 
 /*  no. of bytes of the secret key */
@@ -84,4 +86,20 @@ int PQCLEAN_CROSSRSDPG128BALANCED_CLEAN_crypto_sign_verify(const unsigned char *
         const unsigned char *pk
                                                           );
 
+int PQCLEAN_CROSSRSDPG128BALANCED_CLEAN_crypto_sign_verify_init(shake128incctx *state,
+        const unsigned char *sig,
+        size_t siglen
+                                                              );
+
+void PQCLEAN_CROSSRSDPG128BALANCED_CLEAN_crypto_sign_verify_update(shake128incctx *state,
+        const unsigned char *m,
+        size_t mlen
+                                                                 );
+
+int PQCLEAN_CROSSRSDPG128BALANCED_CLEAN_crypto_sign_verify_final(shake128incctx *state,
+        const unsigned char *sig,
+        size_t siglen,
+        const unsigned char *pk
+                                                               );
+
 #endif
@@ -33,6 +33,7 @@
 
 #include <stdint.h>
 
+#include "csprng_hash.h"
 #include "namespace.h"
 #include "pack_unpack.h"
 #include "parameters.h"
@@ -83,3 +84,9 @@ int CROSS_verify(const pk_t *PK,
                  const char *m,
                  uint64_t mlen,
                  const CROSS_sig_t *sig);
+
+/* as CROSS_verify, for a message absorbed into msg_state with hash_init()
+ * and hash_update(); msg_state is released */
+int CROSS_verify_hashed(const pk_t *PK,
+                        CSPRNG_STATE_T *msg_state,
+                        const CROSS_sig_t *sig);
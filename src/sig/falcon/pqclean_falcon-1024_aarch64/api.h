@@ -4,6 +4,8 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include "fips202.h"
+
 #define PQCLEAN_FALCON1024_AARCH64_CRYPTO_SECRETKEYBYTES   2305
 #define PQCLEAN_FALCON1024_AARCH64_CRYPTO_PUBLICKEYBYTES   1793
 #define PQCLEAN_FALCON1024_AARCH64_CRYPTO_BYTES            1462
@@ -49,6 +51,27 @@ int PQCLEAN_FALCON1024_AARCH64_crypto_sign_verify(
     const uint8_t *sig, size_t siglen,
     const uint8_t *m, size_t mlen, const uint8_t *pk);
 
+/*
+ * Streaming form of PQCLEAN_FALCON1024_AARCH64_crypto_sign_verify(): _init()
+ * checks the signature header and starts hashing its nonce into sc,
+ * _update() hashes the next chunk of the message, and _final()
+ * verifies the signature against the hashed message and releases sc.
+ * sig[] and siglen passed to _final() must be those passed to _init().
+ * If _init() fails, sc is not allocated; otherwise _final() must be
+ * called, or sc released with shake256_inc_ctx_release().
+ *
+ * Return value: 0 on success, -1 on error.
+ */
+int PQCLEAN_FALCON1024_AARCH64_crypto_sign_verify_init(
+    shake256incctx *sc, const uint8_t *sig, size_t siglen);
+
+void PQCLEAN_FALCON1024_AARCH64_crypto_sign_verify_update(
+    shake256incctx *sc, const uint8_t *m, size_t mlen);
+
+int PQCLEAN_FALCON1024_AARCH64_crypto_sign_verify_final(
+    shake256incctx *sc, const uint8_t *sig, size_t siglen,
+    const uint8_t *pk);
+
 /*
  * Compute a signature on a message and pack the signature and message
  * into a single object, written into sm[]. The length of that output is
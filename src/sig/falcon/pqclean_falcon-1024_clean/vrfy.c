@@ -29,6 +29,8 @@
  * @author   Thomas Pornin <thomas.pornin@nccgroup.com>
  */
 
+#include <oqs/common.h>
+
 #include "inner.h"
 
 /* ===================================================================== */
@@ -491,6 +493,10 @@ mq_div_12289(uint32_t x, uint32_t y) {
     return mq_montymul(y18, x);
 }
 
+#if defined(OQS_USE_VECTOR_EXTENSIONS)
+#include "../vecext/mq_vecext.h"
+#endif
+
 /*
  * Compute NTT on a ring element.
  */
@@ -498,6 +504,12 @@ static void
 mq_NTT(uint16_t *a, unsigned logn) {
     size_t n, t, m;
 
+#if defined(OQS_USE_VECTOR_EXTENSIONS)
+    if (logn >= 4) {
+        mq_NTT_vec(a, logn);
+        return;
+    }
+#endif
     n = (size_t)1 << logn;
     t = n;
     for (m = 1; m < n; m <<= 1) {
@@ -531,6 +543,12 @@ mq_iNTT(uint16_t *a, unsigned logn) {
     size_t n, t, m;
     uint32_t ni;
 
+#if defined(OQS_USE_VECTOR_EXTENSIONS)
+    if (logn >= 4) {
+        mq_iNTT_vec(a, logn);
+        return;
+    }
+#endif
     n = (size_t)1 << logn;
     t = 1;
     m = n;
@@ -600,7 +618,14 @@ mq_poly_montymul_ntt(uint16_t *f, const uint16_t *g, unsigned logn) {
     size_t u, n;
 
     n = (size_t)1 << logn;
-    for (u = 0; u < n; u ++) {
+    u = 0;
+#if defined(OQS_USE_VECTOR_EXTENSIONS)
+    for (; u + 8 <= n; u += 8) {
+        mq_vec_store(f + u,
+                     mq_vec_montymul(mq_vec_load(f + u), mq_vec_load(g + u)));
+    }
+#endif
+    for (; u < n; u ++) {
         f[u] = (uint16_t)mq_montymul(f[u], g[u]);
     }
 }
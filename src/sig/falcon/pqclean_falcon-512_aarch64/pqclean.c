@@ -208,14 +208,16 @@ do_sign(uint8_t *nonce, uint8_t *sigbuf, size_t *sigbuflen,
 }
 
 /*
- * Verify a sigature. The nonce has size NONCELEN bytes. sigbuf[]
- * (of size sigbuflen) contains the signature value, not including the
- * header byte or nonce. Return value is 0 on success, -1 on error.
+ * Verify a sigature for a message hashed into sc. The caller has
+ * initialised sc and injected the nonce and the message; this function
+ * flips and releases it. sigbuf[] (of size sigbuflen) contains the
+ * signature value, not including the header byte or nonce. Return value
+ * is 0 on success, -1 on error.
  */
 static int
-do_verify(
-    const uint8_t *nonce, const uint8_t *sigbuf, size_t sigbuflen,
-    const uint8_t *m, size_t mlen, const uint8_t *pk) {
+do_verify_hashed(
+    inner_shake256_context *sc, const uint8_t *sigbuf, size_t sigbuflen,
+    const uint8_t *pk) {
     union {
         uint8_t b[2 * FALCON_N];
         uint64_t dummy_u64;
@@ -224,9 +226,16 @@ do_verify(
     int16_t h[FALCON_N];
     int16_t hm[FALCON_N];
     int16_t sig[FALCON_N];
-    inner_shake256_context sc;
     size_t v;
 
+    /*
+     * Hash nonce + message into a vector. This is done first so
+     * that sc is released on every path.
+     */
+    inner_shake256_flip(sc);
+    PQCLEAN_FALCON512_AARCH64_hash_to_point_ct(sc, (uint16_t *) hm, FALCON_LOGN, tmp.b);
+    inner_shake256_ctx_release(sc);
+
     /*
      * Decode public key.
      */
@@ -263,16 +272,6 @@ do_verify(
         }
     }
 
-    /*
-     * Hash nonce + message into a vector.
-     */
-    inner_shake256_init(&sc);
-    inner_shake256_inject(&sc, nonce, NONCELEN);
-    inner_shake256_inject(&sc, m, mlen);
-    inner_shake256_flip(&sc);
-    PQCLEAN_FALCON512_AARCH64_hash_to_point_ct(&sc, (uint16_t *) hm, FALCON_LOGN, tmp.b);
-    inner_shake256_ctx_release(&sc);
-
     /*
      * Verify signature.
      */
@@ -282,6 +281,23 @@ do_verify(
     return 0;
 }
 
+/*
+ * Verify a sigature. The nonce has size NONCELEN bytes. sigbuf[]
+ * (of size sigbuflen) contains the signature value, not including the
+ * header byte or nonce. Return value is 0 on success, -1 on error.
+ */
+static int
+do_verify(
+    const uint8_t *nonce, const uint8_t *sigbuf, size_t sigbuflen,
+    const uint8_t *m, size_t mlen, const uint8_t *pk) {
+    inner_shake256_context sc;
+
+    inner_shake256_init(&sc);
+    inner_shake256_inject(&sc, nonce, NONCELEN);
+    inner_shake256_inject(&sc, m, mlen);
+    return do_verify_hashed(&sc, sigbuf, sigbuflen, pk);
+}
+
 /* see api.h */
 int
 PQCLEAN_FALCON512_AARCH64_crypto_sign_signature(
@@ -313,6 +329,37 @@ PQCLEAN_FALCON512_AARCH64_crypto_sign_verify(
                      sig + 1 + NONCELEN, siglen - 1 - NONCELEN, m, mlen, pk);
 }
 
+/* see api.h */
+int
+PQCLEAN_FALCON512_AARCH64_crypto_sign_verify_init(
+    shake256incctx *sc, const uint8_t *sig, size_t siglen) {
+    if (siglen < 1 + NONCELEN) {
+        return -1;
+    }
+    if (sig[0] != 0x30 + FALCON_LOGN) {
+        return -1;
+    }
+    inner_shake256_init(sc);
+    inner_shake256_inject(sc, sig + 1, NONCELEN);
+    return 0;
+}
+
+/* see api.h */
+void
+PQCLEAN_FALCON512_AARCH64_crypto_sign_verify_update(
+    shake256incctx *sc, const uint8_t *m, size_t mlen) {
+    inner_shake256_inject(sc, m, mlen);
+}
+
+/* see api.h */
+int
+PQCLEAN_FALCON512_AARCH64_crypto_sign_verify_final(
+    shake256incctx *sc, const uint8_t *sig, size_t siglen,
+    const uint8_t *pk) {
+    return do_verify_hashed(sc,
+                            sig + 1 + NONCELEN, siglen - 1 - NONCELEN, pk);
+}
+
 /* see api.h */
 int
 PQCLEAN_FALCON512_AARCH64_crypto_sign(
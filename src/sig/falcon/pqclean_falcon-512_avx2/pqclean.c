@@ -208,14 +208,16 @@ do_sign(uint8_t *nonce, uint8_t *sigbuf, size_t *sigbuflen,
 }
 
 /*
- * Verify a sigature. The nonce has size NONCELEN bytes. sigbuf[]
- * (of size sigbuflen) contains the signature value, not including the
- * header byte or nonce. Return value is 0 on success, -1 on error.
+ * Verify a sigature for a message hashed into sc. The caller has
+ * initialised sc and injected the nonce and the message; this function
+ * flips and releases it. sigbuf[] (of size sigbuflen) contains the
+ * signature value, not including the header byte or nonce. Return value
+ * is 0 on success, -1 on error.
  */
 static int
-do_verify(
-    const uint8_t *nonce, const uint8_t *sigbuf, size_t sigbuflen,
-    const uint8_t *m, size_t mlen, const uint8_t *pk) {
+do_verify_hashed(
+    inner_shake256_context *sc, const uint8_t *sigbuf, size_t sigbuflen,
+    const uint8_t *pk) {
     union {
         uint8_t b[2 * 512];
         uint64_t dummy_u64;
@@ -223,9 +225,16 @@ do_verify(
     } tmp;
     uint16_t h[512], hm[512];
     int16_t sig[512];
-    inner_shake256_context sc;
     size_t v;
 
+    /*
+     * Hash nonce + message into a vector. This is done first so
+     * that sc is released on every path.
+     */
+    inner_shake256_flip(sc);
+    PQCLEAN_FALCON512_AVX2_hash_to_point_ct(sc, hm, 9, tmp.b);
+    inner_shake256_ctx_release(sc);
+
     /*
      * Decode public key.
      */
@@ -262,16 +271,6 @@ do_verify(
         }
     }
 
-    /*
-     * Hash nonce + message into a vector.
-     */
-    inner_shake256_init(&sc);
-    inner_shake256_inject(&sc, nonce, NONCELEN);
-    inner_shake256_inject(&sc, m, mlen);
-    inner_shake256_flip(&sc);
-    PQCLEAN_FALCON512_AVX2_hash_to_point_ct(&sc, hm, 9, tmp.b);
-    inner_shake256_ctx_release(&sc);
-
     /*
      * Verify signature.
      */
@@ -281,6 +280,23 @@ do_verify(
     return 0;
 }
 
+/*
+ * Verify a sigature. The nonce has size NONCELEN bytes. sigbuf[]
+ * (of size sigbuflen) contains the signature value, not including the
+ * header byte or nonce. Return value is 0 on success, -1 on error.
+ */
+static int
+do_verify(
+    const uint8_t *nonce, const uint8_t *sigbuf, size_t sigbuflen,
+    const uint8_t *m, size_t mlen, const uint8_t *pk) {
+    inner_shake256_context sc;
+
+    inner_shake256_init(&sc);
+    inner_shake256_inject(&sc, nonce, NONCELEN);
+    inner_shake256_inject(&sc, m, mlen);
+    return do_verify_hashed(&sc, sigbuf, sigbuflen, pk);
+}
+
 /* see api.h */
 int
 PQCLEAN_FALCON512_AVX2_crypto_sign_signature(
@@ -312,6 +328,37 @@ PQCLEAN_FALCON512_AVX2_crypto_sign_verify(
                      sig + 1 + NONCELEN, siglen - 1 - NONCELEN, m, mlen, pk);
 }
 
+/* see api.h */
+int
+PQCLEAN_FALCON512_AVX2_crypto_sign_verify_init(
+    shake256incctx *sc, const uint8_t *sig, size_t siglen) {
+    if (siglen < 1 + NONCELEN) {
+        return -1;
+    }
+    if (sig[0] != 0x30 + 9) {
+        return -1;
+    }
+    inner_shake256_init(sc);
+    inner_shake256_inject(sc, sig + 1, NONCELEN);
+    return 0;
+}
+
+/* see api.h */
+void
+PQCLEAN_FALCON512_AVX2_crypto_sign_verify_update(
+    shake256incctx *sc, const uint8_t *m, size_t mlen) {
+    inner_shake256_inject(sc, m, mlen);
+}
+
+/* see api.h */
+int
+PQCLEAN_FALCON512_AVX2_crypto_sign_verify_final(
+    shake256incctx *sc, const uint8_t *sig, size_t siglen,
+    const uint8_t *pk) {
+    return do_verify_hashed(sc,
+                            sig + 1 + NONCELEN, siglen - 1 - NONCELEN, pk);
+}
+
 /* see api.h */
 int
 PQCLEAN_FALCON512_AVX2_crypto_sign(
@@ -724,6 +724,53 @@ modp_montymul(uint32_t a, uint32_t b, uint32_t p, uint32_t p0i) {
     return d;
 }
 
+/*
+ * AVX2 versions of modp_add(), modp_sub() and modp_montymul(), on
+ * eight values at once. All lanes use the same modulus; pp and pp0i
+ * contain p and p0i broadcast to all 32-bit lanes. Results are
+ * identical to the scalar functions.
+ */
+static inline __m256i
+modp_add_x8(__m256i a, __m256i b, __m256i pp) {
+    __m256i d;
+
+    d = _mm256_sub_epi32(_mm256_add_epi32(a, b), pp);
+    return _mm256_add_epi32(d,
+                            _mm256_and_si256(pp, _mm256_srai_epi32(d, 31)));
+}
+
+static inline __m256i
+modp_sub_x8(__m256i a, __m256i b, __m256i pp) {
+    __m256i d;
+
+    d = _mm256_sub_epi32(a, b);
+    return _mm256_add_epi32(d,
+                            _mm256_and_si256(pp, _mm256_srai_epi32(d, 31)));
+}
+
+static inline __m256i
+modp_montymul_x8(__m256i a, __m256i b, __m256i pp, __m256i pp0i) {
+    __m256i m31, ze, zo, we, wo, d;
+
+    /*
+     * _mm256_mul_epu32() multiplies the even 32-bit lanes; the odd
+     * lanes are processed by shifting them down first.
+     */
+    m31 = _mm256_set1_epi64x(0x7FFFFFFF);
+    ze = _mm256_mul_epu32(a, b);
+    zo = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), _mm256_srli_epi64(b, 32));
+    we = _mm256_mul_epu32(
+             _mm256_and_si256(_mm256_mul_epu32(ze, pp0i), m31), pp);
+    wo = _mm256_mul_epu32(
+             _mm256_and_si256(_mm256_mul_epu32(zo, pp0i), m31), pp);
+    ze = _mm256_srli_epi64(_mm256_add_epi64(ze, we), 31);
+    zo = _mm256_slli_epi64(_mm256_add_epi64(zo, wo), 1);
+    d = _mm256_blend_epi32(ze, zo, 0xAA);
+    d = _mm256_sub_epi32(d, pp);
+    return _mm256_add_epi32(d,
+                            _mm256_and_si256(pp, _mm256_srai_epi32(d, 31)));
+}
+
 /*
  * Compute R2 = 2^62 mod p.
  */
@@ -986,6 +1033,25 @@ modp_NTT2_ext(uint32_t *a, size_t stride, const uint32_t *gm, unsigned logn,
             s = gm[m + u];
             r1 = a + v1 * stride;
             r2 = r1 + ht * stride;
+            if (stride == 1 && ht >= 8) {
+                __m256i ss, pp, pp0i;
+
+                ss = _mm256_set1_epi32((int)s);
+                pp = _mm256_set1_epi32((int)p);
+                pp0i = _mm256_set1_epi32((int)p0i);
+                for (v = 0; v < ht; v += 8) {
+                    __m256i x, y;
+
+                    x = _mm256_loadu_si256((__m256i *)(r1 + v));
+                    y = _mm256_loadu_si256((__m256i *)(r2 + v));
+                    y = modp_montymul_x8(y, ss, pp, pp0i);
+                    _mm256_storeu_si256((__m256i *)(r1 + v),
+                                        modp_add_x8(x, y, pp));
+                    _mm256_storeu_si256((__m256i *)(r2 + v),
+                                        modp_sub_x8(x, y, pp));
+                }
+                continue;
+            }
             for (v = 0; v < ht; v ++, r1 += stride, r2 += stride) {
                 uint32_t x, y;
 
@@ -1027,6 +1093,26 @@ modp_iNTT2_ext(uint32_t *a, size_t stride, const uint32_t *igm, unsigned logn,
             s = igm[hm + u];
             r1 = a + v1 * stride;
             r2 = r1 + t * stride;
+            if (stride == 1 && t >= 8) {
+                __m256i ss, pp, pp0i;
+
+                ss = _mm256_set1_epi32((int)s);
+                pp = _mm256_set1_epi32((int)p);
+                pp0i = _mm256_set1_epi32((int)p0i);
+                for (v = 0; v < t; v += 8) {
+                    __m256i x, y;
+
+                    x = _mm256_loadu_si256((__m256i *)(r1 + v));
+                    y = _mm256_loadu_si256((__m256i *)(r2 + v));
+                    _mm256_storeu_si256((__m256i *)(r1 + v),
+                                        modp_add_x8(x, y, pp));
+                    _mm256_storeu_si256((__m256i *)(r2 + v),
+                                        modp_montymul_x8(
+                                            modp_sub_x8(x, y, pp),
+                                            ss, pp, pp0i));
+                }
+                continue;
+            }
             for (v = 0; v < t; v ++, r1 += stride, r2 += stride) {
                 uint32_t x, y;
 
@@ -1046,7 +1132,22 @@ modp_iNTT2_ext(uint32_t *a, size_t stride, const uint32_t *igm, unsigned logn,
      * thus a simple shift will do.
      */
     ni = (uint32_t)1 << (31 - logn);
-    for (k = 0, r = a; k < n; k ++, r += stride) {
+    k = 0;
+    r = a;
+    if (stride == 1) {
+        __m256i nn, pp, pp0i;
+
+        nn = _mm256_set1_epi32((int)ni);
+        pp = _mm256_set1_epi32((int)p);
+        pp0i = _mm256_set1_epi32((int)p0i);
+        for (; k + 8 <= n; k += 8, r += 8) {
+            _mm256_storeu_si256((__m256i *)r,
+                                modp_montymul_x8(
+                                    _mm256_loadu_si256((__m256i *)r),
+                                    nn, pp, pp0i));
+        }
+    }
+    for (; k < n; k ++, r += stride) {
         *r = modp_montymul(*r, ni, p, p0i);
     }
 }
@@ -1191,6 +1292,61 @@ zint_mod_small_unsigned(const uint32_t *d, size_t dlen,
      */
     x = 0;
     u = dlen;
+
+    /*
+     * For long integers, the words are split into eight interleaved
+     * sequences (word indices equal modulo 8), each of which is
+     * evaluated in base 2^248 in its own AVX2 lane; the top dlen % 8
+     * words are processed first and injected in lane 0. The eight
+     * lanes are then recombined with the scalar code. The result is
+     * the same fully reduced value.
+     */
+    if (dlen >= 16) {
+        union {
+            __m256i y;
+            uint32_t w[8];
+        } t;
+        __m256i pp, pp0i, rr;
+        uint32_t R9;
+        size_t j;
+
+        /*
+         * R9 = 2^279 mod p, i.e. 2^248 in Montgomery representation.
+         */
+        R9 = R2;
+        for (j = 0; j < 7; j ++) {
+            R9 = modp_montymul(R9, R2, p, p0i);
+        }
+        while ((u & 7) != 0) {
+            uint32_t w;
+
+            u --;
+            x = modp_montymul(x, R2, p, p0i);
+            w = d[u] - p;
+            w += p & -(w >> 31);
+            x = modp_add(x, w, p);
+        }
+        pp = _mm256_set1_epi32((int)p);
+        pp0i = _mm256_set1_epi32((int)p0i);
+        rr = _mm256_set1_epi32((int)R9);
+        t.y = _mm256_setr_epi32((int)x, 0, 0, 0, 0, 0, 0, 0);
+        while (u > 0) {
+            __m256i w;
+
+            u -= 8;
+            t.y = modp_montymul_x8(t.y, rr, pp, pp0i);
+            w = _mm256_loadu_si256((const __m256i *)(d + u));
+            w = modp_sub_x8(w, pp, pp);
+            t.y = modp_add_x8(t.y, w, pp);
+        }
+        x = t.w[7];
+        for (j = 7; j -- > 0;) {
+            x = modp_montymul(x, R2, p, p0i);
+            x = modp_add(x, t.w[j], p);
+        }
+        return x;
+    }
+
     while (u -- > 0) {
         uint32_t w;
 
@@ -1219,6 +1375,83 @@ zint_mod_small_signed(const uint32_t *d, size_t dlen,
     return z;
 }
 
+/*
+ * AVX2 version of zint_mod_small_unsigned() over eight integers at
+ * once; integer j (0 to 7) starts at d + j * dstride. Each integer is
+ * a serial carry-free Horner evaluation, so the eight run in parallel
+ * lanes with the same prime.
+ */
+static __m256i
+zint_mod_small_unsigned_x8(const uint32_t *d, size_t dstride, size_t dlen,
+                           uint32_t p, uint32_t p0i, uint32_t R2) {
+    __m256i idx, pp, pp0i, rr, x;
+    size_t u;
+
+    idx = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7),
+                             _mm256_set1_epi32((int)dstride));
+    pp = _mm256_set1_epi32((int)p);
+    pp0i = _mm256_set1_epi32((int)p0i);
+    rr = _mm256_set1_epi32((int)R2);
+    x = _mm256_setzero_si256();
+    u = dlen;
+    while (u -- > 0) {
+        __m256i w;
+
+        x = modp_montymul_x8(x, rr, pp, pp0i);
+        w = _mm256_i32gather_epi32((const int *)(d + u), idx, 4);
+        w = modp_sub_x8(w, pp, pp);
+        x = modp_add_x8(x, w, pp);
+    }
+    return x;
+}
+
+/*
+ * Compute zint_mod_small_signed() for 'num' integers of 'dlen' words,
+ * integer v starting at d + v * dstride, and write the residue of
+ * integer v to x[v * xstride]. Eight integers are processed at a time
+ * with AVX2.
+ */
+static void
+zint_mod_small_signed_many(uint32_t *x, size_t xstride,
+                           const uint32_t *d, size_t dstride, size_t num,
+                           size_t dlen, uint32_t p, uint32_t p0i,
+                           uint32_t R2, uint32_t Rx) {
+    size_t v;
+
+    v = 0;
+    if (dlen > 0) {
+        __m256i pp, rx, idx;
+
+        pp = _mm256_set1_epi32((int)p);
+        rx = _mm256_set1_epi32((int)Rx);
+        idx = _mm256_mullo_epi32(
+                  _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7),
+                  _mm256_set1_epi32((int)dstride));
+        for (; v + 8 <= num; v += 8) {
+            union {
+                __m256i y;
+                uint32_t w[8];
+            } z;
+            __m256i hw;
+            size_t j;
+
+            z.y = zint_mod_small_unsigned_x8(d + v * dstride, dstride,
+                                             dlen, p, p0i, R2);
+            hw = _mm256_i32gather_epi32(
+                     (const int *)(d + v * dstride + dlen - 1), idx, 4);
+            hw = _mm256_srai_epi32(_mm256_slli_epi32(hw, 1), 31);
+            z.y = modp_sub_x8(z.y, _mm256_and_si256(rx, hw), pp);
+            for (j = 0; j < 8; j ++) {
+                x[(v + j) * xstride] = z.w[j];
+            }
+        }
+    }
+    for (; v < num; v ++) {
+        x[v * xstride] = zint_mod_small_signed(d + v * dstride, dlen,
+                                               p, p0i, R2, Rx);
+    }
+}
+
 /*
  * Add y*s to x. x and y initially have length 'len' words; the new x
  * has length 'len+1' words. 's' must fit on 31 bits. x[] and y[] must
@@ -1335,7 +1568,42 @@ zint_rebuild_CRT(uint32_t *xx, size_t xlen, size_t xstride,
         p0i = modp_ninv31(p);
         R2 = modp_R2(p, p0i);
 
-        for (v = 0, x = xx; v < num; v ++, x += xstride) {
+        v = 0;
+        x = xx;
+        if (num >= 8) {
+            __m256i pp, pp0i, ss, idx;
+
+            pp = _mm256_set1_epi32((int)p);
+            pp0i = _mm256_set1_epi32((int)p0i);
+            ss = _mm256_set1_epi32((int)s);
+            idx = _mm256_mullo_epi32(
+                      _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7),
+                      _mm256_set1_epi32((int)xstride));
+            for (; v + 8 <= num; v += 8) {
+                union {
+                    __m256i y;
+                    uint32_t w[8];
+                } xr;
+                __m256i xp, xq;
+                size_t j;
+
+                /*
+                 * Same computation as the scalar loop below; the
+                 * residues of eight integers are obtained in
+                 * parallel, and the carry-propagating additions
+                 * are then done one integer at a time.
+                 */
+                xp = _mm256_i32gather_epi32((const int *)(x + u), idx, 4);
+                xq = zint_mod_small_unsigned_x8(x, xstride, u,
+                                                p, p0i, R2);
+                xr.y = modp_montymul_x8(ss, modp_sub_x8(xp, xq, pp),
+                                        pp, pp0i);
+                for (j = 0; j < 8; j ++, x += xstride) {
+                    zint_add_mul_small(x, tmp, u, xr.w[j]);
+                }
+            }
+        }
+        for (; v < num; v ++, x += xstride) {
             uint32_t xp, xq, xr;
             /*
              * xp = the integer x modulo the prime p for this
@@ -2152,10 +2420,8 @@ poly_sub_scaled_ntt(uint32_t *F, size_t Flen, size_t Fstride,
             t1[v] = modp_set(k[v], p);
         }
         modp_NTT2(t1, gm, logn, p, p0i);
-        for (v = 0, y = f, x = fk + u;
-                v < n; v ++, y += fstride, x += tlen) {
-            *x = zint_mod_small_signed(y, flen, p, p0i, R2, Rx);
-        }
+        zint_mod_small_signed_many(fk + u, tlen, f, fstride, n,
+                                   flen, p, p0i, R2, Rx);
         modp_NTT2_ext(fk + u, tlen, gm, logn, p, p0i);
         for (v = 0, x = fk + u; v < n; v ++, x += tlen) {
             *x = modp_montymul(
@@ -2578,9 +2844,8 @@ make_fg_step(uint32_t *data, unsigned logn, unsigned depth,
         R2 = modp_R2(p, p0i);
         Rx = modp_Rx((unsigned)slen, p, p0i, R2);
         modp_mkgm2(gm, igm, logn, primes[u].g, p, p0i);
-        for (v = 0, x = fs; v < n; v ++, x += slen) {
-            t1[v] = zint_mod_small_signed(x, slen, p, p0i, R2, Rx);
-        }
+        zint_mod_small_signed_many(t1, 1, fs, slen, n,
+                                   slen, p, p0i, R2, Rx);
         modp_NTT2(t1, gm, logn, p, p0i);
         for (v = 0, x = fd + u; v < hn; v ++, x += tlen) {
             uint32_t w0, w1;
@@ -2590,9 +2855,8 @@ make_fg_step(uint32_t *data, unsigned logn, unsigned depth,
             *x = modp_montymul(
                      modp_montymul(w0, w1, p, p0i), R2, p, p0i);
         }
-        for (v = 0, x = gs; v < n; v ++, x += slen) {
-            t1[v] = zint_mod_small_signed(x, slen, p, p0i, R2, Rx);
-        }
+        zint_mod_small_signed_many(t1, 1, gs, slen, n,
+                                   slen, p, p0i, R2, Rx);
         modp_NTT2(t1, gm, logn, p, p0i);
         for (v = 0, x = gd + u; v < hn; v ++, x += tlen) {
             uint32_t w0, w1;
@@ -2815,19 +3079,15 @@ solve_NTRU_intermediate(unsigned logn_top,
      */
     for (u = 0; u < llen; u ++) {
         uint32_t p, p0i, R2, Rx;
-        size_t v;
-        uint32_t *xs, *ys, *xd, *yd;
 
         p = primes[u].p;
         p0i = modp_ninv31(p);
         R2 = modp_R2(p, p0i);
         Rx = modp_Rx((unsigned)dlen, p, p0i, R2);
-        for (v = 0, xs = Fd, ys = Gd, xd = Ft + u, yd = Gt + u;
-                v < hn;
-                v ++, xs += dlen, ys += dlen, xd += llen, yd += llen) {
-            *xd = zint_mod_small_signed(xs, dlen, p, p0i, R2, Rx);
-            *yd = zint_mod_small_signed(ys, dlen, p, p0i, R2, Rx);
-        }
+        zint_mod_small_signed_many(Ft + u, llen, Fd, dlen, hn,
+                                   dlen, p, p0i, R2, Rx);
+        zint_mod_small_signed_many(Gt + u, llen, Gd, dlen, hn,
+                                   dlen, p, p0i, R2, Rx);
     }
 
     /*
@@ -2877,13 +3137,10 @@ solve_NTRU_intermediate(unsigned logn_top,
             uint32_t Rx;
 
             Rx = modp_Rx((unsigned)slen, p, p0i, R2);
-            for (v = 0, x = ft, y = gt;
-                    v < n; v ++, x += slen, y += slen) {
-                fx[v] = zint_mod_small_signed(x, slen,
-                                              p, p0i, R2, Rx);
-                gx[v] = zint_mod_small_signed(y, slen,
-                                              p, p0i, R2, Rx);
-            }
+            zint_mod_small_signed_many(fx, 1, ft, slen, n,
+                                       slen, p, p0i, R2, Rx);
+            zint_mod_small_signed_many(gx, 1, gt, slen, n,
+                                       slen, p, p0i, R2, Rx);
             modp_NTT2(fx, gm, logn, p, p0i);
             modp_NTT2(gx, gm, logn, p, p0i);
         }
@@ -3354,19 +3611,15 @@ solve_NTRU_binary_depth1(unsigned logn_top,
      */
     for (u = 0; u < llen; u ++) {
         uint32_t p, p0i, R2, Rx;
-        size_t v;
-        uint32_t *xs, *ys, *xd, *yd;
 
         p = PRIMES[u].p;
         p0i = modp_ninv31(p);
         R2 = modp_R2(p, p0i);
         Rx = modp_Rx((unsigned)dlen, p, p0i, R2);
-        for (v = 0, xs = Fd, ys = Gd, xd = Ft + u, yd = Gt + u;
-                v < hn;
-                v ++, xs += dlen, ys += dlen, xd += llen, yd += llen) {
-            *xd = zint_mod_small_signed(xs, dlen, p, p0i, R2, Rx);
-            *yd = zint_mod_small_signed(ys, dlen, p, p0i, R2, Rx);
-        }
+        zint_mod_small_signed_many(Ft + u, llen, Fd, dlen, hn,
+                                   dlen, p, p0i, R2, Rx);
+        zint_mod_small_signed_many(Gt + u, llen, Gd, dlen, hn,
+                                   dlen, p, p0i, R2, Rx);
     }
 
     /*
@@ -0,0 +1,237 @@
+// SPDX-License-Identifier: MIT
+
+#ifndef FALCON_MQ_VECEXT_H
+#define FALCON_MQ_VECEXT_H
+
+/*
+ * Versions of mq_NTT(), mq_iNTT() and mq_montymul() over eight coefficients,
+ * written with the GCC/Clang vector extensions, for targets without dedicated
+ * SIMD code (e.g. POWER and IBM Z). They are shared by the vrfy.c of the clean
+ * Falcon implementations and by src/sig/falcon_clean_ntt.c, which include this
+ * file after defining Q, Q0I, R, GMb[], iGMb[] and mq_rshift1().
+ *
+ * Each vector holds eight coefficients in 32-bit lanes; every lane performs
+ * exactly the operations of mq_add(), mq_sub() and mq_montymul(), so the
+ * results are identical to the scalar code. The last three NTT layers (and
+ * the first three inverse NTT layers) act within 16 coefficients, and are
+ * computed by regrouping the lanes of two vectors. The callers use the scalar
+ * code for degrees below 16.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+typedef uint32_t mq_vec __attribute__((vector_size(32)));
+typedef uint16_t mq_vec16 __attribute__((vector_size(16)));
+
+#if defined(__clang__)
+#define mq_vec_shuffle(a, b, ...)   __builtin_shufflevector(a, b, __VA_ARGS__)
+#else
+#define mq_vec_shuffle(a, b, ...)   __builtin_shuffle(a, b, (mq_vec){__VA_ARGS__})
+#endif
+
+static inline mq_vec
+mq_vec_load(const uint16_t *p) {
+	mq_vec16 v;
+
+	memcpy(&v, p, sizeof v);
+	return __builtin_convertvector(v, mq_vec);
+}
+
+static inline void
+mq_vec_store(uint16_t *p, mq_vec x) {
+	mq_vec16 v;
+
+	v = __builtin_convertvector(x, mq_vec16);
+	memcpy(p, &v, sizeof v);
+}
+
+/*
+ * Vector { x0, x0, x1, x1, x2, x2, x3, x3 }.
+ */
+static inline mq_vec
+mq_vec_set(uint32_t x0, uint32_t x1, uint32_t x2, uint32_t x3) {
+	mq_vec v = { x0, x0, x1, x1, x2, x2, x3, x3 };
+
+	return v;
+}
+
+static inline mq_vec
+mq_vec_add(mq_vec x, mq_vec y) {
+	mq_vec d;
+
+	d = x + y - Q;
+	d += Q & -(d >> 31);
+	return d;
+}
+
+static inline mq_vec
+mq_vec_sub(mq_vec x, mq_vec y) {
+	mq_vec d;
+
+	d = x - y;
+	d += Q & -(d >> 31);
+	return d;
+}
+
+static inline mq_vec
+mq_vec_montymul(mq_vec x, mq_vec y) {
+	mq_vec z, w;
+
+	z = x * y;
+	w = ((z * Q0I) & 0xFFFF) * Q;
+	z = (z + w) >> 16;
+	z -= Q;
+	z += Q & -(z >> 31);
+	return z;
+}
+
+static void
+mq_NTT_vec(uint16_t *a, unsigned logn) {
+	size_t n, t, m, u;
+
+	n = (size_t)1 << logn;
+	t = n;
+	for (m = 1; t > 8; m <<= 1) {
+		size_t ht, i, j1;
+
+		ht = t >> 1;
+		for (i = 0, j1 = 0; i < m; i ++, j1 += t) {
+			size_t j;
+			mq_vec s;
+
+			s = mq_vec_set(GMb[m + i], GMb[m + i], GMb[m + i], GMb[m + i]);
+			for (j = j1; j < j1 + ht; j += 8) {
+				mq_vec x, y;
+
+				x = mq_vec_load(a + j);
+				y = mq_vec_montymul(mq_vec_load(a + j + ht), s);
+				mq_vec_store(a + j, mq_vec_add(x, y));
+				mq_vec_store(a + j + ht, mq_vec_sub(x, y));
+			}
+		}
+		t = ht;
+	}
+
+	/*
+	 * Layers with ht = 4, 2 and 1 use GMb[n/8 + i], GMb[n/4 + i]
+	 * and GMb[n/2 + i] for the i-th block of 8, 4 and 2 coefficients.
+	 */
+	for (u = 0; u < (n >> 4); u ++) {
+		const uint16_t *g4, *g2;
+		mq_vec v0, v1, lo, hi, y;
+
+		g4 = GMb + (n >> 3) + 2 * u;
+		g2 = GMb + (n >> 2) + 4 * u;
+		v0 = mq_vec_load(a + 16 * u);
+		v1 = mq_vec_load(a + 16 * u + 8);
+
+		lo = mq_vec_shuffle(v0, v1, 0, 1, 2, 3, 8, 9, 10, 11);
+		hi = mq_vec_shuffle(v0, v1, 4, 5, 6, 7, 12, 13, 14, 15);
+		y = mq_vec_montymul(hi, mq_vec_set(g4[0], g4[0], g4[1], g4[1]));
+		v0 = mq_vec_add(lo, y);
+		v1 = mq_vec_sub(lo, y);
+
+		lo = mq_vec_shuffle(v0, v1, 0, 1, 8, 9, 4, 5, 12, 13);
+		hi = mq_vec_shuffle(v0, v1, 2, 3, 10, 11, 6, 7, 14, 15);
+		y = mq_vec_montymul(hi, mq_vec_set(g2[0], g2[1], g2[2], g2[3]));
+		v0 = mq_vec_add(lo, y);
+		v1 = mq_vec_sub(lo, y);
+
+		lo = mq_vec_shuffle(v0, v1, 0, 8, 2, 10, 4, 12, 6, 14);
+		hi = mq_vec_shuffle(v0, v1, 1, 9, 3, 11, 5, 13, 7, 15);
+		y = mq_vec_montymul(hi, mq_vec_load(GMb + (n >> 1) + 8 * u));
+		v0 = mq_vec_add(lo, y);
+		v1 = mq_vec_sub(lo, y);
+
+		mq_vec_store(a + 16 * u,
+					 mq_vec_shuffle(v0, v1, 0, 8, 1, 9, 2, 10, 3, 11));
+		mq_vec_store(a + 16 * u + 8,
+					 mq_vec_shuffle(v0, v1, 4, 12, 5, 13, 6, 14, 7, 15));
+	}
+}
+
+static void
+mq_iNTT_vec(uint16_t *a, unsigned logn) {
+	size_t n, t, m, u;
+	uint32_t ni;
+	mq_vec vni;
+
+	n = (size_t)1 << logn;
+
+	/*
+	 * Layers with t = 1, 2 and 4 use iGMb[n/2 + i], iGMb[n/4 + i]
+	 * and iGMb[n/8 + i] for the i-th block of 2, 4 and 8 coefficients.
+	 */
+	for (u = 0; u < (n >> 4); u ++) {
+		const uint16_t *g4, *g2;
+		mq_vec v0, v1, lo, hi;
+
+		g2 = iGMb + (n >> 2) + 4 * u;
+		g4 = iGMb + (n >> 3) + 2 * u;
+		v0 = mq_vec_load(a + 16 * u);
+		v1 = mq_vec_load(a + 16 * u + 8);
+
+		lo = mq_vec_shuffle(v0, v1, 0, 2, 4, 6, 8, 10, 12, 14);
+		hi = mq_vec_shuffle(v0, v1, 1, 3, 5, 7, 9, 11, 13, 15);
+		v0 = mq_vec_add(lo, hi);
+		v1 = mq_vec_montymul(mq_vec_sub(lo, hi),
+							 mq_vec_load(iGMb + (n >> 1) + 8 * u));
+
+		lo = mq_vec_shuffle(v0, v1, 0, 8, 2, 10, 4, 12, 6, 14);
+		hi = mq_vec_shuffle(v0, v1, 1, 9, 3, 11, 5, 13, 7, 15);
+		v0 = mq_vec_add(lo, hi);
+		v1 = mq_vec_montymul(mq_vec_sub(lo, hi),
+							 mq_vec_set(g2[0], g2[1], g2[2], g2[3]));
+
+		lo = mq_vec_shuffle(v0, v1, 0, 1, 8, 9, 4, 5, 12, 13);
+		hi = mq_vec_shuffle(v0, v1, 2, 3, 10, 11, 6, 7, 14, 15);
+		v0 = mq_vec_add(lo, hi);
+		v1 = mq_vec_montymul(mq_vec_sub(lo, hi),
+							 mq_vec_set(g4[0], g4[0], g4[1], g4[1]));
+
+		mq_vec_store(a + 16 * u,
+					 mq_vec_shuffle(v0, v1, 0, 1, 2, 3, 8, 9, 10, 11));
+		mq_vec_store(a + 16 * u + 8,
+					 mq_vec_shuffle(v0, v1, 4, 5, 6, 7, 12, 13, 14, 15));
+	}
+
+	t = 8;
+	m = n >> 3;
+	while (m > 1) {
+		size_t hm, dt, i, j1;
+
+		hm = m >> 1;
+		dt = t << 1;
+		for (i = 0, j1 = 0; i < hm; i ++, j1 += dt) {
+			size_t j;
+			mq_vec s;
+
+			s = mq_vec_set(iGMb[hm + i], iGMb[hm + i],
+						   iGMb[hm + i], iGMb[hm + i]);
+			for (j = j1; j < j1 + t; j += 8) {
+				mq_vec x, y;
+
+				x = mq_vec_load(a + j);
+				y = mq_vec_load(a + j + t);
+				mq_vec_store(a + j, mq_vec_add(x, y));
+				mq_vec_store(a + j + t,
+							 mq_vec_montymul(mq_vec_sub(x, y), s));
+			}
+		}
+		t = dt;
+		m = hm;
+	}
+
+	ni = R;
+	for (m = n; m > 1; m >>= 1) {
+		ni = mq_rshift1(ni);
+	}
+	vni = mq_vec_set(ni, ni, ni, ni);
+	for (u = 0; u < n; u += 8) {
+		mq_vec_store(a + u, mq_vec_montymul(mq_vec_load(a + u), vni));
+	}
+}
+
+#endif
@@ -36,6 +36,7 @@
 #include <oqs/common.h>
 #include <stdint.h>
 #include <stddef.h>
+#include <string.h>
 
 /* ===================================================================== */
 /*
@@ -408,6 +409,10 @@ mq_montymul(uint32_t x, uint32_t y) {
 	return z;
 }
 
+#if defined(OQS_USE_VECTOR_EXTENSIONS)
+#include "falcon/vecext/mq_vecext.h"
+#endif
+
 /*
  * Compute the NTT on a ring element, binary case.
  *
@@ -417,6 +422,13 @@ OQS_API void
 FALCON_CLEAN_mq_NTT(uint16_t *a, unsigned logn) {
 	size_t n, t, m;
 
+#if defined(OQS_USE_VECTOR_EXTENSIONS)
+	if (logn >= 4) {
+		mq_NTT_vec(a, logn);
+		return;
+	}
+#endif
+
 	n = (size_t)1 << logn;
 	t = n;
 	for (m = 1; m < n; m <<= 1) {
@@ -452,6 +464,13 @@ FALCON_CLEAN_mq_iNTT(uint16_t *a, unsigned logn) {
 	size_t n, t, m;
 	uint32_t ni;
 
+#if defined(OQS_USE_VECTOR_EXTENSIONS)
+	if (logn >= 4) {
+		mq_iNTT_vec(a, logn);
+		return;
+	}
+#endif
+
 	n = (size_t)1 << logn;
 	t = 1;
 	m = n;
@@ -44,3 +44,26 @@ crypto_sign_verify(const unsigned char *sig, size_t siglen,
     return mayo_verify(MAYO_PARAMS, m, mlen, sig, pk);
 }
 
+int
+crypto_sign_verify_init(shake256incctx *state,
+                        const unsigned char *sig, size_t siglen) {
+    (void) sig;
+    if (siglen != CRYPTO_BYTES)
+        return -1;
+    shake256_inc_init(state);
+    return 0;
+}
+
+void
+crypto_sign_verify_update(shake256incctx *state,
+                          const unsigned char *m, size_t mlen) {
+    shake256_inc_absorb(state, m, mlen);
+}
+
+int
+crypto_sign_verify_final(shake256incctx *state,
+                         const unsigned char *sig, size_t siglen,
+                         const unsigned char *pk) {
+    (void) siglen;
+    return mayo_verify_hashed(MAYO_PARAMS, state, sig, pk);
+}
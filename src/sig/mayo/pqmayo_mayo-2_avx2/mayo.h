@@ -5,6 +5,7 @@
 
 #include <stdint.h>
 #include <stdlib.h>
+#include <fips202.h>
 
 #define F_TAIL_LEN 4
 #define F_TAIL_64                                                              \
@@ -438,5 +439,21 @@ int mayo_verify(const mayo_params_t *p, const unsigned char *m,
                 size_t mlen, const unsigned char *sig,
                 const unsigned char *pk);
 
+/**
+ * MAYO verify signature, for a message hashed into state.
+ *
+ * The caller has initialised state with shake256_inc_init() and absorbed
+ * the message; this function finalizes and releases state.
+ *
+ * @param[in] p Mayo parameter set
+ * @param[in] state SHAKE256 state that absorbed the message
+ * @param[in] sig Signature
+ * @param[in] pk Compacted public key
+ * @return int 0 if verification succeeded, 1 otherwise.
+ */
+#define mayo_verify_hashed MAYO_NAMESPACE(mayo_verify_hashed)
+int mayo_verify_hashed(const mayo_params_t *p, shake256incctx *state,
+                       const unsigned char *sig, const unsigned char *pk);
+
 #endif
 
@@ -617,6 +617,15 @@ int mayo_expand_pk(const mayo_params_t *p, const unsigned char *cpk,
 int mayo_verify(const mayo_params_t *p, const unsigned char *m,
                 size_t mlen, const unsigned char *sig,
                 const unsigned char *cpk) {
+    shake256incctx state;
+
+    shake256_inc_init(&state);
+    shake256_inc_absorb(&state, m, mlen);
+    return mayo_verify_hashed(p, &state, sig, cpk);
+}
+
+int mayo_verify_hashed(const mayo_params_t *p, shake256incctx *state,
+                       const unsigned char *sig, const unsigned char *cpk) {
     unsigned char tEnc[M_BYTES_MAX];
     unsigned char t[M_MAX];
     unsigned char y[2 * M_MAX] = {0}; // extra space for reduction mod f(X)
@@ -632,6 +641,11 @@ int mayo_verify(const mayo_params_t *p, const unsigned char *m,
     const int param_digest_bytes = PARAM_digest_bytes(p);
     const int param_salt_bytes = PARAM_salt_bytes(p);
 
+    // hash m; done first so that state is released on every path
+    shake256_inc_finalize(state);
+    shake256_inc_squeeze(tmp, param_digest_bytes, state);
+    shake256_inc_ctx_release(state);
+
     int ret = mayo_expand_pk(p, cpk, pk);
     if (ret != MAYO_OK) {
         return MAYO_ERR;
@@ -653,9 +667,6 @@ int mayo_verify(const mayo_params_t *p, const unsigned char *m,
     }
 #endif
 
-    // hash m
-    shake256(tmp, param_digest_bytes, m, mlen);
-
     // compute t
     memcpy(tmp + param_digest_bytes, sig + param_sig_bytes - param_salt_bytes,
            param_salt_bytes);
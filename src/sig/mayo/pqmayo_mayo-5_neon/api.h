@@ -39,5 +39,25 @@ crypto_sign_verify(const unsigned char *sig, size_t siglen,
                    const unsigned char *m, size_t mlen,
                    const unsigned char *pk);
 
+/* Streaming form of crypto_sign_verify(): _init() checks the signature
+ * length and initialises state, _update() absorbs the next chunk of the
+ * message, and _final() verifies and releases state. If _init() fails,
+ * state is not allocated. */
+#define crypto_sign_verify_init MAYO_NAMESPACE(crypto_sign_verify_init)
+int
+crypto_sign_verify_init(shake256incctx *state,
+                        const unsigned char *sig, size_t siglen);
+
+#define crypto_sign_verify_update MAYO_NAMESPACE(crypto_sign_verify_update)
+void
+crypto_sign_verify_update(shake256incctx *state,
+                          const unsigned char *m, size_t mlen);
+
+#define crypto_sign_verify_final MAYO_NAMESPACE(crypto_sign_verify_final)
+int
+crypto_sign_verify_final(shake256incctx *state,
+                         const unsigned char *sig, size_t siglen,
+                         const unsigned char *pk);
+
 #endif /* api_h */
 
@@ -0,0 +1,273 @@
+// SPDX-License-Identifier: MIT
+
+/*
+ * ML-DSA signing and verification with precomputed keys, on top of the
+ * pqcrystals reference implementation.
+ *
+ * This file is compiled into each ml_dsa_*_ref and ml_dsa_*_aarch64 object
+ * library (with the parameter set selected by DILITHIUM_MODE) and backs
+ * OQS_SIG_key_import().
+ * Every reference signature or verification starts by unpacking the key,
+ * expanding the K x L matrix A from rho with SHAKE128 and transforming the
+ * key vectors to the NTT domain; for a verification this is more than half
+ * of the work. Here that is done once per key:
+ *
+ * - a public key becomes A, NTT(t1 * 2^D) and tr = H(pk);
+ * - a secret key becomes A, NTT(s1), NTT(s2), NTT(t0), key and tr.
+ *
+ * The signing and verification procedures are otherwise those of sign.c, so
+ * outputs are byte-for-byte identical to the reference implementation.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "params.h"
+#include "packing.h"
+#include "polyvec.h"
+#include "poly.h"
+#include "randombytes.h"
+#include "symmetric.h"
+#include "fips202.h"
+
+#include "sign_keycache.h"
+
+typedef struct {
+	polyvecl mat[K];
+	polyveck t1hat;
+	uint8_t tr[TRBYTES];
+} expanded_pk;
+
+typedef struct {
+	polyvecl mat[K];
+	polyvecl s1hat;
+	polyveck s2hat;
+	polyveck t0hat;
+	uint8_t key[SEEDBYTES];
+	uint8_t tr[TRBYTES];
+} expanded_sk;
+
+size_t crypto_sign_expanded_pk_bytes(void) {
+	return sizeof(expanded_pk);
+}
+
+size_t crypto_sign_expanded_sk_bytes(void) {
+	return sizeof(expanded_sk);
+}
+
+void crypto_sign_expand_pk(void *xpk, const uint8_t *pk) {
+	expanded_pk *x = (expanded_pk *) xpk;
+	uint8_t rho[SEEDBYTES];
+
+	unpack_pk(rho, &x->t1hat, pk);
+	polyvec_matrix_expand(x->mat, rho);
+	polyveck_shiftl(&x->t1hat);
+	polyveck_ntt(&x->t1hat);
+	shake256(x->tr, TRBYTES, pk, CRYPTO_PUBLICKEYBYTES);
+}
+
+void crypto_sign_expand_sk(void *xsk, const uint8_t *sk) {
+	expanded_sk *x = (expanded_sk *) xsk;
+	uint8_t rho[SEEDBYTES];
+
+	unpack_sk(rho, x->tr, x->key, &x->t0hat, &x->s1hat, &x->s2hat, sk);
+	polyvec_matrix_expand(x->mat, rho);
+	polyvecl_ntt(&x->s1hat);
+	polyveck_ntt(&x->s2hat);
+	polyveck_ntt(&x->t0hat);
+}
+
+/* pre = (0, ctxlen, ctx), as in crypto_sign_signature / crypto_sign_verify */
+static int prepare_prefix(uint8_t pre[257], const uint8_t *ctx, size_t ctxlen) {
+	size_t i;
+
+	if (ctxlen > 255) {
+		return -1;
+	}
+	pre[0] = 0;
+	pre[1] = (uint8_t) ctxlen;
+	for (i = 0; i < ctxlen; i++) {
+		pre[2 + i] = ctx[i];
+	}
+	return 0;
+}
+
+int crypto_sign_signature_expanded(uint8_t *sig, size_t *siglen,
+                                   const uint8_t *m, size_t mlen,
+                                   const uint8_t *ctx, size_t ctxlen,
+                                   const void *xsk) {
+	const expanded_sk *x = (const expanded_sk *) xsk;
+	unsigned int n;
+	uint8_t pre[257];
+	uint8_t rnd[RNDBYTES];
+	uint8_t mu[CRHBYTES], rhoprime[CRHBYTES];
+	uint16_t nonce = 0;
+	polyvecl y, z;
+	polyveck w1, w0, h;
+	poly cp;
+	shake256incctx state;
+
+	if (prepare_prefix(pre, ctx, ctxlen)) {
+		return -1;
+	}
+
+#ifdef DILITHIUM_RANDOMIZED_SIGNING
+	randombytes(rnd, RNDBYTES);
+#else
+	for (n = 0; n < RNDBYTES; n++) {
+		rnd[n] = 0;
+	}
+#endif
+
+	/* Compute mu = CRH(tr, pre, msg) */
+	shake256_inc_init(&state);
+	shake256_inc_absorb(&state, x->tr, TRBYTES);
+	shake256_inc_absorb(&state, pre, 2 + ctxlen);
+	shake256_inc_absorb(&state, m, mlen);
+	shake256_inc_finalize(&state);
+	shake256_inc_squeeze(mu, CRHBYTES, &state);
+
+	/* Compute rhoprime = CRH(key, rnd, mu) */
+	shake256_inc_ctx_reset(&state);
+	shake256_inc_absorb(&state, x->key, SEEDBYTES);
+	shake256_inc_absorb(&state, rnd, RNDBYTES);
+	shake256_inc_absorb(&state, mu, CRHBYTES);
+	shake256_inc_finalize(&state);
+	shake256_inc_squeeze(rhoprime, CRHBYTES, &state);
+
+rej:
+	/* Sample intermediate vector y */
+	polyvecl_uniform_gamma1(&y, rhoprime, nonce++);
+
+	/* Matrix-vector multiplication */
+	z = y;
+	polyvecl_ntt(&z);
+	polyvec_matrix_pointwise_montgomery(&w1, x->mat, &z);
+	polyveck_reduce(&w1);
+	polyveck_invntt_tomont(&w1);
+
+	/* Decompose w and call the random oracle */
+	polyveck_caddq(&w1);
+	polyveck_decompose(&w1, &w0, &w1);
+	polyveck_pack_w1(sig, &w1);
+
+	shake256_inc_ctx_reset(&state);
+	shake256_inc_absorb(&state, mu, CRHBYTES);
+	shake256_inc_absorb(&state, sig, K * POLYW1_PACKEDBYTES);
+	shake256_inc_finalize(&state);
+	shake256_inc_squeeze(sig, CTILDEBYTES, &state);
+	poly_challenge(&cp, sig);
+	poly_ntt(&cp);
+
+	/* Compute z, reject if it reveals secret */
+	polyvecl_pointwise_poly_montgomery(&z, &cp, &x->s1hat);
+	polyvecl_invntt_tomont(&z);
+	polyvecl_add(&z, &z, &y);
+	polyvecl_reduce(&z);
+	if (polyvecl_chknorm(&z, GAMMA1 - BETA)) {
+		goto rej;
+	}
+
+	/* Check that subtracting cs2 does not change high bits of w and low bits
+	 * do not reveal secret information */
+	polyveck_pointwise_poly_montgomery(&h, &cp, &x->s2hat);
+	polyveck_invntt_tomont(&h);
+	polyveck_sub(&w0, &w0, &h);
+	polyveck_reduce(&w0);
+	if (polyveck_chknorm(&w0, GAMMA2 - BETA)) {
+		goto rej;
+	}
+
+	/* Compute hints for w1 */
+	polyveck_pointwise_poly_montgomery(&h, &cp, &x->t0hat);
+	polyveck_invntt_tomont(&h);
+	polyveck_reduce(&h);
+	if (polyveck_chknorm(&h, GAMMA2)) {
+		goto rej;
+	}
+
+	polyveck_add(&w0, &w0, &h);
+	n = polyveck_make_hint(&h, &w0, &w1);
+	if (n > OMEGA) {
+		goto rej;
+	}
+
+	shake256_inc_ctx_release(&state);
+
+	/* Write signature */
+	pack_sig(sig, sig, &z, &h);
+	*siglen = CRYPTO_BYTES;
+	return 0;
+}
+
+int crypto_sign_verify_expanded(const uint8_t *sig, size_t siglen,
+                                const uint8_t *m, size_t mlen,
+                                const uint8_t *ctx, size_t ctxlen,
+                                const void *xpk) {
+	const expanded_pk *x = (const expanded_pk *) xpk;
+	unsigned int i;
+	uint8_t pre[257];
+	uint8_t buf[K * POLYW1_PACKEDBYTES];
+	uint8_t mu[CRHBYTES];
+	uint8_t c[CTILDEBYTES];
+	uint8_t c2[CTILDEBYTES];
+	poly cp;
+	polyvecl z;
+	polyveck t1, w1, h;
+	shake256incctx state;
+
+	if (prepare_prefix(pre, ctx, ctxlen)) {
+		return -1;
+	}
+	if (siglen != CRYPTO_BYTES) {
+		return -1;
+	}
+
+	if (unpack_sig(c, &z, &h, sig)) {
+		return -1;
+	}
+	if (polyvecl_chknorm(&z, GAMMA1 - BETA)) {
+		return -1;
+	}
+
+	/* Compute CRH(H(rho, t1), pre, msg) */
+	shake256_inc_init(&state);
+	shake256_inc_absorb(&state, x->tr, TRBYTES);
+	shake256_inc_absorb(&state, pre, 2 + ctxlen);
+	shake256_inc_absorb(&state, m, mlen);
+	shake256_inc_finalize(&state);
+	shake256_inc_squeeze(mu, CRHBYTES, &state);
+
+	/* Matrix-vector multiplication; compute Az - c2^dt1 */
+	poly_challenge(&cp, c);
+
+	polyvecl_ntt(&z);
+	polyvec_matrix_pointwise_montgomery(&w1, x->mat, &z);
+
+	poly_ntt(&cp);
+	polyveck_pointwise_poly_montgomery(&t1, &cp, &x->t1hat);
+
+	polyveck_sub(&w1, &w1, &t1);
+	polyveck_reduce(&w1);
+	polyveck_invntt_tomont(&w1);
+
+	/* Reconstruct w1 */
+	polyveck_caddq(&w1);
+	polyveck_use_hint(&w1, &w1, &h);
+	polyveck_pack_w1(buf, &w1);
+
+	/* Call random oracle and verify challenge */
+	shake256_inc_ctx_reset(&state);
+	shake256_inc_absorb(&state, mu, CRHBYTES);
+	shake256_inc_absorb(&state, buf, K * POLYW1_PACKEDBYTES);
+	shake256_inc_finalize(&state);
+	shake256_inc_squeeze(c2, CTILDEBYTES, &state);
+	shake256_inc_ctx_release(&state);
+	for (i = 0; i < CTILDEBYTES; ++i) {
+		if (c[i] != c2[i]) {
+			return -1;
+		}
+	}
+
+	return 0;
+}
@@ -0,0 +1,34 @@
+// SPDX-License-Identifier: MIT
+
+#ifndef SIGN_KEYCACHE_H
+#define SIGN_KEYCACHE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "params.h"
+
+#define crypto_sign_expanded_pk_bytes DILITHIUM_NAMESPACE(expanded_pk_bytes)
+size_t crypto_sign_expanded_pk_bytes(void);
+
+#define crypto_sign_expanded_sk_bytes DILITHIUM_NAMESPACE(expanded_sk_bytes)
+size_t crypto_sign_expanded_sk_bytes(void);
+
+#define crypto_sign_expand_pk DILITHIUM_NAMESPACE(expand_pk)
+void crypto_sign_expand_pk(void *xpk, const uint8_t *pk);
+
+#define crypto_sign_expand_sk DILITHIUM_NAMESPACE(expand_sk)
+void crypto_sign_expand_sk(void *xsk, const uint8_t *sk);
+
+#define crypto_sign_signature_expanded DILITHIUM_NAMESPACE(signature_expanded)
+int crypto_sign_signature_expanded(uint8_t *sig, size_t *siglen,
+                                   const uint8_t *m, size_t mlen,
+                                   const uint8_t *ctx, size_t ctxlen,
+                                   const void *xsk);
+
+#define crypto_sign_verify_expanded DILITHIUM_NAMESPACE(verify_expanded)
+int crypto_sign_verify_expanded(const uint8_t *sig, size_t siglen,
+                                const uint8_t *m, size_t mlen,
+                                const uint8_t *ctx, size_t ctxlen,
+                                const void *xpk);
+
+#endif
@@ -0,0 +1,341 @@
+// SPDX-License-Identifier: MIT
+
+/*
+ * ML-DSA signing and verification with precomputed keys, on top of the
+ * pqcrystals AVX2 implementation.
+ *
+ * This file is compiled into each ml_dsa_*_avx2 object library and provides
+ * the functions of sign_keycache.h for that backend. The precomputed values
+ * are those of sign_keycache.c, but in the AVX2 representation: polynomials
+ * are 32-byte aligned vectors and the NTT domain uses the AVX2 coefficient
+ * order, so a key expanded here can only be used with the functions below.
+ * OQS_MEM_malloc() does not guarantee 32-byte alignment, so the expanded
+ * sizes include room to align the structures inside the buffer.
+ *
+ * The signing and verification procedures are otherwise those of the AVX2
+ * sign.c, so outputs are byte-for-byte identical to it.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "align.h"
+#include "params.h"
+#include "packing.h"
+#include "polyvec.h"
+#include "poly.h"
+#include "randombytes.h"
+#include "symmetric.h"
+#include "fips202.h"
+
+#include "sign_keycache.h"
+
+#define EXPANDED_ALIGN 32
+
+typedef struct {
+	polyvecl mat[K];
+	polyveck t1hat;
+	uint8_t tr[TRBYTES];
+} expanded_pk;
+
+typedef struct {
+	polyvecl mat[K];
+	polyvecl s1hat;
+	polyveck s2hat;
+	polyveck t0hat;
+	uint8_t key[SEEDBYTES];
+	uint8_t tr[TRBYTES];
+} expanded_sk;
+
+static void *align_expanded(const void *x) {
+	return (void *) (((uintptr_t) x + EXPANDED_ALIGN - 1) & ~(uintptr_t) (EXPANDED_ALIGN - 1));
+}
+
+size_t crypto_sign_expanded_pk_bytes(void) {
+	return sizeof(expanded_pk) + EXPANDED_ALIGN - 1;
+}
+
+size_t crypto_sign_expanded_sk_bytes(void) {
+	return sizeof(expanded_sk) + EXPANDED_ALIGN - 1;
+}
+
+void crypto_sign_expand_pk(void *xpk, const uint8_t *pk) {
+	expanded_pk *x = align_expanded(xpk);
+	uint8_t rho[SEEDBYTES];
+
+	unpack_pk(rho, &x->t1hat, pk);
+	polyvec_matrix_expand(x->mat, rho);
+	polyveck_shiftl(&x->t1hat);
+	polyveck_ntt(&x->t1hat);
+	shake256(x->tr, TRBYTES, pk, CRYPTO_PUBLICKEYBYTES);
+}
+
+void crypto_sign_expand_sk(void *xsk, const uint8_t *sk) {
+	expanded_sk *x = align_expanded(xsk);
+	uint8_t rho[SEEDBYTES];
+
+	unpack_sk(rho, x->tr, x->key, &x->t0hat, &x->s1hat, &x->s2hat, sk);
+	polyvec_matrix_expand(x->mat, rho);
+	polyvecl_ntt(&x->s1hat);
+	polyveck_ntt(&x->s2hat);
+	polyveck_ntt(&x->t0hat);
+}
+
+/* pre = (0, ctxlen, ctx), as in crypto_sign_signature / crypto_sign_verify */
+static int prepare_prefix(uint8_t pre[257], const uint8_t *ctx, size_t ctxlen) {
+	if (ctxlen > 255) {
+		return -1;
+	}
+	pre[0] = 0;
+	pre[1] = (uint8_t) ctxlen;
+	memcpy(&pre[2], ctx, ctxlen);
+	return 0;
+}
+
+/* One iteration of the rejection sampling loop of sign.c; 0 if accepted. */
+static int sign_attempt(uint8_t *sig, const expanded_sk *x, const uint8_t mu[CRHBYTES],
+                        const uint8_t rhoprime[CRHBYTES], uint64_t attempt) {
+	unsigned int i, n, pos;
+	uint8_t hintbuf[N];
+	uint8_t *hint = sig + CTILDEBYTES + L * POLYZ_PACKEDBYTES;
+	uint64_t nonce = L * attempt;
+	polyvecl z;
+	polyveck w1;
+	poly c, tmp;
+	union {
+		polyvecl y;
+		polyveck w0;
+	} tmpv;
+	shake256incctx state;
+
+	/* Sample intermediate vector y */
+#if L == 4
+	poly_uniform_gamma1_4x(&z.vec[0], &z.vec[1], &z.vec[2], &z.vec[3],
+	                       rhoprime, nonce, nonce + 1, nonce + 2, nonce + 3);
+#elif L == 5
+	poly_uniform_gamma1_4x(&z.vec[0], &z.vec[1], &z.vec[2], &z.vec[3],
+	                       rhoprime, nonce, nonce + 1, nonce + 2, nonce + 3);
+	poly_uniform_gamma1(&z.vec[4], rhoprime, nonce + 4);
+#elif L == 7
+	poly_uniform_gamma1_4x(&z.vec[0], &z.vec[1], &z.vec[2], &z.vec[3],
+	                       rhoprime, nonce, nonce + 1, nonce + 2, nonce + 3);
+	poly_uniform_gamma1_4x(&z.vec[4], &z.vec[5], &z.vec[6], &tmp,
+	                       rhoprime, nonce + 4, nonce + 5, nonce + 6, 0);
+#else
+#error
+#endif
+
+	/* Matrix-vector product */
+	tmpv.y = z;
+	polyvecl_ntt(&tmpv.y);
+	polyvec_matrix_pointwise_montgomery(&w1, x->mat, &tmpv.y);
+	polyveck_invntt_tomont(&w1);
+
+	/* Decompose w and call the random oracle */
+	polyveck_caddq(&w1);
+	polyveck_decompose(&w1, &tmpv.w0, &w1);
+	polyveck_pack_w1(sig, &w1);
+
+	shake256_inc_init(&state);
+	shake256_inc_absorb(&state, mu, CRHBYTES);
+	shake256_inc_absorb(&state, sig, K * POLYW1_PACKEDBYTES);
+	shake256_inc_finalize(&state);
+	shake256_inc_squeeze(sig, CTILDEBYTES, &state);
+	shake256_inc_ctx_release(&state);
+	poly_challenge(&c, sig);
+	poly_ntt(&c);
+
+	/* Compute z, reject if it reveals secret */
+	for (i = 0; i < L; i++) {
+		poly_pointwise_montgomery(&tmp, &c, &x->s1hat.vec[i]);
+		poly_invntt_tomont(&tmp);
+		poly_add(&z.vec[i], &z.vec[i], &tmp);
+		poly_reduce(&z.vec[i]);
+		if (poly_chknorm(&z.vec[i], GAMMA1 - BETA)) {
+			return -1;
+		}
+	}
+
+	/* Zero hint vector in signature */
+	pos = 0;
+	memset(hint, 0, OMEGA);
+
+	for (i = 0; i < K; i++) {
+		/* Check that subtracting cs2 does not change high bits of w and low
+		 * bits do not reveal secret information */
+		poly_pointwise_montgomery(&tmp, &c, &x->s2hat.vec[i]);
+		poly_invntt_tomont(&tmp);
+		poly_sub(&tmpv.w0.vec[i], &tmpv.w0.vec[i], &tmp);
+		poly_reduce(&tmpv.w0.vec[i]);
+		if (poly_chknorm(&tmpv.w0.vec[i], GAMMA2 - BETA)) {
+			return -1;
+		}
+
+		/* Compute hints */
+		poly_pointwise_montgomery(&tmp, &c, &x->t0hat.vec[i]);
+		poly_invntt_tomont(&tmp);
+		poly_reduce(&tmp);
+		if (poly_chknorm(&tmp, GAMMA2)) {
+			return -1;
+		}
+
+		poly_add(&tmpv.w0.vec[i], &tmpv.w0.vec[i], &tmp);
+		n = poly_make_hint(hintbuf, &tmpv.w0.vec[i], &w1.vec[i]);
+		if (pos + n > OMEGA) {
+			return -1;
+		}
+
+		/* Store hints in signature */
+		memcpy(&hint[pos], hintbuf, n);
+		hint[OMEGA + i] = pos = pos + n;
+	}
+
+	/* Pack z into signature */
+	for (i = 0; i < L; i++) {
+		polyz_pack(sig + CTILDEBYTES + i * POLYZ_PACKEDBYTES, &z.vec[i]);
+	}
+
+	return 0;
+}
+
+int crypto_sign_signature_expanded(uint8_t *sig, size_t *siglen,
+                                   const uint8_t *m, size_t mlen,
+                                   const uint8_t *ctx, size_t ctxlen,
+                                   const void *xsk) {
+	const expanded_sk *x = align_expanded(xsk);
+	uint8_t pre[257];
+	uint8_t rnd[RNDBYTES];
+	uint8_t mu[CRHBYTES], rhoprime[CRHBYTES];
+	uint64_t nonce;
+	shake256incctx state;
+
+	if (prepare_prefix(pre, ctx, ctxlen)) {
+		return -1;
+	}
+
+#ifdef DILITHIUM_RANDOMIZED_SIGNING
+	randombytes(rnd, RNDBYTES);
+#else
+	memset(rnd, 0, RNDBYTES);
+#endif
+
+	/* Compute mu = CRH(tr, pre, msg) */
+	shake256_inc_init(&state);
+	shake256_inc_absorb(&state, x->tr, TRBYTES);
+	shake256_inc_absorb(&state, pre, 2 + ctxlen);
+	shake256_inc_absorb(&state, m, mlen);
+	shake256_inc_finalize(&state);
+	shake256_inc_squeeze(mu, CRHBYTES, &state);
+
+	/* Compute rhoprime = CRH(key, rnd, mu) */
+	shake256_inc_ctx_reset(&state);
+	shake256_inc_absorb(&state, x->key, SEEDBYTES);
+	shake256_inc_absorb(&state, rnd, RNDBYTES);
+	shake256_inc_absorb(&state, mu, CRHBYTES);
+	shake256_inc_finalize(&state);
+	shake256_inc_squeeze(rhoprime, CRHBYTES, &state);
+	shake256_inc_ctx_release(&state);
+
+	for (nonce = 0; sign_attempt(sig, x, mu, rhoprime, nonce); nonce++)
+		;
+
+	*siglen = CRYPTO_BYTES;
+	return 0;
+}
+
+int crypto_sign_verify_expanded(const uint8_t *sig, size_t siglen,
+                                const uint8_t *m, size_t mlen,
+                                const uint8_t *ctx, size_t ctxlen,
+                                const void *xpk) {
+	const expanded_pk *x = align_expanded(xpk);
+	unsigned int i, j, pos = 0;
+	uint8_t pre[257];
+	/* polyw1_pack writes additional 14 bytes */
+	ALIGNED_UINT8(K * POLYW1_PACKEDBYTES + 14) buf;
+	uint8_t mu[CRHBYTES];
+	const uint8_t *hint = sig + CTILDEBYTES + L * POLYZ_PACKEDBYTES;
+	polyvecl z;
+	poly c, w1, h;
+	shake256incctx state;
+
+	if (prepare_prefix(pre, ctx, ctxlen)) {
+		return -1;
+	}
+	if (siglen != CRYPTO_BYTES) {
+		return -1;
+	}
+
+	/* Compute CRH(H(rho, t1), pre, msg) */
+	shake256_inc_init(&state);
+	shake256_inc_absorb(&state, x->tr, TRBYTES);
+	shake256_inc_absorb(&state, pre, 2 + ctxlen);
+	shake256_inc_absorb(&state, m, mlen);
+	shake256_inc_finalize(&state);
+	shake256_inc_squeeze(mu, CRHBYTES, &state);
+
+	/* Expand challenge */
+	poly_challenge(&c, sig);
+	poly_ntt(&c);
+
+	/* Unpack z; shortness follows from unpacking */
+	for (i = 0; i < L; i++) {
+		polyz_unpack(&z.vec[i], sig + CTILDEBYTES + i * POLYZ_PACKEDBYTES);
+		poly_ntt(&z.vec[i]);
+	}
+
+	for (i = 0; i < K; i++) {
+		/* Compute i-th row of Az - c2^Dt1 */
+		polyvecl_pointwise_acc_montgomery(&w1, &x->mat[i], &z);
+
+		poly_pointwise_montgomery(&h, &c, &x->t1hat.vec[i]);
+
+		poly_sub(&w1, &w1, &h);
+		poly_reduce(&w1);
+		poly_invntt_tomont(&w1);
+
+		/* Get hint polynomial and reconstruct w1 */
+		memset(h.vec, 0, sizeof(poly));
+		if (hint[OMEGA + i] < pos || hint[OMEGA + i] > OMEGA) {
+			shake256_inc_ctx_release(&state);
+			return -1;
+		}
+
+		for (j = pos; j < hint[OMEGA + i]; ++j) {
+			/* Coefficients are ordered for strong unforgeability */
+			if (j > pos && hint[j] <= hint[j - 1]) {
+				shake256_inc_ctx_release(&state);
+				return -1;
+			}
+			h.coeffs[hint[j]] = 1;
+		}
+		pos = hint[OMEGA + i];
+
+		poly_caddq(&w1);
+		poly_use_hint(&w1, &w1, &h);
+		polyw1_pack(buf.coeffs + i * POLYW1_PACKEDBYTES, &w1);
+	}
+
+	/* Extra indices are zero for strong unforgeability */
+	for (j = pos; j < OMEGA; ++j) {
+		if (hint[j]) {
+			shake256_inc_ctx_release(&state);
+			return -1;
+		}
+	}
+
+	/* Call random oracle and verify challenge */
+	shake256_inc_ctx_reset(&state);
+	shake256_inc_absorb(&state, mu, CRHBYTES);
+	shake256_inc_absorb(&state, buf.coeffs, K * POLYW1_PACKEDBYTES);
+	shake256_inc_finalize(&state);
+	shake256_inc_squeeze(buf.coeffs, CTILDEBYTES, &state);
+	shake256_inc_ctx_release(&state);
+	for (i = 0; i < CTILDEBYTES; ++i) {
+		if (buf.coeffs[i] != sig[i]) {
+			return -1;
+		}
+	}
+
+	return 0;
+}
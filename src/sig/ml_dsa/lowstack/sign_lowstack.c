@@ -0,0 +1,433 @@
+// SPDX-License-Identifier: MIT
+
+/*
+ * Low-stack ML-DSA key generation, signing and verification on top of the
+ * pqcrystals reference implementation.
+ *
+ * This file is compiled into each ml_dsa_*_ref object library (with the
+ * parameter set selected by DILITHIUM_MODE) when OQS_ML_DSA_LOW_STACK is ON.
+ * Instead of materialising the K x L matrix A and the vectors s1, s2, t0, y,
+ * z, w0, w1 and h, everything is processed one polynomial at a time:
+ *
+ * - A is expanded element by element from rho and consumed immediately, one
+ *   row of A*v at a time;
+ * - s1, s2 and t0 are unpacked from the packed secret key when needed, and
+ *   y is resampled from rhoprime;
+ * - w1 is absorbed into the challenge hash row by row, z is packed straight
+ *   into the signature, and the hint is encoded into the signature as it is
+ *   produced.
+ *
+ * At most four polynomials (4 KiB) are live at any time, independent of the
+ * parameter set, compared with tens of KiB for the reference code. The price
+ * is recomputing rows of A*y, so signing is several times slower.
+ *
+ * Outputs are byte-for-byte identical to the reference implementation: the
+ * same values are computed in the same order, and a signing attempt is
+ * accepted under exactly the same conditions.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "params.h"
+#include "poly.h"
+#include "randombytes.h"
+#include "symmetric.h"
+#include "fips202.h"
+
+#include "sign_lowstack.h"
+
+#define SK_S1_OFFSET (2 * SEEDBYTES + TRBYTES)
+#define SK_S2_OFFSET (SK_S1_OFFSET + L * POLYETA_PACKEDBYTES)
+#define SK_T0_OFFSET (SK_S2_OFFSET + K * POLYETA_PACKEDBYTES)
+#define SIG_Z_OFFSET CTILDEBYTES
+#define SIG_H_OFFSET (SIG_Z_OFFSET + L * POLYZ_PACKEDBYTES)
+
+/*
+ * Computes row k of A*v in the NTT domain, i.e.
+ * acc = sum_l A[k][l] o NTT(v_l), where v_l is produced by next_v.
+ * tmp and v are scratch polynomials.
+ */
+typedef void (*lowstack_vec_fn)(poly *v, unsigned int l, const void *arg);
+
+static void matrix_row_pointwise(poly *acc, poly *tmp, poly *v, const uint8_t rho[SEEDBYTES], unsigned int k,
+                                 lowstack_vec_fn next_v, const void *arg) {
+	unsigned int l;
+
+	for (l = 0; l < L; ++l) {
+		poly_uniform(tmp, rho, (uint16_t) ((k << 8) + l));
+		next_v(v, l, arg);
+		poly_ntt(v);
+		if (l == 0) {
+			poly_pointwise_montgomery(acc, tmp, v);
+		} else {
+			poly_pointwise_montgomery(tmp, tmp, v);
+			poly_add(acc, acc, tmp);
+		}
+	}
+}
+
+static void next_s1_packed(poly *v, unsigned int l, const void *arg) {
+	polyeta_unpack(v, (const uint8_t *) arg + l * POLYETA_PACKEDBYTES);
+}
+
+static void next_z_packed(poly *v, unsigned int l, const void *arg) {
+	polyz_unpack(v, (const uint8_t *) arg + l * POLYZ_PACKEDBYTES);
+}
+
+struct y_source {
+	const uint8_t *rhoprime;
+	uint16_t nonce;
+};
+
+static void next_y(poly *v, unsigned int l, const void *arg) {
+	const struct y_source *src = (const struct y_source *) arg;
+	poly_uniform_gamma1(v, src->rhoprime, (uint16_t) (L * src->nonce + l));
+}
+
+int crypto_sign_keypair_internal_lowstack(uint8_t *pk, uint8_t *sk, const uint8_t seed[SEEDBYTES]) {
+	unsigned int i;
+	uint8_t seedbuf[2 * SEEDBYTES + CRHBYTES];
+	const uint8_t *rho, *rhoprime, *key;
+	poly acc, tmp, v;
+
+	for (i = 0; i < SEEDBYTES; ++i) {
+		seedbuf[i] = seed[i];
+	}
+	seedbuf[SEEDBYTES + 0] = K;
+	seedbuf[SEEDBYTES + 1] = L;
+	shake256(seedbuf, 2 * SEEDBYTES + CRHBYTES, seedbuf, SEEDBYTES + 2);
+	rho = seedbuf;
+	rhoprime = rho + SEEDBYTES;
+	key = rhoprime + CRHBYTES;
+
+	for (i = 0; i < SEEDBYTES; ++i) {
+		pk[i] = rho[i];
+		sk[i] = rho[i];
+		sk[SEEDBYTES + i] = key[i];
+	}
+
+	/* Sample s1 and s2 straight into the secret key */
+	for (i = 0; i < L; ++i) {
+		poly_uniform_eta(&v, rhoprime, (uint16_t) i);
+		polyeta_pack(sk + SK_S1_OFFSET + i * POLYETA_PACKEDBYTES, &v);
+	}
+	for (i = 0; i < K; ++i) {
+		poly_uniform_eta(&v, rhoprime, (uint16_t) (L + i));
+		polyeta_pack(sk + SK_S2_OFFSET + i * POLYETA_PACKEDBYTES, &v);
+	}
+
+	/* t = A*s1 + s2, one row at a time */
+	for (i = 0; i < K; ++i) {
+		matrix_row_pointwise(&acc, &tmp, &v, rho, i, next_s1_packed, sk + SK_S1_OFFSET);
+		poly_reduce(&acc);
+		poly_invntt_tomont(&acc);
+		polyeta_unpack(&v, sk + SK_S2_OFFSET + i * POLYETA_PACKEDBYTES);
+		poly_add(&acc, &acc, &v);
+		poly_caddq(&acc);
+		poly_power2round(&acc, &tmp, &acc);
+		polyt1_pack(pk + SEEDBYTES + i * POLYT1_PACKEDBYTES, &acc);
+		polyt0_pack(sk + SK_T0_OFFSET + i * POLYT0_PACKEDBYTES, &tmp);
+	}
+
+	/* tr = H(pk) */
+	shake256(sk + 2 * SEEDBYTES, TRBYTES, pk, CRYPTO_PUBLICKEYBYTES);
+
+	OQS_MEM_cleanse(seedbuf, sizeof(seedbuf));
+	OQS_MEM_cleanse(&v, sizeof(v));
+	OQS_MEM_cleanse(&tmp, sizeof(tmp));
+	return 0;
+}
+
+int crypto_sign_keypair_lowstack(uint8_t *pk, uint8_t *sk) {
+	uint8_t seed[SEEDBYTES];
+	int ret;
+
+	randombytes(seed, SEEDBYTES);
+	ret = crypto_sign_keypair_internal_lowstack(pk, sk, seed);
+	OQS_MEM_cleanse(seed, SEEDBYTES);
+	return ret;
+}
+
+static int crypto_sign_signature_internal_lowstack(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen,
+        const uint8_t *pre, size_t prelen, const uint8_t rnd[RNDBYTES],
+        const uint8_t *sk) {
+	unsigned int i, j, n, cnt;
+	uint8_t seedbuf[TRBYTES + 2 * CRHBYTES];
+	uint8_t w1_packed[POLYW1_PACKEDBYTES];
+	const uint8_t *rho, *key, *tr;
+	uint8_t *mu, *rhoprime, *hint;
+	struct y_source ysrc;
+	poly acc, tmp, v, cp;
+	shake256incctx state;
+
+	rho = sk;
+	key = sk + SEEDBYTES;
+	tr = sk + 2 * SEEDBYTES;
+	mu = seedbuf;
+	rhoprime = mu + CRHBYTES;
+	hint = sig + SIG_H_OFFSET;
+
+	/* Compute mu = CRH(tr, pre, msg) */
+	shake256_inc_init(&state);
+	shake256_inc_absorb(&state, tr, TRBYTES);
+	shake256_inc_absorb(&state, pre, prelen);
+	shake256_inc_absorb(&state, m, mlen);
+	shake256_inc_finalize(&state);
+	shake256_inc_squeeze(mu, CRHBYTES, &state);
+
+	/* Compute rhoprime = CRH(key, rnd, mu) */
+	shake256_inc_ctx_reset(&state);
+	shake256_inc_absorb(&state, key, SEEDBYTES);
+	shake256_inc_absorb(&state, rnd, RNDBYTES);
+	shake256_inc_absorb(&state, mu, CRHBYTES);
+	shake256_inc_finalize(&state);
+	shake256_inc_squeeze(rhoprime, CRHBYTES, &state);
+
+	ysrc.rhoprime = rhoprime;
+	ysrc.nonce = 0;
+
+rej:
+	/* Challenge c~ = H(mu, w1), absorbing w1 = HighBits(A*y) row by row */
+	shake256_inc_ctx_reset(&state);
+	shake256_inc_absorb(&state, mu, CRHBYTES);
+	for (i = 0; i < K; ++i) {
+		matrix_row_pointwise(&acc, &tmp, &v, rho, i, next_y, &ysrc);
+		poly_reduce(&acc);
+		poly_invntt_tomont(&acc);
+		poly_caddq(&acc);
+		poly_decompose(&acc, &tmp, &acc);
+		polyw1_pack(w1_packed, &acc);
+		shake256_inc_absorb(&state, w1_packed, POLYW1_PACKEDBYTES);
+	}
+	shake256_inc_finalize(&state);
+	shake256_inc_squeeze(sig, CTILDEBYTES, &state);
+	poly_challenge(&cp, sig);
+	poly_ntt(&cp);
+
+	/* Compute z = y + c*s1, reject if it reveals secret, pack into signature */
+	for (i = 0; i < L; ++i) {
+		polyeta_unpack(&v, sk + SK_S1_OFFSET + i * POLYETA_PACKEDBYTES);
+		poly_ntt(&v);
+		poly_pointwise_montgomery(&v, &cp, &v);
+		poly_invntt_tomont(&v);
+		next_y(&tmp, i, &ysrc);
+		poly_add(&v, &v, &tmp);
+		poly_reduce(&v);
+		if (poly_chknorm(&v, GAMMA1 - BETA)) {
+			ysrc.nonce++;
+			goto rej;
+		}
+		polyz_pack(sig + SIG_Z_OFFSET + i * POLYZ_PACKEDBYTES, &v);
+	}
+
+	/* Recompute w row by row for the low-bits checks and the hint */
+	for (i = 0; i < OMEGA + K; ++i) {
+		hint[i] = 0;
+	}
+	n = 0;
+	for (i = 0; i < K; ++i) {
+		matrix_row_pointwise(&acc, &tmp, &v, rho, i, next_y, &ysrc);
+		poly_reduce(&acc);
+		poly_invntt_tomont(&acc);
+		poly_caddq(&acc);
+		poly_decompose(&acc, &tmp, &acc); /* acc = w1_i, tmp = w0_i */
+
+		/* Check that subtracting cs2 does not change high bits of w and low bits
+		 * do not reveal secret information */
+		polyeta_unpack(&v, sk + SK_S2_OFFSET + i * POLYETA_PACKEDBYTES);
+		poly_ntt(&v);
+		poly_pointwise_montgomery(&v, &cp, &v);
+		poly_invntt_tomont(&v);
+		poly_sub(&tmp, &tmp, &v);
+		poly_reduce(&tmp);
+		if (poly_chknorm(&tmp, GAMMA2 - BETA)) {
+			ysrc.nonce++;
+			goto rej;
+		}
+
+		/* Compute hints for w1 */
+		polyt0_unpack(&v, sk + SK_T0_OFFSET + i * POLYT0_PACKEDBYTES);
+		poly_ntt(&v);
+		poly_pointwise_montgomery(&v, &cp, &v);
+		poly_invntt_tomont(&v);
+		poly_reduce(&v);
+		if (poly_chknorm(&v, GAMMA2)) {
+			ysrc.nonce++;
+			goto rej;
+		}
+
+		poly_add(&tmp, &tmp, &v);
+		cnt = poly_make_hint(&v, &tmp, &acc);
+		if (n + cnt > OMEGA) {
+			ysrc.nonce++;
+			goto rej;
+		}
+		for (j = 0; j < N; ++j) {
+			if (v.coeffs[j] != 0) {
+				hint[n++] = (uint8_t) j;
+			}
+		}
+		hint[OMEGA + i] = (uint8_t) n;
+	}
+
+	shake256_inc_ctx_release(&state);
+	*siglen = CRYPTO_BYTES;
+
+	OQS_MEM_cleanse(seedbuf, sizeof(seedbuf));
+	OQS_MEM_cleanse(&acc, sizeof(acc));
+	OQS_MEM_cleanse(&tmp, sizeof(tmp));
+	OQS_MEM_cleanse(&v, sizeof(v));
+	return 0;
+}
+
+int crypto_sign_signature_lowstack(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen,
+                                   const uint8_t *ctx, size_t ctxlen, const uint8_t *sk) {
+	size_t i;
+	uint8_t pre[257];
+	uint8_t rnd[RNDBYTES];
+
+	if (ctxlen > 255) {
+		return -1;
+	}
+
+	/* Prepare pre = (0, ctxlen, ctx) */
+	pre[0] = 0;
+	pre[1] = (uint8_t) ctxlen;
+	for (i = 0; i < ctxlen; i++) {
+		pre[2 + i] = ctx[i];
+	}
+
+#ifdef DILITHIUM_RANDOMIZED_SIGNING
+	randombytes(rnd, RNDBYTES);
+#else
+	for (i = 0; i < RNDBYTES; i++) {
+		rnd[i] = 0;
+	}
+#endif
+
+	return crypto_sign_signature_internal_lowstack(sig, siglen, m, mlen, pre, 2 + ctxlen, rnd, sk);
+}
+
+/* Same checks as unpack_sig(), without expanding h */
+static int check_hint_encoding(const uint8_t *hint) {
+	unsigned int i, j, k;
+
+	k = 0;
+	for (i = 0; i < K; ++i) {
+		if (hint[OMEGA + i] < k || hint[OMEGA + i] > OMEGA) {
+			return 1;
+		}
+		for (j = k; j < hint[OMEGA + i]; ++j) {
+			/* Coefficients are ordered for strong unforgeability */
+			if (j > k && hint[j] <= hint[j - 1]) {
+				return 1;
+			}
+		}
+		k = hint[OMEGA + i];
+	}
+
+	/* Extra indices are zero for strong unforgeability */
+	for (j = k; j < OMEGA; ++j) {
+		if (hint[j]) {
+			return 1;
+		}
+	}
+	return 0;
+}
+
+static int crypto_sign_verify_internal_lowstack(const uint8_t *sig, size_t siglen, const uint8_t *m, size_t mlen,
+        const uint8_t *pre, size_t prelen, const uint8_t *pk) {
+	unsigned int i, j, start;
+	uint8_t w1_packed[POLYW1_PACKEDBYTES];
+	uint8_t mu[CRHBYTES];
+	uint8_t c2[CTILDEBYTES];
+	const uint8_t *hint;
+	poly acc, tmp, v, cp;
+	shake256incctx state;
+
+	if (siglen != CRYPTO_BYTES) {
+		return -1;
+	}
+
+	hint = sig + SIG_H_OFFSET;
+	if (check_hint_encoding(hint)) {
+		return -1;
+	}
+	for (i = 0; i < L; ++i) {
+		polyz_unpack(&v, sig + SIG_Z_OFFSET + i * POLYZ_PACKEDBYTES);
+		if (poly_chknorm(&v, GAMMA1 - BETA)) {
+			return -1;
+		}
+	}
+
+	/* Compute CRH(H(rho, t1), pre, msg) */
+	shake256(mu, TRBYTES, pk, CRYPTO_PUBLICKEYBYTES);
+	shake256_inc_init(&state);
+	shake256_inc_absorb(&state, mu, TRBYTES);
+	shake256_inc_absorb(&state, pre, prelen);
+	shake256_inc_absorb(&state, m, mlen);
+	shake256_inc_finalize(&state);
+	shake256_inc_squeeze(mu, CRHBYTES, &state);
+
+	poly_challenge(&cp, sig);
+	poly_ntt(&cp);
+
+	/* w1 = UseHint(h, Az - c*t1*2^d), absorbed into the hash row by row */
+	shake256_inc_ctx_reset(&state);
+	shake256_inc_absorb(&state, mu, CRHBYTES);
+	start = 0;
+	for (i = 0; i < K; ++i) {
+		matrix_row_pointwise(&acc, &tmp, &v, pk, i, next_z_packed, sig + SIG_Z_OFFSET);
+
+		polyt1_unpack(&v, pk + SEEDBYTES + i * POLYT1_PACKEDBYTES);
+		poly_shiftl(&v);
+		poly_ntt(&v);
+		poly_pointwise_montgomery(&v, &cp, &v);
+
+		poly_sub(&acc, &acc, &v);
+		poly_reduce(&acc);
+		poly_invntt_tomont(&acc);
+		poly_caddq(&acc);
+
+		for (j = 0; j < N; ++j) {
+			v.coeffs[j] = 0;
+		}
+		for (j = start; j < hint[OMEGA + i]; ++j) {
+			v.coeffs[hint[j]] = 1;
+		}
+		start = hint[OMEGA + i];
+
+		poly_use_hint(&acc, &acc, &v);
+		polyw1_pack(w1_packed, &acc);
+		shake256_inc_absorb(&state, w1_packed, POLYW1_PACKEDBYTES);
+	}
+	shake256_inc_finalize(&state);
+	shake256_inc_squeeze(c2, CTILDEBYTES, &state);
+	shake256_inc_ctx_release(&state);
+
+	for (i = 0; i < CTILDEBYTES; ++i) {
+		if (sig[i] != c2[i]) {
+			return -1;
+		}
+	}
+	return 0;
+}
+
+int crypto_sign_verify_lowstack(const uint8_t *sig, size_t siglen, const uint8_t *m, size_t mlen,
+                                const uint8_t *ctx, size_t ctxlen, const uint8_t *pk) {
+	size_t i;
+	uint8_t pre[257];
+
+	if (ctxlen > 255) {
+		return -1;
+	}
+
+	pre[0] = 0;
+	pre[1] = (uint8_t) ctxlen;
+	for (i = 0; i < ctxlen; i++) {
+		pre[2 + i] = ctx[i];
+	}
+
+	return crypto_sign_verify_internal_lowstack(sig, siglen, m, mlen, pre, 2 + ctxlen, pk);
+}
@@ -0,0 +1,30 @@
+// SPDX-License-Identifier: MIT
+
+#ifndef SIGN_LOWSTACK_H
+#define SIGN_LOWSTACK_H
+
+#include <oqs/oqs.h>
+
+#include <stddef.h>
+#include <stdint.h>
+#include "params.h"
+
+#define crypto_sign_keypair_lowstack DILITHIUM_NAMESPACE(lowstack_keypair)
+int crypto_sign_keypair_lowstack(uint8_t *pk, uint8_t *sk);
+
+#define crypto_sign_keypair_internal_lowstack DILITHIUM_NAMESPACE(lowstack_keypair_internal)
+int crypto_sign_keypair_internal_lowstack(uint8_t *pk, uint8_t *sk, const uint8_t seed[SEEDBYTES]);
+
+#define crypto_sign_signature_lowstack DILITHIUM_NAMESPACE(lowstack_signature)
+int crypto_sign_signature_lowstack(uint8_t *sig, size_t *siglen,
+                                   const uint8_t *m, size_t mlen,
+                                   const uint8_t *ctx, size_t ctxlen,
+                                   const uint8_t *sk);
+
+#define crypto_sign_verify_lowstack DILITHIUM_NAMESPACE(lowstack_verify)
+int crypto_sign_verify_lowstack(const uint8_t *sig, size_t siglen,
+                                const uint8_t *m, size_t mlen,
+                                const uint8_t *ctx, size_t ctxlen,
+                                const uint8_t *pk);
+
+#endif
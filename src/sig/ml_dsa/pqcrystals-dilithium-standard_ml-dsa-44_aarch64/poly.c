@@ -0,0 +1,1199 @@
+#include <arm_neon.h>
+#include <stdint.h>
+#include <string.h>
+#include "params.h"
+#include "poly.h"
+#include "ntt.h"
+#include "reduce.h"
+#include "reduce_neon.h"
+#include "rounding.h"
+#include "symmetric.h"
+#include "fips202x4.h"
+
+#ifdef DBENCH
+#include "test/cpucycles.h"
+extern const uint64_t timing_overhead;
+extern uint64_t *tred, *tadd, *tmul, *tround, *tsample, *tpack;
+#define DBENCH_START() uint64_t time = cpucycles()
+#define DBENCH_STOP(t) t += cpucycles() - time - timing_overhead
+#else
+#define DBENCH_START()
+#define DBENCH_STOP(t)
+#endif
+
+/*************************************************
+* Name:        poly_reduce
+*
+* Description: Inplace reduction of all coefficients of polynomial to
+*              representative in [-6283008,6283008].
+*
+* Arguments:   - poly *a: pointer to input/output polynomial
+**************************************************/
+void poly_reduce(poly *a) {
+  unsigned int i;
+  DBENCH_START();
+
+  for(i = 0; i < N; i += 4)
+    vst1q_s32(&a->coeffs[i], reduce32_neon(vld1q_s32(&a->coeffs[i])));
+
+  DBENCH_STOP(*tred);
+}
+
+/*************************************************
+* Name:        poly_caddq
+*
+* Description: For all coefficients of in/out polynomial add Q if
+*              coefficient is negative.
+*
+* Arguments:   - poly *a: pointer to input/output polynomial
+**************************************************/
+void poly_caddq(poly *a) {
+  unsigned int i;
+  DBENCH_START();
+
+  for(i = 0; i < N; i += 4)
+    vst1q_s32(&a->coeffs[i], caddq_neon(vld1q_s32(&a->coeffs[i])));
+
+  DBENCH_STOP(*tred);
+}
+
+/*************************************************
+* Name:        poly_add
+*
+* Description: Add polynomials. No modular reduction is performed.
+*
+* Arguments:   - poly *c: pointer to output polynomial
+*              - const poly *a: pointer to first summand
+*              - const poly *b: pointer to second summand
+**************************************************/
+void poly_add(poly *c, const poly *a, const poly *b)  {
+  unsigned int i;
+  DBENCH_START();
+
+  for(i = 0; i < N; i += 4)
+    vst1q_s32(&c->coeffs[i], vaddq_s32(vld1q_s32(&a->coeffs[i]), vld1q_s32(&b->coeffs[i])));
+
+  DBENCH_STOP(*tadd);
+}
+
+/*************************************************
+* Name:        poly_sub
+*
+* Description: Subtract polynomials. No modular reduction is
+*              performed.
+*
+* Arguments:   - poly *c: pointer to output polynomial
+*              - const poly *a: pointer to first input polynomial
+*              - const poly *b: pointer to second input polynomial to be
+*                               subtraced from first input polynomial
+**************************************************/
+void poly_sub(poly *c, const poly *a, const poly *b) {
+  unsigned int i;
+  DBENCH_START();
+
+  for(i = 0; i < N; i += 4)
+    vst1q_s32(&c->coeffs[i], vsubq_s32(vld1q_s32(&a->coeffs[i]), vld1q_s32(&b->coeffs[i])));
+
+  DBENCH_STOP(*tadd);
+}
+
+/*************************************************
+* Name:        poly_shiftl
+*
+* Description: Multiply polynomial by 2^D without modular reduction. Assumes
+*              input coefficients to be less than 2^{31-D} in absolute value.
+*
+* Arguments:   - poly *a: pointer to input/output polynomial
+**************************************************/
+void poly_shiftl(poly *a) {
+  unsigned int i;
+  DBENCH_START();
+
+  for(i = 0; i < N; i += 4)
+    vst1q_s32(&a->coeffs[i], vshlq_n_s32(vld1q_s32(&a->coeffs[i]), D));
+
+  DBENCH_STOP(*tmul);
+}
+
+/*************************************************
+* Name:        poly_ntt
+*
+* Description: Inplace forward NTT. Coefficients can grow by
+*              8*Q in absolute value.
+*
+* Arguments:   - poly *a: pointer to input/output polynomial
+**************************************************/
+void poly_ntt(poly *a) {
+  DBENCH_START();
+
+  ntt(a->coeffs);
+
+  DBENCH_STOP(*tmul);
+}
+
+/*************************************************
+* Name:        poly_invntt_tomont
+*
+* Description: Inplace inverse NTT and multiplication by 2^{32}.
+*              Input coefficients need to be less than Q in absolute
+*              value and output coefficients are again bounded by Q.
+*
+* Arguments:   - poly *a: pointer to input/output polynomial
+**************************************************/
+void poly_invntt_tomont(poly *a) {
+  DBENCH_START();
+
+  invntt_tomont(a->coeffs);
+
+  DBENCH_STOP(*tmul);
+}
+
+/*************************************************
+* Name:        poly_pointwise_montgomery
+*
+* Description: Pointwise multiplication of polynomials in NTT domain
+*              representation and multiplication of resulting polynomial
+*              by 2^{-32}.
+*
+* Arguments:   - poly *c: pointer to output polynomial
+*              - const poly *a: pointer to first input polynomial
+*              - const poly *b: pointer to second input polynomial
+**************************************************/
+void poly_pointwise_montgomery(poly *c, const poly *a, const poly *b) {
+  unsigned int i;
+  DBENCH_START();
+
+  for(i = 0; i < N; i += 4)
+    vst1q_s32(&c->coeffs[i], montgomery_mul_neon(vld1q_s32(&a->coeffs[i]), vld1q_s32(&b->coeffs[i])));
+
+  DBENCH_STOP(*tmul);
+}
+
+/*************************************************
+* Name:        poly_power2round
+*
+* Description: For all coefficients c of the input polynomial,
+*              compute c0, c1 such that c mod Q = c1*2^D + c0
+*              with -2^{D-1} < c0 <= 2^{D-1}. Assumes coefficients to be
+*              standard representatives.
+*
+* Arguments:   - poly *a1: pointer to output polynomial with coefficients c1
+*              - poly *a0: pointer to output polynomial with coefficients c0
+*              - const poly *a: pointer to input polynomial
+**************************************************/
+void poly_power2round(poly *a1, poly *a0, const poly *a) {
+  unsigned int i;
+  int32x4_t f, f1;
+  DBENCH_START();
+
+  for(i = 0; i < N; i += 4) {
+    f = vld1q_s32(&a->coeffs[i]);
+    f1 = vshrq_n_s32(vaddq_s32(f, vdupq_n_s32((1 << (D-1)) - 1)), D);
+    vst1q_s32(&a1->coeffs[i], f1);
+    vst1q_s32(&a0->coeffs[i], vsubq_s32(f, vshlq_n_s32(f1, D)));
+  }
+
+  DBENCH_STOP(*tround);
+}
+
+/*************************************************
+* Name:        decompose_neon
+*
+* Description: Same as decompose for four coefficients.
+*
+* Arguments:   - int32x4_t *a0: pointer to output low bits
+*              - int32x4_t a: input coefficients (standard representatives)
+*
+* Returns the high bits.
+**************************************************/
+static inline int32x4_t decompose_neon(int32x4_t *a0, int32x4_t a) {
+  int32x4_t a1;
+
+  a1 = vshrq_n_s32(vaddq_s32(a, vdupq_n_s32(127)), 7);
+#if GAMMA2 == (Q-1)/32
+  a1 = vshrq_n_s32(vmlaq_s32(vdupq_n_s32(1 << 21), a1, vdupq_n_s32(1025)), 22);
+  a1 = vandq_s32(a1, vdupq_n_s32(15));
+#elif GAMMA2 == (Q-1)/88
+  a1 = vshrq_n_s32(vmlaq_s32(vdupq_n_s32(1 << 23), a1, vdupq_n_s32(11275)), 24);
+  a1 = veorq_s32(a1, vandq_s32(vshrq_n_s32(vsubq_s32(vdupq_n_s32(43), a1), 31), a1));
+#endif
+
+  *a0 = vmlsq_s32(a, a1, vdupq_n_s32(2*GAMMA2));
+  *a0 = vsubq_s32(*a0, vandq_s32(vshrq_n_s32(vsubq_s32(vdupq_n_s32((Q-1)/2), *a0), 31), vdupq_n_s32(Q)));
+  return a1;
+}
+
+/*************************************************
+* Name:        poly_decompose
+*
+* Description: For all coefficients c of the input polynomial,
+*              compute high and low bits c0, c1 such c mod Q = c1*ALPHA + c0
+*              with -ALPHA/2 < c0 <= ALPHA/2 except c1 = (Q-1)/ALPHA where we
+*              set c1 = 0 and -ALPHA/2 <= c0 = c mod Q - Q < 0.
+*              Assumes coefficients to be standard representatives.
+*
+* Arguments:   - poly *a1: pointer to output polynomial with coefficients c1
+*              - poly *a0: pointer to output polynomial with coefficients c0
+*              - const poly *a: pointer to input polynomial
+**************************************************/
+void poly_decompose(poly *a1, poly *a0, const poly *a) {
+  unsigned int i;
+  int32x4_t f0;
+  DBENCH_START();
+
+  for(i = 0; i < N; i += 4) {
+    vst1q_s32(&a1->coeffs[i], decompose_neon(&f0, vld1q_s32(&a->coeffs[i])));
+    vst1q_s32(&a0->coeffs[i], f0);
+  }
+
+  DBENCH_STOP(*tround);
+}
+
+/*************************************************
+* Name:        poly_make_hint
+*
+* Description: Compute hint polynomial. The coefficients of which indicate
+*              whether the low bits of the corresponding coefficient of
+*              the input polynomial overflow into the high bits.
+*
+* Arguments:   - poly *h: pointer to output hint polynomial
+*              - const poly *a0: pointer to low part of input polynomial
+*              - const poly *a1: pointer to high part of input polynomial
+*
+* Returns number of 1 bits.
+**************************************************/
+unsigned int poly_make_hint(poly *h, const poly *a0, const poly *a1) {
+  unsigned int i;
+  uint32x4_t hint, s = vdupq_n_u32(0);
+  int32x4_t f0, f1;
+  DBENCH_START();
+
+  for(i = 0; i < N; i += 4) {
+    f0 = vld1q_s32(&a0->coeffs[i]);
+    f1 = vld1q_s32(&a1->coeffs[i]);
+    hint = vorrq_u32(vcgtq_s32(f0, vdupq_n_s32(GAMMA2)), vcltq_s32(f0, vdupq_n_s32(-GAMMA2)));
+    hint = vorrq_u32(hint, vandq_u32(vceqq_s32(f0, vdupq_n_s32(-GAMMA2)), vtstq_s32(f1, f1)));
+    hint = vshrq_n_u32(hint, 31);
+    vst1q_s32(&h->coeffs[i], vreinterpretq_s32_u32(hint));
+    s = vaddq_u32(s, hint);
+  }
+
+  DBENCH_STOP(*tround);
+  return vaddvq_u32(s);
+}
+
+/*************************************************
+* Name:        poly_use_hint
+*
+* Description: Use hint polynomial to correct the high bits of a polynomial.
+*
+* Arguments:   - poly *b: pointer to output polynomial with corrected high bits
+*              - const poly *a: pointer to input polynomial
+*              - const poly *h: pointer to input hint polynomial
+**************************************************/
+void poly_use_hint(poly *b, const poly *a, const poly *h) {
+  unsigned int i;
+  int32x4_t f0, f1, d;
+  DBENCH_START();
+
+  for(i = 0; i < N; i += 4) {
+    f1 = decompose_neon(&f0, vld1q_s32(&a->coeffs[i]));
+    /* +1 if a0 > 0, -1 otherwise, and 0 where the hint is not set */
+    d = vbslq_s32(vcgtq_s32(f0, vdupq_n_s32(0)), vdupq_n_s32(1), vdupq_n_s32(-1));
+    d = vandq_s32(d, vnegq_s32(vld1q_s32(&h->coeffs[i])));
+    f1 = vaddq_s32(f1, d);
+#if GAMMA2 == (Q-1)/32
+    f1 = vandq_s32(f1, vdupq_n_s32(15));
+#elif GAMMA2 == (Q-1)/88
+    f1 = vbslq_s32(vceqq_s32(f1, vdupq_n_s32(44)), vdupq_n_s32(0), f1);
+    f1 = vbslq_s32(vceqq_s32(f1, vdupq_n_s32(-1)), vdupq_n_s32(43), f1);
+#endif
+    vst1q_s32(&b->coeffs[i], f1);
+  }
+
+  DBENCH_STOP(*tround);
+}
+
+/*************************************************
+* Name:        poly_chknorm
+*
+* Description: Check infinity norm of polynomial against given bound.
+*              Assumes input coefficients were reduced by reduce32().
+*
+* Arguments:   - const poly *a: pointer to polynomial
+*              - int32_t B: norm bound
+*
+* Returns 0 if norm is strictly smaller than B <= (Q-1)/8 and 1 otherwise.
+**************************************************/
+int poly_chknorm(const poly *a, int32_t B) {
+  unsigned int i;
+  uint32x4_t r = vdupq_n_u32(0);
+  DBENCH_START();
+
+  if(B > (Q-1)/8)
+    return 1;
+
+  /* It is ok to leak which coefficient violates the bound since
+     the probability for each coefficient is independent of secret
+     data but we must not leak the sign of the centralized representative. */
+  for(i = 0; i < N; i += 4)
+    r = vorrq_u32(r, vcgeq_s32(vabsq_s32(vld1q_s32(&a->coeffs[i])), vdupq_n_s32(B)));
+
+  DBENCH_STOP(*tsample);
+  return vmaxvq_u32(r) != 0;
+}
+
+/* Byte shuffles that move the accepted 32-bit lanes of a vector to the
+   front, indexed by the 4-bit acceptance mask */
+static const uint8_t rej_idx[16][16] = {
+  {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255},
+  {  0,  1,  2,  3,255,255,255,255,255,255,255,255,255,255,255,255},
+  {  4,  5,  6,  7,255,255,255,255,255,255,255,255,255,255,255,255},
+  {  0,  1,  2,  3,  4,  5,  6,  7,255,255,255,255,255,255,255,255},
+  {  8,  9, 10, 11,255,255,255,255,255,255,255,255,255,255,255,255},
+  {  0,  1,  2,  3,  8,  9, 10, 11,255,255,255,255,255,255,255,255},
+  {  4,  5,  6,  7,  8,  9, 10, 11,255,255,255,255,255,255,255,255},
+  {  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11,255,255,255,255},
+  { 12, 13, 14, 15,255,255,255,255,255,255,255,255,255,255,255,255},
+  {  0,  1,  2,  3, 12, 13, 14, 15,255,255,255,255,255,255,255,255},
+  {  4,  5,  6,  7, 12, 13, 14, 15,255,255,255,255,255,255,255,255},
+  {  0,  1,  2,  3,  4,  5,  6,  7, 12, 13, 14, 15,255,255,255,255},
+  {  8,  9, 10, 11, 12, 13, 14, 15,255,255,255,255,255,255,255,255},
+  {  0,  1,  2,  3,  8,  9, 10, 11, 12, 13, 14, 15,255,255,255,255},
+  {  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15,255,255,255,255},
+  {  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15}
+};
+
+static const uint8_t rej_uniform_idx[16] = {0, 1, 2, 255, 3, 4, 5, 255, 6, 7, 8, 255, 9, 10, 11, 255};
+static const uint32_t rej_bits[4] = {1, 2, 4, 8};
+
+/*************************************************
+* Name:        rej_store_neon
+*
+* Description: Store the lanes of r selected by the acceptance mask
+*              contiguously to a. Always writes four coefficients.
+*
+* Arguments:   - int32_t *a: pointer to output array with room for four
+*                            coefficients
+*              - int32x4_t r: candidate coefficients
+*              - uint32x4_t good: acceptance mask (all ones or zero per lane)
+*
+* Returns number of accepted coefficients.
+**************************************************/
+static inline unsigned int rej_store_neon(int32_t *a, int32x4_t r, uint32x4_t good) {
+  unsigned int m;
+
+  m = vaddvq_u32(vandq_u32(good, vld1q_u32(rej_bits)));
+  r = vreinterpretq_s32_u8(vqtbl1q_u8(vreinterpretq_u8_s32(r), vld1q_u8(rej_idx[m])));
+  vst1q_s32(a, r);
+  return vaddvq_u32(vshrq_n_u32(good, 31));
+}
+
+/*************************************************
+* Name:        rej_uniform
+*
+* Description: Sample uniformly random coefficients in [0, Q-1] by
+*              performing rejection sampling on array of random bytes.
+*
+* Arguments:   - int32_t *a: pointer to output array (allocated)
+*              - unsigned int len: number of coefficients to be sampled
+*              - const uint8_t *buf: array of random bytes
+*              - unsigned int buflen: length of array of random bytes
+*
+* Returns number of sampled coefficients. Can be smaller than len if not enough
+* random bytes were given.
+**************************************************/
+static unsigned int rej_uniform(int32_t *a,
+                                unsigned int len,
+                                const uint8_t *buf,
+                                unsigned int buflen)
+{
+  unsigned int ctr, pos;
+  uint32_t t;
+  uint32x4_t f;
+  const uint8x16_t idx = vld1q_u8(rej_uniform_idx);
+  DBENCH_START();
+
+  ctr = pos = 0;
+  /* Four candidates from 12 bytes per iteration; the 16-byte load
+     reads ahead by four bytes */
+  while(ctr + 4 <= len && pos + 16 <= buflen) {
+    f = vreinterpretq_u32_u8(vqtbl1q_u8(vld1q_u8(&buf[pos]), idx));
+    f = vandq_u32(f, vdupq_n_u32(0x7FFFFF));
+    ctr += rej_store_neon(&a[ctr], vreinterpretq_s32_u32(f), vcltq_u32(f, vdupq_n_u32(Q)));
+    pos += 12;
+  }
+
+  while(ctr < len && pos + 3 <= buflen) {
+    t  = buf[pos++];
+    t |= (uint32_t)buf[pos++] << 8;
+    t |= (uint32_t)buf[pos++] << 16;
+    t &= 0x7FFFFF;
+
+    if(t < Q)
+      a[ctr++] = t;
+  }
+
+  DBENCH_STOP(*tsample);
+  return ctr;
+}
+
+/*************************************************
+* Name:        poly_uniform
+*
+* Description: Sample polynomial with uniformly random coefficients
+*              in [0,Q-1] by performing rejection sampling on the
+*              output stream of SHAKE128(seed|nonce)
+*
+* Arguments:   - poly *a: pointer to output polynomial
+*              - const uint8_t seed[]: byte array with seed of length SEEDBYTES
+*              - uint16_t nonce: 2-byte nonce
+**************************************************/
+#define POLY_UNIFORM_NBLOCKS ((768 + STREAM128_BLOCKBYTES - 1)/STREAM128_BLOCKBYTES)
+void poly_uniform(poly *a,
+                  const uint8_t seed[SEEDBYTES],
+                  uint16_t nonce)
+{
+  unsigned int i, ctr, off;
+  unsigned int buflen = POLY_UNIFORM_NBLOCKS*STREAM128_BLOCKBYTES;
+  uint8_t buf[POLY_UNIFORM_NBLOCKS*STREAM128_BLOCKBYTES + 2];
+  stream128_state state;
+
+  stream128_init(&state, seed, nonce);
+  stream128_squeezeblocks(buf, POLY_UNIFORM_NBLOCKS, &state);
+
+  ctr = rej_uniform(a->coeffs, N, buf, buflen);
+
+  while(ctr < N) {
+    off = buflen % 3;
+    for(i = 0; i < off; ++i)
+      buf[i] = buf[buflen - off + i];
+
+    stream128_squeezeblocks(buf + off, 1, &state);
+    buflen = STREAM128_BLOCKBYTES + off;
+    ctr += rej_uniform(a->coeffs + ctr, N - ctr, buf, buflen);
+  }
+  stream128_release(&state);
+}
+
+/* Map from a nibble to the corresponding coefficient in [-ETA,ETA]; only
+   the entries of accepted nibbles are used */
+#if ETA == 2
+#define REJ_ETA_BOUND 15
+static const int8_t rej_eta_lut[16] = {2, 1, 0, -1, -2, 2, 1, 0, -1, -2, 2, 1, 0, -1, -2, 0};
+#elif ETA == 4
+#define REJ_ETA_BOUND 9
+static const int8_t rej_eta_lut[16] = {4, 3, 2, 1, 0, -1, -2, -3, -4, 0, 0, 0, 0, 0, 0, 0};
+#endif
+
+/*************************************************
+* Name:        rej_eta
+*
+* Description: Sample uniformly random coefficients in [-ETA, ETA] by
+*              performing rejection sampling on array of random bytes.
+*
+* Arguments:   - int32_t *a: pointer to output array (allocated)
+*              - unsigned int len: number of coefficients to be sampled
+*              - const uint8_t *buf: array of random bytes
+*              - unsigned int buflen: length of array of random bytes
+*
+* Returns number of sampled coefficients. Can be smaller than len if not enough
+* random bytes were given.
+**************************************************/
+static unsigned int rej_eta(int32_t *a,
+                            unsigned int len,
+                            const uint8_t *buf,
+                            unsigned int buflen)
+{
+  unsigned int ctr, pos;
+  uint32_t t0, t1;
+  uint8x8_t f;
+  uint8x8x2_t g;
+  uint8x16_t t;
+  int8x16_t r, good;
+  int16x8_t r16, good16;
+  const int8x16_t lut = vld1q_s8(rej_eta_lut);
+  DBENCH_START();
+
+  ctr = pos = 0;
+  /* 16 candidates from 8 bytes per iteration */
+  while(ctr + 16 <= len && pos + 8 <= buflen) {
+    f = vld1_u8(&buf[pos]);
+    g = vzip_u8(vand_u8(f, vdup_n_u8(0x0F)), vshr_n_u8(f, 4));
+    t = vcombine_u8(g.val[0], g.val[1]);
+    good = vreinterpretq_s8_u8(vcltq_u8(t, vdupq_n_u8(REJ_ETA_BOUND)));
+    r = vqtbl1q_s8(lut, t);
+
+    r16 = vmovl_s8(vget_low_s8(r));
+    good16 = vmovl_s8(vget_low_s8(good));
+    ctr += rej_store_neon(&a[ctr], vmovl_s16(vget_low_s16(r16)), vreinterpretq_u32_s32(vmovl_s16(vget_low_s16(good16))));
+    ctr += rej_store_neon(&a[ctr], vmovl_s16(vget_high_s16(r16)), vreinterpretq_u32_s32(vmovl_s16(vget_high_s16(good16))));
+    r16 = vmovl_s8(vget_high_s8(r));
+    good16 = vmovl_s8(vget_high_s8(good));
+    ctr += rej_store_neon(&a[ctr], vmovl_s16(vget_low_s16(r16)), vreinterpretq_u32_s32(vmovl_s16(vget_low_s16(good16))));
+    ctr += rej_store_neon(&a[ctr], vmovl_s16(vget_high_s16(r16)), vreinterpretq_u32_s32(vmovl_s16(vget_high_s16(good16))));
+    pos += 8;
+  }
+
+  while(ctr < len && pos < buflen) {
+    t0 = buf[pos] & 0x0F;
+    t1 = buf[pos++] >> 4;
+
+#if ETA == 2
+    if(t0 < 15) {
+      t0 = t0 - (205*t0 >> 10)*5;
+      a[ctr++] = 2 - t0;
+    }
+    if(t1 < 15 && ctr < len) {
+      t1 = t1 - (205*t1 >> 10)*5;
+      a[ctr++] = 2 - t1;
+    }
+#elif ETA == 4
+    if(t0 < 9)
+      a[ctr++] = 4 - t0;
+    if(t1 < 9 && ctr < len)
+      a[ctr++] = 4 - t1;
+#endif
+  }
+
+  DBENCH_STOP(*tsample);
+  return ctr;
+}
+
+/*************************************************
+* Name:        poly_uniform_eta
+*
+* Description: Sample polynomial with uniformly random coefficients
+*              in [-ETA,ETA] by performing rejection sampling on the
+*              output stream from SHAKE256(seed|nonce)
+*
+* Arguments:   - poly *a: pointer to output polynomial
+*              - const uint8_t seed[]: byte array with seed of length CRHBYTES
+*              - uint16_t nonce: 2-byte nonce
+**************************************************/
+#if ETA == 2
+#define POLY_UNIFORM_ETA_NBLOCKS ((136 + STREAM256_BLOCKBYTES - 1)/STREAM256_BLOCKBYTES)
+#elif ETA == 4
+#define POLY_UNIFORM_ETA_NBLOCKS ((227 + STREAM256_BLOCKBYTES - 1)/STREAM256_BLOCKBYTES)
+#endif
+void poly_uniform_eta(poly *a,
+                      const uint8_t seed[CRHBYTES],
+                      uint16_t nonce)
+{
+  unsigned int ctr;
+  unsigned int buflen = POLY_UNIFORM_ETA_NBLOCKS*STREAM256_BLOCKBYTES;
+  uint8_t buf[POLY_UNIFORM_ETA_NBLOCKS*STREAM256_BLOCKBYTES];
+  stream256_state state;
+
+  stream256_init(&state, seed, nonce);
+  stream256_squeezeblocks(buf, POLY_UNIFORM_ETA_NBLOCKS, &state);
+
+  ctr = rej_eta(a->coeffs, N, buf, buflen);
+
+  while(ctr < N) {
+    stream256_squeezeblocks(buf, 1, &state);
+    ctr += rej_eta(a->coeffs + ctr, N - ctr, buf, STREAM256_BLOCKBYTES);
+  }
+  stream256_release(&state);
+}
+
+/*************************************************
+* Name:        poly_uniform_gamma1m1
+*
+* Description: Sample polynomial with uniformly random coefficients
+*              in [-(GAMMA1 - 1), GAMMA1] by unpacking output stream
+*              of SHAKE256(seed|nonce)
+*
+* Arguments:   - poly *a: pointer to output polynomial
+*              - const uint8_t seed[]: byte array with seed of length CRHBYTES
+*              - uint16_t nonce: 16-bit nonce
+**************************************************/
+#define POLY_UNIFORM_GAMMA1_NBLOCKS ((POLYZ_PACKEDBYTES + STREAM256_BLOCKBYTES - 1)/STREAM256_BLOCKBYTES)
+void poly_uniform_gamma1(poly *a,
+                         const uint8_t seed[CRHBYTES],
+                         uint16_t nonce)
+{
+  uint8_t buf[POLY_UNIFORM_GAMMA1_NBLOCKS*STREAM256_BLOCKBYTES];
+  stream256_state state;
+
+  stream256_init(&state, seed, nonce);
+  stream256_squeezeblocks(buf, POLY_UNIFORM_GAMMA1_NBLOCKS, &state);
+  stream256_release(&state);
+  polyz_unpack(a, buf);
+}
+
+/*************************************************
+* Name:        poly_uniform_4x
+*
+* Description: Same as poly_uniform for four polynomials at once, using the
+*              four-way parallel SHAKE128.
+*
+* Arguments:   - poly *a0, *a1, *a2, *a3: pointers to output polynomials
+*              - const uint8_t seed[]: byte array with seed of length SEEDBYTES
+*              - uint16_t nonce0, ..., nonce3: 2-byte nonces
+**************************************************/
+void poly_uniform_4x(poly *a0,
+                     poly *a1,
+                     poly *a2,
+                     poly *a3,
+                     const uint8_t seed[SEEDBYTES],
+                     uint16_t nonce0,
+                     uint16_t nonce1,
+                     uint16_t nonce2,
+                     uint16_t nonce3)
+{
+  unsigned int i, ctr0, ctr1, ctr2, ctr3;
+  uint8_t buf[4][POLY_UNIFORM_NBLOCKS*STREAM128_BLOCKBYTES];
+  uint16_t nonce[4] = {nonce0, nonce1, nonce2, nonce3};
+  shake128x4incctx state;
+
+  for(i = 0; i < 4; ++i) {
+    memcpy(buf[i], seed, SEEDBYTES);
+    buf[i][SEEDBYTES+0] = nonce[i];
+    buf[i][SEEDBYTES+1] = nonce[i] >> 8;
+  }
+
+  shake128x4_inc_init(&state);
+  shake128x4_absorb_once(&state, buf[0], buf[1], buf[2], buf[3], SEEDBYTES + 2);
+  shake128x4_squeezeblocks(buf[0], buf[1], buf[2], buf[3], POLY_UNIFORM_NBLOCKS, &state);
+
+  ctr0 = rej_uniform(a0->coeffs, N, buf[0], POLY_UNIFORM_NBLOCKS*STREAM128_BLOCKBYTES);
+  ctr1 = rej_uniform(a1->coeffs, N, buf[1], POLY_UNIFORM_NBLOCKS*STREAM128_BLOCKBYTES);
+  ctr2 = rej_uniform(a2->coeffs, N, buf[2], POLY_UNIFORM_NBLOCKS*STREAM128_BLOCKBYTES);
+  ctr3 = rej_uniform(a3->coeffs, N, buf[3], POLY_UNIFORM_NBLOCKS*STREAM128_BLOCKBYTES);
+
+  /* SHAKE128_RATE is a multiple of 3, so no bytes carry over between blocks */
+  while(ctr0 < N || ctr1 < N || ctr2 < N || ctr3 < N) {
+    shake128x4_squeezeblocks(buf[0], buf[1], buf[2], buf[3], 1, &state);
+
+    ctr0 += rej_uniform(a0->coeffs + ctr0, N - ctr0, buf[0], SHAKE128_RATE);
+    ctr1 += rej_uniform(a1->coeffs + ctr1, N - ctr1, buf[1], SHAKE128_RATE);
+    ctr2 += rej_uniform(a2->coeffs + ctr2, N - ctr2, buf[2], SHAKE128_RATE);
+    ctr3 += rej_uniform(a3->coeffs + ctr3, N - ctr3, buf[3], SHAKE128_RATE);
+  }
+  shake128x4_inc_ctx_release(&state);
+}
+
+/*************************************************
+* Name:        poly_uniform_eta_4x
+*
+* Description: Same as poly_uniform_eta for four polynomials at once, using
+*              the four-way parallel SHAKE256.
+*
+* Arguments:   - poly *a0, *a1, *a2, *a3: pointers to output polynomials
+*              - const uint8_t seed[]: byte array with seed of length CRHBYTES
+*              - uint16_t nonce0, ..., nonce3: 2-byte nonces
+**************************************************/
+void poly_uniform_eta_4x(poly *a0,
+                         poly *a1,
+                         poly *a2,
+                         poly *a3,
+                         const uint8_t seed[CRHBYTES],
+                         uint16_t nonce0,
+                         uint16_t nonce1,
+                         uint16_t nonce2,
+                         uint16_t nonce3)
+{
+  unsigned int i, ctr0, ctr1, ctr2, ctr3;
+  uint8_t buf[4][POLY_UNIFORM_ETA_NBLOCKS*STREAM256_BLOCKBYTES];
+  uint16_t nonce[4] = {nonce0, nonce1, nonce2, nonce3};
+  shake256x4incctx state;
+
+  for(i = 0; i < 4; ++i) {
+    memcpy(buf[i], seed, CRHBYTES);
+    buf[i][CRHBYTES+0] = nonce[i];
+    buf[i][CRHBYTES+1] = nonce[i] >> 8;
+  }
+
+  shake256x4_inc_init(&state);
+  shake256x4_absorb_once(&state, buf[0], buf[1], buf[2], buf[3], CRHBYTES + 2);
+  shake256x4_squeezeblocks(buf[0], buf[1], buf[2], buf[3], POLY_UNIFORM_ETA_NBLOCKS, &state);
+
+  ctr0 = rej_eta(a0->coeffs, N, buf[0], POLY_UNIFORM_ETA_NBLOCKS*STREAM256_BLOCKBYTES);
+  ctr1 = rej_eta(a1->coeffs, N, buf[1], POLY_UNIFORM_ETA_NBLOCKS*STREAM256_BLOCKBYTES);
+  ctr2 = rej_eta(a2->coeffs, N, buf[2], POLY_UNIFORM_ETA_NBLOCKS*STREAM256_BLOCKBYTES);
+  ctr3 = rej_eta(a3->coeffs, N, buf[3], POLY_UNIFORM_ETA_NBLOCKS*STREAM256_BLOCKBYTES);
+
+  while(ctr0 < N || ctr1 < N || ctr2 < N || ctr3 < N) {
+    shake256x4_squeezeblocks(buf[0], buf[1], buf[2], buf[3], 1, &state);
+
+    ctr0 += rej_eta(a0->coeffs + ctr0, N - ctr0, buf[0], SHAKE256_RATE);
+    ctr1 += rej_eta(a1->coeffs + ctr1, N - ctr1, buf[1], SHAKE256_RATE);
+    ctr2 += rej_eta(a2->coeffs + ctr2, N - ctr2, buf[2], SHAKE256_RATE);
+    ctr3 += rej_eta(a3->coeffs + ctr3, N - ctr3, buf[3], SHAKE256_RATE);
+  }
+  shake256x4_inc_ctx_release(&state);
+}
+
+/*************************************************
+* Name:        poly_uniform_gamma1_4x
+*
+* Description: Same as poly_uniform_gamma1 for four polynomials at once,
+*              using the four-way parallel SHAKE256.
+*
+* Arguments:   - poly *a0, *a1, *a2, *a3: pointers to output polynomials
+*              - const uint8_t seed[]: byte array with seed of length CRHBYTES
+*              - uint16_t nonce0, ..., nonce3: 16-bit nonces
+**************************************************/
+void poly_uniform_gamma1_4x(poly *a0,
+                            poly *a1,
+                            poly *a2,
+                            poly *a3,
+                            const uint8_t seed[CRHBYTES],
+                            uint16_t nonce0,
+                            uint16_t nonce1,
+                            uint16_t nonce2,
+                            uint16_t nonce3)
+{
+  unsigned int i;
+  uint8_t buf[4][POLY_UNIFORM_GAMMA1_NBLOCKS*STREAM256_BLOCKBYTES];
+  uint16_t nonce[4] = {nonce0, nonce1, nonce2, nonce3};
+  shake256x4incctx state;
+
+  for(i = 0; i < 4; ++i) {
+    memcpy(buf[i], seed, CRHBYTES);
+    buf[i][CRHBYTES+0] = nonce[i];
+    buf[i][CRHBYTES+1] = nonce[i] >> 8;
+  }
+
+  shake256x4_inc_init(&state);
+  shake256x4_absorb_once(&state, buf[0], buf[1], buf[2], buf[3], CRHBYTES + 2);
+  shake256x4_squeezeblocks(buf[0], buf[1], buf[2], buf[3], POLY_UNIFORM_GAMMA1_NBLOCKS, &state);
+  shake256x4_inc_ctx_release(&state);
+
+  polyz_unpack(a0, buf[0]);
+  polyz_unpack(a1, buf[1]);
+  polyz_unpack(a2, buf[2]);
+  polyz_unpack(a3, buf[3]);
+}
+
+/*************************************************
+* Name:        challenge
+*
+* Description: Implementation of H. Samples polynomial with TAU nonzero
+*              coefficients in {-1,1} using the output stream of
+*              SHAKE256(seed).
+*
+* Arguments:   - poly *c: pointer to output polynomial
+*              - const uint8_t mu[]: byte array containing seed of length CTILDEBYTES
+**************************************************/
+void poly_challenge(poly *c, const uint8_t seed[CTILDEBYTES]) {
+  unsigned int i, b, pos;
+  uint64_t signs;
+  uint8_t buf[SHAKE256_RATE];
+  shake256incctx state;
+
+  shake256_inc_init(&state);
+  shake256_inc_absorb(&state, seed, CTILDEBYTES);
+  shake256_inc_finalize(&state);
+  shake256_squeezeblocks(buf, 1, &state);
+
+  signs = 0;
+  for(i = 0; i < 8; ++i)
+    signs |= (uint64_t)buf[i] << 8*i;
+  pos = 8;
+
+  for(i = 0; i < N; ++i)
+    c->coeffs[i] = 0;
+  for(i = N-TAU; i < N; ++i) {
+    do {
+      if(pos >= SHAKE256_RATE) {
+        shake256_squeezeblocks(buf, 1, &state);
+        pos = 0;
+      }
+
+      b = buf[pos++];
+    } while(b > i);
+
+    c->coeffs[i] = c->coeffs[b];
+    c->coeffs[b] = 1 - 2*(signs & 1);
+    signs >>= 1;
+  }
+  shake256_inc_ctx_release(&state);
+}
+
+/*************************************************
+* Name:        polyeta_pack
+*
+* Description: Bit-pack polynomial with coefficients in [-ETA,ETA].
+*
+* Arguments:   - uint8_t *r: pointer to output byte array with at least
+*                            POLYETA_PACKEDBYTES bytes
+*              - const poly *a: pointer to input polynomial
+**************************************************/
+void polyeta_pack(uint8_t *r, const poly *a) {
+  unsigned int i;
+  uint8_t t[8];
+  DBENCH_START();
+
+#if ETA == 2
+  for(i = 0; i < N/8; ++i) {
+    t[0] = ETA - a->coeffs[8*i+0];
+    t[1] = ETA - a->coeffs[8*i+1];
+    t[2] = ETA - a->coeffs[8*i+2];
+    t[3] = ETA - a->coeffs[8*i+3];
+    t[4] = ETA - a->coeffs[8*i+4];
+    t[5] = ETA - a->coeffs[8*i+5];
+    t[6] = ETA - a->coeffs[8*i+6];
+    t[7] = ETA - a->coeffs[8*i+7];
+
+    r[3*i+0]  = (t[0] >> 0) | (t[1] << 3) | (t[2] << 6);
+    r[3*i+1]  = (t[2] >> 2) | (t[3] << 1) | (t[4] << 4) | (t[5] << 7);
+    r[3*i+2]  = (t[5] >> 1) | (t[6] << 2) | (t[7] << 5);
+  }
+#elif ETA == 4
+  for(i = 0; i < N/2; ++i) {
+    t[0] = ETA - a->coeffs[2*i+0];
+    t[1] = ETA - a->coeffs[2*i+1];
+    r[i] = t[0] | (t[1] << 4);
+  }
+#endif
+
+  DBENCH_STOP(*tpack);
+}
+
+/*************************************************
+* Name:        polyeta_unpack
+*
+* Description: Unpack polynomial with coefficients in [-ETA,ETA].
+*
+* Arguments:   - poly *r: pointer to output polynomial
+*              - const uint8_t *a: byte array with bit-packed polynomial
+**************************************************/
+void polyeta_unpack(poly *r, const uint8_t *a) {
+  unsigned int i;
+  DBENCH_START();
+
+#if ETA == 2
+  for(i = 0; i < N/8; ++i) {
+    r->coeffs[8*i+0] =  (a[3*i+0] >> 0) & 7;
+    r->coeffs[8*i+1] =  (a[3*i+0] >> 3) & 7;
+    r->coeffs[8*i+2] = ((a[3*i+0] >> 6) | (a[3*i+1] << 2)) & 7;
+    r->coeffs[8*i+3] =  (a[3*i+1] >> 1) & 7;
+    r->coeffs[8*i+4] =  (a[3*i+1] >> 4) & 7;
+    r->coeffs[8*i+5] = ((a[3*i+1] >> 7) | (a[3*i+2] << 1)) & 7;
+    r->coeffs[8*i+6] =  (a[3*i+2] >> 2) & 7;
+    r->coeffs[8*i+7] =  (a[3*i+2] >> 5) & 7;
+
+    r->coeffs[8*i+0] = ETA - r->coeffs[8*i+0];
+    r->coeffs[8*i+1] = ETA - r->coeffs[8*i+1];
+    r->coeffs[8*i+2] = ETA - r->coeffs[8*i+2];
+    r->coeffs[8*i+3] = ETA - r->coeffs[8*i+3];
+    r->coeffs[8*i+4] = ETA - r->coeffs[8*i+4];
+    r->coeffs[8*i+5] = ETA - r->coeffs[8*i+5];
+    r->coeffs[8*i+6] = ETA - r->coeffs[8*i+6];
+    r->coeffs[8*i+7] = ETA - r->coeffs[8*i+7];
+  }
+#elif ETA == 4
+  for(i = 0; i < N/2; ++i) {
+    r->coeffs[2*i+0] = a[i] & 0x0F;
+    r->coeffs[2*i+1] = a[i] >> 4;
+    r->coeffs[2*i+0] = ETA - r->coeffs[2*i+0];
+    r->coeffs[2*i+1] = ETA - r->coeffs[2*i+1];
+  }
+#endif
+
+  DBENCH_STOP(*tpack);
+}
+
+/*************************************************
+* Name:        polyt1_pack
+*
+* Description: Bit-pack polynomial t1 with coefficients fitting in 10 bits.
+*              Input coefficients are assumed to be standard representatives.
+*
+* Arguments:   - uint8_t *r: pointer to output byte array with at least
+*                            POLYT1_PACKEDBYTES bytes
+*              - const poly *a: pointer to input polynomial
+**************************************************/
+void polyt1_pack(uint8_t *r, const poly *a) {
+  unsigned int i;
+  DBENCH_START();
+
+  for(i = 0; i < N/4; ++i) {
+    r[5*i+0] = (a->coeffs[4*i+0] >> 0);
+    r[5*i+1] = (a->coeffs[4*i+0] >> 8) | (a->coeffs[4*i+1] << 2);
+    r[5*i+2] = (a->coeffs[4*i+1] >> 6) | (a->coeffs[4*i+2] << 4);
+    r[5*i+3] = (a->coeffs[4*i+2] >> 4) | (a->coeffs[4*i+3] << 6);
+    r[5*i+4] = (a->coeffs[4*i+3] >> 2);
+  }
+
+  DBENCH_STOP(*tpack);
+}
+
+/*************************************************
+* Name:        polyt1_unpack
+*
+* Description: Unpack polynomial t1 with 10-bit coefficients.
+*              Output coefficients are standard representatives.
+*
+* Arguments:   - poly *r: pointer to output polynomial
+*              - const uint8_t *a: byte array with bit-packed polynomial
+**************************************************/
+void polyt1_unpack(poly *r, const uint8_t *a) {
+  unsigned int i;
+  DBENCH_START();
+
+  for(i = 0; i < N/4; ++i) {
+    r->coeffs[4*i+0] = ((a[5*i+0] >> 0) | ((uint32_t)a[5*i+1] << 8)) & 0x3FF;
+    r->coeffs[4*i+1] = ((a[5*i+1] >> 2) | ((uint32_t)a[5*i+2] << 6)) & 0x3FF;
+    r->coeffs[4*i+2] = ((a[5*i+2] >> 4) | ((uint32_t)a[5*i+3] << 4)) & 0x3FF;
+    r->coeffs[4*i+3] = ((a[5*i+3] >> 6) | ((uint32_t)a[5*i+4] << 2)) & 0x3FF;
+  }
+
+  DBENCH_STOP(*tpack);
+}
+
+/*************************************************
+* Name:        polyt0_pack
+*
+* Description: Bit-pack polynomial t0 with coefficients in ]-2^{D-1}, 2^{D-1}].
+*
+* Arguments:   - uint8_t *r: pointer to output byte array with at least
+*                            POLYT0_PACKEDBYTES bytes
+*              - const poly *a: pointer to input polynomial
+**************************************************/
+void polyt0_pack(uint8_t *r, const poly *a) {
+  unsigned int i;
+  uint32_t t[8];
+  DBENCH_START();
+
+  for(i = 0; i < N/8; ++i) {
+    t[0] = (1 << (D-1)) - a->coeffs[8*i+0];
+    t[1] = (1 << (D-1)) - a->coeffs[8*i+1];
+    t[2] = (1 << (D-1)) - a->coeffs[8*i+2];
+    t[3] = (1 << (D-1)) - a->coeffs[8*i+3];
+    t[4] = (1 << (D-1)) - a->coeffs[8*i+4];
+    t[5] = (1 << (D-1)) - a->coeffs[8*i+5];
+    t[6] = (1 << (D-1)) - a->coeffs[8*i+6];
+    t[7] = (1 << (D-1)) - a->coeffs[8*i+7];
+
+    r[13*i+ 0]  =  t[0];
+    r[13*i+ 1]  =  t[0] >>  8;
+    r[13*i+ 1] |=  t[1] <<  5;
+    r[13*i+ 2]  =  t[1] >>  3;
+    r[13*i+ 3]  =  t[1] >> 11;
+    r[13*i+ 3] |=  t[2] <<  2;
+    r[13*i+ 4]  =  t[2] >>  6;
+    r[13*i+ 4] |=  t[3] <<  7;
+    r[13*i+ 5]  =  t[3] >>  1;
+    r[13*i+ 6]  =  t[3] >>  9;
+    r[13*i+ 6] |=  t[4] <<  4;
+    r[13*i+ 7]  =  t[4] >>  4;
+    r[13*i+ 8]  =  t[4] >> 12;
+    r[13*i+ 8] |=  t[5] <<  1;
+    r[13*i+ 9]  =  t[5] >>  7;
+    r[13*i+ 9] |=  t[6] <<  6;
+    r[13*i+10]  =  t[6] >>  2;
+    r[13*i+11]  =  t[6] >> 10;
+    r[13*i+11] |=  t[7] <<  3;
+    r[13*i+12]  =  t[7] >>  5;
+  }
+
+  DBENCH_STOP(*tpack);
+}
+
+/*************************************************
+* Name:        polyt0_unpack
+*
+* Description: Unpack polynomial t0 with coefficients in ]-2^{D-1}, 2^{D-1}].
+*
+* Arguments:   - poly *r: pointer to output polynomial
+*              - const uint8_t *a: byte array with bit-packed polynomial
+**************************************************/
+void polyt0_unpack(poly *r, const uint8_t *a) {
+  unsigned int i;
+  DBENCH_START();
+
+  for(i = 0; i < N/8; ++i) {
+    r->coeffs[8*i+0]  = a[13*i+0];
+    r->coeffs[8*i+0] |= (uint32_t)a[13*i+1] << 8;
+    r->coeffs[8*i+0] &= 0x1FFF;
+
+    r->coeffs[8*i+1]  = a[13*i+1] >> 5;
+    r->coeffs[8*i+1] |= (uint32_t)a[13*i+2] << 3;
+    r->coeffs[8*i+1] |= (uint32_t)a[13*i+3] << 11;
+    r->coeffs[8*i+1] &= 0x1FFF;
+
+    r->coeffs[8*i+2]  = a[13*i+3] >> 2;
+    r->coeffs[8*i+2] |= (uint32_t)a[13*i+4] << 6;
+    r->coeffs[8*i+2] &= 0x1FFF;
+
+    r->coeffs[8*i+3]  = a[13*i+4] >> 7;
+    r->coeffs[8*i+3] |= (uint32_t)a[13*i+5] << 1;
+    r->coeffs[8*i+3] |= (uint32_t)a[13*i+6] << 9;
+    r->coeffs[8*i+3] &= 0x1FFF;
+
+    r->coeffs[8*i+4]  = a[13*i+6] >> 4;
+    r->coeffs[8*i+4] |= (uint32_t)a[13*i+7] << 4;
+    r->coeffs[8*i+4] |= (uint32_t)a[13*i+8] << 12;
+    r->coeffs[8*i+4] &= 0x1FFF;
+
+    r->coeffs[8*i+5]  = a[13*i+8] >> 1;
+    r->coeffs[8*i+5] |= (uint32_t)a[13*i+9] << 7;
+    r->coeffs[8*i+5] &= 0x1FFF;
+
+    r->coeffs[8*i+6]  = a[13*i+9] >> 6;
+    r->coeffs[8*i+6] |= (uint32_t)a[13*i+10] << 2;
+    r->coeffs[8*i+6] |= (uint32_t)a[13*i+11] << 10;
+    r->coeffs[8*i+6] &= 0x1FFF;
+
+    r->coeffs[8*i+7]  = a[13*i+11] >> 3;
+    r->coeffs[8*i+7] |= (uint32_t)a[13*i+12] << 5;
+    r->coeffs[8*i+7] &= 0x1FFF;
+
+    r->coeffs[8*i+0] = (1 << (D-1)) - r->coeffs[8*i+0];
+    r->coeffs[8*i+1] = (1 << (D-1)) - r->coeffs[8*i+1];
+    r->coeffs[8*i+2] = (1 << (D-1)) - r->coeffs[8*i+2];
+    r->coeffs[8*i+3] = (1 << (D-1)) - r->coeffs[8*i+3];
+    r->coeffs[8*i+4] = (1 << (D-1)) - r->coeffs[8*i+4];
+    r->coeffs[8*i+5] = (1 << (D-1)) - r->coeffs[8*i+5];
+    r->coeffs[8*i+6] = (1 << (D-1)) - r->coeffs[8*i+6];
+    r->coeffs[8*i+7] = (1 << (D-1)) - r->coeffs[8*i+7];
+  }
+
+  DBENCH_STOP(*tpack);
+}
+
+/*************************************************
+* Name:        polyz_pack
+*
+* Description: Bit-pack polynomial with coefficients
+*              in [-(GAMMA1 - 1), GAMMA1].
+*
+* Arguments:   - uint8_t *r: pointer to output byte array with at least
+*                            POLYZ_PACKEDBYTES bytes
+*              - const poly *a: pointer to input polynomial
+**************************************************/
+void polyz_pack(uint8_t *r, const poly *a) {
+  unsigned int i;
+  uint32_t t[4];
+  DBENCH_START();
+
+#if GAMMA1 == (1 << 17)
+  for(i = 0; i < N/4; ++i) {
+    t[0] = GAMMA1 - a->coeffs[4*i+0];
+    t[1] = GAMMA1 - a->coeffs[4*i+1];
+    t[2] = GAMMA1 - a->coeffs[4*i+2];
+    t[3] = GAMMA1 - a->coeffs[4*i+3];
+
+    r[9*i+0]  = t[0];
+    r[9*i+1]  = t[0] >> 8;
+    r[9*i+2]  = t[0] >> 16;
+    r[9*i+2] |= t[1] << 2;
+    r[9*i+3]  = t[1] >> 6;
+    r[9*i+4]  = t[1] >> 14;
+    r[9*i+4] |= t[2] << 4;
+    r[9*i+5]  = t[2] >> 4;
+    r[9*i+6]  = t[2] >> 12;
+    r[9*i+6] |= t[3] << 6;
+    r[9*i+7]  = t[3] >> 2;
+    r[9*i+8]  = t[3] >> 10;
+  }
+#elif GAMMA1 == (1 << 19)
+  for(i = 0; i < N/2; ++i) {
+    t[0] = GAMMA1 - a->coeffs[2*i+0];
+    t[1] = GAMMA1 - a->coeffs[2*i+1];
+
+    r[5*i+0]  = t[0];
+    r[5*i+1]  = t[0] >> 8;
+    r[5*i+2]  = t[0] >> 16;
+    r[5*i+2] |= t[1] << 4;
+    r[5*i+3]  = t[1] >> 4;
+    r[5*i+4]  = t[1] >> 12;
+  }
+#endif
+
+  DBENCH_STOP(*tpack);
+}
+
+/*************************************************
+* Name:        polyz_unpack
+*
+* Description: Unpack polynomial z with coefficients
+*              in [-(GAMMA1 - 1), GAMMA1].
+*
+* Arguments:   - poly *r: pointer to output polynomial
+*              - const uint8_t *a: byte array with bit-packed polynomial
+**************************************************/
+void polyz_unpack(poly *r, const uint8_t *a) {
+  unsigned int i;
+  DBENCH_START();
+
+#if GAMMA1 == (1 << 17)
+  for(i = 0; i < N/4; ++i) {
+    r->coeffs[4*i+0]  = a[9*i+0];
+    r->coeffs[4*i+0] |= (uint32_t)a[9*i+1] << 8;
+    r->coeffs[4*i+0] |= (uint32_t)a[9*i+2] << 16;
+    r->coeffs[4*i+0] &= 0x3FFFF;
+
+    r->coeffs[4*i+1]  = a[9*i+2] >> 2;
+    r->coeffs[4*i+1] |= (uint32_t)a[9*i+3] << 6;
+    r->coeffs[4*i+1] |= (uint32_t)a[9*i+4] << 14;
+    r->coeffs[4*i+1] &= 0x3FFFF;
+
+    r->coeffs[4*i+2]  = a[9*i+4] >> 4;
+    r->coeffs[4*i+2] |= (uint32_t)a[9*i+5] << 4;
+    r->coeffs[4*i+2] |= (uint32_t)a[9*i+6] << 12;
+    r->coeffs[4*i+2] &= 0x3FFFF;
+
+    r->coeffs[4*i+3]  = a[9*i+6] >> 6;
+    r->coeffs[4*i+3] |= (uint32_t)a[9*i+7] << 2;
+    r->coeffs[4*i+3] |= (uint32_t)a[9*i+8] << 10;
+    r->coeffs[4*i+3] &= 0x3FFFF;
+
+    r->coeffs[4*i+0] = GAMMA1 - r->coeffs[4*i+0];
+    r->coeffs[4*i+1] = GAMMA1 - r->coeffs[4*i+1];
+    r->coeffs[4*i+2] = GAMMA1 - r->coeffs[4*i+2];
+    r->coeffs[4*i+3] = GAMMA1 - r->coeffs[4*i+3];
+  }
+#elif GAMMA1 == (1 << 19)
+  for(i = 0; i < N/2; ++i) {
+    r->coeffs[2*i+0]  = a[5*i+0];
+    r->coeffs[2*i+0] |= (uint32_t)a[5*i+1] << 8;
+    r->coeffs[2*i+0] |= (uint32_t)a[5*i+2] << 16;
+    r->coeffs[2*i+0] &= 0xFFFFF;
+
+    r->coeffs[2*i+1]  = a[5*i+2] >> 4;
+    r->coeffs[2*i+1] |= (uint32_t)a[5*i+3] << 4;
+    r->coeffs[2*i+1] |= (uint32_t)a[5*i+4] << 12;
+    /* r->coeffs[2*i+1] &= 0xFFFFF; */ /* No effect, since we're anyway at 20 bits */
+
+    r->coeffs[2*i+0] = GAMMA1 - r->coeffs[2*i+0];
+    r->coeffs[2*i+1] = GAMMA1 - r->coeffs[2*i+1];
+  }
+#endif
+
+  DBENCH_STOP(*tpack);
+}
+
+/*************************************************
+* Name:        polyw1_pack
+*
+* Description: Bit-pack polynomial w1 with coefficients in [0,15] or [0,43].
+*              Input coefficients are assumed to be standard representatives.
+*
+* Arguments:   - uint8_t *r: pointer to output byte array with at least
+*                            POLYW1_PACKEDBYTES bytes
+*              - const poly *a: pointer to input polynomial
+**************************************************/
+void polyw1_pack(uint8_t *r, const poly *a) {
+  unsigned int i;
+  DBENCH_START();
+
+#if GAMMA2 == (Q-1)/88
+  for(i = 0; i < N/4; ++i) {
+    r[3*i+0]  = a->coeffs[4*i+0];
+    r[3*i+0] |= a->coeffs[4*i+1] << 6;
+    r[3*i+1]  = a->coeffs[4*i+1] >> 2;
+    r[3*i+1] |= a->coeffs[4*i+2] << 4;
+    r[3*i+2]  = a->coeffs[4*i+2] >> 4;
+    r[3*i+2] |= a->coeffs[4*i+3] << 2;
+  }
+#elif GAMMA2 == (Q-1)/32
+  for(i = 0; i < N/2; ++i)
+    r[i] = a->coeffs[2*i+0] | (a->coeffs[2*i+1] << 4);
+#endif
+
+  DBENCH_STOP(*tpack);
+}
@@ -9,6 +9,9 @@
 #include "randombytes.h"
 #include "symmetric.h"
 #include "fips202.h"
+#if defined(OQS_ML_DSA_SPECULATIVE_SIGN)
+#include "sign_speculative.h"
+#endif
 
 static inline void polyvec_matrix_expand_row(polyvecl **row, polyvecl buf[2], const uint8_t rho[SEEDBYTES], unsigned int i) {
   switch(i) {
@@ -52,18 +55,21 @@ static inline void polyvec_matrix_expand_row(polyvecl **row, polyvecl buf[2], co
 }
 
 /*************************************************
-* Name:        crypto_sign_keypair
+* Name:        crypto_sign_keypair_internal
 *
-* Description: Generates public and private key.
+* Description: Generates public and private key from a seed
+*              (ML-DSA.KeyGen_internal in FIPS 204).
 *
 * Arguments:   - uint8_t *pk: pointer to output public key (allocated
 *                             array of CRYPTO_PUBLICKEYBYTES bytes)
 *              - uint8_t *sk: pointer to output private key (allocated
 *                             array of CRYPTO_SECRETKEYBYTES bytes)
+*              - const uint8_t *seed: pointer to input seed xi (of
+*                                     length SEEDBYTES)
 *
 * Returns 0 (success)
 **************************************************/
-int crypto_sign_keypair(uint8_t *pk, uint8_t *sk) {
+int crypto_sign_keypair_internal(uint8_t *pk, uint8_t *sk, const uint8_t seed[SEEDBYTES]) {
   unsigned int i;
   uint8_t seedbuf[2*SEEDBYTES + CRHBYTES];
   const uint8_t *rho, *rhoprime, *key;
@@ -72,8 +78,8 @@ int crypto_sign_keypair(uint8_t *pk, uint8_t *sk) {
   polyveck s2;
   poly t1, t0;
 
-  /* Get randomness for rho, rhoprime and key */
-  randombytes(seedbuf, SEEDBYTES);
+  /* Expand seed into rho, rhoprime and key */
+  memcpy(seedbuf, seed, SEEDBYTES);
   seedbuf[SEEDBYTES+0] = K;
   seedbuf[SEEDBYTES+1] = L;
   shake256(seedbuf, 2*SEEDBYTES + CRHBYTES, seedbuf, SEEDBYTES+2);
@@ -137,32 +143,60 @@ int crypto_sign_keypair(uint8_t *pk, uint8_t *sk) {
 }
 
 /*************************************************
-* Name:        crypto_sign_signature_internal
+* Name:        crypto_sign_keypair
 *
-* Description: Computes signature. Internal API.
+* Description: Generates public and private key.
 *
-* Arguments:   - uint8_t *sig: pointer to output signature (of length CRYPTO_BYTES)
-*              - size_t *siglen: pointer to output length of signature
-*              - uint8_t *m: pointer to message to be signed
-*              - size_t mlen: length of message
-*              - uint8_t *pre: pointer to prefix string
-*              - size_t prelen: length of prefix string
-*              - uint8_t *rnd: pointer to random seed
-*              - uint8_t *sk: pointer to bit-packed secret key
+* Arguments:   - uint8_t *pk: pointer to output public key (allocated
+*                             array of CRYPTO_PUBLICKEYBYTES bytes)
+*              - uint8_t *sk: pointer to output private key (allocated
+*                             array of CRYPTO_SECRETKEYBYTES bytes)
 *
 * Returns 0 (success)
 **************************************************/
-int crypto_sign_signature_internal(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen,
-                                   const uint8_t *pre, size_t prelen, const uint8_t rnd[RNDBYTES], const uint8_t *sk)
+int crypto_sign_keypair(uint8_t *pk, uint8_t *sk) {
+  uint8_t seed[SEEDBYTES];
+  int ret;
+
+  randombytes(seed, SEEDBYTES);
+  ret = crypto_sign_keypair_internal(pk, sk, seed);
+  OQS_MEM_cleanse(seed, SEEDBYTES);
+  return ret;
+}
+
+typedef struct {
+  const uint8_t *mu;
+  const uint8_t *rhoprime;
+  const polyvecl *mat;
+  const polyvecl *s1;
+  const polyveck *s2;
+  const polyveck *t0;
+} sign_precomp;
+
+/*************************************************
+* Name:        sign_attempt
+*
+* Description: One iteration of the rejection sampling loop of
+*              crypto_sign_signature_internal, using the mask
+*              sampled with nonces L*attempt, ..., L*attempt + L-1.
+*              Attempts are independent of each other given the
+*              precomputed values.
+*
+* Arguments:   - uint8_t *sig: pointer to output signature (of length CRYPTO_BYTES)
+*              - void *arg: pointer to sign_precomp
+*              - uint64_t attempt: attempt number
+*
+* Returns 0 if the signature is accepted and written to sig, -1 otherwise
+**************************************************/
+static int sign_attempt(uint8_t *sig, const void *arg, uint64_t attempt)
 {
+  const sign_precomp *precomp = arg;
   unsigned int i, n, pos;
-  uint8_t seedbuf[2*SEEDBYTES + TRBYTES + 2*CRHBYTES];
-  uint8_t *rho, *tr, *key, *mu, *rhoprime;
   uint8_t hintbuf[N];
   uint8_t *hint = sig + CTILDEBYTES + L*POLYZ_PACKEDBYTES;
-  uint64_t nonce = 0;
-  polyvecl mat[K], s1, z;
-  polyveck t0, s2, w1;
+  uint64_t nonce = L*attempt;
+  polyvecl z;
+  polyveck w1;
   poly c, tmp;
   union {
     polyvecl y;
@@ -170,52 +204,19 @@ int crypto_sign_signature_internal(uint8_t *sig, size_t *siglen, const uint8_t *
   } tmpv;
   shake256incctx state;
 
-  rho = seedbuf;
-  tr = rho + SEEDBYTES;
-  key = tr + TRBYTES;
-  mu = key + SEEDBYTES;
-  rhoprime = mu + CRHBYTES;
-  unpack_sk(rho, tr, key, &t0, &s1, &s2, sk);
-
-  /* Compute mu = CRH(tr, pre, msg) */
-  shake256_inc_init(&state);
-  shake256_inc_absorb(&state, tr, TRBYTES);
-  shake256_inc_absorb(&state, pre, prelen);
-  shake256_inc_absorb(&state, m, mlen);
-  shake256_inc_finalize(&state);
-  shake256_inc_squeeze(mu, CRHBYTES, &state);
-
-  /* Compute rhoprime = CRH(key, rnd, mu) */
-  shake256_inc_ctx_reset(&state);
-  shake256_inc_absorb(&state, key, SEEDBYTES);
-  shake256_inc_absorb(&state, rnd, RNDBYTES);
-  shake256_inc_absorb(&state, mu, CRHBYTES);
-  shake256_inc_finalize(&state);
-  shake256_inc_squeeze(rhoprime, CRHBYTES, &state);
-
-  /* Expand matrix and transform vectors */
-  polyvec_matrix_expand(mat, rho);
-  polyvecl_ntt(&s1);
-  polyveck_ntt(&s2);
-  polyveck_ntt(&t0);
-
-rej:
   /* Sample intermediate vector y */
 #if L == 4
   poly_uniform_gamma1_4x(&z.vec[0], &z.vec[1], &z.vec[2], &z.vec[3],
-                         rhoprime, nonce, nonce + 1, nonce + 2, nonce + 3);
-  nonce += 4;
+                         precomp->rhoprime, nonce, nonce + 1, nonce + 2, nonce + 3);
 #elif L == 5
   poly_uniform_gamma1_4x(&z.vec[0], &z.vec[1], &z.vec[2], &z.vec[3],
-                         rhoprime, nonce, nonce + 1, nonce + 2, nonce + 3);
-  poly_uniform_gamma1(&z.vec[4], rhoprime, nonce + 4);
-  nonce += 5;
+                         precomp->rhoprime, nonce, nonce + 1, nonce + 2, nonce + 3);
+  poly_uniform_gamma1(&z.vec[4], precomp->rhoprime, nonce + 4);
 #elif L == 7
   poly_uniform_gamma1_4x(&z.vec[0], &z.vec[1], &z.vec[2], &z.vec[3],
-                         rhoprime, nonce, nonce + 1, nonce + 2, nonce + 3);
+                         precomp->rhoprime, nonce, nonce + 1, nonce + 2, nonce + 3);
   poly_uniform_gamma1_4x(&z.vec[4], &z.vec[5], &z.vec[6], &tmp,
-                         rhoprime, nonce + 4, nonce + 5, nonce + 6, 0);
-  nonce += 7;
+                         precomp->rhoprime, nonce + 4, nonce + 5, nonce + 6, 0);
 #else
 #error
 #endif
@@ -223,7 +224,7 @@ rej:
   /* Matrix-vector product */
   tmpv.y = z;
   polyvecl_ntt(&tmpv.y);
-  polyvec_matrix_pointwise_montgomery(&w1, mat, &tmpv.y);
+  polyvec_matrix_pointwise_montgomery(&w1, precomp->mat, &tmpv.y);
   polyveck_invntt_tomont(&w1);
 
   /* Decompose w and call the random oracle */
@@ -231,22 +232,23 @@ rej:
   polyveck_decompose(&w1, &tmpv.w0, &w1);
   polyveck_pack_w1(sig, &w1);
 
-  shake256_inc_ctx_reset(&state);
-  shake256_inc_absorb(&state, mu, CRHBYTES);
+  shake256_inc_init(&state);
+  shake256_inc_absorb(&state, precomp->mu, CRHBYTES);
   shake256_inc_absorb(&state, sig, K*POLYW1_PACKEDBYTES);
   shake256_inc_finalize(&state);
   shake256_inc_squeeze(sig, CTILDEBYTES, &state);
+  shake256_inc_ctx_release(&state);
   poly_challenge(&c, sig);
   poly_ntt(&c);
 
   /* Compute z, reject if it reveals secret */
   for(i = 0; i < L; i++) {
-    poly_pointwise_montgomery(&tmp, &c, &s1.vec[i]);
+    poly_pointwise_montgomery(&tmp, &c, &precomp->s1->vec[i]);
     poly_invntt_tomont(&tmp);
     poly_add(&z.vec[i], &z.vec[i], &tmp);
     poly_reduce(&z.vec[i]);
     if(poly_chknorm(&z.vec[i], GAMMA1 - BETA))
-      goto rej;
+      return -1;
   }
 
   /* Zero hint vector in signature */
@@ -256,35 +258,109 @@ rej:
   for(i = 0; i < K; i++) {
     /* Check that subtracting cs2 does not change high bits of w and low bits
      * do not reveal secret information */
-    poly_pointwise_montgomery(&tmp, &c, &s2.vec[i]);
+    poly_pointwise_montgomery(&tmp, &c, &precomp->s2->vec[i]);
     poly_invntt_tomont(&tmp);
     poly_sub(&tmpv.w0.vec[i], &tmpv.w0.vec[i], &tmp);
     poly_reduce(&tmpv.w0.vec[i]);
     if(poly_chknorm(&tmpv.w0.vec[i], GAMMA2 - BETA))
-      goto rej;
+      return -1;
 
     /* Compute hints */
-    poly_pointwise_montgomery(&tmp, &c, &t0.vec[i]);
+    poly_pointwise_montgomery(&tmp, &c, &precomp->t0->vec[i]);
     poly_invntt_tomont(&tmp);
     poly_reduce(&tmp);
     if(poly_chknorm(&tmp, GAMMA2))
-      goto rej;
+      return -1;
 
     poly_add(&tmpv.w0.vec[i], &tmpv.w0.vec[i], &tmp);
     n = poly_make_hint(hintbuf, &tmpv.w0.vec[i], &w1.vec[i]);
     if(pos + n > OMEGA)
-      goto rej;
+      return -1;
 
     /* Store hints in signature */
     memcpy(&hint[pos], hintbuf, n);
     hint[OMEGA + i] = pos = pos + n;
   }
 
-  shake256_inc_ctx_release(&state);
   /* Pack z into signature */
   for(i = 0; i < L; i++)
     polyz_pack(sig + CTILDEBYTES + i*POLYZ_PACKEDBYTES, &z.vec[i]);
 
+  return 0;
+}
+
+/*************************************************
+* Name:        crypto_sign_signature_internal
+*
+* Description: Computes signature. Internal API.
+*
+* Arguments:   - uint8_t *sig: pointer to output signature (of length CRYPTO_BYTES)
+*              - size_t *siglen: pointer to output length of signature
+*              - uint8_t *m: pointer to message to be signed
+*              - size_t mlen: length of message
+*              - uint8_t *pre: pointer to prefix string
+*              - size_t prelen: length of prefix string
+*              - uint8_t *rnd: pointer to random seed
+*              - uint8_t *sk: pointer to bit-packed secret key
+*
+* Returns 0 (success)
+**************************************************/
+int crypto_sign_signature_internal(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen,
+                                   const uint8_t *pre, size_t prelen, const uint8_t rnd[RNDBYTES], const uint8_t *sk)
+{
+  uint8_t seedbuf[2*SEEDBYTES + TRBYTES + 2*CRHBYTES];
+  uint8_t *rho, *tr, *key, *mu, *rhoprime;
+  polyvecl mat[K], s1;
+  polyveck t0, s2;
+  shake256incctx state;
+  sign_precomp precomp;
+#if !defined(OQS_ML_DSA_SPECULATIVE_SIGN)
+  uint64_t nonce;
+#endif
+
+  rho = seedbuf;
+  tr = rho + SEEDBYTES;
+  key = tr + TRBYTES;
+  mu = key + SEEDBYTES;
+  rhoprime = mu + CRHBYTES;
+  unpack_sk(rho, tr, key, &t0, &s1, &s2, sk);
+
+  /* Compute mu = CRH(tr, pre, msg) */
+  shake256_inc_init(&state);
+  shake256_inc_absorb(&state, tr, TRBYTES);
+  shake256_inc_absorb(&state, pre, prelen);
+  shake256_inc_absorb(&state, m, mlen);
+  shake256_inc_finalize(&state);
+  shake256_inc_squeeze(mu, CRHBYTES, &state);
+
+  /* Compute rhoprime = CRH(key, rnd, mu) */
+  shake256_inc_ctx_reset(&state);
+  shake256_inc_absorb(&state, key, SEEDBYTES);
+  shake256_inc_absorb(&state, rnd, RNDBYTES);
+  shake256_inc_absorb(&state, mu, CRHBYTES);
+  shake256_inc_finalize(&state);
+  shake256_inc_squeeze(rhoprime, CRHBYTES, &state);
+
+  /* Expand matrix and transform vectors */
+  polyvec_matrix_expand(mat, rho);
+  polyvecl_ntt(&s1);
+  polyveck_ntt(&s2);
+  polyveck_ntt(&t0);
+
+  precomp.mu = mu;
+  precomp.rhoprime = rhoprime;
+  precomp.mat = mat;
+  precomp.s1 = &s1;
+  precomp.s2 = &s2;
+  precomp.t0 = &t0;
+#if defined(OQS_ML_DSA_SPECULATIVE_SIGN)
+  crypto_sign_speculative_search(sig, sign_attempt, &precomp);
+#else
+  for(nonce = 0; sign_attempt(sig, &precomp, nonce); nonce++)
+    ;
+#endif
+
+  shake256_inc_ctx_release(&state);
   *siglen = CRYPTO_BYTES;
   return 0;
 }
@@ -1,8 +1,12 @@
 #include <stdint.h>
+#include <oqs/common.h>
 #include "params.h"
 #include "ntt.h"
 #include "reduce.h"
 
+/* Replaced by vecext/ntt_vecext.c when OQS_USE_VECTOR_EXTENSIONS is set */
+#if !defined(OQS_USE_VECTOR_EXTENSIONS)
+
 static const int32_t zetas[N] = {
          0,    25847, -2608894,  -518909,   237124,  -777960,  -876248,   466468,
    1826347,  2353451,  -359251, -2091905,  3119733, -2884855,  3111497,  2680103,
@@ -96,3 +100,5 @@ void invntt_tomont(int32_t a[N]) {
     a[j] = montgomery_reduce((int64_t)f * a[j]);
   }
 }
+
+#endif
@@ -4,10 +4,10 @@
 #include <stdint.h>
 #include "params.h"
 
-#define ntt DILITHIUM_NAMESPACE(ntt)
+#define ntt DILITHIUM_NAMESPACE_SHARED(ntt)
 void ntt(int32_t a[N]);
 
-#define invntt_tomont DILITHIUM_NAMESPACE(invntt_tomont)
+#define invntt_tomont DILITHIUM_NAMESPACE_SHARED(invntt_tomont)
 void invntt_tomont(int32_t a[N]);
 
 #endif
@@ -0,0 +1,34 @@
+#include <stdint.h>
+#include "params.h"
+#include "symmetric.h"
+#include "fips202.h"
+
+void dilithium_shake128_stream_init(shake128incctx *state, const uint8_t seed[SEEDBYTES], uint16_t nonce)
+{
+  unsigned int i;
+  uint8_t t[SEEDBYTES + 2];
+
+  /* seed || nonce fits in one block, so absorb it in a single call */
+  for (i = 0; i < SEEDBYTES; ++i)
+    t[i] = seed[i];
+  t[SEEDBYTES] = nonce;
+  t[SEEDBYTES + 1] = nonce >> 8;
+
+  shake128_inc_init(state);
+  shake128_absorb_once(state, t, SEEDBYTES + 2);
+}
+
+void dilithium_shake256_stream_init(shake256incctx *state, const uint8_t seed[CRHBYTES], uint16_t nonce)
+{
+  unsigned int i;
+  uint8_t t[CRHBYTES + 2];
+
+  /* seed || nonce fits in one block, so absorb it in a single call */
+  for (i = 0; i < CRHBYTES; ++i)
+    t[i] = seed[i];
+  t[CRHBYTES] = nonce;
+  t[CRHBYTES + 1] = nonce >> 8;
+
+  shake256_inc_init(state);
+  shake256_absorb_once(state, t, CRHBYTES + 2);
+}
@@ -21,8 +21,10 @@
 #define decorate(s) _##s
 #define _cdecl(s) decorate(s)
 #define cdecl(s) _cdecl(DILITHIUM_NAMESPACE(##s))
+#define cdecl_shared(s) _cdecl(DILITHIUM_NAMESPACE_SHARED(##s))
 #else
 #define cdecl(s) DILITHIUM_NAMESPACE(##s)
+#define cdecl_shared(s) DILITHIUM_NAMESPACE_SHARED(##s)
 #endif
 
 #ifndef __ASSEMBLER__
@@ -31,7 +33,7 @@
 
 typedef ALIGNED_INT32(624) qdata_t;
 
-#define qdata DILITHIUM_NAMESPACE(qdata)
+#define qdata DILITHIUM_NAMESPACE_SHARED(qdata)
 extern const qdata_t qdata;
 
 #endif
@@ -3,12 +3,12 @@
 
 #include <immintrin.h>
 
-#define ntt_avx DILITHIUM_NAMESPACE(ntt_avx)
+#define ntt_avx DILITHIUM_NAMESPACE_SHARED(ntt_avx)
 void ntt_avx(__m256i *a, const __m256i *qdata);
-#define invntt_avx DILITHIUM_NAMESPACE(invntt_avx)
+#define invntt_avx DILITHIUM_NAMESPACE_SHARED(invntt_avx)
 void invntt_avx(__m256i *a, const __m256i *qdata);
 
-#define nttunpack_avx DILITHIUM_NAMESPACE(nttunpack_avx)
+#define nttunpack_avx DILITHIUM_NAMESPACE_SHARED(nttunpack_avx)
 void nttunpack_avx(__m256i *a);
 
 #define pointwise_avx DILITHIUM_NAMESPACE(pointwise_avx)
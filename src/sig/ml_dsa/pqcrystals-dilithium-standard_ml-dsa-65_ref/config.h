@@ -24,4 +24,8 @@
 #define DILITHIUM_NAMESPACE(s) pqcrystals_ml_dsa_87_ref_##s
 #endif
 
+/* NTT and reductions do not depend on DILITHIUM_MODE; they are compiled
+ * once and shared by the three parameter sets (see CMakeLists.txt) */
+#define DILITHIUM_NAMESPACE_SHARED(s) pqcrystals_ml_dsa_ref_##s
+
 #endif
@@ -1,4 +1,5 @@
 #include <stdint.h>
+#include <oqs/common.h>
 #include "params.h"
 #include "poly.h"
 #include "ntt.h"
@@ -155,6 +156,7 @@ void poly_invntt_tomont(poly *a) {
 *              - const poly *a: pointer to first input polynomial
 *              - const poly *b: pointer to second input polynomial
 **************************************************/
+#if !defined(OQS_USE_VECTOR_EXTENSIONS)
 void poly_pointwise_montgomery(poly *c, const poly *a, const poly *b) {
   unsigned int i;
   DBENCH_START();
@@ -164,6 +166,7 @@ void poly_pointwise_montgomery(poly *c, const poly *a, const poly *b) {
 
   DBENCH_STOP(*tmul);
 }
+#endif
 
 /*************************************************
 * Name:        poly_power2round
@@ -1,4 +1,5 @@
 #include <stdint.h>
+#include <string.h>
 #include "params.h"
 #include "sign.h"
 #include "packing.h"
@@ -7,20 +8,26 @@
 #include "randombytes.h"
 #include "symmetric.h"
 #include "fips202.h"
+#if defined(OQS_ML_DSA_SPECULATIVE_SIGN)
+#include "sign_speculative.h"
+#endif
 
 /*************************************************
-* Name:        crypto_sign_keypair
+* Name:        crypto_sign_keypair_internal
 *
-* Description: Generates public and private key.
+* Description: Generates public and private key from a seed
+*              (ML-DSA.KeyGen_internal in FIPS 204).
 *
 * Arguments:   - uint8_t *pk: pointer to output public key (allocated
 *                             array of CRYPTO_PUBLICKEYBYTES bytes)
 *              - uint8_t *sk: pointer to output private key (allocated
 *                             array of CRYPTO_SECRETKEYBYTES bytes)
+*              - const uint8_t *seed: pointer to input seed xi (of
+*                                     length SEEDBYTES)
 *
 * Returns 0 (success)
 **************************************************/
-int crypto_sign_keypair(uint8_t *pk, uint8_t *sk) {
+int crypto_sign_keypair_internal(uint8_t *pk, uint8_t *sk, const uint8_t seed[SEEDBYTES]) {
   uint8_t seedbuf[2*SEEDBYTES + CRHBYTES];
   uint8_t tr[TRBYTES];
   const uint8_t *rho, *rhoprime, *key;
@@ -28,8 +35,8 @@ int crypto_sign_keypair(uint8_t *pk, uint8_t *sk) {
   polyvecl s1, s1hat;
   polyveck s2, t1, t0;
 
-  /* Get randomness for rho, rhoprime and key */
-  randombytes(seedbuf, SEEDBYTES);
+  /* Expand seed into rho, rhoprime and key */
+  memcpy(seedbuf, seed, SEEDBYTES);
   seedbuf[SEEDBYTES+0] = K;
   seedbuf[SEEDBYTES+1] = L;
   shake256(seedbuf, 2*SEEDBYTES + CRHBYTES, seedbuf, SEEDBYTES+2);
@@ -66,6 +73,118 @@ int crypto_sign_keypair(uint8_t *pk, uint8_t *sk) {
   return 0;
 }
 
+/*************************************************
+* Name:        crypto_sign_keypair
+*
+* Description: Generates public and private key.
+*
+* Arguments:   - uint8_t *pk: pointer to output public key (allocated
+*                             array of CRYPTO_PUBLICKEYBYTES bytes)
+*              - uint8_t *sk: pointer to output private key (allocated
+*                             array of CRYPTO_SECRETKEYBYTES bytes)
+*
+* Returns 0 (success)
+**************************************************/
+int crypto_sign_keypair(uint8_t *pk, uint8_t *sk) {
+  uint8_t seed[SEEDBYTES];
+  int ret;
+
+  randombytes(seed, SEEDBYTES);
+  ret = crypto_sign_keypair_internal(pk, sk, seed);
+  OQS_MEM_cleanse(seed, SEEDBYTES);
+  return ret;
+}
+
+typedef struct {
+  const uint8_t *mu;
+  const uint8_t *rhoprime;
+  const polyvecl *mat;
+  const polyvecl *s1;
+  const polyveck *s2;
+  const polyveck *t0;
+} sign_precomp;
+
+/*************************************************
+* Name:        sign_attempt
+*
+* Description: One iteration of the rejection sampling loop of
+*              crypto_sign_signature_internal, using the mask
+*              sampled with nonce. Attempts are independent of each
+*              other given the precomputed values.
+*
+* Arguments:   - uint8_t *sig:   pointer to output signature (of length CRYPTO_BYTES)
+*              - void *arg:      pointer to sign_precomp
+*              - uint64_t nonce: attempt number
+*
+* Returns 0 if the signature is accepted and written to sig, -1 otherwise
+**************************************************/
+static int sign_attempt(uint8_t *sig, const void *arg, uint64_t nonce)
+{
+  const sign_precomp *precomp = arg;
+  unsigned int n;
+  polyvecl y, z;
+  polyveck w1, w0, h;
+  poly cp;
+  shake256incctx state;
+
+  /* Sample intermediate vector y */
+  polyvecl_uniform_gamma1(&y, precomp->rhoprime, (uint16_t)nonce);
+
+  /* Matrix-vector multiplication */
+  z = y;
+  polyvecl_ntt(&z);
+  polyvec_matrix_pointwise_montgomery(&w1, precomp->mat, &z);
+  polyveck_reduce(&w1);
+  polyveck_invntt_tomont(&w1);
+
+  /* Decompose w and call the random oracle */
+  polyveck_caddq(&w1);
+  polyveck_decompose(&w1, &w0, &w1);
+  polyveck_pack_w1(sig, &w1);
+
+  shake256_inc_init(&state);
+  shake256_inc_absorb(&state, precomp->mu, CRHBYTES);
+  shake256_inc_absorb(&state, sig, K*POLYW1_PACKEDBYTES);
+  shake256_inc_finalize(&state);
+  shake256_inc_squeeze(sig, CTILDEBYTES, &state);
+  shake256_inc_ctx_release(&state);
+  poly_challenge(&cp, sig);
+  poly_ntt(&cp);
+
+  /* Compute z, reject if it reveals secret */
+  polyvecl_pointwise_poly_montgomery(&z, &cp, precomp->s1);
+  polyvecl_invntt_tomont(&z);
+  polyvecl_add(&z, &z, &y);
+  polyvecl_reduce(&z);
+  if(polyvecl_chknorm(&z, GAMMA1 - BETA))
+    return -1;
+
+  /* Check that subtracting cs2 does not change high bits of w and low bits
+   * do not reveal secret information */
+  polyveck_pointwise_poly_montgomery(&h, &cp, precomp->s2);
+  polyveck_invntt_tomont(&h);
+  polyveck_sub(&w0, &w0, &h);
+  polyveck_reduce(&w0);
+  if(polyveck_chknorm(&w0, GAMMA2 - BETA))
+    return -1;
+
+  /* Compute hints for w1 */
+  polyveck_pointwise_poly_montgomery(&h, &cp, precomp->t0);
+  polyveck_invntt_tomont(&h);
+  polyveck_reduce(&h);
+  if(polyveck_chknorm(&h, GAMMA2))
+    return -1;
+
+  polyveck_add(&w0, &w0, &h);
+  n = polyveck_make_hint(&h, &w0, &w1);
+  if(n > OMEGA)
+    return -1;
+
+  /* Write signature */
+  pack_sig(sig, sig, &z, &h);
+  return 0;
+}
+
 /*************************************************
 * Name:        crypto_sign_signature_internal
 *
@@ -91,14 +210,15 @@ int crypto_sign_signature_internal(uint8_t *sig,
                                    const uint8_t rnd[RNDBYTES],
                                    const uint8_t *sk)
 {
-  unsigned int n;
   uint8_t seedbuf[2*SEEDBYTES + TRBYTES + 2*CRHBYTES];
   uint8_t *rho, *tr, *key, *mu, *rhoprime;
-  uint16_t nonce = 0;
-  polyvecl mat[K], s1, y, z;
-  polyveck t0, s2, w1, w0, h;
-  poly cp;
+  polyvecl mat[K], s1;
+  polyveck t0, s2;
   shake256incctx state;
+  sign_precomp precomp;
+#if !defined(OQS_ML_DSA_SPECULATIVE_SIGN)
+  uint64_t nonce;
+#endif
 
   rho = seedbuf;
   tr = rho + SEEDBYTES;
@@ -129,63 +249,20 @@ int crypto_sign_signature_internal(uint8_t *sig,
   polyveck_ntt(&s2);
   polyveck_ntt(&t0);
 
-rej:
-  /* Sample intermediate vector y */
-  polyvecl_uniform_gamma1(&y, rhoprime, nonce++);
-
-  /* Matrix-vector multiplication */
-  z = y;
-  polyvecl_ntt(&z);
-  polyvec_matrix_pointwise_montgomery(&w1, mat, &z);
-  polyveck_reduce(&w1);
-  polyveck_invntt_tomont(&w1);
-
-  /* Decompose w and call the random oracle */
-  polyveck_caddq(&w1);
-  polyveck_decompose(&w1, &w0, &w1);
-  polyveck_pack_w1(sig, &w1);
-
-  shake256_inc_ctx_reset(&state);
-  shake256_inc_absorb(&state, mu, CRHBYTES);
-  shake256_inc_absorb(&state, sig, K*POLYW1_PACKEDBYTES);
-  shake256_inc_finalize(&state);
-  shake256_inc_squeeze(sig, CTILDEBYTES, &state);
-  poly_challenge(&cp, sig);
-  poly_ntt(&cp);
-
-  /* Compute z, reject if it reveals secret */
-  polyvecl_pointwise_poly_montgomery(&z, &cp, &s1);
-  polyvecl_invntt_tomont(&z);
-  polyvecl_add(&z, &z, &y);
-  polyvecl_reduce(&z);
-  if(polyvecl_chknorm(&z, GAMMA1 - BETA))
-    goto rej;
-
-  /* Check that subtracting cs2 does not change high bits of w and low bits
-   * do not reveal secret information */
-  polyveck_pointwise_poly_montgomery(&h, &cp, &s2);
-  polyveck_invntt_tomont(&h);
-  polyveck_sub(&w0, &w0, &h);
-  polyveck_reduce(&w0);
-  if(polyveck_chknorm(&w0, GAMMA2 - BETA))
-    goto rej;
-
-  /* Compute hints for w1 */
-  polyveck_pointwise_poly_montgomery(&h, &cp, &t0);
-  polyveck_invntt_tomont(&h);
-  polyveck_reduce(&h);
-  if(polyveck_chknorm(&h, GAMMA2))
-    goto rej;
-
-  polyveck_add(&w0, &w0, &h);
-  n = polyveck_make_hint(&h, &w0, &w1);
-  if(n > OMEGA)
-    goto rej;
+  precomp.mu = mu;
+  precomp.rhoprime = rhoprime;
+  precomp.mat = mat;
+  precomp.s1 = &s1;
+  precomp.s2 = &s2;
+  precomp.t0 = &t0;
+#if defined(OQS_ML_DSA_SPECULATIVE_SIGN)
+  crypto_sign_speculative_search(sig, sign_attempt, &precomp);
+#else
+  for(nonce = 0; sign_attempt(sig, &precomp, nonce); nonce++)
+    ;
+#endif
 
   shake256_inc_ctx_release(&state);
-
-  /* Write signature */
-  pack_sig(sig, sig, &z, &h);
   *siglen = CRYPTO_BYTES;
   return 0;
 }
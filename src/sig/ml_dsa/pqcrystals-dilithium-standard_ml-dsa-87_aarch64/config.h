@@ -0,0 +1,31 @@
+#ifndef CONFIG_H
+#define CONFIG_H
+
+//#define DILITHIUM_MODE 2
+#define DILITHIUM_RANDOMIZED_SIGNING
+//#define USE_RDPMC
+//#define DBENCH
+
+#ifndef DILITHIUM_MODE
+#define DILITHIUM_MODE 2
+#endif
+
+#if DILITHIUM_MODE == 2
+#define CRYPTO_ALGNAME "ML-DSA-44"
+#define DILITHIUM_NAMESPACETOP pqcrystals_ml_dsa_44_aarch64
+#define DILITHIUM_NAMESPACE(s) pqcrystals_ml_dsa_44_aarch64_##s
+#elif DILITHIUM_MODE == 3
+#define CRYPTO_ALGNAME "ML-DSA-65"
+#define DILITHIUM_NAMESPACETOP pqcrystals_ml_dsa_65_aarch64
+#define DILITHIUM_NAMESPACE(s) pqcrystals_ml_dsa_65_aarch64_##s
+#elif DILITHIUM_MODE == 5
+#define CRYPTO_ALGNAME "ML-DSA-87"
+#define DILITHIUM_NAMESPACETOP pqcrystals_ml_dsa_87_aarch64
+#define DILITHIUM_NAMESPACE(s) pqcrystals_ml_dsa_87_aarch64_##s
+#endif
+
+/* NTT and reductions do not depend on DILITHIUM_MODE; they are compiled
+ * once and shared by the three parameter sets (see CMakeLists.txt) */
+#define DILITHIUM_NAMESPACE_SHARED(s) pqcrystals_ml_dsa_aarch64_##s
+
+#endif
@@ -0,0 +1,68 @@
+#ifndef REDUCE_NEON_H
+#define REDUCE_NEON_H
+
+#include <arm_neon.h>
+#include <stdint.h>
+#include "params.h"
+#include "reduce.h"
+
+/*************************************************
+* Name:        montgomery_mul_precomp_neon
+*
+* Description: Montgomery multiplication of four coefficients by b, where
+*              bqinv = b*QINV mod 2^32 is precomputed. Computes the same
+*              representative as montgomery_reduce((int64_t)a*b): the high
+*              halves of 2*a*b and 2*t*Q, with t = a*b*QINV mod 2^32, differ
+*              by exactly twice the result.
+*
+* Arguments:   - int32x4_t a: input coefficients
+*              - int32x4_t b: second factors
+*              - int32x4_t bqinv: b*QINV mod 2^32
+*
+* Returns a*b*2^{-32} mod Q in (-Q, Q).
+**************************************************/
+static inline int32x4_t montgomery_mul_precomp_neon(int32x4_t a, int32x4_t b, int32x4_t bqinv) {
+  int32x4_t hi, t;
+
+  hi = vqdmulhq_s32(a, b);
+  t = vmulq_s32(a, bqinv);
+  t = vqdmulhq_s32(t, vdupq_n_s32(Q));
+  return vhsubq_s32(hi, t);
+}
+
+/*************************************************
+* Name:        montgomery_mul_neon
+*
+* Description: Montgomery multiplication of four pairs of coefficients.
+*              Same result as montgomery_reduce((int64_t)a*b).
+*
+* Arguments:   - int32x4_t a, b: input coefficients
+*
+* Returns a*b*2^{-32} mod Q in (-Q, Q).
+**************************************************/
+static inline int32x4_t montgomery_mul_neon(int32x4_t a, int32x4_t b) {
+  return montgomery_mul_precomp_neon(a, b, vmulq_s32(b, vdupq_n_s32(QINV)));
+}
+
+/*************************************************
+* Name:        reduce32_neon
+*
+* Description: Same as reduce32 for four coefficients.
+**************************************************/
+static inline int32x4_t reduce32_neon(int32x4_t a) {
+  int32x4_t t;
+
+  t = vshrq_n_s32(vaddq_s32(a, vdupq_n_s32(1 << 22)), 23);
+  return vmlsq_s32(a, t, vdupq_n_s32(Q));
+}
+
+/*************************************************
+* Name:        caddq_neon
+*
+* Description: Same as caddq for four coefficients.
+**************************************************/
+static inline int32x4_t caddq_neon(int32x4_t a) {
+  return vaddq_s32(a, vandq_s32(vshrq_n_s32(a, 31), vdupq_n_s32(Q)));
+}
+
+#endif
@@ -5,24 +5,30 @@
 
 void dilithium_shake128_stream_init(shake128incctx *state, const uint8_t seed[SEEDBYTES], uint16_t nonce)
 {
-  uint8_t t[2];
-  t[0] = nonce;
-  t[1] = nonce >> 8;
+  unsigned int i;
+  uint8_t t[SEEDBYTES + 2];
+
+  /* seed || nonce fits in one block, so absorb it in a single call */
+  for (i = 0; i < SEEDBYTES; ++i)
+    t[i] = seed[i];
+  t[SEEDBYTES] = nonce;
+  t[SEEDBYTES + 1] = nonce >> 8;
 
   shake128_inc_init(state);
-  shake128_inc_absorb(state, seed, SEEDBYTES);
-  shake128_inc_absorb(state, t, 2);
-  shake128_inc_finalize(state);
+  shake128_absorb_once(state, t, SEEDBYTES + 2);
 }
 
 void dilithium_shake256_stream_init(shake256incctx *state, const uint8_t seed[CRHBYTES], uint16_t nonce)
 {
-  uint8_t t[2];
-  t[0] = nonce;
-  t[1] = nonce >> 8;
+  unsigned int i;
+  uint8_t t[CRHBYTES + 2];
+
+  /* seed || nonce fits in one block, so absorb it in a single call */
+  for (i = 0; i < CRHBYTES; ++i)
+    t[i] = seed[i];
+  t[CRHBYTES] = nonce;
+  t[CRHBYTES + 1] = nonce >> 8;
 
   shake256_inc_init(state);
-  shake256_inc_absorb(state, seed, CRHBYTES);
-  shake256_inc_absorb(state, t, 2);
-  shake256_inc_finalize(state);
+  shake256_absorb_once(state, t, CRHBYTES + 2);
 }
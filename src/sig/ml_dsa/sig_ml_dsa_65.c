@@ -4,6 +4,8 @@
 
 #include <oqs/sig_ml_dsa.h>
 
+#include "../sig_key.h"
+
 #if defined(OQS_ENABLE_SIG_ml_dsa_65)
 OQS_SIG *OQS_SIG_ml_dsa_65_new(void) {
 
@@ -33,17 +35,35 @@ OQS_SIG *OQS_SIG_ml_dsa_65_new(void) {
 }
 
 extern int pqcrystals_ml_dsa_65_ref_keypair(uint8_t *pk, uint8_t *sk);
+extern int pqcrystals_ml_dsa_65_ref_keypair_internal(uint8_t *pk, uint8_t *sk, const uint8_t *seed);
 extern int pqcrystals_ml_dsa_65_ref_signature(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const uint8_t *ctx, size_t ctxlen, const uint8_t *sk);
 extern int pqcrystals_ml_dsa_65_ref_verify(const uint8_t *sig, size_t siglen, const uint8_t *m, size_t mlen, const uint8_t *ctx, size_t ctxlen, const uint8_t *pk);
 
+#if defined(OQS_ML_DSA_LOW_STACK)
+extern int pqcrystals_ml_dsa_65_ref_lowstack_keypair(uint8_t *pk, uint8_t *sk);
+extern int pqcrystals_ml_dsa_65_ref_lowstack_keypair_internal(uint8_t *pk, uint8_t *sk, const uint8_t *seed);
+extern int pqcrystals_ml_dsa_65_ref_lowstack_signature(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const uint8_t *ctx, size_t ctxlen, const uint8_t *sk);
+extern int pqcrystals_ml_dsa_65_ref_lowstack_verify(const uint8_t *sig, size_t siglen, const uint8_t *m, size_t mlen, const uint8_t *ctx, size_t ctxlen, const uint8_t *pk);
+#endif
+
 #if defined(OQS_ENABLE_SIG_ml_dsa_65_avx2)
 extern int pqcrystals_ml_dsa_65_avx2_keypair(uint8_t *pk, uint8_t *sk);
+extern int pqcrystals_ml_dsa_65_avx2_keypair_internal(uint8_t *pk, uint8_t *sk, const uint8_t *seed);
 extern int pqcrystals_ml_dsa_65_avx2_signature(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const uint8_t *ctx, size_t ctxlen, const uint8_t *sk);
 extern int pqcrystals_ml_dsa_65_avx2_verify(const uint8_t *sig, size_t siglen, const uint8_t *m, size_t mlen, const uint8_t *ctx, size_t ctxlen, const uint8_t *pk);
 #endif
 
+#if defined(OQS_ENABLE_SIG_ml_dsa_65_aarch64)
+extern int pqcrystals_ml_dsa_65_aarch64_keypair(uint8_t *pk, uint8_t *sk);
+extern int pqcrystals_ml_dsa_65_aarch64_keypair_internal(uint8_t *pk, uint8_t *sk, const uint8_t *seed);
+extern int pqcrystals_ml_dsa_65_aarch64_signature(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const uint8_t *ctx, size_t ctxlen, const uint8_t *sk);
+extern int pqcrystals_ml_dsa_65_aarch64_verify(const uint8_t *sig, size_t siglen, const uint8_t *m, size_t mlen, const uint8_t *ctx, size_t ctxlen, const uint8_t *pk);
+#endif
+
 OQS_API OQS_STATUS OQS_SIG_ml_dsa_65_keypair(uint8_t *public_key, uint8_t *secret_key) {
-#if defined(OQS_ENABLE_SIG_ml_dsa_65_avx2)
+#if defined(OQS_ML_DSA_LOW_STACK)
+	return (OQS_STATUS) pqcrystals_ml_dsa_65_ref_lowstack_keypair(public_key, secret_key);
+#elif defined(OQS_ENABLE_SIG_ml_dsa_65_avx2)
 #if defined(OQS_DIST_BUILD)
 	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2) && OQS_CPU_has_extension(OQS_CPU_EXT_POPCNT)) {
 #endif /* OQS_DIST_BUILD */
@@ -53,13 +73,53 @@ OQS_API OQS_STATUS OQS_SIG_ml_dsa_65_keypair(uint8_t *public_key, uint8_t *secre
 		return (OQS_STATUS) pqcrystals_ml_dsa_65_ref_keypair(public_key, secret_key);
 	}
 #endif /* OQS_DIST_BUILD */
+#elif defined(OQS_ENABLE_SIG_ml_dsa_65_aarch64)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_ARM_NEON)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) pqcrystals_ml_dsa_65_aarch64_keypair(public_key, secret_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) pqcrystals_ml_dsa_65_ref_keypair(public_key, secret_key);
+	}
+#endif /* OQS_DIST_BUILD */
 #else
 	return (OQS_STATUS) pqcrystals_ml_dsa_65_ref_keypair(public_key, secret_key);
 #endif
 }
 
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_65_keypair_from_seed(uint8_t *public_key, uint8_t *secret_key, const uint8_t *seed) {
+#if defined(OQS_ML_DSA_LOW_STACK)
+	return (OQS_STATUS) pqcrystals_ml_dsa_65_ref_lowstack_keypair_internal(public_key, secret_key, seed);
+#elif defined(OQS_ENABLE_SIG_ml_dsa_65_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2) && OQS_CPU_has_extension(OQS_CPU_EXT_POPCNT)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) pqcrystals_ml_dsa_65_avx2_keypair_internal(public_key, secret_key, seed);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) pqcrystals_ml_dsa_65_ref_keypair_internal(public_key, secret_key, seed);
+	}
+#endif /* OQS_DIST_BUILD */
+#elif defined(OQS_ENABLE_SIG_ml_dsa_65_aarch64)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_ARM_NEON)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) pqcrystals_ml_dsa_65_aarch64_keypair_internal(public_key, secret_key, seed);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) pqcrystals_ml_dsa_65_ref_keypair_internal(public_key, secret_key, seed);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return (OQS_STATUS) pqcrystals_ml_dsa_65_ref_keypair_internal(public_key, secret_key, seed);
+#endif
+}
+
 OQS_API OQS_STATUS OQS_SIG_ml_dsa_65_sign(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *secret_key) {
-#if defined(OQS_ENABLE_SIG_ml_dsa_65_avx2)
+#if defined(OQS_ML_DSA_LOW_STACK)
+	return (OQS_STATUS) pqcrystals_ml_dsa_65_ref_lowstack_signature(signature, signature_len, message, message_len, NULL, 0, secret_key);
+#elif defined(OQS_ENABLE_SIG_ml_dsa_65_avx2)
 #if defined(OQS_DIST_BUILD)
 	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2) && OQS_CPU_has_extension(OQS_CPU_EXT_POPCNT)) {
 #endif /* OQS_DIST_BUILD */
@@ -69,13 +129,25 @@ OQS_API OQS_STATUS OQS_SIG_ml_dsa_65_sign(uint8_t *signature, size_t *signature_
 		return (OQS_STATUS) pqcrystals_ml_dsa_65_ref_signature(signature, signature_len, message, message_len, NULL, 0, secret_key);
 	}
 #endif /* OQS_DIST_BUILD */
+#elif defined(OQS_ENABLE_SIG_ml_dsa_65_aarch64)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_ARM_NEON)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) pqcrystals_ml_dsa_65_aarch64_signature(signature, signature_len, message, message_len, NULL, 0, secret_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) pqcrystals_ml_dsa_65_ref_signature(signature, signature_len, message, message_len, NULL, 0, secret_key);
+	}
+#endif /* OQS_DIST_BUILD */
 #else
 	return (OQS_STATUS) pqcrystals_ml_dsa_65_ref_signature(signature, signature_len, message, message_len, NULL, 0, secret_key);
 #endif
 }
 
 OQS_API OQS_STATUS OQS_SIG_ml_dsa_65_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key) {
-#if defined(OQS_ENABLE_SIG_ml_dsa_65_avx2)
+#if defined(OQS_ML_DSA_LOW_STACK)
+	return (OQS_STATUS) pqcrystals_ml_dsa_65_ref_lowstack_verify(signature, signature_len, message, message_len, NULL, 0, public_key);
+#elif defined(OQS_ENABLE_SIG_ml_dsa_65_avx2)
 #if defined(OQS_DIST_BUILD)
 	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2) && OQS_CPU_has_extension(OQS_CPU_EXT_POPCNT)) {
 #endif /* OQS_DIST_BUILD */
@@ -85,12 +157,24 @@ OQS_API OQS_STATUS OQS_SIG_ml_dsa_65_verify(const uint8_t *message, size_t messa
 		return (OQS_STATUS) pqcrystals_ml_dsa_65_ref_verify(signature, signature_len, message, message_len, NULL, 0, public_key);
 	}
 #endif /* OQS_DIST_BUILD */
+#elif defined(OQS_ENABLE_SIG_ml_dsa_65_aarch64)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_ARM_NEON)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) pqcrystals_ml_dsa_65_aarch64_verify(signature, signature_len, message, message_len, NULL, 0, public_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) pqcrystals_ml_dsa_65_ref_verify(signature, signature_len, message, message_len, NULL, 0, public_key);
+	}
+#endif /* OQS_DIST_BUILD */
 #else
 	return (OQS_STATUS) pqcrystals_ml_dsa_65_ref_verify(signature, signature_len, message, message_len, NULL, 0, public_key);
 #endif
 }
 OQS_API OQS_STATUS OQS_SIG_ml_dsa_65_sign_with_ctx_str(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *secret_key) {
-#if defined(OQS_ENABLE_SIG_ml_dsa_65_avx2)
+#if defined(OQS_ML_DSA_LOW_STACK)
+	return (OQS_STATUS) pqcrystals_ml_dsa_65_ref_lowstack_signature(signature, signature_len, message, message_len, ctx_str, ctx_str_len, secret_key);
+#elif defined(OQS_ENABLE_SIG_ml_dsa_65_avx2)
 #if defined(OQS_DIST_BUILD)
 	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2) && OQS_CPU_has_extension(OQS_CPU_EXT_POPCNT)) {
 #endif /* OQS_DIST_BUILD */
@@ -100,13 +184,25 @@ OQS_API OQS_STATUS OQS_SIG_ml_dsa_65_sign_with_ctx_str(uint8_t *signature, size_
 		return (OQS_STATUS) pqcrystals_ml_dsa_65_ref_signature(signature, signature_len, message, message_len, ctx_str, ctx_str_len, secret_key);
 	}
 #endif /* OQS_DIST_BUILD */
+#elif defined(OQS_ENABLE_SIG_ml_dsa_65_aarch64)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_ARM_NEON)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) pqcrystals_ml_dsa_65_aarch64_signature(signature, signature_len, message, message_len, ctx_str, ctx_str_len, secret_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) pqcrystals_ml_dsa_65_ref_signature(signature, signature_len, message, message_len, ctx_str, ctx_str_len, secret_key);
+	}
+#endif /* OQS_DIST_BUILD */
 #else
 	return (OQS_STATUS) pqcrystals_ml_dsa_65_ref_signature(signature, signature_len, message, message_len, ctx_str, ctx_str_len, secret_key);
 #endif
 }
 
 OQS_API OQS_STATUS OQS_SIG_ml_dsa_65_verify_with_ctx_str(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key) {
-#if defined(OQS_ENABLE_SIG_ml_dsa_65_avx2)
+#if defined(OQS_ML_DSA_LOW_STACK)
+	return (OQS_STATUS) pqcrystals_ml_dsa_65_ref_lowstack_verify(signature, signature_len, message, message_len, ctx_str, ctx_str_len, public_key);
+#elif defined(OQS_ENABLE_SIG_ml_dsa_65_avx2)
 #if defined(OQS_DIST_BUILD)
 	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2) && OQS_CPU_has_extension(OQS_CPU_EXT_POPCNT)) {
 #endif /* OQS_DIST_BUILD */
@@ -116,8 +212,142 @@ OQS_API OQS_STATUS OQS_SIG_ml_dsa_65_verify_with_ctx_str(const uint8_t *message,
 		return (OQS_STATUS) pqcrystals_ml_dsa_65_ref_verify(signature, signature_len, message, message_len, ctx_str, ctx_str_len, public_key);
 	}
 #endif /* OQS_DIST_BUILD */
+#elif defined(OQS_ENABLE_SIG_ml_dsa_65_aarch64)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_ARM_NEON)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) pqcrystals_ml_dsa_65_aarch64_verify(signature, signature_len, message, message_len, ctx_str, ctx_str_len, public_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) pqcrystals_ml_dsa_65_ref_verify(signature, signature_len, message, message_len, ctx_str, ctx_str_len, public_key);
+	}
+#endif /* OQS_DIST_BUILD */
 #else
 	return (OQS_STATUS) pqcrystals_ml_dsa_65_ref_verify(signature, signature_len, message, message_len, ctx_str, ctx_str_len, public_key);
 #endif
 }
+
+extern size_t pqcrystals_ml_dsa_65_ref_expanded_pk_bytes(void);
+extern size_t pqcrystals_ml_dsa_65_ref_expanded_sk_bytes(void);
+extern void pqcrystals_ml_dsa_65_ref_expand_pk(void *xpk, const uint8_t *pk);
+extern void pqcrystals_ml_dsa_65_ref_expand_sk(void *xsk, const uint8_t *sk);
+extern int pqcrystals_ml_dsa_65_ref_signature_expanded(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const uint8_t *ctx, size_t ctxlen, const void *xsk);
+extern int pqcrystals_ml_dsa_65_ref_verify_expanded(const uint8_t *sig, size_t siglen, const uint8_t *m, size_t mlen, const uint8_t *ctx, size_t ctxlen, const void *xpk);
+
+#if defined(OQS_ENABLE_SIG_ml_dsa_65_aarch64)
+extern int pqcrystals_ml_dsa_65_aarch64_signature_expanded(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const uint8_t *ctx, size_t ctxlen, const void *xsk);
+extern int pqcrystals_ml_dsa_65_aarch64_verify_expanded(const uint8_t *sig, size_t siglen, const uint8_t *m, size_t mlen, const uint8_t *ctx, size_t ctxlen, const void *xpk);
+#endif
+
+#if defined(OQS_ENABLE_SIG_ml_dsa_65_avx2)
+extern size_t pqcrystals_ml_dsa_65_avx2_expanded_pk_bytes(void);
+extern size_t pqcrystals_ml_dsa_65_avx2_expanded_sk_bytes(void);
+extern void pqcrystals_ml_dsa_65_avx2_expand_pk(void *xpk, const uint8_t *pk);
+extern void pqcrystals_ml_dsa_65_avx2_expand_sk(void *xsk, const uint8_t *sk);
+extern int pqcrystals_ml_dsa_65_avx2_signature_expanded(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const uint8_t *ctx, size_t ctxlen, const void *xsk);
+extern int pqcrystals_ml_dsa_65_avx2_verify_expanded(const uint8_t *sig, size_t siglen, const uint8_t *m, size_t mlen, const uint8_t *ctx, size_t ctxlen, const void *xpk);
+#endif
+
+static OQS_STATUS ml_dsa_65_key_expand(OQS_SIG_KEY *key) {
+	size_t len = (key->type == OQS_SIG_KEY_SECRET) ? pqcrystals_ml_dsa_65_ref_expanded_sk_bytes() : pqcrystals_ml_dsa_65_ref_expanded_pk_bytes();
+	void *expanded = OQS_MEM_malloc(len);
+	if (expanded == NULL) {
+		return OQS_ERROR;
+	}
+	if (key->type == OQS_SIG_KEY_SECRET) {
+		pqcrystals_ml_dsa_65_ref_expand_sk(expanded, key->bytes);
+	} else {
+		pqcrystals_ml_dsa_65_ref_expand_pk(expanded, key->bytes);
+	}
+	key->expanded = expanded;
+	key->expanded_len = len;
+	return OQS_SUCCESS;
+}
+
+static OQS_STATUS ml_dsa_65_key_sign(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, const OQS_SIG_KEY *secret_key) {
+#if defined(OQS_ENABLE_SIG_ml_dsa_65_aarch64)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_ARM_NEON)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) pqcrystals_ml_dsa_65_aarch64_signature_expanded(signature, signature_len, message, message_len, ctx_str, ctx_str_len, secret_key->expanded);
+#if defined(OQS_DIST_BUILD)
+	}
+#endif /* OQS_DIST_BUILD */
+#endif
+	return (OQS_STATUS) pqcrystals_ml_dsa_65_ref_signature_expanded(signature, signature_len, message, message_len, ctx_str, ctx_str_len, secret_key->expanded);
+}
+
+static OQS_STATUS ml_dsa_65_key_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const OQS_SIG_KEY *public_key) {
+#if defined(OQS_ENABLE_SIG_ml_dsa_65_aarch64)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_ARM_NEON)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) pqcrystals_ml_dsa_65_aarch64_verify_expanded(signature, signature_len, message, message_len, ctx_str, ctx_str_len, public_key->expanded);
+#if defined(OQS_DIST_BUILD)
+	}
+#endif /* OQS_DIST_BUILD */
+#endif
+	return (OQS_STATUS) pqcrystals_ml_dsa_65_ref_verify_expanded(signature, signature_len, message, message_len, ctx_str, ctx_str_len, public_key->expanded);
+}
+
+static const OQS_SIG_KEY_ops ml_dsa_65_key_ops = {
+	.expand = ml_dsa_65_key_expand,
+	.sign = ml_dsa_65_key_sign,
+	.verify = ml_dsa_65_key_verify,
+};
+
+#if defined(OQS_ENABLE_SIG_ml_dsa_65_avx2)
+static OQS_STATUS ml_dsa_65_avx2_key_expand(OQS_SIG_KEY *key) {
+	size_t len = (key->type == OQS_SIG_KEY_SECRET) ? pqcrystals_ml_dsa_65_avx2_expanded_sk_bytes() : pqcrystals_ml_dsa_65_avx2_expanded_pk_bytes();
+	void *expanded = OQS_MEM_malloc(len);
+	if (expanded == NULL) {
+		return OQS_ERROR;
+	}
+	if (key->type == OQS_SIG_KEY_SECRET) {
+		pqcrystals_ml_dsa_65_avx2_expand_sk(expanded, key->bytes);
+	} else {
+		pqcrystals_ml_dsa_65_avx2_expand_pk(expanded, key->bytes);
+	}
+	key->expanded = expanded;
+	key->expanded_len = len;
+	return OQS_SUCCESS;
+}
+
+static OQS_STATUS ml_dsa_65_avx2_key_sign(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, const OQS_SIG_KEY *secret_key) {
+	return (OQS_STATUS) pqcrystals_ml_dsa_65_avx2_signature_expanded(signature, signature_len, message, message_len, ctx_str, ctx_str_len, secret_key->expanded);
+}
+
+static OQS_STATUS ml_dsa_65_avx2_key_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const OQS_SIG_KEY *public_key) {
+	return (OQS_STATUS) pqcrystals_ml_dsa_65_avx2_verify_expanded(signature, signature_len, message, message_len, ctx_str, ctx_str_len, public_key->expanded);
+}
+
+static const OQS_SIG_KEY_ops ml_dsa_65_avx2_key_ops = {
+	.expand = ml_dsa_65_avx2_key_expand,
+	.sign = ml_dsa_65_avx2_key_sign,
+	.verify = ml_dsa_65_avx2_key_verify,
+};
+#endif
+
+/* The precomputed keys follow the backend the wrappers above select. The
+ * AArch64 code shares the layout of the reference code, so one set of ops
+ * serves both and picks NEON where available. The AVX2 code has its own
+ * aligned, differently ordered layout, so a key is expanded and used by the
+ * AVX2 ops only. The low-stack build must not hold expanded matrices and
+ * keeps keys as bytes. */
+const OQS_SIG_KEY_ops *OQS_SIG_ml_dsa_65_key_ops(void) {
+	const OQS_SIG_KEY_ops *ops = &ml_dsa_65_key_ops;
+#if defined(OQS_ENABLE_SIG_ml_dsa_65_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2) && OQS_CPU_has_extension(OQS_CPU_EXT_POPCNT)) {
+#endif /* OQS_DIST_BUILD */
+		ops = &ml_dsa_65_avx2_key_ops;
+#if defined(OQS_DIST_BUILD)
+	}
+#endif /* OQS_DIST_BUILD */
+#endif
+#if defined(OQS_ML_DSA_LOW_STACK)
+	ops = NULL;
+#endif
+	return ops;
+}
 #endif
@@ -0,0 +1,143 @@
+/**
+ * \file sig_ml_dsa_direct.h
+ * \brief Direct, inlinable ML-DSA entry points for single-implementation builds.
+ *
+ * Counterpart of kem_ml_kem_direct.h: OQS_SIG_ml_dsa_*_direct_* behave like the
+ * corresponding OQS_SIG_ml_dsa_* functions. With OQS_DIRECT_DISPATCH they are
+ * `static inline` calls into the build-time selected backend (AVX2, AArch64,
+ * reference, or low-stack reference with OQS_ML_DSA_LOW_STACK), bypassing
+ * OQS_SIG_new(), the OQS_SIG function pointers and the run-time CPU feature
+ * check; otherwise they forward to the regular API.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef OQS_SIG_ML_DSA_DIRECT_H
+#define OQS_SIG_ML_DSA_DIRECT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <oqs/oqs.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#if defined(OQS_DIRECT_DISPATCH)
+
+#define OQS_SIG_ML_DSA_DIRECT_DEFINE(alg, impl)                                                              \
+	extern int impl##_keypair(uint8_t *pk, uint8_t *sk);                                                    \
+	extern int impl##_signature(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen,                \
+	                            const uint8_t *ctx, size_t ctxlen, const uint8_t *sk);                      \
+	extern int impl##_verify(const uint8_t *sig, size_t siglen, const uint8_t *m, size_t mlen,              \
+	                         const uint8_t *ctx, size_t ctxlen, const uint8_t *pk);                         \
+	static inline OQS_STATUS OQS_SIG_##alg##_direct_keypair(uint8_t *public_key, uint8_t *secret_key) {       \
+		return (OQS_STATUS) impl##_keypair(public_key, secret_key);                                         \
+	}                                                                                                       \
+	static inline OQS_STATUS OQS_SIG_##alg##_direct_sign_with_ctx_str(uint8_t *signature, size_t *signature_len, \
+	        const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len,         \
+	        const uint8_t *secret_key) {                                                                    \
+		return (OQS_STATUS) impl##_signature(signature, signature_len, message, message_len, ctx_str,       \
+		                                     ctx_str_len, secret_key);                                      \
+	}                                                                                                       \
+	static inline OQS_STATUS OQS_SIG_##alg##_direct_verify_with_ctx_str(const uint8_t *message, size_t message_len, \
+	        const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len,     \
+	        const uint8_t *public_key) {                                                                    \
+		return (OQS_STATUS) impl##_verify(signature, signature_len, message, message_len, ctx_str,          \
+		                                  ctx_str_len, public_key);                                         \
+	}
+
+#if defined(OQS_ENABLE_SIG_ml_dsa_44) && defined(OQS_ML_DSA_LOW_STACK)
+OQS_SIG_ML_DSA_DIRECT_DEFINE(ml_dsa_44, pqcrystals_ml_dsa_44_ref_lowstack)
+#elif defined(OQS_ENABLE_SIG_ml_dsa_44_avx2)
+OQS_SIG_ML_DSA_DIRECT_DEFINE(ml_dsa_44, pqcrystals_ml_dsa_44_avx2)
+#elif defined(OQS_ENABLE_SIG_ml_dsa_44_aarch64)
+OQS_SIG_ML_DSA_DIRECT_DEFINE(ml_dsa_44, pqcrystals_ml_dsa_44_aarch64)
+#elif defined(OQS_ENABLE_SIG_ml_dsa_44)
+OQS_SIG_ML_DSA_DIRECT_DEFINE(ml_dsa_44, pqcrystals_ml_dsa_44_ref)
+#endif
+
+#if defined(OQS_ENABLE_SIG_ml_dsa_65) && defined(OQS_ML_DSA_LOW_STACK)
+OQS_SIG_ML_DSA_DIRECT_DEFINE(ml_dsa_65, pqcrystals_ml_dsa_65_ref_lowstack)
+#elif defined(OQS_ENABLE_SIG_ml_dsa_65_avx2)
+OQS_SIG_ML_DSA_DIRECT_DEFINE(ml_dsa_65, pqcrystals_ml_dsa_65_avx2)
+#elif defined(OQS_ENABLE_SIG_ml_dsa_65_aarch64)
+OQS_SIG_ML_DSA_DIRECT_DEFINE(ml_dsa_65, pqcrystals_ml_dsa_65_aarch64)
+#elif defined(OQS_ENABLE_SIG_ml_dsa_65)
+OQS_SIG_ML_DSA_DIRECT_DEFINE(ml_dsa_65, pqcrystals_ml_dsa_65_ref)
+#endif
+
+#if defined(OQS_ENABLE_SIG_ml_dsa_87) && defined(OQS_ML_DSA_LOW_STACK)
+OQS_SIG_ML_DSA_DIRECT_DEFINE(ml_dsa_87, pqcrystals_ml_dsa_87_ref_lowstack)
+#elif defined(OQS_ENABLE_SIG_ml_dsa_87_avx2)
+OQS_SIG_ML_DSA_DIRECT_DEFINE(ml_dsa_87, pqcrystals_ml_dsa_87_avx2)
+#elif defined(OQS_ENABLE_SIG_ml_dsa_87_aarch64)
+OQS_SIG_ML_DSA_DIRECT_DEFINE(ml_dsa_87, pqcrystals_ml_dsa_87_aarch64)
+#elif defined(OQS_ENABLE_SIG_ml_dsa_87)
+OQS_SIG_ML_DSA_DIRECT_DEFINE(ml_dsa_87, pqcrystals_ml_dsa_87_ref)
+#endif
+
+#else /* OQS_DIRECT_DISPATCH */
+
+#define OQS_SIG_ML_DSA_DIRECT_DEFINE(alg)                                                                    \
+	static inline OQS_STATUS OQS_SIG_##alg##_direct_keypair(uint8_t *public_key, uint8_t *secret_key) {       \
+		return OQS_SIG_##alg##_keypair(public_key, secret_key);                                             \
+	}                                                                                                       \
+	static inline OQS_STATUS OQS_SIG_##alg##_direct_sign_with_ctx_str(uint8_t *signature, size_t *signature_len, \
+	        const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len,         \
+	        const uint8_t *secret_key) {                                                                    \
+		return OQS_SIG_##alg##_sign_with_ctx_str(signature, signature_len, message, message_len, ctx_str,   \
+		        ctx_str_len, secret_key);                                                                   \
+	}                                                                                                       \
+	static inline OQS_STATUS OQS_SIG_##alg##_direct_verify_with_ctx_str(const uint8_t *message, size_t message_len, \
+	        const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len,     \
+	        const uint8_t *public_key) {                                                                    \
+		return OQS_SIG_##alg##_verify_with_ctx_str(message, message_len, signature, signature_len, ctx_str, \
+		        ctx_str_len, public_key);                                                                   \
+	}
+
+#if defined(OQS_ENABLE_SIG_ml_dsa_44)
+OQS_SIG_ML_DSA_DIRECT_DEFINE(ml_dsa_44)
+#endif
+#if defined(OQS_ENABLE_SIG_ml_dsa_65)
+OQS_SIG_ML_DSA_DIRECT_DEFINE(ml_dsa_65)
+#endif
+#if defined(OQS_ENABLE_SIG_ml_dsa_87)
+OQS_SIG_ML_DSA_DIRECT_DEFINE(ml_dsa_87)
+#endif
+
+#endif /* OQS_DIRECT_DISPATCH */
+
+#undef OQS_SIG_ML_DSA_DIRECT_DEFINE
+
+/* The context-free variants sign and verify with an empty context string. */
+#define OQS_SIG_ML_DSA_DIRECT_DEFINE_NO_CTX(alg)                                                             \
+	static inline OQS_STATUS OQS_SIG_##alg##_direct_sign(uint8_t *signature, size_t *signature_len,          \
+	        const uint8_t *message, size_t message_len, const uint8_t *secret_key) {                        \
+		return OQS_SIG_##alg##_direct_sign_with_ctx_str(signature, signature_len, message, message_len,     \
+		        NULL, 0, secret_key);                                                                       \
+	}                                                                                                       \
+	static inline OQS_STATUS OQS_SIG_##alg##_direct_verify(const uint8_t *message, size_t message_len,       \
+	        const uint8_t *signature, size_t signature_len, const uint8_t *public_key) {                    \
+		return OQS_SIG_##alg##_direct_verify_with_ctx_str(message, message_len, signature, signature_len,   \
+		        NULL, 0, public_key);                                                                       \
+	}
+
+#if defined(OQS_ENABLE_SIG_ml_dsa_44)
+OQS_SIG_ML_DSA_DIRECT_DEFINE_NO_CTX(ml_dsa_44)
+#endif
+#if defined(OQS_ENABLE_SIG_ml_dsa_65)
+OQS_SIG_ML_DSA_DIRECT_DEFINE_NO_CTX(ml_dsa_65)
+#endif
+#if defined(OQS_ENABLE_SIG_ml_dsa_87)
+OQS_SIG_ML_DSA_DIRECT_DEFINE_NO_CTX(ml_dsa_87)
+#endif
+
+#undef OQS_SIG_ML_DSA_DIRECT_DEFINE_NO_CTX
+
+#if defined(__cplusplus)
+} // extern "C"
+#endif
+
+#endif // OQS_SIG_ML_DSA_DIRECT_H
@@ -0,0 +1,108 @@
+// SPDX-License-Identifier: MIT
+
+/*
+ * Speculative rejection sampling for ML-DSA signing.
+ *
+ * This file is compiled into each ml_dsa_* object library (with the parameter
+ * set selected by DILITHIUM_MODE) when OQS_ML_DSA_SPECULATIVE_SIGN is ON.
+ * Signing repeats an attempt with nonce 0, 1, 2, ... until one passes the
+ * norm and hint checks; attempts depend only on their nonce, and about 4 to
+ * 5 of them are needed on average, with a geometric tail. Here
+ * ML_DSA_SPECULATIVE_LANES threads take the nonces round-robin and the
+ * smallest accepted nonce wins. Every smaller nonce has been tried and
+ * rejected by then, so this is the attempt the sequential loop stops at and
+ * signatures are byte-for-byte identical; only the latency changes.
+ */
+
+#include <pthread.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <oqs/common.h>
+
+#include "params.h"
+#include "sign_speculative.h"
+
+typedef struct {
+	crypto_sign_attempt_fn attempt;
+	const void *arg;
+	pthread_mutex_t lock;
+	uint64_t first; /* smallest accepted nonce so far, UINT64_MAX if none */
+} search_state;
+
+typedef struct {
+	search_state *search;
+	uint64_t lane;
+	uint8_t *sig;
+} lane_state;
+
+static uint64_t first_accepted(search_state *s) {
+	uint64_t first;
+
+	pthread_mutex_lock(&s->lock);
+	first = s->first;
+	pthread_mutex_unlock(&s->lock);
+	return first;
+}
+
+/* Tries nonces lane, lane + LANES, ... until one is accepted or another lane
+ * has accepted a smaller one. */
+static void *run_lane(void *arg) {
+	lane_state *ls = arg;
+	search_state *s = ls->search;
+
+	for (uint64_t nonce = ls->lane; nonce < first_accepted(s); nonce += ML_DSA_SPECULATIVE_LANES) {
+		if (s->attempt(ls->sig, s->arg, nonce) == 0) {
+			pthread_mutex_lock(&s->lock);
+			if (nonce < s->first) {
+				s->first = nonce;
+			}
+			pthread_mutex_unlock(&s->lock);
+			break;
+		}
+	}
+	return NULL;
+}
+
+void crypto_sign_speculative_search(uint8_t sig[CRYPTO_BYTES], crypto_sign_attempt_fn attempt, const void *arg) {
+	search_state s;
+	lane_state lanes[ML_DSA_SPECULATIVE_LANES];
+	pthread_t threads[ML_DSA_SPECULATIVE_LANES];
+	int started[ML_DSA_SPECULATIVE_LANES];
+	uint8_t bufs[ML_DSA_SPECULATIVE_LANES][CRYPTO_BYTES];
+	unsigned int i;
+
+	s.attempt = attempt;
+	s.arg = arg;
+	s.first = UINT64_MAX;
+	if (pthread_mutex_init(&s.lock, NULL) != 0) {
+		for (uint64_t nonce = 0; attempt(sig, arg, nonce) != 0; nonce++)
+			;
+		return;
+	}
+
+	for (i = 0; i < ML_DSA_SPECULATIVE_LANES; i++) {
+		lanes[i].search = &s;
+		lanes[i].lane = i;
+		lanes[i].sig = bufs[i];
+	}
+	started[0] = 0;
+	for (i = 1; i < ML_DSA_SPECULATIVE_LANES; i++) {
+		started[i] = pthread_create(&threads[i], NULL, run_lane, &lanes[i]) == 0;
+	}
+	run_lane(&lanes[0]);
+	/* A lane whose thread could not be started runs here, after the others;
+	 * the result is the same, only later. */
+	for (i = 1; i < ML_DSA_SPECULATIVE_LANES; i++) {
+		if (started[i]) {
+			pthread_join(threads[i], NULL);
+		} else {
+			run_lane(&lanes[i]);
+		}
+	}
+	pthread_mutex_destroy(&s.lock);
+
+	memcpy(sig, bufs[s.first % ML_DSA_SPECULATIVE_LANES], CRYPTO_BYTES);
+	/* the other buffers hold rejected attempts */
+	OQS_MEM_cleanse(bufs, sizeof(bufs));
+}
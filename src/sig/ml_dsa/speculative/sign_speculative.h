@@ -0,0 +1,19 @@
+// SPDX-License-Identifier: MIT
+
+#ifndef SIGN_SPECULATIVE_H
+#define SIGN_SPECULATIVE_H
+
+#include <stdint.h>
+#include "params.h"
+
+/* Number of signing attempts evaluated concurrently, including the caller's. */
+#define ML_DSA_SPECULATIVE_LANES 4
+
+/* One rejection-sampling iteration of signing: writes a signature to sig and
+ * returns 0 if attempt number `attempt` is accepted, nonzero otherwise. */
+typedef int (*crypto_sign_attempt_fn)(uint8_t *sig, const void *arg, uint64_t attempt);
+
+#define crypto_sign_speculative_search DILITHIUM_NAMESPACE(speculative_search)
+void crypto_sign_speculative_search(uint8_t sig[CRYPTO_BYTES], crypto_sign_attempt_fn attempt, const void *arg);
+
+#endif
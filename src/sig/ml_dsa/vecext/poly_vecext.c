@@ -0,0 +1,21 @@
+// SPDX-License-Identifier: MIT
+
+/*
+ * poly_pointwise_montgomery() of the ML-DSA reference implementation, written
+ * with the GCC/Clang vector extensions. Compiled into each ml_dsa_*_ref object
+ * library when OQS_USE_VECTOR_EXTENSIONS is ON, next to ntt_vecext.c.
+ */
+
+#include <stdint.h>
+
+#include "params.h"
+#include "poly.h"
+#include "vecext.h"
+
+void poly_pointwise_montgomery(poly *c, const poly *a, const poly *b) {
+	unsigned int i;
+
+	for (i = 0; i < N; i += 4) {
+		vec_store(c->coeffs + i, vec_montgomery_mul(vec_load(a->coeffs + i), vec_load(b->coeffs + i)));
+	}
+}
@@ -0,0 +1,55 @@
+// SPDX-License-Identifier: MIT
+
+#ifndef VECEXT_H
+#define VECEXT_H
+
+/*
+ * Vector types and lane-wise Montgomery arithmetic shared by ntt_vecext.c and
+ * poly_vecext.c. Each lane performs the same Montgomery reductions as
+ * montgomery_reduce() in reduce.c, in the same order, so the results are
+ * bit-for-bit identical to the scalar code.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "params.h"
+#include "reduce.h"
+
+typedef int32_t vec32 __attribute__((vector_size(16)));
+typedef uint32_t vecu32 __attribute__((vector_size(16)));
+typedef int64_t vec64 __attribute__((vector_size(32)));
+
+#if defined(__clang__)
+#define vec_shuffle(a, b, ...) __builtin_shufflevector(a, b, __VA_ARGS__)
+#else
+#define vec_shuffle(a, b, ...) __builtin_shuffle(a, b, (vec32) {__VA_ARGS__})
+#endif
+
+static inline vec32 vec_set(int32_t x0, int32_t x1, int32_t x2, int32_t x3) {
+	const vec32 v = {x0, x1, x2, x3};
+	return v;
+}
+
+static inline vec32 vec_load(const int32_t *p) {
+	vec32 v;
+	memcpy(&v, p, sizeof(v));
+	return v;
+}
+
+static inline void vec_store(int32_t *p, vec32 v) {
+	memcpy(p, &v, sizeof(v));
+}
+
+/* Lane-wise montgomery_reduce() */
+static inline vec32 vec_montgomery_reduce(vec64 a) {
+	const vec32 t = (vec32)(__builtin_convertvector(a, vecu32) * (uint32_t)QINV);
+	return __builtin_convertvector((a - __builtin_convertvector(t, vec64) * Q) >> 32, vec32);
+}
+
+/* Lane-wise montgomery_reduce((int64_t)a * b) */
+static inline vec32 vec_montgomery_mul(vec32 a, vec32 b) {
+	return vec_montgomery_reduce(__builtin_convertvector(a, vec64) * __builtin_convertvector(b, vec64));
+}
+
+#endif
@@ -17,46 +17,40 @@
  * ============================================================================
  * We use direct function declarations instead of including headers
  * to avoid namespace macro conflicts between different Dilithium variants.
+ *
+ * The NTT and the reductions do not depend on the parameter set, so the
+ * reference implementation compiles them once for ML-DSA-44, -65 and -87
+ * (DILITHIUM_NAMESPACE_SHARED); the per-level wrappers below all use them.
  */
 
-/* ML-DSA-44 ref */
-extern void pqcrystals_ml_dsa_44_ref_ntt(int32_t a[256]);
-extern void pqcrystals_ml_dsa_44_ref_invntt_tomont(int32_t a[256]);
-extern int32_t pqcrystals_ml_dsa_44_ref_montgomery_reduce(int64_t a);
-extern int32_t pqcrystals_ml_dsa_44_ref_freeze(int32_t a);
-
-/* ML-DSA-65 ref */
-extern void pqcrystals_ml_dsa_65_ref_ntt(int32_t a[256]);
-extern void pqcrystals_ml_dsa_65_ref_invntt_tomont(int32_t a[256]);
-extern int32_t pqcrystals_ml_dsa_65_ref_montgomery_reduce(int64_t a);
-extern int32_t pqcrystals_ml_dsa_65_ref_freeze(int32_t a);
-
-/* ML-DSA-87 ref */
-extern void pqcrystals_ml_dsa_87_ref_ntt(int32_t a[256]);
-extern void pqcrystals_ml_dsa_87_ref_invntt_tomont(int32_t a[256]);
-extern int32_t pqcrystals_ml_dsa_87_ref_montgomery_reduce(int64_t a);
-extern int32_t pqcrystals_ml_dsa_87_ref_freeze(int32_t a);
+extern void pqcrystals_ml_dsa_ref_ntt(int32_t a[256]);
+extern void pqcrystals_ml_dsa_ref_invntt_tomont(int32_t a[256]);
+extern int32_t pqcrystals_ml_dsa_ref_montgomery_reduce(int64_t a);
+extern int32_t pqcrystals_ml_dsa_ref_freeze(int32_t a);
 
+static void ml_dsa_ref_invntt(int32_t a[256]) {
+    pqcrystals_ml_dsa_ref_invntt_tomont(a);
+    // Apply Montgomery reduction and freeze to get standard form [0, Q-1]
+    for (int i = 0; i < 256; i++) {
+        a[i] = pqcrystals_ml_dsa_ref_montgomery_reduce((int64_t)a[i]);
+        a[i] = pqcrystals_ml_dsa_ref_freeze(a[i]);
+    }
+}
 
 /* ============================================================================
  * ML-DSA-44 Reference Implementation Wrappers
  * ============================================================================ */
 
 OQS_API void OQS_SIG_ml_dsa_44_ref_ntt(int32_t a[256]) {
-    pqcrystals_ml_dsa_44_ref_ntt(a);
+    pqcrystals_ml_dsa_ref_ntt(a);
 }
 
 OQS_API void OQS_SIG_ml_dsa_44_ref_invntt_tomont(int32_t a[256]) {
-    pqcrystals_ml_dsa_44_ref_invntt_tomont(a);
+    pqcrystals_ml_dsa_ref_invntt_tomont(a);
 }
 
 OQS_API void OQS_SIG_ml_dsa_44_ref_invntt(int32_t a[256]) {
-    pqcrystals_ml_dsa_44_ref_invntt_tomont(a);
-    // Apply Montgomery reduction and freeze to get standard form [0, Q-1]
-    for (int i = 0; i < 256; i++) {
-        a[i] = pqcrystals_ml_dsa_44_ref_montgomery_reduce((int64_t)a[i]);
-        a[i] = pqcrystals_ml_dsa_44_ref_freeze(a[i]);
-    }
+    ml_dsa_ref_invntt(a);
 }
 
 /* ============================================================================
@@ -64,20 +58,15 @@ OQS_API void OQS_SIG_ml_dsa_44_ref_invntt(int32_t a[256]) {
  * ============================================================================ */
 
 OQS_API void OQS_SIG_ml_dsa_65_ref_ntt(int32_t a[256]) {
-    pqcrystals_ml_dsa_65_ref_ntt(a);
+    pqcrystals_ml_dsa_ref_ntt(a);
 }
 
 OQS_API void OQS_SIG_ml_dsa_65_ref_invntt_tomont(int32_t a[256]) {
-    pqcrystals_ml_dsa_65_ref_invntt_tomont(a);
+    pqcrystals_ml_dsa_ref_invntt_tomont(a);
 }
 
 OQS_API void OQS_SIG_ml_dsa_65_ref_invntt(int32_t a[256]) {
-    pqcrystals_ml_dsa_65_ref_invntt_tomont(a);
-    // Apply Montgomery reduction and freeze to get standard form [0, Q-1]
-    for (int i = 0; i < 256; i++) {
-        a[i] = pqcrystals_ml_dsa_65_ref_montgomery_reduce((int64_t)a[i]);
-        a[i] = pqcrystals_ml_dsa_65_ref_freeze(a[i]);
-    }
+    ml_dsa_ref_invntt(a);
 }
 
 /* ============================================================================
@@ -85,18 +74,13 @@ OQS_API void OQS_SIG_ml_dsa_65_ref_invntt(int32_t a[256]) {
  * ============================================================================ */
 
 OQS_API void OQS_SIG_ml_dsa_87_ref_ntt(int32_t a[256]) {
-    pqcrystals_ml_dsa_87_ref_ntt(a);
+    pqcrystals_ml_dsa_ref_ntt(a);
 }
 
 OQS_API void OQS_SIG_ml_dsa_87_ref_invntt_tomont(int32_t a[256]) {
-    pqcrystals_ml_dsa_87_ref_invntt_tomont(a);
+    pqcrystals_ml_dsa_ref_invntt_tomont(a);
 }
 
 OQS_API void OQS_SIG_ml_dsa_87_ref_invntt(int32_t a[256]) {
-    pqcrystals_ml_dsa_87_ref_invntt_tomont(a);
-    // Apply Montgomery reduction and freeze to get standard form [0, Q-1]
-    for (int i = 0; i < 256; i++) {
-        a[i] = pqcrystals_ml_dsa_87_ref_montgomery_reduce((int64_t)a[i]);
-        a[i] = pqcrystals_ml_dsa_87_ref_freeze(a[i]);
-    }
+    ml_dsa_ref_invntt(a);
 }
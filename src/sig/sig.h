@@ -725,6 +725,28 @@ OQS_API OQS_STATUS OQS_SIG_verify_with_ctx_str(const OQS_SIG *sig, const uint8_t
  */
 OQS_API void OQS_SIG_free(OQS_SIG *sig);
 
+/**
+ * Warms up a signature algorithm ahead of its first real use.
+ *
+ * Runs one keypair/sign/verify cycle on throwaway buffers. This resolves
+ * CPU feature dispatch, runs the lazy initializers of the algorithm and of
+ * the primitives it uses, and faults in the constant tables on the code path
+ * that is selected on this machine, so that the first operation performed
+ * afterwards runs at steady-state speed.
+ *
+ * The cost is that of one full cycle of the algorithm. The throwaway keys are
+ * drawn from a fixed-seed generator installed for the duration of the call with
+ * OQS_randombytes_set_thread_source(), so the warm-up consumes no output of the
+ * RNG configured by the application, whether process-wide or for the thread.
+ * Embedded builds have no per-thread sources; there the throwaway keys are drawn
+ * from the source set with OQS_randombytes_custom_algorithm(), which must be
+ * set before the call.
+ *
+ * @param[in] method_name Name of the desired algorithm; one of the names in `OQS_SIG_algs`.
+ * @return OQS_SUCCESS, or OQS_ERROR if the algorithm is unknown or disabled, or an operation failed.
+ */
+OQS_API OQS_STATUS OQS_SIG_warmup(const char *method_name);
+
 /**
  * Indicates whether the specified signature algorithm supports signing with a context string.
  *
@@ -733,6 +755,288 @@ OQS_API void OQS_SIG_free(OQS_SIG *sig);
  */
 OQS_API bool OQS_SIG_supports_ctx_str(const char *alg_name);
 
+/**
+ * Opaque handle to an imported signature key.
+ *
+ * A key handle holds a copy of the encoded key and, where the algorithm
+ * supports it, a parsed or precomputed form of it (for ML-DSA: the expanded
+ * matrix A and the key vectors in the NTT domain), so that repeated
+ * operations with the same key do not decode it again on every call.
+ * Algorithms without such support keep only the bytes and forward to the
+ * regular OQS_SIG functions. A handle is immutable after import and may be
+ * used concurrently from several threads.
+ */
+typedef struct OQS_SIG_KEY OQS_SIG_KEY;
+
+/** OQS_SIG_key_import() flag: the bytes are a public key. */
+#define OQS_SIG_KEY_PUBLIC 0x1u
+/** OQS_SIG_key_import() flag: the bytes are a secret key. */
+#define OQS_SIG_KEY_SECRET 0x2u
+/** OQS_SIG_key_import() flag: only keep the bytes, do not precompute. */
+#define OQS_SIG_KEY_BYTES_ONLY 0x100u
+/**
+ * OQS_SIG_key_import() flag, with OQS_SIG_KEY_SECRET only: the bytes are the
+ * seed the secret key is generated from with OQS_SIG_keypair_from_seed().
+ */
+#define OQS_SIG_KEY_SEED 0x200u
+
+/**
+ * Imports an encoded public or secret key into a key handle.
+ *
+ * With OQS_SIG_KEY_SEED, the secret key is generated from the seed at import
+ * and the handle also keeps the seed for OQS_SIG_key_export_seed().
+ *
+ * @param[in] sig The OQS_SIG object the key belongs to.
+ * @param[in] key The encoded key, or the seed with OQS_SIG_KEY_SEED.
+ * @param[in] key_len Length of `key`; must equal the corresponding `length_*` member of `sig`, or OQS_SIG_keypair_seed_length() with OQS_SIG_KEY_SEED.
+ * @param[in] flags Exactly one of OQS_SIG_KEY_PUBLIC and OQS_SIG_KEY_SECRET, optionally OR'ed with OQS_SIG_KEY_BYTES_ONLY and, for secret keys, OQS_SIG_KEY_SEED.
+ * @return A key handle to be freed with OQS_SIG_key_free(), or NULL on error.
+ */
+OQS_API OQS_SIG_KEY *OQS_SIG_key_import(const OQS_SIG *sig, const uint8_t *key, size_t key_len, uint32_t flags);
+
+/**
+ * Frees a key handle, zeroing any secret material it holds.
+ *
+ * @param[in] key The key handle to free; may be NULL.
+ */
+OQS_API void OQS_SIG_key_free(OQS_SIG_KEY *key);
+
+/**
+ * Indicates whether a key handle holds an algorithm-specific precomputed form
+ * of the key, rather than only its encoding.
+ *
+ * @param[in] key The key handle.
+ * @return true if the key was precomputed at import.
+ */
+OQS_API bool OQS_SIG_key_is_expanded(const OQS_SIG_KEY *key);
+
+/**
+ * Signature generation with an imported secret key; see OQS_SIG_sign().
+ *
+ * @param[in] sig The OQS_SIG object representing the signature scheme.
+ * @param[out] signature The signature on the message represented as a byte string.
+ * @param[out] signature_len The length of the signature.
+ * @param[in] message The message to sign represented as a byte string.
+ * @param[in] message_len The length of the message to sign.
+ * @param[in] secret_key A secret key handle imported for `sig`.
+ * @return OQS_SUCCESS or OQS_ERROR
+ */
+OQS_API OQS_STATUS OQS_SIG_key_sign(const OQS_SIG *sig, uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const OQS_SIG_KEY *secret_key);
+
+/**
+ * Signature generation with a context string and an imported secret key; see OQS_SIG_sign_with_ctx_str().
+ *
+ * @param[in] sig The OQS_SIG object representing the signature scheme.
+ * @param[out] signature The signature on the message represented as a byte string.
+ * @param[out] signature_len The length of the signature.
+ * @param[in] message The message to sign represented as a byte string.
+ * @param[in] message_len The length of the message to sign.
+ * @param[in] ctx_str The context string used for the signature.
+ * @param[in] ctx_str_len The context string length.
+ * @param[in] secret_key A secret key handle imported for `sig`.
+ * @return OQS_SUCCESS or OQS_ERROR
+ */
+OQS_API OQS_STATUS OQS_SIG_key_sign_with_ctx_str(const OQS_SIG *sig, uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, const OQS_SIG_KEY *secret_key);
+
+/**
+ * Signature verification with an imported public key; see OQS_SIG_verify().
+ *
+ * @param[in] sig The OQS_SIG object representing the signature scheme.
+ * @param[in] message The message represented as a byte string.
+ * @param[in] message_len The length of the message.
+ * @param[in] signature The signature on the message represented as a byte string.
+ * @param[in] signature_len The length of the signature.
+ * @param[in] public_key A public key handle imported for `sig`.
+ * @return OQS_SUCCESS or OQS_ERROR
+ */
+OQS_API OQS_STATUS OQS_SIG_key_verify(const OQS_SIG *sig, const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const OQS_SIG_KEY *public_key);
+
+/**
+ * Signature verification with a context string and an imported public key; see OQS_SIG_verify_with_ctx_str().
+ *
+ * @param[in] sig The OQS_SIG object representing the signature scheme.
+ * @param[in] message The message represented as a byte string.
+ * @param[in] message_len The length of the message.
+ * @param[in] signature The signature on the message represented as a byte string.
+ * @param[in] signature_len The length of the signature.
+ * @param[in] ctx_str The context string used for the signature.
+ * @param[in] ctx_str_len The context string length.
+ * @param[in] public_key A public key handle imported for `sig`.
+ * @return OQS_SUCCESS or OQS_ERROR
+ */
+OQS_API OQS_STATUS OQS_SIG_key_verify_with_ctx_str(const OQS_SIG *sig, const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const OQS_SIG_KEY *public_key);
+
+/**
+ * Writes the encoded key held by a key handle.
+ *
+ * @param[in] key The key handle.
+ * @param[out] out The encoded public or secret key.
+ * @param[in] out_len Length of `out`; must equal the length of the encoded key.
+ * @return OQS_SUCCESS or OQS_ERROR
+ */
+OQS_API OQS_STATUS OQS_SIG_key_export(const OQS_SIG_KEY *key, uint8_t *out, size_t out_len);
+
+/**
+ * Writes the seed of a secret key handle imported with OQS_SIG_KEY_SEED.
+ *
+ * @param[in] key The key handle.
+ * @param[out] seed The seed.
+ * @param[in] seed_len Length of `seed`; must equal OQS_SIG_keypair_seed_length().
+ * @return OQS_SUCCESS, or OQS_ERROR if the handle was not imported from a seed.
+ */
+OQS_API OQS_STATUS OQS_SIG_key_export_seed(const OQS_SIG_KEY *key, uint8_t *seed, size_t seed_len);
+
+/**
+ * Returns the length of the seeds accepted by OQS_SIG_keypair_from_seed().
+ *
+ * @param[in] sig The OQS_SIG object representing the signature scheme.
+ * @return The seed length in bytes (32 for ML-DSA), or 0 if the scheme does not support key generation from a seed.
+ */
+OQS_API size_t OQS_SIG_keypair_seed_length(const OQS_SIG *sig);
+
+/**
+ * Deterministic keypair generation from a seed.
+ *
+ * For ML-DSA this is ML-DSA.KeyGen_internal of FIPS 204 with the seed as
+ * xi, so the 32-byte seed is a complete representation of the secret key.
+ *
+ * @param[in] sig The OQS_SIG object representing the signature scheme.
+ * @param[out] public_key The public key represented as a byte string.
+ * @param[out] secret_key The secret key represented as a byte string.
+ * @param[in] seed The seed, of OQS_SIG_keypair_seed_length() bytes.
+ * @return OQS_SUCCESS, or OQS_ERROR if the scheme does not support key generation from a seed.
+ */
+OQS_API OQS_STATUS OQS_SIG_keypair_from_seed(const OQS_SIG *sig, uint8_t *public_key, uint8_t *secret_key, const uint8_t *seed);
+
+/**
+ * Opaque cache of secret keys expanded from their seeds.
+ *
+ * Signing through the cache takes the secret key as its seed, so that keys
+ * can be stored in seed form, and keeps recently used keys imported (and,
+ * where supported, precomputed; see OQS_SIG_KEY) within a memory budget,
+ * evicting the least recently used ones. A miss costs a key generation.
+ * When liboqs is built with pthreads, a cache may be used concurrently from
+ * several threads.
+ */
+typedef struct OQS_SIG_KEY_CACHE OQS_SIG_KEY_CACHE;
+
+/**
+ * Creates a key expansion cache.
+ *
+ * @param[in] sig The OQS_SIG object the keys belong to; it must outlive the cache and support OQS_SIG_keypair_from_seed().
+ * @param[in] max_bytes The memory budget of the cached keys, in bytes; see OQS_KEY_CACHE_STATS.bytes.
+ * @return A cache to be freed with OQS_SIG_key_cache_free(), or NULL on error.
+ */
+OQS_API OQS_SIG_KEY_CACHE *OQS_SIG_key_cache_new(const OQS_SIG *sig, size_t max_bytes);
+
+/**
+ * Frees a key expansion cache and all keys in it, zeroing their secret material.
+ *
+ * @param[in] cache The cache to free; may be NULL.
+ */
+OQS_API void OQS_SIG_key_cache_free(OQS_SIG_KEY_CACHE *cache);
+
+/**
+ * Signature generation with a secret key given by its seed, expanded through a cache.
+ *
+ * @param[in] cache The key expansion cache.
+ * @param[out] signature The signature on the message represented as a byte string.
+ * @param[out] signature_len The length of the signature.
+ * @param[in] message The message to sign represented as a byte string.
+ * @param[in] message_len The length of the message to sign.
+ * @param[in] ctx_str The context string used for the signature, or NULL.
+ * @param[in] ctx_str_len The context string length; 0 if `ctx_str` is NULL.
+ * @param[in] seed The seed of the secret key, of OQS_SIG_keypair_seed_length() bytes.
+ * @return OQS_SUCCESS or OQS_ERROR
+ */
+OQS_API OQS_STATUS OQS_SIG_key_cache_sign(OQS_SIG_KEY_CACHE *cache, uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *seed);
+
+/**
+ * Reads the counters of a key expansion cache.
+ *
+ * @param[in] cache The key expansion cache.
+ * @param[out] stats The counters.
+ */
+OQS_API void OQS_SIG_key_cache_stats(OQS_SIG_KEY_CACHE *cache, OQS_KEY_CACHE_STATS *stats);
+
+/**
+ * Opaque state of a streaming signature verification.
+ *
+ * Algorithms that hash the message exactly once during verification can
+ * take it in chunks, so that a large message, such as a file read from a
+ * descriptor, is verified with bounded memory. Streaming verification is
+ * available for Falcon, MAYO, UOV, SNOVA, CROSS and the pure SLH-DSA
+ * variants; see OQS_SIG_supports_verify_stream(). A context must not be
+ * used concurrently from several threads.
+ */
+typedef struct OQS_SIG_VERIFY_CTX OQS_SIG_VERIFY_CTX;
+
+/**
+ * Starts a streaming signature verification.
+ *
+ * The message is then passed in chunks of any size to OQS_SIG_verify_update(),
+ * and OQS_SIG_verify_final() gives the result OQS_SIG_verify() would give on
+ * the concatenation of the chunks. The signature and public key are copied
+ * into the context.
+ *
+ * @param[in] sig The OQS_SIG object representing the signature scheme.
+ * @param[out] ctx The verification context, to be freed with OQS_SIG_VERIFY_CTX_free(); set to NULL on error.
+ * @param[in] signature The signature represented as a byte string.
+ * @param[in] signature_len The length of the signature.
+ * @param[in] public_key The public key represented as a byte string.
+ * @return OQS_SUCCESS, or OQS_ERROR if the algorithm cannot stream or the signature is malformed
+ */
+OQS_API OQS_STATUS OQS_SIG_verify_init(const OQS_SIG *sig, OQS_SIG_VERIFY_CTX **ctx, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+
+/**
+ * Starts a streaming signature verification with a context string; see
+ * OQS_SIG_verify_init() and OQS_SIG_verify_with_ctx_str().
+ *
+ * @param[in] sig The OQS_SIG object representing the signature scheme.
+ * @param[out] ctx The verification context, to be freed with OQS_SIG_VERIFY_CTX_free(); set to NULL on error.
+ * @param[in] signature The signature represented as a byte string.
+ * @param[in] signature_len The length of the signature.
+ * @param[in] ctx_str The context string used for the signature.
+ * @param[in] ctx_str_len The context string length.
+ * @param[in] public_key The public key represented as a byte string.
+ * @return OQS_SUCCESS, or OQS_ERROR if the algorithm cannot stream, does not support the context string, or the signature is malformed
+ */
+OQS_API OQS_STATUS OQS_SIG_verify_init_with_ctx_str(const OQS_SIG *sig, OQS_SIG_VERIFY_CTX **ctx, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key);
+
+/**
+ * Passes the next chunk of the message to a streaming signature verification.
+ *
+ * @param[in] ctx The verification context.
+ * @param[in] message The next chunk of the message.
+ * @param[in] message_len The length of the chunk; may be 0.
+ * @return OQS_SUCCESS, or OQS_ERROR if OQS_SIG_verify_final() was already called on `ctx`
+ */
+OQS_API OQS_STATUS OQS_SIG_verify_update(OQS_SIG_VERIFY_CTX *ctx, const uint8_t *message, size_t message_len);
+
+/**
+ * Completes a streaming signature verification. It can be called once per
+ * context; the context must still be freed with OQS_SIG_VERIFY_CTX_free().
+ *
+ * @param[in] ctx The verification context.
+ * @return OQS_SUCCESS if the signature is valid for the message passed to OQS_SIG_verify_update(), OQS_ERROR otherwise
+ */
+OQS_API OQS_STATUS OQS_SIG_verify_final(OQS_SIG_VERIFY_CTX *ctx);
+
+/**
+ * Frees a streaming verification context, whether or not OQS_SIG_verify_final() was called.
+ *
+ * @param[in] ctx The verification context to free; may be NULL.
+ */
+OQS_API void OQS_SIG_VERIFY_CTX_free(OQS_SIG_VERIFY_CTX *ctx);
+
+/**
+ * Indicates whether an algorithm supports streaming verification with OQS_SIG_verify_init().
+ *
+ * @param[in] alg_name Name of the desired algorithm; one of the names in `OQS_SIG_algs`.
+ * @return true if the algorithm is enabled and supports streaming verification
+ */
+OQS_API bool OQS_SIG_supports_verify_stream(const char *alg_name);
+
 ///// OQS_COPY_FROM_UPSTREAM_FRAGMENT_INCLUDE_START
 #ifdef OQS_ENABLE_SIG_ML_DSA
 #include <oqs/sig_ml_dsa.h>
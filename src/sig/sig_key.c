@@ -0,0 +1,301 @@
+// SPDX-License-Identifier: MIT
+
+#include <string.h>
+#if defined(_WIN32)
+#define strcasecmp _stricmp
+#else
+#include <strings.h>
+#endif
+
+#include <oqs/oqs.h>
+#include <oqs/sha3.h>
+
+#include "../common/key_cache.h"
+#include "sig_key.h"
+
+typedef OQS_STATUS (*sig_keypair_from_seed_fn)(uint8_t *public_key, uint8_t *secret_key, const uint8_t *seed);
+
+/* Precomputed-key hooks by algorithm; NULL keeps the key as bytes. */
+static const OQS_SIG_KEY_ops *sig_key_ops(const char *method_name) {
+#if defined(OQS_ENABLE_SIG_ml_dsa_44)
+	if (0 == strcasecmp(method_name, OQS_SIG_alg_ml_dsa_44)) {
+		return OQS_SIG_ml_dsa_44_key_ops();
+	}
+#endif
+#if defined(OQS_ENABLE_SIG_ml_dsa_65)
+	if (0 == strcasecmp(method_name, OQS_SIG_alg_ml_dsa_65)) {
+		return OQS_SIG_ml_dsa_65_key_ops();
+	}
+#endif
+#if defined(OQS_ENABLE_SIG_ml_dsa_87)
+	if (0 == strcasecmp(method_name, OQS_SIG_alg_ml_dsa_87)) {
+		return OQS_SIG_ml_dsa_87_key_ops();
+	}
+#endif
+	(void) method_name;
+	return NULL;
+}
+
+/* Key generation from a seed by algorithm; NULL if not supported. */
+static sig_keypair_from_seed_fn sig_keypair_from_seed(const char *method_name, size_t *seed_len) {
+#if defined(OQS_ENABLE_SIG_ml_dsa_44)
+	if (0 == strcasecmp(method_name, OQS_SIG_alg_ml_dsa_44)) {
+		*seed_len = OQS_SIG_ml_dsa_44_length_keypair_seed;
+		return OQS_SIG_ml_dsa_44_keypair_from_seed;
+	}
+#endif
+#if defined(OQS_ENABLE_SIG_ml_dsa_65)
+	if (0 == strcasecmp(method_name, OQS_SIG_alg_ml_dsa_65)) {
+		*seed_len = OQS_SIG_ml_dsa_65_length_keypair_seed;
+		return OQS_SIG_ml_dsa_65_keypair_from_seed;
+	}
+#endif
+#if defined(OQS_ENABLE_SIG_ml_dsa_87)
+	if (0 == strcasecmp(method_name, OQS_SIG_alg_ml_dsa_87)) {
+		*seed_len = OQS_SIG_ml_dsa_87_length_keypair_seed;
+		return OQS_SIG_ml_dsa_87_keypair_from_seed;
+	}
+#endif
+	(void) method_name;
+	*seed_len = 0;
+	return NULL;
+}
+
+OQS_API size_t OQS_SIG_keypair_seed_length(const OQS_SIG *sig) {
+	size_t seed_len = 0;
+	if (sig != NULL) {
+		sig_keypair_from_seed(sig->method_name, &seed_len);
+	}
+	return seed_len;
+}
+
+OQS_API OQS_STATUS OQS_SIG_keypair_from_seed(const OQS_SIG *sig, uint8_t *public_key, uint8_t *secret_key, const uint8_t *seed) {
+	size_t seed_len;
+	sig_keypair_from_seed_fn keypair_from_seed;
+
+	if (sig == NULL) {
+		return OQS_ERROR;
+	}
+	keypair_from_seed = sig_keypair_from_seed(sig->method_name, &seed_len);
+	if (keypair_from_seed == NULL || keypair_from_seed(public_key, secret_key, seed) != OQS_SUCCESS) {
+		return OQS_ERROR;
+	}
+	return OQS_SUCCESS;
+}
+
+OQS_API OQS_SIG_KEY *OQS_SIG_key_import(const OQS_SIG *sig, const uint8_t *key, size_t key_len, uint32_t flags) {
+	uint32_t type = flags & (OQS_SIG_KEY_PUBLIC | OQS_SIG_KEY_SECRET);
+	size_t expected_len;
+	sig_keypair_from_seed_fn keypair_from_seed = NULL;
+
+	if (sig == NULL || key == NULL || (flags & ~(OQS_SIG_KEY_PUBLIC | OQS_SIG_KEY_SECRET | OQS_SIG_KEY_BYTES_ONLY | OQS_SIG_KEY_SEED)) != 0) {
+		return NULL;
+	}
+	if (type == OQS_SIG_KEY_PUBLIC && !(flags & OQS_SIG_KEY_SEED)) {
+		expected_len = sig->length_public_key;
+	} else if (type == OQS_SIG_KEY_SECRET) {
+		expected_len = sig->length_secret_key;
+	} else {
+		return NULL;
+	}
+	if (flags & OQS_SIG_KEY_SEED) {
+		keypair_from_seed = sig_keypair_from_seed(sig->method_name, &expected_len);
+		if (keypair_from_seed == NULL) {
+			return NULL;
+		}
+	}
+	if (key_len != expected_len) {
+		return NULL;
+	}
+
+	OQS_SIG_KEY *handle = OQS_MEM_calloc(1, sizeof(OQS_SIG_KEY));
+	if (handle == NULL) {
+		return NULL;
+	}
+	handle->method_name = sig->method_name;
+	handle->type = type;
+	if (keypair_from_seed != NULL) {
+		uint8_t *public_key = OQS_MEM_malloc(sig->length_public_key);
+		handle->bytes_len = sig->length_secret_key;
+		handle->bytes = OQS_MEM_malloc(handle->bytes_len);
+		handle->seed_len = key_len;
+		handle->seed = OQS_MEM_malloc(key_len);
+		if (public_key == NULL || handle->bytes == NULL || handle->seed == NULL ||
+		        keypair_from_seed(public_key, handle->bytes, key) != OQS_SUCCESS) {
+			OQS_MEM_insecure_free(public_key);
+			OQS_SIG_key_free(handle);
+			return NULL;
+		}
+		OQS_MEM_insecure_free(public_key);
+		memcpy(handle->seed, key, key_len);
+	} else {
+		handle->bytes_len = key_len;
+		handle->bytes = OQS_MEM_malloc(key_len);
+		if (handle->bytes == NULL) {
+			OQS_MEM_insecure_free(handle);
+			return NULL;
+		}
+		memcpy(handle->bytes, key, key_len);
+	}
+
+	if (!(flags & OQS_SIG_KEY_BYTES_ONLY)) {
+		handle->ops = sig_key_ops(sig->method_name);
+		/* a failed precomputation leaves a bytes-only handle */
+		if (handle->ops != NULL && handle->ops->expand(handle) != OQS_SUCCESS) {
+			handle->ops = NULL;
+		}
+	}
+	return handle;
+}
+
+OQS_API void OQS_SIG_key_free(OQS_SIG_KEY *key) {
+	if (key == NULL) {
+		return;
+	}
+	OQS_MEM_secure_free(key->expanded, key->expanded_len);
+	OQS_MEM_secure_free(key->bytes, key->bytes_len);
+	OQS_MEM_secure_free(key->seed, key->seed_len);
+	OQS_MEM_insecure_free(key);
+}
+
+OQS_API bool OQS_SIG_key_is_expanded(const OQS_SIG_KEY *key) {
+	return key != NULL && key->expanded != NULL;
+}
+
+static bool sig_key_matches(const OQS_SIG *sig, const OQS_SIG_KEY *key, uint32_t type) {
+	return sig != NULL && key != NULL && key->type == type && 0 == strcmp(sig->method_name, key->method_name);
+}
+
+OQS_API OQS_STATUS OQS_SIG_key_sign(const OQS_SIG *sig, uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const OQS_SIG_KEY *secret_key) {
+	if (!sig_key_matches(sig, secret_key, OQS_SIG_KEY_SECRET)) {
+		return OQS_ERROR;
+	}
+	if (secret_key->expanded != NULL) {
+		return secret_key->ops->sign(signature, signature_len, message, message_len, NULL, 0, secret_key);
+	}
+	return OQS_SIG_sign(sig, signature, signature_len, message, message_len, secret_key->bytes);
+}
+
+OQS_API OQS_STATUS OQS_SIG_key_sign_with_ctx_str(const OQS_SIG *sig, uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, const OQS_SIG_KEY *secret_key) {
+	if (!sig_key_matches(sig, secret_key, OQS_SIG_KEY_SECRET)) {
+		return OQS_ERROR;
+	}
+	if (secret_key->expanded != NULL) {
+		return secret_key->ops->sign(signature, signature_len, message, message_len, ctx_str, ctx_str_len, secret_key);
+	}
+	return OQS_SIG_sign_with_ctx_str(sig, signature, signature_len, message, message_len, ctx_str, ctx_str_len, secret_key->bytes);
+}
+
+OQS_API OQS_STATUS OQS_SIG_key_verify(const OQS_SIG *sig, const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const OQS_SIG_KEY *public_key) {
+	if (!sig_key_matches(sig, public_key, OQS_SIG_KEY_PUBLIC)) {
+		return OQS_ERROR;
+	}
+	if (public_key->expanded != NULL) {
+		return public_key->ops->verify(message, message_len, signature, signature_len, NULL, 0, public_key);
+	}
+	return OQS_SIG_verify(sig, message, message_len, signature, signature_len, public_key->bytes);
+}
+
+OQS_API OQS_STATUS OQS_SIG_key_verify_with_ctx_str(const OQS_SIG *sig, const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const OQS_SIG_KEY *public_key) {
+	if (!sig_key_matches(sig, public_key, OQS_SIG_KEY_PUBLIC)) {
+		return OQS_ERROR;
+	}
+	if (public_key->expanded != NULL) {
+		return public_key->ops->verify(message, message_len, signature, signature_len, ctx_str, ctx_str_len, public_key);
+	}
+	return OQS_SIG_verify_with_ctx_str(sig, message, message_len, signature, signature_len, ctx_str, ctx_str_len, public_key->bytes);
+}
+
+OQS_API OQS_STATUS OQS_SIG_key_export(const OQS_SIG_KEY *key, uint8_t *out, size_t out_len) {
+	if (key == NULL || out == NULL || out_len != key->bytes_len) {
+		return OQS_ERROR;
+	}
+	memcpy(out, key->bytes, out_len);
+	return OQS_SUCCESS;
+}
+
+OQS_API OQS_STATUS OQS_SIG_key_export_seed(const OQS_SIG_KEY *key, uint8_t *seed, size_t seed_len) {
+	if (key == NULL || key->seed == NULL || seed == NULL || seed_len != key->seed_len) {
+		return OQS_ERROR;
+	}
+	memcpy(seed, key->seed, seed_len);
+	return OQS_SUCCESS;
+}
+
+struct OQS_SIG_KEY_CACHE {
+	const OQS_SIG *sig;
+	size_t seed_len;
+	OQS_KEY_CACHE *cache;
+};
+
+static void sig_key_cache_free_value(void *value) {
+	OQS_SIG_key_free((OQS_SIG_KEY *) value);
+}
+
+OQS_API OQS_SIG_KEY_CACHE *OQS_SIG_key_cache_new(const OQS_SIG *sig, size_t max_bytes) {
+	OQS_SIG_KEY_CACHE *cache;
+
+	if (OQS_SIG_keypair_seed_length(sig) == 0) {
+		return NULL;
+	}
+	cache = OQS_MEM_malloc(sizeof(OQS_SIG_KEY_CACHE));
+	if (cache == NULL) {
+		return NULL;
+	}
+	cache->sig = sig;
+	cache->seed_len = OQS_SIG_keypair_seed_length(sig);
+	cache->cache = OQS_KEY_CACHE_new(max_bytes, sig_key_cache_free_value);
+	if (cache->cache == NULL) {
+		OQS_MEM_insecure_free(cache);
+		return NULL;
+	}
+	return cache;
+}
+
+OQS_API void OQS_SIG_key_cache_free(OQS_SIG_KEY_CACHE *cache) {
+	if (cache == NULL) {
+		return;
+	}
+	OQS_KEY_CACHE_free(cache->cache);
+	OQS_MEM_insecure_free(cache);
+}
+
+OQS_API OQS_STATUS OQS_SIG_key_cache_sign(OQS_SIG_KEY_CACHE *cache, uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *seed) {
+	/* keys are looked up by a hash of the seed, so that the table itself
+	 * holds no secret material */
+	uint8_t id[OQS_KEY_CACHE_ID_BYTES];
+	OQS_KEY_CACHE_ENTRY *entry;
+	const OQS_SIG_KEY *key;
+	OQS_STATUS rc;
+
+	if (cache == NULL || seed == NULL) {
+		return OQS_ERROR;
+	}
+	OQS_SHA3_sha3_256(id, seed, cache->seed_len);
+	entry = OQS_KEY_CACHE_acquire(cache->cache, id);
+	if (entry == NULL) {
+		OQS_SIG_KEY *handle = OQS_SIG_key_import(cache->sig, seed, cache->seed_len, OQS_SIG_KEY_SECRET | OQS_SIG_KEY_SEED);
+		if (handle == NULL) {
+			return OQS_ERROR;
+		}
+		entry = OQS_KEY_CACHE_insert(cache->cache, id, handle, sizeof(OQS_SIG_KEY) + handle->bytes_len + handle->seed_len + handle->expanded_len);
+		if (entry == NULL) {
+			return OQS_ERROR;
+		}
+	}
+	key = (const OQS_SIG_KEY *) OQS_KEY_CACHE_value(entry);
+	if (ctx_str == NULL && ctx_str_len == 0) {
+		rc = OQS_SIG_key_sign(cache->sig, signature, signature_len, message, message_len, key);
+	} else {
+		rc = OQS_SIG_key_sign_with_ctx_str(cache->sig, signature, signature_len, message, message_len, ctx_str, ctx_str_len, key);
+	}
+	OQS_KEY_CACHE_release(cache->cache, entry);
+	return rc;
+}
+
+OQS_API void OQS_SIG_key_cache_stats(OQS_SIG_KEY_CACHE *cache, OQS_KEY_CACHE_STATS *stats) {
+	if (cache == NULL || stats == NULL) {
+		return;
+	}
+	OQS_KEY_CACHE_stats(cache->cache, stats);
+}
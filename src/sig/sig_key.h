@@ -0,0 +1,57 @@
+// SPDX-License-Identifier: MIT
+
+/*
+ * Internal definition of OQS_SIG_KEY and the per-algorithm hooks behind
+ * OQS_SIG_key_import(). Not installed.
+ */
+
+#ifndef OQS_SIG_KEY_INTERNAL_H
+#define OQS_SIG_KEY_INTERNAL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <oqs/oqs.h>
+
+/*
+ * Algorithm hooks for precomputed keys. `expand` fills key->expanded (and
+ * key->expanded_len) from key->bytes, allocating with OQS_MEM_malloc; the
+ * generic code frees it with OQS_MEM_secure_free. `sign` is only called with
+ * expanded secret keys and `verify` only with expanded public keys.
+ */
+typedef struct OQS_SIG_KEY_ops {
+	OQS_STATUS (*expand)(OQS_SIG_KEY *key);
+	OQS_STATUS (*sign)(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len,
+	                   const uint8_t *ctx_str, size_t ctx_str_len, const OQS_SIG_KEY *secret_key);
+	OQS_STATUS (*verify)(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len,
+	                     const uint8_t *ctx_str, size_t ctx_str_len, const OQS_SIG_KEY *public_key);
+} OQS_SIG_KEY_ops;
+
+struct OQS_SIG_KEY {
+	/* method_name of the OQS_SIG the key was imported for */
+	const char *method_name;
+	/* OQS_SIG_KEY_PUBLIC or OQS_SIG_KEY_SECRET */
+	uint32_t type;
+	uint8_t *bytes;
+	size_t bytes_len;
+	/* seed the secret key was generated from (OQS_SIG_KEY_SEED), or NULL */
+	uint8_t *seed;
+	size_t seed_len;
+	/* algorithm-specific form, or NULL if only the bytes are held */
+	void *expanded;
+	size_t expanded_len;
+	const OQS_SIG_KEY_ops *ops;
+};
+
+/* Returns the hooks for the current platform, or NULL to keep keys as bytes. */
+#if defined(OQS_ENABLE_SIG_ml_dsa_44)
+const OQS_SIG_KEY_ops *OQS_SIG_ml_dsa_44_key_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_ml_dsa_65)
+const OQS_SIG_KEY_ops *OQS_SIG_ml_dsa_65_key_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_ml_dsa_87)
+const OQS_SIG_KEY_ops *OQS_SIG_ml_dsa_87_key_ops(void);
+#endif
+
+#endif // OQS_SIG_KEY_INTERNAL_H
@@ -0,0 +1,434 @@
+// SPDX-License-Identifier: MIT
+
+#include <string.h>
+#if defined(_WIN32)
+#define strcasecmp _stricmp
+#else
+#include <strings.h>
+#endif
+
+#include <oqs/oqs.h>
+
+#include "sig_verify.h"
+
+struct OQS_SIG_VERIFY_CTX {
+	const OQS_SIG_VERIFY_ops *ops;
+	void *state;
+	/* true from a successful init until final */
+	bool active;
+	uint8_t *signature;
+	size_t signature_len;
+	uint8_t *public_key;
+	size_t public_key_len;
+};
+
+/* Streaming verification hooks by algorithm; NULL if the algorithm cannot stream. */
+static const OQS_SIG_VERIFY_ops *sig_verify_ops(const char *method_name) {
+	///// OQS_COPY_FROM_UPSTREAM_FRAGMENT_VERIFY_OPS_START
+#if defined(OQS_ENABLE_SIG_falcon_512)
+	if (0 == strcasecmp(method_name, OQS_SIG_alg_falcon_512)) {
+		return OQS_SIG_falcon_512_verify_ops();
+	}
+#endif
+#if defined(OQS_ENABLE_SIG_falcon_1024)
+	if (0 == strcasecmp(method_name, OQS_SIG_alg_falcon_1024)) {
+		return OQS_SIG_falcon_1024_verify_ops();
+	}
+#endif
+#if defined(OQS_ENABLE_SIG_falcon_padded_512)
+	if (0 == strcasecmp(method_name, OQS_SIG_alg_falcon_padded_512)) {
+		return OQS_SIG_falcon_padded_512_verify_ops();
+	}
+#endif
+#if defined(OQS_ENABLE_SIG_falcon_padded_1024)
+	if (0 == strcasecmp(method_name, OQS_SIG_alg_falcon_padded_1024)) {
+		return OQS_SIG_falcon_padded_1024_verify_ops();
+	}
+#endif
+#if defined(OQS_ENABLE_SIG_mayo_1)
+	if (0 == strcasecmp(method_name, OQS_SIG_alg_mayo_1)) {
+		return OQS_SIG_mayo_1_verify_ops();
+	}
+#endif
+#if defined(OQS_ENABLE_SIG_mayo_2)
+	if (0 == strcasecmp(method_name, OQS_SIG_alg_mayo_2)) {
+		return OQS_SIG_mayo_2_verify_ops();
+	}
+#endif
+#if defined(OQS_ENABLE_SIG_mayo_3)
+	if (0 == strcasecmp(method_name, OQS_SIG_alg_mayo_3)) {
+		return OQS_SIG_mayo_3_verify_ops();
+	}
+#endif
+#if defined(OQS_ENABLE_SIG_mayo_5)
+	if (0 == strcasecmp(method_name, OQS_SIG_alg_mayo_5)) {
+		return OQS_SIG_mayo_5_verify_ops();
+	}
+#endif
+#if defined(OQS_ENABLE_SIG_cross_rsdp_128_balanced)
+	if (0 == strcasecmp(method_name, OQS_SIG_alg_cross_rsdp_128_balanced)) {
+		return OQS_SIG_cross_rsdp_128_balanced_verify_ops();
+	}
+#endif
+#if defined(OQS_ENABLE_SIG_cross_rsdp_128_fast)
+	if (0 == strcasecmp(method_name, OQS_SIG_alg_cross_rsdp_128_fast)) {
+		return OQS_SIG_cross_rsdp_128_fast_verify_ops();
+	}
+#endif
+#if defined(OQS_ENABLE_SIG_cross_rsdp_128_small)
+	if (0 == strcasecmp(method_name, OQS_SIG_alg_cross_rsdp_128_small)) {
+		return OQS_SIG_cross_rsdp_128_small_verify_ops();
+	}
+#endif
+#if defined(OQS_ENABLE_SIG_cross_rsdp_192_balanced)
+	if (0 == strcasecmp(method_name, OQS_SIG_alg_cross_rsdp_192_balanced)) {
+		return OQS_SIG_cross_rsdp_192_balanced_verify_ops();
+	}
+#endif
+#if defined(OQS_ENABLE_SIG_cross_rsdp_192_fast)
+	if (0 == strcasecmp(method_name, OQS_SIG_alg_cross_rsdp_192_fast)) {
+		return OQS_SIG_cross_rsdp_192_fast_verify_ops();
+	}
+#endif
+#if defined(OQS_ENABLE_SIG_cross_rsdp_192_small)
+	if (0 == strcasecmp(method_name, OQS_SIG_alg_cross_rsdp_192_small)) {
+		return OQS_SIG_cross_rsdp_192_small_verify_ops();
+	}
+#endif
+#if defined(OQS_ENABLE_SIG_cross_rsdp_256_balanced)
+	if (0 == strcasecmp(method_name, OQS_SIG_alg_cross_rsdp_256_balanced)) {
+		return OQS_SIG_cross_rsdp_256_balanced_verify_ops();
+	}
+#endif
+#if defined(OQS_ENABLE_SIG_cross_rsdp_256_fast)
+	if (0 == strcasecmp(method_name, OQS_SIG_alg_cross_rsdp_256_fast)) {
+		return OQS_SIG_cross_rsdp_256_fast_verify_ops();
+	}
+#endif
+#if defined(OQS_ENABLE_SIG_cross_rsdp_256_small)
+	if (0 == strcasecmp(method_name, OQS_SIG_alg_cross_rsdp_256_small)) {
+		return OQS_SIG_cross_rsdp_256_small_verify_ops();
+	}
+#endif
+#if defined(OQS_ENABLE_SIG_cross_rsdpg_128_balanced)
+	if (0 == strcasecmp(method_name, OQS_SIG_alg_cross_rsdpg_128_balanced)) {
+		return OQS_SIG_cross_rsdpg_128_balanced_verify_ops();
+	}
+#endif
+#if defined(OQS_ENABLE_SIG_cross_rsdpg_128_fast)
+	if (0 == strcasecmp(method_name, OQS_SIG_alg_cross_rsdpg_128_fast)) {
+		return OQS_SIG_cross_rsdpg_128_fast_verify_ops();
+	}
+#endif
+#if defined(OQS_ENABLE_SIG_cross_rsdpg_128_small)
+	if (0 == strcasecmp(method_name, OQS_SIG_alg_cross_rsdpg_128_small)) {
+		return OQS_SIG_cross_rsdpg_128_small_verify_ops();
+	}
+#endif
+#if defined(OQS_ENABLE_SIG_cross_rsdpg_192_balanced)
+	if (0 == strcasecmp(method_name, OQS_SIG_alg_cross_rsdpg_192_balanced)) {
+		return OQS_SIG_cross_rsdpg_192_balanced_verify_ops();
+	}
+#endif
+#if defined(OQS_ENABLE_SIG_cross_rsdpg_192_fast)
+	if (0 == strcasecmp(method_name, OQS_SIG_alg_cross_rsdpg_192_fast)) {
+		return OQS_SIG_cross_rsdpg_192_fast_verify_ops();
+	}
+#endif
+#if defined(OQS_ENABLE_SIG_cross_rsdpg_192_small)
+	if (0 == strcasecmp(method_name, OQS_SIG_alg_cross_rsdpg_192_small)) {
+		return OQS_SIG_cross_rsdpg_192_small_verify_ops();
+	}
+#endif
+#if defined(OQS_ENABLE_SIG_cross_rsdpg_256_balanced)
+	if (0 == strcasecmp(method_name, OQS_SIG_alg_cross_rsdpg_256_balanced)) {
+		return OQS_SIG_cross_rsdpg_256_balanced_verify_ops();
+	}
+#endif
+#if defined(OQS_ENABLE_SIG_cross_rsdpg_256_fast)
+	if (0 == strcasecmp(method_name, OQS_SIG_alg_cross_rsdpg_256_fast)) {
+		return OQS_SIG_cross_rsdpg_256_fast_verify_ops();
+	}
+#endif
+#if defined(OQS_ENABLE_SIG_cross_rsdpg_256_small)
+	if (0 == strcasecmp(method_name, OQS_SIG_alg_cross_rsdpg_256_small)) {
+		return OQS_SIG_cross_rsdpg_256_small_verify_ops();
+	}
+#endif
+#if defined(OQS_ENABLE_SIG_uov_ov_Is)
+	if (0 == strcasecmp(method_name, OQS_SIG_alg_uov_ov_Is)) {
+		return OQS_SIG_uov_ov_Is_verify_ops();
+	}
+#endif
+#if defined(OQS_ENABLE_SIG_uov_ov_Ip)
+	if (0 == strcasecmp(method_name, OQS_SIG_alg_uov_ov_Ip)) {
+		return OQS_SIG_uov_ov_Ip_verify_ops();
+	}
+#endif
+#if defined(OQS_ENABLE_SIG_uov_ov_III)
+	if (0 == strcasecmp(method_name, OQS_SIG_alg_uov_ov_III)) {
+		return OQS_SIG_uov_ov_III_verify_ops();
+	}
+#endif
+#if defined(OQS_ENABLE_SIG_uov_ov_V)
+	if (0 == strcasecmp(method_name, OQS_SIG_alg_uov_ov_V)) {
+		return OQS_SIG_uov_ov_V_verify_ops();
+	}
+#endif
+#if defined(OQS_ENABLE_SIG_uov_ov_Is_pkc)
+	if (0 == strcasecmp(method_name, OQS_SIG_alg_uov_ov_Is_pkc)) {
+		return OQS_SIG_uov_ov_Is_pkc_verify_ops();
+	}
+#endif
+#if defined(OQS_ENABLE_SIG_uov_ov_Ip_pkc)
+	if (0 == strcasecmp(method_name, OQS_SIG_alg_uov_ov_Ip_pkc)) {
+		return OQS_SIG_uov_ov_Ip_pkc_verify_ops();
+	}
+#endif
+#if defined(OQS_ENABLE_SIG_uov_ov_III_pkc)
+	if (0 == strcasecmp(method_name, OQS_SIG_alg_uov_ov_III_pkc)) {
+		return OQS_SIG_uov_ov_III_pkc_verify_ops();
+	}
+#endif
+#if defined(OQS_ENABLE_SIG_uov_ov_V_pkc)
+	if (0 == strcasecmp(method_name, OQS_SIG_alg_uov_ov_V_pkc)) {
+		return OQS_SIG_uov_ov_V_pkc_verify_ops();
+	}
+#endif
+#if defined(OQS_ENABLE_SIG_uov_ov_Is_pkc_skc)
+	if (0 == strcasecmp(method_name, OQS_SIG_alg_uov_ov_Is_pkc_skc)) {
+		return OQS_SIG_uov_ov_Is_pkc_skc_verify_ops();
+	}
+#endif
+#if defined(OQS_ENABLE_SIG_uov_ov_Ip_pkc_skc)
+	if (0 == strcasecmp(method_name, OQS_SIG_alg_uov_ov_Ip_pkc_skc)) {
+		return OQS_SIG_uov_ov_Ip_pkc_skc_verify_ops();
+	}
+#endif
+#if defined(OQS_ENABLE_SIG_uov_ov_III_pkc_skc)
+	if (0 == strcasecmp(method_name, OQS_SIG_alg_uov_ov_III_pkc_skc)) {
+		return OQS_SIG_uov_ov_III_pkc_skc_verify_ops();
+	}
+#endif
+#if defined(OQS_ENABLE_SIG_uov_ov_V_pkc_skc)
+	if (0 == strcasecmp(method_name, OQS_SIG_alg_uov_ov_V_pkc_skc)) {
+		return OQS_SIG_uov_ov_V_pkc_skc_verify_ops();
+	}
+#endif
+#if defined(OQS_ENABLE_SIG_snova_SNOVA_24_5_4)
+	if (0 == strcasecmp(method_name, OQS_SIG_alg_snova_SNOVA_24_5_4)) {
+		return OQS_SIG_snova_SNOVA_24_5_4_verify_ops();
+	}
+#endif
+#if defined(OQS_ENABLE_SIG_snova_SNOVA_24_5_4_SHAKE)
+	if (0 == strcasecmp(method_name, OQS_SIG_alg_snova_SNOVA_24_5_4_SHAKE)) {
+		return OQS_SIG_snova_SNOVA_24_5_4_SHAKE_verify_ops();
+	}
+#endif
+#if defined(OQS_ENABLE_SIG_snova_SNOVA_24_5_4_esk)
+	if (0 == strcasecmp(method_name, OQS_SIG_alg_snova_SNOVA_24_5_4_esk)) {
+		return OQS_SIG_snova_SNOVA_24_5_4_esk_verify_ops();
+	}
+#endif
+#if defined(OQS_ENABLE_SIG_snova_SNOVA_24_5_4_SHAKE_esk)
+	if (0 == strcasecmp(method_name, OQS_SIG_alg_snova_SNOVA_24_5_4_SHAKE_esk)) {
+		return OQS_SIG_snova_SNOVA_24_5_4_SHAKE_esk_verify_ops();
+	}
+#endif
+#if defined(OQS_ENABLE_SIG_snova_SNOVA_37_17_2)
+	if (0 == strcasecmp(method_name, OQS_SIG_alg_snova_SNOVA_37_17_2)) {
+		return OQS_SIG_snova_SNOVA_37_17_2_verify_ops();
+	}
+#endif
+#if defined(OQS_ENABLE_SIG_snova_SNOVA_25_8_3)
+	if (0 == strcasecmp(method_name, OQS_SIG_alg_snova_SNOVA_25_8_3)) {
+		return OQS_SIG_snova_SNOVA_25_8_3_verify_ops();
+	}
+#endif
+#if defined(OQS_ENABLE_SIG_snova_SNOVA_56_25_2)
+	if (0 == strcasecmp(method_name, OQS_SIG_alg_snova_SNOVA_56_25_2)) {
+		return OQS_SIG_snova_SNOVA_56_25_2_verify_ops();
+	}
+#endif
+#if defined(OQS_ENABLE_SIG_snova_SNOVA_49_11_3)
+	if (0 == strcasecmp(method_name, OQS_SIG_alg_snova_SNOVA_49_11_3)) {
+		return OQS_SIG_snova_SNOVA_49_11_3_verify_ops();
+	}
+#endif
+#if defined(OQS_ENABLE_SIG_snova_SNOVA_37_8_4)
+	if (0 == strcasecmp(method_name, OQS_SIG_alg_snova_SNOVA_37_8_4)) {
+		return OQS_SIG_snova_SNOVA_37_8_4_verify_ops();
+	}
+#endif
+#if defined(OQS_ENABLE_SIG_snova_SNOVA_24_5_5)
+	if (0 == strcasecmp(method_name, OQS_SIG_alg_snova_SNOVA_24_5_5)) {
+		return OQS_SIG_snova_SNOVA_24_5_5_verify_ops();
+	}
+#endif
+#if defined(OQS_ENABLE_SIG_snova_SNOVA_60_10_4)
+	if (0 == strcasecmp(method_name, OQS_SIG_alg_snova_SNOVA_60_10_4)) {
+		return OQS_SIG_snova_SNOVA_60_10_4_verify_ops();
+	}
+#endif
+#if defined(OQS_ENABLE_SIG_snova_SNOVA_29_6_5)
+	if (0 == strcasecmp(method_name, OQS_SIG_alg_snova_SNOVA_29_6_5)) {
+		return OQS_SIG_snova_SNOVA_29_6_5_verify_ops();
+	}
+#endif
+	///// OQS_COPY_FROM_UPSTREAM_FRAGMENT_VERIFY_OPS_END
+	///// OQS_COPY_FROM_SLH_DSA_FRAGMENT_VERIFY_OPS_START
+#if defined(OQS_ENABLE_SIG_slh_dsa_pure_sha2_128s)
+	if (0 == strcasecmp(method_name, OQS_SIG_alg_slh_dsa_pure_sha2_128s)) {
+		return OQS_SIG_slh_dsa_pure_sha2_128s_verify_ops();
+	}
+#endif
+#if defined(OQS_ENABLE_SIG_slh_dsa_pure_sha2_128f)
+	if (0 == strcasecmp(method_name, OQS_SIG_alg_slh_dsa_pure_sha2_128f)) {
+		return OQS_SIG_slh_dsa_pure_sha2_128f_verify_ops();
+	}
+#endif
+#if defined(OQS_ENABLE_SIG_slh_dsa_pure_sha2_192s)
+	if (0 == strcasecmp(method_name, OQS_SIG_alg_slh_dsa_pure_sha2_192s)) {
+		return OQS_SIG_slh_dsa_pure_sha2_192s_verify_ops();
+	}
+#endif
+#if defined(OQS_ENABLE_SIG_slh_dsa_pure_sha2_192f)
+	if (0 == strcasecmp(method_name, OQS_SIG_alg_slh_dsa_pure_sha2_192f)) {
+		return OQS_SIG_slh_dsa_pure_sha2_192f_verify_ops();
+	}
+#endif
+#if defined(OQS_ENABLE_SIG_slh_dsa_pure_sha2_256s)
+	if (0 == strcasecmp(method_name, OQS_SIG_alg_slh_dsa_pure_sha2_256s)) {
+		return OQS_SIG_slh_dsa_pure_sha2_256s_verify_ops();
+	}
+#endif
+#if defined(OQS_ENABLE_SIG_slh_dsa_pure_sha2_256f)
+	if (0 == strcasecmp(method_name, OQS_SIG_alg_slh_dsa_pure_sha2_256f)) {
+		return OQS_SIG_slh_dsa_pure_sha2_256f_verify_ops();
+	}
+#endif
+#if defined(OQS_ENABLE_SIG_slh_dsa_pure_shake_128s)
+	if (0 == strcasecmp(method_name, OQS_SIG_alg_slh_dsa_pure_shake_128s)) {
+		return OQS_SIG_slh_dsa_pure_shake_128s_verify_ops();
+	}
+#endif
+#if defined(OQS_ENABLE_SIG_slh_dsa_pure_shake_128f)
+	if (0 == strcasecmp(method_name, OQS_SIG_alg_slh_dsa_pure_shake_128f)) {
+		return OQS_SIG_slh_dsa_pure_shake_128f_verify_ops();
+	}
+#endif
+#if defined(OQS_ENABLE_SIG_slh_dsa_pure_shake_192s)
+	if (0 == strcasecmp(method_name, OQS_SIG_alg_slh_dsa_pure_shake_192s)) {
+		return OQS_SIG_slh_dsa_pure_shake_192s_verify_ops();
+	}
+#endif
+#if defined(OQS_ENABLE_SIG_slh_dsa_pure_shake_192f)
+	if (0 == strcasecmp(method_name, OQS_SIG_alg_slh_dsa_pure_shake_192f)) {
+		return OQS_SIG_slh_dsa_pure_shake_192f_verify_ops();
+	}
+#endif
+#if defined(OQS_ENABLE_SIG_slh_dsa_pure_shake_256s)
+	if (0 == strcasecmp(method_name, OQS_SIG_alg_slh_dsa_pure_shake_256s)) {
+		return OQS_SIG_slh_dsa_pure_shake_256s_verify_ops();
+	}
+#endif
+#if defined(OQS_ENABLE_SIG_slh_dsa_pure_shake_256f)
+	if (0 == strcasecmp(method_name, OQS_SIG_alg_slh_dsa_pure_shake_256f)) {
+		return OQS_SIG_slh_dsa_pure_shake_256f_verify_ops();
+	}
+#endif
+	///// OQS_COPY_FROM_SLH_DSA_FRAGMENT_VERIFY_OPS_END
+	(void) method_name;
+	return NULL;
+}
+
+OQS_API OQS_STATUS OQS_SIG_verify_init(const OQS_SIG *sig, OQS_SIG_VERIFY_CTX **ctx, const uint8_t *signature, size_t signature_len, const uint8_t *public_key) {
+	return OQS_SIG_verify_init_with_ctx_str(sig, ctx, signature, signature_len, NULL, 0, public_key);
+}
+
+OQS_API OQS_STATUS OQS_SIG_verify_init_with_ctx_str(const OQS_SIG *sig, OQS_SIG_VERIFY_CTX **ctx, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key) {
+	if (ctx == NULL) {
+		return OQS_ERROR;
+	}
+	*ctx = NULL;
+	if (sig == NULL || signature == NULL || public_key == NULL || signature_len > sig->length_signature) {
+		return OQS_ERROR;
+	}
+	const OQS_SIG_VERIFY_ops *ops = sig_verify_ops(sig->method_name);
+	if (ops == NULL) {
+		return OQS_ERROR;
+	}
+
+	OQS_SIG_VERIFY_CTX *c = OQS_MEM_calloc(1, sizeof(OQS_SIG_VERIFY_CTX));
+	if (c == NULL) {
+		return OQS_ERROR;
+	}
+	c->ops = ops;
+	c->signature_len = signature_len;
+	c->public_key_len = sig->length_public_key;
+	c->state = OQS_MEM_calloc(1, ops->state_len);
+	/* the signature and public key are only read again by final, but the
+	 * caller need not keep them until then */
+	c->signature = OQS_MEM_malloc(signature_len > 0 ? signature_len : 1);
+	c->public_key = OQS_MEM_malloc(c->public_key_len);
+	if (c->state == NULL || c->signature == NULL || c->public_key == NULL) {
+		OQS_SIG_VERIFY_CTX_free(c);
+		return OQS_ERROR;
+	}
+	memcpy(c->signature, signature, signature_len);
+	memcpy(c->public_key, public_key, c->public_key_len);
+
+	if (ops->init(c->state, c->signature, c->signature_len, ctx_str, ctx_str_len, c->public_key) != OQS_SUCCESS) {
+		OQS_SIG_VERIFY_CTX_free(c);
+		return OQS_ERROR;
+	}
+	c->active = true;
+	*ctx = c;
+	return OQS_SUCCESS;
+}
+
+OQS_API OQS_STATUS OQS_SIG_verify_update(OQS_SIG_VERIFY_CTX *ctx, const uint8_t *message, size_t message_len) {
+	if (ctx == NULL || !ctx->active || (message == NULL && message_len != 0)) {
+		return OQS_ERROR;
+	}
+	if (message_len > 0) {
+		ctx->ops->update(ctx->state, message, message_len);
+	}
+	return OQS_SUCCESS;
+}
+
+OQS_API OQS_STATUS OQS_SIG_verify_final(OQS_SIG_VERIFY_CTX *ctx) {
+	if (ctx == NULL || !ctx->active) {
+		return OQS_ERROR;
+	}
+	ctx->active = false;
+	if (ctx->ops->final(ctx->state, ctx->signature, ctx->signature_len, ctx->public_key) != OQS_SUCCESS) {
+		return OQS_ERROR;
+	}
+	return OQS_SUCCESS;
+}
+
+OQS_API void OQS_SIG_VERIFY_CTX_free(OQS_SIG_VERIFY_CTX *ctx) {
+	if (ctx == NULL) {
+		return;
+	}
+	if (ctx->active) {
+		ctx->ops->abort(ctx->state);
+	}
+	if (ctx->state != NULL) {
+		OQS_MEM_secure_free(ctx->state, ctx->ops->state_len);
+	}
+	OQS_MEM_insecure_free(ctx->signature);
+	OQS_MEM_insecure_free(ctx->public_key);
+	OQS_MEM_insecure_free(ctx);
+}
+
+OQS_API bool OQS_SIG_supports_verify_stream(const char *alg_name) {
+	OQS_SIG *sig = OQS_SIG_new(alg_name);
+	if (sig == NULL) {
+		return false;
+	}
+	bool result = sig_verify_ops(sig->method_name) != NULL;
+	OQS_SIG_free(sig);
+	return result;
+}
@@ -0,0 +1,224 @@
+// SPDX-License-Identifier: MIT
+
+/*
+ * Internal per-algorithm hooks behind OQS_SIG_verify_init(). Not installed.
+ */
+
+#ifndef OQS_SIG_VERIFY_INTERNAL_H
+#define OQS_SIG_VERIFY_INTERNAL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <oqs/oqs.h>
+
+/*
+ * Algorithm hooks for streaming verification. The generic code allocates
+ * `state_len` zeroed bytes for the state. `init` starts hashing the message
+ * and leaves nothing to release if it fails; after a successful `init`, the
+ * generic code calls any number of `update` and then exactly one of `final`
+ * and `abort`, both of which release what `init` acquired. `final` is given
+ * the same signature and public key as `init`.
+ */
+typedef struct OQS_SIG_VERIFY_ops {
+	size_t state_len;
+	OQS_STATUS (*init)(void *state, const uint8_t *signature, size_t signature_len,
+	                   const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key);
+	void (*update)(void *state, const uint8_t *message, size_t message_len);
+	OQS_STATUS (*final)(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+	void (*abort)(void *state);
+} OQS_SIG_VERIFY_ops;
+
+/* Returns the hooks for the algorithm, or NULL if it cannot stream. */
+///// OQS_COPY_FROM_UPSTREAM_FRAGMENT_VERIFY_OPS_START
+#if defined(OQS_ENABLE_SIG_falcon_512)
+const OQS_SIG_VERIFY_ops *OQS_SIG_falcon_512_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_falcon_1024)
+const OQS_SIG_VERIFY_ops *OQS_SIG_falcon_1024_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_falcon_padded_512)
+const OQS_SIG_VERIFY_ops *OQS_SIG_falcon_padded_512_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_falcon_padded_1024)
+const OQS_SIG_VERIFY_ops *OQS_SIG_falcon_padded_1024_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_mayo_1)
+const OQS_SIG_VERIFY_ops *OQS_SIG_mayo_1_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_mayo_2)
+const OQS_SIG_VERIFY_ops *OQS_SIG_mayo_2_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_mayo_3)
+const OQS_SIG_VERIFY_ops *OQS_SIG_mayo_3_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_mayo_5)
+const OQS_SIG_VERIFY_ops *OQS_SIG_mayo_5_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_cross_rsdp_128_balanced)
+const OQS_SIG_VERIFY_ops *OQS_SIG_cross_rsdp_128_balanced_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_cross_rsdp_128_fast)
+const OQS_SIG_VERIFY_ops *OQS_SIG_cross_rsdp_128_fast_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_cross_rsdp_128_small)
+const OQS_SIG_VERIFY_ops *OQS_SIG_cross_rsdp_128_small_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_cross_rsdp_192_balanced)
+const OQS_SIG_VERIFY_ops *OQS_SIG_cross_rsdp_192_balanced_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_cross_rsdp_192_fast)
+const OQS_SIG_VERIFY_ops *OQS_SIG_cross_rsdp_192_fast_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_cross_rsdp_192_small)
+const OQS_SIG_VERIFY_ops *OQS_SIG_cross_rsdp_192_small_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_cross_rsdp_256_balanced)
+const OQS_SIG_VERIFY_ops *OQS_SIG_cross_rsdp_256_balanced_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_cross_rsdp_256_fast)
+const OQS_SIG_VERIFY_ops *OQS_SIG_cross_rsdp_256_fast_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_cross_rsdp_256_small)
+const OQS_SIG_VERIFY_ops *OQS_SIG_cross_rsdp_256_small_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_cross_rsdpg_128_balanced)
+const OQS_SIG_VERIFY_ops *OQS_SIG_cross_rsdpg_128_balanced_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_cross_rsdpg_128_fast)
+const OQS_SIG_VERIFY_ops *OQS_SIG_cross_rsdpg_128_fast_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_cross_rsdpg_128_small)
+const OQS_SIG_VERIFY_ops *OQS_SIG_cross_rsdpg_128_small_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_cross_rsdpg_192_balanced)
+const OQS_SIG_VERIFY_ops *OQS_SIG_cross_rsdpg_192_balanced_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_cross_rsdpg_192_fast)
+const OQS_SIG_VERIFY_ops *OQS_SIG_cross_rsdpg_192_fast_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_cross_rsdpg_192_small)
+const OQS_SIG_VERIFY_ops *OQS_SIG_cross_rsdpg_192_small_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_cross_rsdpg_256_balanced)
+const OQS_SIG_VERIFY_ops *OQS_SIG_cross_rsdpg_256_balanced_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_cross_rsdpg_256_fast)
+const OQS_SIG_VERIFY_ops *OQS_SIG_cross_rsdpg_256_fast_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_cross_rsdpg_256_small)
+const OQS_SIG_VERIFY_ops *OQS_SIG_cross_rsdpg_256_small_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_uov_ov_Is)
+const OQS_SIG_VERIFY_ops *OQS_SIG_uov_ov_Is_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_uov_ov_Ip)
+const OQS_SIG_VERIFY_ops *OQS_SIG_uov_ov_Ip_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_uov_ov_III)
+const OQS_SIG_VERIFY_ops *OQS_SIG_uov_ov_III_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_uov_ov_V)
+const OQS_SIG_VERIFY_ops *OQS_SIG_uov_ov_V_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_uov_ov_Is_pkc)
+const OQS_SIG_VERIFY_ops *OQS_SIG_uov_ov_Is_pkc_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_uov_ov_Ip_pkc)
+const OQS_SIG_VERIFY_ops *OQS_SIG_uov_ov_Ip_pkc_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_uov_ov_III_pkc)
+const OQS_SIG_VERIFY_ops *OQS_SIG_uov_ov_III_pkc_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_uov_ov_V_pkc)
+const OQS_SIG_VERIFY_ops *OQS_SIG_uov_ov_V_pkc_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_uov_ov_Is_pkc_skc)
+const OQS_SIG_VERIFY_ops *OQS_SIG_uov_ov_Is_pkc_skc_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_uov_ov_Ip_pkc_skc)
+const OQS_SIG_VERIFY_ops *OQS_SIG_uov_ov_Ip_pkc_skc_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_uov_ov_III_pkc_skc)
+const OQS_SIG_VERIFY_ops *OQS_SIG_uov_ov_III_pkc_skc_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_uov_ov_V_pkc_skc)
+const OQS_SIG_VERIFY_ops *OQS_SIG_uov_ov_V_pkc_skc_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_snova_SNOVA_24_5_4)
+const OQS_SIG_VERIFY_ops *OQS_SIG_snova_SNOVA_24_5_4_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_snova_SNOVA_24_5_4_SHAKE)
+const OQS_SIG_VERIFY_ops *OQS_SIG_snova_SNOVA_24_5_4_SHAKE_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_snova_SNOVA_24_5_4_esk)
+const OQS_SIG_VERIFY_ops *OQS_SIG_snova_SNOVA_24_5_4_esk_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_snova_SNOVA_24_5_4_SHAKE_esk)
+const OQS_SIG_VERIFY_ops *OQS_SIG_snova_SNOVA_24_5_4_SHAKE_esk_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_snova_SNOVA_37_17_2)
+const OQS_SIG_VERIFY_ops *OQS_SIG_snova_SNOVA_37_17_2_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_snova_SNOVA_25_8_3)
+const OQS_SIG_VERIFY_ops *OQS_SIG_snova_SNOVA_25_8_3_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_snova_SNOVA_56_25_2)
+const OQS_SIG_VERIFY_ops *OQS_SIG_snova_SNOVA_56_25_2_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_snova_SNOVA_49_11_3)
+const OQS_SIG_VERIFY_ops *OQS_SIG_snova_SNOVA_49_11_3_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_snova_SNOVA_37_8_4)
+const OQS_SIG_VERIFY_ops *OQS_SIG_snova_SNOVA_37_8_4_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_snova_SNOVA_24_5_5)
+const OQS_SIG_VERIFY_ops *OQS_SIG_snova_SNOVA_24_5_5_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_snova_SNOVA_60_10_4)
+const OQS_SIG_VERIFY_ops *OQS_SIG_snova_SNOVA_60_10_4_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_snova_SNOVA_29_6_5)
+const OQS_SIG_VERIFY_ops *OQS_SIG_snova_SNOVA_29_6_5_verify_ops(void);
+#endif
+///// OQS_COPY_FROM_UPSTREAM_FRAGMENT_VERIFY_OPS_END
+///// OQS_COPY_FROM_SLH_DSA_FRAGMENT_VERIFY_OPS_START
+#if defined(OQS_ENABLE_SIG_slh_dsa_pure_sha2_128s)
+const OQS_SIG_VERIFY_ops *OQS_SIG_slh_dsa_pure_sha2_128s_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_slh_dsa_pure_sha2_128f)
+const OQS_SIG_VERIFY_ops *OQS_SIG_slh_dsa_pure_sha2_128f_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_slh_dsa_pure_sha2_192s)
+const OQS_SIG_VERIFY_ops *OQS_SIG_slh_dsa_pure_sha2_192s_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_slh_dsa_pure_sha2_192f)
+const OQS_SIG_VERIFY_ops *OQS_SIG_slh_dsa_pure_sha2_192f_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_slh_dsa_pure_sha2_256s)
+const OQS_SIG_VERIFY_ops *OQS_SIG_slh_dsa_pure_sha2_256s_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_slh_dsa_pure_sha2_256f)
+const OQS_SIG_VERIFY_ops *OQS_SIG_slh_dsa_pure_sha2_256f_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_slh_dsa_pure_shake_128s)
+const OQS_SIG_VERIFY_ops *OQS_SIG_slh_dsa_pure_shake_128s_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_slh_dsa_pure_shake_128f)
+const OQS_SIG_VERIFY_ops *OQS_SIG_slh_dsa_pure_shake_128f_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_slh_dsa_pure_shake_192s)
+const OQS_SIG_VERIFY_ops *OQS_SIG_slh_dsa_pure_shake_192s_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_slh_dsa_pure_shake_192f)
+const OQS_SIG_VERIFY_ops *OQS_SIG_slh_dsa_pure_shake_192f_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_slh_dsa_pure_shake_256s)
+const OQS_SIG_VERIFY_ops *OQS_SIG_slh_dsa_pure_shake_256s_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_slh_dsa_pure_shake_256f)
+const OQS_SIG_VERIFY_ops *OQS_SIG_slh_dsa_pure_shake_256f_verify_ops(void);
+#endif
+///// OQS_COPY_FROM_SLH_DSA_FRAGMENT_VERIFY_OPS_END
+
+#endif // OQS_SIG_VERIFY_INTERNAL_H
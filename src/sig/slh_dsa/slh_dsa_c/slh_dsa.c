@@ -716,3 +716,41 @@ int slh_verify(const uint8_t *m, size_t m_sz, const uint8_t *sig, size_t sig_sz,
 
   return slh_verify_digest(&var, digest, sig, sig_sz, prm);
 }
+
+/* === Streaming verification of a pure SLH-DSA signature. */
+/* R = SIG[0:n] is absorbed by slh_verify_init(), before M. */
+
+int slh_verify_init(slh_h_msg_t *st, const uint8_t *sig, size_t sig_sz,
+                    const uint8_t *ctx, size_t ctx_sz, const uint8_t *pk,
+                    const slh_param_t *prm)
+{
+  slh_var_t var;
+
+  if (ctx_sz > 255 || sig_sz != slh_sig_sz(prm))
+  {
+    return 0; /* false */
+  }
+
+  prm->mk_var(&var, pk, NULL, prm);
+  prm->h_msg_init(&var, st, sig, ctx, ctx_sz);
+
+  return 1;
+}
+
+void slh_verify_update(slh_h_msg_t *st, const uint8_t *m, size_t m_sz,
+                       const slh_param_t *prm)
+{
+  prm->h_msg_update(st, m, m_sz);
+}
+
+int slh_verify_final(slh_h_msg_t *st, const uint8_t *sig, size_t sig_sz,
+                     const uint8_t *pk, const slh_param_t *prm)
+{
+  slh_var_t var;
+  uint8_t digest[SLH_MAX_M];
+
+  prm->mk_var(&var, pk, NULL, prm);
+  prm->h_msg_final(&var, st, digest, sig);
+
+  return slh_verify_digest(&var, digest, sig, sig_sz, prm);
+}
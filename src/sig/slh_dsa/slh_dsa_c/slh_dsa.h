@@ -17,6 +17,8 @@ extern "C"
 #include <stddef.h>
 #include <stdint.h>
 #include <oqs/oqs.h>
+#include "sha2_api.h"
+#include "sha3_api.h"
 
 #ifndef _SLH_PARAM_H_
   typedef struct slh_param_s slh_param_t;
@@ -78,6 +80,27 @@ extern "C"
                  size_t sig_sz, const uint8_t *ctx, size_t ctx_sz,
                  const uint8_t *pk, const slh_param_t *prm);
 
+  /* Streaming slh_verify(): the message is passed to slh_verify_update() */
+  /* in chunks. slh_verify_init() returns 0 on a malformed signature or */
+  /* context, 1 otherwise; slh_verify_final() returns as slh_verify(). */
+  /* The same sig and pk must be passed to _init() and _final(). */
+  typedef union slh_h_msg_u
+  {
+    sha2_256_t sha2_256;
+    sha2_512_t sha2_512;
+    sha3_var_t sha3;
+  } slh_h_msg_t;
+
+  int slh_verify_init(slh_h_msg_t *st, const uint8_t *sig, size_t sig_sz,
+                      const uint8_t *ctx, size_t ctx_sz, const uint8_t *pk,
+                      const slh_param_t *prm);
+
+  void slh_verify_update(slh_h_msg_t *st, const uint8_t *m, size_t m_sz,
+                         const slh_param_t *prm);
+
+  int slh_verify_final(slh_h_msg_t *st, const uint8_t *sig, size_t sig_sz,
+                       const uint8_t *pk, const slh_param_t *prm);
+
 #ifdef __cplusplus
 }
 #endif
@@ -23,6 +23,7 @@ typedef union
 typedef struct slh_param_s slh_param_t;
 #endif
 typedef struct slh_var_s slh_var_t;
+union slh_h_msg_u;
 
 /* used to indicate _internal mode */
 #define SLH_CTX_SZ_NO_CONTEXT 0x100
@@ -50,6 +51,12 @@ struct slh_param_s
   void (*fors_hash)(slh_var_t *var, uint8_t *tmp, uint32_t s);
   void (*h_msg)(slh_var_t *var, uint8_t *h, const uint8_t *r, const uint8_t *m,
                 size_t m_sz, const uint8_t *ctx, size_t ctx_sz);
+  /* h_msg split for a message passed in chunks */
+  void (*h_msg_init)(slh_var_t *var, union slh_h_msg_u *st, const uint8_t *r,
+                     const uint8_t *ctx, size_t ctx_sz);
+  void (*h_msg_update)(union slh_h_msg_u *st, const uint8_t *m, size_t m_sz);
+  void (*h_msg_final)(slh_var_t *var, union slh_h_msg_u *st, uint8_t *h,
+                      const uint8_t *r);
   void (*prf)(slh_var_t *var, uint8_t *h);
   void (*prf_msg)(slh_var_t *var, uint8_t *h, const uint8_t *opt_rand,
                   const uint8_t *m, size_t m_sz, const uint8_t *ctx,
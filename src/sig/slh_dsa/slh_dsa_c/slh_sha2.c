@@ -11,39 +11,53 @@
 #include "sha2_api.h"
 #include "slh_adrs.h"
 #include "slh_var.h"
+#include "slh_dsa.h"
 
 /* Cat 1: Hmsg(R, PK.seed, PK.root, M) = */
 /* MGF1-SHA-256(R || PK.seed || SHA-256(R ||PK.seed || PK.root || */
 /* M), m) */
 
-static void sha2_256_h_msg(slh_var_t *var, uint8_t *h, const uint8_t *r,
-                           const uint8_t *m, size_t m_sz, const uint8_t *ctx,
-                           size_t ctx_sz)
+static void sha2_256_h_msg_init(slh_var_t *var, slh_h_msg_t *st,
+                                const uint8_t *r, const uint8_t *ctx,
+                                size_t ctx_sz)
 {
-  sha2_256_t sha2;
-  size_t i;
   size_t n = var->prm->n;
-  uint8_t buf[16 + 16 + 32 + 4];
-  size_t mgf_sz;
-  uint8_t *ctr;
+  uint8_t buf[2];
 
   /* SHA-256(R || PK.seed || PK.root || M) */
-  sha2_256_init(&sha2);
-  sha2_256_update(&sha2, r, n);
-  sha2_256_update(&sha2, var->pk_seed, n);
-  sha2_256_update(&sha2, var->pk_root, n);
+  sha2_256_init(&st->sha2_256);
+  sha2_256_update(&st->sha2_256, r, n);
+  sha2_256_update(&st->sha2_256, var->pk_seed, n);
+  sha2_256_update(&st->sha2_256, var->pk_root, n);
 
   /* add "pure" domain separator and context, if supplied */
   if (ctx_sz != SLH_CTX_SZ_NO_CONTEXT)
   {
     buf[0] = 0;
     buf[1] = ctx_sz & 0xFF;
-    sha2_256_update(&sha2, buf, 2);
-    sha2_256_update(&sha2, ctx, ctx_sz);
+    sha2_256_update(&st->sha2_256, buf, 2);
+    sha2_256_update(&st->sha2_256, ctx, ctx_sz);
   }
+}
+
+static void sha2_256_h_msg_update(slh_h_msg_t *st, const uint8_t *m,
+                                  size_t m_sz)
+{
   /* message */
-  sha2_256_update(&sha2, m, m_sz);
-  sha2_256_final(&sha2, buf + 2 * n);
+  sha2_256_update(&st->sha2_256, m, m_sz);
+}
+
+static void sha2_256_h_msg_final(slh_var_t *var, slh_h_msg_t *st,
+                                 uint8_t *h, const uint8_t *r)
+{
+  sha2_256_t sha2;
+  size_t i;
+  size_t n = var->prm->n;
+  uint8_t buf[16 + 16 + 32 + 4];
+  size_t mgf_sz;
+  uint8_t *ctr;
+
+  sha2_256_final(&st->sha2_256, buf + 2 * n);
 
   /* MGF1-SHA-256(R || PK.seed || .. */
   memcpy(buf, r, n);
@@ -75,37 +89,62 @@ static void sha2_256_h_msg(slh_var_t *var, uint8_t *h, const uint8_t *r,
   }
 }
 
+static void sha2_256_h_msg(slh_var_t *var, uint8_t *h, const uint8_t *r,
+                           const uint8_t *m, size_t m_sz, const uint8_t *ctx,
+                           size_t ctx_sz)
+{
+  slh_h_msg_t st;
+
+  sha2_256_h_msg_init(var, &st, r, ctx, ctx_sz);
+  sha2_256_h_msg_update(&st, m, m_sz);
+  sha2_256_h_msg_final(var, &st, h, r);
+}
+
 /* Cat 3, 5: Hmsg(R, PK.seed, PK.root, M) = */
 /* MGF1-SHA-512(R || PK.seed || SHA-512(R || PK.seed || PK.root || */
 /* M), m) */
 
-static void sha2_512_h_msg(slh_var_t *var, uint8_t *h, const uint8_t *r,
-                           const uint8_t *m, size_t m_sz, const uint8_t *ctx,
-                           size_t ctx_sz)
+static void sha2_512_h_msg_init(slh_var_t *var, slh_h_msg_t *st,
+                                const uint8_t *r, const uint8_t *ctx,
+                                size_t ctx_sz)
 {
-  size_t i;
-  sha2_512_t sha2;
-  uint8_t buf[32 + 32 + 64 + 4];
-  size_t mgf_sz;
-  uint8_t *ctr;
   size_t n = var->prm->n;
+  uint8_t buf[2];
 
   /* SHA-512(R || PK.seed || PK.root || M) */
-  sha2_512_init(&sha2);
-  sha2_512_update(&sha2, r, n);
-  sha2_512_update(&sha2, var->pk_seed, n);
-  sha2_512_update(&sha2, var->pk_root, n);
+  sha2_512_init(&st->sha2_512);
+  sha2_512_update(&st->sha2_512, r, n);
+  sha2_512_update(&st->sha2_512, var->pk_seed, n);
+  sha2_512_update(&st->sha2_512, var->pk_root, n);
 
   /* add "pure" domain separator and context, if supplied */
   if (ctx_sz != SLH_CTX_SZ_NO_CONTEXT)
   {
     buf[0] = 0;
     buf[1] = ctx_sz & 0xFF;
-    sha2_512_update(&sha2, buf, 2);
-    sha2_512_update(&sha2, ctx, ctx_sz);
+    sha2_512_update(&st->sha2_512, buf, 2);
+    sha2_512_update(&st->sha2_512, ctx, ctx_sz);
   }
-  sha2_512_update(&sha2, m, m_sz);
-  sha2_512_final(&sha2, buf + 2 * n);
+}
+
+static void sha2_512_h_msg_update(slh_h_msg_t *st, const uint8_t *m,
+                                  size_t m_sz)
+{
+  /* message */
+  sha2_512_update(&st->sha2_512, m, m_sz);
+}
+
+static void sha2_512_h_msg_final(slh_var_t *var, slh_h_msg_t *st,
+                                 uint8_t *h, const uint8_t *r)
+{
+  sha2_512_t sha2;
+  size_t i;
+  size_t n = var->prm->n;
+  uint8_t buf[32 + 32 + 64 + 4];
+  size_t mgf_sz;
+  uint8_t *ctr;
+
+  sha2_512_final(&st->sha2_512, buf + 2 * n);
 
   /* MGF1-SHA-512(R || PK.seed || .. */
   memcpy(buf, r, n);
@@ -137,6 +176,17 @@ static void sha2_512_h_msg(slh_var_t *var, uint8_t *h, const uint8_t *r,
   }
 }
 
+static void sha2_512_h_msg(slh_var_t *var, uint8_t *h, const uint8_t *r,
+                           const uint8_t *m, size_t m_sz, const uint8_t *ctx,
+                           size_t ctx_sz)
+{
+  slh_h_msg_t st;
+
+  sha2_512_h_msg_init(var, &st, r, ctx, ctx_sz);
+  sha2_512_h_msg_update(&st, m, m_sz);
+  sha2_512_h_msg_final(var, &st, h, r);
+}
+
 /* insert ARDSc. */
 
 static void sha2_256_adrsc(sha2_256_t *sha2, const slh_var_t *var)
@@ -473,6 +523,9 @@ OQS_API const slh_param_t slh_dsa_sha2_128s = {/* .alg_id = */ "SLH-DSA-SHA2-128
                                        /* .wots_chain = */ sha2_256_wots_chain,
                                        /* .fors_hash = */ sha2_256_fors_hash,
                                        /* .h_msg = */ sha2_256_h_msg,
+                                       /* .h_msg_init = */ sha2_256_h_msg_init,
+                                       /* .h_msg_update = */ sha2_256_h_msg_update,
+                                       /* .h_msg_final = */ sha2_256_h_msg_final,
                                        /* .prf = */ sha2_256_prf,
                                        /* .prf_msg = */ sha2_256_prf_msg,
                                        /* .h_f = */ sha2_256_f,
@@ -493,6 +546,9 @@ OQS_API const slh_param_t slh_dsa_sha2_128f = {/* .alg_id = */ "SLH-DSA-SHA2-128
                                        /* .wots_chain = */ sha2_256_wots_chain,
                                        /* .fors_hash = */ sha2_256_fors_hash,
                                        /* .h_msg = */ sha2_256_h_msg,
+                                       /* .h_msg_init = */ sha2_256_h_msg_init,
+                                       /* .h_msg_update = */ sha2_256_h_msg_update,
+                                       /* .h_msg_final = */ sha2_256_h_msg_final,
                                        /* .prf = */ sha2_256_prf,
                                        /* .prf_msg = */ sha2_256_prf_msg,
                                        /* .h_f = */ sha2_256_f,
@@ -515,6 +571,9 @@ OQS_API const slh_param_t slh_dsa_sha2_192s = {/* .alg_id = */ "SLH-DSA-SHA2-192
                                        /* .wots_chain = */ sha2_256_wots_chain,
                                        /* .fors_hash = */ sha2_256_fors_hash,
                                        /* .h_msg = */ sha2_512_h_msg,
+                                       /* .h_msg_init = */ sha2_512_h_msg_init,
+                                       /* .h_msg_update = */ sha2_512_h_msg_update,
+                                       /* .h_msg_final = */ sha2_512_h_msg_final,
                                        /* .prf = */ sha2_256_prf,
                                        /* .prf_msg = */ sha2_512_prf_msg,
                                        /* .h_f = */ sha2_256_f,
@@ -535,6 +594,9 @@ OQS_API const slh_param_t slh_dsa_sha2_192f = {/* .alg_id = */ "SLH-DSA-SHA2-192
                                        /* .wots_chain = */ sha2_256_wots_chain,
                                        /* .fors_hash = */ sha2_256_fors_hash,
                                        /* .h_msg = */ sha2_512_h_msg,
+                                       /* .h_msg_init = */ sha2_512_h_msg_init,
+                                       /* .h_msg_update = */ sha2_512_h_msg_update,
+                                       /* .h_msg_final = */ sha2_512_h_msg_final,
                                        /* .prf = */ sha2_256_prf,
                                        /* .prf_msg = */ sha2_512_prf_msg,
                                        /* .h_f = */ sha2_256_f,
@@ -555,6 +617,9 @@ OQS_API const slh_param_t slh_dsa_sha2_256s = {/* .alg_id = */ "SLH-DSA-SHA2-256
                                        /* .wots_chain = */ sha2_256_wots_chain,
                                        /* .fors_hash = */ sha2_256_fors_hash,
                                        /* .h_msg = */ sha2_512_h_msg,
+                                       /* .h_msg_init = */ sha2_512_h_msg_init,
+                                       /* .h_msg_update = */ sha2_512_h_msg_update,
+                                       /* .h_msg_final = */ sha2_512_h_msg_final,
                                        /* .prf = */ sha2_256_prf,
                                        /* .prf_msg = */ sha2_512_prf_msg,
                                        /* .h_f = */ sha2_256_f,
@@ -575,6 +640,9 @@ OQS_API const slh_param_t slh_dsa_sha2_256f = {/* .alg_id = */ "SLH-DSA-SHA2-256
                                        /* .wots_chain = */ sha2_256_wots_chain,
                                        /* .fors_hash = */ sha2_256_fors_hash,
                                        /* .h_msg = */ sha2_512_h_msg,
+                                       /* .h_msg_init = */ sha2_512_h_msg_init,
+                                       /* .h_msg_update = */ sha2_512_h_msg_update,
+                                       /* .h_msg_final = */ sha2_512_h_msg_final,
                                        /* .prf = */ sha2_256_prf,
                                        /* .prf_msg = */ sha2_512_prf_msg,
                                        /* .h_f = */ sha2_256_f,
@@ -7,6 +7,7 @@
 
 #include <oqs/oqs.h>
 #include "sha3_api.h"
+#include "slh_dsa.h"
 #include "slh_adrs.h"
 #include "slh_var.h"
 
@@ -15,45 +16,93 @@
 /* Hmsg(R, PK.seed, PK.root, M) = SHAKE256(R || PK.seed || PK.root || M, */
 /* 8m) */
 
-static void shake_h_msg(slh_var_t *var, uint8_t *h, const uint8_t *r,
-                        const uint8_t *m, size_t m_sz, const uint8_t *ctx,
-                        size_t ctx_sz)
+static void shake_h_msg_init(slh_var_t *var, slh_h_msg_t *st,
+                             const uint8_t *r, const uint8_t *ctx,
+                             size_t ctx_sz)
 {
-  sha3_var_t sha3;
   size_t n = var->prm->n;
   uint8_t buf[2];
 
-  shake256_init(&sha3);
-  shake_update(&sha3, r, n);
-  shake_update(&sha3, var->pk_seed, n);
-  shake_update(&sha3, var->pk_root, n);
+  shake256_init(&st->sha3);
+  shake_update(&st->sha3, r, n);
+  shake_update(&st->sha3, var->pk_seed, n);
+  shake_update(&st->sha3, var->pk_root, n);
 
   /* add "pure" domain separator and context, if supplied */
   if (ctx_sz != SLH_CTX_SZ_NO_CONTEXT)
   {
     buf[0] = 0;
     buf[1] = ctx_sz & 0xFF;
-    shake_update(&sha3, buf, 2);
-    shake_update(&sha3, ctx, ctx_sz);
+    shake_update(&st->sha3, buf, 2);
+    shake_update(&st->sha3, ctx, ctx_sz);
   }
-  shake_update(&sha3, m, m_sz);
+}
 
-  shake_out(&sha3, h, var->prm->m);
+static void shake_h_msg_update(slh_h_msg_t *st, const uint8_t *m,
+                               size_t m_sz)
+{
+  shake_update(&st->sha3, m, m_sz);
 }
 
-/* F(PK.seed, ADRS, M1 ) = SHAKE256(PK.seed || ADRS || M1, 8n) */
+static void shake_h_msg_final(slh_var_t *var, slh_h_msg_t *st, uint8_t *h,
+                              const uint8_t *r)
+{
+  (void)r;
+  shake_out(&st->sha3, h, var->prm->m);
+}
 
-static void shake_f(slh_var_t *var, uint8_t *h, const uint8_t *m1)
+static void shake_h_msg(slh_var_t *var, uint8_t *h, const uint8_t *r,
+                        const uint8_t *m, size_t m_sz, const uint8_t *ctx,
+                        size_t ctx_sz)
 {
-  sha3_var_t sha3;
+  slh_h_msg_t st;
+
+  shake_h_msg_init(var, &st, r, ctx, ctx_sz);
+  shake_h_msg_update(&st, m, m_sz);
+  shake_h_msg_final(var, &st, h, r);
+}
+
+/* single-block SHAKE256(PK.seed || ADRS || M1 [|| M2], 8n) */
+/* the input is at most 3n + 32 <= 128 bytes, less than the 136-byte rate, */
+/* so the padded state is built directly as words, as in shake_chain() */
+
+static void shake_block(slh_var_t *var, uint8_t *h, const uint8_t *m1,
+                        const uint8_t *m2)
+{
+  uint32_t k;
+  uint64_t ks[25];
   size_t n = var->prm->n;
+  const uint32_t r = (1600 - 256 * 2) / 64; /* SHAKE256 rate */
+  uint32_t n8 = n / 8;                      /* number of words */
+  uint32_t l = n8 + (32 / 8);               /* input length */
 
-  shake256_init(&sha3);
-  shake_update(&sha3, var->pk_seed, n);
-  shake_update(&sha3, (const uint8_t *)var->adrs->u8, 32);
-  shake_update(&sha3, m1, n);
+  memcpy(ks, var->pk_seed, n); /* PK.seed */
+  memcpy(ks + n8, (const uint8_t *)var->adrs->u8, 32);
+  memcpy(ks + l, m1, n);
+  l += n8;
+  if (m2 != NULL)
+  {
+    memcpy(ks + l, m2, n);
+    l += n8;
+  }
 
-  shake_out(&sha3, h, n);
+  /* padding */
+  ks[l] = 0x1F; /* shake padding */
+  for (k = l + 1; k < 25; k++)
+  {
+    ks[k] = 0;
+  }
+  ks[r - 1] ^= UINT64_C(1) << 63; /* rate padding */
+
+  keccak_f1600(ks); /* permutation */
+  memcpy(h, ks, n);
+}
+
+/* F(PK.seed, ADRS, M1 ) = SHAKE256(PK.seed || ADRS || M1, 8n) */
+
+static void shake_f(slh_var_t *var, uint8_t *h, const uint8_t *m1)
+{
+  shake_block(var, h, m1, NULL);
 }
 
 /* PRF(PK.seed, SK.seed, ADRS) = SHAKE256(PK.seed || ADRS || SK.seed, 8n) */
@@ -111,16 +160,7 @@ static void shake_t(slh_var_t *var, uint8_t *h, const uint8_t *m, size_t m_sz)
 static void shake_h(slh_var_t *var, uint8_t *h, const uint8_t *m1,
                     const uint8_t *m2)
 {
-  sha3_var_t sha3;
-  size_t n = var->prm->n;
-
-  shake256_init(&sha3);
-  shake_update(&sha3, var->pk_seed, n);
-  shake_update(&sha3, (const uint8_t *)var->adrs->u8, 32);
-  shake_update(&sha3, m1, n);
-  shake_update(&sha3, m2, n);
-
-  shake_out(&sha3, h, n);
+  shake_block(var, h, m1, m2);
 }
 
 /* create a context */
@@ -245,6 +285,9 @@ OQS_API const slh_param_t slh_dsa_shake_128s = {/* .alg_id = */ "SLH-DSA-SHAKE-1
                                         /* .wots_chain = */ shake_wots_chain,
                                         /* .fors_hash = */ shake_fors_hash,
                                         /* .h_msg = */ shake_h_msg,
+                                        /* .h_msg_init = */ shake_h_msg_init,
+                                        /* .h_msg_update = */ shake_h_msg_update,
+                                        /* .h_msg_final = */ shake_h_msg_final,
                                         /* .prf = */ shake_prf,
                                         /* .prf_msg = */ shake_prf_msg,
                                         /* .h_f = */ shake_f,
@@ -265,6 +308,9 @@ OQS_API const slh_param_t slh_dsa_shake_128f = {/* .alg_id = */ "SLH-DSA-SHAKE-1
                                         /* .wots_chain = */ shake_wots_chain,
                                         /* .fors_hash = */ shake_fors_hash,
                                         /* .h_msg = */ shake_h_msg,
+                                        /* .h_msg_init = */ shake_h_msg_init,
+                                        /* .h_msg_update = */ shake_h_msg_update,
+                                        /* .h_msg_final = */ shake_h_msg_final,
                                         /* .prf = */ shake_prf,
                                         /* .prf_msg = */ shake_prf_msg,
                                         /* .h_f = */ shake_f,
@@ -285,6 +331,9 @@ OQS_API const slh_param_t slh_dsa_shake_192s = {/* .alg_id = */ "SLH-DSA-SHAKE-1
                                         /* .wots_chain = */ shake_wots_chain,
                                         /* .fors_hash = */ shake_fors_hash,
                                         /* .h_msg = */ shake_h_msg,
+                                        /* .h_msg_init = */ shake_h_msg_init,
+                                        /* .h_msg_update = */ shake_h_msg_update,
+                                        /* .h_msg_final = */ shake_h_msg_final,
                                         /* .prf = */ shake_prf,
                                         /* .prf_msg = */ shake_prf_msg,
                                         /* .h_f = */ shake_f,
@@ -305,6 +354,9 @@ OQS_API const slh_param_t slh_dsa_shake_192f = {/* .alg_id = */ "SLH-DSA-SHAKE-1
                                         /* .wots_chain = */ shake_wots_chain,
                                         /* .fors_hash = */ shake_fors_hash,
                                         /* .h_msg = */ shake_h_msg,
+                                        /* .h_msg_init = */ shake_h_msg_init,
+                                        /* .h_msg_update = */ shake_h_msg_update,
+                                        /* .h_msg_final = */ shake_h_msg_final,
                                         /* .prf = */ shake_prf,
                                         /* .prf_msg = */ shake_prf_msg,
                                         /* .h_f = */ shake_f,
@@ -325,6 +377,9 @@ OQS_API const slh_param_t slh_dsa_shake_256s = {/* .alg_id = */ "SLH-DSA-SHAKE-2
                                         /* .wots_chain = */ shake_wots_chain,
                                         /* .fors_hash = */ shake_fors_hash,
                                         /* .h_msg = */ shake_h_msg,
+                                        /* .h_msg_init = */ shake_h_msg_init,
+                                        /* .h_msg_update = */ shake_h_msg_update,
+                                        /* .h_msg_final = */ shake_h_msg_final,
                                         /* .prf = */ shake_prf,
                                         /* .prf_msg = */ shake_prf_msg,
                                         /* .h_f = */ shake_f,
@@ -345,6 +400,9 @@ OQS_API const slh_param_t slh_dsa_shake_256f = {/* .alg_id = */ "SLH-DSA-SHAKE-2
                                         /* .wots_chain = */ shake_wots_chain,
                                         /* .fors_hash = */ shake_fors_hash,
                                         /* .h_msg = */ shake_h_msg,
+                                        /* .h_msg_init = */ shake_h_msg_init,
+                                        /* .h_msg_update = */ shake_h_msg_update,
+                                        /* .h_msg_final = */ shake_h_msg_final,
                                         /* .prf = */ shake_prf,
                                         /* .prf_msg = */ shake_prf_msg,
                                         /* .h_f = */ shake_f,
@@ -5,6 +5,7 @@
 #include "../../sig_slh_dsa.h"
 #include "../../slh_dsa_c/slh_dsa.h"
 #include "../../slh_dsa_c/slh_prehash.h"
+#include "../../../sig_verify.h"
 #include <oqs/oqs.h>
 
 
@@ -116,5 +117,57 @@ OQS_API OQS_STATUS OQS_SIG_slh_dsa_pure_sha2_128s_verify_with_ctx_str(const uint
 	return OQS_SUCCESS;
 }
 
+static OQS_STATUS slh_dsa_pure_sha2_128s_verify_init(void *state, const uint8_t *signature,
+        size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key) {
+
+	const slh_param_t *prm = &slh_dsa_sha2_128s;
+
+	int res = slh_verify_init(state, signature, signature_len, ctx_str, ctx_str_len,
+	                          public_key, prm);
+
+	if (res == 0) {
+		return OQS_ERROR;
+	}
+	return OQS_SUCCESS;
+}
+
+static void slh_dsa_pure_sha2_128s_verify_update(void *state, const uint8_t *message, size_t message_len) {
+
+	const slh_param_t *prm = &slh_dsa_sha2_128s;
+
+	slh_verify_update(state, message, message_len, prm);
+}
+
+static OQS_STATUS slh_dsa_pure_sha2_128s_verify_final(void *state, const uint8_t *signature,
+        size_t signature_len, const uint8_t *public_key) {
+
+	const slh_param_t *prm = &slh_dsa_sha2_128s;
+
+	int res = slh_verify_final(state, signature, signature_len, public_key, prm);
+
+	if (res == 0) {
+		return OQS_ERROR;
+	}
+	return OQS_SUCCESS;
+}
+
+static void slh_dsa_pure_sha2_128s_verify_abort(void *state) {
+
+	/* the hash state holds no resources */
+	(void) state;
+}
+
+static const OQS_SIG_VERIFY_ops slh_dsa_pure_sha2_128s_verify_ops = {
+	.state_len = sizeof(slh_h_msg_t),
+	.init = slh_dsa_pure_sha2_128s_verify_init,
+	.update = slh_dsa_pure_sha2_128s_verify_update,
+	.final = slh_dsa_pure_sha2_128s_verify_final,
+	.abort = slh_dsa_pure_sha2_128s_verify_abort,
+};
+
+const OQS_SIG_VERIFY_ops *OQS_SIG_slh_dsa_pure_sha2_128s_verify_ops(void) {
+	return &slh_dsa_pure_sha2_128s_verify_ops;
+}
+
 #endif
 
@@ -3,6 +3,9 @@
 #include <stdlib.h>
 
 #include <oqs/sig_snova.h>
+#include <oqs/sha3.h>
+
+#include "../sig_verify.h"
 
 #if defined(OQS_ENABLE_SIG_snova_SNOVA_24_5_4_SHAKE_esk)
 OQS_SIG *OQS_SIG_snova_SNOVA_24_5_4_SHAKE_esk_new(void) {
@@ -35,17 +38,26 @@ OQS_SIG *OQS_SIG_snova_SNOVA_24_5_4_SHAKE_esk_new(void) {
 extern int _snova_24_5_4_shake_esk_opt_keypair(uint8_t *pk, uint8_t *sk);
 extern int _snova_24_5_4_shake_esk_opt_sign(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const uint8_t *sk);
 extern int _snova_24_5_4_shake_esk_opt_verify(const uint8_t *sig, size_t siglen, const uint8_t *m, size_t mlen, const uint8_t *pk);
+extern int _snova_24_5_4_shake_esk_opt_verify_init(OQS_SHA3_shake256_inc_ctx *state, const uint8_t *sig, size_t siglen);
+extern void _snova_24_5_4_shake_esk_opt_verify_update(OQS_SHA3_shake256_inc_ctx *state, const uint8_t *m, size_t mlen);
+extern int _snova_24_5_4_shake_esk_opt_verify_final(OQS_SHA3_shake256_inc_ctx *state, const uint8_t *sig, size_t siglen, const uint8_t *pk);
 
 #if defined(OQS_ENABLE_SIG_snova_SNOVA_24_5_4_SHAKE_esk_avx2)
 extern int _snova_24_5_4_shake_esk_avx2_keypair(uint8_t *pk, uint8_t *sk);
 extern int _snova_24_5_4_shake_esk_avx2_sign(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const uint8_t *sk);
 extern int _snova_24_5_4_shake_esk_avx2_verify(const uint8_t *sig, size_t siglen, const uint8_t *m, size_t mlen, const uint8_t *pk);
+extern int _snova_24_5_4_shake_esk_avx2_verify_init(OQS_SHA3_shake256_inc_ctx *state, const uint8_t *sig, size_t siglen);
+extern void _snova_24_5_4_shake_esk_avx2_verify_update(OQS_SHA3_shake256_inc_ctx *state, const uint8_t *m, size_t mlen);
+extern int _snova_24_5_4_shake_esk_avx2_verify_final(OQS_SHA3_shake256_inc_ctx *state, const uint8_t *sig, size_t siglen, const uint8_t *pk);
 #endif
 
 #if defined(OQS_ENABLE_SIG_snova_SNOVA_24_5_4_SHAKE_esk_neon)
 extern int _snova_24_5_4_shake_esk_neon_keypair(uint8_t *pk, uint8_t *sk);
 extern int _snova_24_5_4_shake_esk_neon_sign(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const uint8_t *sk);
 extern int _snova_24_5_4_shake_esk_neon_verify(const uint8_t *sig, size_t siglen, const uint8_t *m, size_t mlen, const uint8_t *pk);
+extern int _snova_24_5_4_shake_esk_neon_verify_init(OQS_SHA3_shake256_inc_ctx *state, const uint8_t *sig, size_t siglen);
+extern void _snova_24_5_4_shake_esk_neon_verify_update(OQS_SHA3_shake256_inc_ctx *state, const uint8_t *m, size_t mlen);
+extern int _snova_24_5_4_shake_esk_neon_verify_final(OQS_SHA3_shake256_inc_ctx *state, const uint8_t *sig, size_t siglen, const uint8_t *pk);
 #endif
 
 OQS_API OQS_STATUS OQS_SIG_snova_SNOVA_24_5_4_SHAKE_esk_keypair(uint8_t *public_key, uint8_t *secret_key) {
@@ -141,4 +153,102 @@ OQS_API OQS_STATUS OQS_SIG_snova_SNOVA_24_5_4_SHAKE_esk_verify_with_ctx_str(cons
 		return OQS_ERROR;
 	}
 }
+
+static OQS_STATUS snova_SNOVA_24_5_4_SHAKE_esk_verify_init(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key) {
+	(void) public_key;
+	if (ctx_str != NULL || ctx_str_len != 0) {
+		return OQS_ERROR;
+	}
+#if defined(OQS_ENABLE_SIG_snova_SNOVA_24_5_4_SHAKE_esk_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) _snova_24_5_4_shake_esk_avx2_verify_init(state, signature, signature_len);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) _snova_24_5_4_shake_esk_opt_verify_init(state, signature, signature_len);
+	}
+#endif /* OQS_DIST_BUILD */
+#elif defined(OQS_ENABLE_SIG_snova_SNOVA_24_5_4_SHAKE_esk_neon)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_ARM_NEON)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) _snova_24_5_4_shake_esk_neon_verify_init(state, signature, signature_len);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) _snova_24_5_4_shake_esk_opt_verify_init(state, signature, signature_len);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return (OQS_STATUS) _snova_24_5_4_shake_esk_opt_verify_init(state, signature, signature_len);
+#endif
+}
+
+static void snova_SNOVA_24_5_4_SHAKE_esk_verify_update(void *state, const uint8_t *message, size_t message_len) {
+#if defined(OQS_ENABLE_SIG_snova_SNOVA_24_5_4_SHAKE_esk_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2)) {
+#endif /* OQS_DIST_BUILD */
+		_snova_24_5_4_shake_esk_avx2_verify_update(state, message, message_len);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		_snova_24_5_4_shake_esk_opt_verify_update(state, message, message_len);
+	}
+#endif /* OQS_DIST_BUILD */
+#elif defined(OQS_ENABLE_SIG_snova_SNOVA_24_5_4_SHAKE_esk_neon)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_ARM_NEON)) {
+#endif /* OQS_DIST_BUILD */
+		_snova_24_5_4_shake_esk_neon_verify_update(state, message, message_len);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		_snova_24_5_4_shake_esk_opt_verify_update(state, message, message_len);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	_snova_24_5_4_shake_esk_opt_verify_update(state, message, message_len);
+#endif
+}
+
+static OQS_STATUS snova_SNOVA_24_5_4_SHAKE_esk_verify_final(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key) {
+#if defined(OQS_ENABLE_SIG_snova_SNOVA_24_5_4_SHAKE_esk_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) _snova_24_5_4_shake_esk_avx2_verify_final(state, signature, signature_len, public_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) _snova_24_5_4_shake_esk_opt_verify_final(state, signature, signature_len, public_key);
+	}
+#endif /* OQS_DIST_BUILD */
+#elif defined(OQS_ENABLE_SIG_snova_SNOVA_24_5_4_SHAKE_esk_neon)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_ARM_NEON)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) _snova_24_5_4_shake_esk_neon_verify_final(state, signature, signature_len, public_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) _snova_24_5_4_shake_esk_opt_verify_final(state, signature, signature_len, public_key);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return (OQS_STATUS) _snova_24_5_4_shake_esk_opt_verify_final(state, signature, signature_len, public_key);
+#endif
+}
+
+static void snova_SNOVA_24_5_4_SHAKE_esk_verify_abort(void *state) {
+	OQS_SHA3_shake256_inc_ctx_release(state);
+}
+
+static const OQS_SIG_VERIFY_ops snova_SNOVA_24_5_4_SHAKE_esk_verify_ops = {
+	.state_len = sizeof(OQS_SHA3_shake256_inc_ctx),
+	.init = snova_SNOVA_24_5_4_SHAKE_esk_verify_init,
+	.update = snova_SNOVA_24_5_4_SHAKE_esk_verify_update,
+	.final = snova_SNOVA_24_5_4_SHAKE_esk_verify_final,
+	.abort = snova_SNOVA_24_5_4_SHAKE_esk_verify_abort,
+};
+
+const OQS_SIG_VERIFY_ops *OQS_SIG_snova_SNOVA_24_5_4_SHAKE_esk_verify_ops(void) {
+	return &snova_SNOVA_24_5_4_SHAKE_esk_verify_ops;
+}
 #endif
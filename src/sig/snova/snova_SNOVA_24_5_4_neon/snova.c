@@ -1,5 +1,9 @@
 #include "snova.h"
 
+#if defined(OQS_USE_PTHREADS)
+#include <pthread.h>
+#endif
+
 #include "gf16_matrix_inline.h"
 
 #define i_prime(mi, alpha) ((alpha + mi) % o_SNOVA)
@@ -56,23 +60,39 @@ static void gen_ABQ(const char *abq_seed) {
 #endif
 
 /**
- * SNOVA init
+ * Build the process-wide tables used by all SNOVA operations.
  */
-static void snova_init(void) {
-	static int first_time = 1;
-	if (first_time) {
-		first_time = 0;
-		init_gf16_tables();
-		gen_S_array();
+static void snova_init_tables(void) {
+	init_gf16_tables();
+	gen_S_array();
 
 #if FIXED_ABQ
-		gen_ABQ("SNOVA_ABQ");
+	gen_ABQ("SNOVA_ABQ");
 #endif
 
 #if OPTIMISATION != 0
-		snova_plasma_init();
+	snova_plasma_init();
+#endif
+}
+
+#if defined(OQS_USE_PTHREADS)
+static pthread_once_t snova_init_once = PTHREAD_ONCE_INIT;
 #endif
+
+/**
+ * SNOVA init. The tables are built on first use; with pthreads, concurrent
+ * first calls wait for a single initialization instead of racing.
+ */
+static void snova_init(void) {
+#if defined(OQS_USE_PTHREADS)
+	pthread_once(&snova_init_once, snova_init_tables);
+#else
+	static int first_time = 1;
+	if (first_time) {
+		first_time = 0;
+		snova_init_tables();
 	}
+#endif
 }
 
 /**
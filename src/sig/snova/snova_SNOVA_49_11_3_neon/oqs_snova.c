@@ -70,3 +70,33 @@ OQS_STATUS SNOVA_NAMESPACE(verify)(const uint8_t *signature, size_t signature_le
 		return OQS_SUCCESS;
 	}
 }
+
+OQS_STATUS SNOVA_NAMESPACE(verify_init)(OQS_SHA3_shake256_inc_ctx *state, const uint8_t *signature, size_t signature_len) {
+	(void) signature;
+	if (signature_len != bytes_sig_with_salt) {
+		return OQS_ERROR;
+	}
+	OQS_SHA3_shake256_inc_init(state);
+	return OQS_SUCCESS;
+}
+
+void SNOVA_NAMESPACE(verify_update)(OQS_SHA3_shake256_inc_ctx *state, const uint8_t *message, size_t message_len) {
+	OQS_SHA3_shake256_inc_absorb(state, message, message_len);
+}
+
+// Completes SNOVA_NAMESPACE(verify) for a message absorbed into state, and releases state.
+OQS_STATUS SNOVA_NAMESPACE(verify_final)(OQS_SHA3_shake256_inc_ctx *state, const uint8_t *signature, size_t signature_len,
+        const uint8_t *pk) {
+	(void) signature_len;
+
+	uint8_t digest[SNOVA_BYTES_DIGEST];
+	OQS_SHA3_shake256_inc_finalize(state);
+	OQS_SHA3_shake256_inc_squeeze(digest, SNOVA_BYTES_DIGEST, state);
+	OQS_SHA3_shake256_inc_ctx_release(state);
+
+	if (verify_signture(digest, SNOVA_BYTES_DIGEST, signature, pk)) {
+		return OQS_ERROR;
+	} else {
+		return OQS_SUCCESS;
+	}
+}
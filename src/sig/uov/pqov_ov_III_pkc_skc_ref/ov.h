@@ -8,6 +8,7 @@
 
 #include "params.h"
 #include "ov_keypair.h"
+#include "utils_hash.h"
 
 #include <stdint.h>
 #include <stdio.h>  // for size_t
@@ -159,6 +160,17 @@ int ov_sign( uint8_t *signature, const sk_t *sk, const uint8_t *message, size_t
 #define ov_verify PQOV_NAMESPACE(ov_verify)
 int ov_verify( const uint8_t *message, size_t mlen, const uint8_t *signature, const pk_t *pk );
 
+///
+/// @brief Verifying function for a message absorbed into a hash context.
+///
+/// @param[in]  hctx      - the hash context after hash_init() and hash_update() on the message; freed on return.
+/// @param[in]  signature - the signature.
+/// @param[in]  pk        - the public key.
+/// @return 0 for successful verified. -1 for failed verification.
+///
+#define ov_verify_hashed PQOV_NAMESPACE(ov_verify_hashed)
+int ov_verify_hashed( hash_ctx *hctx, const uint8_t *signature, const pk_t *pk );
+
 
 
 
@@ -187,6 +199,17 @@ int ov_expand_and_sign( uint8_t *signature, const csk_t *sk, const uint8_t *mess
 #define ov_expand_and_verify PQOV_NAMESPACE(ov_expand_and_verify)
 int ov_expand_and_verify( const uint8_t *message, size_t mlen, const uint8_t *signature, const cpk_t *pk );
 
+///
+/// @brief Verifying function for compressed public keys and a message absorbed into a hash context.
+///
+/// @param[in]  hctx      - the hash context after hash_init() and hash_update() on the message; freed on return.
+/// @param[in]  signature - the signature.
+/// @param[in]  pk        - the public key of cyclic OV.
+/// @return 0 for successful verified. -1 for failed verification.
+///
+#define ov_expand_and_verify_hashed PQOV_NAMESPACE(ov_expand_and_verify_hashed)
+int ov_expand_and_verify_hashed( hash_ctx *hctx, const uint8_t *signature, const cpk_t *pk );
+
 
 
 
@@ -125,14 +125,12 @@ int ov_sign( uint8_t *signature, const sk_t *sk, const uint8_t *message, size_t
 }
 
 
+// hctx has absorbed the message; it is freed here.
 static
-int _ov_verify( const uint8_t *message, size_t mlen, const uint8_t *salt, const unsigned char *digest_ck ) {
+int _ov_verify( hash_ctx *hctx, const uint8_t *salt, const unsigned char *digest_ck ) {
     unsigned char correct[_PUB_M_BYTE];
-    hash_ctx hctx;
-    hash_init(&hctx);
-    hash_update(&hctx, message, mlen);
-    hash_update(&hctx, salt, _SALT_BYTE);
-    hash_final_digest(correct, _PUB_M_BYTE, &hctx);  // H( message || salt )
+    hash_update(hctx, salt, _SALT_BYTE);
+    hash_final_digest(correct, _PUB_M_BYTE, hctx);  // H( message || salt )
 
     // check consistency.
     unsigned char cc = 0;
@@ -146,14 +144,21 @@ int _ov_verify( const uint8_t *message, size_t mlen, const uint8_t *salt, const
 
 
 #if !(defined(_OV_PKC) || defined(_OV_PKC_SKC)) || !defined(_SAVE_MEMORY_)
-int ov_verify( const uint8_t *message, size_t mlen, const uint8_t *signature, const pk_t *pk ) {
+int ov_verify_hashed( hash_ctx *hctx, const uint8_t *signature, const pk_t *pk ) {
     #if defined(_VALGRIND_)
     VALGRIND_MAKE_MEM_DEFINED(signature, OV_SIGNATUREBYTES );  // mark signature as public data
     #endif
     unsigned char digest_ck[_PUB_M_BYTE];
     ov_publicmap( digest_ck, pk->pk, signature );
 
-    return _ov_verify( message, mlen, signature + _PUB_N_BYTE, digest_ck );
+    return _ov_verify( hctx, signature + _PUB_N_BYTE, digest_ck );
+}
+
+int ov_verify( const uint8_t *message, size_t mlen, const uint8_t *signature, const pk_t *pk ) {
+    hash_ctx hctx;
+    hash_init(&hctx);
+    hash_update(&hctx, message, mlen);
+    return ov_verify_hashed( &hctx, signature, pk );
 }
 #endif
 
@@ -187,18 +192,20 @@ int ov_expand_and_sign( uint8_t *signature, const csk_t *csk, const uint8_t *mes
 }
 #endif
 
-int ov_expand_and_verify( const uint8_t *message, size_t mlen, const uint8_t *signature, const cpk_t *cpk ) {
+int ov_expand_and_verify_hashed( hash_ctx *hctx, const uint8_t *signature, const cpk_t *cpk ) {
 
     #ifdef _SAVE_MEMORY_
     unsigned char digest_ck[_PUB_M_BYTE];
     ov_publicmap_pkc( digest_ck, cpk, signature );
-    return _ov_verify( message, mlen, signature + _PUB_N_BYTE, digest_ck );
+    return _ov_verify( hctx, signature + _PUB_N_BYTE, digest_ck );
     #else
     int rc;
 
     #ifdef _MALLOC_
     pk_t *pk = ov_malloc(sizeof(pk_t));
     if (NULL == pk) {
+        unsigned char digest[_PUB_M_BYTE];
+        hash_final_digest(digest, _PUB_M_BYTE, hctx);  // free hctx
         return -1;
     }
     #else
@@ -215,7 +222,7 @@ int ov_expand_and_verify( const uint8_t *message, size_t mlen, const uint8_t *si
     #else
     expand_pk( pk, cpk );
     #endif
-    rc = ov_verify( message, mlen, signature, pk );
+    rc = ov_verify_hashed( hctx, signature, pk );
 
 
     #ifdef _MALLOC_
@@ -224,6 +231,13 @@ int ov_expand_and_verify( const uint8_t *message, size_t mlen, const uint8_t *si
     return rc;
     #endif
 }
+
+int ov_expand_and_verify( const uint8_t *message, size_t mlen, const uint8_t *signature, const cpk_t *cpk ) {
+    hash_ctx hctx;
+    hash_init(&hctx);
+    hash_update(&hctx, message, mlen);
+    return ov_expand_and_verify_hashed( &hctx, signature, cpk );
+}
 #endif
 
 
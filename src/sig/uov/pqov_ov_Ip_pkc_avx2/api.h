@@ -15,6 +15,7 @@
 #if defined(PQM4) || defined(_UTILS_OQS_)
 // for size_t
 #include <stddef.h>
+#include "utils_hash.h"
 
 #ifdef  __cplusplus
 extern  "C" {
@@ -48,6 +49,24 @@ crypto_sign_verify(const unsigned char  *sig, size_t siglen,
                       const unsigned char  *m, size_t mlen,
                       const unsigned char  *pk);
 
+// Streaming form of crypto_sign_verify(). _init() checks the signature
+// length and initializes hctx; _final() verifies and frees hctx.
+#define crypto_sign_verify_init PQOV_NAMESPACE(verify_init)
+int
+crypto_sign_verify_init(hash_ctx *hctx,
+                        const unsigned char *sig, size_t siglen);
+
+#define crypto_sign_verify_update PQOV_NAMESPACE(verify_update)
+void
+crypto_sign_verify_update(hash_ctx *hctx,
+                          const unsigned char *m, size_t mlen);
+
+#define crypto_sign_verify_final PQOV_NAMESPACE(verify_final)
+int
+crypto_sign_verify_final(hash_ctx *hctx,
+                         const unsigned char *sig, size_t siglen,
+                         const unsigned char *pk);
+
 #ifdef  __cplusplus
 }
 #endif
@@ -127,6 +127,48 @@ crypto_sign_verify(const unsigned char *sig, unsigned long long siglen, const un
     return r;
 }
 
+int
+crypto_sign_verify_init(hash_ctx *hctx, const unsigned char *sig, size_t siglen)
+{
+    (void) sig;
+    if ( OV_SIGNATUREBYTES != siglen ) {
+        return -1;
+    }
+    hash_init( hctx );
+    return 0;
+}
+
+void
+crypto_sign_verify_update(hash_ctx *hctx, const unsigned char *m, size_t mlen)
+{
+    hash_update( hctx, m, mlen );
+}
+
+int
+crypto_sign_verify_final(hash_ctx *hctx, const unsigned char *sig, size_t siglen, const unsigned char *pk)
+{
+    int r;
+    (void) siglen;
+
+    #if defined _OV_CLASSIC
+
+    r = ov_verify_hashed( hctx, sig, (const pk_t *)pk );
+
+    #elif defined _OV_PKC
+
+    r = ov_expand_and_verify_hashed( hctx, sig, (const cpk_t *)pk );
+
+    #elif defined _OV_PKC_SKC
+
+    r = ov_expand_and_verify_hashed( hctx, sig, (const cpk_t *)pk );
+
+    #else
+    error here
+    #endif
+
+    return r;
+}
+
 int
 #if defined(PQM4) || defined(_UTILS_OQS_)
 crypto_sign_open(unsigned char *m, size_t *mlen, const unsigned char *sm, size_t smlen, const unsigned char *pk)
@@ -3,6 +3,9 @@
 #include <stdlib.h>
 
 #include <oqs/sig_uov.h>
+#include <oqs/sha3.h>
+
+#include "../sig_verify.h"
 
 #if defined(OQS_ENABLE_SIG_uov_ov_III_pkc_skc)
 OQS_SIG *OQS_SIG_uov_ov_III_pkc_skc_new(void) {
@@ -35,17 +38,26 @@ OQS_SIG *OQS_SIG_uov_ov_III_pkc_skc_new(void) {
 extern int pqov_uov_III_pkc_skc_ref_keypair(uint8_t *pk, uint8_t *sk);
 extern int pqov_uov_III_pkc_skc_ref_signature(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const uint8_t *sk);
 extern int pqov_uov_III_pkc_skc_ref_verify(const uint8_t *sig, size_t siglen, const uint8_t *m, size_t mlen, const uint8_t *pk);
+extern int pqov_uov_III_pkc_skc_ref_verify_init(OQS_SHA3_shake256_inc_ctx *state, const uint8_t *sig, size_t siglen);
+extern void pqov_uov_III_pkc_skc_ref_verify_update(OQS_SHA3_shake256_inc_ctx *state, const uint8_t *m, size_t mlen);
+extern int pqov_uov_III_pkc_skc_ref_verify_final(OQS_SHA3_shake256_inc_ctx *state, const uint8_t *sig, size_t siglen, const uint8_t *pk);
 
 #if defined(OQS_ENABLE_SIG_uov_ov_III_pkc_skc_neon)
 extern int pqov_uov_III_pkc_skc_neon_keypair(uint8_t *pk, uint8_t *sk);
 extern int pqov_uov_III_pkc_skc_neon_signature(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const uint8_t *sk);
 extern int pqov_uov_III_pkc_skc_neon_verify(const uint8_t *sig, size_t siglen, const uint8_t *m, size_t mlen, const uint8_t *pk);
+extern int pqov_uov_III_pkc_skc_neon_verify_init(OQS_SHA3_shake256_inc_ctx *state, const uint8_t *sig, size_t siglen);
+extern void pqov_uov_III_pkc_skc_neon_verify_update(OQS_SHA3_shake256_inc_ctx *state, const uint8_t *m, size_t mlen);
+extern int pqov_uov_III_pkc_skc_neon_verify_final(OQS_SHA3_shake256_inc_ctx *state, const uint8_t *sig, size_t siglen, const uint8_t *pk);
 #endif
 
 #if defined(OQS_ENABLE_SIG_uov_ov_III_pkc_skc_avx2)
 extern int pqov_uov_III_pkc_skc_avx2_keypair(uint8_t *pk, uint8_t *sk);
 extern int pqov_uov_III_pkc_skc_avx2_signature(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const uint8_t *sk);
 extern int pqov_uov_III_pkc_skc_avx2_verify(const uint8_t *sig, size_t siglen, const uint8_t *m, size_t mlen, const uint8_t *pk);
+extern int pqov_uov_III_pkc_skc_avx2_verify_init(OQS_SHA3_shake256_inc_ctx *state, const uint8_t *sig, size_t siglen);
+extern void pqov_uov_III_pkc_skc_avx2_verify_update(OQS_SHA3_shake256_inc_ctx *state, const uint8_t *m, size_t mlen);
+extern int pqov_uov_III_pkc_skc_avx2_verify_final(OQS_SHA3_shake256_inc_ctx *state, const uint8_t *sig, size_t siglen, const uint8_t *pk);
 #endif
 
 OQS_API OQS_STATUS OQS_SIG_uov_ov_III_pkc_skc_keypair(uint8_t *public_key, uint8_t *secret_key) {
@@ -141,4 +153,102 @@ OQS_API OQS_STATUS OQS_SIG_uov_ov_III_pkc_skc_verify_with_ctx_str(const uint8_t
 		return OQS_ERROR;
 	}
 }
+
+static OQS_STATUS uov_ov_III_pkc_skc_verify_init(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key) {
+	(void) public_key;
+	if (ctx_str != NULL || ctx_str_len != 0) {
+		return OQS_ERROR;
+	}
+#if defined(OQS_ENABLE_SIG_uov_ov_III_pkc_skc_neon)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_ARM_NEON)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) pqov_uov_III_pkc_skc_neon_verify_init(state, signature, signature_len);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) pqov_uov_III_pkc_skc_ref_verify_init(state, signature, signature_len);
+	}
+#endif /* OQS_DIST_BUILD */
+#elif defined(OQS_ENABLE_SIG_uov_ov_III_pkc_skc_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) pqov_uov_III_pkc_skc_avx2_verify_init(state, signature, signature_len);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) pqov_uov_III_pkc_skc_ref_verify_init(state, signature, signature_len);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return (OQS_STATUS) pqov_uov_III_pkc_skc_ref_verify_init(state, signature, signature_len);
+#endif
+}
+
+static void uov_ov_III_pkc_skc_verify_update(void *state, const uint8_t *message, size_t message_len) {
+#if defined(OQS_ENABLE_SIG_uov_ov_III_pkc_skc_neon)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_ARM_NEON)) {
+#endif /* OQS_DIST_BUILD */
+		pqov_uov_III_pkc_skc_neon_verify_update(state, message, message_len);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		pqov_uov_III_pkc_skc_ref_verify_update(state, message, message_len);
+	}
+#endif /* OQS_DIST_BUILD */
+#elif defined(OQS_ENABLE_SIG_uov_ov_III_pkc_skc_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2)) {
+#endif /* OQS_DIST_BUILD */
+		pqov_uov_III_pkc_skc_avx2_verify_update(state, message, message_len);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		pqov_uov_III_pkc_skc_ref_verify_update(state, message, message_len);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	pqov_uov_III_pkc_skc_ref_verify_update(state, message, message_len);
+#endif
+}
+
+static OQS_STATUS uov_ov_III_pkc_skc_verify_final(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key) {
+#if defined(OQS_ENABLE_SIG_uov_ov_III_pkc_skc_neon)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_ARM_NEON)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) pqov_uov_III_pkc_skc_neon_verify_final(state, signature, signature_len, public_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) pqov_uov_III_pkc_skc_ref_verify_final(state, signature, signature_len, public_key);
+	}
+#endif /* OQS_DIST_BUILD */
+#elif defined(OQS_ENABLE_SIG_uov_ov_III_pkc_skc_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) pqov_uov_III_pkc_skc_avx2_verify_final(state, signature, signature_len, public_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) pqov_uov_III_pkc_skc_ref_verify_final(state, signature, signature_len, public_key);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return (OQS_STATUS) pqov_uov_III_pkc_skc_ref_verify_final(state, signature, signature_len, public_key);
+#endif
+}
+
+static void uov_ov_III_pkc_skc_verify_abort(void *state) {
+	OQS_SHA3_shake256_inc_ctx_release(state);
+}
+
+static const OQS_SIG_VERIFY_ops uov_ov_III_pkc_skc_verify_ops = {
+	.state_len = sizeof(OQS_SHA3_shake256_inc_ctx),
+	.init = uov_ov_III_pkc_skc_verify_init,
+	.update = uov_ov_III_pkc_skc_verify_update,
+	.final = uov_ov_III_pkc_skc_verify_final,
+	.abort = uov_ov_III_pkc_skc_verify_abort,
+};
+
+const OQS_SIG_VERIFY_ops *OQS_SIG_uov_ov_III_pkc_skc_verify_ops(void) {
+	return &uov_ov_III_pkc_skc_verify_ops;
+}
 #endif
@@ -53,6 +53,17 @@ void hss_hash_ctx(void *result, int hash_type, union hash_context *ctx,
     }
 }
 
+void hss_hash_x4(unsigned char *result[4], int hash_type,
+          const unsigned char *message[4], size_t message_len) {
+    switch (hash_type) {
+    case HASH_SHA256:
+        OQS_SHA2_sha256_x4(result[0], result[1], result[2], result[3],
+                           message[0], message[1], message[2], message[3],
+                           message_len);
+        break;
+    }
+}
+
 void hss_hash(void *result, int hash_type,
           const void *message, size_t message_len) {
     union hash_context ctx;
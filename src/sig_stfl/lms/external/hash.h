@@ -34,6 +34,10 @@ void hss_hash(void *result, int hash_type,
 void hss_hash_ctx(void *result, int hash_type, union hash_context *ctx,
           const void *message, size_t message_len);
 
+/* Hashes four messages of the same length at once */
+void hss_hash_x4(unsigned char *result[4], int hash_type,
+          const unsigned char *message[4], size_t message_len);
+
 /*
  * This is a debugging flag; turning this on will cause the system to dump
  * the inputs and the outputs of all hash functions.  It only works if
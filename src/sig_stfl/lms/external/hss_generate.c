@@ -413,7 +413,7 @@ bool hss_generate_working_key(
                 /* update process will miss the very first update before we */
                 /* need to sign.  To account for that, generate one more */
                 /* node than what our current count would suggest */
-            if (i != w->levels - 1) {
+            if ((i-1) != w->levels - 1) {
                 subtree_count++;
             }
             active->current_index = 0;
@@ -422,7 +422,7 @@ bool hss_generate_working_key(
 
             /* Check if we have aux data at this level */
             int already_computed_lower = 0;
-            if (i == 0) {
+            if ((i-1) == 0) {
                 merkle_index_t lower_index = num_bottom_nodes-1;
                 merkle_index_t node_offset = active->left_leaf>>active->levels_below;
                 if (hss_extract_aux_data(expanded_aux, active->level+h_subtree,
@@ -473,7 +473,7 @@ bool hss_generate_working_key(
 
                 /* Check if this is already in the aux data */
                 already_computed_lower = 0;
-                if (i == 0) {
+                if ((i-1) == 0) {
                     merkle_index_t lower_index = num_bottom_nodes-1;
                     merkle_index_t node_offset = building->left_leaf>>building->levels_below;
                     if (hss_extract_aux_data(expanded_aux, building->level+h_subtree,
@@ -3,9 +3,11 @@
  * This is the code that implements the one-time-signature part of the LMS hash
  * based signatures
  */
+#include <string.h>
 #include "lm_ots_common.h"
 #include "common_defs.h"
 #include "hash.h"
+#include "hss_zeroize.h"
 
 /*
  * Convert the external name of a parameter set into the set of values we care
@@ -98,3 +100,53 @@ unsigned lm_ots_compute_checksum(const unsigned char *Q, unsigned Q_len,
     }
     return sum << ls;
 }
+
+/*
+ * This advances up to four OTS chains at once.  chain[k] is an ITER_MAX_LEN
+ * buffer that already holds I, q and the chain index, with the value at
+ * position begin[k] in ITER_PREV; it is iterated up to position end[k].
+ * Lanes with begin[k] == end[k] are idle, but chain[k] must still point to
+ * a buffer (which is hashed and ignored)
+ */
+void lm_ots_iterate_chains(unsigned h, unsigned n, unsigned char *chain[4],
+                           const unsigned begin[4], const unsigned end[4]) {
+    unsigned char out[4][MAX_HASH];
+    unsigned char *result[4] = { out[0], out[1], out[2], out[3] };
+    const unsigned char *message[4];
+    union hash_context ctx;
+    unsigned pos[4];
+    unsigned k, active, last = 0;
+
+    for (k=0; k<4; k++) {
+        pos[k] = begin[k];
+        message[k] = chain[k];
+    }
+    for (;;) {
+        active = 0;
+        for (k=0; k<4; k++) {
+            if (pos[k] < end[k]) {
+                chain[k][ITER_J] = (unsigned char)pos[k];
+                active++;
+                last = k;
+            }
+        }
+        if (active == 0) break;
+        if (active == 1) {
+            /* The longest chain finishes on its own */
+            hss_hash_ctx( chain[last] + ITER_PREV, h, &ctx, chain[last],
+                          ITER_LEN(n) );
+            pos[last]++;
+            continue;
+        }
+        hss_hash_x4( result, h, message, ITER_LEN(n) );
+        for (k=0; k<4; k++) {
+            if (pos[k] < end[k]) {
+                memcpy( chain[k] + ITER_PREV, out[k], n );
+                pos[k]++;
+            }
+        }
+    }
+
+    hss_zeroize( out, sizeof out );
+    hss_zeroize( &ctx, sizeof ctx );
+}
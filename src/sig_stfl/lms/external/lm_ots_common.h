@@ -14,5 +14,7 @@ unsigned lm_ots_hashes_per_public_key(param_set_t lm_ots_type);
 unsigned lm_ots_compute_checksum(const unsigned char *Q, unsigned Q_len,
                                  unsigned w, unsigned ls);
 unsigned lm_ots_coef(const unsigned char *Q, unsigned i, unsigned w);
+void lm_ots_iterate_chains(unsigned h, unsigned n, unsigned char *chain[4],
+                           const unsigned begin[4], const unsigned end[4]);
 
 #endif /* LM_OTS_COMMON_H_ */
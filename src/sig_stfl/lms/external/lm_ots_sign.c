@@ -40,35 +40,43 @@ bool lm_ots_generate_public_key(
 
     /* Now generate the public key */
     /* This is where we spend the majority of the time during key gen and */
-    /* signing operations; it would make sense to attempt to try to take */
-    /* advantage of parallel (SIMD) hardware; even if we use it nowhere */
-    /* else, we'd get a significant speed up */
-    unsigned i, j;
-
-    unsigned char buf[ ITER_MAX_LEN ];
-    memcpy( buf + ITER_I, I, I_LEN );
-    put_bigendian( buf + ITER_Q, q, 4 );
-    union hash_context ctx;
+    /* signing operations; all chains have the same length here, so they */
+    /* are computed four at a time with the multi-buffer hash */
+    unsigned i, k;
+
+    unsigned char buf[4][ ITER_MAX_LEN ];
+    unsigned char *chain[4] = { buf[0], buf[1], buf[2], buf[3] };
+    unsigned begin[4] = { 0, 0, 0, 0 };
+    unsigned end[4];
+    memset( buf, 0, sizeof buf );
+    for (k=0; k<4; k++) {
+        memcpy( buf[k] + ITER_I, I, I_LEN );
+        put_bigendian( buf[k] + ITER_Q, q, 4 );
+    }
 
     hss_seed_derive_set_j( seed, 0 );
 
-    for (i=0; i<p; i++) {
-        hss_seed_derive( buf + ITER_PREV, seed, i < p-1 );
-        put_bigendian( buf + ITER_K, i, 2 );
-        /* We'll place j in the buffer below */
-        for (j=0; j < (unsigned)(1<<w) - 1; j++) {
-            buf[ITER_J] = j;
-
-            hss_hash_ctx( buf + ITER_PREV, h, &ctx, buf, ITER_LEN(n) );
+    for (i=0; i<p; i+=4) {
+        for (k=0; k<4; k++) {
+            if (i+k < p) {
+                hss_seed_derive( buf[k] + ITER_PREV, seed, i+k < p-1 );
+                put_bigendian( buf[k] + ITER_K, i+k, 2 );
+                end[k] = (1<<w) - 1;
+            } else {
+                end[k] = 0;
+            }
+        }
+        lm_ots_iterate_chains( h, n, chain, begin, end );
+        /* Include those in the hash */
+        for (k=0; k<4 && i+k<p; k++) {
+            hss_update_hash_context(h, &public_ctx, buf[k] + ITER_PREV, n );
         }
-        /* Include that in the hash */
-        hss_update_hash_context(h, &public_ctx, buf + ITER_PREV, n );
     }
 
     /* And the result of the running hash is the public key */
     hss_finalize_hash_context( h, &public_ctx, public_key );
 
-    hss_zeroize( &ctx, sizeof ctx );
+    hss_zeroize( buf, sizeof buf );
 
     return true;
 }
@@ -143,27 +151,39 @@ bool lm_ots_generate_signature(
     /* Append the checksum to the randomized hash */
     put_bigendian( &Q[n], lm_ots_compute_checksum(Q, n, w, ls), 2 );
 
-    unsigned i;
-    unsigned char tmp[ITER_MAX_LEN];
+    unsigned i, k;
+    unsigned char tmp[4][ITER_MAX_LEN];
+    unsigned char *chain[4] = { tmp[0], tmp[1], tmp[2], tmp[3] };
+    unsigned begin[4] = { 0, 0, 0, 0 };
+    unsigned end[4];
 
     /* Preset the parts of tmp that don't change */
-    memcpy( tmp + ITER_I, I, I_LEN );
-    put_bigendian( tmp + ITER_Q, q, 4 );
+    memset( tmp, 0, sizeof tmp );
+    for (k=0; k<4; k++) {
+        memcpy( tmp[k] + ITER_I, I, I_LEN );
+        put_bigendian( tmp[k] + ITER_Q, q, 4 );
+    }
 
+    /* The chains are advanced four at a time */
     hss_seed_derive_set_j( seed, 0 );
-    for (i=0; i<p; i++) {
-        put_bigendian( tmp + ITER_K, i, 2 );
-        hss_seed_derive( tmp + ITER_PREV, seed, i<p-1 );
-        unsigned a = lm_ots_coef( Q, i, w );
-        unsigned j;
-        for (j=0; j<a; j++) {
-            tmp[ITER_J] = j;
-            hss_hash_ctx( tmp + ITER_PREV, h, &ctx, tmp, ITER_LEN(n) );
+    for (i=0; i<p; i+=4) {
+        for (k=0; k<4; k++) {
+            if (i+k < p) {
+                put_bigendian( tmp[k] + ITER_K, i+k, 2 );
+                hss_seed_derive( tmp[k] + ITER_PREV, seed, i+k<p-1 );
+                end[k] = lm_ots_coef( Q, i+k, w );
+            } else {
+                end[k] = 0;
+            }
+        }
+        lm_ots_iterate_chains( h, n, chain, begin, end );
+        for (k=0; k<4 && i+k<p; k++) {
+            memcpy( &signature[ 4 + n + n*(i+k) ], tmp[k] + ITER_PREV, n );
         }
-        memcpy( &signature[ 4 + n + n*i ], tmp + ITER_PREV, n );
     }
 
     hss_zeroize( &ctx, sizeof ctx );
+    hss_zeroize( tmp, sizeof tmp );
 
     return true;
 }
@@ -90,26 +90,37 @@ bool lm_ots_validate_signature_compute(
                                 PBLC_PREFIX_LEN );
     }
 
-    unsigned i;
-    unsigned char tmp[ITER_MAX_LEN];
+    unsigned i, k;
+    unsigned char tmp[4][ITER_MAX_LEN];
+    unsigned char *chain[4] = { tmp[0], tmp[1], tmp[2], tmp[3] };
+    unsigned begin[4];
+    unsigned end[4];
 
     /* Preset the parts of tmp that don't change */
-    memcpy( tmp + ITER_I, I, I_LEN );
-    put_bigendian( tmp + ITER_Q, q, 4 );
+    memset( tmp, 0, sizeof tmp );
+    for (k=0; k<4; k++) {
+        memcpy( tmp[k] + ITER_I, I, I_LEN );
+        put_bigendian( tmp[k] + ITER_Q, q, 4 );
+    }
 
+    /* The chains are advanced four at a time */
     unsigned max_digit = (1<<w) - 1;
-    for (i=0; i<p; i++) {
-        put_bigendian( tmp + ITER_K, i, 2 );
-        memcpy( tmp + ITER_PREV, y + i*n, n );
-        unsigned a = lm_ots_coef( Q, i, w );
-        unsigned j;
-        for (j=a; j<max_digit; j++) {
-            union hash_context ctx;
-            tmp[ITER_J] = j;
-            hss_hash_ctx( tmp + ITER_PREV, h, &ctx, tmp, ITER_LEN(n) );
+    for (i=0; i<p; i+=4) {
+        for (k=0; k<4; k++) {
+            if (i+k < p) {
+                put_bigendian( tmp[k] + ITER_K, i+k, 2 );
+                memcpy( tmp[k] + ITER_PREV, y + (i+k)*n, n );
+                begin[k] = lm_ots_coef( Q, i+k, w );
+                end[k] = max_digit;
+            } else {
+                begin[k] = end[k] = 0;
+            }
         }
+        lm_ots_iterate_chains( h, n, chain, begin, end );
 
-        hss_update_hash_context(h, &final_ctx, tmp + ITER_PREV, n );
+        for (k=0; k<4 && i+k<p; k++) {
+            hss_update_hash_context(h, &final_ctx, tmp[k] + ITER_PREV, n );
+        }
     }
 
     /* Ok, finalize the public key hash */
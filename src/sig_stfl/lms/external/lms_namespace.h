@@ -11,6 +11,7 @@
 #define hss_hash_blocksize LMS_NAMESPACE(hss_hash_blocksize)
 #define hss_hash_ctx LMS_NAMESPACE(hss_hash_ctx)
 #define hss_hash_length LMS_NAMESPACE(hss_hash_length)
+#define hss_hash_x4 LMS_NAMESPACE(hss_hash_x4)
 #define hss_init_hash_context LMS_NAMESPACE(hss_init_hash_context)
 #define hss_update_hash_context LMS_NAMESPACE(hss_update_hash_context)
 #define hss_extra_info_set_threads LMS_NAMESPACE(hss_extra_info_set_threads)
@@ -82,6 +83,7 @@
 #define lm_ots_get_public_key_len LMS_NAMESPACE(lm_ots_get_public_key_len)
 #define lm_ots_get_signature_len LMS_NAMESPACE(lm_ots_get_signature_len)
 #define lm_ots_hashes_per_public_key LMS_NAMESPACE(lm_ots_hashes_per_public_key)
+#define lm_ots_iterate_chains LMS_NAMESPACE(lm_ots_iterate_chains)
 #define lm_ots_look_up_parameter_set LMS_NAMESPACE(lm_ots_look_up_parameter_set)
 #define lm_ots_generate_public_key LMS_NAMESPACE(lm_ots_generate_public_key)
 #define lm_ots_generate_randomizer LMS_NAMESPACE(lm_ots_generate_randomizer)
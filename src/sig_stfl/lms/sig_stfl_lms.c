@@ -54,6 +54,9 @@ static OQS_STATUS OQS_SECRET_KEY_LMS_deserialize_key(OQS_SIG_STFL_SECRET_KEY *sk
 
 static void OQS_SECRET_KEY_LMS_set_store_cb(OQS_SIG_STFL_SECRET_KEY *sk, secure_store_sk store_cb, void *context);
 
+/* Use an lms byte string in application memory in place */
+static OQS_STATUS OQS_SECRET_KEY_LMS_map_key(OQS_SIG_STFL_SECRET_KEY *sk, uint8_t *sk_buf, size_t sk_len);
+
 // ======================== LMS Maccros ======================== //
 // macro to en/disable OQS_SIG_STFL-only structs used only in sig&gen case:
 #ifdef OQS_ALLOW_LMS_KEY_AND_SIG_GEN
@@ -62,7 +65,16 @@ static void OQS_SECRET_KEY_LMS_set_store_cb(OQS_SIG_STFL_SECRET_KEY *sk, secure_
         sig->sigs_remaining = OQS_SIG_STFL_lms_sigs_left; \
         sig->sigs_total = OQS_SIG_STFL_lms_sigs_total; \
         sig->keypair = OQS_SIG_STFL_alg_lms_##lms_variant##_keypair; \
-        sig->sign = OQS_SIG_STFL_alg_lms_sign;
+        sig->sign = OQS_SIG_STFL_alg_lms_sign; \
+        sig->sign_concurrent = OQS_SIG_STFL_alg_lms_sign_concurrent; \
+        sig->sign_init = OQS_SIG_STFL_alg_lms_sign_init; \
+        sig->sign_update = OQS_SIG_STFL_alg_lms_sign_update; \
+        sig->sign_final = OQS_SIG_STFL_alg_lms_sign_final; \
+        sig->sign_abort = OQS_SIG_STFL_alg_lms_sign_abort; \
+        sig->verify_init = OQS_SIG_STFL_alg_lms_verify_init; \
+        sig->verify_update = OQS_SIG_STFL_alg_lms_verify_update; \
+        sig->verify_final = OQS_SIG_STFL_alg_lms_verify_final; \
+        sig->verify_abort = OQS_SIG_STFL_alg_lms_verify_abort;
 #else
 #define LMS_SIGGEN(lms_variant, LMS_VARIANT)
 #endif
@@ -125,6 +137,15 @@ OQS_SIG_STFL_SECRET_KEY *OQS_SECRET_KEY_LMS_##LMS_VARIANT##_new(void) {\
         sk->free_key = OQS_SECRET_KEY_LMS_free;\
 \
         sk->set_scrt_key_store_cb = OQS_SECRET_KEY_LMS_set_store_cb;\
+\
+        sk->secure_store_scrt_key_range = NULL;\
+\
+        sk->map_key = OQS_SECRET_KEY_LMS_map_key;\
+\
+        if (oqs_lms_signer_init(sk) != OQS_SUCCESS) {\
+                OQS_MEM_insecure_free(sk);\
+                return NULL;\
+        }\
 \
         return sk;\
 }
@@ -287,6 +308,11 @@ static OQS_STATUS OQS_SECRET_KEY_LMS_deserialize_key(OQS_SIG_STFL_SECRET_KEY *sk
 	return oqs_deserialize_lms_key(sk, sk_buf, sk_len, context);
 }
 
+/* Use an lms byte string in application memory in place */
+static OQS_STATUS OQS_SECRET_KEY_LMS_map_key(OQS_SIG_STFL_SECRET_KEY *sk, uint8_t *sk_buf, size_t sk_len) {
+	return oqs_map_lms_key(sk, sk_buf, sk_len);
+}
+
 static void OQS_SECRET_KEY_LMS_set_store_cb(OQS_SIG_STFL_SECRET_KEY *sk, secure_store_sk store_cb, void *context) {
 	if (sk && store_cb && context) {
 		oqs_lms_key_set_store_cb(sk, store_cb, context);
@@ -319,21 +319,43 @@ int oqs_sig_stfl_lms_keypair(uint8_t *pk, OQS_SIG_STFL_SECRET_KEY *sk, const uin
 int oqs_sig_stfl_lms_sign(OQS_SIG_STFL_SECRET_KEY *sk, uint8_t *sm, size_t *smlen,
                           const uint8_t *m, size_t mlen);
 
+struct hss_sign_inc;
+struct hss_working_key;
+int oqs_sig_stfl_lms_sign_reserve(OQS_SIG_STFL_SECRET_KEY *sk, struct hss_sign_inc *ctx, struct hss_working_key **w,
+                                  uint8_t *signature, size_t *signature_len);
+int oqs_sig_stfl_lms_sign_message(struct hss_sign_inc *ctx, struct hss_working_key *w,
+                                  uint8_t *signature, const uint8_t *m, size_t mlen);
+int oqs_sig_stfl_lms_sign_final(struct hss_sign_inc *ctx, struct hss_working_key *w, uint8_t *signature);
+
 int oqs_sig_stfl_lms_verify(const uint8_t *m, size_t mlen, const uint8_t *sm, size_t smlen,
                             const uint8_t *pk);
 
+OQS_STATUS oqs_lms_signer_init(OQS_SIG_STFL_SECRET_KEY *sk);
 void oqs_secret_lms_key_free(OQS_SIG_STFL_SECRET_KEY *sk);
 
 OQS_STATUS oqs_serialize_lms_key(uint8_t **sk_key, size_t *sk_len, const OQS_SIG_STFL_SECRET_KEY *sk);
 OQS_STATUS oqs_deserialize_lms_key(OQS_SIG_STFL_SECRET_KEY *sk, const uint8_t *sk_buf, const size_t sk_len, void *context);
+OQS_STATUS oqs_map_lms_key(OQS_SIG_STFL_SECRET_KEY *sk, uint8_t *sk_buf, const size_t sk_len);
 void oqs_lms_key_set_store_cb(OQS_SIG_STFL_SECRET_KEY *sk, secure_store_sk store_cb, void *context);
 
 // ---------------------------- FUNCTIONS INDEPENDENT OF VARIANT -----------------------------------------
 
 OQS_API OQS_STATUS OQS_SIG_STFL_alg_lms_sign(uint8_t *signature, size_t *signature_length, const uint8_t *message, size_t message_len, OQS_SIG_STFL_SECRET_KEY *secret_key);
 
+OQS_API OQS_STATUS OQS_SIG_STFL_alg_lms_sign_concurrent(uint8_t *signature, size_t *signature_length, const uint8_t *message, size_t message_len, OQS_SIG_STFL_SECRET_KEY *secret_key);
+
 OQS_API OQS_STATUS OQS_SIG_STFL_alg_lms_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
 
+OQS_API OQS_STATUS OQS_SIG_STFL_alg_lms_sign_init(void **state, uint8_t *signature, OQS_SIG_STFL_SECRET_KEY *secret_key);
+OQS_API OQS_STATUS OQS_SIG_STFL_alg_lms_sign_update(void *state, const uint8_t *message, size_t message_len);
+OQS_API OQS_STATUS OQS_SIG_STFL_alg_lms_sign_final(void *state, uint8_t *signature, size_t *signature_len);
+OQS_API void OQS_SIG_STFL_alg_lms_sign_abort(void *state);
+
+OQS_API OQS_STATUS OQS_SIG_STFL_alg_lms_verify_init(void **state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_STFL_alg_lms_verify_update(void *state, const uint8_t *message, size_t message_len);
+OQS_API OQS_STATUS OQS_SIG_STFL_alg_lms_verify_final(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+OQS_API void OQS_SIG_STFL_alg_lms_verify_abort(void *state);
+
 // --------------------------------------------------------------------------------------------------------
 
 #endif /* OQS_SIG_STFL_LMS_H */
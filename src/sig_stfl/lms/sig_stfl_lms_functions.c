@@ -2,6 +2,9 @@
 
 #include <string.h>
 #include <oqs/oqs.h>
+#if defined(OQS_USE_PTHREADS)
+#include <pthread.h>
+#endif
 #include "sig_stfl_lms.h"
 #include "external/config.h"
 #include "external/hss_verify_inc.h"
@@ -10,6 +13,7 @@
 #include "external/endian.h"
 #include "external/hss_internal.h"
 #include "sig_stfl_lms_wrap.h"
+#include "../sig_stfl_verify.h"
 
 #ifdef __GNUC__
 #define UNUSED __attribute__((unused))
@@ -52,6 +56,39 @@ typedef struct OQS_LMS_KEY_DATA {
 	void *context;
 } oqs_lms_key_data;
 
+#ifdef OQS_ALLOW_LMS_KEY_AND_SIG_GEN
+/*
+ * Passes the updated private key to the application: serialized in full, or for a
+ * mapped key only the bytes of sec_key that differ from sec_key_before, which is the
+ * signature counter. sec_key is at the start of the serialized key.
+ */
+static OQS_STATUS oqs_lms_store_key(const OQS_SIG_STFL_SECRET_KEY *sk, const uint8_t *sec_key_before) {
+	const oqs_lms_key_data *lms_key_data = sk->secret_key_data;
+	const uint8_t *sec_key = lms_key_data->sec_key;
+	uint8_t *sk_key_buf = NULL;
+	size_t sk_key_buf_len = 0;
+	size_t start, end;
+	OQS_STATUS status;
+
+	if (sk->secure_store_scrt_key_range == NULL) {
+		status = oqs_serialize_lms_key(&sk_key_buf, &sk_key_buf_len, sk);
+		if (status == OQS_SUCCESS) {
+			status = sk->secure_store_scrt_key(sk_key_buf, sk_key_buf_len, sk->context);
+		}
+		OQS_MEM_secure_free(sk_key_buf, sk_key_buf_len);
+		return status;
+	}
+
+	for (start = 0; start < lms_key_data->len_sec_key && sec_key[start] == sec_key_before[start]; start++);
+	if (start == lms_key_data->len_sec_key) {
+		return OQS_SUCCESS;
+	}
+	for (end = lms_key_data->len_sec_key; sec_key[end - 1] == sec_key_before[end - 1]; end--);
+
+	return sk->secure_store_scrt_key_range(sec_key, start, end - start, sk->context);
+}
+#endif
+
 #ifndef OQS_ALLOW_LMS_KEY_AND_SIG_GEN
 OQS_API OQS_STATUS OQS_SIG_STFL_alg_lms_sign(UNUSED uint8_t *signature, UNUSED size_t *signature_length, UNUSED const uint8_t *message,
         UNUSED size_t message_len, UNUSED OQS_SIG_STFL_SECRET_KEY *secret_key) {
@@ -61,11 +98,8 @@ OQS_API OQS_STATUS OQS_SIG_STFL_alg_lms_sign(UNUSED uint8_t *signature, UNUSED s
 OQS_API OQS_STATUS OQS_SIG_STFL_alg_lms_sign(uint8_t *signature, size_t *signature_length, const uint8_t *message,
         size_t message_len, OQS_SIG_STFL_SECRET_KEY *secret_key) {
 	OQS_STATUS status = OQS_ERROR;
-	OQS_STATUS rc_keyupdate = OQS_ERROR;
 	oqs_lms_key_data *lms_key_data = NULL;
-	uint8_t *sk_key_buf = NULL;
-	size_t sk_key_buf_len = 0;
-	void *context;
+	uint8_t sec_key_before[PRIVATE_KEY_LEN];
 
 	if (secret_key == NULL || message == NULL || signature == NULL || signature_length == NULL) {
 		return OQS_ERROR;
@@ -79,15 +113,16 @@ OQS_API OQS_STATUS OQS_SIG_STFL_alg_lms_sign(uint8_t *signature, size_t *signatu
 	/*
 	 * Don't even attempt signing without a way to safe the updated private key
 	 */
-	if (secret_key->secure_store_scrt_key == NULL) {
+	if (secret_key->secure_store_scrt_key == NULL && secret_key->secure_store_scrt_key_range == NULL) {
 		fprintf(stderr, "No Secure-store set for secret key.\n.");
 		goto err;
 	}
 
 	lms_key_data = (oqs_lms_key_data *)secret_key->secret_key_data;
-	if (lms_key_data == NULL) {
+	if (lms_key_data == NULL || lms_key_data->len_sec_key > sizeof(sec_key_before)) {
 		goto err;
 	}
+	memcpy(sec_key_before, lms_key_data->sec_key, lms_key_data->len_sec_key);
 
 	if (oqs_sig_stfl_lms_sign(secret_key, signature,
 	                          signature_length,
@@ -96,18 +131,10 @@ OQS_API OQS_STATUS OQS_SIG_STFL_alg_lms_sign(uint8_t *signature, size_t *signatu
 	}
 
 	/*
-	 * serialize and securely store the updated private key
-	 * but, delete signature and the serialized key other wise
+	 * securely store the updated private key
+	 * but, delete signature other wise
 	 */
-
-	rc_keyupdate = oqs_serialize_lms_key(&sk_key_buf, &sk_key_buf_len, secret_key);
-	if (rc_keyupdate != OQS_SUCCESS) {
-		goto err;
-	}
-
-	context = secret_key->context;
-	rc_keyupdate = secret_key->secure_store_scrt_key(sk_key_buf, sk_key_buf_len, context);
-	if (rc_keyupdate != OQS_SUCCESS) {
+	if (oqs_lms_store_key(secret_key, sec_key_before) != OQS_SUCCESS) {
 		goto err;
 	}
 
@@ -121,7 +148,7 @@ err:
 	*signature_length = 0;
 
 passed:
-	OQS_MEM_secure_free(sk_key_buf, sk_key_buf_len);
+	OQS_MEM_cleanse(sec_key_before, sizeof(sec_key_before));
 
 	/* Unlock secret to ensure OTS use */
 	if ((secret_key->unlock_key) && (secret_key->mutex)) {
@@ -131,6 +158,319 @@ passed:
 }
 #endif
 
+#ifdef OQS_ALLOW_LMS_KEY_AND_SIG_GEN
+/*
+ * Signing state of an LMS secret key, in sk->sign_state. Concurrent signers advance w, a
+ * working key loaded once from the key, one at a time, with sec_key as its private key, and
+ * then copy the advanced sec_key into the key under the key lock. w is loaded again if the
+ * key was changed by other means.
+ */
+typedef struct {
+#if defined(OQS_USE_PTHREADS)
+	/* Serializes the signers on w */
+	pthread_mutex_t lock;
+#endif
+	struct hss_working_key *w;
+	uint8_t sec_key[PRIVATE_KEY_LEN];
+} oqs_lms_signer;
+
+/* Without threads the key lock also serializes the signers, and is held for the whole reservation. */
+static void oqs_lms_signer_lock(const OQS_SIG_STFL_SECRET_KEY *sk, oqs_lms_signer *signer) {
+#if defined(OQS_USE_PTHREADS)
+	(void)sk;
+	pthread_mutex_lock(&signer->lock);
+#else
+	(void)signer;
+	if ((sk->lock_key) && (sk->mutex)) {
+		sk->lock_key(sk->mutex);
+	}
+#endif
+}
+
+static void oqs_lms_signer_unlock(const OQS_SIG_STFL_SECRET_KEY *sk, oqs_lms_signer *signer) {
+#if defined(OQS_USE_PTHREADS)
+	(void)sk;
+	pthread_mutex_unlock(&signer->lock);
+#else
+	(void)signer;
+	if ((sk->unlock_key) && (sk->mutex)) {
+		sk->unlock_key(sk->mutex);
+	}
+#endif
+}
+
+static void oqs_lms_key_lock(const OQS_SIG_STFL_SECRET_KEY *sk) {
+#if defined(OQS_USE_PTHREADS)
+	if ((sk->lock_key) && (sk->mutex)) {
+		sk->lock_key(sk->mutex);
+	}
+#else
+	(void)sk;
+#endif
+}
+
+static void oqs_lms_key_unlock(const OQS_SIG_STFL_SECRET_KEY *sk) {
+#if defined(OQS_USE_PTHREADS)
+	if ((sk->unlock_key) && (sk->mutex)) {
+		sk->unlock_key(sk->mutex);
+	}
+#else
+	(void)sk;
+#endif
+}
+
+/*
+ * Copies the parts of w that hss_sign_finalize() reads: the parameter sets, and the I and
+ * seed of the top tree, which never change. A signature reserved on the signer's working
+ * key is finished on the copy, after the signer has moved on.
+ */
+static struct hss_working_key *oqs_lms_copy_final_key(const struct hss_working_key *w) {
+	struct hss_working_key *copy = OQS_MEM_calloc(1, sizeof(struct hss_working_key));
+	if (copy == NULL) {
+		return NULL;
+	}
+
+	copy->levels = w->levels;
+	copy->status = w->status;
+	for (unsigned i = 0; i < w->levels; i++) {
+		struct merkle_level *tree = OQS_MEM_calloc(1, sizeof(struct merkle_level));
+		if (tree == NULL) {
+			hss_free_working_key(copy);
+			return NULL;
+		}
+		tree->level = w->tree[i]->level;
+		tree->h = w->tree[i]->h;
+		tree->hash_size = w->tree[i]->hash_size;
+		tree->lm_type = w->tree[i]->lm_type;
+		tree->lm_ots_type = w->tree[i]->lm_ots_type;
+		tree->max_index = w->tree[i]->max_index;
+		copy->tree[i] = tree;
+	}
+	memcpy(copy->tree[0]->I, w->tree[0]->I, I_LEN);
+	memcpy(copy->tree[0]->seed, w->tree[0]->seed, SEED_LEN);
+
+	return copy;
+}
+
+/*
+ * Reserves the next leaf of secret_key and stores the updated key. The working key is advanced
+ * by the signer outside the key lock; only the copy of the advanced private key into the key
+ * and the store run under the lock. On success the key for the LM-OTS signature is returned in
+ * *w, to be released by oqs_sig_stfl_lms_sign_message() or oqs_sig_stfl_lms_sign_final().
+ */
+static OQS_STATUS oqs_lms_sign_reserve_locked(OQS_SIG_STFL_SECRET_KEY *secret_key, struct hss_sign_inc *ctx, struct hss_working_key **w,
+        uint8_t *signature, size_t *signature_length) {
+	OQS_STATUS status = OQS_ERROR;
+	oqs_lms_key_data *lms_key_data = NULL;
+	oqs_lms_signer *signer = secret_key->sign_state;
+	uint8_t sec_key_before[PRIVATE_KEY_LEN];
+	size_t sig_len;
+	bool synced;
+
+	*w = NULL;
+	*signature_length = 0;
+
+	/*
+	 * Don't even attempt signing without a way to safe the updated private key
+	 */
+	if (secret_key->secure_store_scrt_key == NULL && secret_key->secure_store_scrt_key_range == NULL) {
+		fprintf(stderr, "No Secure-store set for secret key.\n.");
+		return OQS_ERROR;
+	}
+
+	lms_key_data = (oqs_lms_key_data *)secret_key->secret_key_data;
+	if (signer == NULL || lms_key_data == NULL || lms_key_data->len_sec_key > sizeof(sec_key_before)) {
+		return OQS_ERROR;
+	}
+
+	oqs_lms_signer_lock(secret_key, signer);
+
+	do {
+		if (signer->w == NULL) {
+			oqs_lms_key_lock(secret_key);
+			memcpy(signer->sec_key, lms_key_data->sec_key, lms_key_data->len_sec_key);
+			oqs_lms_key_unlock(secret_key);
+
+			signer->w = hss_load_private_key(NULL, signer->sec_key, 0,
+			                                 lms_key_data->aux_data, lms_key_data->len_aux_data, NULL);
+			if (signer->w == NULL) {
+				goto unlock;
+			}
+		}
+
+		/* Look up the signature length */
+		sig_len = hss_get_signature_len_from_working_key(signer->w);
+		if (sig_len == 0) {
+			goto unlock;
+		}
+
+		/* Advance the working key and signer->sec_key, and write all but the bottom LM-OTS signature */
+		memcpy(sec_key_before, signer->sec_key, lms_key_data->len_sec_key);
+		if (!hss_sign_init(ctx, signer->w, NULL, signer->sec_key, signature, sig_len, 0)) {
+			hss_free_working_key(signer->w);
+			signer->w = NULL;
+			goto unlock;
+		}
+
+		oqs_lms_key_lock(secret_key);
+		synced = memcmp(lms_key_data->sec_key, sec_key_before, lms_key_data->len_sec_key) == 0;
+		if (synced) {
+			memcpy(lms_key_data->sec_key, signer->sec_key, lms_key_data->len_sec_key);
+			status = oqs_lms_store_key(secret_key, sec_key_before);
+		} else {
+			/* The key was changed by other means; sign again from the key as it is now */
+			hss_free_working_key(signer->w);
+			signer->w = NULL;
+		}
+		oqs_lms_key_unlock(secret_key);
+	} while (!synced);
+
+	if (status == OQS_SUCCESS) {
+		*w = oqs_lms_copy_final_key(signer->w);
+		if (*w == NULL) {
+			status = OQS_ERROR;
+		} else {
+			*signature_length = sig_len;
+		}
+	}
+
+unlock:
+	OQS_MEM_cleanse(sec_key_before, sizeof(sec_key_before));
+	oqs_lms_signer_unlock(secret_key, signer);
+	return status;
+}
+#endif
+
+#ifndef OQS_ALLOW_LMS_KEY_AND_SIG_GEN
+OQS_API OQS_STATUS OQS_SIG_STFL_alg_lms_sign_concurrent(UNUSED uint8_t *signature, UNUSED size_t *signature_length, UNUSED const uint8_t *message,
+        UNUSED size_t message_len, UNUSED OQS_SIG_STFL_SECRET_KEY *secret_key) {
+	return OQS_ERROR;
+}
+#else
+OQS_API OQS_STATUS OQS_SIG_STFL_alg_lms_sign_concurrent(uint8_t *signature, size_t *signature_length, const uint8_t *message,
+        size_t message_len, OQS_SIG_STFL_SECRET_KEY *secret_key) {
+	OQS_STATUS status;
+	struct hss_sign_inc ctx;
+	struct hss_working_key *w = NULL;
+
+	if (secret_key == NULL || message == NULL || signature == NULL || signature_length == NULL) {
+		return OQS_ERROR;
+	}
+
+	status = oqs_lms_sign_reserve_locked(secret_key, &ctx, &w, signature, signature_length);
+
+	/* The reserved leaf is used by no other signer, so the LM-OTS signature is computed outside the lock */
+	if (status == OQS_SUCCESS) {
+		if (oqs_sig_stfl_lms_sign_message(&ctx, w, signature, message, message_len) != 0) {
+			status = OQS_ERROR;
+		}
+	}
+	if (status != OQS_SUCCESS) {
+		if (*signature_length) {
+			OQS_MEM_cleanse(signature, *signature_length);
+		}
+		*signature_length = 0;
+	}
+	return status;
+}
+#endif
+
+#ifdef OQS_ALLOW_LMS_KEY_AND_SIG_GEN
+/* State of a streaming LMS signature */
+typedef struct {
+	struct hss_sign_inc ctx;
+	struct hss_working_key *w;
+	size_t sig_len;
+} oqs_lms_sign_state;
+#endif
+
+#ifndef OQS_ALLOW_LMS_KEY_AND_SIG_GEN
+OQS_API OQS_STATUS OQS_SIG_STFL_alg_lms_sign_init(UNUSED void **state, UNUSED uint8_t *signature, UNUSED OQS_SIG_STFL_SECRET_KEY *secret_key) {
+	return OQS_ERROR;
+}
+
+OQS_API OQS_STATUS OQS_SIG_STFL_alg_lms_sign_update(UNUSED void *state, UNUSED const uint8_t *message, UNUSED size_t message_len) {
+	return OQS_ERROR;
+}
+
+OQS_API OQS_STATUS OQS_SIG_STFL_alg_lms_sign_final(UNUSED void *state, UNUSED uint8_t *signature, UNUSED size_t *signature_len) {
+	return OQS_ERROR;
+}
+
+OQS_API void OQS_SIG_STFL_alg_lms_sign_abort(UNUSED void *state) {
+}
+#else
+OQS_API OQS_STATUS OQS_SIG_STFL_alg_lms_sign_init(void **state, uint8_t *signature, OQS_SIG_STFL_SECRET_KEY *secret_key) {
+	oqs_lms_sign_state *st;
+
+	if (state == NULL || signature == NULL || secret_key == NULL) {
+		return OQS_ERROR;
+	}
+
+	st = OQS_MEM_malloc(sizeof(oqs_lms_sign_state));
+	if (st == NULL) {
+		return OQS_ERROR;
+	}
+
+	/* The leaf is reserved and stored now; the message is hashed by sign_update */
+	if (oqs_lms_sign_reserve_locked(secret_key, &st->ctx, &st->w, signature, &st->sig_len) != OQS_SUCCESS) {
+		OQS_MEM_insecure_free(st);
+		return OQS_ERROR;
+	}
+
+	*state = st;
+	return OQS_SUCCESS;
+}
+
+OQS_API OQS_STATUS OQS_SIG_STFL_alg_lms_sign_update(void *state, const uint8_t *message, size_t message_len) {
+	oqs_lms_sign_state *st = state;
+
+	if (st == NULL || (message == NULL && message_len != 0)) {
+		return OQS_ERROR;
+	}
+
+	if (!hss_sign_update(&st->ctx, message, message_len)) {
+		return OQS_ERROR;
+	}
+
+	return OQS_SUCCESS;
+}
+
+OQS_API OQS_STATUS OQS_SIG_STFL_alg_lms_sign_final(void *state, uint8_t *signature, size_t *signature_len) {
+	oqs_lms_sign_state *st = state;
+	OQS_STATUS status = OQS_ERROR;
+
+	if (st == NULL) {
+		return OQS_ERROR;
+	}
+
+	if (signature != NULL && signature_len != NULL) {
+		if (oqs_sig_stfl_lms_sign_final(&st->ctx, st->w, signature) == 0) {
+			*signature_len = st->sig_len;
+			status = OQS_SUCCESS;
+		} else {
+			OQS_MEM_cleanse(signature, st->sig_len);
+		}
+		st->w = NULL;
+	}
+
+	OQS_SIG_STFL_alg_lms_sign_abort(st);
+	return status;
+}
+
+OQS_API void OQS_SIG_STFL_alg_lms_sign_abort(void *state) {
+	oqs_lms_sign_state *st = state;
+
+	if (st == NULL) {
+		return;
+	}
+	if (st->w != NULL) {
+		hss_free_working_key(st->w);
+	}
+	OQS_MEM_secure_free(st, sizeof(oqs_lms_sign_state));
+}
+#endif
+
 OQS_API OQS_STATUS OQS_SIG_STFL_alg_lms_verify(const uint8_t *message, size_t message_len,
         const uint8_t *signature, size_t signature_len, const uint8_t *public_key) {
 
@@ -147,6 +487,70 @@ OQS_API OQS_STATUS OQS_SIG_STFL_alg_lms_verify(const uint8_t *message, size_t me
 	return OQS_SUCCESS;
 }
 
+OQS_API OQS_STATUS OQS_SIG_STFL_alg_lms_verify_init(void **state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key) {
+	struct hss_validate_inc *ctx;
+
+	if (state == NULL || signature == NULL || public_key == NULL) {
+		return OQS_ERROR;
+	}
+
+	ctx = OQS_MEM_malloc(sizeof(struct hss_validate_inc));
+	if (ctx == NULL) {
+		return OQS_ERROR;
+	}
+
+	if (!hss_validate_signature_init(ctx, public_key, signature, signature_len, 0)) {
+		OQS_MEM_insecure_free(ctx);
+		return OQS_ERROR;
+	}
+
+	*state = ctx;
+	return OQS_SUCCESS;
+}
+
+OQS_API OQS_STATUS OQS_SIG_STFL_alg_lms_verify_update(void *state, const uint8_t *message, size_t message_len) {
+
+	if (state == NULL || (message == NULL && message_len != 0)) {
+		return OQS_ERROR;
+	}
+
+	if (!hss_validate_signature_update(state, message, message_len)) {
+		return OQS_ERROR;
+	}
+
+	return OQS_SUCCESS;
+}
+
+OQS_API OQS_STATUS OQS_SIG_STFL_alg_lms_verify_final(void *state, const uint8_t *signature, UNUSED size_t signature_len, UNUSED const uint8_t *public_key) {
+	bool valid = false;
+
+	if (state == NULL) {
+		return OQS_ERROR;
+	}
+
+	if (signature != NULL) {
+		valid = hss_validate_signature_finalize(state, signature, 0);
+	}
+
+	OQS_MEM_insecure_free(state);
+	return valid ? OQS_SUCCESS : OQS_ERROR;
+}
+
+OQS_API void OQS_SIG_STFL_alg_lms_verify_abort(void *state) {
+	OQS_MEM_insecure_free(state);
+}
+
+static const OQS_SIG_STFL_VERIFY_ops lms_verify_ops = {
+	.init = OQS_SIG_STFL_alg_lms_verify_init,
+	.update = OQS_SIG_STFL_alg_lms_verify_update,
+	.final = OQS_SIG_STFL_alg_lms_verify_final,
+	.abort = OQS_SIG_STFL_alg_lms_verify_abort,
+};
+
+const OQS_SIG_STFL_VERIFY_ops *OQS_SIG_STFL_alg_lms_verify_ops(void) {
+	return &lms_verify_ops;
+}
+
 OQS_API OQS_STATUS OQS_SIG_STFL_lms_sigs_left(unsigned long long *remain, const OQS_SIG_STFL_SECRET_KEY *secret_key) {
 	OQS_STATUS status;
 	uint8_t *priv_key = NULL;
@@ -545,80 +949,99 @@ int oqs_sig_stfl_lms_sign(UNUSED OQS_SIG_STFL_SECRET_KEY *sk, UNUSED uint8_t *si
 	return -1;
 }
 #else
-int oqs_sig_stfl_lms_sign(OQS_SIG_STFL_SECRET_KEY *sk,
-                          uint8_t *signature, size_t *signature_len,
-                          const uint8_t *m, size_t mlen) {
-
+/*
+ * Reserves the next bottom-level leaf: advances the private key and writes all
+ * of the signature but the bottom LM-OTS signature. The working key is loaded
+ * afresh from the private key and is returned in *w for
+ * oqs_sig_stfl_lms_sign_message() to release; concurrent signers keep theirs in
+ * the signing state instead. Must run under the secret key lock.
+ */
+int oqs_sig_stfl_lms_sign_reserve(OQS_SIG_STFL_SECRET_KEY *sk, struct hss_sign_inc *ctx, struct hss_working_key **w,
+                                  uint8_t *signature, size_t *signature_len) {
 	size_t sig_len;
-	bool status;
-	uint8_t *sig = NULL;
-	uint8_t *priv_key = NULL;
 	oqs_lms_key_data *oqs_key_data = NULL;
-	struct hss_working_key *w = NULL;
-	struct hss_sign_inc ctx;
-	if (sk) {
-		oqs_key_data = sk->secret_key_data;
-		priv_key = oqs_key_data->sec_key;
-	} else {
+
+	if (sk == NULL || sk->secret_key_data == NULL || w == NULL) {
 		return -1;
 	}
-	w = hss_load_private_key(NULL, priv_key,
-	                         0,
-	                         NULL,
-	                         0,
-	                         0);
-	if (!w) {
-		hss_free_working_key(w);
-		return 0;
+	oqs_key_data = sk->secret_key_data;
+
+	*w = hss_load_private_key(NULL, oqs_key_data->sec_key,
+	                          0,
+	                          NULL,
+	                          0,
+	                          0);
+	if (!*w) {
+		return -1;
 	}
 
-	/* Now, go through the file list, and generate the signatures for each */
-
 	/* Look up the signature length */
-
-	sig_len = hss_get_signature_len_from_working_key(w);
+	sig_len = hss_get_signature_len_from_working_key(*w);
 	if (sig_len == 0) {
-		hss_free_working_key(w);
-		return 0;
+		goto err;
 	}
 
-	sig = OQS_MEM_malloc(sig_len);
-	if (!sig) {
-		hss_free_working_key(w);
-		return -1;
+	if (!hss_sign_init(
+	            ctx,                  /* Incremental signing context */
+	            *w,                   /* Working key */
+	            NULL,                 /* Routine to update the */
+	            oqs_key_data->sec_key, /* private key */
+	            signature, sig_len,   /* Where to place the signature */
+	            0)) {
+		goto err;
 	}
 
-	(void)hss_sign_init(
-	    &ctx,                 /* Incremental signing context */
-	    w,                    /* Working key */
-	    NULL,                 /* Routine to update the */
-	    priv_key,       /* private key */
-	    sig, sig_len,         /* Where to place the signature */
-	    0);
+	*signature_len = sig_len;
+	return 0;
+
+err:
+	hss_free_working_key(*w);
+	*w = NULL;
+	return -1;
+}
 
+/*
+ * Completes a signature reserved with oqs_sig_stfl_lms_sign_reserve() with the
+ * LM-OTS signature on m, and frees the working key. Neither touches the secret
+ * key, so this may run outside the secret key lock.
+ */
+int oqs_sig_stfl_lms_sign_message(struct hss_sign_inc *ctx, struct hss_working_key *w,
+                                  uint8_t *signature, const uint8_t *m, size_t mlen) {
 	(void)hss_sign_update(
-	    &ctx,           /* Incremental signing context */
-	    m,         /* Next piece of the message */
-	    mlen);             /* Length of this piece */
+	    ctx,            /* Incremental signing context */
+	    m,              /* Next piece of the message */
+	    mlen);          /* Length of this piece */
+
+	return oqs_sig_stfl_lms_sign_final(ctx, w, signature);
+}
+
+/*
+ * Completes a signature reserved with oqs_sig_stfl_lms_sign_reserve() once the
+ * message has been passed to hss_sign_update(), and frees the working key.
+ */
+int oqs_sig_stfl_lms_sign_final(struct hss_sign_inc *ctx, struct hss_working_key *w, uint8_t *signature) {
+	bool status;
 
 	status = hss_sign_finalize(
-	             &ctx,               /* Incremental signing context */
+	             ctx,                /* Incremental signing context */
 	             w,                  /* Working key */
-	             sig,                /* Signature */
+	             signature,          /* Signature */
 	             0);
 
-	if (!status) {
-		hss_free_working_key(w);
-		OQS_MEM_insecure_free(sig);
-		return -1;
-	}
-
-	*signature_len = sig_len;
-	memcpy(signature, sig, sig_len);
-	OQS_MEM_insecure_free(sig);
 	hss_free_working_key(w);
+	return status ? 0 : -1;
+}
 
-	return 0;
+int oqs_sig_stfl_lms_sign(OQS_SIG_STFL_SECRET_KEY *sk,
+                          uint8_t *signature, size_t *signature_len,
+                          const uint8_t *m, size_t mlen) {
+	struct hss_sign_inc ctx;
+	struct hss_working_key *w = NULL;
+
+	if (oqs_sig_stfl_lms_sign_reserve(sk, &ctx, &w, signature, signature_len) != 0) {
+		return -1;
+	}
+	return oqs_sig_stfl_lms_sign_message(&ctx, w, signature, m, mlen);
 }
 #endif
 
@@ -653,14 +1076,52 @@ int oqs_sig_stfl_lms_verify(const uint8_t *m, size_t mlen,
 	}
 }
 
+/* Allocates the signing state of sk. Without signature generation there is none. */
+OQS_STATUS oqs_lms_signer_init(OQS_SIG_STFL_SECRET_KEY *sk) {
+	sk->sign_state = NULL;
+#ifdef OQS_ALLOW_LMS_KEY_AND_SIG_GEN
+	oqs_lms_signer *signer = OQS_MEM_malloc(sizeof(oqs_lms_signer));
+	if (signer == NULL) {
+		return OQS_ERROR;
+	}
+	signer->w = NULL;
+#if defined(OQS_USE_PTHREADS)
+	if (pthread_mutex_init(&signer->lock, NULL) != 0) {
+		OQS_MEM_insecure_free(signer);
+		return OQS_ERROR;
+	}
+#endif
+	sk->sign_state = signer;
+#endif
+	return OQS_SUCCESS;
+}
+
+static void oqs_lms_signer_free(OQS_SIG_STFL_SECRET_KEY *sk) {
+#ifdef OQS_ALLOW_LMS_KEY_AND_SIG_GEN
+	oqs_lms_signer *signer = sk->sign_state;
+	if (signer == NULL) {
+		return;
+	}
+#if defined(OQS_USE_PTHREADS)
+	pthread_mutex_destroy(&signer->lock);
+#endif
+	hss_free_working_key(signer->w);
+	OQS_MEM_secure_free(signer, sizeof(oqs_lms_signer));
+#endif
+	sk->sign_state = NULL;
+}
+
 void oqs_secret_lms_key_free(OQS_SIG_STFL_SECRET_KEY *sk) {
 	if (sk == NULL) {
 		return;
 	}
 
+	oqs_lms_signer_free(sk);
+
 	if (sk->secret_key_data) {
 		oqs_lms_key_data *key_data = (oqs_lms_key_data *)sk->secret_key_data;
-		if (key_data != NULL) {
+		/* A mapped key belongs to the application */
+		if (key_data != NULL && sk->secure_store_scrt_key_range == NULL) {
 			OQS_MEM_secure_free(key_data->sec_key, key_data->len_sec_key);
 			key_data->sec_key = NULL;
 
@@ -798,6 +1259,59 @@ success:
 	return OQS_SUCCESS;
 }
 
+/*
+ * Use an LMS byte string in application memory in place: sec_key and aux data
+ * point into sk_buf instead of private copies
+ */
+OQS_STATUS oqs_map_lms_key(OQS_SIG_STFL_SECRET_KEY *sk, uint8_t *sk_buf, const size_t sk_len) {
+
+	oqs_lms_key_data *lms_key_data = NULL;
+	size_t lms_sk_len = hss_get_private_key_len((unsigned )(1), NULL, NULL);
+
+	if (sk == NULL || sk_buf == NULL || (sk_len == 0) || (sk_len < lms_sk_len )) {
+		return OQS_ERROR;
+	}
+
+#ifndef OQS_ALLOW_LMS_KEY_AND_SIG_GEN
+	return OQS_ERROR;
+#endif
+
+	if (sk->secret_key_data) {
+		// Key data already present
+		return OQS_ERROR;
+	}
+
+	unsigned levels = 0;
+
+	param_set_t lm_type[ MAX_HSS_LEVELS ];
+	param_set_t lm_ots_type[ MAX_HSS_LEVELS ];
+
+	// validate sk_buf for lms params
+	if (!hss_get_parameter_set(&levels,
+	                           lm_type,
+	                           lm_ots_type,
+	                           NULL,
+	                           (void *)sk_buf)) {
+		return OQS_ERROR;
+	}
+
+	lms_key_data = OQS_MEM_malloc(sizeof(oqs_lms_key_data));
+	if (lms_key_data == NULL) {
+		return OQS_ERROR;
+	}
+	OQS_MEM_cleanse(lms_key_data, sizeof(oqs_lms_key_data));
+
+	lms_key_data->sec_key = sk_buf;
+	lms_key_data->len_sec_key = lms_sk_len;
+	if (sk_len > lms_sk_len) {
+		lms_key_data->aux_data = sk_buf + lms_sk_len;
+		lms_key_data->len_aux_data = sk_len - lms_sk_len;
+	}
+
+	sk->secret_key_data = lms_key_data;
+	return OQS_SUCCESS;
+}
+
 void oqs_lms_key_set_store_cb(OQS_SIG_STFL_SECRET_KEY *sk, secure_store_sk store_cb, void *context) {
 
 	if (sk == NULL) {
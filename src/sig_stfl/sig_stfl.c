@@ -2,9 +2,11 @@
 
 #include <assert.h>
 #include <stdlib.h>
+#include <string.h>
 #if defined(_WIN32)
 #include <string.h>
 #define strcasecmp _stricmp
+#define strncasecmp _strnicmp
 #else
 #include <strings.h>
 #endif
@@ -19,6 +21,8 @@
 #include <oqs/sig_stfl_lms.h>
 #endif // OQS_ENABLE_SIG_STFL_LMS
 
+#include "sig_stfl_verify.h"
+
 OQS_API const char *OQS_SIG_STFL_alg_identifier(size_t i) {
 
 	const char *a[OQS_SIG_STFL_algs_length] = {
@@ -1029,6 +1033,31 @@ OQS_API OQS_STATUS OQS_SIG_STFL_sign(const OQS_SIG_STFL *sig, uint8_t *signature
 #endif
 }
 
+OQS_API OQS_STATUS OQS_SIG_STFL_sign_concurrent(const OQS_SIG_STFL *sig, uint8_t *signature, size_t *signature_len, const uint8_t *message,
+        size_t message_len, OQS_SIG_STFL_SECRET_KEY *secret_key) {
+#ifndef OQS_ALLOW_STFL_KEY_AND_SIG_GEN
+	(void)sig;
+	(void)signature;
+	(void)signature_len;
+	(void)message;
+	(void)message_len;
+	(void)secret_key;
+	return OQS_ERROR;
+#else
+	if (sig == NULL) {
+		return OQS_ERROR;
+	}
+	if (sig->sign_concurrent == NULL) {
+		return OQS_SIG_STFL_sign(sig, signature, signature_len, message, message_len, secret_key);
+	}
+	if (sig->sign_concurrent(signature, signature_len, message, message_len, secret_key) != 0) {
+		return OQS_ERROR;
+	} else {
+		return OQS_SUCCESS;
+	}
+#endif
+}
+
 OQS_API OQS_STATUS OQS_SIG_STFL_verify(const OQS_SIG_STFL *sig, const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key) {
 	if (sig == NULL || sig->verify == NULL || sig->verify(message, message_len, signature, signature_len, public_key) != 0) {
 		return OQS_ERROR;
@@ -1037,6 +1066,393 @@ OQS_API OQS_STATUS OQS_SIG_STFL_verify(const OQS_SIG_STFL *sig, const uint8_t *m
 	}
 }
 
+#ifdef OQS_ALLOW_STFL_KEY_AND_SIG_GEN
+struct OQS_SIG_STFL_SIGN_CTX {
+	const OQS_SIG_STFL *sig;
+	/* Scheme state, NULL once consumed by sign_final */
+	void *state;
+	/* Signature under construction, length_signature bytes */
+	uint8_t *signature;
+};
+#endif //OQS_ALLOW_STFL_KEY_AND_SIG_GEN
+
+struct OQS_SIG_STFL_VERIFY_CTX {
+	OQS_SIG_STFL_VERIFY_ops ops;
+	/* Scheme state, NULL once consumed by verify_final */
+	void *state;
+	uint8_t *signature;
+	size_t signature_len;
+	uint8_t *public_key;
+};
+
+#ifndef OQS_ALLOW_STFL_KEY_AND_SIG_GEN
+/* Streaming verification hooks by algorithm; NULL if the algorithm is not enabled. */
+static const OQS_SIG_STFL_VERIFY_ops *sig_stfl_verify_ops(const char *method_name) {
+#ifdef OQS_ENABLE_SIG_STFL_xmss_sha256_h10
+	if (0 == strcasecmp(method_name, OQS_SIG_STFL_alg_xmss_sha256_h10)) {
+		return OQS_SIG_STFL_alg_xmss_sha256_h10_verify_ops();
+	}
+#endif
+#ifdef OQS_ENABLE_SIG_STFL_xmss_sha256_h16
+	if (0 == strcasecmp(method_name, OQS_SIG_STFL_alg_xmss_sha256_h16)) {
+		return OQS_SIG_STFL_alg_xmss_sha256_h16_verify_ops();
+	}
+#endif
+#ifdef OQS_ENABLE_SIG_STFL_xmss_sha256_h20
+	if (0 == strcasecmp(method_name, OQS_SIG_STFL_alg_xmss_sha256_h20)) {
+		return OQS_SIG_STFL_alg_xmss_sha256_h20_verify_ops();
+	}
+#endif
+#ifdef OQS_ENABLE_SIG_STFL_xmss_shake128_h10
+	if (0 == strcasecmp(method_name, OQS_SIG_STFL_alg_xmss_shake128_h10)) {
+		return OQS_SIG_STFL_alg_xmss_shake128_h10_verify_ops();
+	}
+#endif
+#ifdef OQS_ENABLE_SIG_STFL_xmss_shake128_h16
+	if (0 == strcasecmp(method_name, OQS_SIG_STFL_alg_xmss_shake128_h16)) {
+		return OQS_SIG_STFL_alg_xmss_shake128_h16_verify_ops();
+	}
+#endif
+#ifdef OQS_ENABLE_SIG_STFL_xmss_shake128_h20
+	if (0 == strcasecmp(method_name, OQS_SIG_STFL_alg_xmss_shake128_h20)) {
+		return OQS_SIG_STFL_alg_xmss_shake128_h20_verify_ops();
+	}
+#endif
+#ifdef OQS_ENABLE_SIG_STFL_xmss_sha512_h10
+	if (0 == strcasecmp(method_name, OQS_SIG_STFL_alg_xmss_sha512_h10)) {
+		return OQS_SIG_STFL_alg_xmss_sha512_h10_verify_ops();
+	}
+#endif
+#ifdef OQS_ENABLE_SIG_STFL_xmss_sha512_h16
+	if (0 == strcasecmp(method_name, OQS_SIG_STFL_alg_xmss_sha512_h16)) {
+		return OQS_SIG_STFL_alg_xmss_sha512_h16_verify_ops();
+	}
+#endif
+#ifdef OQS_ENABLE_SIG_STFL_xmss_sha512_h20
+	if (0 == strcasecmp(method_name, OQS_SIG_STFL_alg_xmss_sha512_h20)) {
+		return OQS_SIG_STFL_alg_xmss_sha512_h20_verify_ops();
+	}
+#endif
+#ifdef OQS_ENABLE_SIG_STFL_xmss_shake256_h10
+	if (0 == strcasecmp(method_name, OQS_SIG_STFL_alg_xmss_shake256_h10)) {
+		return OQS_SIG_STFL_alg_xmss_shake256_h10_verify_ops();
+	}
+#endif
+#ifdef OQS_ENABLE_SIG_STFL_xmss_shake256_h16
+	if (0 == strcasecmp(method_name, OQS_SIG_STFL_alg_xmss_shake256_h16)) {
+		return OQS_SIG_STFL_alg_xmss_shake256_h16_verify_ops();
+	}
+#endif
+#ifdef OQS_ENABLE_SIG_STFL_xmss_shake256_h20
+	if (0 == strcasecmp(method_name, OQS_SIG_STFL_alg_xmss_shake256_h20)) {
+		return OQS_SIG_STFL_alg_xmss_shake256_h20_verify_ops();
+	}
+#endif
+#ifdef OQS_ENABLE_SIG_STFL_xmss_sha256_h10_192
+	if (0 == strcasecmp(method_name, OQS_SIG_STFL_alg_xmss_sha256_h10_192)) {
+		return OQS_SIG_STFL_alg_xmss_sha256_h10_192_verify_ops();
+	}
+#endif
+#ifdef OQS_ENABLE_SIG_STFL_xmss_sha256_h16_192
+	if (0 == strcasecmp(method_name, OQS_SIG_STFL_alg_xmss_sha256_h16_192)) {
+		return OQS_SIG_STFL_alg_xmss_sha256_h16_192_verify_ops();
+	}
+#endif
+#ifdef OQS_ENABLE_SIG_STFL_xmss_sha256_h20_192
+	if (0 == strcasecmp(method_name, OQS_SIG_STFL_alg_xmss_sha256_h20_192)) {
+		return OQS_SIG_STFL_alg_xmss_sha256_h20_192_verify_ops();
+	}
+#endif
+#ifdef OQS_ENABLE_SIG_STFL_xmss_shake256_h10_192
+	if (0 == strcasecmp(method_name, OQS_SIG_STFL_alg_xmss_shake256_h10_192)) {
+		return OQS_SIG_STFL_alg_xmss_shake256_h10_192_verify_ops();
+	}
+#endif
+#ifdef OQS_ENABLE_SIG_STFL_xmss_shake256_h16_192
+	if (0 == strcasecmp(method_name, OQS_SIG_STFL_alg_xmss_shake256_h16_192)) {
+		return OQS_SIG_STFL_alg_xmss_shake256_h16_192_verify_ops();
+	}
+#endif
+#ifdef OQS_ENABLE_SIG_STFL_xmss_shake256_h20_192
+	if (0 == strcasecmp(method_name, OQS_SIG_STFL_alg_xmss_shake256_h20_192)) {
+		return OQS_SIG_STFL_alg_xmss_shake256_h20_192_verify_ops();
+	}
+#endif
+#ifdef OQS_ENABLE_SIG_STFL_xmss_shake256_h10_256
+	if (0 == strcasecmp(method_name, OQS_SIG_STFL_alg_xmss_shake256_h10_256)) {
+		return OQS_SIG_STFL_alg_xmss_shake256_h10_256_verify_ops();
+	}
+#endif
+#ifdef OQS_ENABLE_SIG_STFL_xmss_shake256_h16_256
+	if (0 == strcasecmp(method_name, OQS_SIG_STFL_alg_xmss_shake256_h16_256)) {
+		return OQS_SIG_STFL_alg_xmss_shake256_h16_256_verify_ops();
+	}
+#endif
+#ifdef OQS_ENABLE_SIG_STFL_xmss_shake256_h20_256
+	if (0 == strcasecmp(method_name, OQS_SIG_STFL_alg_xmss_shake256_h20_256)) {
+		return OQS_SIG_STFL_alg_xmss_shake256_h20_256_verify_ops();
+	}
+#endif
+#ifdef OQS_ENABLE_SIG_STFL_xmssmt_sha256_h20_2
+	if (0 == strcasecmp(method_name, OQS_SIG_STFL_alg_xmssmt_sha256_h20_2)) {
+		return OQS_SIG_STFL_alg_xmssmt_sha256_h20_2_verify_ops();
+	}
+#endif
+#ifdef OQS_ENABLE_SIG_STFL_xmssmt_sha256_h20_4
+	if (0 == strcasecmp(method_name, OQS_SIG_STFL_alg_xmssmt_sha256_h20_4)) {
+		return OQS_SIG_STFL_alg_xmssmt_sha256_h20_4_verify_ops();
+	}
+#endif
+#ifdef OQS_ENABLE_SIG_STFL_xmssmt_sha256_h40_2
+	if (0 == strcasecmp(method_name, OQS_SIG_STFL_alg_xmssmt_sha256_h40_2)) {
+		return OQS_SIG_STFL_alg_xmssmt_sha256_h40_2_verify_ops();
+	}
+#endif
+#ifdef OQS_ENABLE_SIG_STFL_xmssmt_sha256_h40_4
+	if (0 == strcasecmp(method_name, OQS_SIG_STFL_alg_xmssmt_sha256_h40_4)) {
+		return OQS_SIG_STFL_alg_xmssmt_sha256_h40_4_verify_ops();
+	}
+#endif
+#ifdef OQS_ENABLE_SIG_STFL_xmssmt_sha256_h40_8
+	if (0 == strcasecmp(method_name, OQS_SIG_STFL_alg_xmssmt_sha256_h40_8)) {
+		return OQS_SIG_STFL_alg_xmssmt_sha256_h40_8_verify_ops();
+	}
+#endif
+#ifdef OQS_ENABLE_SIG_STFL_xmssmt_sha256_h60_3
+	if (0 == strcasecmp(method_name, OQS_SIG_STFL_alg_xmssmt_sha256_h60_3)) {
+		return OQS_SIG_STFL_alg_xmssmt_sha256_h60_3_verify_ops();
+	}
+#endif
+#ifdef OQS_ENABLE_SIG_STFL_xmssmt_sha256_h60_6
+	if (0 == strcasecmp(method_name, OQS_SIG_STFL_alg_xmssmt_sha256_h60_6)) {
+		return OQS_SIG_STFL_alg_xmssmt_sha256_h60_6_verify_ops();
+	}
+#endif
+#ifdef OQS_ENABLE_SIG_STFL_xmssmt_sha256_h60_12
+	if (0 == strcasecmp(method_name, OQS_SIG_STFL_alg_xmssmt_sha256_h60_12)) {
+		return OQS_SIG_STFL_alg_xmssmt_sha256_h60_12_verify_ops();
+	}
+#endif
+#ifdef OQS_ENABLE_SIG_STFL_xmssmt_shake128_h20_2
+	if (0 == strcasecmp(method_name, OQS_SIG_STFL_alg_xmssmt_shake128_h20_2)) {
+		return OQS_SIG_STFL_alg_xmssmt_shake128_h20_2_verify_ops();
+	}
+#endif
+#ifdef OQS_ENABLE_SIG_STFL_xmssmt_shake128_h20_4
+	if (0 == strcasecmp(method_name, OQS_SIG_STFL_alg_xmssmt_shake128_h20_4)) {
+		return OQS_SIG_STFL_alg_xmssmt_shake128_h20_4_verify_ops();
+	}
+#endif
+#ifdef OQS_ENABLE_SIG_STFL_xmssmt_shake128_h40_2
+	if (0 == strcasecmp(method_name, OQS_SIG_STFL_alg_xmssmt_shake128_h40_2)) {
+		return OQS_SIG_STFL_alg_xmssmt_shake128_h40_2_verify_ops();
+	}
+#endif
+#ifdef OQS_ENABLE_SIG_STFL_xmssmt_shake128_h40_4
+	if (0 == strcasecmp(method_name, OQS_SIG_STFL_alg_xmssmt_shake128_h40_4)) {
+		return OQS_SIG_STFL_alg_xmssmt_shake128_h40_4_verify_ops();
+	}
+#endif
+#ifdef OQS_ENABLE_SIG_STFL_xmssmt_shake128_h40_8
+	if (0 == strcasecmp(method_name, OQS_SIG_STFL_alg_xmssmt_shake128_h40_8)) {
+		return OQS_SIG_STFL_alg_xmssmt_shake128_h40_8_verify_ops();
+	}
+#endif
+#ifdef OQS_ENABLE_SIG_STFL_xmssmt_shake128_h60_3
+	if (0 == strcasecmp(method_name, OQS_SIG_STFL_alg_xmssmt_shake128_h60_3)) {
+		return OQS_SIG_STFL_alg_xmssmt_shake128_h60_3_verify_ops();
+	}
+#endif
+#ifdef OQS_ENABLE_SIG_STFL_xmssmt_shake128_h60_6
+	if (0 == strcasecmp(method_name, OQS_SIG_STFL_alg_xmssmt_shake128_h60_6)) {
+		return OQS_SIG_STFL_alg_xmssmt_shake128_h60_6_verify_ops();
+	}
+#endif
+#ifdef OQS_ENABLE_SIG_STFL_xmssmt_shake128_h60_12
+	if (0 == strcasecmp(method_name, OQS_SIG_STFL_alg_xmssmt_shake128_h60_12)) {
+		return OQS_SIG_STFL_alg_xmssmt_shake128_h60_12_verify_ops();
+	}
+#endif
+#ifdef OQS_ENABLE_SIG_STFL_LMS
+	if (0 == strncasecmp(method_name, "LMS_", 4)) {
+		return OQS_SIG_STFL_alg_lms_verify_ops();
+	}
+#endif
+	(void)method_name; // unused if no stateful algorithm is enabled
+	return NULL;
+}
+#endif //OQS_ALLOW_STFL_KEY_AND_SIG_GEN
+
+static OQS_STATUS sig_stfl_verify_ops_get(const OQS_SIG_STFL *sig, OQS_SIG_STFL_VERIFY_ops *ops) {
+#ifdef OQS_ALLOW_STFL_KEY_AND_SIG_GEN
+	ops->init = sig->verify_init;
+	ops->update = sig->verify_update;
+	ops->final = sig->verify_final;
+	ops->abort = sig->verify_abort;
+#else
+	const OQS_SIG_STFL_VERIFY_ops *found = sig->method_name == NULL ? NULL : sig_stfl_verify_ops(sig->method_name);
+
+	if (found == NULL) {
+		return OQS_ERROR;
+	}
+	*ops = *found;
+#endif //OQS_ALLOW_STFL_KEY_AND_SIG_GEN
+	if (ops->init == NULL || ops->update == NULL || ops->final == NULL || ops->abort == NULL) {
+		return OQS_ERROR;
+	}
+	return OQS_SUCCESS;
+}
+
+OQS_API OQS_STATUS OQS_SIG_STFL_sign_init(const OQS_SIG_STFL *sig, OQS_SIG_STFL_SIGN_CTX **ctx, OQS_SIG_STFL_SECRET_KEY *secret_key) {
+#ifndef OQS_ALLOW_STFL_KEY_AND_SIG_GEN
+	(void)sig;
+	(void)ctx;
+	(void)secret_key;
+	return OQS_ERROR;
+#else
+	OQS_SIG_STFL_SIGN_CTX *c;
+
+	if (sig == NULL || ctx == NULL || sig->sign_init == NULL) {
+		return OQS_ERROR;
+	}
+	c = OQS_MEM_malloc(sizeof(OQS_SIG_STFL_SIGN_CTX));
+	if (c == NULL) {
+		return OQS_ERROR;
+	}
+	c->sig = sig;
+	c->state = NULL;
+	c->signature = OQS_MEM_malloc(sig->length_signature);
+	if (c->signature == NULL) {
+		OQS_MEM_insecure_free(c);
+		return OQS_ERROR;
+	}
+	if (sig->sign_init(&c->state, c->signature, secret_key) != OQS_SUCCESS) {
+		OQS_MEM_insecure_free(c->signature);
+		OQS_MEM_insecure_free(c);
+		return OQS_ERROR;
+	}
+	*ctx = c;
+	return OQS_SUCCESS;
+#endif //OQS_ALLOW_STFL_KEY_AND_SIG_GEN
+}
+
+OQS_API OQS_STATUS OQS_SIG_STFL_sign_update(OQS_SIG_STFL_SIGN_CTX *ctx, const uint8_t *message, size_t message_len) {
+#ifndef OQS_ALLOW_STFL_KEY_AND_SIG_GEN
+	(void)ctx;
+	(void)message;
+	(void)message_len;
+	return OQS_ERROR;
+#else
+	if (ctx == NULL || ctx->state == NULL || (message == NULL && message_len != 0)) {
+		return OQS_ERROR;
+	}
+	return ctx->sig->sign_update(ctx->state, message, message_len);
+#endif //OQS_ALLOW_STFL_KEY_AND_SIG_GEN
+}
+
+OQS_API OQS_STATUS OQS_SIG_STFL_sign_final(OQS_SIG_STFL_SIGN_CTX *ctx, uint8_t *signature, size_t *signature_len) {
+#ifndef OQS_ALLOW_STFL_KEY_AND_SIG_GEN
+	(void)ctx;
+	(void)signature;
+	(void)signature_len;
+	return OQS_ERROR;
+#else
+	OQS_STATUS status;
+	size_t len = 0;
+
+	if (ctx == NULL || ctx->state == NULL || signature == NULL || signature_len == NULL) {
+		return OQS_ERROR;
+	}
+	status = ctx->sig->sign_final(ctx->state, ctx->signature, &len);
+	ctx->state = NULL;
+	if (status != OQS_SUCCESS || len > ctx->sig->length_signature) {
+		return OQS_ERROR;
+	}
+	memcpy(signature, ctx->signature, len);
+	*signature_len = len;
+	return OQS_SUCCESS;
+#endif //OQS_ALLOW_STFL_KEY_AND_SIG_GEN
+}
+
+OQS_API void OQS_SIG_STFL_SIGN_CTX_free(OQS_SIG_STFL_SIGN_CTX *ctx) {
+#ifndef OQS_ALLOW_STFL_KEY_AND_SIG_GEN
+	(void)ctx;
+#else
+	if (ctx == NULL) {
+		return;
+	}
+	if (ctx->state != NULL) {
+		ctx->sig->sign_abort(ctx->state);
+	}
+	OQS_MEM_insecure_free(ctx->signature);
+	OQS_MEM_insecure_free(ctx);
+#endif //OQS_ALLOW_STFL_KEY_AND_SIG_GEN
+}
+
+OQS_API OQS_STATUS OQS_SIG_STFL_verify_init(const OQS_SIG_STFL *sig, OQS_SIG_STFL_VERIFY_CTX **ctx, const uint8_t *signature, size_t signature_len, const uint8_t *public_key) {
+	OQS_SIG_STFL_VERIFY_CTX *c;
+
+	if (sig == NULL || ctx == NULL || signature == NULL || public_key == NULL) {
+		return OQS_ERROR;
+	}
+	c = OQS_MEM_calloc(1, sizeof(OQS_SIG_STFL_VERIFY_CTX));
+	if (c == NULL) {
+		return OQS_ERROR;
+	}
+	if (sig_stfl_verify_ops_get(sig, &c->ops) != OQS_SUCCESS) {
+		goto err;
+	}
+	c->signature_len = signature_len;
+	c->signature = OQS_MEM_malloc(signature_len == 0 ? 1 : signature_len);
+	c->public_key = OQS_MEM_malloc(sig->length_public_key);
+	if (c->signature == NULL || c->public_key == NULL) {
+		goto err;
+	}
+	memcpy(c->signature, signature, signature_len);
+	memcpy(c->public_key, public_key, sig->length_public_key);
+	if (c->ops.init(&c->state, c->signature, c->signature_len, c->public_key) != OQS_SUCCESS) {
+		goto err;
+	}
+	*ctx = c;
+	return OQS_SUCCESS;
+
+err:
+	OQS_MEM_insecure_free(c->signature);
+	OQS_MEM_insecure_free(c->public_key);
+	OQS_MEM_insecure_free(c);
+	return OQS_ERROR;
+}
+
+OQS_API OQS_STATUS OQS_SIG_STFL_verify_update(OQS_SIG_STFL_VERIFY_CTX *ctx, const uint8_t *message, size_t message_len) {
+	if (ctx == NULL || ctx->state == NULL || (message == NULL && message_len != 0)) {
+		return OQS_ERROR;
+	}
+	return ctx->ops.update(ctx->state, message, message_len);
+}
+
+OQS_API OQS_STATUS OQS_SIG_STFL_verify_final(OQS_SIG_STFL_VERIFY_CTX *ctx) {
+	OQS_STATUS status;
+
+	if (ctx == NULL || ctx->state == NULL) {
+		return OQS_ERROR;
+	}
+	status = ctx->ops.final(ctx->state, ctx->signature, ctx->signature_len, ctx->public_key);
+	ctx->state = NULL;
+	return status == OQS_SUCCESS ? OQS_SUCCESS : OQS_ERROR;
+}
+
+OQS_API void OQS_SIG_STFL_VERIFY_CTX_free(OQS_SIG_STFL_VERIFY_CTX *ctx) {
+	if (ctx == NULL) {
+		return;
+	}
+	if (ctx->state != NULL) {
+		ctx->ops.abort(ctx->state);
+	}
+	OQS_MEM_insecure_free(ctx->signature);
+	OQS_MEM_insecure_free(ctx->public_key);
+	OQS_MEM_insecure_free(ctx);
+}
+
 OQS_API OQS_STATUS OQS_SIG_STFL_sigs_remaining(const OQS_SIG_STFL *sig, unsigned long long *remain, const OQS_SIG_STFL_SECRET_KEY *secret_key) {
 #ifndef OQS_ALLOW_STFL_KEY_AND_SIG_GEN
 	(void)sig;
@@ -1546,6 +1962,21 @@ OQS_API OQS_STATUS OQS_SIG_STFL_SECRET_KEY_deserialize(OQS_SIG_STFL_SECRET_KEY *
 	return sk->deserialize_key(sk, sk_buf, sk_buf_len, context);
 }
 
+/* Operate on a serialized secret key in application memory */
+OQS_API OQS_STATUS OQS_SIG_STFL_SECRET_KEY_map(OQS_SIG_STFL_SECRET_KEY *sk, uint8_t *sk_buf, size_t sk_buf_len, secure_store_sk_range store_range_cb, void *context) {
+	if (sk == NULL || sk_buf == NULL || store_range_cb == NULL || sk->map_key == NULL || sk->secure_store_scrt_key_range != NULL) {
+		return OQS_ERROR;
+	}
+
+	if (sk->map_key(sk, sk_buf, sk_buf_len) != OQS_SUCCESS) {
+		return OQS_ERROR;
+	}
+	sk->secure_store_scrt_key_range = store_range_cb;
+	sk->context = context;
+
+	return OQS_SUCCESS;
+}
+
 /*  OQS_SIG_STFL_SECRET_KEY_SET_lock callback function*/
 OQS_API void OQS_SIG_STFL_SECRET_KEY_SET_lock(OQS_SIG_STFL_SECRET_KEY *sk, lock_key lock) {
 	if (sk == NULL) {
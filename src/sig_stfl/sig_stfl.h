@@ -203,6 +203,12 @@ extern "C"
 
 typedef struct OQS_SIG_STFL_SECRET_KEY OQS_SIG_STFL_SECRET_KEY;
 
+/** Context of a streaming signature, see OQS_SIG_STFL_sign_init() */
+typedef struct OQS_SIG_STFL_SIGN_CTX OQS_SIG_STFL_SIGN_CTX;
+
+/** Context of a streaming verification, see OQS_SIG_STFL_verify_init() */
+typedef struct OQS_SIG_STFL_VERIFY_CTX OQS_SIG_STFL_VERIFY_CTX;
+
 /**
  * Application provided function to securely store data
  * @param[in] sk_buf pointer to the data to be saved
@@ -212,6 +218,17 @@ typedef struct OQS_SIG_STFL_SECRET_KEY OQS_SIG_STFL_SECRET_KEY;
  */
 typedef OQS_STATUS (*secure_store_sk)(uint8_t *sk_buf, size_t buf_len, void *context);
 
+/**
+ * Application provided function to persist bytes of a secret key that lives in application
+ * memory, see OQS_SIG_STFL_SECRET_KEY_map()
+ * @param[in] sk_buf pointer to the memory holding the serialized secret key
+ * @param[in] offset offset in sk_buf of the first modified byte
+ * @param[in] len number of modified bytes starting at offset
+ * @param[out] context pass back application data related to secret key data storage.
+ * return OQS_SUCCESS if successful, otherwise OQS_ERROR
+ */
+typedef OQS_STATUS (*secure_store_sk_range)(const uint8_t *sk_buf, size_t offset, size_t len, void *context);
+
 /**
  * Application provided function to lock secret key object serialize access
  * @param[in] mutex pointer to mutex struct
@@ -367,6 +384,102 @@ typedef struct OQS_SIG_STFL {
 	 */
 	OQS_STATUS (*sigs_total)(unsigned long long *total, const OQS_SIG_STFL_SECRET_KEY *secret_key);
 
+	/**
+	 * Signature generation that holds the secret key lock only while reserving a one-time key.
+	 *
+	 * Same interface and output as `sign`. The tree traversal runs on the working copy in
+	 * `sign_state`; only copying the result into the secret key and storing it run under the
+	 * lock, and the one-time signature on the message is computed after the lock is released.
+	 * May be NULL, in which case `sign` is used.
+	 *
+	 * @param[out] signature The signature on the message is represented as a byte string.
+	 * @param[out] signature_len The length of the signature.
+	 * @param[in] message The message to sign is represented as a byte string.
+	 * @param[in] message_len The length of the message to sign.
+	 * @param[in] secret_key The secret key object pointer.
+	 * @return OQS_SUCCESS or OQS_ERROR
+	 */
+	OQS_STATUS (*sign_concurrent)(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, OQS_SIG_STFL_SECRET_KEY *secret_key);
+
+	/**
+	 * Start a streaming signature: reserve and store the next one-time key like `sign_concurrent`
+	 * and allocate the signing state. May be NULL if the scheme cannot sign a message in pieces.
+	 *
+	 * @param[out] state The signing state, consumed by `sign_final` or `sign_abort`.
+	 * @param[out] signature A buffer of `length_signature` bytes for the signature, which the scheme
+	 *                       may fill in part; the same buffer is passed to `sign_final`.
+	 * @param[in] secret_key The secret key object pointer.
+	 * @return OQS_SUCCESS or OQS_ERROR
+	 */
+	OQS_STATUS (*sign_init)(void **state, uint8_t *signature, OQS_SIG_STFL_SECRET_KEY *secret_key);
+
+	/**
+	 * Absorb the next piece of the message of a streaming signature.
+	 *
+	 * @param[in] state The signing state.
+	 * @param[in] message The next piece of the message.
+	 * @param[in] message_len The length of the piece.
+	 * @return OQS_SUCCESS or OQS_ERROR
+	 */
+	OQS_STATUS (*sign_update)(void *state, const uint8_t *message, size_t message_len);
+
+	/**
+	 * Complete a streaming signature and free the signing state.
+	 *
+	 * @param[in] state The signing state.
+	 * @param[in,out] signature The buffer that was passed to `sign_init`.
+	 * @param[out] signature_len The length of the signature.
+	 * @return OQS_SUCCESS or OQS_ERROR
+	 */
+	OQS_STATUS (*sign_final)(void *state, uint8_t *signature, size_t *signature_len);
+
+	/**
+	 * Free the state of a streaming signature that is not completed.
+	 *
+	 * @param[in] state The signing state.
+	 */
+	void (*sign_abort)(void *state);
+
+	/**
+	 * Start a streaming verification of a signature. May be NULL if the scheme cannot verify a
+	 * message in pieces.
+	 *
+	 * @param[out] state The verification state, consumed by `verify_final` or `verify_abort`.
+	 * @param[in] signature The signature.
+	 * @param[in] signature_len The length of the signature.
+	 * @param[in] public_key The public key.
+	 * @return OQS_SUCCESS or OQS_ERROR
+	 */
+	OQS_STATUS (*verify_init)(void **state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+
+	/**
+	 * Absorb the next piece of the message of a streaming verification.
+	 *
+	 * @param[in] state The verification state.
+	 * @param[in] message The next piece of the message.
+	 * @param[in] message_len The length of the piece.
+	 * @return OQS_SUCCESS or OQS_ERROR
+	 */
+	OQS_STATUS (*verify_update)(void *state, const uint8_t *message, size_t message_len);
+
+	/**
+	 * Complete a streaming verification and free the verification state.
+	 *
+	 * @param[in] state The verification state.
+	 * @param[in] signature The signature that was passed to `verify_init`.
+	 * @param[in] signature_len The length of the signature.
+	 * @param[in] public_key The public key that was passed to `verify_init`.
+	 * @return OQS_SUCCESS if the signature is valid, otherwise OQS_ERROR
+	 */
+	OQS_STATUS (*verify_final)(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+
+	/**
+	 * Free the state of a streaming verification that is not completed.
+	 *
+	 * @param[in] state The verification state.
+	 */
+	void (*verify_abort)(void *state);
+
 } OQS_SIG_STFL;
 #endif //OQS_ALLOW_STFL_KEY_AND_SIG_GEN
 
@@ -484,6 +597,41 @@ typedef struct OQS_SIG_STFL_SECRET_KEY {
 	 * @return None.
 	 */
 	void (*set_scrt_key_store_cb)(OQS_SIG_STFL_SECRET_KEY *sk, secure_store_sk store_cb, void *context);
+
+	/**
+	 * Store Secret Key Range Function
+	 *
+	 * Set by OQS_SIG_STFL_SECRET_KEY_map(). When populated, the secret key data lives in
+	 * application memory and is updated in place; after a signature generation this function
+	 * is called for each modified byte range instead of `secure_store_scrt_key`.
+	 * @param[in] sk_buf The application memory holding the serialized secret key
+	 * @param[in] offset Offset of the first modified byte
+	 * @param[in] len Number of modified bytes
+	 * @param[in] context application supplied data (passed in at the time the key was mapped).
+	 *
+	 * @return OQS_SUCCESS or OQS_ERROR
+	 */
+	OQS_STATUS (*secure_store_scrt_key_range)(const uint8_t *sk_buf, size_t offset, size_t len, void *context);
+
+	/**
+	 * Map Secret Key Function
+	 *
+	 * Makes the variant-specific secret key data use the serialized secret key in `sk_buf`
+	 * in place instead of a private copy. May be NULL if the variant does not support it.
+	 *
+	 * @param[in] sk The secret key represented as OQS_SIG_STFL_SECRET_KEY object.
+	 * @param[in] sk_buf The application memory holding the serialized secret key.
+	 * @param[in] sk_buf_len The length of the serialized secret key.
+	 * @return OQS_SUCCESS or OQS_ERROR
+	 */
+	OQS_STATUS (*map_key)(OQS_SIG_STFL_SECRET_KEY *sk, uint8_t *sk_buf, size_t sk_buf_len);
+
+	/**
+	 * Variant-specific signing state kept across signatures, e.g. a working copy of the key on
+	 * which OQS_SIG_STFL_sign_concurrent() advances the tree traversal outside `lock_key`.
+	 * Allocated with the key and released by `free_key`; not part of the serialized key.
+	 */
+	void *sign_state;
 } OQS_SIG_STFL_SECRET_KEY;
 
 /**
@@ -536,6 +684,119 @@ OQS_API OQS_STATUS OQS_SIG_STFL_keypair(const OQS_SIG_STFL *sig, uint8_t *public
  */
 OQS_API OQS_STATUS OQS_SIG_STFL_sign(const OQS_SIG_STFL *sig, uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, OQS_SIG_STFL_SECRET_KEY *secret_key);
 
+/**
+ * Signature generation for several threads signing with one secret key.
+ *
+ * Produces the same signatures as OQS_SIG_STFL_sign(), but the secret key lock is only
+ * held while the advanced index and tree state are copied into the secret key and passed
+ * to the store callback. The tree traversal runs on a working copy of the key kept with
+ * the secret key object, one signer at a time, and the one-time signature on the message,
+ * which is most of the work, is computed after the lock is released, so signers sharing a
+ * key run in parallel. Changes made to the secret key by other means, e.g. by
+ * OQS_SIG_STFL_sign(), are picked up by the next call.
+ *
+ * As the index is stored before the signature exists, a failure after the reservation
+ * consumes a one-time key without producing a signature.
+ *
+ * @param[in] sig The OQS_SIG_STFL object representing the signature scheme.
+ * @param[out] signature The signature on the message is represented as a byte string.
+ * @param[out] signature_len The length of the signature.
+ * @param[in] message The message to sign is represented as a byte string.
+ * @param[in] message_len The length of the message to sign.
+ * @param[in] secret_key The secret key object pointer.
+ * @return OQS_SUCCESS or OQS_ERROR
+ *
+ * @note Concurrent calls on one secret key require the `lock/unlock` functions and `mutex` to be set.
+ */
+OQS_API OQS_STATUS OQS_SIG_STFL_sign_concurrent(const OQS_SIG_STFL *sig, uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, OQS_SIG_STFL_SECRET_KEY *secret_key);
+
+/**
+ * Start signing a message that is passed in pieces, such as a large file.
+ *
+ * The next one-time key is reserved and the updated secret key is passed to the store callback
+ * before this returns, as in OQS_SIG_STFL_sign_concurrent(); the secret key is not accessed
+ * afterwards. Pass the message to OQS_SIG_STFL_sign_update() in any number of pieces, obtain the
+ * signature with OQS_SIG_STFL_sign_final() and release the context with OQS_SIG_STFL_SIGN_CTX_free().
+ * A context that is freed without OQS_SIG_STFL_sign_final() consumes a one-time key without
+ * producing a signature.
+ *
+ * The signature is the same as OQS_SIG_STFL_sign() produces for the concatenated pieces.
+ *
+ * @param[in] sig The OQS_SIG_STFL object representing the signature scheme.
+ * @param[out] ctx The new signing context.
+ * @param[in] secret_key The secret key object pointer.
+ * @return OQS_SUCCESS or OQS_ERROR
+ */
+OQS_API OQS_STATUS OQS_SIG_STFL_sign_init(const OQS_SIG_STFL *sig, OQS_SIG_STFL_SIGN_CTX **ctx, OQS_SIG_STFL_SECRET_KEY *secret_key);
+
+/**
+ * Pass the next piece of the message to a streaming signature.
+ *
+ * @param[in] ctx The signing context.
+ * @param[in] message The next piece of the message.
+ * @param[in] message_len The length of the piece.
+ * @return OQS_SUCCESS or OQS_ERROR
+ */
+OQS_API OQS_STATUS OQS_SIG_STFL_sign_update(OQS_SIG_STFL_SIGN_CTX *ctx, const uint8_t *message, size_t message_len);
+
+/**
+ * Complete a streaming signature. The context can then only be freed.
+ *
+ * @param[in] ctx The signing context.
+ * @param[out] signature The signature, a buffer of at least `length_signature` bytes.
+ * @param[out] signature_len The length of the signature.
+ * @return OQS_SUCCESS or OQS_ERROR
+ */
+OQS_API OQS_STATUS OQS_SIG_STFL_sign_final(OQS_SIG_STFL_SIGN_CTX *ctx, uint8_t *signature, size_t *signature_len);
+
+/**
+ * Free a streaming signing context.
+ *
+ * @param[in] ctx The signing context, may be NULL.
+ */
+OQS_API void OQS_SIG_STFL_SIGN_CTX_free(OQS_SIG_STFL_SIGN_CTX *ctx);
+
+/**
+ * Start verifying a signature on a message that is passed in pieces.
+ *
+ * Pass the message to OQS_SIG_STFL_verify_update() in any number of pieces, check the signature
+ * with OQS_SIG_STFL_verify_final() and release the context with OQS_SIG_STFL_VERIFY_CTX_free().
+ * The signature and public key are copied into the context.
+ *
+ * @param[in] sig The OQS_SIG_STFL object representing the signature scheme.
+ * @param[out] ctx The new verification context.
+ * @param[in] signature The signature.
+ * @param[in] signature_len The length of the signature.
+ * @param[in] public_key The public key.
+ * @return OQS_SUCCESS or OQS_ERROR
+ */
+OQS_API OQS_STATUS OQS_SIG_STFL_verify_init(const OQS_SIG_STFL *sig, OQS_SIG_STFL_VERIFY_CTX **ctx, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+
+/**
+ * Pass the next piece of the message to a streaming verification.
+ *
+ * @param[in] ctx The verification context.
+ * @param[in] message The next piece of the message.
+ * @param[in] message_len The length of the piece.
+ * @return OQS_SUCCESS or OQS_ERROR
+ */
+OQS_API OQS_STATUS OQS_SIG_STFL_verify_update(OQS_SIG_STFL_VERIFY_CTX *ctx, const uint8_t *message, size_t message_len);
+
+/**
+ * Complete a streaming verification. The context can then only be freed.
+ *
+ * @param[in] ctx The verification context.
+ * @return OQS_SUCCESS if the signature is valid, otherwise OQS_ERROR
+ */
+OQS_API OQS_STATUS OQS_SIG_STFL_verify_final(OQS_SIG_STFL_VERIFY_CTX *ctx);
+
+/**
+ * Free a streaming verification context.
+ *
+ * @param[in] ctx The verification context, may be NULL.
+ */
+OQS_API void OQS_SIG_STFL_VERIFY_CTX_free(OQS_SIG_STFL_VERIFY_CTX *ctx);
+
 /**
  * Signature verification algorithm.
  *
@@ -732,6 +993,38 @@ OQS_API OQS_STATUS OQS_SIG_STFL_SECRET_KEY_serialize(uint8_t **sk_buf_ptr, size_
  */
 OQS_API OQS_STATUS OQS_SIG_STFL_SECRET_KEY_deserialize(OQS_SIG_STFL_SECRET_KEY *sk, const uint8_t *sk_buf, size_t sk_buf_len, void *context);
 
+/**
+ * Use a serialized secret key in application memory, such as a memory-mapped file, in place.
+ *
+ * Instead of holding a private copy of the key, `sk` operates directly on `sk_buf`, which must
+ * hold a secret key as produced by OQS_SIG_STFL_SECRET_KEY_serialize(). Signature generation
+ * then updates the index and traversal state in `sk_buf` in place and calls `store_range_cb`
+ * for each modified byte range, e.g. to `msync` the pages concerned, instead of passing the
+ * whole serialized key to the callback set with OQS_SIG_STFL_SECRET_KEY_SET_store_cb().
+ * For most signatures only a few bytes change.
+ *
+ * LMS signing only changes the counter. XMSS signing also updates the tree traversal state;
+ * there the advanced index is passed to `store_range_cb` before any other byte of `sk_buf` is
+ * modified, and if the callback fails, signing fails without touching the rest of the key.
+ * As `sk_buf` is updated in place, a process that stops during signing, or memory written back
+ * before the last `store_range_cb` call, can leave a partially updated traversal state behind.
+ * Its index never allows a one-time key to be used twice, but later signatures from such a key
+ * may not verify. Applications that must recover from this should keep a copy of the key.
+ *
+ * The key object must be fresh: not generated into, deserialized or mapped before.
+ *
+ * @param[in] sk Pointer to a new stateful secret key object.
+ * @param[in] sk_buf The application memory holding the serialized secret key.
+ * @param[in] sk_buf_len The length of the serialized secret key in bytes.
+ * @param[in] store_range_cb Callback function that persists modified ranges of `sk_buf`.
+ * @param[in] context Application-specific context passed to `store_range_cb`.
+ * @return OQS_SUCCESS if the key was mapped; otherwise, OQS_ERROR.
+ *
+ * @attention `sk_buf` is owned by the application and must stay valid until the key object is
+ *            freed with OQS_SIG_STFL_SECRET_KEY_free(), which does not clear or release it.
+ */
+OQS_API OQS_STATUS OQS_SIG_STFL_SECRET_KEY_map(OQS_SIG_STFL_SECRET_KEY *sk, uint8_t *sk_buf, size_t sk_buf_len, secure_store_sk_range store_range_cb, void *context);
+
 #if defined(__cplusplus)
 // extern "C"
 }
@@ -0,0 +1,144 @@
+// SPDX-License-Identifier: MIT
+
+/*
+ * Internal per-algorithm hooks behind OQS_SIG_STFL_verify_init(). Not installed.
+ */
+
+#ifndef OQS_SIG_STFL_VERIFY_INTERNAL_H
+#define OQS_SIG_STFL_VERIFY_INTERNAL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <oqs/oqs.h>
+
+/*
+ * Streaming verification hooks, with the semantics of the verify_* members of
+ * OQS_SIG_STFL. Builds without OQS_ALLOW_STFL_KEY_AND_SIG_GEN have no such
+ * members (OQS_SIG_STFL is then an OQS_SIG), so the generic code finds the
+ * hooks through the functions below instead.
+ */
+typedef struct OQS_SIG_STFL_VERIFY_ops {
+	OQS_STATUS (*init)(void **state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+	OQS_STATUS (*update)(void *state, const uint8_t *message, size_t message_len);
+	OQS_STATUS (*final)(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+	void (*abort)(void *state);
+} OQS_SIG_STFL_VERIFY_ops;
+
+#if defined(OQS_ENABLE_SIG_STFL_xmss_sha256_h10)
+const OQS_SIG_STFL_VERIFY_ops *OQS_SIG_STFL_alg_xmss_sha256_h10_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_STFL_xmss_sha256_h16)
+const OQS_SIG_STFL_VERIFY_ops *OQS_SIG_STFL_alg_xmss_sha256_h16_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_STFL_xmss_sha256_h20)
+const OQS_SIG_STFL_VERIFY_ops *OQS_SIG_STFL_alg_xmss_sha256_h20_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_STFL_xmss_shake128_h10)
+const OQS_SIG_STFL_VERIFY_ops *OQS_SIG_STFL_alg_xmss_shake128_h10_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_STFL_xmss_shake128_h16)
+const OQS_SIG_STFL_VERIFY_ops *OQS_SIG_STFL_alg_xmss_shake128_h16_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_STFL_xmss_shake128_h20)
+const OQS_SIG_STFL_VERIFY_ops *OQS_SIG_STFL_alg_xmss_shake128_h20_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_STFL_xmss_sha512_h10)
+const OQS_SIG_STFL_VERIFY_ops *OQS_SIG_STFL_alg_xmss_sha512_h10_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_STFL_xmss_sha512_h16)
+const OQS_SIG_STFL_VERIFY_ops *OQS_SIG_STFL_alg_xmss_sha512_h16_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_STFL_xmss_sha512_h20)
+const OQS_SIG_STFL_VERIFY_ops *OQS_SIG_STFL_alg_xmss_sha512_h20_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_STFL_xmss_shake256_h10)
+const OQS_SIG_STFL_VERIFY_ops *OQS_SIG_STFL_alg_xmss_shake256_h10_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_STFL_xmss_shake256_h16)
+const OQS_SIG_STFL_VERIFY_ops *OQS_SIG_STFL_alg_xmss_shake256_h16_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_STFL_xmss_shake256_h20)
+const OQS_SIG_STFL_VERIFY_ops *OQS_SIG_STFL_alg_xmss_shake256_h20_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_STFL_xmss_sha256_h10_192)
+const OQS_SIG_STFL_VERIFY_ops *OQS_SIG_STFL_alg_xmss_sha256_h10_192_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_STFL_xmss_sha256_h16_192)
+const OQS_SIG_STFL_VERIFY_ops *OQS_SIG_STFL_alg_xmss_sha256_h16_192_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_STFL_xmss_sha256_h20_192)
+const OQS_SIG_STFL_VERIFY_ops *OQS_SIG_STFL_alg_xmss_sha256_h20_192_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_STFL_xmss_shake256_h10_192)
+const OQS_SIG_STFL_VERIFY_ops *OQS_SIG_STFL_alg_xmss_shake256_h10_192_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_STFL_xmss_shake256_h16_192)
+const OQS_SIG_STFL_VERIFY_ops *OQS_SIG_STFL_alg_xmss_shake256_h16_192_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_STFL_xmss_shake256_h20_192)
+const OQS_SIG_STFL_VERIFY_ops *OQS_SIG_STFL_alg_xmss_shake256_h20_192_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_STFL_xmss_shake256_h10_256)
+const OQS_SIG_STFL_VERIFY_ops *OQS_SIG_STFL_alg_xmss_shake256_h10_256_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_STFL_xmss_shake256_h16_256)
+const OQS_SIG_STFL_VERIFY_ops *OQS_SIG_STFL_alg_xmss_shake256_h16_256_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_STFL_xmss_shake256_h20_256)
+const OQS_SIG_STFL_VERIFY_ops *OQS_SIG_STFL_alg_xmss_shake256_h20_256_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_STFL_xmssmt_sha256_h20_2)
+const OQS_SIG_STFL_VERIFY_ops *OQS_SIG_STFL_alg_xmssmt_sha256_h20_2_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_STFL_xmssmt_sha256_h20_4)
+const OQS_SIG_STFL_VERIFY_ops *OQS_SIG_STFL_alg_xmssmt_sha256_h20_4_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_STFL_xmssmt_sha256_h40_2)
+const OQS_SIG_STFL_VERIFY_ops *OQS_SIG_STFL_alg_xmssmt_sha256_h40_2_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_STFL_xmssmt_sha256_h40_4)
+const OQS_SIG_STFL_VERIFY_ops *OQS_SIG_STFL_alg_xmssmt_sha256_h40_4_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_STFL_xmssmt_sha256_h40_8)
+const OQS_SIG_STFL_VERIFY_ops *OQS_SIG_STFL_alg_xmssmt_sha256_h40_8_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_STFL_xmssmt_sha256_h60_3)
+const OQS_SIG_STFL_VERIFY_ops *OQS_SIG_STFL_alg_xmssmt_sha256_h60_3_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_STFL_xmssmt_sha256_h60_6)
+const OQS_SIG_STFL_VERIFY_ops *OQS_SIG_STFL_alg_xmssmt_sha256_h60_6_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_STFL_xmssmt_sha256_h60_12)
+const OQS_SIG_STFL_VERIFY_ops *OQS_SIG_STFL_alg_xmssmt_sha256_h60_12_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_STFL_xmssmt_shake128_h20_2)
+const OQS_SIG_STFL_VERIFY_ops *OQS_SIG_STFL_alg_xmssmt_shake128_h20_2_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_STFL_xmssmt_shake128_h20_4)
+const OQS_SIG_STFL_VERIFY_ops *OQS_SIG_STFL_alg_xmssmt_shake128_h20_4_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_STFL_xmssmt_shake128_h40_2)
+const OQS_SIG_STFL_VERIFY_ops *OQS_SIG_STFL_alg_xmssmt_shake128_h40_2_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_STFL_xmssmt_shake128_h40_4)
+const OQS_SIG_STFL_VERIFY_ops *OQS_SIG_STFL_alg_xmssmt_shake128_h40_4_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_STFL_xmssmt_shake128_h40_8)
+const OQS_SIG_STFL_VERIFY_ops *OQS_SIG_STFL_alg_xmssmt_shake128_h40_8_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_STFL_xmssmt_shake128_h60_3)
+const OQS_SIG_STFL_VERIFY_ops *OQS_SIG_STFL_alg_xmssmt_shake128_h60_3_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_STFL_xmssmt_shake128_h60_6)
+const OQS_SIG_STFL_VERIFY_ops *OQS_SIG_STFL_alg_xmssmt_shake128_h60_6_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_STFL_xmssmt_shake128_h60_12)
+const OQS_SIG_STFL_VERIFY_ops *OQS_SIG_STFL_alg_xmssmt_shake128_h60_12_verify_ops(void);
+#endif
+#if defined(OQS_ENABLE_SIG_STFL_LMS)
+/* One set of hooks serves all LMS/HSS parameter sets */
+const OQS_SIG_STFL_VERIFY_ops *OQS_SIG_STFL_alg_lms_verify_ops(void);
+#endif
+
+#endif // OQS_SIG_STFL_VERIFY_INTERNAL_H
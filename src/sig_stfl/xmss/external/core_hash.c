@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: (Apache-2.0 OR MIT) AND CC0-1.0
 #include <oqs/sha2.h>
 #include <oqs/sha3.h>
+#include <oqs/sha3x4.h>
 #include "core_hash.h"
 #include <string.h>
 
@@ -37,3 +38,132 @@ int core_hash(const xmss_params *params,
 
 	return 0;
 }
+
+void core_hash_inc_init(core_hash_inc_ctx *state) {
+#if HASH == XMSS_CORE_HASH_SHA256_N24 || HASH == XMSS_CORE_HASH_SHA256_N32
+	OQS_SHA2_sha256_inc_init(&state->ctx);
+#elif HASH == XMSS_CORE_HASH_SHA512_N64
+	OQS_SHA2_sha512_inc_init(&state->ctx);
+	state->block_len = 0;
+#elif HASH == XMSS_CORE_HASH_SHAKE128_N32
+	OQS_SHA3_shake128_inc_init(&state->ctx);
+#else
+	OQS_SHA3_shake256_inc_init(&state->ctx);
+#endif
+}
+
+void core_hash_inc_absorb(core_hash_inc_ctx *state,
+                          const unsigned char *in, unsigned long long inlen) {
+#if HASH == XMSS_CORE_HASH_SHA256_N24 || HASH == XMSS_CORE_HASH_SHA256_N32
+	OQS_SHA2_sha256_inc(&state->ctx, in, (size_t)inlen);
+#elif HASH == XMSS_CORE_HASH_SHA512_N64
+	size_t take;
+
+	if (state->block_len > 0) {
+		take = sizeof(state->block) - state->block_len;
+		if (take > inlen) {
+			take = (size_t)inlen;
+		}
+		memcpy(state->block + state->block_len, in, take);
+		state->block_len += take;
+		in += take;
+		inlen -= take;
+		if (state->block_len < sizeof(state->block)) {
+			return;
+		}
+		OQS_SHA2_sha512_inc_blocks(&state->ctx, state->block, 1);
+		state->block_len = 0;
+	}
+	if (inlen >= sizeof(state->block)) {
+		OQS_SHA2_sha512_inc_blocks(&state->ctx, in, (size_t)(inlen / sizeof(state->block)));
+		in += inlen - inlen % sizeof(state->block);
+		inlen %= sizeof(state->block);
+	}
+	memcpy(state->block, in, (size_t)inlen);
+	state->block_len = (size_t)inlen;
+#elif HASH == XMSS_CORE_HASH_SHAKE128_N32
+	OQS_SHA3_shake128_inc_absorb(&state->ctx, in, (size_t)inlen);
+#else
+	OQS_SHA3_shake256_inc_absorb(&state->ctx, in, (size_t)inlen);
+#endif
+}
+
+int core_hash_inc_finalize(const xmss_params *params,
+                           unsigned char *out, core_hash_inc_ctx *state) {
+
+	(void)params;
+#if HASH == XMSS_CORE_HASH_SHA256_N24
+	unsigned char buf[32];
+	OQS_SHA2_sha256_inc_finalize(buf, &state->ctx, NULL, 0);
+	memcpy(out, buf, 24);
+
+#elif HASH == XMSS_CORE_HASH_SHA256_N32
+	OQS_SHA2_sha256_inc_finalize(out, &state->ctx, NULL, 0);
+
+#elif HASH == XMSS_CORE_HASH_SHA512_N64
+	OQS_SHA2_sha512_inc_finalize(out, &state->ctx, state->block, state->block_len);
+
+#elif HASH == XMSS_CORE_HASH_SHAKE128_N32
+	OQS_SHA3_shake128_inc_finalize(&state->ctx);
+	OQS_SHA3_shake128_inc_squeeze(out, 32, &state->ctx);
+	OQS_SHA3_shake128_inc_ctx_release(&state->ctx);
+
+#elif HASH == XMSS_CORE_HASH_SHAKE256_N24 || HASH == XMSS_CORE_HASH_SHAKE256_N32 || HASH == XMSS_CORE_HASH_SHAKE256_N64
+	OQS_SHA3_shake256_inc_finalize(&state->ctx);
+	OQS_SHA3_shake256_inc_squeeze(out, params->n, &state->ctx);
+	OQS_SHA3_shake256_inc_ctx_release(&state->ctx);
+#else
+	return -1;
+#endif
+
+	return 0;
+}
+
+void core_hash_inc_release(core_hash_inc_ctx *state) {
+#if HASH == XMSS_CORE_HASH_SHA256_N24 || HASH == XMSS_CORE_HASH_SHA256_N32
+	OQS_SHA2_sha256_inc_ctx_release(&state->ctx);
+#elif HASH == XMSS_CORE_HASH_SHA512_N64
+	OQS_SHA2_sha512_inc_ctx_release(&state->ctx);
+#elif HASH == XMSS_CORE_HASH_SHAKE128_N32
+	OQS_SHA3_shake128_inc_ctx_release(&state->ctx);
+#else
+	OQS_SHA3_shake256_inc_ctx_release(&state->ctx);
+#endif
+}
+
+#if XMSS_CORE_HASH_X4
+int core_hash_x4(const xmss_params *params,
+                 unsigned char *out0, unsigned char *out1,
+                 unsigned char *out2, unsigned char *out3,
+                 const unsigned char *in0, const unsigned char *in1,
+                 const unsigned char *in2, const unsigned char *in3,
+                 unsigned long long inlen) {
+
+	(void)params;
+#if HASH == XMSS_CORE_HASH_SHA256_N24
+	unsigned char buf[4][32];
+	OQS_SHA2_sha256_x4(buf[0], buf[1], buf[2], buf[3], in0, in1, in2, in3, inlen);
+	memcpy(out0, buf[0], 24);
+	memcpy(out1, buf[1], 24);
+	memcpy(out2, buf[2], 24);
+	memcpy(out3, buf[3], 24);
+
+#elif HASH == XMSS_CORE_HASH_SHAKE256_N24
+	OQS_SHA3_shake256_x4(out0, out1, out2, out3, 24, in0, in1, in2, in3, inlen);
+
+#elif HASH == XMSS_CORE_HASH_SHA256_N32
+	OQS_SHA2_sha256_x4(out0, out1, out2, out3, in0, in1, in2, in3, inlen);
+
+#elif HASH == XMSS_CORE_HASH_SHAKE128_N32
+	OQS_SHA3_shake128_x4(out0, out1, out2, out3, 32, in0, in1, in2, in3, inlen);
+
+#elif HASH == XMSS_CORE_HASH_SHAKE256_N32
+	OQS_SHA3_shake256_x4(out0, out1, out2, out3, 32, in0, in1, in2, in3, inlen);
+
+#elif HASH == XMSS_CORE_HASH_SHAKE256_N64
+	OQS_SHA3_shake256_x4(out0, out1, out2, out3, 64, in0, in1, in2, in3, inlen);
+#endif
+
+	return 0;
+}
+#endif
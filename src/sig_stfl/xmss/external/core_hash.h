@@ -2,6 +2,10 @@
 #ifndef CORE_HASH
 #define CORE_HASH
 
+#include <stddef.h>
+#include <oqs/sha2.h>
+#include <oqs/sha3.h>
+
 #include "namespace.h"
 #include "params.h"
 
@@ -16,9 +20,60 @@
 #define XMSS_CORE_HASH_SHA512_N64   6
 #define XMSS_CORE_HASH_SHAKE256_N64 7
 
+// The SHAKE and SHA-256 instances can evaluate four independent hashes at once.
+#if HASH == XMSS_CORE_HASH_SHA256_N24 || HASH == XMSS_CORE_HASH_SHAKE256_N24 || \
+    HASH == XMSS_CORE_HASH_SHA256_N32 || HASH == XMSS_CORE_HASH_SHAKE128_N32 || \
+    HASH == XMSS_CORE_HASH_SHAKE256_N32 || HASH == XMSS_CORE_HASH_SHAKE256_N64
+#define XMSS_CORE_HASH_X4 1
+#else
+#define XMSS_CORE_HASH_X4 0
+#endif
+
 #define core_hash XMSS_PARAMS_INNER_CORE_HASH(core_hash)
 int core_hash(const xmss_params *params,
               unsigned char *out,
               const unsigned char *in, unsigned long long inlen);
 
+/* State of an incremental core_hash() computation. */
+typedef struct {
+#if HASH == XMSS_CORE_HASH_SHA256_N24 || HASH == XMSS_CORE_HASH_SHA256_N32
+    OQS_SHA2_sha256_ctx ctx;
+#elif HASH == XMSS_CORE_HASH_SHA512_N64
+    OQS_SHA2_sha512_ctx ctx;
+    /* SHA-512 only absorbs whole blocks incrementally */
+    unsigned char block[128];
+    size_t block_len;
+#elif HASH == XMSS_CORE_HASH_SHAKE128_N32
+    OQS_SHA3_shake128_inc_ctx ctx;
+#else
+    OQS_SHA3_shake256_inc_ctx ctx;
+#endif
+} core_hash_inc_ctx;
+
+#define core_hash_inc_init XMSS_PARAMS_INNER_CORE_HASH(core_hash_inc_init)
+void core_hash_inc_init(core_hash_inc_ctx *state);
+
+#define core_hash_inc_absorb XMSS_PARAMS_INNER_CORE_HASH(core_hash_inc_absorb)
+void core_hash_inc_absorb(core_hash_inc_ctx *state,
+                          const unsigned char *in, unsigned long long inlen);
+
+/* Writes the n-byte digest to out and releases the state. */
+#define core_hash_inc_finalize XMSS_PARAMS_INNER_CORE_HASH(core_hash_inc_finalize)
+int core_hash_inc_finalize(const xmss_params *params,
+                           unsigned char *out, core_hash_inc_ctx *state);
+
+/* Releases the state without computing the digest. */
+#define core_hash_inc_release XMSS_PARAMS_INNER_CORE_HASH(core_hash_inc_release)
+void core_hash_inc_release(core_hash_inc_ctx *state);
+
+#if XMSS_CORE_HASH_X4
+#define core_hash_x4 XMSS_PARAMS_INNER_CORE_HASH(core_hash_x4)
+int core_hash_x4(const xmss_params *params,
+                 unsigned char *out0, unsigned char *out1,
+                 unsigned char *out2, unsigned char *out3,
+                 const unsigned char *in0, const unsigned char *in1,
+                 const unsigned char *in2, const unsigned char *in3,
+                 unsigned long long inlen);
+#endif
+
 #endif
@@ -16,6 +16,9 @@
 #define XMSS_HASH_PADDING_PRF 3
 #define XMSS_HASH_PADDING_PRF_KEYGEN 4
 
+/* Longest message hash prefix: padding_len + 3 * n for n = 64 */
+#define XMSS_HASH_MSG_PREFIX_MAX (64 + 3 * 64)
+
 void addr_to_bytes(unsigned char *bytes, const uint32_t addr[8])
 {
     int i;
@@ -82,6 +85,22 @@ int hash_message(const xmss_params *params, unsigned char *out,
     return core_hash(params, out, m_with_prefix, mlen + params->padding_len + 3*params->n);
 }
 
+void hash_message_init(const xmss_params *params, core_hash_inc_ctx *state,
+                       const unsigned char *R, const unsigned char *root,
+                       unsigned long long idx)
+{
+    /* toByte(X, 32) || R || root || index, as in hash_message() */
+    unsigned char prefix[XMSS_HASH_MSG_PREFIX_MAX];
+
+    ull_to_bytes(prefix, params->padding_len, XMSS_HASH_PADDING_HASH);
+    memcpy(prefix + params->padding_len, R, params->n);
+    memcpy(prefix + params->padding_len + params->n, root, params->n);
+    ull_to_bytes(prefix + params->padding_len + 2*params->n, params->n, idx);
+
+    core_hash_inc_init(state);
+    core_hash_inc_absorb(state, prefix, params->padding_len + 3*params->n);
+}
+
 /**
  * We assume the left half is in in[0]...in[n-1]
  */
@@ -152,3 +171,90 @@ int thash_f(const xmss_params *params,
 
     return ret;
 }
+
+#if XMSS_CORE_HASH_X4
+/*
+ * Computes PRF(key, in[j]) for four 32-byte inputs at once.
+ */
+static int prf_x4(const xmss_params *params,
+                  unsigned char *out[4], unsigned char in[4][32],
+                  const unsigned char *key,
+                  unsigned char *buf[4])
+{
+    unsigned int j;
+
+    for (j = 0; j < 4; j++) {
+        ull_to_bytes(buf[j], params->padding_len, XMSS_HASH_PADDING_PRF);
+        memcpy(buf[j] + params->padding_len, key, params->n);
+        memcpy(buf[j] + params->padding_len + params->n, in[j], 32);
+    }
+
+    return core_hash_x4(params, out[0], out[1], out[2], out[3],
+                        buf[0], buf[1], buf[2], buf[3],
+                        params->padding_len + params->n + 32);
+}
+
+int prf_keygen_x4(const xmss_params *params,
+                  unsigned char *out[4], unsigned char *in[4],
+                  const unsigned char *key,
+                  unsigned char *buf[4])
+{
+    unsigned int j;
+
+    for (j = 0; j < 4; j++) {
+        ull_to_bytes(buf[j], params->padding_len, XMSS_HASH_PADDING_PRF_KEYGEN);
+        memcpy(buf[j] + params->padding_len, key, params->n);
+        memcpy(buf[j] + params->padding_len + params->n, in[j], params->n + 32);
+    }
+
+    return core_hash_x4(params, out[0], out[1], out[2], out[3],
+                        buf[0], buf[1], buf[2], buf[3],
+                        params->padding_len + 2*params->n + 32);
+}
+
+int thash_f_x4(const xmss_params *params,
+               unsigned char *inout[4],
+               const unsigned char *pub_seed, uint32_t addr[4][8],
+               unsigned char *buf[4])
+{
+    unsigned char *key[4];
+    unsigned char *bitmask[4];
+    unsigned char *prf_buf[4];
+
+    unsigned char addr_as_bytes[4][32];
+    unsigned int i, j;
+
+    for (j = 0; j < 4; j++) {
+        key[j] = buf[j] + params->padding_len;
+        bitmask[j] = buf[j] + (params->padding_len + 2 * params->n);
+        prf_buf[j] = bitmask[j] + params->n;
+
+        /* Set the function padding. */
+        ull_to_bytes(buf[j], params->padding_len, XMSS_HASH_PADDING_F);
+    }
+
+    /* Generate the n-byte keys. */
+    for (j = 0; j < 4; j++) {
+        set_key_and_mask(addr[j], 0);
+        addr_to_bytes(addr_as_bytes[j], addr[j]);
+    }
+    prf_x4(params, key, addr_as_bytes, pub_seed, prf_buf);
+
+    /* Generate the n-byte masks. */
+    for (j = 0; j < 4; j++) {
+        set_key_and_mask(addr[j], 1);
+        addr_to_bytes(addr_as_bytes[j], addr[j]);
+    }
+    prf_x4(params, bitmask, addr_as_bytes, pub_seed, prf_buf);
+
+    for (j = 0; j < 4; j++) {
+        for (i = 0; i < params->n; i++) {
+            buf[j][params->padding_len + params->n + i] = inout[j][i] ^ bitmask[j][i];
+        }
+    }
+
+    return core_hash_x4(params, inout[0], inout[1], inout[2], inout[3],
+                        buf[0], buf[1], buf[2], buf[3],
+                        params->padding_len + 2 * params->n);
+}
+#endif
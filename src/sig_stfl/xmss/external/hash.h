@@ -39,6 +39,35 @@ int thash_f(const xmss_params *params,
             const unsigned char *pub_seed, uint32_t addr[8],
             unsigned char *buf);
 
+#if XMSS_CORE_HASH_X4
+/*
+ * Four-way variants of prf_keygen and thash_f. Each lane j has its own
+ * buffer buf[j] of the size the single-lane function takes.
+ */
+#define prf_keygen_x4 XMSS_INNER_NAMESPACE(prf_keygen_x4)
+int prf_keygen_x4(const xmss_params *params,
+                  unsigned char *out[4], unsigned char *in[4],
+                  const unsigned char *key,
+                  unsigned char *buf[4]);
+
+/* Computes inout[j] = F(inout[j]) for the addresses addr[j]. */
+#define thash_f_x4 XMSS_INNER_NAMESPACE(thash_f_x4)
+int thash_f_x4(const xmss_params *params,
+               unsigned char *inout[4],
+               const unsigned char *pub_seed, uint32_t addr[4][8],
+               unsigned char *buf[4]);
+#endif
+
+/*
+ * Starts an incremental message hash: absorbs the prefix that hash_message()
+ * places before the message. The message itself is then absorbed with
+ * core_hash_inc_absorb() and the hash completed with core_hash_inc_finalize().
+ */
+#define hash_message_init XMSS_INNER_NAMESPACE(hash_message_init)
+void hash_message_init(const xmss_params *params, core_hash_inc_ctx *state,
+                       const unsigned char *R, const unsigned char *root,
+                       unsigned long long idx);
+
 #define hash_message XMSS_INNER_NAMESPACE(hash_message)
 int hash_message(const xmss_params *params, unsigned char *out,
                  const unsigned char *R, const unsigned char *root,
@@ -8,6 +8,21 @@
 #include "hash_address.h"
 #include "params.h"
 
+#if XMSS_CORE_HASH_X4
+#define WOTS_LANES 4
+#else
+#define WOTS_LANES 1
+#endif
+
+/**
+ * Size of the scratch buffer used by one hash lane; the functions below take
+ * WOTS_LANES such buffers laid out back to back.
+ */
+static size_t wots_buf_size(const xmss_params *params)
+{
+    return 2 * params->padding_len + 4 * params->n + 64;
+}
+
 /**
  * Helper method for pseudorandom key generation.
  * Expands an n-byte array into a len*n byte array using the `prf_keygen` function.
@@ -18,6 +33,29 @@ static void expand_seed(const xmss_params *params,
                         unsigned char *buf)
 {
     unsigned int i;
+#if XMSS_CORE_HASH_X4
+    const size_t lane_size = wots_buf_size(params);
+    unsigned char *in[4], *prf_buf[4], *out[4];
+    unsigned int j, chain;
+
+    set_hash_addr(addr, 0);
+    set_key_and_mask(addr, 0);
+    for (j = 0; j < 4; j++) {
+        in[j] = buf + j*lane_size;
+        prf_buf[j] = in[j] + params->n + 32;
+        memcpy(in[j], pub_seed, params->n);
+    }
+    for (i = 0; i < params->wots_len; i += 4) {
+        for (j = 0; j < 4; j++) {
+            /* Lanes past the last chain recompute the last seed. */
+            chain = i + j < params->wots_len ? i + j : params->wots_len - 1;
+            set_chain_addr(addr, chain);
+            addr_to_bytes(in[j] + params->n, addr);
+            out[j] = outseeds + chain*params->n;
+        }
+        prf_keygen_x4(params, out, in, inseed, prf_buf);
+    }
+#else
     unsigned char *prf_buf = buf + params->n + 32;
 
     set_hash_addr(addr, 0);
@@ -28,8 +66,10 @@ static void expand_seed(const xmss_params *params,
         addr_to_bytes(buf + params->n, addr);
         prf_keygen(params, outseeds + i*params->n, buf, inseed, prf_buf);
     }
+#endif
 }
 
+#if !XMSS_CORE_HASH_X4
 /**
  * Computes the chaining function.
  * out and in have to be n-byte arrays.
@@ -54,6 +94,115 @@ static void gen_chain(const xmss_params *params,
         thash_f(params, out, out, pub_seed, addr, thash_buf);
     }
 }
+#endif
+
+/**
+ * Computes the chaining function on all wots_len chains of a WOTS key.
+ * Chain i is advanced from position start[i] to position end[i] on the value
+ * at in + i*n, and the result is written to out + i*n. A NULL start means
+ * position 0 for every chain, and a NULL end means position w - 1.
+ *
+ * With a four-way hash, chains are processed in order of their number of
+ * steps so that the lanes of each hash call stay busy.
+ *
+ * Returns -1 if the scratch memory for this cannot be allocated.
+ */
+static int gen_chains(const xmss_params *params,
+                       unsigned char *out, const unsigned char *in,
+                       const unsigned int *start, const unsigned int *end,
+                       const unsigned char *pub_seed, uint32_t addr[8],
+                       unsigned char *buf)
+{
+    unsigned int i;
+#if XMSS_CORE_HASH_X4
+    const size_t lane_size = wots_buf_size(params);
+    unsigned int *order = OQS_MEM_malloc(params->wots_len * sizeof(unsigned int));
+    unsigned char *dummy = OQS_MEM_calloc(1, params->n);
+    unsigned char *lanes[4], *bufs[4];
+    uint32_t addrs[4][8];
+    unsigned int chain[4], pos[4], stop[4];
+    unsigned int j, k, steps, active, last;
+    if (order == NULL || dummy == NULL) {
+        OQS_MEM_insecure_free(order);
+        OQS_MEM_insecure_free(dummy);
+        return -1;
+    }
+
+    for (j = 0; j < 4; j++) {
+        bufs[j] = buf + j*lane_size;
+    }
+
+    /* Sort the chains by their number of steps. */
+#define CHAIN_START(c) (start == NULL ? 0 : start[c])
+#define CHAIN_END(c) (end == NULL ? params->wots_w - 1 : end[c])
+    for (i = 0; i < params->wots_len; i++) {
+        steps = CHAIN_END(i) - CHAIN_START(i);
+        for (k = i; k > 0 && CHAIN_END(order[k - 1]) - CHAIN_START(order[k - 1]) > steps; k--) {
+            order[k] = order[k - 1];
+        }
+        order[k] = i;
+    }
+
+    if (out != in) {
+        memcpy(out, in, params->wots_len * params->n);
+    }
+
+    for (i = 0; i < params->wots_len; i += 4) {
+        for (j = 0; j < 4; j++) {
+            memcpy(addrs[j], addr, sizeof(addrs[j]));
+            if (i + j < params->wots_len) {
+                chain[j] = order[i + j];
+                set_chain_addr(addrs[j], chain[j]);
+                pos[j] = CHAIN_START(chain[j]);
+                stop[j] = CHAIN_END(chain[j]);
+            } else {
+                chain[j] = 0;
+                pos[j] = stop[j] = 0;
+            }
+        }
+
+        for (;;) {
+            active = 0;
+            last = 0;
+            for (j = 0; j < 4; j++) {
+                if (pos[j] < stop[j]) {
+                    lanes[j] = out + chain[j]*params->n;
+                    set_hash_addr(addrs[j], pos[j]);
+                    pos[j]++;
+                    active++;
+                    last = j;
+                } else {
+                    /* Idle lanes hash a dummy value that is never used. */
+                    lanes[j] = dummy;
+                }
+            }
+            if (active == 0) {
+                break;
+            } else if (active == 1) {
+                thash_f(params, lanes[last], lanes[last], pub_seed, addrs[last], bufs[0]);
+            } else {
+                thash_f_x4(params, lanes, pub_seed, addrs, bufs);
+            }
+        }
+    }
+#undef CHAIN_START
+#undef CHAIN_END
+
+    OQS_MEM_insecure_free(order);
+    OQS_MEM_insecure_free(dummy);
+    return 0;
+#else
+    for (i = 0; i < params->wots_len; i++) {
+        unsigned int first = start == NULL ? 0 : start[i];
+        unsigned int last = end == NULL ? params->wots_w - 1 : end[i];
+
+        set_chain_addr(addr, i);
+        gen_chain(params, out + i*params->n, in + i*params->n,
+                  first, last - first, pub_seed, addr, buf);
+    }
+    return 0;
+#endif
+}
 
 /**
  * base_w algorithm as described in draft.
@@ -82,14 +231,14 @@ static void base_w(const xmss_params *params,
 }
 
 /* Computes the WOTS+ checksum over a message (in base_w). */
-static void wots_checksum(const xmss_params *params,
-                          unsigned int *csum_base_w, const unsigned int *msg_base_w)
+static int wots_checksum(const xmss_params *params,
+                         unsigned int *csum_base_w, const unsigned int *msg_base_w)
 {
     int csum = 0;
     unsigned int csum_bytes_length =  (params->wots_len2 * params->wots_log_w + 7) / 8;
     unsigned char *csum_bytes = OQS_MEM_malloc(csum_bytes_length);
     if (csum_bytes == NULL) {
-        return;
+        return -1;
     }
     unsigned int i;
 
@@ -105,14 +254,15 @@ static void wots_checksum(const xmss_params *params,
     base_w(params, csum_base_w, params->wots_len2, csum_bytes);
 
     OQS_MEM_insecure_free(csum_bytes);
+    return 0;
 }
 
 /* Takes a message and derives the matching chain lengths. */
-static void chain_lengths(const xmss_params *params,
-                          unsigned int *lengths, const unsigned char *msg)
+static int chain_lengths(const xmss_params *params,
+                         unsigned int *lengths, const unsigned char *msg)
 {
     base_w(params, lengths, params->wots_len1, msg);
-    wots_checksum(params, lengths + params->wots_len1, lengths);
+    return wots_checksum(params, lengths + params->wots_len1, lengths);
 }
 
 /**
@@ -122,87 +272,95 @@ static void chain_lengths(const xmss_params *params,
  * and the address of this WOTS key pair.
  *
  * Writes the computed public key to 'pk'.
+ * Returns -1 on memory allocation failure.
  */
-void wots_pkgen(const xmss_params *params,
-                unsigned char *pk, const unsigned char *seed,
-                const unsigned char *pub_seed, uint32_t addr[8])
+int wots_pkgen(const xmss_params *params,
+               unsigned char *pk, const unsigned char *seed,
+               const unsigned char *pub_seed, uint32_t addr[8])
 {
-    unsigned int i;
-    const size_t buf_size = 2 * params->padding_len + 4 * params->n + 64;
+    const size_t buf_size = WOTS_LANES * wots_buf_size(params);
     unsigned char *buf = OQS_MEM_malloc(buf_size);
+    int ret;
     if (buf == NULL) {
-        return;
+        return -1;
     }
-    
+
     /* The WOTS+ private key is derived from the seed. */
     expand_seed(params, pk, seed, pub_seed, addr, buf);
 
-    for (i = 0; i < params->wots_len; i++) {
-        set_chain_addr(addr, i);
-        gen_chain(params, pk + i*params->n, pk + i*params->n,
-                  0, params->wots_w - 1, pub_seed, addr, buf);
+    ret = gen_chains(params, pk, pk, NULL, NULL, pub_seed, addr, buf);
+    if (ret != 0) {
+        /* pk still holds the private key. */
+        OQS_MEM_cleanse(pk, params->wots_sig_bytes);
     }
 
     OQS_MEM_secure_free(buf, buf_size);
+    return ret;
 }
 
 /**
  * Takes a n-byte message and the 32-byte seed for the private key to compute a
  * signature that is placed at 'sig'.
+ * Returns -1 on memory allocation failure.
  */
-void wots_sign(const xmss_params *params,
-               unsigned char *sig, const unsigned char *msg,
-               const unsigned char *seed, const unsigned char *pub_seed,
-               uint32_t addr[8])
+int wots_sign(const xmss_params *params,
+              unsigned char *sig, const unsigned char *msg,
+              const unsigned char *seed, const unsigned char *pub_seed,
+              uint32_t addr[8])
 {
-    const size_t buf_size = 2 * params->padding_len + 4 * params->n + 64;
+    const size_t buf_size = WOTS_LANES * wots_buf_size(params);
     unsigned int *lengths = OQS_MEM_calloc(params->wots_len, sizeof(unsigned int));
     unsigned char *buf = OQS_MEM_malloc(buf_size);
-    unsigned int i;
+    int ret = -1;
     if (lengths == NULL || buf == NULL) {
-        return;
+        goto cleanup;
     }
 
-    chain_lengths(params, lengths, msg);
+    if (chain_lengths(params, lengths, msg) != 0) {
+        goto cleanup;
+    }
 
     /* The WOTS+ private key is derived from the seed. */
     expand_seed(params, sig, seed, pub_seed, addr, buf);
 
-    for (i = 0; i < params->wots_len; i++) {
-        set_chain_addr(addr, i);
-        gen_chain(params, sig + i*params->n, sig + i*params->n,
-                  0, lengths[i], pub_seed, addr, buf);
+    ret = gen_chains(params, sig, sig, NULL, lengths, pub_seed, addr, buf);
+    if (ret != 0) {
+        /* sig still holds the private key. */
+        OQS_MEM_cleanse(sig, params->wots_sig_bytes);
     }
 
+cleanup:
     OQS_MEM_insecure_free(lengths);
     OQS_MEM_secure_free(buf, buf_size);
+    return ret;
 }
 
 /**
  * Takes a WOTS signature and an n-byte message, computes a WOTS public key.
  *
  * Writes the computed public key to 'pk'.
+ * Returns -1 on memory allocation failure.
  */
-void wots_pk_from_sig(const xmss_params *params, unsigned char *pk,
-                      const unsigned char *sig, const unsigned char *msg,
-                      const unsigned char *pub_seed, uint32_t addr[8])
+int wots_pk_from_sig(const xmss_params *params, unsigned char *pk,
+                     const unsigned char *sig, const unsigned char *msg,
+                     const unsigned char *pub_seed, uint32_t addr[8])
 {
     unsigned int *lengths = OQS_MEM_calloc(params->wots_len, sizeof(unsigned int ));
-    const size_t thash_buf_len = 2 * params->padding_len + 4 * params->n + 32;
+    const size_t thash_buf_len = WOTS_LANES * wots_buf_size(params);
     unsigned char *thash_buf = OQS_MEM_malloc(thash_buf_len);
-    unsigned int i;
+    int ret = -1;
     if (lengths == NULL || thash_buf == NULL) {
-        return;
+        goto cleanup;
     }
 
-    chain_lengths(params, lengths, msg);
-
-    for (i = 0; i < params->wots_len; i++) {
-        set_chain_addr(addr, i);
-        gen_chain(params, pk + i*params->n, sig + i*params->n,
-                  lengths[i], params->wots_w - 1 - lengths[i], pub_seed, addr, thash_buf);
+    if (chain_lengths(params, lengths, msg) != 0) {
+        goto cleanup;
     }
 
+    ret = gen_chains(params, pk, sig, lengths, NULL, pub_seed, addr, thash_buf);
+
+cleanup:
     OQS_MEM_insecure_free(lengths);
     OQS_MEM_insecure_free(thash_buf);
+    return ret;
 }
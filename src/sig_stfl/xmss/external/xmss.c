@@ -1,8 +1,10 @@
 // SPDX-License-Identifier: (Apache-2.0 OR MIT) AND CC0-1.0
 #include <stdint.h>
+#include <oqs/common.h>
 
 #include "params.h"
 #include "xmss_core.h"
+#include "xmss_commons.h"
 #include "utils.h"
 #include "xmss.h"
 
@@ -67,20 +69,23 @@ int xmss_keypair(unsigned char *pk, unsigned char *sk, const uint32_t oid)
  * signed message (sm) after signing. The length is in bytes.
  * @param m The message to be signed, represented as an array of unsigned characters.
  * @param mlen The length of the message to be signed, in bytes.
+ * @param dirty Records the changes to sk, or NULL.
  * 
  * @return an integer value. If the function executes successfully, it will return 0. If there is an
  * error, it will return -1.
  */
 #ifndef OQS_ALLOW_XMSS_KEY_AND_SIG_GEN
 int xmss_sign(XMSS_UNUSED_ATT unsigned char *sk, XMSS_UNUSED_ATT unsigned char *sm, XMSS_UNUSED_ATT unsigned long long *smlen,
-              XMSS_UNUSED_ATT const unsigned char *m, XMSS_UNUSED_ATT unsigned long long mlen)
+              XMSS_UNUSED_ATT const unsigned char *m, XMSS_UNUSED_ATT unsigned long long mlen,
+              XMSS_UNUSED_ATT xmss_dirty_ranges *dirty)
 {
     return -1;
 }
 #else
 int xmss_sign(unsigned char *sk,
               unsigned char *sm, unsigned long long *smlen,
-              const unsigned char *m, unsigned long long mlen)
+              const unsigned char *m, unsigned long long mlen,
+              xmss_dirty_ranges *dirty)
 {
     xmss_params params;
     uint32_t oid = 0;
@@ -92,7 +97,105 @@ int xmss_sign(unsigned char *sk,
     if (xmss_parse_oid(&params, oid)) {
         return -1;
     }
-    return xmss_core_sign(&params, sk + XMSS_OID_LEN, sm, smlen, m, mlen);
+    return xmss_core_sign(&params, sk + XMSS_OID_LEN, sm, smlen, m, mlen, dirty);
+}
+#endif
+
+/**
+ * Reserves the next one-time key of an XMSS secret key; see xmss_core_sign_reserve().
+ *
+ * @param sk The secret key, whose index and BDS state are advanced.
+ * @param sm The signature buffer; receives the index and authentication path.
+ * @param reservation Buffer of XMSS_SIGN_RESERVATION_BYTES that receives the
+ * OID and the seeds needed by xmss_sign_message().
+ * @param dirty Records the changes to sk, or NULL.
+ *
+ * @return 0 on success, a negative value on error.
+ */
+#ifndef OQS_ALLOW_XMSS_KEY_AND_SIG_GEN
+int xmss_sign_reserve(XMSS_UNUSED_ATT unsigned char *sk, XMSS_UNUSED_ATT unsigned char *sm, XMSS_UNUSED_ATT unsigned char *reservation,
+                      XMSS_UNUSED_ATT xmss_dirty_ranges *dirty)
+{
+    return -1;
+}
+
+int xmss_sign_message(XMSS_UNUSED_ATT const unsigned char *reservation, XMSS_UNUSED_ATT unsigned char *sm, XMSS_UNUSED_ATT unsigned long long *smlen,
+                      XMSS_UNUSED_ATT const unsigned char *m, XMSS_UNUSED_ATT unsigned long long mlen)
+{
+    return -1;
+}
+
+int xmss_sign_message_init(XMSS_UNUSED_ATT void **state, XMSS_UNUSED_ATT const unsigned char *reservation, XMSS_UNUSED_ATT unsigned char *sm)
+{
+    return -1;
+}
+#else
+int xmss_sign_reserve(unsigned char *sk, unsigned char *sm, unsigned char *reservation,
+                      xmss_dirty_ranges *dirty)
+{
+    xmss_params params;
+    uint32_t oid = 0;
+    unsigned int i;
+
+    for (i = 0; i < XMSS_OID_LEN; i++) {
+        oid |= sk[XMSS_OID_LEN - i - 1] << (i * 8);
+        reservation[i] = sk[i];
+    }
+    if (xmss_parse_oid(&params, oid)) {
+        return -1;
+    }
+    return xmss_core_sign_reserve(&params, sk + XMSS_OID_LEN, sm, reservation + XMSS_OID_LEN, dirty);
+}
+
+/**
+ * Completes a signature on `m` from a reservation made by xmss_sign_reserve().
+ * Does not access the secret key.
+ */
+int xmss_sign_message(const unsigned char *reservation,
+                      unsigned char *sm, unsigned long long *smlen,
+                      const unsigned char *m, unsigned long long mlen)
+{
+    xmss_params params;
+    uint32_t oid = 0;
+    unsigned int i;
+
+    for (i = 0; i < XMSS_OID_LEN; i++) {
+        oid |= reservation[XMSS_OID_LEN - i - 1] << (i * 8);
+    }
+    if (xmss_parse_oid(&params, oid)) {
+        return -1;
+    }
+    return xmss_xmssmt_core_sign_message(&params, reservation + XMSS_OID_LEN, sm, smlen, m, mlen);
+}
+
+/**
+ * Streaming form of xmss_sign_message(): starts the signature reserved in
+ * `reservation`, writing R into `sm`. The message is then passed in pieces to
+ * xmss_xmssmt_inc_update() and the signature completed by
+ * xmss_xmssmt_sign_message_final().
+ */
+int xmss_sign_message_init(void **state, const unsigned char *reservation, unsigned char *sm)
+{
+    xmss_params params;
+    xmss_inc_state *st;
+    uint32_t oid = 0;
+    unsigned int i;
+
+    for (i = 0; i < XMSS_OID_LEN; i++) {
+        oid |= reservation[XMSS_OID_LEN - i - 1] << (i * 8);
+    }
+    if (xmss_parse_oid(&params, oid)) {
+        return -1;
+    }
+    if ((st = OQS_MEM_malloc(sizeof(xmss_inc_state))) == NULL) {
+        return -1;
+    }
+    if (xmss_xmssmt_core_sign_message_init(&params, st, reservation + XMSS_OID_LEN, sm)) {
+        OQS_MEM_secure_free(st, sizeof(xmss_inc_state));
+        return -1;
+    }
+    *state = st;
+    return 0;
 }
 #endif
 
@@ -127,6 +230,39 @@ int xmss_sign_open(const unsigned char *m, unsigned long long mlen,
     return xmss_core_sign_open(&params, m, mlen, sm, smlen, pk + XMSS_OID_LEN);
 }
 
+/**
+ * Streaming form of xmss_sign_open(): starts verifying `sm` under `pk`. The
+ * message is then passed in pieces to xmss_xmssmt_inc_update() and the
+ * signature checked by xmss_xmssmt_sign_open_final().
+ */
+int xmss_sign_open_init(void **state, const unsigned char *sm, unsigned long long smlen,
+                        const unsigned char *pk)
+{
+    xmss_params params;
+    xmss_inc_state *st;
+    uint32_t oid = 0;
+    unsigned int i;
+
+    for (i = 0; i < XMSS_OID_LEN; i++) {
+        oid |= pk[XMSS_OID_LEN - i - 1] << (i * 8);
+    }
+    if (xmss_parse_oid(&params, oid)) {
+        return -1;
+    }
+    if (smlen != params.sig_bytes) {
+        return -1;
+    }
+    if ((st = OQS_MEM_malloc(sizeof(xmss_inc_state))) == NULL) {
+        return -1;
+    }
+    if (xmssmt_core_sign_open_init(&params, st, sm, pk + XMSS_OID_LEN)) {
+        OQS_MEM_insecure_free(st);
+        return -1;
+    }
+    *state = st;
+    return 0;
+}
+
 /**
  * The function calculates the remaining number of signatures that can be generated using a given XMSS
  * private key.
@@ -211,7 +347,24 @@ int xmssmt_keypair(unsigned char *pk, unsigned char *sk, const uint32_t oid)
 
 int xmssmt_sign(unsigned char *sk,
                 unsigned char *sm, unsigned long long *smlen,
-                const unsigned char *m, unsigned long long mlen)
+                const unsigned char *m, unsigned long long mlen,
+                xmss_dirty_ranges *dirty)
+{
+    xmss_params params;
+    uint32_t oid = 0;
+    unsigned int i;
+
+    for (i = 0; i < XMSS_OID_LEN; i++) {
+        oid |= sk[XMSS_OID_LEN - i - 1] << (i * 8);
+    }
+    if (xmssmt_parse_oid(&params, oid)) {
+        return -1;
+    }
+    return xmssmt_core_sign(&params, sk + XMSS_OID_LEN, sm, smlen, m, mlen, dirty);
+}
+
+int xmssmt_sign_reserve(unsigned char *sk, unsigned char *sm, unsigned char *reservation,
+                        xmss_dirty_ranges *dirty)
 {
     xmss_params params;
     uint32_t oid = 0;
@@ -219,11 +372,53 @@ int xmssmt_sign(unsigned char *sk,
 
     for (i = 0; i < XMSS_OID_LEN; i++) {
         oid |= sk[XMSS_OID_LEN - i - 1] << (i * 8);
+        reservation[i] = sk[i];
     }
     if (xmssmt_parse_oid(&params, oid)) {
         return -1;
     }
-    return xmssmt_core_sign(&params, sk + XMSS_OID_LEN, sm, smlen, m, mlen);
+    return xmssmt_core_sign_reserve(&params, sk + XMSS_OID_LEN, sm, reservation + XMSS_OID_LEN, dirty);
+}
+
+int xmssmt_sign_message(const unsigned char *reservation,
+                        unsigned char *sm, unsigned long long *smlen,
+                        const unsigned char *m, unsigned long long mlen)
+{
+    xmss_params params;
+    uint32_t oid = 0;
+    unsigned int i;
+
+    for (i = 0; i < XMSS_OID_LEN; i++) {
+        oid |= reservation[XMSS_OID_LEN - i - 1] << (i * 8);
+    }
+    if (xmssmt_parse_oid(&params, oid)) {
+        return -1;
+    }
+    return xmss_xmssmt_core_sign_message(&params, reservation + XMSS_OID_LEN, sm, smlen, m, mlen);
+}
+
+int xmssmt_sign_message_init(void **state, const unsigned char *reservation, unsigned char *sm)
+{
+    xmss_params params;
+    xmss_inc_state *st;
+    uint32_t oid = 0;
+    unsigned int i;
+
+    for (i = 0; i < XMSS_OID_LEN; i++) {
+        oid |= reservation[XMSS_OID_LEN - i - 1] << (i * 8);
+    }
+    if (xmssmt_parse_oid(&params, oid)) {
+        return -1;
+    }
+    if ((st = OQS_MEM_malloc(sizeof(xmss_inc_state))) == NULL) {
+        return -1;
+    }
+    if (xmss_xmssmt_core_sign_message_init(&params, st, reservation + XMSS_OID_LEN, sm)) {
+        OQS_MEM_secure_free(st, sizeof(xmss_inc_state));
+        return -1;
+    }
+    *state = st;
+    return 0;
 }
 
 int xmssmt_sign_open(const unsigned char *m, unsigned long long mlen,
@@ -243,6 +438,34 @@ int xmssmt_sign_open(const unsigned char *m, unsigned long long mlen,
     return xmssmt_core_sign_open(&params, m, mlen, sm, smlen, pk + XMSS_OID_LEN);
 }
 
+int xmssmt_sign_open_init(void **state, const unsigned char *sm, unsigned long long smlen,
+                          const unsigned char *pk)
+{
+    xmss_params params;
+    xmss_inc_state *st;
+    uint32_t oid = 0;
+    unsigned int i;
+
+    for (i = 0; i < XMSS_OID_LEN; i++) {
+        oid |= pk[XMSS_OID_LEN - i - 1] << (i * 8);
+    }
+    if (xmssmt_parse_oid(&params, oid)) {
+        return -1;
+    }
+    if (smlen != params.sig_bytes) {
+        return -1;
+    }
+    if ((st = OQS_MEM_malloc(sizeof(xmss_inc_state))) == NULL) {
+        return -1;
+    }
+    if (xmssmt_core_sign_open_init(&params, st, sm, pk + XMSS_OID_LEN)) {
+        OQS_MEM_insecure_free(st);
+        return -1;
+    }
+    *state = st;
+    return 0;
+}
+
 
 /**
  * The function calculates the remaining number of signatures that can be generated using a given
@@ -308,3 +531,52 @@ int xmssmt_total_signatures(unsigned long long *max, const unsigned  char *sk)
 
     return 0;
 }
+
+/**
+ * Absorbs the next piece of the message of a streaming signature or
+ * verification.
+ */
+int xmss_xmssmt_inc_update(void *state, const unsigned char *m, unsigned long long mlen)
+{
+    xmss_inc_state *st = state;
+
+    core_hash_inc_absorb(&st->hash, m, mlen);
+    return 0;
+}
+
+/**
+ * Completes a streaming signature and frees the state.
+ */
+int xmss_xmssmt_sign_message_final(void *state, unsigned char *sm, unsigned long long *smlen)
+{
+    int ret = xmss_xmssmt_core_sign_message_final(state, sm, smlen);
+
+    OQS_MEM_secure_free(state, sizeof(xmss_inc_state));
+    return ret;
+}
+
+/**
+ * Completes a streaming verification of `sm` and frees the state.
+ */
+int xmss_xmssmt_sign_open_final(void *state, const unsigned char *sm)
+{
+    int ret = xmssmt_core_sign_open_final(state, sm);
+
+    OQS_MEM_insecure_free(state);
+    return ret;
+}
+
+/**
+ * Frees the state of a streaming signature or verification that was not
+ * completed.
+ */
+void xmss_xmssmt_inc_free(void *state)
+{
+    xmss_inc_state *st = state;
+
+    if (st == NULL) {
+        return;
+    }
+    core_hash_inc_release(&st->hash);
+    OQS_MEM_secure_free(st, sizeof(xmss_inc_state));
+}
@@ -5,6 +5,33 @@
 #include <stdint.h>
 #include "namespace.h"
 
+/* Number of byte ranges an xmss_dirty_ranges records before merging them */
+#define XMSS_DIRTY_RANGES_MAX 16
+
+/* Modified ranges separated by fewer unchanged bytes than this are recorded as one */
+#define XMSS_DIRTY_RANGES_GAP 64
+
+/**
+ * Byte ranges of a secret key changed by signing, as offsets from `base`,
+ * sorted and non-overlapping. Signing with a tracker records every byte of
+ * the index and BDS state it writes, so that a secret key kept in place, e.g.
+ * in a memory-mapped file, can be persisted without comparing it to a copy.
+ *
+ * If `flush` is set, it is called once the index has been advanced and before
+ * any other byte of the key is changed; it should persist the recorded ranges
+ * and clear them by setting `count` to 0. A non-zero return aborts signing.
+ */
+typedef struct xmss_dirty_ranges {
+    const unsigned char *base;
+    int (*flush)(struct xmss_dirty_ranges *dirty);
+    void *context;
+    unsigned int count;
+    struct {
+        unsigned long long offset;
+        unsigned long long len;
+    } range[XMSS_DIRTY_RANGES_MAX];
+} xmss_dirty_ranges;
+
 /**
  * Generates a XMSS key pair for a given parameter set.
  * Format sk: [OID || (32bit) idx || SK_SEED || SK_PRF || PUB_SEED || root]
@@ -18,11 +45,43 @@ int xmss_keypair(unsigned char *pk, unsigned char *sk, const uint32_t oid);
  * Returns
  * 1. an array containing the signature followed by the message AND
  * 2. an updated secret key!
+ * The changes to sk are recorded in `dirty` unless it is NULL.
  */
 #define xmss_sign XMSS_NAMESPACE(xmss_sign)
 int xmss_sign(unsigned char *sk,
               unsigned char *sm, unsigned long long *smlen,
-              const unsigned char *m, unsigned long long mlen);
+              const unsigned char *m, unsigned long long mlen,
+              xmss_dirty_ranges *dirty);
+
+/* Length of the reservation buffer used by xmss(mt)_sign_reserve():
+ * OID || SK_SEED || SK_PRF || PUB_SEED || root, for n up to 64 */
+#define XMSS_SIGN_RESERVATION_BYTES (4 + 4 * 64)
+
+/**
+ * Splits xmss_sign() in two.
+ * xmss_sign_reserve() claims the next one-time key: it writes the index and
+ * authentication path into `sm`, advances `sk` and fills `reservation`.
+ * xmss_sign_message() then completes the signature on `m` from the
+ * reservation alone, without accessing `sk`.
+ * The changes to sk are recorded in `dirty` unless it is NULL.
+ */
+#define xmss_sign_reserve XMSS_NAMESPACE(xmss_sign_reserve)
+int xmss_sign_reserve(unsigned char *sk, unsigned char *sm, unsigned char *reservation,
+                      xmss_dirty_ranges *dirty);
+
+#define xmss_sign_message XMSS_NAMESPACE(xmss_sign_message)
+int xmss_sign_message(const unsigned char *reservation,
+                      unsigned char *sm, unsigned long long *smlen,
+                      const unsigned char *m, unsigned long long mlen);
+
+/**
+ * Streaming form of xmss_sign_message(), for messages that are not available
+ * in one piece: xmss_sign_message_init() allocates *state and writes R into
+ * `sm`, xmss_xmssmt_inc_update() absorbs the message piece by piece and
+ * xmss_xmssmt_sign_message_final() completes `sm` and frees the state.
+ */
+#define xmss_sign_message_init XMSS_NAMESPACE(xmss_sign_message_init)
+int xmss_sign_message_init(void **state, const unsigned char *reservation, unsigned char *sm);
 
 /**
  * Verifies a given message signature pair using a given public key.
@@ -36,6 +95,15 @@ int xmss_sign_open(const unsigned char *m, unsigned long long mlen,
                    const unsigned char *sm, unsigned long long smlen,
                    const unsigned char *pk);
 
+/**
+ * Streaming form of xmss_sign_open(): xmss_sign_open_init() allocates *state,
+ * xmss_xmssmt_inc_update() absorbs the message piece by piece and
+ * xmss_xmssmt_sign_open_final() verifies `sm` and frees the state.
+ */
+#define xmss_sign_open_init XMSS_NAMESPACE(xmss_sign_open_init)
+int xmss_sign_open_init(void **state, const unsigned char *sm, unsigned long long smlen,
+                        const unsigned char *pk);
+
 /* 
  * Write number of remaining signature to `remain` variable given `sk`
  */
@@ -61,11 +129,28 @@ int xmssmt_keypair(unsigned char *pk, unsigned char *sk, const uint32_t oid);
  * Returns
  * 1. an array containing the signature followed by the message AND
  * 2. an updated secret key!
+ * The changes to sk are recorded in `dirty` unless it is NULL.
  */
 #define xmssmt_sign XMSS_NAMESPACE(xmssmt_sign)
 int xmssmt_sign(unsigned char *sk,
                 unsigned char *sm, unsigned long long *smlen,
-                const unsigned char *m, unsigned long long mlen);
+                const unsigned char *m, unsigned long long mlen,
+                xmss_dirty_ranges *dirty);
+
+/**
+ * XMSSMT counterparts of xmss_sign_reserve() and xmss_sign_message().
+ */
+#define xmssmt_sign_reserve XMSS_NAMESPACE(xmssmt_sign_reserve)
+int xmssmt_sign_reserve(unsigned char *sk, unsigned char *sm, unsigned char *reservation,
+                        xmss_dirty_ranges *dirty);
+
+#define xmssmt_sign_message XMSS_NAMESPACE(xmssmt_sign_message)
+int xmssmt_sign_message(const unsigned char *reservation,
+                        unsigned char *sm, unsigned long long *smlen,
+                        const unsigned char *m, unsigned long long mlen);
+
+#define xmssmt_sign_message_init XMSS_NAMESPACE(xmssmt_sign_message_init)
+int xmssmt_sign_message_init(void **state, const unsigned char *reservation, unsigned char *sm);
 
 /**
  * Verifies a given message signature pair using a given public key.
@@ -79,6 +164,10 @@ int xmssmt_sign_open(const unsigned char *m, unsigned long long mlen,
                      const unsigned char *sm, unsigned long long smlen,
                      const unsigned char *pk);
 
+#define xmssmt_sign_open_init XMSS_NAMESPACE(xmssmt_sign_open_init)
+int xmssmt_sign_open_init(void **state, const unsigned char *sm, unsigned long long smlen,
+                          const unsigned char *pk);
+
 /* 
  * Write number of remaining signature to `remain` variable given `sk`
  */
@@ -91,4 +180,20 @@ int xmssmt_remaining_signatures(unsigned long long *remain, const unsigned  char
 #define xmssmt_total_signatures XMSS_NAMESPACE(xmssmt_total_signatures)
 int xmssmt_total_signatures(unsigned long long *max, const unsigned  char *sk);
 
+/*
+ * Shared by the streaming XMSS and XMSSMT functions above.
+ */
+#define xmss_xmssmt_inc_update XMSS_NAMESPACE(xmss_xmssmt_inc_update)
+int xmss_xmssmt_inc_update(void *state, const unsigned char *m, unsigned long long mlen);
+
+#define xmss_xmssmt_sign_message_final XMSS_NAMESPACE(xmss_xmssmt_sign_message_final)
+int xmss_xmssmt_sign_message_final(void *state, unsigned char *sm, unsigned long long *smlen);
+
+#define xmss_xmssmt_sign_open_final XMSS_NAMESPACE(xmss_xmssmt_sign_open_final)
+int xmss_xmssmt_sign_open_final(void *state, const unsigned char *sm);
+
+/* Frees the state of a streaming signature or verification that was not completed */
+#define xmss_xmssmt_inc_free XMSS_NAMESPACE(xmss_xmssmt_inc_free)
+void xmss_xmssmt_inc_free(void *state);
+
 #endif
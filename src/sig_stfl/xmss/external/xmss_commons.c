@@ -104,22 +104,27 @@ static void compute_root(const xmss_params *params, unsigned char *root,
  * Computes the leaf at a given address. First generates the WOTS key pair,
  * then computes leaf using l_tree. As this happens position independent, we
  * only require that addr encodes the right ltree-address.
+ * Returns -1 on memory allocation failure.
  */
-void gen_leaf_wots(const xmss_params *params, unsigned char *leaf,
-                   const unsigned char *sk_seed, const unsigned char *pub_seed,
-                   uint32_t ltree_addr[8], uint32_t ots_addr[8])
+int gen_leaf_wots(const xmss_params *params, unsigned char *leaf,
+                  const unsigned char *sk_seed, const unsigned char *pub_seed,
+                  uint32_t ltree_addr[8], uint32_t ots_addr[8])
 {
     unsigned char *pk = OQS_MEM_malloc(params->wots_sig_bytes + 2 * params->padding_len + 6 * params->n + 32);
     if (pk == NULL) {
-        return;
+        return -1;
     }
     unsigned char *thash_buf = pk + params->wots_sig_bytes;
 
-    wots_pkgen(params, pk, sk_seed, pub_seed, ots_addr);
+    if (wots_pkgen(params, pk, sk_seed, pub_seed, ots_addr) != 0) {
+        OQS_MEM_insecure_free(pk);
+        return -1;
+    }
 
     l_tree(params, leaf, pk, pub_seed, ltree_addr, thash_buf);
 
     OQS_MEM_insecure_free(pk);
+    return 0;
 }
 
 
@@ -148,12 +153,48 @@ int xmssmt_core_sign_open(const xmss_params *params,
                           const unsigned char *sm, unsigned long long smlen,
                           const unsigned char *pk)
 {
-    const unsigned char *pub_root = pk;
-    const unsigned char *pub_seed = pk + params->n;
+    xmss_inc_state state;
+    int ret;
+
+    // Unused since smlen is a constant
+    (void) smlen;
+
+    ret = xmssmt_core_sign_open_init(params, &state, sm, pk);
+    if (ret == 0) {
+        core_hash_inc_absorb(&state.hash, m, mlen);
+        ret = xmssmt_core_sign_open_final(&state, sm);
+    }
+
+    return ret;
+}
+
+int xmssmt_core_sign_open_init(const xmss_params *params, xmss_inc_state *state,
+                               const unsigned char *sm, const unsigned char *pk)
+{
+    unsigned long long idx;
+
+    state->params = *params;
+    memcpy(state->keys, pk, 2*params->n);
+
+    /* Convert the index bytes from the signature to an integer. */
+    idx = bytes_to_ull(sm, params->index_bytes);
+
+    /* Start the message hash; the message is absorbed by the caller. */
+    hash_message_init(params, &state->hash, sm + params->index_bytes, pk, idx);
+
+    return 0;
+}
+
+int xmssmt_core_sign_open_final(xmss_inc_state *state, const unsigned char *sm)
+{
+    const xmss_params *params = &state->params;
+    const unsigned char *pub_root = state->keys;
+    const unsigned char *pub_seed = state->keys + params->n;
 
     unsigned char *tmp = OQS_MEM_malloc(params->wots_sig_bytes + params->n + params->n +
                                 + 2 *params->n + 2 * params->padding_len + 6 * params->n + 32);
     if (tmp == NULL) {
+        core_hash_inc_release(&state->hash);
         return -1;
     }
     unsigned char *wots_pk = tmp;
@@ -162,12 +203,10 @@ int xmssmt_core_sign_open(const xmss_params *params,
     unsigned char *compute_root_buf = root + params->n;
     unsigned char *thash_buf = compute_root_buf + 2*params->n;
 
-    unsigned long long prefix_length = params->padding_len + 3*params->n;
-    unsigned long long m_with_prefix_len = mlen + prefix_length;
-    unsigned char *m_with_prefix = NULL;
     unsigned char *mhash = root;
     unsigned long long idx = 0;
-    unsigned int i, ret;
+    unsigned int i;
+    int ret;
     uint32_t idx_leaf;
 
     uint32_t ots_addr[8] = {0};
@@ -178,26 +217,14 @@ int xmssmt_core_sign_open(const xmss_params *params,
     set_type(ltree_addr, XMSS_ADDR_TYPE_LTREE);
     set_type(node_addr, XMSS_ADDR_TYPE_HASHTREE);
 
-    // Unused since smlen is a constant
-    (void) smlen;
-
-    if ((m_with_prefix_len == 0) || (m_with_prefix = OQS_MEM_malloc(m_with_prefix_len)) == NULL){
-        ret = -1;
-        goto fail;
-    }
-
     /* Convert the index bytes from the signature to an integer. */
     idx = bytes_to_ull(sm, params->index_bytes);
 
-    /* Put the message at the m_with_prefix buffer, so that we can
-     * prepend the required other inputs for the hash function. */
-    memcpy(m_with_prefix, sm + params->sig_bytes - prefix_length, (size_t)prefix_length);
-    memcpy(m_with_prefix + prefix_length, m, (size_t)mlen);
-
     /* Compute the message hash. */
-    hash_message(params, mhash, sm + params->index_bytes, pk, idx,
-                m_with_prefix,
-                 mlen);
+    if (core_hash_inc_finalize(params, mhash, &state->hash)) {
+        ret = -1;
+        goto fail;
+    }
     sm += params->index_bytes + params->n;
 
     /* For each subtree.. */
@@ -217,7 +244,10 @@ int xmssmt_core_sign_open(const xmss_params *params,
         set_ots_addr(ots_addr, idx_leaf);
         /* Initially, root = mhash, but on subsequent iterations it is the root
            of the subtree below the currently processed subtree. */
-        wots_pk_from_sig(params, wots_pk, sm, root, pub_seed, ots_addr);
+        if (wots_pk_from_sig(params, wots_pk, sm, root, pub_seed, ots_addr) != 0) {
+            ret = -1;
+            goto fail;
+        }
         sm += params->wots_sig_bytes;
 
         /* Compute the leaf node using the WOTS public key. */
@@ -238,7 +268,6 @@ int xmssmt_core_sign_open(const xmss_params *params,
     ret = 0;
 fail:
     OQS_MEM_insecure_free(tmp);
-    OQS_MEM_insecure_free(m_with_prefix);
     return ret;
 
 }
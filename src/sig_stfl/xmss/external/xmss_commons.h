@@ -4,16 +4,30 @@
 
 #include <stdint.h>
 #include "params.h"
+#include "core_hash.h"
+
+/**
+ * State of a streaming XMSS or XMSS^MT signature or verification, in which
+ * the message is absorbed into the message hash piece by piece.
+ */
+typedef struct {
+    xmss_params params;
+    core_hash_inc_ctx hash;
+    /* Signing: SK_SEED || SK_PRF || PUB_SEED || root,
+       verification: root || PUB_SEED */
+    unsigned char keys[4 * 64];
+} xmss_inc_state;
 
 /**
  * Computes the leaf at a given address. First generates the WOTS key pair,
  * then computes leaf using l_tree. As this happens position independent, we
  * only require that addr encodes the right ltree-address.
+ * Returns -1 on memory allocation failure.
  */
 #define gen_leaf_wots XMSS_INNER_NAMESPACE(gen_leaf_wots)
-void gen_leaf_wots(const xmss_params *params, unsigned char *leaf,
-                   const unsigned char *sk_seed, const unsigned char *pub_seed,
-                   uint32_t ltree_addr[8], uint32_t ots_addr[8]);
+int gen_leaf_wots(const xmss_params *params, unsigned char *leaf,
+                  const unsigned char *sk_seed, const unsigned char *pub_seed,
+                  uint32_t ltree_addr[8], uint32_t ots_addr[8]);
 
 /**
  * Verifies a given message signature pair under a given public key.
@@ -34,4 +48,20 @@ int xmssmt_core_sign_open(const xmss_params *params,
                           const unsigned char *m, unsigned long long mlen,
                           const unsigned char *sm, unsigned long long smlen,
                           const unsigned char *pk);
+
+/**
+ * Starts verifying the signature sm under pk ([root || PUB_SEED]): copies pk
+ * to `state` and absorbs the message hash prefix. The message is then
+ * absorbed into state->hash with core_hash_inc_absorb().
+ */
+#define xmssmt_core_sign_open_init XMSS_INNER_NAMESPACE(xmssmt_core_sign_open_init)
+int xmssmt_core_sign_open_init(const xmss_params *params, xmss_inc_state *state,
+                               const unsigned char *sm, const unsigned char *pk);
+
+/**
+ * Completes the message hash in `state` and verifies the signature sm that
+ * was passed to xmssmt_core_sign_open_init(). Releases state->hash.
+ */
+#define xmssmt_core_sign_open_final XMSS_INNER_NAMESPACE(xmssmt_core_sign_open_final)
+int xmssmt_core_sign_open_final(xmss_inc_state *state, const unsigned char *sm);
 #endif
@@ -3,6 +3,8 @@
 #define XMSS_CORE_H
 
 #include "params.h"
+#include "xmss_commons.h"
+#include "xmss.h"
 
 /**
  * Given a set of parameters, this function returns the size of the secret key.
@@ -25,13 +27,52 @@ int xmss_core_keypair(const xmss_params *params,
 
 /**
  * Signs a message. Returns an array containing the signature followed by the
- * message and an updated secret key.
+ * message and an updated secret key, whose changes are recorded in `dirty`
+ * unless it is NULL.
  */
 #define xmss_core_sign XMSS_INNER_NAMESPACE(xmss_core_sign)
 int xmss_core_sign(const xmss_params *params,
                    unsigned char *sk,
                    unsigned char *sm, unsigned long long *smlen,
-                   const unsigned char *m, unsigned long long mlen);
+                   const unsigned char *m, unsigned long long mlen,
+                   xmss_dirty_ranges *dirty);
+
+/**
+ * Reserves the next one-time key: writes the index and authentication path
+ * into sm, advances sk and copies the seeds and root to `seeds` (4 * n bytes).
+ * The changes to sk are recorded in `dirty` unless it is NULL.
+ */
+#define xmss_core_sign_reserve XMSS_INNER_NAMESPACE(xmss_core_sign_reserve)
+int xmss_core_sign_reserve(const xmss_params *params,
+                           unsigned char *sk,
+                           unsigned char *sm,
+                           unsigned char *seeds,
+                           xmss_dirty_ranges *dirty);
+
+/**
+ * Streaming form of xmss_xmssmt_core_sign_message(). The init step computes R
+ * into `sm` and absorbs the message hash prefix; the message is then absorbed
+ * into state->hash with core_hash_inc_absorb(), and the final step computes
+ * the WOTS signature and releases state->hash.
+ */
+#define xmss_xmssmt_core_sign_message_init XMSS_INNER_NAMESPACE(xmss_xmssmt_core_sign_message_init)
+int xmss_xmssmt_core_sign_message_init(const xmss_params *params,
+                                       xmss_inc_state *state,
+                                       const unsigned char *seeds,
+                                       unsigned char *sm);
+
+#define xmss_xmssmt_core_sign_message_final XMSS_INNER_NAMESPACE(xmss_xmssmt_core_sign_message_final)
+int xmss_xmssmt_core_sign_message_final(xmss_inc_state *state,
+                                        unsigned char *sm, unsigned long long *smlen);
+
+/**
+ * Completes an XMSS or XMSSMT signature on m from a reservation.
+ */
+#define xmss_xmssmt_core_sign_message XMSS_INNER_NAMESPACE(xmss_xmssmt_core_sign_message)
+int xmss_xmssmt_core_sign_message(const xmss_params *params,
+                                  const unsigned char *seeds,
+                                  unsigned char *sm, unsigned long long *smlen,
+                                  const unsigned char *m, unsigned long long mlen);
 
 /**
  * Verifies a given message signature pair under a given public key.
@@ -65,13 +106,25 @@ int xmssmt_core_seed_keypair(const xmss_params *params,
 
 /**
  * Signs a message. Returns an array containing the signature followed by the
- * message and an updated secret key.
+ * message and an updated secret key, whose changes are recorded in `dirty`
+ * unless it is NULL.
  */
 #define xmssmt_core_sign XMSS_INNER_NAMESPACE(xmssmt_core_sign)
 int xmssmt_core_sign(const xmss_params *params,
                      unsigned char *sk,
                      unsigned char *sm, unsigned long long *smlen,
-                     const unsigned char *m, unsigned long long mlen);
+                     const unsigned char *m, unsigned long long mlen,
+                     xmss_dirty_ranges *dirty);
+
+/**
+ * XMSSMT counterpart of xmss_core_sign_reserve().
+ */
+#define xmssmt_core_sign_reserve XMSS_INNER_NAMESPACE(xmssmt_core_sign_reserve)
+int xmssmt_core_sign_reserve(const xmss_params *params,
+                             unsigned char *sk,
+                             unsigned char *sm,
+                             unsigned char *seeds,
+                             xmss_dirty_ranges *dirty);
 
 /**
  * Verifies a given message signature pair under a given public key.
@@ -29,8 +29,99 @@ typedef struct {
     treehash_inst *treehash;
     unsigned char *retain;
     unsigned long long next_leaf;
+    xmss_dirty_ranges *dirty;
 } bds_state;
 
+/**
+ * Records that len bytes of the secret key, starting at p, have been written.
+ * Overlapping or nearby ranges are merged; when all ranges are in use, the new
+ * one is merged with a neighbour.
+ */
+static void mark_dirty(xmss_dirty_ranges *dirty, const unsigned char *p,
+                       unsigned long long len)
+{
+    unsigned long long start, end;
+    unsigned int i, j;
+
+    if (dirty == NULL || len == 0) {
+        return;
+    }
+    start = (unsigned long long)(p - dirty->base);
+    end = start + len;
+
+    /* Ranges i .. j-1 are merged with [start, end) */
+    i = 0;
+    while (i < dirty->count && dirty->range[i].offset + dirty->range[i].len + XMSS_DIRTY_RANGES_GAP < start) {
+        i++;
+    }
+    j = i;
+    while (j < dirty->count && dirty->range[j].offset <= end + XMSS_DIRTY_RANGES_GAP) {
+        j++;
+    }
+    if (i == j && dirty->count == XMSS_DIRTY_RANGES_MAX) {
+        if (i == dirty->count) {
+            i--;
+        }
+        else {
+            j++;
+        }
+    }
+    if (i < j) {
+        if (dirty->range[i].offset < start) {
+            start = dirty->range[i].offset;
+        }
+        if (dirty->range[j-1].offset + dirty->range[j-1].len > end) {
+            end = dirty->range[j-1].offset + dirty->range[j-1].len;
+        }
+    }
+
+    memmove(&dirty->range[i+1], &dirty->range[j], (dirty->count - j) * sizeof(dirty->range[0]));
+    dirty->count = dirty->count + 1 - (j - i);
+    dirty->range[i].offset = start;
+    dirty->range[i].len = end - start;
+}
+
+/**
+ * Hands the ranges recorded so far to the caller, see xmss_dirty_ranges.
+ * Returns non-zero if signing has to be aborted.
+ */
+static int flush_dirty(xmss_dirty_ranges *dirty)
+{
+    if (dirty == NULL || dirty->flush == NULL) {
+        return 0;
+    }
+    return dirty->flush(dirty);
+}
+
+/**
+ * ull_to_bytes() for a field of the secret key that is recorded in dirty if
+ * its value changes.
+ */
+static void store_field(xmss_dirty_ranges *dirty, unsigned char *out,
+                        unsigned int outlen, unsigned long long in)
+{
+    unsigned char buf[8];
+
+    ull_to_bytes(buf, outlen, in);
+    if (memcmp(out, buf, outlen) != 0) {
+        memcpy(out, buf, outlen);
+        mark_dirty(dirty, out, outlen);
+    }
+}
+
+/* Size of one serialized BDS state, which is stored from state->stack on. */
+static unsigned long long bds_state_bytes(const xmss_params *params)
+{
+    return (params->tree_height + 1) * params->n
+        + 4
+        + params->tree_height + 1
+        + params->tree_height * params->n
+        + (params->tree_height >> 1) * params->n
+        + (params->tree_height - params->bds_k) * (7 + params->n)
+        + ((1 << params->bds_k) - params->bds_k - 1) * params->n
+        + 4;
+}
+
 /* These serialization functions provide a transition between the current
    way of storing the state in an exposed struct, and storing it as part of the
    byte array that is the secret key.
@@ -47,7 +138,7 @@ static void xmssmt_serialize_state(const xmss_params *params,
     for (i = 0; i < 2*params->d - 1; i++) {
         sk += (params->tree_height + 1) * params->n; /* stack */
 
-        ull_to_bytes(sk, 4, states[i].stackoffset);
+        store_field(states[i].dirty, sk, 4, states[i].stackoffset);
         sk += 4;
 
         sk += params->tree_height + 1; /* stacklevels */
@@ -55,16 +146,16 @@ static void xmssmt_serialize_state(const xmss_params *params,
         sk += (params->tree_height >> 1) * params->n; /* keep */
 
         for (j = 0; j < params->tree_height - params->bds_k; j++) {
-            ull_to_bytes(sk, 1, states[i].treehash[j].h);
+            store_field(states[i].dirty, sk, 1, states[i].treehash[j].h);
             sk += 1;
 
-            ull_to_bytes(sk, 4, states[i].treehash[j].next_idx);
+            store_field(states[i].dirty, sk, 4, states[i].treehash[j].next_idx);
             sk += 4;
 
-            ull_to_bytes(sk, 1, states[i].treehash[j].stackusage);
+            store_field(states[i].dirty, sk, 1, states[i].treehash[j].stackusage);
             sk += 1;
 
-            ull_to_bytes(sk, 1, states[i].treehash[j].completed);
+            store_field(states[i].dirty, sk, 1, states[i].treehash[j].completed);
             sk += 1;
 
             sk += params->n; /* node */
@@ -73,7 +164,7 @@ static void xmssmt_serialize_state(const xmss_params *params,
         /* retain */
         sk += ((1 << params->bds_k) - params->bds_k - 1) * params->n;
 
-        ull_to_bytes(sk, 4, states[i].next_leaf);
+        store_field(states[i].dirty, sk, 4, states[i].next_leaf);
         sk += 4;
     }
 }
@@ -81,7 +172,8 @@ static void xmssmt_serialize_state(const xmss_params *params,
 static void xmssmt_deserialize_state(const xmss_params *params,
                                      bds_state *states,
                                      unsigned char **wots_sigs,
-                                     unsigned char *sk)
+                                     unsigned char *sk,
+                                     xmss_dirty_ranges *dirty)
 {
     unsigned int i, j;
 
@@ -92,6 +184,8 @@ static void xmssmt_deserialize_state(const xmss_params *params,
     // TODO (from upstream) They should be reconsidered / motivated more explicitly
 
     for (i = 0; i < 2*params->d - 1; i++) {
+        states[i].dirty = dirty;
+
         states[i].stack = sk;
         sk += (params->tree_height + 1) * params->n;
 
@@ -143,9 +237,10 @@ static void xmss_serialize_state(const xmss_params *params,
 }
 
 static void xmss_deserialize_state(const xmss_params *params,
-                                   bds_state *state, unsigned char *sk)
+                                   bds_state *state, unsigned char *sk,
+                                   xmss_dirty_ranges *dirty)
 {
-    xmssmt_deserialize_state(params, state, NULL, sk);
+    xmssmt_deserialize_state(params, state, NULL, sk, dirty);
 }
 
 static void memswap(void *a, void *b, void *t, unsigned long long len)
@@ -198,6 +293,9 @@ static void deep_state_swap(const xmss_params *params,
     memswap(a->retain, b->retain, t, ((1 << params->bds_k) - params->bds_k - 1) * params->n);
     memswap(&a->next_leaf, &b->next_leaf, t, sizeof(a->next_leaf));
 
+    mark_dirty(a->dirty, a->stack, bds_state_bytes(params));
+    mark_dirty(b->dirty, b->stack, bds_state_bytes(params));
+
     OQS_MEM_secure_free(t, t_size);
 }
 
@@ -218,12 +316,12 @@ static int treehash_minheight_on_stack(const xmss_params *params,
 /**
  * Merkle's TreeHash algorithm. The address only needs to initialize the first 78 bits of addr. Everything else will be set by treehash.
  * Currently only used for key generation.
- *
+ * Returns -1 on memory allocation failure.
  */
-static void treehash_init(const xmss_params *params,
-                          unsigned char *node, int height, int index,
-                          bds_state *state, const unsigned char *sk_seed,
-                          const unsigned char *pub_seed, const uint32_t addr[8])
+static int treehash_init(const xmss_params *params,
+                         unsigned char *node, int height, int index,
+                         bds_state *state, const unsigned char *sk_seed,
+                         const unsigned char *pub_seed, const uint32_t addr[8])
 {
     // use three different addresses because at this point we use all three formats in parallel
     uint32_t ots_addr[8] = {0};
@@ -246,9 +344,10 @@ static void treehash_init(const xmss_params *params,
     unsigned char *stack = OQS_MEM_calloc((height+1)*params->n, sizeof(unsigned char));
     unsigned int *stacklevels = OQS_MEM_malloc((height + 1)*sizeof(unsigned int));
     unsigned char *thash_buf = OQS_MEM_malloc(thash_buf_size);
+    int ret = -1;
 
     if (stack == NULL || stacklevels == NULL || thash_buf == NULL) {
-        return;
+        goto cleanup;
     }
 
     unsigned int stackoffset=0;
@@ -264,7 +363,9 @@ static void treehash_init(const xmss_params *params,
     for (; idx < lastnode; idx++) {
         set_ltree_addr(ltree_addr, idx);
         set_ots_addr(ots_addr, idx);
-        gen_leaf_wots(params, stack+stackoffset*params->n, sk_seed, pub_seed, ltree_addr, ots_addr);
+        if (gen_leaf_wots(params, stack+stackoffset*params->n, sk_seed, pub_seed, ltree_addr, ots_addr) != 0) {
+            goto cleanup;
+        }
         stacklevels[stackoffset] = 0;
         stackoffset++;
         if (params->tree_height - params->bds_k > 0 && i == 3) {
@@ -293,10 +394,13 @@ static void treehash_init(const xmss_params *params,
     }
 
     memcpy(node, stack, params->n);
+    ret = 0;
 
+cleanup:
     OQS_MEM_insecure_free(stacklevels);
     OQS_MEM_secure_free(stack, stack_size);
     OQS_MEM_secure_free(thash_buf, thash_buf_size);
+    return ret;
 }
 
 static void treehash_update(const xmss_params *params,
@@ -342,12 +446,15 @@ static void treehash_update(const xmss_params *params,
     }
     if (nodeheight == treehash->h) { // this also implies stackusage == 0
         memcpy(treehash->node, nodebuffer, params->n);
+        mark_dirty(state->dirty, treehash->node, params->n);
         treehash->completed = 1;
     }
     else {
         memcpy(state->stack + state->stackoffset*params->n, nodebuffer, params->n);
+        mark_dirty(state->dirty, state->stack + state->stackoffset*params->n, params->n);
         treehash->stackusage++;
         state->stacklevels[state->stackoffset] = nodeheight;
+        mark_dirty(state->dirty, state->stacklevels + state->stackoffset, 1);
         state->stackoffset++;
         treehash->next_idx++;
     }
@@ -438,30 +545,39 @@ static char bds_state_update(const xmss_params *params,
     set_ltree_addr(ltree_addr, idx);
 
     gen_leaf_wots(params, state->stack+state->stackoffset*params->n, sk_seed, pub_seed, ltree_addr, ots_addr);
+    mark_dirty(state->dirty, state->stack+state->stackoffset*params->n, params->n);
 
     state->stacklevels[state->stackoffset] = 0;
+    mark_dirty(state->dirty, state->stacklevels+state->stackoffset, 1);
     state->stackoffset++;
     if (params->tree_height - params->bds_k > 0 && idx == 3) {
         memcpy(state->treehash[0].node, state->stack+state->stackoffset*params->n, params->n);
+        mark_dirty(state->dirty, state->treehash[0].node, params->n);
     }
     while (state->stackoffset>1 && state->stacklevels[state->stackoffset-1] == state->stacklevels[state->stackoffset-2]) {
         nodeh = state->stacklevels[state->stackoffset-1];
         if (idx >> nodeh == 1) {
             memcpy(state->auth + nodeh*params->n, state->stack+(state->stackoffset-1)*params->n, params->n);
+            mark_dirty(state->dirty, state->auth + nodeh*params->n, params->n);
         }
         else {
             if (nodeh < params->tree_height - params->bds_k && idx >> nodeh == 3) {
                 memcpy(state->treehash[nodeh].node, state->stack+(state->stackoffset-1)*params->n, params->n);
+                mark_dirty(state->dirty, state->treehash[nodeh].node, params->n);
             }
             else if (nodeh >= params->tree_height - params->bds_k) {
-                memcpy(state->retain + ((1 << (params->tree_height - 1 - nodeh)) + nodeh - params->tree_height + (((idx >> nodeh) - 3) >> 1)) * params->n, state->stack+(state->stackoffset-1)*params->n, params->n);
+                unsigned char *retain_node = state->retain + ((1 << (params->tree_height - 1 - nodeh)) + nodeh - params->tree_height + (((idx >> nodeh) - 3) >> 1)) * params->n;
+                memcpy(retain_node, state->stack+(state->stackoffset-1)*params->n, params->n);
+                mark_dirty(state->dirty, retain_node, params->n);
             }
         }
         set_tree_height(node_addr, state->stacklevels[state->stackoffset-1]);
         set_tree_index(node_addr, (idx >> (state->stacklevels[state->stackoffset-1]+1)));
         thash_h(params, state->stack+(state->stackoffset-2)*params->n, state->stack+(state->stackoffset-2)*params->n, pub_seed, node_addr, thash_buf);
+        mark_dirty(state->dirty, state->stack+(state->stackoffset-2)*params->n, params->n);
 
         state->stacklevels[state->stackoffset-2]++;
+        mark_dirty(state->dirty, state->stacklevels+state->stackoffset-2, 1);
         state->stackoffset--;
     }
     state->next_leaf++;
@@ -518,11 +634,13 @@ static void bds_round(const xmss_params *params,
     }
     if (!((leaf_idx >> (tau + 1)) & 1) && (tau < params->tree_height - 1)) {
         memcpy(state->keep + (tau >> 1)*params->n, state->auth + tau*params->n, params->n);
+        mark_dirty(state->dirty, state->keep + (tau >> 1)*params->n, params->n);
     }
     if (tau == 0) {
         set_ltree_addr(ltree_addr, leaf_idx);
         set_ots_addr(ots_addr, leaf_idx);
         gen_leaf_wots(params, state->auth, sk_seed, pub_seed, ltree_addr, ots_addr);
+        mark_dirty(state->dirty, state->auth, params->n);
     }
     else {
         set_tree_height(node_addr, (tau-1));
@@ -538,6 +656,8 @@ static void bds_round(const xmss_params *params,
                 memcpy(state->auth + i * params->n, state->retain + (offset + rowidx) * params->n, params->n);
             }
         }
+        /* auth nodes 0 .. tau */
+        mark_dirty(state->dirty, state->auth, (tau + 1) * params->n);
 
         for (i = 0; i < ((tau < params->tree_height - params->bds_k) ? tau : (params->tree_height - params->bds_k)); i++) {
             startidx = leaf_idx + 1 + 3 * (1 << i);
@@ -563,16 +683,7 @@ static void bds_round(const xmss_params *params,
 unsigned long long xmss_xmssmt_core_sk_bytes(const xmss_params *params)
 {
     return params->index_bytes + 4 * params->n
-        + (2 * params->d - 1) * (
-            (params->tree_height + 1) * params->n
-            + 4
-            + params->tree_height + 1
-            + params->tree_height * params->n
-            + (params->tree_height >> 1) * params->n
-            + (params->tree_height - params->bds_k) * (7 + params->n)
-            + ((1 << params->bds_k) - params->bds_k - 1) * params->n
-            + 4
-         )
+        + (2 * params->d - 1) * bds_state_bytes(params)
         + (params->d - 1) * params->wots_sig_bytes;
 }
 
@@ -595,7 +706,7 @@ int xmss_core_keypair(const xmss_params *params,
     }
     state.treehash = treehash;
 
-    xmss_deserialize_state(params, &state, sk);
+    xmss_deserialize_state(params, &state, sk, NULL);
 
     state.stackoffset = 0;
     state.next_leaf = 0;
@@ -614,7 +725,10 @@ int xmss_core_keypair(const xmss_params *params,
     memcpy(pk + params->n, sk + params->index_bytes + 3*params->n, params->n);
 
     // Compute root
-    treehash_init(params, pk, params->tree_height, 0, &state, sk + params->index_bytes, sk + params->index_bytes + 3*params->n, addr);
+    if (treehash_init(params, pk, params->tree_height, 0, &state, sk + params->index_bytes, sk + params->index_bytes + 3*params->n, addr) != 0) {
+        OQS_MEM_secure_free(treehash, treehash_size);
+        return -1;
+    }
     // copy root to sk
     memcpy(sk + params->index_bytes + 2*params->n, pk, params->n);
 
@@ -627,27 +741,134 @@ int xmss_core_keypair(const xmss_params *params,
 }
 
 /**
- * Signs a message.
- * Returns
- * 1. an array containing the signature followed by the message AND
- * 2. an updated secret key!
+ * Computes the message-dependent part of an XMSS or XMSS^MT signature whose
+ * one-time key was reserved with xmss_core_sign_reserve() or
+ * xmssmt_core_sign_reserve(): the randomizer R, the message hash and the
+ * bottom-layer WOTS signature. `seeds` holds SK_SEED || SK_PRF || PUB_SEED ||
+ * root as written by the reservation and the index is read back from `sm`.
  *
+ * This only reads `seeds` and writes `sm`, so it needs no access to the
+ * secret key and can run outside the secret key lock.
  */
-int xmss_core_sign(const xmss_params *params,
-                   unsigned char *sk,
-                   unsigned char *sm, unsigned long long *smlen,
-                   const unsigned char *m, unsigned long long mlen)
+int xmss_xmssmt_core_sign_message(const xmss_params *params,
+                                  const unsigned char *seeds,
+                                  unsigned char *sm, unsigned long long *smlen,
+                                  const unsigned char *m, unsigned long long mlen)
+{
+    xmss_inc_state state;
+    int ret;
+
+    ret = xmss_xmssmt_core_sign_message_init(params, &state, seeds, sm);
+    if (ret == 0) {
+        core_hash_inc_absorb(&state.hash, m, mlen);
+        ret = xmss_xmssmt_core_sign_message_final(&state, sm, smlen);
+    }
+    OQS_MEM_cleanse(&state, sizeof(state));
+
+    return ret;
+}
+
+int xmss_xmssmt_core_sign_message_init(const xmss_params *params,
+                                       xmss_inc_state *state,
+                                       const unsigned char *seeds,
+                                       unsigned char *sm)
+{
+    const unsigned char *sk_prf = seeds + params->n;
+    const unsigned char *pub_root = seeds + 3*params->n;
+    const size_t prf_buf_size = params->padding_len + params->n + 32;
+    unsigned char *prf_buf = OQS_MEM_malloc(prf_buf_size);
+    unsigned char idx_bytes_32[32];
+    unsigned long long idx = 0;
+    unsigned int i;
+
+    if (prf_buf == NULL) {
+        return -1;
+    }
+
+    state->params = *params;
+    memcpy(state->keys, seeds, 4*params->n);
+
+    for (i = 0; i < params->index_bytes; i++) {
+        idx |= ((unsigned long long)sm[i]) << 8*(params->index_bytes - 1 - i);
+    }
+
+    // ---------------------------------
+    // Message Hashing
+    // ---------------------------------
+
+    // Message Hash:
+    // First compute pseudorandom value, directly into its place in the signature
+    ull_to_bytes(idx_bytes_32, 32, idx);
+    prf(params, sm + params->index_bytes, idx_bytes_32, sk_prf, prf_buf);
+
+    /* Start the message hash; the message is absorbed by the caller. */
+    hash_message_init(params, &state->hash, sm + params->index_bytes, pub_root, idx);
+
+    OQS_MEM_secure_free(prf_buf, prf_buf_size);
+
+    return 0;
+}
+
+int xmss_xmssmt_core_sign_message_final(xmss_inc_state *state,
+                                        unsigned char *sm, unsigned long long *smlen)
+{
+    const xmss_params *params = &state->params;
+    const unsigned char *sk_seed = state->keys;
+    const unsigned char *pub_seed = state->keys + 2*params->n;
+    unsigned char msg_h[64];
+    uint32_t ots_addr[8] = {0};
+    unsigned long long idx = 0;
+    unsigned int i;
+
+    /* Compute the message hash. */
+    if (core_hash_inc_finalize(params, msg_h, &state->hash)) {
+        return -1;
+    }
+
+    for (i = 0; i < params->index_bytes; i++) {
+        idx |= ((unsigned long long)sm[i]) << 8*(params->index_bytes - 1 - i);
+    }
+
+    // ----------------------------------
+    // Now we start to "really sign"
+    // ----------------------------------
+
+    // Prepare Address
+    set_type(ots_addr, 0);
+    set_layer_addr(ots_addr, 0);
+    set_tree_addr(ots_addr, idx >> params->tree_height);
+    set_ots_addr(ots_addr, (uint32_t)(idx & ((1ULL << params->tree_height) - 1)));
+
+    // Compute WOTS signature
+    if (wots_sign(params, sm + params->index_bytes + params->n, msg_h, sk_seed, pub_seed, ots_addr) != 0) {
+        return -1;
+    }
+
+    *smlen = params->sig_bytes;
+
+    return 0;
+}
+
+/**
+ * Reserves the next one-time key of an XMSS secret key.
+ * Writes the index and the authentication path into their places in `sm`,
+ * copies SK_SEED || SK_PRF || PUB_SEED || root (4 * n bytes) to `seeds` and
+ * advances the index and the BDS traversal state in `sk`. The signature is
+ * completed by xmss_xmssmt_core_sign_message().
+ */
+int xmss_core_sign_reserve(const xmss_params *params,
+                           unsigned char *sk,
+                           unsigned char *sm,
+                           unsigned char *seeds,
+                           xmss_dirty_ranges *dirty)
 {
     if (params->full_height > 60) {
         // Unsupport Tree height
         return -2;
     }
 
-    const unsigned char *pub_root = sk + params->index_bytes + 2*params->n;
     int ret;
 
-    uint16_t i = 0;
-
     // TODO (from upstream) refactor BDS state not to need separate treehash instances
     bds_state state;
     const size_t treehash_size = (params->tree_height - params->bds_k) * sizeof(treehash_inst);
@@ -655,12 +876,14 @@ int xmss_core_sign(const xmss_params *params,
     treehash_inst *treehash = OQS_MEM_calloc(params->tree_height - params->bds_k, sizeof(treehash_inst));
     unsigned char *tmp = OQS_MEM_malloc(tmp_size);
     if (treehash == NULL || tmp == NULL) {
+        OQS_MEM_insecure_free(treehash);
+        OQS_MEM_insecure_free(tmp);
         return -1;
     }
 
     state.treehash = treehash;
     /* Load the BDS state from sk. */
-    xmss_deserialize_state(params, &state, sk);
+    xmss_deserialize_state(params, &state, sk, dirty);
 
     // Extract SK
     unsigned long long idx = ((unsigned long long)sk[0] << 24) | ((unsigned long long)sk[1] << 16) | ((unsigned long long)sk[2] << 8) | sk[3];
@@ -681,6 +904,7 @@ int xmss_core_sign(const xmss_params *params,
         // has to make sure that this happens on disk.
         OQS_MEM_cleanse(sk, params->index_bytes);
         OQS_MEM_cleanse(sk + params->index_bytes, (size_t)(params->sk_bytes - params->index_bytes));
+        mark_dirty(dirty, sk, params->sk_bytes);
         if (idx > ((1ULL << params->full_height) - 1)) {
             ret = -2; // We already used all one-time keys
             goto cleanup;
@@ -690,14 +914,15 @@ int xmss_core_sign(const xmss_params *params,
     unsigned char *sk_seed = tmp;
     unsigned char *sk_prf = sk_seed + params->n;
     unsigned char *pub_seed = sk_prf + params->n;
+    uint32_t ots_addr[8] = {0};
 
     memcpy(sk_seed, sk + params->index_bytes, params->n);
     memcpy(sk_prf, sk + params->index_bytes + params->n, params->n);
     memcpy(pub_seed, sk + params->index_bytes + 3*params->n, params->n);
 
-    // index as 32 bytes string
-    unsigned char idx_bytes_32[32];
-    ull_to_bytes(idx_bytes_32, 32, idx);
+    memcpy(seeds, sk_seed, 2*params->n);
+    memcpy(seeds + 2*params->n, pub_seed, params->n);
+    memcpy(seeds + 3*params->n, sk + params->index_bytes + 2*params->n, params->n);
 
     // Update SK
     sk[0] = ((idx + 1) >> 24) & 255;
@@ -707,39 +932,12 @@ int xmss_core_sign(const xmss_params *params,
     // Secret key for this non-forward-secure version is now updated.
     // A production implementation should consider using a file handle instead,
     //  and write the updated secret key at this point!
-
-    // Init working params
-    unsigned char *R = pub_seed + params->n;
-    unsigned char *msg_h = R + params->n;
-    unsigned char *prf_buf = msg_h + params->n;
-    uint32_t ots_addr[8] = {0};
-
-    // ---------------------------------
-    // Message Hashing
-    // ---------------------------------
-
-    // Message Hash:
-    // First compute pseudorandom value
-    prf(params, R, idx_bytes_32, sk_prf, prf_buf);
-
-    /* Already put the message in the right place, to make it easier to prepend
-     * things when computing the hash over the message. */
-    unsigned long long prefix_length = params->padding_len + 3*params->n;
-    unsigned char *m_with_prefix = OQS_MEM_malloc((size_t)(mlen + prefix_length));
-    if (m_with_prefix == NULL) {
+    // With a tracker, the caller gets to do that before the BDS state changes.
+    mark_dirty(dirty, sk, params->index_bytes);
+    if (flush_dirty(dirty) != 0) {
         ret = -1;
         goto cleanup;
     }
-    memcpy(m_with_prefix, sm + params->sig_bytes - prefix_length, (size_t)prefix_length);
-    memcpy(m_with_prefix + prefix_length, m, (size_t)mlen);
-
-    /* Compute the message hash. */
-    hash_message(params, msg_h, R, pub_root, idx,
-                 m_with_prefix,
-                 mlen);
-
-    // Start collecting signature
-    *smlen = 0;
 
     // Copy index to signature
     sm[0] = (idx >> 24) & 255;
@@ -747,48 +945,23 @@ int xmss_core_sign(const xmss_params *params,
     sm[2] = (idx >> 8) & 255;
     sm[3] = idx & 255;
 
-    sm += 4;
-    *smlen += 4;
-
-    // Copy R to signature
-    for (i = 0; i < params->n; i++) {
-        sm[i] = R[i];
-    }
-
-    sm += params->n;
-    *smlen += params->n;
-
-    // ----------------------------------
-    // Now we start to "really sign"
-    // ----------------------------------
+    // the auth path was already computed during the previous round
+    memcpy(sm + params->index_bytes + params->n + params->wots_sig_bytes, state.auth, params->tree_height*params->n);
 
     // Prepare Address
     set_type(ots_addr, 0);
     set_ots_addr(ots_addr, (uint32_t) idx);
 
-    // Compute WOTS signature
-    wots_sign(params, sm, msg_h, sk_seed, pub_seed, ots_addr);
-
-    sm += params->wots_sig_bytes;
-    *smlen += params->wots_sig_bytes;
-
-    // the auth path was already computed during the previous round
-    memcpy(sm, state.auth, params->tree_height*params->n);
-
     if (idx < (1ULL << params->tree_height) - 1) {
         bds_round(params, &state, (const unsigned long)idx, sk_seed, pub_seed, ots_addr);
         bds_treehash_update(params, &state, (params->tree_height - params->bds_k) >> 1, sk_seed, pub_seed, ots_addr);
     }
 
-    *smlen += params->tree_height*params->n;
-
     /* Write the updated BDS state back into sk. */
     xmss_serialize_state(params, sk, &state);
 
     ret = 0;
 
-    OQS_MEM_insecure_free(m_with_prefix);
-
 cleanup:
     OQS_MEM_secure_free(tmp, tmp_size);
     OQS_MEM_secure_free(treehash, treehash_size);
@@ -796,6 +969,34 @@ cleanup:
     return ret;
 }
 
+/**
+ * Signs a message.
+ * Returns
+ * 1. an array containing the signature followed by the message AND
+ * 2. an updated secret key!
+ *
+ */
+int xmss_core_sign(const xmss_params *params,
+                   unsigned char *sk,
+                   unsigned char *sm, unsigned long long *smlen,
+                   const unsigned char *m, unsigned long long mlen,
+                   xmss_dirty_ranges *dirty)
+{
+    unsigned char *seeds = OQS_MEM_malloc(4 * params->n);
+    int ret;
+
+    if (seeds == NULL) {
+        return -1;
+    }
+    ret = xmss_core_sign_reserve(params, sk, sm, seeds, dirty);
+    if (ret == 0) {
+        ret = xmss_xmssmt_core_sign_message(params, seeds, sm, smlen, m, mlen);
+    }
+    OQS_MEM_secure_free(seeds, 4 * params->n);
+
+    return ret;
+}
+
 /*
  * Generates a XMSSMT key pair for a given parameter set.
  * Format sk: [(ceil(h/8) bit) idx || SK_SEED || SK_PRF || root || PUB_SEED]
@@ -807,6 +1008,7 @@ int xmssmt_core_keypair(const xmss_params *params,
     uint32_t addr[8] = {0};
     unsigned int i;
     unsigned char *wots_sigs;
+    int ret = -1;
 
     // TODO (from upstream) refactor BDS state not to need separate treehash instances
     const size_t states_size = (2*params->d - 1)* sizeof(bds_state);
@@ -814,13 +1016,13 @@ int xmssmt_core_keypair(const xmss_params *params,
     bds_state *states = OQS_MEM_calloc(2*params->d - 1, sizeof(bds_state));
     treehash_inst *treehash = OQS_MEM_calloc((2*params->d - 1) * (params->tree_height - params->bds_k), sizeof(treehash_inst));
     if (states == NULL || treehash == NULL) {
-        return -1;
+        goto cleanup;
     }
     for (i = 0; i < 2*params->d - 1; i++) {
         states[i].treehash = treehash + i * (params->tree_height - params->bds_k);
     }
 
-    xmssmt_deserialize_state(params, states, &wots_sigs, sk);
+    xmssmt_deserialize_state(params, states, &wots_sigs, sk, NULL);
 
     for (i = 0; i < 2 * params->d - 1; i++) {
         states[i].stackoffset = 0;
@@ -844,41 +1046,49 @@ int xmssmt_core_keypair(const xmss_params *params,
     // Set up state and compute wots signatures for all but topmost tree root
     for (i = 0; i < params->d - 1; i++) {
         // Compute seed for OTS key pair
-        treehash_init(params, pk, params->tree_height, 0, states + i, sk+params->index_bytes, pk+params->n, addr);
+        if (treehash_init(params, pk, params->tree_height, 0, states + i, sk+params->index_bytes, pk+params->n, addr) != 0) {
+            goto cleanup;
+        }
         set_layer_addr(addr, (i+1));
-        wots_sign(params, wots_sigs + i*params->wots_sig_bytes, pk, sk + params->index_bytes, pk+params->n, addr);
+        if (wots_sign(params, wots_sigs + i*params->wots_sig_bytes, pk, sk + params->index_bytes, pk+params->n, addr) != 0) {
+            goto cleanup;
+        }
     }
     // Address now points to the single tree on layer d-1
-    treehash_init(params, pk, params->tree_height, 0, states + i, sk+params->index_bytes, pk+params->n, addr);
+    if (treehash_init(params, pk, params->tree_height, 0, states + i, sk+params->index_bytes, pk+params->n, addr) != 0) {
+        goto cleanup;
+    }
     memcpy(sk + params->index_bytes + 2*params->n, pk, params->n);
 
     xmssmt_serialize_state(params, sk, states);
+    ret = 0;
 
+cleanup:
     OQS_MEM_secure_free(treehash, treehash_size);
     OQS_MEM_secure_free(states, states_size);
 
-    return 0;
+    return ret;
 }
 
 /**
- * Signs a message.
- * Returns
- * 1. an array containing the signature followed by the message AND
- * 2. an updated secret key!
- *
+ * Reserves the next one-time key of an XMSS^MT secret key.
+ * Writes the index, the bottom authentication path and the cached signatures
+ * and authentication paths of the upper layers into their places in `sm`,
+ * copies SK_SEED || SK_PRF || PUB_SEED || root (4 * n bytes) to `seeds` and
+ * advances the index and the BDS traversal states in `sk`. The signature is
+ * completed by xmss_xmssmt_core_sign_message().
  */
-int xmssmt_core_sign(const xmss_params *params,
-                     unsigned char *sk,
-                     unsigned char *sm, unsigned long long *smlen,
-                     const unsigned char *m, unsigned long long mlen)
+int xmssmt_core_sign_reserve(const xmss_params *params,
+                             unsigned char *sk,
+                             unsigned char *sm,
+                             unsigned char *seeds,
+                             xmss_dirty_ranges *dirty)
 {
     if (params == NULL || params->full_height > 60) {
         // Unsupport parameter
         return -1;
     }
 
-    const unsigned char *pub_root = sk + params->index_bytes + 2*params->n;
-
     uint64_t idx_tree;
     uint32_t idx_leaf;
     unsigned int i, j;
@@ -888,30 +1098,23 @@ int xmssmt_core_sign(const xmss_params *params,
     // TODO (from upstream) refactor BDS state not to need separate treehash instances
     const size_t states_size = (2*params->d - 1)* sizeof(bds_state);
     const size_t treehash_size = (2*params->d - 1) * (params->tree_height - params->bds_k) * sizeof(treehash_inst);
-    const size_t tmp_size = 5 * params->n +
-                                params->padding_len + params->n + 32;
+    const size_t tmp_size = 3 * params->n;
     bds_state *states = OQS_MEM_calloc(2*params->d - 1, sizeof(bds_state));
     treehash_inst *treehash = OQS_MEM_calloc((2*params->d - 1) * (params->tree_height - params->bds_k), sizeof(treehash_inst));
-    unsigned char *tmp = OQS_MEM_malloc(5 * params->n +
-                                params->padding_len + params->n + 32);
+    unsigned char *tmp = OQS_MEM_malloc(tmp_size);
     if (states == NULL || treehash == NULL || tmp == NULL) {
+        OQS_MEM_insecure_free(states);
+        OQS_MEM_insecure_free(treehash);
+        OQS_MEM_insecure_free(tmp);
         return -1;
     }
     unsigned char *sk_seed = tmp;
     unsigned char *sk_prf = sk_seed + params->n;
     unsigned char *pub_seed = sk_prf + params->n;
-    // Init working params
-    unsigned char *R = pub_seed + params->n;
-    unsigned char *msg_h = R + params->n;
-    unsigned char *prf_buf = msg_h + params->n;
     uint32_t addr[8] = {0};
     uint32_t ots_addr[8] = {0};
-    unsigned char idx_bytes_32[32];
 
     unsigned char *wots_sigs = NULL;
-    unsigned long long prefix_length = params->padding_len + 3*params->n;
-    unsigned long long m_with_prefix_len = mlen + prefix_length;
-    unsigned char *m_with_prefix = NULL;
     int ret = 0;
 
     for (i = 0; i < 2*params->d - 1; i++) {
@@ -925,12 +1128,7 @@ int xmssmt_core_sign(const xmss_params *params,
         states[i].next_leaf = 0;
     }
 
-    if ((m_with_prefix_len == 0) || (m_with_prefix = OQS_MEM_malloc(m_with_prefix_len)) == NULL) {
-        ret = -1;
-        goto cleanup;
-    }
-
-    xmssmt_deserialize_state(params, states, &wots_sigs, sk);
+    xmssmt_deserialize_state(params, states, &wots_sigs, sk, dirty);
 
     // Extract SK
     unsigned long long idx = 0;
@@ -954,6 +1152,7 @@ int xmssmt_core_sign(const xmss_params *params,
         // has to make sure that this happens on disk.
         OQS_MEM_cleanse(sk, params->index_bytes);
         OQS_MEM_cleanse(sk + params->index_bytes, (size_t)(params->sk_bytes - params->index_bytes));
+        mark_dirty(dirty, sk, params->sk_bytes);
         if (idx > ((1ULL << params->full_height) - 1)) {
             // We already used all one-time keys
             ret = -2;
@@ -965,6 +1164,10 @@ int xmssmt_core_sign(const xmss_params *params,
     memcpy(sk_prf, sk+params->index_bytes+params->n, (size_t)params->n);
     memcpy(pub_seed, sk+params->index_bytes+3*params->n, (size_t)params->n);
 
+    memcpy(seeds, sk_seed, 2*params->n);
+    memcpy(seeds + 2*params->n, pub_seed, params->n);
+    memcpy(seeds + 3*params->n, sk + params->index_bytes + 2*params->n, params->n);
+
     // Update SK
     for (i = 0; i < params->index_bytes; i++) {
         sk[i] = ((idx + 1) >> 8*(params->index_bytes - 1 - i)) & 255;
@@ -972,68 +1175,27 @@ int xmssmt_core_sign(const xmss_params *params,
     // Secret key for this non-forward-secure version is now updated.
     // A production implementation should consider using a file handle instead,
     //  and write the updated secret key at this point!
-
-    // ---------------------------------
-    // Message Hashing
-    // ---------------------------------
-
-    // Message Hash:
-    // First compute pseudorandom value
-    ull_to_bytes(idx_bytes_32, 32, idx);
-    prf(params, R, idx_bytes_32, sk_prf, prf_buf);
-
-    /* Already put the message in the right place, to make it easier to prepend
-     * things when computing the hash over the message. */
-    memcpy(m_with_prefix, sm + params->sig_bytes - prefix_length, prefix_length);
-    memcpy(m_with_prefix + prefix_length, m, mlen);
-
-    /* Compute the message hash. */
-    hash_message(params, msg_h, R, pub_root, idx,
-                m_with_prefix,
-                 mlen);
-
-    // Start collecting signature
-    *smlen = 0;
+    // With a tracker, the caller gets to do that before the BDS states change.
+    mark_dirty(dirty, sk, params->index_bytes);
+    if (flush_dirty(dirty) != 0) {
+        ret = -1;
+        goto cleanup;
+    }
 
     // Copy index to signature
     for (i = 0; i < params->index_bytes; i++) {
         sm[i] = (idx >> 8*(params->index_bytes - 1 - i)) & 255;
     }
 
-    sm += params->index_bytes;
-    *smlen += params->index_bytes;
-
-    // Copy R to signature
-    for (i = 0; i < params->n; i++) {
-        sm[i] = R[i];
-    }
-
-    sm += params->n;
-    *smlen += params->n;
-
-    // ----------------------------------
-    // Now we start to "really sign"
-    // ----------------------------------
-
-    // Handle lowest layer separately as it is slightly different...
+    // Leave room for R and the bottom WOTS signature, which depend on the
+    // message and are added by xmss_xmssmt_core_sign_message()
+    sm += params->index_bytes + params->n + params->wots_sig_bytes;
 
-    // Prepare Address
-    set_type(ots_addr, 0);
     idx_tree = idx >> params->tree_height;
     idx_leaf = (idx & ((1 << params->tree_height)-1));
-    set_layer_addr(ots_addr, 0);
-    set_tree_addr(ots_addr, idx_tree);
-    set_ots_addr(ots_addr, idx_leaf);
-
-    // Compute WOTS signature
-    wots_sign(params, sm, msg_h, sk_seed, pub_seed, ots_addr);
-
-    sm += params->wots_sig_bytes;
-    *smlen += params->wots_sig_bytes;
 
     memcpy(sm, states[0].auth, params->tree_height*params->n);
     sm += params->tree_height*params->n;
-    *smlen += params->tree_height*params->n;
 
     // prepare signature of remaining layers
     for (i = 1; i < params->d; i++) {
@@ -1041,7 +1203,6 @@ int xmssmt_core_sign(const xmss_params *params,
         memcpy(sm, wots_sigs + (i-1)*params->wots_sig_bytes, params->wots_sig_bytes);
 
         sm += params->wots_sig_bytes;
-        *smlen += params->wots_sig_bytes;
 
         // put AUTH nodes in place
         if (states[i].auth == NULL) {
@@ -1050,7 +1211,6 @@ int xmssmt_core_sign(const xmss_params *params,
         }
         memcpy(sm, states[i].auth, params->tree_height*params->n);
         sm += params->tree_height*params->n;
-        *smlen += params->tree_height*params->n;
     }
 
     updates = (params->tree_height - params->bds_k) >> 1;
@@ -1088,7 +1248,13 @@ int xmssmt_core_sign(const xmss_params *params,
             set_tree_addr(ots_addr, ((idx + 1) >> ((i+2) * params->tree_height)));
             set_ots_addr(ots_addr, (((idx >> ((i+1) * params->tree_height)) + 1) & ((1ULL << params->tree_height)-1)));
 
-            wots_sign(params, wots_sigs + i*params->wots_sig_bytes, states[i].stack, sk_seed, pub_seed, ots_addr);
+            // The index in sk has already been advanced, so bailing out here
+            // never leads to a one-time key being used twice.
+            if (wots_sign(params, wots_sigs + i*params->wots_sig_bytes, states[i].stack, sk_seed, pub_seed, ots_addr) != 0) {
+                ret = -1;
+                goto cleanup;
+            }
+            mark_dirty(dirty, wots_sigs + i*params->wots_sig_bytes, params->wots_sig_bytes);
 
             states[params->d + i].stackoffset = 0;
             states[params->d + i].next_leaf = 0;
@@ -1107,7 +1273,38 @@ cleanup:
     OQS_MEM_secure_free(treehash, treehash_size);
     OQS_MEM_secure_free(states, states_size);
     OQS_MEM_secure_free(tmp, tmp_size);
-    OQS_MEM_insecure_free(m_with_prefix);
+
+    return ret;
+}
+
+/**
+ * Signs a message.
+ * Returns
+ * 1. an array containing the signature followed by the message AND
+ * 2. an updated secret key!
+ *
+ */
+int xmssmt_core_sign(const xmss_params *params,
+                     unsigned char *sk,
+                     unsigned char *sm, unsigned long long *smlen,
+                     const unsigned char *m, unsigned long long mlen,
+                     xmss_dirty_ranges *dirty)
+{
+    if (params == NULL) {
+        return -1;
+    }
+
+    unsigned char *seeds = OQS_MEM_malloc(4 * params->n);
+    int ret;
+
+    if (seeds == NULL) {
+        return -1;
+    }
+    ret = xmssmt_core_sign_reserve(params, sk, sm, seeds, dirty);
+    if (ret == 0) {
+        ret = xmss_xmssmt_core_sign_message(params, seeds, sm, smlen, m, mlen);
+    }
+    OQS_MEM_secure_free(seeds, 4 * params->n);
 
     return ret;
 }
@@ -12,6 +12,8 @@
 
 #define XMSS_OID_LEN 4
 
+struct xmss_dirty_ranges;
+
 /*
  * | Algorithms                    | oid  | sk (b) | pk (b) | sig (b) | n  | RFC8391 | NIST SP 800-208 | CNSA 2.0 |
  * |-------------------------------|------|--------|--------|---------|----| ------- | --------------- | -------- |
@@ -701,9 +703,36 @@ OQS_API OQS_STATUS OQS_SIG_STFL_alg_xmssmt_shake128_h60_12_sigs_total(unsigned l
 #define OQS_SIG_STFL_alg_xmss_sign OQS_SIG_STFL_alg_xmss_NAMESPACE(OQS_SIG_STFL_alg_xmss_sign)
 OQS_API OQS_STATUS OQS_SIG_STFL_alg_xmss_sign(uint8_t *signature, size_t *signature_len, XMSS_UNUSED_ATT const uint8_t *message, XMSS_UNUSED_ATT size_t message_len, XMSS_UNUSED_ATT OQS_SIG_STFL_SECRET_KEY *secret_key);
 
+#define OQS_SIG_STFL_alg_xmss_sign_concurrent OQS_SIG_STFL_alg_xmss_NAMESPACE(OQS_SIG_STFL_alg_xmss_sign_concurrent)
+OQS_API OQS_STATUS OQS_SIG_STFL_alg_xmss_sign_concurrent(uint8_t *signature, size_t *signature_len, XMSS_UNUSED_ATT const uint8_t *message, XMSS_UNUSED_ATT size_t message_len, XMSS_UNUSED_ATT OQS_SIG_STFL_SECRET_KEY *secret_key);
+
 #define OQS_SIG_STFL_alg_xmss_verify OQS_SIG_STFL_alg_xmss_NAMESPACE(OQS_SIG_STFL_alg_xmss_verify)
 OQS_API OQS_STATUS OQS_SIG_STFL_alg_xmss_verify(XMSS_UNUSED_ATT const uint8_t *message, XMSS_UNUSED_ATT size_t message_len, const uint8_t *signature, size_t signature_len, XMSS_UNUSED_ATT const uint8_t *public_key);
 
+#define OQS_SIG_STFL_alg_xmss_sign_init OQS_SIG_STFL_alg_xmss_NAMESPACE(OQS_SIG_STFL_alg_xmss_sign_init)
+OQS_API OQS_STATUS OQS_SIG_STFL_alg_xmss_sign_init(void **state, uint8_t *signature, OQS_SIG_STFL_SECRET_KEY *secret_key);
+
+#define OQS_SIG_STFL_alg_xmss_sign_update OQS_SIG_STFL_alg_xmss_NAMESPACE(OQS_SIG_STFL_alg_xmss_sign_update)
+OQS_API OQS_STATUS OQS_SIG_STFL_alg_xmss_sign_update(void *state, const uint8_t *message, size_t message_len);
+
+#define OQS_SIG_STFL_alg_xmss_sign_final OQS_SIG_STFL_alg_xmss_NAMESPACE(OQS_SIG_STFL_alg_xmss_sign_final)
+OQS_API OQS_STATUS OQS_SIG_STFL_alg_xmss_sign_final(void *state, uint8_t *signature, size_t *signature_len);
+
+#define OQS_SIG_STFL_alg_xmss_sign_abort OQS_SIG_STFL_alg_xmss_NAMESPACE(OQS_SIG_STFL_alg_xmss_sign_abort)
+OQS_API void OQS_SIG_STFL_alg_xmss_sign_abort(void *state);
+
+#define OQS_SIG_STFL_alg_xmss_verify_init OQS_SIG_STFL_alg_xmss_NAMESPACE(OQS_SIG_STFL_alg_xmss_verify_init)
+OQS_API OQS_STATUS OQS_SIG_STFL_alg_xmss_verify_init(void **state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+
+#define OQS_SIG_STFL_alg_xmss_verify_update OQS_SIG_STFL_alg_xmss_NAMESPACE(OQS_SIG_STFL_alg_xmss_verify_update)
+OQS_API OQS_STATUS OQS_SIG_STFL_alg_xmss_verify_update(void *state, const uint8_t *message, size_t message_len);
+
+#define OQS_SIG_STFL_alg_xmss_verify_final OQS_SIG_STFL_alg_xmss_NAMESPACE(OQS_SIG_STFL_alg_xmss_verify_final)
+OQS_API OQS_STATUS OQS_SIG_STFL_alg_xmss_verify_final(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+
+#define OQS_SIG_STFL_alg_xmss_verify_abort OQS_SIG_STFL_alg_xmss_NAMESPACE(OQS_SIG_STFL_alg_xmss_verify_abort)
+OQS_API void OQS_SIG_STFL_alg_xmss_verify_abort(void *state);
+
 #define OQS_SIG_STFL_alg_xmss_sigs_remaining OQS_SIG_STFL_alg_xmss_NAMESPACE(OQS_SIG_STFL_alg_xmss_sigs_remaining)
 OQS_API OQS_STATUS OQS_SIG_STFL_alg_xmss_sigs_remaining(unsigned long long *remain, const OQS_SIG_STFL_SECRET_KEY *secret_key);
 
@@ -716,9 +745,36 @@ OQS_API OQS_STATUS OQS_SIG_STFL_alg_xmss_sigs_total(unsigned long long *total, c
 #define OQS_SIG_STFL_alg_xmssmt_sign OQS_SIG_STFL_alg_xmss_NAMESPACE(OQS_SIG_STFL_alg_xmssmt_sign)
 OQS_API OQS_STATUS OQS_SIG_STFL_alg_xmssmt_sign(uint8_t *signature, size_t *signature_len, XMSS_UNUSED_ATT const uint8_t *message, XMSS_UNUSED_ATT size_t message_len, XMSS_UNUSED_ATT OQS_SIG_STFL_SECRET_KEY *secret_key);
 
+#define OQS_SIG_STFL_alg_xmssmt_sign_concurrent OQS_SIG_STFL_alg_xmss_NAMESPACE(OQS_SIG_STFL_alg_xmssmt_sign_concurrent)
+OQS_API OQS_STATUS OQS_SIG_STFL_alg_xmssmt_sign_concurrent(uint8_t *signature, size_t *signature_len, XMSS_UNUSED_ATT const uint8_t *message, XMSS_UNUSED_ATT size_t message_len, XMSS_UNUSED_ATT OQS_SIG_STFL_SECRET_KEY *secret_key);
+
 #define OQS_SIG_STFL_alg_xmssmt_verify OQS_SIG_STFL_alg_xmss_NAMESPACE(OQS_SIG_STFL_alg_xmssmt_verify)
 OQS_API OQS_STATUS OQS_SIG_STFL_alg_xmssmt_verify(XMSS_UNUSED_ATT const uint8_t *message, XMSS_UNUSED_ATT size_t message_len, const uint8_t *signature, size_t signature_len, XMSS_UNUSED_ATT const uint8_t *public_key);
 
+#define OQS_SIG_STFL_alg_xmssmt_sign_init OQS_SIG_STFL_alg_xmss_NAMESPACE(OQS_SIG_STFL_alg_xmssmt_sign_init)
+OQS_API OQS_STATUS OQS_SIG_STFL_alg_xmssmt_sign_init(void **state, uint8_t *signature, OQS_SIG_STFL_SECRET_KEY *secret_key);
+
+#define OQS_SIG_STFL_alg_xmssmt_sign_update OQS_SIG_STFL_alg_xmss_NAMESPACE(OQS_SIG_STFL_alg_xmssmt_sign_update)
+OQS_API OQS_STATUS OQS_SIG_STFL_alg_xmssmt_sign_update(void *state, const uint8_t *message, size_t message_len);
+
+#define OQS_SIG_STFL_alg_xmssmt_sign_final OQS_SIG_STFL_alg_xmss_NAMESPACE(OQS_SIG_STFL_alg_xmssmt_sign_final)
+OQS_API OQS_STATUS OQS_SIG_STFL_alg_xmssmt_sign_final(void *state, uint8_t *signature, size_t *signature_len);
+
+#define OQS_SIG_STFL_alg_xmssmt_sign_abort OQS_SIG_STFL_alg_xmss_NAMESPACE(OQS_SIG_STFL_alg_xmssmt_sign_abort)
+OQS_API void OQS_SIG_STFL_alg_xmssmt_sign_abort(void *state);
+
+#define OQS_SIG_STFL_alg_xmssmt_verify_init OQS_SIG_STFL_alg_xmss_NAMESPACE(OQS_SIG_STFL_alg_xmssmt_verify_init)
+OQS_API OQS_STATUS OQS_SIG_STFL_alg_xmssmt_verify_init(void **state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+
+#define OQS_SIG_STFL_alg_xmssmt_verify_update OQS_SIG_STFL_alg_xmss_NAMESPACE(OQS_SIG_STFL_alg_xmssmt_verify_update)
+OQS_API OQS_STATUS OQS_SIG_STFL_alg_xmssmt_verify_update(void *state, const uint8_t *message, size_t message_len);
+
+#define OQS_SIG_STFL_alg_xmssmt_verify_final OQS_SIG_STFL_alg_xmss_NAMESPACE(OQS_SIG_STFL_alg_xmssmt_verify_final)
+OQS_API OQS_STATUS OQS_SIG_STFL_alg_xmssmt_verify_final(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+
+#define OQS_SIG_STFL_alg_xmssmt_verify_abort OQS_SIG_STFL_alg_xmss_NAMESPACE(OQS_SIG_STFL_alg_xmssmt_verify_abort)
+OQS_API void OQS_SIG_STFL_alg_xmssmt_verify_abort(void *state);
+
 #define OQS_SIG_STFL_alg_xmssmt_sigs_remaining OQS_SIG_STFL_alg_xmss_NAMESPACE(OQS_SIG_STFL_alg_xmssmt_sigs_remaining)
 OQS_API OQS_STATUS OQS_SIG_STFL_alg_xmssmt_sigs_remaining(unsigned long long *remain, const OQS_SIG_STFL_SECRET_KEY *secret_key);
 
@@ -743,6 +799,19 @@ OQS_STATUS OQS_SECRET_KEY_XMSS_deserialize_key(OQS_SIG_STFL_SECRET_KEY *sk, cons
 /* Store Secret Key Function, ideally written to secure device */
 void OQS_SECRET_KEY_XMSS_set_store_cb(OQS_SIG_STFL_SECRET_KEY *sk, secure_store_sk store_cb, void *context);
 
+/* Use a serialized XMSS secret key in application memory in place */
+OQS_STATUS OQS_SECRET_KEY_XMSS_map_key(OQS_SIG_STFL_SECRET_KEY *sk, uint8_t *sk_buf, size_t sk_len);
+
+/* Only for internal use. Set up dirty to record what signing changes in a mapped key; NULL if the key is not mapped. */
+struct xmss_dirty_ranges *OQS_SECRET_KEY_XMSS_track(struct xmss_dirty_ranges *dirty, const OQS_SIG_STFL_SECRET_KEY *sk);
+
+/* Only for internal use. Store the key after signing: in full, or the ranges of a mapped key recorded in dirty. */
+OQS_STATUS OQS_SECRET_KEY_XMSS_store(const OQS_SIG_STFL_SECRET_KEY *sk, struct xmss_dirty_ranges *dirty);
+
+/* Only for internal use. Reserve the next one-time key with xmss(mt)_sign_reserve on the working copy of the key, and copy it into the key and store it under the lock. */
+OQS_STATUS OQS_SECRET_KEY_XMSS_sign_reserve(OQS_SIG_STFL_SECRET_KEY *sk, uint8_t *sm, uint8_t *reservation,
+        int (*reserve)(unsigned char *sk, unsigned char *sm, unsigned char *reservation, struct xmss_dirty_ranges *dirty));
+
 /* Free Secret key object */
 void OQS_SECRET_KEY_XMSS_free(OQS_SIG_STFL_SECRET_KEY *sk);
 
@@ -3,7 +3,11 @@
 #include <oqs/oqs.h>
 #include <string.h>
 #include <stdbool.h>
+#if defined(OQS_USE_PTHREADS)
+#include <pthread.h>
+#endif
 #include "sig_stfl_xmss.h"
+#include "external/xmss.h"
 
 #if defined(__GNUC__) || defined(__clang__)
 #define XMSS_UNUSED_ATT __attribute__((unused))
@@ -11,6 +15,60 @@
 #define XMSS_UNUSED_ATT
 #endif
 
+/*
+ * Signing state of an XMSS secret key, in sk->sign_state. Concurrent signers advance the
+ * BDS state on work, a copy of the key, one at a time, and then copy the changed bytes into
+ * the key under the key lock. synced is the key as last copied, to notice changes made to
+ * the key by other means; work is reloaded from the key if it differs.
+ */
+typedef struct {
+#if defined(OQS_USE_PTHREADS)
+	/* Serializes the signers on work */
+	pthread_mutex_t lock;
+#endif
+	bool valid;
+	uint8_t *work;
+	uint8_t *synced;
+} xmss_signer;
+
+static xmss_signer *xmss_signer_new(size_t length_secret_key) {
+	xmss_signer *signer = OQS_MEM_malloc(sizeof(xmss_signer));
+	if (signer == NULL) {
+		return NULL;
+	}
+
+	signer->valid = false;
+	signer->work = OQS_MEM_malloc(length_secret_key);
+	signer->synced = OQS_MEM_malloc(length_secret_key);
+	if (signer->work == NULL || signer->synced == NULL) {
+		goto err;
+	}
+#if defined(OQS_USE_PTHREADS)
+	if (pthread_mutex_init(&signer->lock, NULL) != 0) {
+		goto err;
+	}
+#endif
+	return signer;
+
+err:
+	OQS_MEM_insecure_free(signer->work);
+	OQS_MEM_insecure_free(signer->synced);
+	OQS_MEM_insecure_free(signer);
+	return NULL;
+}
+
+static void xmss_signer_free(xmss_signer *signer, size_t length_secret_key) {
+	if (signer == NULL) {
+		return;
+	}
+#if defined(OQS_USE_PTHREADS)
+	pthread_mutex_destroy(&signer->lock);
+#endif
+	OQS_MEM_secure_free(signer->work, length_secret_key);
+	OQS_MEM_secure_free(signer->synced, length_secret_key);
+	OQS_MEM_insecure_free(signer);
+}
+
 extern inline OQS_SIG_STFL_SECRET_KEY *OQS_SECRET_KEY_XMSS_new(size_t length_secret_key) {
 
 	// Initialize the secret key in the heap with adequate memory
@@ -57,6 +115,18 @@ extern inline OQS_SIG_STFL_SECRET_KEY *OQS_SECRET_KEY_XMSS_new(size_t length_sec
 	// Set Secret Key free function
 	sk->free_key = OQS_SECRET_KEY_XMSS_free;
 
+	// Secret key data is private until mapped
+	sk->secure_store_scrt_key_range = NULL;
+	sk->map_key = OQS_SECRET_KEY_XMSS_map_key;
+
+	// Working copy for concurrent signers
+	sk->sign_state = xmss_signer_new(sk->length_secret_key);
+	if (sk->sign_state == NULL) {
+		OQS_MEM_secure_free(sk->secret_key_data, sk->length_secret_key);
+		OQS_MEM_insecure_free(sk);
+		return NULL;
+	}
+
 	return sk;
 }
 
@@ -134,13 +204,192 @@ void OQS_SECRET_KEY_XMSS_set_store_cb(OQS_SIG_STFL_SECRET_KEY *sk, secure_store_
 	sk->context = context;
 }
 
+/* Use the XMSS secret key in sk_buf in place. As the key data is a plain byte string, sk_buf simply replaces it. */
+OQS_STATUS OQS_SECRET_KEY_XMSS_map_key(OQS_SIG_STFL_SECRET_KEY *sk, uint8_t *sk_buf, size_t sk_len) {
+#ifndef OQS_ALLOW_XMSS_KEY_AND_SIG_GEN
+	return OQS_ERROR;
+#endif
+
+	if (sk == NULL || sk_buf == NULL || (sk_len != sk->length_secret_key) || sk->secure_store_scrt_key_range != NULL) {
+		return OQS_ERROR;
+	}
+
+	OQS_MEM_secure_free(sk->secret_key_data, sk->length_secret_key);
+	sk->secret_key_data = sk_buf;
+
+	return OQS_SUCCESS;
+}
+
+/* Passes the ranges recorded in dirty to the store callback of the mapped key dirty->context, and clears them. */
+static int xmss_store_ranges(xmss_dirty_ranges *dirty) {
+	const OQS_SIG_STFL_SECRET_KEY *sk = dirty->context;
+
+	for (unsigned int i = 0; i < dirty->count; i++) {
+		if (sk->secure_store_scrt_key_range(sk->secret_key_data, (size_t)dirty->range[i].offset, (size_t)dirty->range[i].len, sk->context) != OQS_SUCCESS) {
+			return -1;
+		}
+	}
+	dirty->count = 0;
+
+	return 0;
+}
+
+/*
+ * Only for internal use. For a mapped key, the signing code records the bytes it writes in dirty, and
+ * passes the advanced index to the store callback before it modifies the BDS state.
+ */
+xmss_dirty_ranges *OQS_SECRET_KEY_XMSS_track(xmss_dirty_ranges *dirty, const OQS_SIG_STFL_SECRET_KEY *sk) {
+	if (sk->secure_store_scrt_key_range == NULL) {
+		return NULL;
+	}
+
+	dirty->base = sk->secret_key_data;
+	dirty->flush = xmss_store_ranges;
+	dirty->context = (void *)sk;
+	dirty->count = 0;
+
+	return dirty;
+}
+
+/* Only for internal use, with the lock held. Passes the updated key to the application: serialized in full, or the ranges recorded for a mapped key. */
+OQS_STATUS OQS_SECRET_KEY_XMSS_store(const OQS_SIG_STFL_SECRET_KEY *sk, xmss_dirty_ranges *dirty) {
+	OQS_STATUS status;
+	uint8_t *sk_key_buf_ptr = NULL;
+	size_t sk_key_buf_len = 0;
+
+	if (sk->secure_store_scrt_key_range == NULL) {
+		status = OQS_SECRET_KEY_XMSS_inner_serialize_key(&sk_key_buf_ptr, &sk_key_buf_len, sk);
+		if (status != OQS_SUCCESS) {
+			return status;
+		}
+		status = sk->secure_store_scrt_key(sk_key_buf_ptr, sk_key_buf_len, sk->context);
+		OQS_MEM_secure_free(sk_key_buf_ptr, sk_key_buf_len);
+		return status;
+	}
+
+	return xmss_store_ranges(dirty) == 0 ? OQS_SUCCESS : OQS_ERROR;
+}
+
+/* Without threads the key lock also serializes the signers, and is held for the whole reservation. */
+static OQS_STATUS xmss_signer_lock(const OQS_SIG_STFL_SECRET_KEY *sk, xmss_signer *signer) {
+#if defined(OQS_USE_PTHREADS)
+	(void)sk;
+	return pthread_mutex_lock(&signer->lock) == 0 ? OQS_SUCCESS : OQS_ERROR;
+#else
+	(void)signer;
+	return OQS_SECRET_KEY_XMSS_acquire_lock(sk);
+#endif
+}
+
+static OQS_STATUS xmss_signer_unlock(const OQS_SIG_STFL_SECRET_KEY *sk, xmss_signer *signer) {
+#if defined(OQS_USE_PTHREADS)
+	(void)sk;
+	return pthread_mutex_unlock(&signer->lock) == 0 ? OQS_SUCCESS : OQS_ERROR;
+#else
+	(void)signer;
+	return OQS_SECRET_KEY_XMSS_release_lock(sk);
+#endif
+}
+
+static OQS_STATUS xmss_key_lock(const OQS_SIG_STFL_SECRET_KEY *sk) {
+#if defined(OQS_USE_PTHREADS)
+	return OQS_SECRET_KEY_XMSS_acquire_lock(sk);
+#else
+	(void)sk;
+	return OQS_SUCCESS;
+#endif
+}
+
+static OQS_STATUS xmss_key_unlock(const OQS_SIG_STFL_SECRET_KEY *sk) {
+#if defined(OQS_USE_PTHREADS)
+	return OQS_SECRET_KEY_XMSS_release_lock(sk);
+#else
+	(void)sk;
+	return OQS_SUCCESS;
+#endif
+}
+
+/*
+ * Only for internal use. Reserves the next one-time key with reserve (xmss_sign_reserve or
+ * xmssmt_sign_reserve) on the working copy of the key, then copies the changed bytes into the
+ * key and stores them. Only the copy and the store run under the key lock; the ranges are
+ * copied and stored in order, so the index is persisted before the BDS state.
+ */
+OQS_STATUS OQS_SECRET_KEY_XMSS_sign_reserve(OQS_SIG_STFL_SECRET_KEY *sk, uint8_t *sm, uint8_t *reservation,
+        int (*reserve)(unsigned char *sk, unsigned char *sm, unsigned char *reservation, xmss_dirty_ranges *dirty)) {
+	xmss_signer *signer = sk->sign_state;
+	xmss_dirty_ranges dirty;
+	OQS_STATUS status = OQS_ERROR;
+	bool synced;
+
+	if (signer == NULL || xmss_signer_lock(sk, signer) != OQS_SUCCESS) {
+		return OQS_ERROR;
+	}
+
+	do {
+		if (!signer->valid) {
+			if (xmss_key_lock(sk) != OQS_SUCCESS) {
+				goto unlock;
+			}
+			memcpy(signer->synced, sk->secret_key_data, sk->length_secret_key);
+			if (xmss_key_unlock(sk) != OQS_SUCCESS) {
+				goto unlock;
+			}
+			memcpy(signer->work, signer->synced, sk->length_secret_key);
+			signer->valid = true;
+		}
+
+		dirty.base = signer->work;
+		dirty.flush = NULL;
+		dirty.context = sk;
+		dirty.count = 0;
+		if (reserve(signer->work, sm, reservation, &dirty)) {
+			signer->valid = false;
+			goto unlock;
+		}
+
+		if (xmss_key_lock(sk) != OQS_SUCCESS) {
+			signer->valid = false;
+			goto unlock;
+		}
+		synced = memcmp(sk->secret_key_data, signer->synced, sk->length_secret_key) == 0;
+		if (synced) {
+			for (unsigned int i = 0; i < dirty.count; i++) {
+				size_t offset = (size_t)dirty.range[i].offset, len = (size_t)dirty.range[i].len;
+				memcpy((uint8_t *)sk->secret_key_data + offset, signer->work + offset, len);
+				memcpy(signer->synced + offset, signer->work + offset, len);
+			}
+			status = OQS_SECRET_KEY_XMSS_store(sk, &dirty);
+		} else {
+			/* The key was changed by other means; sign again from the key as it is now */
+			signer->valid = false;
+		}
+		if (xmss_key_unlock(sk) != OQS_SUCCESS) {
+			status = OQS_ERROR;
+			goto unlock;
+		}
+	} while (!synced);
+
+unlock:
+	if (xmss_signer_unlock(sk, signer) != OQS_SUCCESS) {
+		status = OQS_ERROR;
+	}
+	return status;
+}
+
 void OQS_SECRET_KEY_XMSS_free(OQS_SIG_STFL_SECRET_KEY *sk) {
 	if (sk == NULL) {
 		return;
 	}
 
-	OQS_MEM_secure_free(sk->secret_key_data, sk->length_secret_key);
+	/* A mapped key belongs to the application */
+	if (sk->secure_store_scrt_key_range == NULL) {
+		OQS_MEM_secure_free(sk->secret_key_data, sk->length_secret_key);
+	}
 	sk->secret_key_data = NULL;
+
+	xmss_signer_free(sk->sign_state, sk->length_secret_key);
+	sk->sign_state = NULL;
 }
 
 OQS_STATUS OQS_SECRET_KEY_XMSS_acquire_lock(const OQS_SIG_STFL_SECRET_KEY *sk) {
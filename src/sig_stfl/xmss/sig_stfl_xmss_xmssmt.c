@@ -5,6 +5,7 @@
 
 #include <oqs/oqs.h>
 #include "sig_stfl_xmss.h"
+#include "../sig_stfl_verify.h"
 
 #include "external/xmss.h"
 
@@ -16,14 +17,23 @@
 
 // macro to en/disable OQS_SIG_STFL-only structs used only in sig&gen case:
 #ifdef OQS_ALLOW_XMSS_KEY_AND_SIG_GEN
-#define XMSS_SIGGEN(xmss_v, XMSS_V) \
+#define XMSS_SIGGEN(mt, xmss_v, XMSS_V) \
         sig->oid = OQS_SIG_STFL_alg_xmss##xmss_v##_oid; \
         sig->sigs_remaining = OQS_SIG_STFL_alg_xmss##xmss_v##_sigs_remaining;\
         sig->sigs_total = OQS_SIG_STFL_alg_xmss##xmss_v##_sigs_total;\
         sig->keypair = OQS_SIG_STFL_alg_xmss##xmss_v##_keypair;\
-        sig->sign = OQS_SIG_STFL_alg_xmss##xmss_v##_sign;
+        sig->sign = OQS_SIG_STFL_alg_xmss##xmss_v##_sign;\
+        sig->sign_concurrent = OQS_SIG_STFL_alg_xmss##mt##_sign_concurrent;\
+        sig->sign_init = OQS_SIG_STFL_alg_xmss##mt##_sign_init;\
+        sig->sign_update = OQS_SIG_STFL_alg_xmss##mt##_sign_update;\
+        sig->sign_final = OQS_SIG_STFL_alg_xmss##mt##_sign_final;\
+        sig->sign_abort = OQS_SIG_STFL_alg_xmss##mt##_sign_abort;\
+        sig->verify_init = OQS_SIG_STFL_alg_xmss##mt##_verify_init;\
+        sig->verify_update = OQS_SIG_STFL_alg_xmss##mt##_verify_update;\
+        sig->verify_final = OQS_SIG_STFL_alg_xmss##mt##_verify_final;\
+        sig->verify_abort = OQS_SIG_STFL_alg_xmss##mt##_verify_abort;
 #else
-#define XMSS_SIGGEN(xmss_v, XMSS_V)
+#define XMSS_SIGGEN(mt, xmss_v, XMSS_V)
 #endif
 
 // generator for all alg-specific functions:
@@ -36,7 +46,7 @@ OQS_SIG_STFL *OQS_SIG_STFL_alg_xmss##xmss_v##_new(void) { \
         } \
         memset(sig, 0, sizeof(OQS_SIG_STFL)); \
 \
-        XMSS_SIGGEN(xmss_v, XMSS_V) \
+        XMSS_SIGGEN(mt, xmss_v, XMSS_V) \
         sig->method_name = OQS_SIG_STFL_alg_xmss##xmss_v; \
         sig->alg_version = "https://datatracker.ietf.org/doc/html/rfc8391"; \
         sig->euf_cma = true; \
@@ -51,6 +61,17 @@ OQS_SIG_STFL *OQS_SIG_STFL_alg_xmss##xmss_v##_new(void) { \
         return sig;\
 } \
 \
+static const OQS_SIG_STFL_VERIFY_ops xmss##xmss_v##_verify_ops = { \
+        .init = OQS_SIG_STFL_alg_xmss##mt##_verify_init, \
+        .update = OQS_SIG_STFL_alg_xmss##mt##_verify_update, \
+        .final = OQS_SIG_STFL_alg_xmss##mt##_verify_final, \
+        .abort = OQS_SIG_STFL_alg_xmss##mt##_verify_abort, \
+}; \
+\
+const OQS_SIG_STFL_VERIFY_ops *OQS_SIG_STFL_alg_xmss##xmss_v##_verify_ops(void) { \
+        return &xmss##xmss_v##_verify_ops; \
+} \
+\
 OQS_SIG_STFL_SECRET_KEY *OQS_SECRET_KEY_XMSS##XMSS_V##_new(void) {\
         return OQS_SECRET_KEY_XMSS_new(OQS_SIG_STFL_alg_xmss##xmss_v##_length_sk);\
 }\
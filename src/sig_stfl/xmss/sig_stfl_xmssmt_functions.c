@@ -24,16 +24,15 @@ OQS_API OQS_STATUS OQS_SIG_STFL_alg_xmssmt_sign(XMSS_UNUSED_ATT uint8_t *signatu
 OQS_API OQS_STATUS OQS_SIG_STFL_alg_xmssmt_sign(uint8_t *signature, size_t *signature_len, XMSS_UNUSED_ATT const uint8_t *message, XMSS_UNUSED_ATT size_t message_len, XMSS_UNUSED_ATT OQS_SIG_STFL_SECRET_KEY *secret_key) {
 
 	OQS_STATUS status = OQS_SUCCESS;
-	uint8_t *sk_key_buf_ptr = NULL;
+	xmss_dirty_ranges dirty;
 	unsigned long long sig_length = 0;
-	size_t sk_key_buf_len = 0;
 
 	if (signature == NULL || signature_len == NULL || message == NULL || secret_key == NULL || secret_key->secret_key_data == NULL) {
 		return OQS_ERROR;
 	}
 
 	/* Don't even attempt signing without a way to safe the updated private key */
-	if (secret_key->secure_store_scrt_key == NULL) {
+	if (secret_key->secure_store_scrt_key == NULL && secret_key->secure_store_scrt_key_range == NULL) {
 		return OQS_ERROR;
 	}
 
@@ -42,24 +41,14 @@ OQS_API OQS_STATUS OQS_SIG_STFL_alg_xmssmt_sign(uint8_t *signature, size_t *sign
 		return OQS_ERROR;
 	}
 
-	if (xmssmt_sign(secret_key->secret_key_data, signature, &sig_length, message, message_len)) {
+	if (xmssmt_sign(secret_key->secret_key_data, signature, &sig_length, message, message_len, OQS_SECRET_KEY_XMSS_track(&dirty, secret_key))) {
 		status = OQS_ERROR;
 		goto err;
 	}
 	*signature_len = (size_t)sig_length;
-	/*
-	 * serialize and securely store the updated private key
-	 * regardless, delete signature and the serialized key other wise
-	 */
-
-	status = OQS_SECRET_KEY_XMSS_inner_serialize_key(&sk_key_buf_ptr, &sk_key_buf_len, secret_key);
-	if (status != OQS_SUCCESS) {
-		goto err;
-	}
 
 	// Store updated private key securely
-	status = secret_key->secure_store_scrt_key(sk_key_buf_ptr, sk_key_buf_len, secret_key->context);
-	OQS_MEM_secure_free(sk_key_buf_ptr, sk_key_buf_len);
+	status = OQS_SECRET_KEY_XMSS_store(secret_key, &dirty);
 
 err:
 	/* Unlock the key if possible */
@@ -71,6 +60,134 @@ err:
 }
 #endif
 
+#ifdef OQS_ALLOW_STFL_KEY_AND_SIG_GEN
+/*
+ * Reserve the next one-time key of secret_key into reservation and store the updated key.
+ * The BDS traversal runs on the working copy of the key; only the copy into the key and the
+ * store run under the lock.
+ */
+static OQS_STATUS xmssmt_sign_reserve_locked(uint8_t *signature, uint8_t *reservation, OQS_SIG_STFL_SECRET_KEY *secret_key) {
+
+	if (signature == NULL || secret_key == NULL || secret_key->secret_key_data == NULL) {
+		return OQS_ERROR;
+	}
+
+	/* Don't even attempt signing without a way to safe the updated private key */
+	if (secret_key->secure_store_scrt_key == NULL && secret_key->secure_store_scrt_key_range == NULL) {
+		return OQS_ERROR;
+	}
+
+	return OQS_SECRET_KEY_XMSS_sign_reserve(secret_key, signature, reservation, xmssmt_sign_reserve);
+}
+#endif
+
+#ifndef OQS_ALLOW_STFL_KEY_AND_SIG_GEN
+OQS_API OQS_STATUS OQS_SIG_STFL_alg_xmssmt_sign_concurrent(XMSS_UNUSED_ATT uint8_t *signature, XMSS_UNUSED_ATT size_t *signature_len, XMSS_UNUSED_ATT const uint8_t *message, XMSS_UNUSED_ATT size_t message_len,
+        XMSS_UNUSED_ATT OQS_SIG_STFL_SECRET_KEY *secret_key) {
+	return OQS_ERROR;
+}
+#else
+OQS_API OQS_STATUS OQS_SIG_STFL_alg_xmssmt_sign_concurrent(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, OQS_SIG_STFL_SECRET_KEY *secret_key) {
+
+	OQS_STATUS status;
+	unsigned long long sig_length = 0;
+	uint8_t reservation[XMSS_SIGN_RESERVATION_BYTES];
+
+	if (signature_len == NULL || message == NULL) {
+		return OQS_ERROR;
+	}
+
+	status = xmssmt_sign_reserve_locked(signature, reservation, secret_key);
+
+	/* The reserved one-time key is used by no other signer, so finish outside the lock */
+	if (status == OQS_SUCCESS) {
+		if (xmssmt_sign_message(reservation, signature, &sig_length, message, message_len)) {
+			status = OQS_ERROR;
+		} else {
+			*signature_len = (size_t)sig_length;
+		}
+	}
+	OQS_MEM_cleanse(reservation, sizeof(reservation));
+
+	return status;
+}
+#endif
+
+#ifndef OQS_ALLOW_STFL_KEY_AND_SIG_GEN
+OQS_API OQS_STATUS OQS_SIG_STFL_alg_xmssmt_sign_init(XMSS_UNUSED_ATT void **state, XMSS_UNUSED_ATT uint8_t *signature, XMSS_UNUSED_ATT OQS_SIG_STFL_SECRET_KEY *secret_key) {
+	return OQS_ERROR;
+}
+
+OQS_API OQS_STATUS OQS_SIG_STFL_alg_xmssmt_sign_update(XMSS_UNUSED_ATT void *state, XMSS_UNUSED_ATT const uint8_t *message, XMSS_UNUSED_ATT size_t message_len) {
+	return OQS_ERROR;
+}
+
+OQS_API OQS_STATUS OQS_SIG_STFL_alg_xmssmt_sign_final(XMSS_UNUSED_ATT void *state, XMSS_UNUSED_ATT uint8_t *signature, XMSS_UNUSED_ATT size_t *signature_len) {
+	return OQS_ERROR;
+}
+
+OQS_API void OQS_SIG_STFL_alg_xmssmt_sign_abort(XMSS_UNUSED_ATT void *state) {
+}
+#else
+OQS_API OQS_STATUS OQS_SIG_STFL_alg_xmssmt_sign_init(void **state, uint8_t *signature, OQS_SIG_STFL_SECRET_KEY *secret_key) {
+
+	OQS_STATUS status;
+	uint8_t reservation[XMSS_SIGN_RESERVATION_BYTES];
+
+	if (state == NULL) {
+		return OQS_ERROR;
+	}
+
+	status = xmssmt_sign_reserve_locked(signature, reservation, secret_key);
+
+	/* The message hash is started here; the rest of the signature is computed by sign_final */
+	if (status == OQS_SUCCESS && xmssmt_sign_message_init(state, reservation, signature)) {
+		status = OQS_ERROR;
+	}
+	OQS_MEM_cleanse(reservation, sizeof(reservation));
+
+	return status;
+}
+
+OQS_API OQS_STATUS OQS_SIG_STFL_alg_xmssmt_sign_update(void *state, const uint8_t *message, size_t message_len) {
+
+	if (state == NULL || (message == NULL && message_len != 0)) {
+		return OQS_ERROR;
+	}
+
+	if (xmss_xmssmt_inc_update(state, message, (unsigned long long)message_len)) {
+		return OQS_ERROR;
+	}
+
+	return OQS_SUCCESS;
+}
+
+OQS_API OQS_STATUS OQS_SIG_STFL_alg_xmssmt_sign_final(void *state, uint8_t *signature, size_t *signature_len) {
+
+	unsigned long long sig_length = 0;
+
+	if (state == NULL) {
+		return OQS_ERROR;
+	}
+
+	if (signature == NULL || signature_len == NULL) {
+		xmss_xmssmt_inc_free(state);
+		return OQS_ERROR;
+	}
+
+	if (xmss_xmssmt_sign_message_final(state, signature, &sig_length)) {
+		return OQS_ERROR;
+	}
+	*signature_len = (size_t)sig_length;
+
+	return OQS_SUCCESS;
+}
+
+OQS_API void OQS_SIG_STFL_alg_xmssmt_sign_abort(void *state) {
+	xmss_xmssmt_inc_free(state);
+}
+#endif
+
 OQS_API OQS_STATUS OQS_SIG_STFL_alg_xmssmt_verify(XMSS_UNUSED_ATT const uint8_t *message, XMSS_UNUSED_ATT size_t message_len, const uint8_t *signature, size_t signature_len, XMSS_UNUSED_ATT const uint8_t *public_key) {
 
 	if (message == NULL || signature == NULL || public_key == NULL) {
@@ -84,6 +201,54 @@ OQS_API OQS_STATUS OQS_SIG_STFL_alg_xmssmt_verify(XMSS_UNUSED_ATT const uint8_t
 	return OQS_SUCCESS;
 }
 
+OQS_API OQS_STATUS OQS_SIG_STFL_alg_xmssmt_verify_init(void **state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key) {
+
+	if (state == NULL || signature == NULL || public_key == NULL) {
+		return OQS_ERROR;
+	}
+
+	if (xmssmt_sign_open_init(state, signature, (unsigned long long)signature_len, public_key)) {
+		return OQS_ERROR;
+	}
+
+	return OQS_SUCCESS;
+}
+
+OQS_API OQS_STATUS OQS_SIG_STFL_alg_xmssmt_verify_update(void *state, const uint8_t *message, size_t message_len) {
+
+	if (state == NULL || (message == NULL && message_len != 0)) {
+		return OQS_ERROR;
+	}
+
+	if (xmss_xmssmt_inc_update(state, message, (unsigned long long)message_len)) {
+		return OQS_ERROR;
+	}
+
+	return OQS_SUCCESS;
+}
+
+OQS_API OQS_STATUS OQS_SIG_STFL_alg_xmssmt_verify_final(void *state, const uint8_t *signature, XMSS_UNUSED_ATT size_t signature_len, XMSS_UNUSED_ATT const uint8_t *public_key) {
+
+	if (state == NULL) {
+		return OQS_ERROR;
+	}
+
+	if (signature == NULL) {
+		xmss_xmssmt_inc_free(state);
+		return OQS_ERROR;
+	}
+
+	if (xmss_xmssmt_sign_open_final(state, signature)) {
+		return OQS_ERROR;
+	}
+
+	return OQS_SUCCESS;
+}
+
+OQS_API void OQS_SIG_STFL_alg_xmssmt_verify_abort(void *state) {
+	xmss_xmssmt_inc_free(state);
+}
+
 OQS_API OQS_STATUS OQS_SIG_STFL_alg_xmssmt_sigs_remaining(unsigned long long *remain, const OQS_SIG_STFL_SECRET_KEY *secret_key) {
 	if (remain == NULL || secret_key == NULL || secret_key->secret_key_data == NULL) {
 		return OQS_ERROR;
@@ -148,6 +148,27 @@ void fprint_l_str(FILE *fp, const char *S, const uint8_t *A, size_t L) {
 	fprintf(fp, "\n");
 }
 
+/* Verify the message in 7-byte pieces with the streaming API */
+static OQS_STATUS verify_streaming(const OQS_SIG_STFL *sig, const uint8_t *msg, size_t msg_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key) {
+	OQS_SIG_STFL_VERIFY_CTX *ctx = NULL;
+	OQS_STATUS rc = OQS_ERROR;
+	size_t off, len;
+
+	if (OQS_SIG_STFL_verify_init(sig, &ctx, signature, signature_len, public_key) != OQS_SUCCESS) {
+		return OQS_ERROR;
+	}
+	for (off = 0; off < msg_len; off += len) {
+		len = msg_len - off < 7 ? msg_len - off : 7;
+		if (OQS_SIG_STFL_verify_update(ctx, msg + off, len) != OQS_SUCCESS) {
+			goto cleanup;
+		}
+	}
+	rc = OQS_SIG_STFL_verify_final(ctx);
+cleanup:
+	OQS_SIG_STFL_VERIFY_CTX_free(ctx);
+	return rc;
+}
+
 OQS_STATUS sig_stfl_kat(const char *method_name, const char *katfile) {
 
 	uint8_t seed[48];
@@ -270,6 +291,11 @@ OQS_STATUS sig_stfl_kat(const char *method_name, const char *katfile) {
 		fprintf(stderr, "[kat_stfl_sig] %s ERROR: OQS_SIG_STFL_verify failed!\n", method_name);
 		goto err;
 	}
+	rc = verify_streaming(sig, msg, msg_len, signature, signature_len, public_key);
+	if (rc != OQS_SUCCESS) {
+		fprintf(stderr, "[kat_stfl_sig] %s ERROR: streaming verification failed!\n", method_name);
+		goto err;
+	}
 
 	rc = OQS_SIG_STFL_sigs_remaining(sig, &sigs_remain, secret_key);
 	if (rc != OQS_SUCCESS) {
@@ -306,6 +332,11 @@ OQS_STATUS sig_stfl_kat(const char *method_name, const char *katfile) {
 		fprintf(stderr, "[kat_stfl_sig] %s ERROR: OQS_SIG_STFL_verify failed!\n", method_name);
 		goto err;
 	}
+	rc = verify_streaming(sig, msg, msg_len, signature_kat, signature_len, public_key);
+	if (rc != OQS_SUCCESS) {
+		fprintf(stderr, "[kat_stfl_sig] %s ERROR: streaming verification failed!\n", method_name);
+		goto err;
+	}
 
 	// Echo back remain
 	if (FindMarker(fp_rsp, "remain = ")) {
@@ -437,6 +468,9 @@ static OQS_STATUS test_lms_kat(const char *method_name, const char *katfile) {
 
 	// Verify KAT
 	rc = OQS_SIG_STFL_verify(sig, msg, msg_len, sm, sig->length_signature, public_key);
+	if (rc == OQS_SUCCESS) {
+		rc = verify_streaming(sig, msg, msg_len, sm, sig->length_signature, public_key);
+	}
 	if (rc != OQS_SUCCESS) {
 		fprintf(stderr, "ERROR: Verify test vector failed: %s\n", method_name);
 	} else {
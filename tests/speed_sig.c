@@ -61,6 +61,13 @@ static OQS_STATUS sig_speed_wrapper(const char *method_name, uint64_t duration,
 	OQS_randombytes(message, message_len);
 
 	printf("%-36s | %10s | %14s | %15s | %10s | %25s | %10s\n", sig->method_name, "", "", "", "", "", "");
+	/*
+	 * First use in this process (lazy initialization, page faults on tables),
+	 * then the same cycle again. When several algorithms are run, primitives
+	 * shared with an earlier one are already warm in the cold row.
+	 */
+	TIME_OPERATION_ITERATIONS(OQS_SIG_warmup(sig->method_name), "warmup cold", 1)
+	TIME_OPERATION_ITERATIONS(OQS_SIG_warmup(sig->method_name), "warmup warm", 1)
 	if (!doFullCycle) {
 		TIME_OPERATION_SECONDS(OQS_SIG_keypair(sig, public_key, secret_key), "keypair", duration)
 		TIME_OPERATION_SECONDS(OQS_SIG_sign(sig, signature, &signature_len, message, message_len, secret_key), "sign", duration)
@@ -111,6 +111,9 @@ static void print_cpu_extensions(void) {
 	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX512)) {
 		printf(" AVX512");
 	}
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX512VBMI2)) {
+		printf(" AVX512VBMI2");
+	}
 	if (OQS_CPU_has_extension(OQS_CPU_EXT_BMI1)) {
 		printf(" BMI1");
 	}
@@ -164,6 +167,9 @@ static void print_cpu_extensions(void) {
 #ifdef OQS_USE_AVX512_INSTRUCTIONS
 	printf(" AVX512");
 #endif
+#ifdef OQS_USE_AVX512VBMI2_INSTRUCTIONS
+	printf(" AVX512VBMI2");
+#endif
 #ifdef OQS_USE_BMI1_INSTRUCTIONS
 	printf(" BMI1");
 #endif
@@ -250,7 +256,12 @@ static void print_oqs_configuration(void) {
 	    printf("SHA-2:            C and ARM CRYPTO extensions\n")
 	);
 #endif
-#if defined(OQS_USE_SHA3_OPENSSL)
+#if defined(OQS_USE_SHA3_ROUTING)
+	printf("SHA-3:            sha3 %s, sha3_inc %s, shake %s, shake_inc %s, x4 %s\n",
+	       OQS_SHA3_backend_name(OQS_SHA3_ROUTE_SHA3), OQS_SHA3_backend_name(OQS_SHA3_ROUTE_SHA3_INC),
+	       OQS_SHA3_backend_name(OQS_SHA3_ROUTE_SHAKE), OQS_SHA3_backend_name(OQS_SHA3_ROUTE_SHAKE_INC),
+	       OQS_SHA3_backend_name(OQS_SHA3_ROUTE_X4));
+#elif defined(OQS_USE_SHA3_OPENSSL)
 	printf("SHA-3:            OpenSSL\n");
 #elif defined(OQS_USE_SHA3_AVX512VL)
 	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX512)) {
@@ -260,6 +271,14 @@ static void print_oqs_configuration(void) {
 	} else {
 		printf("SHA-3:            C\n");
 	}
+#elif defined(OQS_ENABLE_SHA3_xkcp_low_armv8a_sha3) && defined(OQS_DIST_ARM64_V8_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_ARM_SHA3)) {
+		printf("SHA-3:            ARM SHA3 extension\n");
+	} else {
+		printf("SHA-3:            C\n");
+	}
+#elif defined(OQS_ENABLE_SHA3_xkcp_low_armv8a_sha3)
+	printf("SHA-3:            ARM SHA3 extension\n");
 #else
 	printf("SHA-3:            C\n");
 #endif
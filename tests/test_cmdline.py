@@ -12,6 +12,14 @@ def test_examples(program):
         [helpers.path_to_executable(program)],
     )
 
+@helpers.filtered_test
+def test_hpp():
+    try:
+        program = helpers.path_to_executable('test_hpp')
+    except AssertionError:
+        pytest.skip('Not built; needs a C++17 compiler')
+    helpers.run_subprocess([program])
+
 @helpers.filtered_test
 @pytest.mark.parametrize('kem_name', helpers.available_kems_by_name())
 def test_kem(kem_name):
@@ -20,6 +28,21 @@ def test_kem(kem_name):
         [helpers.path_to_executable('test_kem'), kem_name],
     )
 
+@helpers.filtered_test
+def test_kem_hybrid():
+    helpers.run_subprocess(
+        [helpers.path_to_executable('test_kem_hybrid')],
+    )
+
+@helpers.filtered_test
+@pytest.mark.parametrize('param_set', ['6688128', '6960119', '8192128'])
+def test_mceliece_syndrome(param_set):
+    if not(helpers.is_use_option_enabled_by_name('CLASSIC_MCELIECE_AVX512')): pytest.skip('Not enabled')
+    if not(helpers.is_kem_enabled_by_name('Classic-McEliece-' + param_set)): pytest.skip('Not enabled')
+    helpers.run_subprocess(
+        [helpers.path_to_executable('test_mceliece_syndrome_' + param_set)],
+    )
+
 @helpers.filtered_test
 @pytest.mark.parametrize('sig_name', helpers.available_sigs_by_name())
 def test_sig(sig_name):
@@ -245,6 +245,45 @@ static int do_sha512(void) {
 	return 0;
 }
 
+static int do_sha256_x4(void) {
+	// read message from stdin
+	uint8_t *msg;
+	size_t msg_len;
+	if (read_stdin(&msg, &msg_len) != 0) {
+		fprintf(stderr, "ERROR reading from stdin\n");
+		return -1;
+	}
+	// lane j hashes msg with its last byte xored with j
+	uint8_t *lanes = OQS_MEM_malloc(4 * msg_len + 1);
+	if (lanes == NULL) {
+		OQS_MEM_insecure_free(msg);
+		return -1;
+	}
+	for (size_t j = 0; j < 4; j++) {
+		memcpy(&lanes[j * msg_len], msg, msg_len);
+		if (msg_len > 0) {
+			lanes[j * msg_len + msg_len - 1] ^= (uint8_t) j;
+		}
+	}
+	uint8_t output[4][32];
+	uint8_t expected[32];
+	OQS_SHA2_sha256_x4(output[0], output[1], output[2], output[3],
+	                   &lanes[0], &lanes[msg_len], &lanes[2 * msg_len], &lanes[3 * msg_len], msg_len);
+	for (size_t j = 0; j < 4; j++) {
+		OQS_SHA2_sha256(expected, &lanes[j * msg_len], msg_len);
+		if (memcmp(output[j], expected, 32) != 0) {
+			fprintf(stderr, "ERROR: Four-way API does not match main API in lane %zu\n", j);
+			OQS_MEM_insecure_free(lanes);
+			OQS_MEM_insecure_free(msg);
+			return -2;
+		}
+	}
+	print_hex(output[0], 32);
+	OQS_MEM_insecure_free(lanes);
+	OQS_MEM_insecure_free(msg);
+	return 0;
+}
+
 static int do_arbitrary_hash(void (*hash)(uint8_t *, const uint8_t *, size_t), size_t hash_len) {
 	// read message from stdin
 	uint8_t *msg;
@@ -279,7 +318,7 @@ int main(int argc, char **argv) {
 	OQS_init();
 	if (argc != 2) {
 		fprintf(stderr, "Usage: test_hash algname\n");
-		fprintf(stderr, "  algname: sha256, sha384, sha512, sha256inc, sha384inc, sha512inc\n");
+		fprintf(stderr, "  algname: sha256, sha384, sha512, sha256inc, sha384inc, sha512inc, sha256x4\n");
 		fprintf(stderr, "           sha3_256, sha3_384, sha3_512\n");
 		fprintf(stderr, "  test_hash reads input from stdin and outputs hash value as hex string to stdout");
 		printf("\n");
@@ -291,6 +330,8 @@ int main(int argc, char **argv) {
 
 	if (strcmp(hash_alg, "sha256inc") == 0) {
 		ret = do_sha256();
+	} else if (strcmp(hash_alg, "sha256x4") == 0) {
+		ret = do_sha256_x4();
 	} else if (strcmp(hash_alg, "sha384inc") == 0) {
 		ret = do_sha384();
 	} else if (strcmp(hash_alg, "sha512inc") == 0) {
@@ -110,6 +110,225 @@ typedef struct magic_s {
 	uint8_t val[31];
 } magic_t;
 
+/* Encapsulates and decapsulates through imported key handles, crossing over with the byte-oriented API. */
+static OQS_STATUS kem_test_key_handles(const OQS_KEM *kem, const uint8_t *public_key, const uint8_t *secret_key) {
+	OQS_KEM_KEY *pk = NULL, *sk = NULL, *sk_expanded = NULL;
+	uint8_t *ciphertext = NULL, *shared_secret_e = NULL, *shared_secret_d = NULL;
+	OQS_STATUS rc, rc_key, ret = OQS_ERROR;
+
+	ciphertext = OQS_MEM_malloc(kem->length_ciphertext);
+	shared_secret_e = OQS_MEM_malloc(kem->length_shared_secret);
+	shared_secret_d = OQS_MEM_malloc(kem->length_shared_secret);
+	pk = OQS_KEM_key_import(kem, public_key, kem->length_public_key, OQS_KEM_KEY_PUBLIC);
+	sk = OQS_KEM_key_import(kem, secret_key, kem->length_secret_key, OQS_KEM_KEY_SECRET | OQS_KEM_KEY_BYTES_ONLY);
+	sk_expanded = OQS_KEM_key_import(kem, secret_key, kem->length_secret_key, OQS_KEM_KEY_SECRET);
+	if (ciphertext == NULL || shared_secret_e == NULL || shared_secret_d == NULL || pk == NULL || sk == NULL || sk_expanded == NULL) {
+		fprintf(stderr, "ERROR: OQS_KEM_key_import failed\n");
+		goto cleanup;
+	}
+	printf("Key handles: public key %s, secret key %s\n", OQS_KEM_key_is_expanded(pk) ? "expanded" : "bytes",
+	       OQS_KEM_key_is_expanded(sk_expanded) ? "expanded" : "bytes");
+	if (OQS_KEM_key_is_expanded(sk)) {
+		fprintf(stderr, "ERROR: OQS_KEM_KEY_BYTES_ONLY key was expanded\n");
+		goto cleanup;
+	}
+#if defined(OQS_ENABLE_KEM_ML_KEM) && !OQS_USE_CUPQC && !OQS_USE_ICICLE
+	if (0 == strncmp(kem->method_name, "ML-KEM", 6) && !(OQS_KEM_key_is_expanded(pk) && OQS_KEM_key_is_expanded(sk_expanded))) {
+		fprintf(stderr, "ERROR: ML-KEM key was not expanded\n");
+		goto cleanup;
+	}
+#endif
+
+	rc = OQS_KEM_key_encaps(kem, ciphertext, shared_secret_e, pk);
+	OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+	if (rc != OQS_SUCCESS) {
+		fprintf(stderr, "ERROR: OQS_KEM_key_encaps failed\n");
+		goto cleanup;
+	}
+	OQS_TEST_CT_DECLASSIFY(ciphertext, kem->length_ciphertext);
+	rc = OQS_KEM_decaps(kem, shared_secret_d, ciphertext, secret_key);
+	OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+	OQS_TEST_CT_DECLASSIFY(shared_secret_e, kem->length_shared_secret);
+	OQS_TEST_CT_DECLASSIFY(shared_secret_d, kem->length_shared_secret);
+	if (rc != OQS_SUCCESS || memcmp(shared_secret_e, shared_secret_d, kem->length_shared_secret) != 0) {
+		fprintf(stderr, "ERROR: OQS_KEM_decaps does not match OQS_KEM_key_encaps\n");
+		goto cleanup;
+	}
+	rc = OQS_KEM_key_decaps(kem, shared_secret_d, ciphertext, sk);
+	OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+	OQS_TEST_CT_DECLASSIFY(shared_secret_d, kem->length_shared_secret);
+	if (rc != OQS_SUCCESS || memcmp(shared_secret_e, shared_secret_d, kem->length_shared_secret) != 0) {
+		fprintf(stderr, "ERROR: OQS_KEM_key_decaps does not match OQS_KEM_key_encaps\n");
+		goto cleanup;
+	}
+	rc = OQS_KEM_key_decaps(kem, shared_secret_d, ciphertext, sk_expanded);
+	OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+	OQS_TEST_CT_DECLASSIFY(shared_secret_d, kem->length_shared_secret);
+	if (rc != OQS_SUCCESS || memcmp(shared_secret_e, shared_secret_d, kem->length_shared_secret) != 0) {
+		fprintf(stderr, "ERROR: OQS_KEM_key_decaps with an expanded key does not match OQS_KEM_key_encaps\n");
+		goto cleanup;
+	}
+
+	/* implicit rejection must not depend on the form of the secret key */
+	ciphertext[0] ^= 1;
+	rc = OQS_KEM_decaps(kem, shared_secret_e, ciphertext, secret_key);
+	rc_key = OQS_KEM_key_decaps(kem, shared_secret_d, ciphertext, sk_expanded);
+	ciphertext[0] ^= 1;
+	OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+	OQS_TEST_CT_DECLASSIFY(&rc_key, sizeof rc_key);
+	OQS_TEST_CT_DECLASSIFY(shared_secret_e, kem->length_shared_secret);
+	OQS_TEST_CT_DECLASSIFY(shared_secret_d, kem->length_shared_secret);
+	if (rc != rc_key || (rc == OQS_SUCCESS && memcmp(shared_secret_e, shared_secret_d, kem->length_shared_secret) != 0)) {
+		fprintf(stderr, "ERROR: OQS_KEM_key_decaps does not match OQS_KEM_decaps on a modified ciphertext\n");
+		goto cleanup;
+	}
+
+	/* handles are typed: a public key cannot decapsulate and a secret key cannot encapsulate */
+	if (OQS_KEM_key_decaps(kem, shared_secret_d, ciphertext, pk) != OQS_ERROR ||
+	        OQS_KEM_key_encaps(kem, ciphertext, shared_secret_e, sk) != OQS_ERROR) {
+		fprintf(stderr, "ERROR: key handle of the wrong type was accepted\n");
+		goto cleanup;
+	}
+
+	ret = OQS_SUCCESS;
+
+cleanup:
+	OQS_KEM_key_free(pk);
+	OQS_KEM_key_free(sk);
+	OQS_KEM_key_free(sk_expanded);
+	OQS_MEM_insecure_free(ciphertext);
+	OQS_MEM_secure_free(shared_secret_e, kem->length_shared_secret);
+	OQS_MEM_secure_free(shared_secret_d, kem->length_shared_secret);
+	return ret;
+}
+
+/* Checks seed-format secret keys: import/export and decapsulation through an expansion cache. */
+static OQS_STATUS kem_test_key_seeds(const OQS_KEM *kem) {
+	uint8_t seeds[2][64];
+	uint8_t *public_keys[2] = {NULL, NULL};
+	uint8_t *secret_key = NULL, *exported = NULL, *ciphertexts[2] = {NULL, NULL};
+	uint8_t *shared_secret_e[2] = {NULL, NULL}, *shared_secret_d = NULL;
+	OQS_KEM_KEY *sk = NULL;
+	OQS_KEM_KEY_CACHE *cache = NULL;
+	OQS_KEY_CACHE_STATS stats;
+	size_t entry_bytes;
+	OQS_STATUS rc, ret = OQS_ERROR;
+
+	if (kem->length_keypair_seed == 0) {
+		printf("Seed-format keys not supported\n");
+		return OQS_SUCCESS;
+	}
+	if (kem->length_keypair_seed > sizeof seeds[0]) {
+		fprintf(stderr, "ERROR: unexpected seed length %zu\n", kem->length_keypair_seed);
+		return OQS_ERROR;
+	}
+	OQS_randombytes(seeds[0], kem->length_keypair_seed);
+	OQS_randombytes(seeds[1], kem->length_keypair_seed);
+	/* key generation is covered by the derand test; here the keys are
+	 * compared, and the cache looks them up by a hash of the seed */
+	OQS_TEST_CT_DECLASSIFY(seeds, sizeof seeds);
+
+	secret_key = OQS_MEM_malloc(kem->length_secret_key);
+	exported = OQS_MEM_malloc(kem->length_secret_key);
+	shared_secret_d = OQS_MEM_malloc(kem->length_shared_secret);
+	if (secret_key == NULL || exported == NULL || shared_secret_d == NULL) {
+		fprintf(stderr, "ERROR: OQS_MEM_malloc failed\n");
+		goto cleanup;
+	}
+	for (int i = 0; i < 2; i++) {
+		public_keys[i] = OQS_MEM_malloc(kem->length_public_key);
+		ciphertexts[i] = OQS_MEM_malloc(kem->length_ciphertext);
+		shared_secret_e[i] = OQS_MEM_malloc(kem->length_shared_secret);
+		if (public_keys[i] == NULL || ciphertexts[i] == NULL || shared_secret_e[i] == NULL) {
+			fprintf(stderr, "ERROR: OQS_MEM_malloc failed\n");
+			goto cleanup;
+		}
+		rc = OQS_KEM_keypair_derand(kem, public_keys[i], secret_key, seeds[i]);
+		rc |= OQS_KEM_encaps(kem, ciphertexts[i], shared_secret_e[i], public_keys[i]);
+		OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+		if (rc != OQS_SUCCESS) {
+			fprintf(stderr, "ERROR: OQS_KEM_keypair_derand or OQS_KEM_encaps failed\n");
+			goto cleanup;
+		}
+	}
+
+	/* the handle generates the same secret key (here of seeds[1]) and returns the seed */
+	sk = OQS_KEM_key_import(kem, seeds[1], kem->length_keypair_seed, OQS_KEM_KEY_SECRET | OQS_KEM_KEY_SEED);
+	if (sk == NULL || OQS_KEM_key_export(sk, exported, kem->length_secret_key) != OQS_SUCCESS ||
+	        memcmp(exported, secret_key, kem->length_secret_key) != 0) {
+		fprintf(stderr, "ERROR: secret key imported from seed does not match OQS_KEM_keypair_derand\n");
+		goto cleanup;
+	}
+	if (OQS_KEM_key_export_seed(sk, exported, kem->length_keypair_seed) != OQS_SUCCESS ||
+	        memcmp(exported, seeds[1], kem->length_keypair_seed) != 0) {
+		fprintf(stderr, "ERROR: OQS_KEM_key_export_seed does not return the imported seed\n");
+		goto cleanup;
+	}
+
+	/* an unbounded cache: a miss, then a hit */
+	cache = OQS_KEM_key_cache_new(kem, SIZE_MAX);
+	if (cache == NULL) {
+		fprintf(stderr, "ERROR: OQS_KEM_key_cache_new failed\n");
+		goto cleanup;
+	}
+	for (int i = 0; i < 2; i++) {
+		rc = OQS_KEM_key_cache_decaps(cache, shared_secret_d, ciphertexts[0], seeds[0]);
+		OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+		OQS_TEST_CT_DECLASSIFY(shared_secret_d, kem->length_shared_secret);
+		OQS_TEST_CT_DECLASSIFY(shared_secret_e[0], kem->length_shared_secret);
+		if (rc != OQS_SUCCESS || memcmp(shared_secret_d, shared_secret_e[0], kem->length_shared_secret) != 0) {
+			fprintf(stderr, "ERROR: OQS_KEM_key_cache_decaps failed\n");
+			goto cleanup;
+		}
+	}
+	OQS_KEM_key_cache_stats(cache, &stats);
+	if (stats.hits != 1 || stats.misses != 1 || stats.entries != 1) {
+		fprintf(stderr, "ERROR: unexpected key cache counters\n");
+		goto cleanup;
+	}
+	entry_bytes = stats.bytes;
+	OQS_KEM_key_cache_free(cache);
+
+	/* a cache with room for one key evicts the first when the second is used */
+	cache = OQS_KEM_key_cache_new(kem, entry_bytes);
+	if (cache == NULL) {
+		fprintf(stderr, "ERROR: OQS_KEM_key_cache_new failed\n");
+		goto cleanup;
+	}
+	for (int i = 0; i < 3; i++) {
+		rc = OQS_KEM_key_cache_decaps(cache, shared_secret_d, ciphertexts[i & 1], seeds[i & 1]);
+		OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+		OQS_TEST_CT_DECLASSIFY(shared_secret_d, kem->length_shared_secret);
+		OQS_TEST_CT_DECLASSIFY(shared_secret_e[i & 1], kem->length_shared_secret);
+		if (rc != OQS_SUCCESS || memcmp(shared_secret_d, shared_secret_e[i & 1], kem->length_shared_secret) != 0) {
+			fprintf(stderr, "ERROR: OQS_KEM_key_cache_decaps failed\n");
+			goto cleanup;
+		}
+	}
+	OQS_KEM_key_cache_stats(cache, &stats);
+	if (stats.hits != 0 || stats.misses != 3 || stats.evictions != 2 || stats.entries != 1 || stats.bytes > entry_bytes) {
+		fprintf(stderr, "ERROR: unexpected key cache counters after eviction\n");
+		goto cleanup;
+	}
+	printf("Seed-format keys: %zu-byte seeds, %zu bytes per cached key\n", kem->length_keypair_seed, entry_bytes);
+
+	ret = OQS_SUCCESS;
+
+cleanup:
+	OQS_KEM_key_cache_free(cache);
+	OQS_KEM_key_free(sk);
+	OQS_MEM_cleanse(seeds, sizeof seeds);
+	for (int i = 0; i < 2; i++) {
+		OQS_MEM_insecure_free(public_keys[i]);
+		OQS_MEM_insecure_free(ciphertexts[i]);
+		OQS_MEM_secure_free(shared_secret_e[i], kem->length_shared_secret);
+	}
+	OQS_MEM_secure_free(secret_key, kem->length_secret_key);
+	OQS_MEM_secure_free(exported, kem->length_secret_key);
+	OQS_MEM_secure_free(shared_secret_d, kem->length_shared_secret);
+	return ret;
+}
+
 static OQS_STATUS kem_test_correctness(const char *method_name, bool derand) {
 
 	OQS_KEM *kem = NULL;
@@ -278,6 +497,14 @@ static OQS_STATUS kem_test_correctness(const char *method_name, bool derand) {
 		printf("shared secrets are equal\n");
 	}
 
+	if (kem_test_key_handles(kem, public_key, secret_key) != OQS_SUCCESS) {
+		goto err;
+	}
+
+	if (kem_test_key_seeds(kem) != OQS_SUCCESS) {
+		goto err;
+	}
+
 #ifdef OQS_ENABLE_KEM_ML_KEM
 	/* check mlkem rejection testcases. returns true for all other kem algos */
 	if (false == mlkem_rej_testcase(kem, ciphertext, secret_key)) {
@@ -383,6 +610,122 @@ void *test_wrapper(void *arg) {
 	OQS_thread_stop();
 	return NULL;
 }
+
+#if !defined(OQS_ENABLE_TEST_CONSTANT_TIME)
+#define THREAD_SOURCE_WORKERS 3
+
+/* Each worker draws its randomness from SHAKE256(seed || counter). */
+struct thread_source_data {
+	const char *alg_name;
+	uint8_t seed[32];
+	uint64_t counter;
+	uint8_t *public_key;
+	size_t public_key_len;
+	OQS_STATUS rc;
+};
+
+static void thread_source_randombytes(uint8_t *random_array, size_t bytes_to_read, void *ctx) {
+	struct thread_source_data *td = ctx;
+	uint8_t input[sizeof(td->seed) + 8];
+
+	memcpy(input, td->seed, sizeof(td->seed));
+	for (size_t i = 0; i < 8; i++) {
+		input[sizeof(td->seed) + i] = (uint8_t)(td->counter >> (8 * i));
+	}
+	td->counter++;
+	OQS_SHA3_shake256(random_array, bytes_to_read, input, sizeof(input));
+}
+
+static void *thread_source_keypair(void *arg) {
+	struct thread_source_data *td = arg;
+	OQS_KEM *kem = OQS_KEM_new(td->alg_name);
+	uint8_t *secret_key = NULL;
+	void (*source)(uint8_t *, size_t, void *);
+	void *ctx;
+
+	td->rc = OQS_ERROR;
+	if (kem == NULL) {
+		goto cleanup;
+	}
+	td->public_key_len = kem->length_public_key;
+	td->public_key = OQS_MEM_malloc(kem->length_public_key);
+	secret_key = OQS_MEM_malloc(kem->length_secret_key);
+	if (td->public_key == NULL || secret_key == NULL) {
+		goto cleanup;
+	}
+	if (OQS_randombytes_set_thread_source(&thread_source_randombytes, td) != OQS_SUCCESS) {
+		goto cleanup;
+	}
+	// a warm-up in between must neither replace the thread's source nor draw from it
+	if (OQS_KEM_warmup(td->alg_name) == OQS_SUCCESS) {
+		OQS_randombytes_get_thread_source(&source, &ctx);
+		if (source == &thread_source_randombytes && ctx == td && td->counter == 0) {
+			td->rc = OQS_KEM_keypair(kem, td->public_key, secret_key);
+		}
+	}
+	(void)OQS_randombytes_set_thread_source(NULL, NULL);
+
+cleanup:
+	if (kem != NULL) {
+		OQS_MEM_secure_free(secret_key, kem->length_secret_key);
+	}
+	OQS_KEM_free(kem);
+	OQS_thread_stop();
+	return NULL;
+}
+
+/* Workers that run concurrently with per-thread sources get reproducible keys:
+ * equal seeds give equal keys, different seeds different ones. */
+static OQS_STATUS kem_test_thread_sources(const char *alg_name) {
+	struct thread_source_data td[THREAD_SOURCE_WORKERS];
+	pthread_t threads[THREAD_SOURCE_WORKERS];
+	bool started[THREAD_SOURCE_WORKERS];
+	OQS_STATUS rc = OQS_SUCCESS;
+
+	for (size_t i = 0; i < THREAD_SOURCE_WORKERS; i++) {
+		memset(&td[i], 0, sizeof(td[i]));
+		td[i].alg_name = alg_name;
+		// workers 0 and 1 share a seed
+		memset(td[i].seed, i == 2 ? 0x02 : 0x01, sizeof(td[i].seed));
+		started[i] = pthread_create(&threads[i], NULL, thread_source_keypair, &td[i]) == 0;
+	}
+	for (size_t i = 0; i < THREAD_SOURCE_WORKERS; i++) {
+		if (started[i]) {
+			pthread_join(threads[i], NULL);
+		}
+		if (!started[i] || td[i].rc != OQS_SUCCESS) {
+			fprintf(stderr, "ERROR: keypair with a thread randomness source failed\n");
+			rc = OQS_ERROR;
+		}
+	}
+	if (rc == OQS_SUCCESS) {
+		if (memcmp(td[0].public_key, td[1].public_key, td[0].public_key_len) != 0) {
+			fprintf(stderr, "ERROR: equal thread randomness sources gave different keys\n");
+			rc = OQS_ERROR;
+		} else if (memcmp(td[0].public_key, td[2].public_key, td[0].public_key_len) == 0) {
+			fprintf(stderr, "ERROR: different thread randomness sources gave equal keys\n");
+			rc = OQS_ERROR;
+		} else {
+			printf("Thread randomness sources: %d concurrent workers, reproducible keys\n", THREAD_SOURCE_WORKERS);
+		}
+	}
+	for (size_t i = 0; i < THREAD_SOURCE_WORKERS; i++) {
+		OQS_MEM_insecure_free(td[i].public_key);
+	}
+	return rc;
+}
+#endif
+#endif
+
+#if !defined(OQS_ENABLE_TEST_CONSTANT_TIME)
+/* Counts what the process-wide RNG hands out; the warm-up must not draw from it,
+ * except in embedded builds, which have no per-thread sources to warm up with. */
+static size_t warmup_rng_bytes = 0;
+
+static void warmup_counting_randombytes(uint8_t *random_array, size_t bytes_to_read) {
+	memset(random_array, 0, bytes_to_read);
+	warmup_rng_bytes += bytes_to_read;
+}
 #endif
 
 int main(int argc, char **argv) {
@@ -417,6 +760,31 @@ int main(int argc, char **argv) {
 #ifdef OQS_ENABLE_TEST_CONSTANT_TIME
 	OQS_randombytes_custom_algorithm(&TEST_KEM_randombytes);
 #else
+	OQS_randombytes_custom_algorithm(&warmup_counting_randombytes);
+	if (OQS_KEM_warmup(alg_name) != OQS_SUCCESS) {
+		fprintf(stderr, "ERROR: OQS_KEM_warmup failed\n");
+		OQS_destroy();
+		return EXIT_FAILURE;
+	}
+#if defined(OQS_EMBEDDED_BUILD)
+	if (warmup_rng_bytes == 0) {
+		fprintf(stderr, "ERROR: OQS_KEM_warmup did not draw from the custom RNG\n");
+		OQS_destroy();
+		return EXIT_FAILURE;
+	}
+	// there is no system RNG in embedded builds
+	uint8_t entropy_input[48];
+	for (size_t i = 0; i < sizeof(entropy_input); i++) {
+		entropy_input[i] = (uint8_t)i;
+	}
+	OQS_randombytes_nist_kat_init_256bit(entropy_input, NULL);
+	OQS_randombytes_custom_algorithm(&OQS_randombytes_nist_kat);
+#else
+	if (warmup_rng_bytes != 0) {
+		fprintf(stderr, "ERROR: OQS_KEM_warmup drew %zu bytes from the RNG\n", warmup_rng_bytes);
+		OQS_destroy();
+		return EXIT_FAILURE;
+	}
 	rc = OQS_randombytes_switch_algorithm("system");
 	if (rc != OQS_SUCCESS) {
 		printf("Could not generate random data with system RNG\n");
@@ -424,6 +792,7 @@ int main(int argc, char **argv) {
 		return EXIT_FAILURE;
 	}
 #endif
+#endif
 
 #if OQS_USE_PTHREADS
 #define MAX_LEN_KEM_NAME_ 64
@@ -448,6 +817,11 @@ int main(int argc, char **argv) {
 		}
 		pthread_join(thread, NULL);
 		rc = td.rc;
+#if !defined(OQS_ENABLE_TEST_CONSTANT_TIME)
+		if (rc == OQS_SUCCESS) {
+			rc = kem_test_thread_sources(alg_name);
+		}
+#endif
 	} else {
 		rc = kem_test_correctness(alg_name, false);
 		if (rc == OQS_SUCCESS) {
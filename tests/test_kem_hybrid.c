@@ -0,0 +1,254 @@
+// SPDX-License-Identifier: MIT
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <oqs/oqs.h>
+#include <oqs/sha3.h>
+
+#include "system_info.c"
+
+/* RFC 7748, Section 5.2 and Section 6.1 */
+static const char *rfc7748_scalar = "a546e36bf0527c9d3b16154b82465edd62144c0ac1fc5a18506a2244ba449ac4";
+static const char *rfc7748_u = "e6db6867583030db3594c1a424b15f7c726624ec26b3353b10a903a6d0ab1c4c";
+static const char *rfc7748_out = "c3da55379de9c6908e94ea4df28d084f32eccf03491c71f754b4075577a28552";
+static const char *alice_sk = "77076d0a7318a57d3c16c17251b26645df4c2f87ebc0992ab177fba51db92c2a";
+static const char *alice_pk = "8520f0098930a754748b7ddcb43ef75a0dbf3a0d26381af4eba4a98eaa9b4e6a";
+static const char *bob_sk = "5dab087e624a8a4b79e17f8b83800ee66f3bb1292618b6fd1c2f8b27ff88e0eb";
+static const char *bob_pk = "de9edb7d7b7dc1b4d35b61c2ece435373f8343c85b78674dadfc7e146f882b4f";
+static const char *shared = "4a5d9d5ba4ce2de1728e3bf480350f25e07e21c947d19e3376f09b3c1e161742";
+
+static uint8_t fixed_randomness[32];
+
+static void fixed_randombytes(uint8_t *random_array, size_t bytes_to_read) {
+	memcpy(random_array, fixed_randomness, bytes_to_read < 32 ? bytes_to_read : 32);
+}
+
+static void hex_decode(uint8_t *out, const char *hex, size_t len) {
+	for (size_t i = 0; i < len; i++) {
+		unsigned int b;
+		sscanf(hex + 2 * i, "%2x", &b);
+		out[i] = (uint8_t) b;
+	}
+}
+
+static bool check(const char *what, const uint8_t *got, const char *expected_hex) {
+	uint8_t expected[32];
+	hex_decode(expected, expected_hex, 32);
+	if (memcmp(got, expected, 32) != 0) {
+		fprintf(stderr, "ERROR: %s mismatch\n", what);
+		return false;
+	}
+	return true;
+}
+
+static OQS_STATUS test_x25519(void) {
+	const OQS_KEM_CLASSICAL *x25519 = OQS_KEM_classical_x25519();
+	uint8_t sk[32], pk[32], ct[32], ss[32], u[32];
+	bool ok = true;
+
+	hex_decode(sk, rfc7748_scalar, 32);
+	hex_decode(u, rfc7748_u, 32);
+	ok &= x25519->decaps(x25519->ctx, ss, u, sk) == OQS_SUCCESS;
+	ok &= check("X25519 (RFC 7748 5.2)", ss, rfc7748_out);
+
+	OQS_randombytes_custom_algorithm(fixed_randombytes);
+	hex_decode(fixed_randomness, alice_sk, 32);
+	ok &= x25519->keypair(x25519->ctx, pk, sk) == OQS_SUCCESS;
+	ok &= check("X25519 Alice public key", pk, alice_pk);
+
+	hex_decode(fixed_randomness, bob_sk, 32);
+	ok &= x25519->encaps(x25519->ctx, ct, ss, pk) == OQS_SUCCESS;
+	ok &= check("X25519 Bob public key", ct, bob_pk);
+	ok &= check("X25519 encaps shared secret", ss, shared);
+	ok &= x25519->decaps(x25519->ctx, ss, ct, sk) == OQS_SUCCESS;
+	ok &= check("X25519 decaps shared secret", ss, shared);
+	OQS_randombytes_switch_algorithm(OQS_RAND_alg_system);
+
+	/* The all-zero point yields an all-zero output, which must be rejected. */
+	memset(u, 0, sizeof(u));
+	if (x25519->decaps(x25519->ctx, ss, u, sk) != OQS_ERROR) {
+		fprintf(stderr, "ERROR: X25519 accepted a low-order point\n");
+		ok = false;
+	}
+	return ok ? OQS_SUCCESS : OQS_ERROR;
+}
+
+/* The combiner must match a one-shot hash over the concatenated transcript. */
+static OQS_STATUS test_combine(const OQS_KEM_HYBRID *hybrid) {
+	const size_t ss_pq_len = hybrid->pq->length_shared_secret;
+	const size_t ct_pq_len = hybrid->pq->length_ciphertext;
+	const size_t c_len = 32;
+	const bool bind = (hybrid->flags & OQS_KEM_HYBRID_FLAG_BIND_PQ_CIPHERTEXT) != 0;
+	uint8_t *ss_pq = OQS_MEM_malloc(ss_pq_len);
+	uint8_t *ct_pq = OQS_MEM_malloc(ct_pq_len);
+	uint8_t *transcript = OQS_MEM_malloc(ss_pq_len + 3 * c_len + ct_pq_len + hybrid->label_len);
+	uint8_t ss_c[32], ct_c[32], pk_c[32], expected[32], got[32];
+	OQS_STATUS rc = OQS_ERROR;
+	size_t off = 0;
+
+	if (ss_pq == NULL || ct_pq == NULL || transcript == NULL) {
+		goto err;
+	}
+	OQS_randombytes(ss_pq, ss_pq_len);
+	OQS_randombytes(ct_pq, ct_pq_len);
+	OQS_randombytes(ss_c, sizeof(ss_c));
+	OQS_randombytes(ct_c, sizeof(ct_c));
+	OQS_randombytes(pk_c, sizeof(pk_c));
+
+	memcpy(transcript + off, ss_pq, ss_pq_len);
+	off += ss_pq_len;
+	memcpy(transcript + off, ss_c, c_len);
+	off += c_len;
+	memcpy(transcript + off, ct_c, c_len);
+	off += c_len;
+	memcpy(transcript + off, pk_c, c_len);
+	off += c_len;
+	if (bind) {
+		memcpy(transcript + off, ct_pq, ct_pq_len);
+		off += ct_pq_len;
+	}
+	memcpy(transcript + off, hybrid->label, hybrid->label_len);
+	off += hybrid->label_len;
+
+	if (hybrid->flags & OQS_KEM_HYBRID_FLAG_SHAKE256) {
+		OQS_SHA3_shake256(expected, sizeof(expected), transcript, off);
+	} else {
+		OQS_SHA3_sha3_256(expected, transcript, off);
+	}
+	if (OQS_KEM_HYBRID_combine(hybrid, got, ss_pq, ss_c, ct_pq, ct_c, pk_c) != OQS_SUCCESS ||
+	        memcmp(got, expected, sizeof(got)) != 0) {
+		fprintf(stderr, "ERROR: combiner does not match one-shot hash (flags %u)\n", (unsigned) hybrid->flags);
+		goto err;
+	}
+	rc = OQS_SUCCESS;
+
+err:
+	OQS_MEM_insecure_free(ss_pq);
+	OQS_MEM_insecure_free(ct_pq);
+	OQS_MEM_insecure_free(transcript);
+	return rc;
+}
+
+#define BATCH 6
+
+static OQS_STATUS test_hybrid(const OQS_KEM *kem, uint32_t flags) {
+	OQS_KEM_HYBRID *hybrid = OQS_KEM_HYBRID_new(kem, OQS_KEM_classical_x25519(), NULL, 0, flags);
+	uint8_t *pk = NULL, *sk = NULL, *ct = NULL, *ss_e = NULL, *ss_d = NULL;
+	OQS_STATUS rc = OQS_ERROR;
+
+	if (hybrid == NULL) {
+		fprintf(stderr, "ERROR: OQS_KEM_HYBRID_new failed\n");
+		return OQS_ERROR;
+	}
+	pk = OQS_MEM_malloc(BATCH * hybrid->length_public_key);
+	sk = OQS_MEM_malloc(BATCH * hybrid->length_secret_key);
+	ct = OQS_MEM_malloc(BATCH * hybrid->length_ciphertext);
+	ss_e = OQS_MEM_malloc(BATCH * hybrid->length_shared_secret);
+	ss_d = OQS_MEM_malloc(BATCH * hybrid->length_shared_secret);
+	if (pk == NULL || sk == NULL || ct == NULL || ss_e == NULL || ss_d == NULL) {
+		goto err;
+	}
+
+	if (test_combine(hybrid) != OQS_SUCCESS) {
+		goto err;
+	}
+
+	for (size_t i = 0; i < BATCH; i++) {
+		if (OQS_KEM_HYBRID_keypair(hybrid, pk + i * hybrid->length_public_key,
+		                           sk + i * hybrid->length_secret_key) != OQS_SUCCESS) {
+			fprintf(stderr, "ERROR: OQS_KEM_HYBRID_keypair failed\n");
+			goto err;
+		}
+	}
+
+	/* single */
+	if (OQS_KEM_HYBRID_encaps(hybrid, ct, ss_e, pk) != OQS_SUCCESS ||
+	        OQS_KEM_HYBRID_decaps(hybrid, ss_d, ct, sk) != OQS_SUCCESS ||
+	        memcmp(ss_e, ss_d, hybrid->length_shared_secret) != 0) {
+		fprintf(stderr, "ERROR: hybrid shared secrets differ\n");
+		goto err;
+	}
+
+	/* a modified classical ciphertext must change the shared secret */
+	ct[hybrid->length_ciphertext - 1] ^= 0x01;
+	if (OQS_KEM_HYBRID_decaps(hybrid, ss_d, ct, sk) == OQS_SUCCESS &&
+	        memcmp(ss_e, ss_d, hybrid->length_shared_secret) == 0) {
+		fprintf(stderr, "ERROR: modified classical ciphertext gave the same shared secret\n");
+		goto err;
+	}
+
+	/* batch, including a partial group of four */
+	if (OQS_KEM_HYBRID_encaps_batch(hybrid, BATCH, ct, ss_e, pk) != OQS_SUCCESS ||
+	        OQS_KEM_HYBRID_decaps_batch(hybrid, BATCH, ss_d, ct, sk) != OQS_SUCCESS ||
+	        memcmp(ss_e, ss_d, BATCH * hybrid->length_shared_secret) != 0) {
+		fprintf(stderr, "ERROR: batch hybrid shared secrets differ\n");
+		goto err;
+	}
+	for (size_t i = 0; i < BATCH; i++) {
+		uint8_t ss[OQS_KEM_HYBRID_length_shared_secret];
+		if (OQS_KEM_HYBRID_decaps(hybrid, ss, ct + i * hybrid->length_ciphertext,
+		                          sk + i * hybrid->length_secret_key) != OQS_SUCCESS ||
+		        memcmp(ss, ss_d + i * hybrid->length_shared_secret, sizeof(ss)) != 0) {
+			fprintf(stderr, "ERROR: batch and single decapsulation differ at index %zu\n", i);
+			goto err;
+		}
+	}
+	rc = OQS_SUCCESS;
+
+err:
+	OQS_MEM_secure_free(sk, hybrid->length_secret_key * BATCH);
+	OQS_MEM_insecure_free(pk);
+	OQS_MEM_insecure_free(ct);
+	OQS_MEM_insecure_free(ss_e);
+	OQS_MEM_insecure_free(ss_d);
+	OQS_KEM_HYBRID_free(hybrid);
+	return rc;
+}
+
+int main(int argc, char **argv) {
+	const char *alg_name = OQS_KEM_alg_ml_kem_768;
+	OQS_KEM *kem = NULL;
+	int ret = EXIT_FAILURE;
+
+	OQS_init();
+	printf("Testing hybrid KEM combiner\n");
+	print_system_info();
+
+	if (argc > 1) {
+		alg_name = argv[1];
+	} else if (!OQS_KEM_alg_is_enabled(alg_name)) {
+		/* fall back to the first enabled KEM */
+		for (int i = 0; i < OQS_KEM_alg_count(); i++) {
+			if (OQS_KEM_alg_is_enabled(OQS_KEM_alg_identifier(i))) {
+				alg_name = OQS_KEM_alg_identifier(i);
+				break;
+			}
+		}
+	}
+	kem = OQS_KEM_new(alg_name);
+	if (kem == NULL) {
+		printf("No KEM enabled for the hybrid test\n");
+		OQS_destroy();
+		return EXIT_SUCCESS;
+	}
+	printf("Post-quantum component: %s\n", kem->method_name);
+
+	if (test_x25519() != OQS_SUCCESS) {
+		goto err;
+	}
+	for (uint32_t flags = 0; flags <= (OQS_KEM_HYBRID_FLAG_SHAKE256 | OQS_KEM_HYBRID_FLAG_BIND_PQ_CIPHERTEXT); flags++) {
+		if (test_hybrid(kem, flags) != OQS_SUCCESS) {
+			goto err;
+		}
+	}
+	printf("Hybrid KEM tests passed\n");
+	ret = EXIT_SUCCESS;
+
+err:
+	OQS_KEM_free(kem);
+	OQS_destroy();
+	return ret;
+}
@@ -7,9 +7,11 @@
  * 2. Polynomial multiplication via NTT
  * 3. Platform-specific implementations
  * 4. Edge cases and error conditions
+ * 5. NTRU and sntrup761 ring multiplication against schoolbook products
  */
 
 #include <oqs/oqs_ntt_api.h>
+#include <oqs/oqs_ring_mul_api.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -495,6 +497,150 @@ static int test_falcon_clean_consistency(void) {
     return 1;
 }
 
+/* ============================================================================
+ * Ring Multiplication Tests (NTRU, sntrup761)
+ * ============================================================================ */
+
+#define RING_MUL_BATCH 3
+#define NTRU_MAX_N 1373
+#define SNTRUP761_P OQS_KEM_ntruprime_sntrup761_p
+#define SNTRUP761_Q OQS_KEM_ntruprime_sntrup761_q
+
+/**
+ * @brief Schoolbook product in Z_q[x]/(x^n - 1), q a power of two
+ */
+static void ntru_schoolbook(uint16_t *r, const uint16_t *a, const uint16_t *b, size_t n, uint16_t q) {
+    for (size_t k = 0; k < n; k++) {
+        uint32_t acc = 0;
+        for (size_t i = 0; i < n; i++) {
+            acc += (uint32_t)a[i] * b[(n + k - i) % n];
+        }
+        r[k] = (uint16_t)(acc & (q - 1));
+    }
+}
+
+/**
+ * @brief Test NTRU multiplication for one ring degree
+ *
+ * Checks single, batched and in-place products against schoolbook.
+ */
+static int test_ntru_Rq_mul(size_t n, uint16_t q) {
+    static uint16_t a[RING_MUL_BATCH * NTRU_MAX_N], b[RING_MUL_BATCH * NTRU_MAX_N];
+    static uint16_t r[RING_MUL_BATCH * NTRU_MAX_N], expected[RING_MUL_BATCH * NTRU_MAX_N];
+    char name[64];
+
+    snprintf(name, sizeof(name), "NTRU Rq multiplication (n=%zu)", n);
+    TEST_START(name);
+
+    // Full 16-bit inputs: only their residues modulo q may matter
+    for (size_t i = 0; i < RING_MUL_BATCH * n; i++) {
+        a[i] = (uint16_t)rand();
+        b[i] = (uint16_t)rand();
+    }
+    for (size_t j = 0; j < RING_MUL_BATCH; j++) {
+        ntru_schoolbook(expected + j * n, a + j * n, b + j * n, n, q);
+    }
+
+    ASSERT(OQS_KEM_ntru_poly_Rq_mul(r, a, b, n) == OQS_SUCCESS, "Multiplication failed");
+    ASSERT(memcmp(r, expected, n * sizeof(uint16_t)) == 0, "Product differs from schoolbook");
+
+    ASSERT(OQS_KEM_ntru_poly_Rq_mul_batch(r, a, b, n, RING_MUL_BATCH) == OQS_SUCCESS,
+           "Batched multiplication failed");
+    ASSERT(memcmp(r, expected, RING_MUL_BATCH * n * sizeof(uint16_t)) == 0,
+           "Batched product differs from schoolbook");
+
+    ASSERT(OQS_KEM_ntru_poly_Rq_mul(a, a, b, n) == OQS_SUCCESS, "In-place multiplication failed");
+    ASSERT(memcmp(a, expected, n * sizeof(uint16_t)) == 0, "In-place product differs from schoolbook");
+
+    TEST_PASS();
+    return 1;
+}
+
+/**
+ * @brief Test that degrees without an NTRU parameter set are rejected
+ */
+static int test_ntru_unsupported_degree(void) {
+    TEST_START("NTRU Rq multiplication rejects n=512");
+
+    uint16_t a[512] = {0}, b[512] = {0}, r[512];
+
+    ASSERT(OQS_KEM_ntru_poly_Rq_mul(r, a, b, 512) == OQS_ERROR, "n=512 accepted");
+
+    TEST_PASS();
+    return 1;
+}
+
+/**
+ * @brief Centered representative of x modulo the sntrup761 q
+ */
+static int16_t sntrup761_center(int64_t x) {
+    int64_t t = x % SNTRUP761_Q;
+    if (t < 0) t += SNTRUP761_Q;
+    if (t > (SNTRUP761_Q - 1) / 2) t -= SNTRUP761_Q;
+    return (int16_t)t;
+}
+
+/**
+ * @brief Schoolbook product in Z_q[x]/(x^p - x - 1)
+ */
+static void sntrup761_schoolbook(int16_t *h, const int16_t *f, const int8_t *g) {
+    int64_t fg[2 * SNTRUP761_P - 1] = {0};
+
+    for (size_t i = 0; i < SNTRUP761_P; i++) {
+        for (size_t j = 0; j < SNTRUP761_P; j++) {
+            fg[i + j] += (int64_t)f[i] * g[j];
+        }
+    }
+    // x^p = x + 1
+    for (size_t i = 2 * SNTRUP761_P - 2; i >= SNTRUP761_P; i--) {
+        fg[i - SNTRUP761_P] += fg[i];
+        fg[i - SNTRUP761_P + 1] += fg[i];
+    }
+    for (size_t i = 0; i < SNTRUP761_P; i++) {
+        h[i] = sntrup761_center(fg[i]);
+    }
+}
+
+/**
+ * @brief Test sntrup761 multiplication by small polynomials
+ *
+ * Checks single, batched and in-place products against schoolbook.
+ */
+static int test_sntrup761_Rq_mul_small(void) {
+    TEST_START("sntrup761 Rq by small multiplication");
+
+    static int16_t f[RING_MUL_BATCH * SNTRUP761_P], h[RING_MUL_BATCH * SNTRUP761_P];
+    static int16_t expected[RING_MUL_BATCH * SNTRUP761_P];
+    static int8_t g[RING_MUL_BATCH * SNTRUP761_P];
+
+    // f is not reduced: the API takes any int16_t
+    for (size_t i = 0; i < RING_MUL_BATCH * SNTRUP761_P; i++) {
+        f[i] = (int16_t)rand();
+        g[i] = (int8_t)(rand() % 3 - 1);
+    }
+    for (size_t j = 0; j < RING_MUL_BATCH; j++) {
+        sntrup761_schoolbook(expected + j * SNTRUP761_P, f + j * SNTRUP761_P, g + j * SNTRUP761_P);
+    }
+
+    ASSERT(OQS_KEM_ntruprime_sntrup761_poly_Rq_mul_small(h, f, g) == OQS_SUCCESS,
+           "Multiplication failed");
+    ASSERT(memcmp(h, expected, SNTRUP761_P * sizeof(int16_t)) == 0,
+           "Product differs from schoolbook");
+
+    ASSERT(OQS_KEM_ntruprime_sntrup761_poly_Rq_mul_small_batch(h, f, g, RING_MUL_BATCH) == OQS_SUCCESS,
+           "Batched multiplication failed");
+    ASSERT(memcmp(h, expected, RING_MUL_BATCH * SNTRUP761_P * sizeof(int16_t)) == 0,
+           "Batched product differs from schoolbook");
+
+    ASSERT(OQS_KEM_ntruprime_sntrup761_poly_Rq_mul_small(f, f, g) == OQS_SUCCESS,
+           "In-place multiplication failed");
+    ASSERT(memcmp(f, expected, SNTRUP761_P * sizeof(int16_t)) == 0,
+           "In-place product differs from schoolbook");
+
+    TEST_PASS();
+    return 1;
+}
+
 /* ============================================================================
  * Performance Benchmarks
  * ============================================================================ */
@@ -613,6 +759,52 @@ static void benchmark_falcon_1024_clean(void) {
            ops_per_sec, time_sec, iterations);
 }
 
+/**
+ * @brief Benchmark batched NTRU and sntrup761 ring multiplication
+ */
+static void benchmark_ring_mul(void) {
+    const int iterations = 1000;
+    static uint16_t a[RING_MUL_BATCH * NTRU_MAX_N], b[RING_MUL_BATCH * NTRU_MAX_N], r[RING_MUL_BATCH * NTRU_MAX_N];
+    static int16_t f[RING_MUL_BATCH * SNTRUP761_P], h[RING_MUL_BATCH * SNTRUP761_P];
+    static int8_t g[RING_MUL_BATCH * SNTRUP761_P];
+    const size_t degrees[] = {509, 677, 701, 821};
+
+    for (size_t i = 0; i < RING_MUL_BATCH * NTRU_MAX_N; i++) {
+        a[i] = (uint16_t)rand();
+        b[i] = (uint16_t)rand();
+    }
+    for (size_t d = 0; d < sizeof(degrees) / sizeof(degrees[0]); d++) {
+        if (OQS_KEM_ntru_poly_Rq_mul(r, a, b, degrees[d]) != OQS_SUCCESS) {
+            continue;
+        }
+        clock_t start = clock();
+        for (int i = 0; i < iterations; i++) {
+            OQS_KEM_ntru_poly_Rq_mul_batch(r, a, b, degrees[d], RING_MUL_BATCH);
+        }
+        clock_t end = clock();
+
+        double time_sec = ((double)(end - start)) / CLOCKS_PER_SEC;
+        printf("  NTRU Rq mul n=%-4zu:    %8.2f ops/sec  (%.4f sec for %d products)\n",
+               degrees[d], iterations * RING_MUL_BATCH / time_sec, time_sec, iterations * RING_MUL_BATCH);
+    }
+
+    for (size_t i = 0; i < RING_MUL_BATCH * SNTRUP761_P; i++) {
+        f[i] = (int16_t)rand();
+        g[i] = (int8_t)(rand() % 3 - 1);
+    }
+    if (OQS_KEM_ntruprime_sntrup761_poly_Rq_mul_small(h, f, g) == OQS_SUCCESS) {
+        clock_t start = clock();
+        for (int i = 0; i < iterations; i++) {
+            OQS_KEM_ntruprime_sntrup761_poly_Rq_mul_small_batch(h, f, g, RING_MUL_BATCH);
+        }
+        clock_t end = clock();
+
+        double time_sec = ((double)(end - start)) / CLOCKS_PER_SEC;
+        printf("  sntrup761 Rq mul:      %8.2f ops/sec  (%.4f sec for %d products)\n",
+               iterations * RING_MUL_BATCH / time_sec, time_sec, iterations * RING_MUL_BATCH);
+    }
+}
+
 /* ============================================================================
  * Main Test Runner
  * ============================================================================ */
@@ -646,6 +838,31 @@ int main(void) {
     test_falcon_clean_linearity();
     test_falcon_clean_consistency();
 
+    /* Ring Multiplication Tests */
+    printf("\n--- Ring Multiplication Tests ---\n");
+#if defined(OQS_ENABLE_KEM_ntru_hps2048509)
+    test_ntru_Rq_mul(509, 2048);
+#endif
+#if defined(OQS_ENABLE_KEM_ntru_hps2048677)
+    test_ntru_Rq_mul(677, 2048);
+#endif
+#if defined(OQS_ENABLE_KEM_ntru_hps4096821)
+    test_ntru_Rq_mul(821, 4096);
+#endif
+#if defined(OQS_ENABLE_KEM_ntru_hps40961229)
+    test_ntru_Rq_mul(1229, 4096);
+#endif
+#if defined(OQS_ENABLE_KEM_ntru_hrss701)
+    test_ntru_Rq_mul(701, 8192);
+#endif
+#if defined(OQS_ENABLE_KEM_ntru_hrss1373)
+    test_ntru_Rq_mul(1373, 16384);
+#endif
+    test_ntru_unsupported_degree();
+#if defined(OQS_ENABLE_KEM_ntruprime_sntrup761)
+    test_sntrup761_Rq_mul_small();
+#endif
+
     /* Performance Benchmarks */
     printf("\n--- Performance Benchmarks ---\n");
     benchmark_ml_dsa_44_ref();
@@ -653,6 +870,7 @@ int main(void) {
     benchmark_ml_dsa_87_ref();
     benchmark_falcon_512_clean();
     benchmark_falcon_1024_clean();
+    benchmark_ring_mul();
 
     /* Test Summary */
     printf("\n");
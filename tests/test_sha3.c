@@ -19,6 +19,7 @@
 
 static bool sha3_callback_called = false;
 static bool sha3_x4_callback_called = false;
+static bool shake_absorb_callback_called = false;
 
 /**
 * \file sha3_test.h
@@ -188,6 +189,17 @@ int sha3_256_kat_test(void) {
 	OQS_SHA3_sha3_256_inc_ctx_reset(&state);
 	OQS_SHA3_sha3_256_inc_absorb(&state, msg1600, 200);
 	OQS_SHA3_sha3_256_inc_finalize(hash, &state);
+
+	if (are_equal8(hash, exp1600, 32) == EXIT_FAILURE) {
+		status = EXIT_FAILURE;
+	}
+
+	/* partial block followed by an absorb that crosses the rate boundary */
+	clear8(hash, 200);
+	OQS_SHA3_sha3_256_inc_ctx_reset(&state);
+	OQS_SHA3_sha3_256_inc_absorb(&state, msg1600, 1);
+	OQS_SHA3_sha3_256_inc_absorb(&state, msg1600 + 1, 199);
+	OQS_SHA3_sha3_256_inc_finalize(hash, &state);
 	OQS_SHA3_sha3_256_inc_ctx_release(&state);
 
 	if (are_equal8(hash, exp1600, 32) == EXIT_FAILURE) {
@@ -1169,6 +1181,78 @@ int shake_256_x4_kat_test(void) {
 	return status;
 }
 
+/**
+* \brief Tests the single-call SHAKE absorb against the incremental absorb for
+* every input length up to one block past the rate, which covers the
+* single-block fast path and the fallback.
+*
+* \return Returns 1 for success, 0 for failure
+*/
+int shake_absorb_once_test(void) {
+	uint8_t msg[OQS_SHA3_SHAKE128_RATE + 1];
+	uint8_t exp[4][64];
+	uint8_t out[4][64];
+	int status = EXIT_SUCCESS;
+
+	for (size_t i = 0; i < sizeof(msg); i++) {
+		msg[i] = (uint8_t) (i * 31 + 7);
+	}
+
+	for (size_t len = 0; len <= OQS_SHA3_SHAKE128_RATE + 1; len++) {
+		OQS_SHA3_shake128_inc_ctx s128;
+		OQS_SHA3_shake128_x4_inc_ctx s128x4;
+
+		OQS_SHA3_shake128_inc_init(&s128);
+		OQS_SHA3_shake128_inc_absorb(&s128, msg, len);
+		OQS_SHA3_shake128_inc_finalize(&s128);
+		OQS_SHA3_shake128_inc_squeeze(exp[0], 64, &s128);
+		OQS_SHA3_shake128_absorb_once(&s128, msg, len);
+		OQS_SHA3_shake128_inc_squeeze(out[0], 64, &s128);
+		OQS_SHA3_shake128_inc_ctx_release(&s128);
+		if (are_equal8(out[0], exp[0], 64) == EXIT_FAILURE) {
+			status = EXIT_FAILURE;
+		}
+
+		OQS_SHA3_shake128_x4_inc_init(&s128x4);
+		OQS_SHA3_shake128_x4_absorb_once(&s128x4, msg, msg, msg, msg, len);
+		OQS_SHA3_shake128_x4_inc_squeeze(out[0], out[1], out[2], out[3], 64, &s128x4);
+		OQS_SHA3_shake128_x4_inc_ctx_release(&s128x4);
+		for (size_t j = 0; j < 4; j++) {
+			if (are_equal8(out[j], exp[0], 64) == EXIT_FAILURE) {
+				status = EXIT_FAILURE;
+			}
+		}
+	}
+
+	for (size_t len = 0; len <= OQS_SHA3_SHAKE256_RATE + 1; len++) {
+		OQS_SHA3_shake256_inc_ctx s256;
+		OQS_SHA3_shake256_x4_inc_ctx s256x4;
+
+		OQS_SHA3_shake256_inc_init(&s256);
+		OQS_SHA3_shake256_inc_absorb(&s256, msg, len);
+		OQS_SHA3_shake256_inc_finalize(&s256);
+		OQS_SHA3_shake256_inc_squeeze(exp[0], 64, &s256);
+		OQS_SHA3_shake256_absorb_once(&s256, msg, len);
+		OQS_SHA3_shake256_inc_squeeze(out[0], 64, &s256);
+		OQS_SHA3_shake256_inc_ctx_release(&s256);
+		if (are_equal8(out[0], exp[0], 64) == EXIT_FAILURE) {
+			status = EXIT_FAILURE;
+		}
+
+		OQS_SHA3_shake256_x4_inc_init(&s256x4);
+		OQS_SHA3_shake256_x4_absorb_once(&s256x4, msg, msg, msg, msg, len);
+		OQS_SHA3_shake256_x4_inc_squeeze(out[0], out[1], out[2], out[3], 64, &s256x4);
+		OQS_SHA3_shake256_x4_inc_ctx_release(&s256x4);
+		for (size_t j = 0; j < 4; j++) {
+			if (are_equal8(out[j], exp[0], 64) == EXIT_FAILURE) {
+				status = EXIT_FAILURE;
+			}
+		}
+	}
+
+	return status;
+}
+
 extern struct OQS_SHA3_callbacks sha3_default_callbacks;
 
 static void override_SHA3_sha3_256_inc_init(OQS_SHA3_sha3_256_inc_ctx *state) {
@@ -1176,6 +1260,11 @@ static void override_SHA3_sha3_256_inc_init(OQS_SHA3_sha3_256_inc_ctx *state) {
 	sha3_default_callbacks.SHA3_sha3_256_inc_init(state);
 }
 
+static void override_SHA3_shake128_inc_absorb(OQS_SHA3_shake128_inc_ctx *state, const uint8_t *input, size_t inlen) {
+	shake_absorb_callback_called = true;
+	sha3_default_callbacks.SHA3_shake128_inc_absorb(state, input, inlen);
+}
+
 extern struct OQS_SHA3_x4_callbacks sha3_x4_default_callbacks;
 
 static void override_SHA3_shake128_x4_inc_init(OQS_SHA3_shake128_x4_inc_ctx *state) {
@@ -1208,9 +1297,18 @@ int main(UNUSED int argc, UNUSED char **argv) {
 	/* set SHA3 default callbacks */
 	sha3_trigger_dispatcher();
 #endif
+	/* the built-in callbacks take the single-block absorb fast path */
+	if (shake_absorb_once_test() == EXIT_SUCCESS) {
+		printf("Success! passed single-call shake absorb tests with the built-in callbacks \n");
+	} else {
+		printf("Failure! failed single-call shake absorb tests with the built-in callbacks \n");
+		ret = EXIT_FAILURE;
+	}
+
 	struct OQS_SHA3_callbacks sha3_callbacks = sha3_default_callbacks;
 
 	sha3_callbacks.SHA3_sha3_256_inc_init = override_SHA3_sha3_256_inc_init;
+	sha3_callbacks.SHA3_shake128_inc_absorb = override_SHA3_shake128_inc_absorb;
 	OQS_SHA3_set_callbacks(&sha3_callbacks);
 
 	struct OQS_SHA3_x4_callbacks sha3_x4_callbacks = sha3_x4_default_callbacks;
@@ -1270,16 +1368,58 @@ int main(UNUSED int argc, UNUSED char **argv) {
 		ret = EXIT_FAILURE;
 	}
 
+	if (shake_absorb_once_test() == EXIT_SUCCESS) {
+		printf("Success! passed single-call shake absorb tests \n");
+	} else {
+		printf("Failure! failed single-call shake absorb tests \n");
+		ret = EXIT_FAILURE;
+	}
+
 	if (!sha3_callback_called) {
 		printf("Failure! SHA3 callback was not called\n");
 		ret = EXIT_FAILURE;
 	}
 
+	/* application callbacks also serve the single-call absorb */
+	OQS_SHA3_shake128_inc_ctx s128;
+	const uint8_t msg[1] = {0};
+
+	OQS_SHA3_shake128_inc_init(&s128);
+	shake_absorb_callback_called = false;
+	OQS_SHA3_shake128_absorb_once(&s128, msg, sizeof(msg));
+	OQS_SHA3_shake128_inc_ctx_release(&s128);
+	if (!shake_absorb_callback_called) {
+		printf("Failure! single-call shake absorb bypassed the SHA3 callbacks\n");
+		ret = EXIT_FAILURE;
+	}
+
 	if (!sha3_x4_callback_called) {
 		printf("Failure! SHA3_x4 callback was not called\n");
 		ret = EXIT_FAILURE;
 	}
 
+#ifdef OQS_USE_SHA3_ROUTING
+	/* run the known answer tests again with every route on each backend */
+	OQS_SHA3_set_callbacks(&sha3_default_callbacks);
+	OQS_SHA3_x4_set_callbacks(&sha3_x4_default_callbacks);
+	for (int backend = OQS_SHA3_BACKEND_XKCP; backend <= OQS_SHA3_BACKEND_OPENSSL; backend++) {
+		for (int route = 0; route < OQS_SHA3_ROUTE_COUNT; route++) {
+			if (OQS_SHA3_set_backend((OQS_SHA3_ROUTE) route, (OQS_SHA3_BACKEND) backend) != OQS_SUCCESS) {
+				ret = EXIT_FAILURE;
+			}
+		}
+		if (sha3_256_kat_test() == EXIT_SUCCESS && sha3_384_kat_test() == EXIT_SUCCESS
+		        && sha3_512_kat_test() == EXIT_SUCCESS && shake_128_kat_test() == EXIT_SUCCESS
+		        && shake_256_kat_test() == EXIT_SUCCESS && shake_128_x4_kat_test() == EXIT_SUCCESS
+		        && shake_256_x4_kat_test() == EXIT_SUCCESS && shake_absorb_once_test() == EXIT_SUCCESS) {
+			printf("Success! passed known answer tests with all routes on %s\n", OQS_SHA3_backend_name(OQS_SHA3_ROUTE_SHA3));
+		} else {
+			printf("Failure! failed known answer tests with all routes on %s\n", OQS_SHA3_backend_name(OQS_SHA3_ROUTE_SHA3));
+			ret = EXIT_FAILURE;
+		}
+	}
+#endif
+
 	OQS_destroy();
 
 
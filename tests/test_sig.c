@@ -21,6 +21,266 @@ typedef struct magic_s {
 	uint8_t val[31];
 } magic_t;
 
+/* Signs and verifies through imported key handles, crossing over with the byte-oriented API. */
+static OQS_STATUS sig_test_key_handles(const OQS_SIG *sig, const uint8_t *public_key, const uint8_t *secret_key,
+                                       uint8_t *message, size_t message_len) {
+	OQS_SIG_KEY *pk = NULL, *sk = NULL, *pk_bytes = NULL;
+	uint8_t *signature = NULL;
+	size_t signature_len;
+	const uint8_t ctx[] = "liboqs key handle test";
+	OQS_STATUS rc, ret = OQS_ERROR;
+
+	signature = OQS_MEM_malloc(sig->length_signature);
+	pk = OQS_SIG_key_import(sig, public_key, sig->length_public_key, OQS_SIG_KEY_PUBLIC);
+	sk = OQS_SIG_key_import(sig, secret_key, sig->length_secret_key, OQS_SIG_KEY_SECRET);
+	pk_bytes = OQS_SIG_key_import(sig, public_key, sig->length_public_key, OQS_SIG_KEY_PUBLIC | OQS_SIG_KEY_BYTES_ONLY);
+	if (signature == NULL || pk == NULL || sk == NULL || pk_bytes == NULL) {
+		fprintf(stderr, "ERROR: OQS_SIG_key_import failed\n");
+		goto cleanup;
+	}
+	printf("Key handles: public key %s, secret key %s\n", OQS_SIG_key_is_expanded(pk) ? "expanded" : "bytes",
+	       OQS_SIG_key_is_expanded(sk) ? "expanded" : "bytes");
+	if (OQS_SIG_key_is_expanded(pk_bytes)) {
+		fprintf(stderr, "ERROR: OQS_SIG_KEY_BYTES_ONLY key was expanded\n");
+		goto cleanup;
+	}
+#if defined(OQS_ENABLE_SIG_ML_DSA) && !defined(OQS_ML_DSA_LOW_STACK)
+	if (0 == strncmp(sig->method_name, "ML-DSA", 6) && !(OQS_SIG_key_is_expanded(pk) && OQS_SIG_key_is_expanded(sk))) {
+		fprintf(stderr, "ERROR: ML-DSA key was not expanded\n");
+		goto cleanup;
+	}
+#endif
+
+	rc = OQS_SIG_key_sign(sig, signature, &signature_len, message, message_len, sk);
+	OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+	if (rc != OQS_SUCCESS) {
+		fprintf(stderr, "ERROR: OQS_SIG_key_sign failed\n");
+		goto cleanup;
+	}
+	OQS_TEST_CT_DECLASSIFY(signature, signature_len);
+	rc = OQS_SIG_verify(sig, message, message_len, signature, signature_len, public_key);
+	rc |= OQS_SIG_key_verify(sig, message, message_len, signature, signature_len, pk);
+	rc |= OQS_SIG_key_verify(sig, message, message_len, signature, signature_len, pk_bytes);
+	OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+	if (rc != OQS_SUCCESS) {
+		fprintf(stderr, "ERROR: OQS_SIG_key_verify failed\n");
+		goto cleanup;
+	}
+
+	message[0] ^= 1;
+	rc = OQS_SIG_key_verify(sig, message, message_len, signature, signature_len, pk);
+	message[0] ^= 1;
+	OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+	if (rc != OQS_ERROR) {
+		fprintf(stderr, "ERROR: OQS_SIG_key_verify succeeded on a modified message\n");
+		goto cleanup;
+	}
+
+	/* handles are typed: a secret key cannot verify and a public key cannot sign */
+	if (OQS_SIG_key_verify(sig, message, message_len, signature, signature_len, sk) != OQS_ERROR ||
+	        OQS_SIG_key_sign(sig, signature, &signature_len, message, message_len, pk) != OQS_ERROR) {
+		fprintf(stderr, "ERROR: key handle of the wrong type was accepted\n");
+		goto cleanup;
+	}
+
+	if (sig->sig_with_ctx_support) {
+		rc = OQS_SIG_key_sign_with_ctx_str(sig, signature, &signature_len, message, message_len, ctx, sizeof ctx, sk);
+		OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+		OQS_TEST_CT_DECLASSIFY(signature, signature_len);
+		if (rc == OQS_SUCCESS) {
+			rc = OQS_SIG_verify_with_ctx_str(sig, message, message_len, signature, signature_len, ctx, sizeof ctx, public_key);
+			rc |= OQS_SIG_key_verify_with_ctx_str(sig, message, message_len, signature, signature_len, ctx, sizeof ctx, pk);
+			OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+		}
+		if (rc != OQS_SUCCESS) {
+			fprintf(stderr, "ERROR: key handle sign/verify with context string failed\n");
+			goto cleanup;
+		}
+		rc = OQS_SIG_key_verify_with_ctx_str(sig, message, message_len, signature, signature_len, ctx, sizeof ctx - 1, pk);
+		OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+		if (rc != OQS_ERROR) {
+			fprintf(stderr, "ERROR: OQS_SIG_key_verify_with_ctx_str succeeded with a different context string\n");
+			goto cleanup;
+		}
+	}
+
+	ret = OQS_SUCCESS;
+
+cleanup:
+	OQS_SIG_key_free(pk);
+	OQS_SIG_key_free(sk);
+	OQS_SIG_key_free(pk_bytes);
+	OQS_MEM_insecure_free(signature);
+	return ret;
+}
+
+/* Checks seed-format secret keys: deterministic generation, import/export and signing through an expansion cache. */
+static OQS_STATUS sig_test_key_seeds(const OQS_SIG *sig, const uint8_t *message, size_t message_len) {
+	size_t seed_len = OQS_SIG_keypair_seed_length(sig);
+	uint8_t seeds[2][64];
+	uint8_t *public_keys[2] = {NULL, NULL};
+	uint8_t *secret_key = NULL, *exported = NULL, *signature = NULL;
+	size_t signature_len;
+	OQS_SIG_KEY *sk = NULL;
+	OQS_SIG_KEY_CACHE *cache = NULL;
+	OQS_KEY_CACHE_STATS stats;
+	size_t entry_bytes;
+	OQS_STATUS rc, ret = OQS_ERROR;
+
+	if (seed_len == 0) {
+		printf("Seed-format keys not supported\n");
+		return OQS_SUCCESS;
+	}
+	if (seed_len > sizeof seeds[0]) {
+		fprintf(stderr, "ERROR: unexpected seed length %zu\n", seed_len);
+		return OQS_ERROR;
+	}
+	OQS_randombytes(seeds[0], seed_len);
+	OQS_randombytes(seeds[1], seed_len);
+	/* key generation is covered by the keypair test; here the keys are
+	 * compared, and the cache looks them up by a hash of the seed */
+	OQS_TEST_CT_DECLASSIFY(seeds, sizeof seeds);
+
+	public_keys[0] = OQS_MEM_malloc(sig->length_public_key);
+	public_keys[1] = OQS_MEM_malloc(sig->length_public_key);
+	secret_key = OQS_MEM_malloc(sig->length_secret_key);
+	exported = OQS_MEM_malloc(sig->length_secret_key);
+	signature = OQS_MEM_malloc(sig->length_signature);
+	if (public_keys[0] == NULL || public_keys[1] == NULL || secret_key == NULL || exported == NULL || signature == NULL) {
+		fprintf(stderr, "ERROR: OQS_MEM_malloc failed\n");
+		goto cleanup;
+	}
+
+	rc = OQS_SIG_keypair_from_seed(sig, public_keys[0], secret_key, seeds[0]);
+	rc |= OQS_SIG_keypair_from_seed(sig, public_keys[1], exported, seeds[1]);
+	if (rc != OQS_SUCCESS) {
+		fprintf(stderr, "ERROR: OQS_SIG_keypair_from_seed failed\n");
+		goto cleanup;
+	}
+
+	/* the handle generates the same secret key and returns the seed */
+	sk = OQS_SIG_key_import(sig, seeds[0], seed_len, OQS_SIG_KEY_SECRET | OQS_SIG_KEY_SEED);
+	if (sk == NULL || OQS_SIG_key_export(sk, exported, sig->length_secret_key) != OQS_SUCCESS ||
+	        memcmp(exported, secret_key, sig->length_secret_key) != 0) {
+		fprintf(stderr, "ERROR: secret key imported from seed does not match OQS_SIG_keypair_from_seed\n");
+		goto cleanup;
+	}
+	if (OQS_SIG_key_export_seed(sk, exported, seed_len) != OQS_SUCCESS || memcmp(exported, seeds[0], seed_len) != 0) {
+		fprintf(stderr, "ERROR: OQS_SIG_key_export_seed does not return the imported seed\n");
+		goto cleanup;
+	}
+	if (OQS_SIG_key_import(sig, seeds[0], seed_len, OQS_SIG_KEY_PUBLIC | OQS_SIG_KEY_SEED) != NULL) {
+		fprintf(stderr, "ERROR: public key imported from a seed\n");
+		goto cleanup;
+	}
+
+	/* an unbounded cache: a miss, then a hit */
+	cache = OQS_SIG_key_cache_new(sig, SIZE_MAX);
+	for (int i = 0; i < 2 && cache != NULL; i++) {
+		rc = OQS_SIG_key_cache_sign(cache, signature, &signature_len, message, message_len, NULL, 0, seeds[0]);
+		OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+		OQS_TEST_CT_DECLASSIFY(signature, signature_len);
+		if (rc != OQS_SUCCESS || OQS_SIG_verify(sig, message, message_len, signature, signature_len, public_keys[0]) != OQS_SUCCESS) {
+			fprintf(stderr, "ERROR: OQS_SIG_key_cache_sign failed\n");
+			goto cleanup;
+		}
+	}
+	if (cache == NULL) {
+		fprintf(stderr, "ERROR: OQS_SIG_key_cache_new failed\n");
+		goto cleanup;
+	}
+	OQS_SIG_key_cache_stats(cache, &stats);
+	if (stats.hits != 1 || stats.misses != 1 || stats.entries != 1) {
+		fprintf(stderr, "ERROR: unexpected key cache counters\n");
+		goto cleanup;
+	}
+	entry_bytes = stats.bytes;
+	OQS_SIG_key_cache_free(cache);
+
+	/* a cache with room for one key evicts the first when the second is used */
+	cache = OQS_SIG_key_cache_new(sig, entry_bytes);
+	for (int i = 0; i < 3 && cache != NULL; i++) {
+		rc = OQS_SIG_key_cache_sign(cache, signature, &signature_len, message, message_len, NULL, 0, seeds[i & 1]);
+		OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+		OQS_TEST_CT_DECLASSIFY(signature, signature_len);
+		if (rc != OQS_SUCCESS || OQS_SIG_verify(sig, message, message_len, signature, signature_len, public_keys[i & 1]) != OQS_SUCCESS) {
+			fprintf(stderr, "ERROR: OQS_SIG_key_cache_sign failed\n");
+			goto cleanup;
+		}
+	}
+	if (cache == NULL) {
+		fprintf(stderr, "ERROR: OQS_SIG_key_cache_new failed\n");
+		goto cleanup;
+	}
+	OQS_SIG_key_cache_stats(cache, &stats);
+	if (stats.hits != 0 || stats.misses != 3 || stats.evictions != 2 || stats.entries != 1 || stats.bytes > entry_bytes) {
+		fprintf(stderr, "ERROR: unexpected key cache counters after eviction\n");
+		goto cleanup;
+	}
+	printf("Seed-format keys: %zu-byte seeds, %zu bytes per cached key\n", seed_len, entry_bytes);
+
+	ret = OQS_SUCCESS;
+
+cleanup:
+	OQS_SIG_key_cache_free(cache);
+	OQS_SIG_key_free(sk);
+	OQS_MEM_cleanse(seeds, sizeof seeds);
+	OQS_MEM_insecure_free(public_keys[0]);
+	OQS_MEM_insecure_free(public_keys[1]);
+	OQS_MEM_secure_free(secret_key, sig->length_secret_key);
+	OQS_MEM_secure_free(exported, sig->length_secret_key);
+	OQS_MEM_insecure_free(signature);
+	return ret;
+}
+
+/* Feeds the message to the streaming verifier in uneven chunks, then checks a modified message and an abandoned context. */
+static OQS_STATUS sig_test_verify_stream(const OQS_SIG *sig, uint8_t *message, size_t message_len,
+        const uint8_t *signature, size_t signature_len, const uint8_t *public_key) {
+	OQS_SIG_VERIFY_CTX *ctx = NULL;
+	size_t off, chunk;
+	OQS_STATUS rc;
+
+	if (!OQS_SIG_supports_verify_stream(sig->method_name)) {
+		if (OQS_SIG_verify_init(sig, &ctx, signature, signature_len, public_key) != OQS_ERROR || ctx != NULL) {
+			fprintf(stderr, "ERROR: OQS_SIG_verify_init succeeded without streaming support\n");
+			return OQS_ERROR;
+		}
+		return OQS_SUCCESS;
+	}
+
+	for (int flip = 0; flip < 2; flip++) {
+		message[message_len / 2] ^= (uint8_t) flip;
+		rc = OQS_SIG_verify_init(sig, &ctx, signature, signature_len, public_key);
+		for (off = 0, chunk = 1; rc == OQS_SUCCESS && off < message_len; off += chunk, chunk = 2 * chunk + 5) {
+			if (chunk > message_len - off) {
+				chunk = message_len - off;
+			}
+			rc = OQS_SIG_verify_update(ctx, message + off, chunk);
+		}
+		if (rc == OQS_SUCCESS) {
+			rc = OQS_SIG_verify_final(ctx);
+		}
+		OQS_SIG_VERIFY_CTX_free(ctx);
+		ctx = NULL;
+		message[message_len / 2] ^= (uint8_t) flip;
+		OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+		if (rc != (flip ? OQS_ERROR : OQS_SUCCESS)) {
+			fprintf(stderr, "ERROR: streaming verification %s\n", flip ? "succeeded on a modified message" : "failed");
+			return OQS_ERROR;
+		}
+	}
+
+	/* a context freed before OQS_SIG_verify_final() must release its hash state */
+	if (OQS_SIG_verify_init(sig, &ctx, signature, signature_len, public_key) != OQS_SUCCESS ||
+	        OQS_SIG_verify_update(ctx, message, message_len) != OQS_SUCCESS) {
+		fprintf(stderr, "ERROR: OQS_SIG_verify_init failed\n");
+		OQS_SIG_VERIFY_CTX_free(ctx);
+		return OQS_ERROR;
+	}
+	OQS_SIG_VERIFY_CTX_free(ctx);
+	return OQS_SUCCESS;
+}
+
 static OQS_STATUS sig_test_correctness(const char *method_name, bool bitflips_all[2], size_t bitflips[2], bool extended_tests) {
 
 	OQS_SIG *sig = NULL;
@@ -120,6 +380,21 @@ static OQS_STATUS sig_test_correctness(const char *method_name, bool bitflips_al
 		goto err;
 	}
 
+	rc = sig_test_key_handles(sig, public_key, secret_key, message, message_len);
+	if (rc != OQS_SUCCESS) {
+		goto err;
+	}
+
+	rc = sig_test_key_seeds(sig, message, message_len);
+	if (rc != OQS_SUCCESS) {
+		goto err;
+	}
+
+	rc = sig_test_verify_stream(sig, message, message_len, signature, signature_len, public_key);
+	if (rc != OQS_SUCCESS) {
+		goto err;
+	}
+
 	if (extended_tests) {
 		rc = test_sig_bitflip(sig, message, message_len, signature, signature_len, public_key, bitflips_all, bitflips, false, NULL, 0);
 		OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
@@ -276,6 +551,17 @@ void *test_wrapper(void *arg) {
 }
 #endif
 
+#if !defined(OQS_ENABLE_TEST_CONSTANT_TIME)
+/* Counts what the process-wide RNG hands out; the warm-up must not draw from it,
+ * except in embedded builds, which have no per-thread sources to warm up with. */
+static size_t warmup_rng_bytes = 0;
+
+static void warmup_counting_randombytes(uint8_t *random_array, size_t bytes_to_read) {
+	memset(random_array, 0, bytes_to_read);
+	warmup_rng_bytes += bytes_to_read;
+}
+#endif
+
 int main(int argc, char **argv) {
 	OQS_STATUS rc;
 	OQS_init();
@@ -341,6 +627,31 @@ int main(int argc, char **argv) {
 #ifdef OQS_ENABLE_TEST_CONSTANT_TIME
 	OQS_randombytes_custom_algorithm(&TEST_SIG_randombytes);
 #else
+	OQS_randombytes_custom_algorithm(&warmup_counting_randombytes);
+	if (OQS_SIG_warmup(alg_name) != OQS_SUCCESS) {
+		fprintf(stderr, "ERROR: OQS_SIG_warmup failed\n");
+		OQS_destroy();
+		return EXIT_FAILURE;
+	}
+#if defined(OQS_EMBEDDED_BUILD)
+	if (warmup_rng_bytes == 0) {
+		fprintf(stderr, "ERROR: OQS_SIG_warmup did not draw from the custom RNG\n");
+		OQS_destroy();
+		return EXIT_FAILURE;
+	}
+	// there is no system RNG in embedded builds
+	uint8_t entropy_input[48];
+	for (size_t i = 0; i < sizeof(entropy_input); i++) {
+		entropy_input[i] = (uint8_t)i;
+	}
+	OQS_randombytes_nist_kat_init_256bit(entropy_input, NULL);
+	OQS_randombytes_custom_algorithm(&OQS_randombytes_nist_kat);
+#else
+	if (warmup_rng_bytes != 0) {
+		fprintf(stderr, "ERROR: OQS_SIG_warmup drew %zu bytes from the RNG\n", warmup_rng_bytes);
+		OQS_destroy();
+		return EXIT_FAILURE;
+	}
 	rc = OQS_randombytes_switch_algorithm("system");
 	if (rc != OQS_SUCCESS) {
 		printf("Could not generate random data with system RNG\n");
@@ -348,6 +659,7 @@ int main(int argc, char **argv) {
 		return EXIT_FAILURE;
 	}
 #endif
+#endif
 
 #if OQS_USE_PTHREADS && !defined(OQS_ENABLE_TEST_CONSTANT_TIME)
 #define MAX_LEN_SIG_NAME_ 64
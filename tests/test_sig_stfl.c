@@ -164,6 +164,17 @@ static size_t signature_len_2;
 static uint8_t message_1[] = "The quick brown fox ...";
 static uint8_t message_2[] = "The quick brown fox jumped from the tree.";
 
+/* CPU time of the calling thread, in seconds */
+static double thread_cpu_seconds(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+	return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+/* CPU time spent by the lock holders with the key locked; both are protected by the key lock */
+static double lock_held_seconds = 0;
+static double lock_acquired_at = 0;
+
 static OQS_STATUS lock_sk_key(void *mutex) {
 	if (mutex == NULL) {
 		return OQS_ERROR;
@@ -172,6 +183,7 @@ static OQS_STATUS lock_sk_key(void *mutex) {
 	if (pthread_mutex_lock((pthread_mutex_t *)mutex)) {
 		return OQS_ERROR;
 	}
+	lock_acquired_at = thread_cpu_seconds();
 	return  OQS_SUCCESS;
 }
 
@@ -180,6 +192,7 @@ static OQS_STATUS unlock_sk_key(void *mutex) {
 		return OQS_ERROR;
 	}
 
+	lock_held_seconds += thread_cpu_seconds() - lock_acquired_at;
 	if (pthread_mutex_unlock((pthread_mutex_t *)mutex)) {
 		return OQS_ERROR;
 	}
@@ -729,6 +742,271 @@ cleanup:
 	return rc;
 }
 
+/* Enough signatures for the lowest XMSS^MT tree of height 5 to be replaced, where the key allows it */
+#define MAP_TEST_SIGNATURES 32
+
+typedef struct map_store_data {
+	size_t calls;
+	size_t bytes;
+	/* what a key file on disk would hold */
+	uint8_t *persisted;
+	size_t persisted_len;
+} map_store_data_t;
+
+static OQS_STATUS save_secret_key_range(const uint8_t *sk_buf, size_t offset, size_t len, void *context) {
+	map_store_data_t *store = context;
+	if (sk_buf == NULL || len == 0 || store == NULL || offset + len > store->persisted_len) {
+		return OQS_ERROR;
+	}
+	/* an application would msync the pages of sk_buf covering [offset, offset + len) here */
+	memcpy(store->persisted + offset, sk_buf + offset, len);
+	store->calls++;
+	store->bytes += len;
+	return OQS_SUCCESS;
+}
+
+/*
+ * Sign with a secret key used in place in application memory, as with a
+ * memory-mapped key file, and check that only changed bytes are stored.
+ */
+static OQS_STATUS sig_stfl_test_secret_key_map(const char *method_name, const char *katfile) {
+	OQS_STATUS rc = OQS_SUCCESS;
+	OQS_SIG_STFL *sig_obj = NULL;
+	OQS_SIG_STFL_SECRET_KEY *sk = NULL;
+	OQS_SIG_STFL_SECRET_KEY *sk_mapped = NULL;
+	uint8_t *public_key = NULL;
+	uint8_t *signature = NULL;
+	uint8_t *sk_buf = NULL;
+	uint8_t *sk_buf_2 = NULL;
+	size_t sk_buf_len = 0, sk_buf_len_2 = 0, signature_len = 0;
+	unsigned long long sigs_before = 0, sigs_after = 0, sigs = 0, i;
+	map_store_data_t store = {0, 0, NULL, 0};
+	uint8_t message[] = "The quick brown fox jumped over the mapped key.";
+
+	printf("================================================================================\n");
+	printf("Testing mapped stateful Secret Key %s\n", method_name);
+	printf("================================================================================\n");
+
+	sig_obj = OQS_SIG_STFL_new(method_name);
+	sk = OQS_SIG_STFL_SECRET_KEY_new(method_name);
+	sk_mapped = OQS_SIG_STFL_SECRET_KEY_new(method_name);
+	if (sig_obj == NULL || sk == NULL || sk_mapped == NULL) {
+		goto err;
+	}
+	public_key = OQS_MEM_malloc(sig_obj->length_public_key);
+	signature = OQS_MEM_malloc(sig_obj->length_signature);
+	if (public_key == NULL || signature == NULL) {
+		goto err;
+	}
+
+	if (sig_stfl_KATs_keygen(sig_obj, public_key, sk, katfile) != OQS_SUCCESS) {
+		fprintf(stderr, "OQS STFL key gen failed.\n");
+		goto err;
+	}
+
+	/* sk_buf stands in for a memory-mapped key file */
+	if (OQS_SIG_STFL_SECRET_KEY_serialize(&sk_buf, &sk_buf_len, sk) != OQS_SUCCESS) {
+		goto err;
+	}
+	store.persisted = OQS_MEM_malloc(sk_buf_len);
+	if (store.persisted == NULL) {
+		goto err;
+	}
+	memcpy(store.persisted, sk_buf, sk_buf_len);
+	store.persisted_len = sk_buf_len;
+	if (OQS_SIG_STFL_SECRET_KEY_map(sk_mapped, sk_buf, sk_buf_len, save_secret_key_range, &store) != OQS_SUCCESS) {
+		fprintf(stderr, "ERROR: OQS_SIG_STFL_SECRET_KEY_map failed\n");
+		goto err;
+	}
+	if (OQS_SIG_STFL_sigs_remaining(sig_obj, &sigs_before, sk_mapped) != OQS_SUCCESS) {
+		goto err;
+	}
+
+	/* without exhausting the key */
+	sigs = sigs_before > MAP_TEST_SIGNATURES ? MAP_TEST_SIGNATURES : sigs_before - 1;
+	for (i = 0; i < sigs; i++) {
+		if (OQS_SIG_STFL_sign(sig_obj, signature, &signature_len, message, sizeof(message), sk_mapped) != OQS_SUCCESS) {
+			fprintf(stderr, "ERROR: OQS_SIG_STFL_sign with mapped key failed\n");
+			goto err;
+		}
+		if (OQS_SIG_STFL_verify(sig_obj, message, sizeof(message), signature, signature_len, public_key) != OQS_SUCCESS) {
+			fprintf(stderr, "ERROR: OQS_SIG_STFL_verify with mapped key failed\n");
+			goto err;
+		}
+	}
+
+	if (OQS_SIG_STFL_sigs_remaining(sig_obj, &sigs_after, sk_mapped) != OQS_SUCCESS || sigs_after != sigs_before - sigs) {
+		fprintf(stderr, "ERROR: mapped key did not advance\n");
+		goto err;
+	}
+	if (store.calls == 0 || store.bytes >= sigs * sk_buf_len) {
+		fprintf(stderr, "ERROR: mapped key stored %zu bytes in %zu ranges\n", store.bytes, store.calls);
+		goto err;
+	}
+	printf("Stored %zu bytes in %zu ranges of a %zu byte key in %llu signatures\n", store.bytes, store.calls, sk_buf_len, sigs);
+
+	/* Every modified byte has been stored */
+	if (memcmp(store.persisted, sk_buf, sk_buf_len) != 0) {
+		fprintf(stderr, "ERROR: mapped key modified outside the stored ranges\n");
+		goto err;
+	}
+
+	/* The mapped memory holds the whole updated key */
+	if (OQS_SIG_STFL_SECRET_KEY_serialize(&sk_buf_2, &sk_buf_len_2, sk_mapped) != OQS_SUCCESS ||
+	        sk_buf_len_2 != sk_buf_len || memcmp(sk_buf, sk_buf_2, sk_buf_len) != 0) {
+		fprintf(stderr, "ERROR: mapped key differs from its serialization\n");
+		goto err;
+	}
+
+	goto cleanup;
+
+err:
+	rc = OQS_ERROR;
+cleanup:
+	/* free the mapped key before the memory it uses */
+	OQS_SIG_STFL_SECRET_KEY_free(sk_mapped);
+	OQS_SIG_STFL_SECRET_KEY_free(sk);
+	OQS_MEM_secure_free(sk_buf, sk_buf_len);
+	OQS_MEM_secure_free(sk_buf_2, sk_buf_len_2);
+	OQS_MEM_secure_free(store.persisted, store.persisted_len);
+	OQS_MEM_insecure_free(public_key);
+	OQS_MEM_insecure_free(signature);
+	OQS_SIG_STFL_free(sig_obj);
+	return rc;
+}
+
+/*
+ * Sign and verify a message passed in pieces, and check that the streaming
+ * and one-shot functions accept each other's signatures.
+ */
+static OQS_STATUS sig_stfl_test_streaming(const char *method_name, const char *katfile) {
+	OQS_STATUS rc = OQS_SUCCESS;
+	OQS_SIG_STFL *sig_obj = NULL;
+	OQS_SIG_STFL_SECRET_KEY *sk = NULL;
+	OQS_SIG_STFL_SIGN_CTX *sign_ctx = NULL;
+	OQS_SIG_STFL_VERIFY_CTX *verify_ctx = NULL;
+	uint8_t *public_key = NULL;
+	uint8_t *signature = NULL;
+	uint8_t *message = NULL;
+	char *context = NULL;
+	size_t signature_len = 0, off, len;
+	const size_t message_len = 5000;
+	const size_t pieces[] = {1, 7, 64, 135, 1000};
+	unsigned long long sigs_before = 0, sigs_after = 0;
+	int i;
+
+	printf("================================================================================\n");
+	printf("Testing streaming stateful Signature %s\n", method_name);
+	printf("================================================================================\n");
+
+	sig_obj = OQS_SIG_STFL_new(method_name);
+	sk = OQS_SIG_STFL_SECRET_KEY_new(method_name);
+	if (sig_obj == NULL || sk == NULL) {
+		goto err;
+	}
+	public_key = OQS_MEM_malloc(sig_obj->length_public_key);
+	signature = OQS_MEM_malloc(sig_obj->length_signature);
+	message = OQS_MEM_malloc(message_len);
+	if (public_key == NULL || signature == NULL || message == NULL) {
+		goto err;
+	}
+	OQS_randombytes(message, message_len);
+
+	if (sig_stfl_KATs_keygen(sig_obj, public_key, sk, katfile) != OQS_SUCCESS) {
+		fprintf(stderr, "OQS STFL key gen failed.\n");
+		goto err;
+	}
+	context = convert_method_name_to_file_name(method_name);
+	OQS_SIG_STFL_SECRET_KEY_SET_store_cb(sk, save_secret_key, (void *)context);
+
+	/* Sign in pieces of varying size; the key is used up by sign_init */
+	if (OQS_SIG_STFL_sigs_remaining(sig_obj, &sigs_before, sk) != OQS_SUCCESS ||
+	        OQS_SIG_STFL_sign_init(sig_obj, &sign_ctx, sk) != OQS_SUCCESS ||
+	        OQS_SIG_STFL_sigs_remaining(sig_obj, &sigs_after, sk) != OQS_SUCCESS || sigs_after != sigs_before - 1) {
+		fprintf(stderr, "ERROR: OQS_SIG_STFL_sign_init failed\n");
+		goto err;
+	}
+	for (off = 0, i = 0; off < message_len; off += len, i++) {
+		len = pieces[i % (sizeof(pieces) / sizeof(pieces[0]))];
+		len = len < message_len - off ? len : message_len - off;
+		if (OQS_SIG_STFL_sign_update(sign_ctx, message + off, len) != OQS_SUCCESS) {
+			fprintf(stderr, "ERROR: OQS_SIG_STFL_sign_update failed\n");
+			goto err;
+		}
+	}
+	if (OQS_SIG_STFL_sign_final(sign_ctx, signature, &signature_len) != OQS_SUCCESS) {
+		fprintf(stderr, "ERROR: OQS_SIG_STFL_sign_final failed\n");
+		goto err;
+	}
+	if (OQS_SIG_STFL_verify(sig_obj, message, message_len, signature, signature_len, public_key) != OQS_SUCCESS) {
+		fprintf(stderr, "ERROR: streaming signature does not verify\n");
+		goto err;
+	}
+
+	/* Verify a one-shot signature in pieces */
+	if (OQS_SIG_STFL_sign(sig_obj, signature, &signature_len, message, message_len, sk) != OQS_SUCCESS) {
+		fprintf(stderr, "ERROR: OQS_SIG_STFL_sign failed\n");
+		goto err;
+	}
+	if (OQS_SIG_STFL_verify_init(sig_obj, &verify_ctx, signature, signature_len, public_key) != OQS_SUCCESS) {
+		fprintf(stderr, "ERROR: OQS_SIG_STFL_verify_init failed\n");
+		goto err;
+	}
+	for (off = 0, i = 0; off < message_len; off += len, i++) {
+		len = pieces[(i + 2) % (sizeof(pieces) / sizeof(pieces[0]))];
+		len = len < message_len - off ? len : message_len - off;
+		if (OQS_SIG_STFL_verify_update(verify_ctx, message + off, len) != OQS_SUCCESS) {
+			fprintf(stderr, "ERROR: OQS_SIG_STFL_verify_update failed\n");
+			goto err;
+		}
+	}
+	if (OQS_SIG_STFL_verify_final(verify_ctx) != OQS_SUCCESS) {
+		fprintf(stderr, "ERROR: streaming verification failed\n");
+		goto err;
+	}
+	OQS_SIG_STFL_VERIFY_CTX_free(verify_ctx);
+	verify_ctx = NULL;
+
+	/* A changed message must not verify */
+	message[message_len / 2] ^= 1;
+	if (OQS_SIG_STFL_verify_init(sig_obj, &verify_ctx, signature, signature_len, public_key) != OQS_SUCCESS ||
+	        OQS_SIG_STFL_verify_update(verify_ctx, message, message_len) != OQS_SUCCESS ||
+	        OQS_SIG_STFL_verify_final(verify_ctx) == OQS_SUCCESS) {
+		fprintf(stderr, "ERROR: streaming verification accepted a changed message\n");
+		goto err;
+	}
+
+	/* An abandoned signature still uses up its one-time key */
+	OQS_SIG_STFL_SIGN_CTX_free(sign_ctx);
+	sign_ctx = NULL;
+	if (OQS_SIG_STFL_sigs_remaining(sig_obj, &sigs_before, sk) != OQS_SUCCESS ||
+	        OQS_SIG_STFL_sign_init(sig_obj, &sign_ctx, sk) != OQS_SUCCESS ||
+	        OQS_SIG_STFL_sign_update(sign_ctx, message, 10) != OQS_SUCCESS) {
+		goto err;
+	}
+	OQS_SIG_STFL_SIGN_CTX_free(sign_ctx);
+	sign_ctx = NULL;
+	if (OQS_SIG_STFL_sigs_remaining(sig_obj, &sigs_after, sk) != OQS_SUCCESS || sigs_after != sigs_before - 1) {
+		fprintf(stderr, "ERROR: abandoned streaming signature did not use up its key\n");
+		goto err;
+	}
+
+	goto cleanup;
+
+err:
+	rc = OQS_ERROR;
+cleanup:
+	OQS_SIG_STFL_SIGN_CTX_free(sign_ctx);
+	OQS_SIG_STFL_VERIFY_CTX_free(verify_ctx);
+	OQS_SIG_STFL_SECRET_KEY_free(sk);
+	OQS_MEM_insecure_free(public_key);
+	OQS_MEM_insecure_free(signature);
+	OQS_MEM_insecure_free(message);
+	OQS_MEM_insecure_free(context);
+	OQS_SIG_STFL_free(sig_obj);
+	return rc;
+}
+
 #ifdef OQS_ENABLE_TEST_CONSTANT_TIME
 static void TEST_SIG_STFL_randombytes(uint8_t *random_array, size_t bytes_to_read) {
 	// We can't make direct calls to the system randombytes on some platforms,
@@ -977,6 +1255,114 @@ err:
 }
 
 
+#define CONCURRENT_SIGNERS 4
+
+typedef struct concurrent_sign_data {
+	uint8_t *signature;
+	size_t signature_len;
+	double cpu_seconds;
+	OQS_STATUS rc;
+} concurrent_sign_data_t;
+
+static void *concurrent_sign(void *arg) {
+	concurrent_sign_data_t *cd = arg;
+	double start = thread_cpu_seconds();
+	cd->rc = OQS_SIG_STFL_sign_concurrent(lock_test_sig_obj, cd->signature, &cd->signature_len, message_1, sizeof(message_1), lock_test_sk);
+	cd->cpu_seconds = thread_cpu_seconds() - start;
+	OQS_thread_stop();
+	return NULL;
+}
+
+/*
+ * Sign from several threads at once with the key of the lock tests. Each signer
+ * must get its own one-time key, so every signature verifies and the number of
+ * remaining signatures drops by the number of signers.
+ */
+static OQS_STATUS sig_stfl_test_sign_concurrent(const char *method_name) {
+	OQS_STATUS rc = OQS_SUCCESS;
+	concurrent_sign_data_t cd[CONCURRENT_SIGNERS];
+	pthread_t threads[CONCURRENT_SIGNERS];
+	unsigned long long sigs_before = 0, sigs_after = 0;
+	size_t i, started = 0;
+
+	printf("================================================================================\n");
+	printf("Testing concurrent stateful Signature Generation %s\n", method_name);
+	printf("================================================================================\n");
+
+	if (lock_test_sk == NULL || lock_test_sig_obj == NULL) {
+		return OQS_ERROR;
+	}
+
+	if (OQS_SIG_STFL_sigs_remaining(lock_test_sig_obj, &sigs_before, lock_test_sk) != OQS_SUCCESS) {
+		return OQS_ERROR;
+	}
+	if (sigs_before < CONCURRENT_SIGNERS) {
+		printf("Not enough signatures left, skipping.\n");
+		return OQS_SUCCESS;
+	}
+
+	/* the store context of sig_stfl_test_sig_gen has been freed */
+	OQS_SIG_STFL_SECRET_KEY_SET_store_cb(lock_test_sk, save_secret_key, (void *)lock_test_context);
+
+	for (i = 0; i < CONCURRENT_SIGNERS; i++) {
+		cd[i].signature = OQS_MEM_malloc(lock_test_sig_obj->length_signature);
+		cd[i].signature_len = 0;
+		cd[i].cpu_seconds = 0;
+		cd[i].rc = OQS_ERROR;
+	}
+	lock_held_seconds = 0;
+	for (i = 0; i < CONCURRENT_SIGNERS; i++) {
+		if (cd[i].signature == NULL || pthread_create(&threads[i], NULL, concurrent_sign, &cd[i])) {
+			fprintf(stderr, "ERROR: Creating pthread for concurrent_sign\n");
+			rc = OQS_ERROR;
+			break;
+		}
+		started++;
+	}
+	for (i = 0; i < started; i++) {
+		pthread_join(threads[i], NULL);
+	}
+
+	for (i = 0; i < started && rc == OQS_SUCCESS; i++) {
+		if (cd[i].rc != OQS_SUCCESS) {
+			fprintf(stderr, "ERROR: OQS_SIG_STFL_sign_concurrent failed\n");
+			rc = OQS_ERROR;
+		} else if (OQS_SIG_STFL_verify(lock_test_sig_obj, message_1, sizeof(message_1), cd[i].signature, cd[i].signature_len, lock_test_public_key) != OQS_SUCCESS) {
+			fprintf(stderr, "ERROR: OQS_SIG_STFL_verify failed on a concurrent signature\n");
+			rc = OQS_ERROR;
+		}
+	}
+
+	if (rc == OQS_SUCCESS) {
+		if (OQS_SIG_STFL_sigs_remaining(lock_test_sig_obj, &sigs_after, lock_test_sk) != OQS_SUCCESS ||
+		        sigs_after != sigs_before - CONCURRENT_SIGNERS) {
+			fprintf(stderr, "ERROR: concurrent signers did not each use one signature\n");
+			rc = OQS_ERROR;
+		}
+	}
+
+	/*
+	 * Only copying the advanced state into the key and storing it may run under the key
+	 * lock; the tree traversal and the one-time signature must run outside it.
+	 */
+	if (rc == OQS_SUCCESS) {
+		double sign_seconds = 0;
+		for (i = 0; i < CONCURRENT_SIGNERS; i++) {
+			sign_seconds += cd[i].cpu_seconds;
+		}
+		printf("Key lock held for %.1f%% of the signing time\n", sign_seconds > 0 ? 100 * lock_held_seconds / sign_seconds : 0.0);
+		if (2 * lock_held_seconds > sign_seconds) {
+			fprintf(stderr, "ERROR: concurrent signers held the key lock for most of the signing time\n");
+			rc = OQS_ERROR;
+		}
+	}
+
+	for (i = 0; i < CONCURRENT_SIGNERS; i++) {
+		OQS_MEM_insecure_free(cd[i].signature);
+	}
+	return rc;
+}
+
 typedef struct thread_data {
 	const char *alg_name;
 	const char *katfile;
@@ -1063,7 +1449,7 @@ static OQS_STATUS update_test_result( OQS_STATUS rc, int xmss_or_lms) {
 }
 
 int main(int argc, char **argv) {
-	OQS_STATUS  rc = OQS_ERROR, rc1 = OQS_ERROR;
+	OQS_STATUS  rc = OQS_ERROR, rc1 = OQS_ERROR, rc2 = OQS_ERROR, rc3 = OQS_ERROR;
 	OQS_init();
 	rc = oqs_fstore_init();
 	if (rc != OQS_SUCCESS) {
@@ -1158,7 +1544,7 @@ int main(int argc, char **argv) {
 
 #if OQS_USE_PTHREADS_IN_TESTS
 #define MAX_LEN_SIG_NAME_ 64
-	OQS_STATUS rc_create = OQS_ERROR, rc_sign = OQS_ERROR, rc_query = OQS_ERROR;
+	OQS_STATUS rc_create = OQS_ERROR, rc_sign = OQS_ERROR, rc_query = OQS_ERROR, rc_concurrent = OQS_ERROR;
 
 	pthread_t thread;
 	pthread_t create_key_thread;
@@ -1205,6 +1591,12 @@ int main(int argc, char **argv) {
 	rc1 = td_2.rc;
 	rc1 = update_test_result(rc1, is_xmss);
 
+	rc2 = sig_stfl_test_secret_key_map(alg_name, katfile);
+	rc2 = update_test_result(rc2, is_xmss);
+
+	rc3 = sig_stfl_test_streaming(alg_name, katfile);
+	rc3 = update_test_result(rc3, is_xmss);
+
 	if (pthread_create(&create_key_thread, NULL, test_create_keys, &td_create)) {
 		fprintf(stderr, "ERROR: Creating pthread for test_create_keys\n");
 		exit_status = EXIT_FAILURE;
@@ -1232,6 +1624,9 @@ int main(int argc, char **argv) {
 	rc_query = td_query.rc;
 	rc_query = update_test_result(rc_query, is_xmss);
 
+	rc_concurrent = sig_stfl_test_sign_concurrent(alg_name);
+	rc_concurrent = update_test_result(rc_concurrent, is_xmss);
+
 err:
 	if (test_sk_lock) {
 		pthread_mutex_destroy(test_sk_lock);
@@ -1248,12 +1643,12 @@ err:
 	OQS_MEM_insecure_free(signature_2);
 
 	OQS_destroy();
-	if (rc != OQS_SUCCESS || rc1 != OQS_SUCCESS) {
+	if (rc != OQS_SUCCESS || rc1 != OQS_SUCCESS || rc2 != OQS_SUCCESS || rc3 != OQS_SUCCESS) {
 		return EXIT_FAILURE;
 	}
 
 #if OQS_USE_PTHREADS_IN_TESTS
-	if (rc_create != OQS_SUCCESS || rc_sign != OQS_SUCCESS || rc_query != OQS_SUCCESS) {
+	if (rc_create != OQS_SUCCESS || rc_sign != OQS_SUCCESS || rc_query != OQS_SUCCESS || rc_concurrent != OQS_SUCCESS) {
 		return EXIT_FAILURE;
 	}
 #endif
@@ -1261,13 +1656,17 @@ err:
 #else
 	rc = sig_stfl_test_correctness(alg_name, katfile, bitflips_all, bitflips);
 	rc1 = sig_stfl_test_secret_key(alg_name, katfile);
+	rc2 = sig_stfl_test_secret_key_map(alg_name, katfile);
+	rc3 = sig_stfl_test_streaming(alg_name, katfile);
 
 	OQS_destroy();
 	rc = update_test_result(rc, is_xmss);
 	rc1 = update_test_result(rc1, is_xmss);
+	rc2 = update_test_result(rc2, is_xmss);
+	rc3 = update_test_result(rc3, is_xmss);
 
 
-	if (rc != OQS_SUCCESS || rc1 != OQS_SUCCESS) {
+	if (rc != OQS_SUCCESS || rc1 != OQS_SUCCESS || rc2 != OQS_SUCCESS || rc3 != OQS_SUCCESS) {
 		return EXIT_FAILURE;
 	}
 	return exit_status;
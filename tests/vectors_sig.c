@@ -274,6 +274,16 @@ static OQS_STATUS sig_kg_vector(const char *method_name,
 	} else {
 		ret = OQS_ERROR;
 		fprintf(stderr, "[vectors_sig] %s ERROR: public key or private key doesn't match!\n", method_name);
+		goto cleanup;
+	}
+
+	/* for ML-DSA the randomness of key generation is the seed xi */
+	if (is_ml_dsa(method_name)) {
+		rc = OQS_SIG_keypair_from_seed(sig, public_key, secret_key, prng_output_stream);
+		if (rc != OQS_SUCCESS || memcmp(public_key, kg_pk, sig->length_public_key) || memcmp(secret_key, kg_sk, sig->length_secret_key)) {
+			ret = OQS_ERROR;
+			fprintf(stderr, "[vectors_sig] %s ERROR: OQS_SIG_keypair_from_seed doesn't match!\n", method_name);
+		}
 	}
 	goto cleanup;
 